@@ -67,7 +67,7 @@ void routeCommand(FirmwareContext& ctx, uint16_t seq, const std::vector<uint8_t>
   }
 }
 
-constexpr std::array<CommandRoute, 14> COMMAND_ROUTES{{
+constexpr std::array<CommandRoute, 15> COMMAND_ROUTES{{
     {CommandCode::SET_POWER_RELAY, exactPayloadPolicyFromMetadata(CommandCode::SET_POWER_RELAY), routeCommand<handleSetPowerRelayCommand>},
     {CommandCode::SET_SERVOS_ENABLED, exactPayloadPolicyFromMetadata(CommandCode::SET_SERVOS_ENABLED), routeCommand<handleSetServosEnabledCommand>},
     {CommandCode::GET_SERVOS_ENABLED, exactPayloadPolicyFromMetadata(CommandCode::GET_SERVOS_ENABLED), routeCommand<handleGetServosEnabledCommand>},
@@ -82,6 +82,7 @@ constexpr std::array<CommandRoute, 14> COMMAND_ROUTES{{
     {CommandCode::SET_ANGLE_CALIBRATIONS, exactPayloadPolicyFromMetadata(CommandCode::SET_ANGLE_CALIBRATIONS), routeCommand<handleCalibCommand>},
     {CommandCode::SET_TARGET_ANGLE, exactPayloadPolicyFromMetadata(CommandCode::SET_TARGET_ANGLE), routeCommand<handleSetAngleCommand>},
     {CommandCode::SET_JOINT_TARGETS, exactPayloadPolicyFromMetadata(CommandCode::SET_JOINT_TARGETS), routeCommand<handleSetJointTargetsCommand>},
+    {CommandCode::SET_JOINT_TARGETS_GET_STATE, exactPayloadPolicyFromMetadata(CommandCode::SET_JOINT_TARGETS_GET_STATE), routeCommand<handleSetJointTargetsGetStateCommand>},
 }};
 
 bool handleKnownActiveCommand(FirmwareContext& ctx, const DecodedPacket& packet, CommandCode command)
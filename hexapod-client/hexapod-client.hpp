@@ -42,6 +42,9 @@ void handleGetVoltageCommand(FirmwareContext& ctx, uint16_t seq);
 void handleGetSensorCommand(FirmwareContext& ctx, uint16_t seq, const std::vector<uint8_t>& payload);
 void handleSetJointTargetsCommand(FirmwareContext& ctx, uint16_t seq, const std::vector<uint8_t>& payload);
 void handleGetFullHardwareStateCommand(FirmwareContext& ctx, uint16_t seq);
+void handleSetJointTargetsGetStateCommand(FirmwareContext& ctx, uint16_t seq, const std::vector<uint8_t>& payload);
+// Decodes and applies a joint-targets payload; NACKs and returns false when it is malformed.
+bool applyJointTargetsPayload(FirmwareContext& ctx, uint16_t seq, const std::vector<uint8_t>& payload);
 void handleSetServosEnabledCommand(FirmwareContext& ctx, uint16_t seq, const std::vector<uint8_t>& payload);
 void handleGetServosEnabledCommand(FirmwareContext& ctx, uint16_t seq);
 void handleSetServosToMidCommand(FirmwareContext& ctx, uint16_t seq);
@@ -79,7 +79,7 @@ void calibServos(FirmwareContext& ctx, float calibs[kProtocolJointCount][kProtoc
   return;
 }
 
-void handleSetJointTargetsCommand(FirmwareContext& ctx, uint16_t seq, const std::vector<uint8_t>& payload)
+bool applyJointTargetsPayload(FirmwareContext& ctx, uint16_t seq, const std::vector<uint8_t>& payload)
 {
   protocol::JointTargets target_positions{};
   if(!payload::expect_payload_or_report(payload,
@@ -90,7 +90,7 @@ void handleSetJointTargetsCommand(FirmwareContext& ctx, uint16_t seq, const std:
                                           nackInvalidPayloadLength(ctx, seq, status);
                                         }))
   {
-    return;
+    return false;
   }
 
   for (std::size_t s = 0; s < kProtocolJointCount; ++s)
@@ -98,6 +98,22 @@ void handleSetJointTargetsCommand(FirmwareContext& ctx, uint16_t seq, const std:
     ctx.servos.value(static_cast<int>(s), target_positions[s]);
     ctx.jointTargetPositionsRad[s] = target_positions[s];
   }
+  return true;
+}
+
+void handleSetJointTargetsCommand(FirmwareContext& ctx, uint16_t seq, const std::vector<uint8_t>& payload)
+{
+  if(!applyJointTargetsPayload(ctx, seq, payload))
+    return;
 
   ctx.serial.send_packet(seq, ACK, {});
 }
+
+void handleSetJointTargetsGetStateCommand(FirmwareContext& ctx, uint16_t seq, const std::vector<uint8_t>& payload)
+{
+  if(!applyJointTargetsPayload(ctx, seq, payload))
+    return;
+
+  // One bus transaction per host cycle: the ACK carries the state sampled after the new targets.
+  handleGetFullHardwareStateCommand(ctx, seq);
+}
@@ -65,6 +65,30 @@ bool test_active_unknown_command_sends_unsupported_nack()
                 "unknown command should use UNSUPPORTED_COMMAND");
 }
 
+bool test_active_set_joint_targets_get_state_is_routed()
+{
+  FirmwareContext ctx{};
+  ctx.state = HexapodState::ACTIVE;
+
+  protocol::JointTargets targets{};
+  targets.fill(0.4f);
+  handleActivePacket(ctx,
+                     DecodedPacket{21, as_u8(CommandCode::SET_JOINT_TARGETS_GET_STATE),
+                                   protocol::encode_joint_targets(targets)});
+
+  const auto* packet = last_packet(ctx);
+  if(!expect(packet != nullptr && packet->seq == 21 && packet->cmd == ACK, "combined command should ACK"))
+    return false;
+  if(!expect(packet->payload.size() == kProtocolFullStatePayloadBytes, "combined ACK should carry full state"))
+    return false;
+
+  handleActivePacket(ctx, DecodedPacket{22, as_u8(CommandCode::SET_JOINT_TARGETS_GET_STATE), {}});
+  packet = last_packet(ctx);
+  return expect(packet != nullptr && packet->cmd == NACK && packet->payload.size() == 1 &&
+                    packet->payload[0] == INVALID_PAYLOAD_LENGTH,
+                "combined command without targets should NACK with INVALID_PAYLOAD_LENGTH");
+}
+
 bool test_host_liveness_timeout_transitions_to_safe_waiting_state()
 {
   FirmwareContext ctx{};
@@ -95,6 +119,8 @@ int main()
     return EXIT_FAILURE;
   if(!test_active_unknown_command_sends_unsupported_nack())
     return EXIT_FAILURE;
+  if(!test_active_set_joint_targets_get_state_is_routed())
+    return EXIT_FAILURE;
   if(!test_host_liveness_timeout_transitions_to_safe_waiting_state())
     return EXIT_FAILURE;
 
@@ -154,6 +154,48 @@ bool test_set_joint_targets_invalid_payload_length_nack()
                 "expected INVALID_PAYLOAD_LENGTH nack");
 }
 
+bool test_set_joint_targets_get_state_applies_targets_and_replies_with_state()
+{
+  FirmwareContext ctx{};
+  ctx.softwareAngleFeedbackEstimatorEnabled = true;
+  ctx.vol_adc.voltage = 11.5f;
+  ctx.cur_adc.current = 2.25f;
+  protocol::JointTargets targets{};
+  for(std::size_t i = 0; i < targets.size(); ++i)
+    targets[i] = 0.05f * static_cast<float>(i) - 0.3f;
+
+  handleSetJointTargetsGetStateCommand(ctx, 31, protocol::encode_joint_targets(targets));
+
+  if(!expect(ctx.serial.sent_packets.size() == 1, "combined command should send exactly one reply"))
+    return false;
+  if(!expect_last_packet(ctx, 31, ACK))
+    return false;
+
+  protocol::FullHardwareState decoded{};
+  if(!expect(protocol::decode_full_hardware_state(last_packet(ctx)->payload, decoded),
+             "expected full hardware state payload in combined ACK"))
+    return false;
+
+  for(std::size_t i = 0; i < targets.size(); ++i)
+  {
+    if(!expect(std::fabs(ctx.servos.value(static_cast<int>(i)) - targets[i]) < 1e-6f,
+               "expected combined command to apply servo targets"))
+      return false;
+    if(!expect(std::fabs(decoded.joint_positions_rad[i] - targets[i]) < 1e-6f,
+               "expected reply to be sampled after the new targets were applied"))
+      return false;
+  }
+
+  if(!expect(decoded.voltage == 11.5f && decoded.current == 2.25f, "expected voltage and current in reply"))
+    return false;
+
+  handleSetJointTargetsGetStateCommand(ctx, 32, std::vector<uint8_t>(kProtocolJointTargetsPayloadBytes + 1, 0));
+  if(!expect_last_packet(ctx, 32, NACK))
+    return false;
+  return expect(last_packet(ctx)->payload.size() == 1 && last_packet(ctx)->payload[0] == INVALID_PAYLOAD_LENGTH,
+                "expected INVALID_PAYLOAD_LENGTH nack for malformed combined payload");
+}
+
 bool test_set_angle_calibrations_valid_ack_and_updates_calibration()
 {
   FirmwareContext ctx{};
@@ -328,6 +370,8 @@ int main()
     return EXIT_FAILURE;
   if(!test_set_joint_targets_invalid_payload_length_nack())
     return EXIT_FAILURE;
+  if(!test_set_joint_targets_get_state_applies_targets_and_replies_with_state())
+    return EXIT_FAILURE;
   if(!test_set_angle_calibrations_valid_ack_and_updates_calibration())
     return EXIT_FAILURE;
   if(!test_set_angle_calibrations_malformed_buffer_nack())
@@ -0,0 +1,168 @@
+#pragma once
+
+// Binary UDP telemetry from hexapod-server to the visualisers, sent alongside the JSON packets on the
+// same port (see telemetry_json.hpp). One message per datagram, no fragmentation. Little-endian wire
+// layout; trivially copyable sub-structs, modelled on minphys_viz_protocol.hpp.
+//
+// Leg arrays use the visualiser order LF, LM, LR, RF, RM, RR (the JSON `angles_deg` keys). Joint angles
+// are degrees in coxa, femur, tibia order. Geometry is not part of this family: receivers keep using the
+// JSON `geometry` packet, which the server re-sends periodically.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace hexapod_telemetry {
+
+inline constexpr char kMagic0 = 'H';
+inline constexpr char kMagic1 = 'X';
+inline constexpr char kMagic2 = 'T';
+inline constexpr char kMagic3 = '1';
+inline constexpr std::uint16_t kWireVersion = 1;
+inline constexpr std::size_t kLegCount = 6;
+inline constexpr std::size_t kJointsPerLeg = 3;
+
+enum class TelemetryMessageKind : std::uint8_t {
+    ControlFrame = 0,
+    FusionSummary = 1,
+    NavigationSummary = 2,
+};
+
+// TelemetryControlFrameBody::flags
+inline constexpr std::uint8_t kFrameFlagBusOk = 1u << 0;
+inline constexpr std::uint8_t kFrameFlagEstimatorValid = 1u << 1;
+inline constexpr std::uint8_t kFrameFlagHasBodyPose = 1u << 2;
+
+// TelemetryFusionSummaryBody::flags
+inline constexpr std::uint8_t kFusionFlagHasData = 1u << 0;
+inline constexpr std::uint8_t kFusionFlagResyncRequested = 1u << 1;
+inline constexpr std::uint8_t kFusionFlagHardResetRequested = 1u << 2;
+inline constexpr std::uint8_t kFusionFlagPredictiveMode = 1u << 3;
+
+// TelemetryNavigationSummaryBody::flags
+inline constexpr std::uint8_t kNavFlagMapFresh = 1u << 0;
+inline constexpr std::uint8_t kNavFlagActive = 1u << 1;
+inline constexpr std::uint8_t kNavFlagPaused = 1u << 2;
+
+#pragma pack(push, 1)
+
+struct TelemetryWireHeader {
+    char magic[4]{kMagic0, kMagic1, kMagic2, kMagic3};
+    std::uint16_t wire_version{kWireVersion};
+    std::uint8_t message_kind{0};
+    std::uint8_t reserved0{0};
+};
+
+struct TelemetryVec3f {
+    float x{0.0f};
+    float y{0.0f};
+    float z{0.0f};
+};
+
+/// Sent every control step. `sequence` counts frames sent so receivers can measure loss.
+struct TelemetryControlFrameBody {
+    std::uint64_t timestamp_us{0};
+    std::uint32_t sequence{0};
+    std::uint32_t loop_counter{0};
+    std::uint8_t active_mode{0};   // RobotMode
+    std::uint8_t active_fault{0};  // FaultCode
+    std::uint8_t flags{0};         // kFrameFlag*
+    std::uint8_t contact_mask{0};  // bit i = raw foot contact of leg i
+    float voltage{0.0f};
+    float current{0.0f};
+    float commanded_angles_deg[kLegCount][kJointsPerLeg]{};
+    float measured_angles_deg[kLegCount][kJointsPerLeg]{};
+    TelemetryVec3f body_position_m{};
+    TelemetryVec3f body_orientation_rad{};
+    std::uint8_t contact_phase[kLegCount]{};  // ContactPhase
+    std::uint8_t reserved1[2]{};
+    float contact_confidence[kLegCount]{};
+};
+
+struct TelemetryFusionSummaryBody {
+    std::uint64_t timestamp_us{0};
+    std::uint8_t flags{0};  // kFusionFlag*
+    std::uint8_t reserved0[3]{};
+    float model_trust{0.0f};
+    float max_body_position_error_m{0.0f};
+    float max_body_orientation_error_rad{0.0f};
+    float contact_mismatch_ratio{0.0f};
+    float terrain_residual_m{0.0f};
+};
+
+struct TelemetryNavigationSummaryBody {
+    std::uint64_t timestamp_us{0};
+    std::uint8_t lifecycle{0};       // NavigationLifecycleState
+    std::uint8_t planner_status{0};  // LocalPlanStatus
+    std::uint8_t block_reason{0};    // PlannerBlockReason
+    std::uint8_t flags{0};           // kNavFlag*
+    std::uint32_t replan_count{0};
+    std::uint32_t active_segment_waypoint_count{0};
+    float active_segment_length_m{0.0f};
+    float nearest_obstacle_distance_m{-1.0f};
+};
+
+#pragma pack(pop)
+
+static_assert(std::is_trivially_copyable_v<TelemetryWireHeader>);
+static_assert(std::is_trivially_copyable_v<TelemetryControlFrameBody>);
+static_assert(std::is_trivially_copyable_v<TelemetryFusionSummaryBody>);
+static_assert(std::is_trivially_copyable_v<TelemetryNavigationSummaryBody>);
+static_assert(sizeof(TelemetryWireHeader) == 8);
+static_assert(sizeof(TelemetryControlFrameBody) == 228);
+static_assert(sizeof(TelemetryFusionSummaryBody) == 32);
+static_assert(sizeof(TelemetryNavigationSummaryBody) == 28);
+
+inline bool IsTelemetryBinaryPayload(const void* data, std::size_t len) {
+    if (len < sizeof(TelemetryWireHeader)) {
+        return false;
+    }
+    const auto* h = static_cast<const TelemetryWireHeader*>(data);
+    return h->magic[0] == kMagic0 && h->magic[1] == kMagic1 && h->magic[2] == kMagic2 && h->magic[3] == kMagic3
+        && h->wire_version == kWireVersion;
+}
+
+namespace detail {
+
+template <typename Body>
+inline void EncodeMessage(std::vector<std::uint8_t>& out, TelemetryMessageKind kind, const Body& body) {
+    TelemetryWireHeader hdr{};
+    hdr.message_kind = static_cast<std::uint8_t>(kind);
+    out.resize(sizeof(hdr) + sizeof(body));
+    std::memcpy(out.data(), &hdr, sizeof(hdr));
+    std::memcpy(out.data() + sizeof(hdr), &body, sizeof(body));
+}
+
+}  // namespace detail
+
+/// Each encoder replaces `out` with one datagram; reusing `out` keeps steady-state encoding allocation-free.
+inline void EncodeControlFrame(std::vector<std::uint8_t>& out, const TelemetryControlFrameBody& body) {
+    detail::EncodeMessage(out, TelemetryMessageKind::ControlFrame, body);
+}
+
+inline void EncodeFusionSummary(std::vector<std::uint8_t>& out, const TelemetryFusionSummaryBody& body) {
+    detail::EncodeMessage(out, TelemetryMessageKind::FusionSummary, body);
+}
+
+inline void EncodeNavigationSummary(std::vector<std::uint8_t>& out, const TelemetryNavigationSummaryBody& body) {
+    detail::EncodeMessage(out, TelemetryMessageKind::NavigationSummary, body);
+}
+
+/// Copies the body of a datagram of the given kind into `body`. False on a short or mismatched datagram.
+template <typename Body>
+inline bool DecodeMessage(const void* data, std::size_t len, TelemetryMessageKind kind, Body& body) {
+    if (!IsTelemetryBinaryPayload(data, len) || len < sizeof(TelemetryWireHeader) + sizeof(Body)) {
+        return false;
+    }
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    if (bytes[offsetof(TelemetryWireHeader, message_kind)] != static_cast<std::uint8_t>(kind)) {
+        return false;
+    }
+    std::memcpy(&body, bytes + sizeof(TelemetryWireHeader), sizeof(Body));
+    return true;
+}
+
+}  // namespace hexapod_telemetry
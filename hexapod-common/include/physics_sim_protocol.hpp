@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -9,6 +10,10 @@
 // Binary UDP protocol between hexapod-server (client) and hexapod-physics-sim --serve (host).
 // All structs are packed; wire format is little-endian (native on supported targets).
 // Scalar fields on the wire are float32; minphys3d uses double internally — convert at the sim boundary.
+//
+// Every message ends with `env_index`: `hexapod-physics-sim --serve --serve-envs N` hosts N independent
+// worlds behind one port and routes each message to world `env_index` (responses echo it). A plain
+// `--serve` host has a single environment, index 0.
 
 namespace physics_sim {
 
@@ -77,6 +82,7 @@ struct StepCommand {
     std::uint32_t sequence_id{0};
     float dt_seconds{0.0f};
     std::array<float, 18> joint_targets{}; // radians, sim servo order (6 legs × 3 joints)
+    std::uint16_t env_index{0};
 };
 
 struct ObstacleFootprint {
@@ -108,6 +114,7 @@ struct StateResponse {
     /// Capture timestamp for the LiDAR frame. Repeated responses reuse the last frame timestamp.
     std::uint64_t matrix_lidar_timestamp_us{0};
     std::array<std::uint16_t, kMatrixLidarMaxCells> matrix_lidar_ranges_mm{};
+    std::uint16_t env_index{0};
 };
 
 struct StateCorrection {
@@ -127,6 +134,7 @@ struct StateCorrection {
     std::array<float, 3> terrain_normal{0.0f, 1.0f, 0.0f};
     float terrain_height_m{0.0f};
     std::array<std::uint8_t, 7> reserved{};
+    std::uint16_t env_index{0};
 };
 
 struct ConfigCommand {
@@ -135,12 +143,14 @@ struct ConfigCommand {
     std::int32_t solver_iterations{8};
     std::int32_t reserved_i32{0};
     std::array<float, 4> reserved_float{};
+    std::uint16_t env_index{0};
 };
 
 struct ConfigAck {
     std::uint8_t message_type{static_cast<std::uint8_t>(MessageType::ConfigAck)};
     std::uint32_t body_count{0};
     std::uint32_t joint_count{0};
+    std::uint16_t env_index{0};
 };
 
 #pragma pack(pop)
@@ -157,44 +167,52 @@ inline constexpr std::size_t kStateResponseBytes = sizeof(StateResponse);
 inline constexpr std::size_t kStateCorrectionBytes = sizeof(StateCorrection);
 inline constexpr std::size_t kConfigCommandBytes = sizeof(ConfigCommand);
 inline constexpr std::size_t kConfigAckBytes = sizeof(ConfigAck);
+/// Size of the trailing `env_index`. Decoders accept messages without it (peers that predate
+/// `--serve-envs`) and read them as environment 0.
+inline constexpr std::size_t kEnvIndexBytes = sizeof(std::uint16_t);
 
 inline bool tryDecodeStepCommand(const void* data, std::size_t len, StepCommand& out) {
-    if (len < kStepCommandBytes) {
+    if (len < kStepCommandBytes - kEnvIndexBytes) {
         return false;
     }
-    std::memcpy(&out, data, kStepCommandBytes);
+    out = StepCommand{};
+    std::memcpy(&out, data, std::min(len, kStepCommandBytes));
     return out.message_type == static_cast<std::uint8_t>(MessageType::StepCommand);
 }
 
 inline bool tryDecodeStateResponse(const void* data, std::size_t len, StateResponse& out) {
-    if (len < kStateResponseBytes) {
+    if (len < kStateResponseBytes - kEnvIndexBytes) {
         return false;
     }
-    std::memcpy(&out, data, kStateResponseBytes);
+    out = StateResponse{};
+    std::memcpy(&out, data, std::min(len, kStateResponseBytes));
     return out.message_type == static_cast<std::uint8_t>(MessageType::StateResponse);
 }
 
 inline bool tryDecodeStateCorrection(const void* data, std::size_t len, StateCorrection& out) {
-    if (len < kStateCorrectionBytes) {
+    if (len < kStateCorrectionBytes - kEnvIndexBytes) {
         return false;
     }
-    std::memcpy(&out, data, kStateCorrectionBytes);
+    out = StateCorrection{};
+    std::memcpy(&out, data, std::min(len, kStateCorrectionBytes));
     return out.message_type == static_cast<std::uint8_t>(MessageType::StateCorrection);
 }
 
 inline bool tryDecodeConfigCommand(const void* data, std::size_t len, ConfigCommand& out) {
-    if (len < kConfigCommandBytes) {
+    if (len < kConfigCommandBytes - kEnvIndexBytes) {
         return false;
     }
-    std::memcpy(&out, data, kConfigCommandBytes);
+    out = ConfigCommand{};
+    std::memcpy(&out, data, std::min(len, kConfigCommandBytes));
     return out.message_type == static_cast<std::uint8_t>(MessageType::ConfigCommand);
 }
 
 inline bool tryDecodeConfigAck(const void* data, std::size_t len, ConfigAck& out) {
-    if (len < kConfigAckBytes) {
+    if (len < kConfigAckBytes - kEnvIndexBytes) {
         return false;
     }
-    std::memcpy(&out, data, kConfigAckBytes);
+    out = ConfigAck{};
+    std::memcpy(&out, data, std::min(len, kConfigAckBytes));
     return out.message_type == static_cast<std::uint8_t>(MessageType::ConfigAck);
 }
 
@@ -197,6 +197,9 @@ inline bool decode_calibrations(const std::vector<uint8_t>& payload, Calibration
   return offset == payload.size();
 }
 
+// SET_JOINT_TARGETS_GET_STATE reuses both payloads: the request is encoded with
+// encode_joint_targets() and the ACK with encode_full_hardware_state(), sampled after the
+// targets were applied.
 inline std::vector<uint8_t> encode_full_hardware_state(const FullHardwareState& in) {
   std::vector<uint8_t> payload;
   payload.reserve(kProtocolFullStatePayloadBytes);
@@ -36,7 +36,8 @@ enum class CommandCode : uint8_t {
   SET_SERVOS_TO_MID = 0x17,
   KILL = 0x18,
   GET_LED_INFO = 0x19,
-  SET_LED_COLORS = 0x1A
+  SET_LED_COLORS = 0x1A,
+  SET_JOINT_TARGETS_GET_STATE = 0x1B
 };
 
 enum class StatusCode : uint8_t {
@@ -85,6 +86,7 @@ inline constexpr uint8_t SET_SERVOS_TO_MID = as_u8(CommandCode::SET_SERVOS_TO_MI
 inline constexpr uint8_t KILL = as_u8(CommandCode::KILL);
 inline constexpr uint8_t GET_LED_INFO = as_u8(CommandCode::GET_LED_INFO);
 inline constexpr uint8_t SET_LED_COLORS = as_u8(CommandCode::SET_LED_COLORS);
+inline constexpr uint8_t SET_JOINT_TARGETS_GET_STATE = as_u8(CommandCode::SET_JOINT_TARGETS_GET_STATE);
 
 inline constexpr uint8_t STATUS_OK = as_u8(StatusCode::OK);
 inline constexpr uint8_t STATUS_BUSY = as_u8(StatusCode::BUSY);
@@ -107,7 +109,7 @@ struct CommandMetadata {
   bool handled_by_firmware_dispatch{false};
 };
 
-inline constexpr std::array<CommandCode, 17> kAllCommandCodes{{
+inline constexpr std::array<CommandCode, 18> kAllCommandCodes{{
     CommandCode::HELLO,
     CommandCode::HEARTBEAT,
     CommandCode::GET_FULL_HARDWARE_STATE,
@@ -125,9 +127,10 @@ inline constexpr std::array<CommandCode, 17> kAllCommandCodes{{
     CommandCode::SET_SERVOS_TO_MID,
     CommandCode::GET_LED_INFO,
     CommandCode::SET_LED_COLORS,
+    CommandCode::SET_JOINT_TARGETS_GET_STATE,
 }};
 
-inline constexpr std::array<CommandMetadata, 17> kCommandMetadata{{
+inline constexpr std::array<CommandMetadata, 18> kCommandMetadata{{
     {as_u8(CommandCode::HELLO), "HELLO", sizeof(uint8_t) * 2, true, false},
     {as_u8(CommandCode::HEARTBEAT), "HEARTBEAT", 0, true, false},
     {as_u8(CommandCode::GET_FULL_HARDWARE_STATE), "GET_FULL_HARDWARE_STATE", 0, true, true},
@@ -145,6 +148,7 @@ inline constexpr std::array<CommandMetadata, 17> kCommandMetadata{{
     {as_u8(CommandCode::SET_SERVOS_TO_MID), "SET_SERVOS_TO_MID", 0, true, true},
     {as_u8(CommandCode::GET_LED_INFO), "GET_LED_INFO", 0, true, true},
     {as_u8(CommandCode::SET_LED_COLORS), "SET_LED_COLORS", kProtocolLedColorsPayloadBytes, true, true},
+    {as_u8(CommandCode::SET_JOINT_TARGETS_GET_STATE), "SET_JOINT_TARGETS_GET_STATE", kProtocolJointTargetsPayloadBytes, true, true},
 }};
 
 inline constexpr const CommandMetadata* find_command_metadata(uint8_t cmd) {
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "visualiser/robot/geometry_state.hpp"
+
+namespace visualiser::parsing {
+
+bool IsTelemetryBinaryPacket(const std::uint8_t* data, std::size_t size);
+
+// Decodes one `hexapod_telemetry_protocol.hpp` datagram (control frame, fusion or navigation summary)
+// into the same state the JSON `joints` packet fills. `packet_kind` is set to "control_frame",
+// "fusion_summary" or "navigation_summary".
+bool ParseTelemetryBinaryPacket(const std::uint8_t* data,
+                                std::size_t size,
+                                visualiser::robot::HexapodTelemetryState& telemetry,
+                                std::string& packet_kind);
+
+}  // namespace visualiser::parsing
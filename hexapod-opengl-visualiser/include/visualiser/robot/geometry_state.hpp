@@ -43,6 +43,8 @@ struct HexapodStatusState {
   bool estimator_valid = true;
   float voltage = 0.0f;
   float current = 0.0f;
+  // Bit i = raw foot contact of leg i (LF, LM, LR, RF, RM, RR); only the binary control frame carries it.
+  std::optional<std::uint8_t> contact_mask{};
   std::optional<int> nav_lifecycle{};
   std::optional<int> nav_block_reason{};
   std::optional<int> nav_planner_status{};
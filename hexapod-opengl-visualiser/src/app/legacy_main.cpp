@@ -31,6 +31,7 @@
 #include <string_view>
 #include <vector>
 
+#include "hexapod_telemetry_protocol.hpp"
 #include "minphys_viz_protocol.hpp"
 #include "visualiser_frame_math.hpp"
 
@@ -195,6 +196,8 @@ struct HexapodStatusState {
   bool estimator_valid = true;
   float voltage = 0.0f;
   float current = 0.0f;
+  // Bit i = raw foot contact of leg i (LF, LM, LR, RF, RM, RR); only the binary control frame carries it.
+  std::optional<std::uint8_t> contact_mask{};
   std::optional<int> nav_lifecycle{};
   std::optional<int> nav_block_reason{};
   std::optional<int> nav_planner_status{};
@@ -1887,6 +1890,87 @@ bool ParseVizBinaryPacket(const std::uint8_t* data,
   }
 }
 
+// hexapod-server binary stream (`hexapod_telemetry_protocol.hpp`); fills the same state as a JSON `joints` packet.
+bool ParseTelemetryBinaryPacket(const std::uint8_t* data,
+                                std::size_t len,
+                                HexapodTelemetryState& telemetry,
+                                std::string& packet_kind) {
+  using hexapod_telemetry::TelemetryMessageKind;
+  if (!hexapod_telemetry::IsTelemetryBinaryPayload(data, len)) {
+    return false;
+  }
+  HexapodStatusState& status = telemetry.status;
+  const auto kind = static_cast<TelemetryMessageKind>(data[offsetof(hexapod_telemetry::TelemetryWireHeader, message_kind)]);
+  switch (kind) {
+    case TelemetryMessageKind::ControlFrame: {
+      hexapod_telemetry::TelemetryControlFrameBody frame{};
+      if (!hexapod_telemetry::DecodeMessage(data, len, kind, frame)) {
+        return false;
+      }
+      for (std::size_t leg = 0; leg < hexapod_telemetry::kLegCount; ++leg) {
+        for (std::size_t joint = 0; joint < hexapod_telemetry::kJointsPerLeg; ++joint) {
+          telemetry.angles_deg[leg][joint] = frame.commanded_angles_deg[leg][joint];
+        }
+      }
+      telemetry.has_joints = true;
+      if ((frame.flags & hexapod_telemetry::kFrameFlagHasBodyPose) != 0) {
+        telemetry.body_pose.position = {frame.body_position_m.x, frame.body_position_m.y, frame.body_position_m.z};
+        telemetry.body_pose.orientation_rad =
+            {frame.body_orientation_rad.x, frame.body_orientation_rad.y, frame.body_orientation_rad.z};
+        telemetry.body_pose.yaw_rad = frame.body_orientation_rad.z;
+        telemetry.body_pose.valid = true;
+      }
+      status.timestamp_ms = frame.timestamp_us / 1000u;
+      status.loop_counter = static_cast<int>(frame.loop_counter);
+      status.active_mode = frame.active_mode;
+      status.active_fault = frame.active_fault;
+      status.bus_ok = (frame.flags & hexapod_telemetry::kFrameFlagBusOk) != 0;
+      status.estimator_valid = (frame.flags & hexapod_telemetry::kFrameFlagEstimatorValid) != 0;
+      status.voltage = frame.voltage;
+      status.current = frame.current;
+      status.contact_mask = frame.contact_mask;
+      status.valid = true;
+      packet_kind = "control_frame";
+      return true;
+    }
+    case TelemetryMessageKind::FusionSummary: {
+      hexapod_telemetry::TelemetryFusionSummaryBody fusion{};
+      if (!hexapod_telemetry::DecodeMessage(data, len, kind, fusion)) {
+        return false;
+      }
+      if ((fusion.flags & hexapod_telemetry::kFusionFlagHasData) != 0) {
+        status.fusion_model_trust = fusion.model_trust;
+        status.fusion_resync_requested = (fusion.flags & hexapod_telemetry::kFusionFlagResyncRequested) != 0;
+        status.fusion_hard_reset_requested = (fusion.flags & hexapod_telemetry::kFusionFlagHardResetRequested) != 0;
+        status.fusion_predictive_mode = (fusion.flags & hexapod_telemetry::kFusionFlagPredictiveMode) != 0;
+        status.fusion_max_body_position_error_m = fusion.max_body_position_error_m;
+        status.fusion_max_body_orientation_error_rad = fusion.max_body_orientation_error_rad;
+        status.fusion_contact_mismatch_ratio = fusion.contact_mismatch_ratio;
+        status.fusion_terrain_residual_m = fusion.terrain_residual_m;
+      }
+      packet_kind = "fusion_summary";
+      return true;
+    }
+    case TelemetryMessageKind::NavigationSummary: {
+      hexapod_telemetry::TelemetryNavigationSummaryBody nav{};
+      if (!hexapod_telemetry::DecodeMessage(data, len, kind, nav)) {
+        return false;
+      }
+      status.nav_lifecycle = nav.lifecycle;
+      status.nav_planner_status = nav.planner_status;
+      status.nav_block_reason = nav.block_reason;
+      status.nav_map_fresh = (nav.flags & hexapod_telemetry::kNavFlagMapFresh) != 0;
+      status.nav_replan_count = nav.replan_count;
+      status.nav_active_segment_waypoint_count = nav.active_segment_waypoint_count;
+      status.nav_active_segment_length_m = nav.active_segment_length_m;
+      status.nav_nearest_obstacle_distance_m = nav.nearest_obstacle_distance_m;
+      packet_kind = "navigation_summary";
+      return true;
+    }
+  }
+  return false;
+}
+
 bool ParsePacket(const std::string& payload,
                  std::map<std::uint32_t, EntityState>& entities,
                  TerrainPatchState& terrain_patch,
@@ -2051,6 +2135,14 @@ class UdpReceiver {
         } else {
           ++rejected_packets;
         }
+      } else if (hexapod_telemetry::IsTelemetryBinaryPayload(buffer.data(), n)) {
+        if (ParseTelemetryBinaryPacket(reinterpret_cast<const std::uint8_t*>(buffer.data()), n, telemetry, packet_kind)) {
+          last_packet_kind = packet_kind;
+          ++accepted_packets;
+          ++packets;
+        } else {
+          ++rejected_packets;
+        }
       } else {
         const std::string text_payload(buffer.data(), n);
         if (ParsePacket(text_payload, entities, terrain_patch, telemetry, packet_kind, &terrain_reassembly_)) {
@@ -2316,6 +2408,13 @@ void DrawUi(AppUiState& ui,
                 telemetry.status.loop_counter,
                 static_cast<unsigned long long>(telemetry.status.timestamp_ms));
     ImGui::Text("Voltage: %.2f V | Current: %.2f A", telemetry.status.voltage, telemetry.status.current);
+    if (telemetry.status.contact_mask.has_value()) {
+      char contacts[7]{};
+      for (int leg = 0; leg < 6; ++leg) {
+        contacts[leg] = (*telemetry.status.contact_mask & (1u << leg)) != 0 ? '1' : '0';
+      }
+      ImGui::Text("Contacts LF..RR: %s", contacts);
+    }
   } else {
     ImGui::TextUnformatted("No server telemetry yet");
   }
@@ -2,6 +2,7 @@
 
 #include "minphys_viz_protocol.hpp"
 #include "visualiser/parsing/json_packets.hpp"
+#include "visualiser/parsing/telemetry_binary.hpp"
 
 namespace visualiser::parsing {
 
@@ -30,6 +31,18 @@ PacketDispatchResult ParsePacket(const std::string& payload,
     return result;
   }
 
+  const auto* bytes = reinterpret_cast<const std::uint8_t*>(payload.data());
+  if (IsTelemetryBinaryPacket(bytes, payload.size())) {
+    std::string packet_kind;
+    if (ParseTelemetryBinaryPacket(bytes, payload.size(), telemetry, packet_kind)) {
+      result.accepted = true;
+      result.packet_kind = packet_kind;
+      return result;
+    }
+    result.rejection_reason = "invalid telemetry binary packet";
+    return result;
+  }
+
   if (ParseEntityPacket(payload, entities)) {
     result.accepted = true;
     result.packet_kind = "entity";
@@ -0,0 +1,115 @@
+#include "visualiser/parsing/telemetry_binary.hpp"
+
+#include "hexapod_telemetry_protocol.hpp"
+
+namespace visualiser::parsing {
+
+namespace {
+
+using hexapod_telemetry::TelemetryMessageKind;
+
+void ApplyControlFrame(const hexapod_telemetry::TelemetryControlFrameBody& frame,
+                       visualiser::robot::HexapodTelemetryState& telemetry) {
+  for (std::size_t leg = 0; leg < hexapod_telemetry::kLegCount; ++leg) {
+    for (std::size_t joint = 0; joint < hexapod_telemetry::kJointsPerLeg; ++joint) {
+      telemetry.angles_deg[leg][joint] = frame.commanded_angles_deg[leg][joint];
+    }
+  }
+  telemetry.has_joints = true;
+
+  if ((frame.flags & hexapod_telemetry::kFrameFlagHasBodyPose) != 0) {
+    telemetry.body_pose.position = {frame.body_position_m.x, frame.body_position_m.y, frame.body_position_m.z};
+    telemetry.body_pose.orientation_rad =
+        {frame.body_orientation_rad.x, frame.body_orientation_rad.y, frame.body_orientation_rad.z};
+    telemetry.body_pose.yaw_rad = frame.body_orientation_rad.z;
+    telemetry.body_pose.valid = true;
+  }
+
+  visualiser::robot::HexapodStatusState& status = telemetry.status;
+  status.timestamp_ms = frame.timestamp_us / 1000u;
+  status.loop_counter = static_cast<int>(frame.loop_counter);
+  status.active_mode = frame.active_mode;
+  status.active_fault = frame.active_fault;
+  status.bus_ok = (frame.flags & hexapod_telemetry::kFrameFlagBusOk) != 0;
+  status.estimator_valid = (frame.flags & hexapod_telemetry::kFrameFlagEstimatorValid) != 0;
+  status.voltage = frame.voltage;
+  status.current = frame.current;
+  status.contact_mask = frame.contact_mask;
+  status.valid = true;
+}
+
+void ApplyFusionSummary(const hexapod_telemetry::TelemetryFusionSummaryBody& fusion,
+                        visualiser::robot::HexapodStatusState& status) {
+  if ((fusion.flags & hexapod_telemetry::kFusionFlagHasData) == 0) {
+    return;
+  }
+  status.fusion_model_trust = fusion.model_trust;
+  status.fusion_resync_requested = (fusion.flags & hexapod_telemetry::kFusionFlagResyncRequested) != 0;
+  status.fusion_hard_reset_requested = (fusion.flags & hexapod_telemetry::kFusionFlagHardResetRequested) != 0;
+  status.fusion_predictive_mode = (fusion.flags & hexapod_telemetry::kFusionFlagPredictiveMode) != 0;
+  status.fusion_max_body_position_error_m = fusion.max_body_position_error_m;
+  status.fusion_max_body_orientation_error_rad = fusion.max_body_orientation_error_rad;
+  status.fusion_contact_mismatch_ratio = fusion.contact_mismatch_ratio;
+  status.fusion_terrain_residual_m = fusion.terrain_residual_m;
+}
+
+void ApplyNavigationSummary(const hexapod_telemetry::TelemetryNavigationSummaryBody& nav,
+                            visualiser::robot::HexapodStatusState& status) {
+  status.nav_lifecycle = nav.lifecycle;
+  status.nav_planner_status = nav.planner_status;
+  status.nav_block_reason = nav.block_reason;
+  status.nav_map_fresh = (nav.flags & hexapod_telemetry::kNavFlagMapFresh) != 0;
+  status.nav_replan_count = nav.replan_count;
+  status.nav_active_segment_waypoint_count = nav.active_segment_waypoint_count;
+  status.nav_active_segment_length_m = nav.active_segment_length_m;
+  status.nav_nearest_obstacle_distance_m = nav.nearest_obstacle_distance_m;
+}
+
+}  // namespace
+
+bool IsTelemetryBinaryPacket(const std::uint8_t* data, std::size_t size) {
+  return hexapod_telemetry::IsTelemetryBinaryPayload(data, size);
+}
+
+bool ParseTelemetryBinaryPacket(const std::uint8_t* data,
+                                std::size_t size,
+                                visualiser::robot::HexapodTelemetryState& telemetry,
+                                std::string& packet_kind) {
+  if (!hexapod_telemetry::IsTelemetryBinaryPayload(data, size)) {
+    return false;
+  }
+  const auto kind =
+      static_cast<TelemetryMessageKind>(data[offsetof(hexapod_telemetry::TelemetryWireHeader, message_kind)]);
+  switch (kind) {
+    case TelemetryMessageKind::ControlFrame: {
+      hexapod_telemetry::TelemetryControlFrameBody frame{};
+      if (!hexapod_telemetry::DecodeMessage(data, size, kind, frame)) {
+        return false;
+      }
+      ApplyControlFrame(frame, telemetry);
+      packet_kind = "control_frame";
+      return true;
+    }
+    case TelemetryMessageKind::FusionSummary: {
+      hexapod_telemetry::TelemetryFusionSummaryBody fusion{};
+      if (!hexapod_telemetry::DecodeMessage(data, size, kind, fusion)) {
+        return false;
+      }
+      ApplyFusionSummary(fusion, telemetry.status);
+      packet_kind = "fusion_summary";
+      return true;
+    }
+    case TelemetryMessageKind::NavigationSummary: {
+      hexapod_telemetry::TelemetryNavigationSummaryBody nav{};
+      if (!hexapod_telemetry::DecodeMessage(data, size, kind, nav)) {
+        return false;
+      }
+      ApplyNavigationSummary(nav, telemetry.status);
+      packet_kind = "navigation_summary";
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace visualiser::parsing
@@ -0,0 +1,102 @@
+#include "visualiser/parsing/packet_dispatch.hpp"
+#include "visualiser/parsing/telemetry_binary.hpp"
+
+#include "hexapod_telemetry_protocol.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+bool expect(bool condition, const char* message) {
+  if (!condition) {
+    std::cerr << "FAIL: " << message << '\n';
+    return false;
+  }
+  return true;
+}
+
+bool nearlyEqual(float a, float b, float eps = 1e-5f) {
+  return std::abs(a - b) <= eps;
+}
+
+std::string AsPayload(const std::vector<std::uint8_t>& datagram) {
+  return std::string(reinterpret_cast<const char*>(datagram.data()), datagram.size());
+}
+}  // namespace
+
+int main() {
+  hexapod_telemetry::TelemetryControlFrameBody frame{};
+  frame.timestamp_us = 2'500'000;
+  frame.loop_counter = 1250;
+  frame.active_mode = 3;
+  frame.active_fault = 0;
+  frame.flags = hexapod_telemetry::kFrameFlagBusOk | hexapod_telemetry::kFrameFlagHasBodyPose;
+  frame.contact_mask = 0b101010;
+  frame.voltage = 11.8f;
+  frame.current = 1.5f;
+  frame.commanded_angles_deg[3][1] = 42.5f;
+  frame.body_position_m = {0.1f, 0.2f, 0.3f};
+  frame.body_orientation_rad = {0.0f, 0.05f, 1.25f};
+
+  hexapod_telemetry::TelemetryFusionSummaryBody fusion{};
+  fusion.flags = hexapod_telemetry::kFusionFlagHasData | hexapod_telemetry::kFusionFlagResyncRequested;
+  fusion.model_trust = 0.7f;
+  fusion.terrain_residual_m = 0.02f;
+
+  hexapod_telemetry::TelemetryNavigationSummaryBody nav{};
+  nav.lifecycle = 1;
+  nav.flags = hexapod_telemetry::kNavFlagMapFresh;
+  nav.replan_count = 4;
+  nav.nearest_obstacle_distance_m = 0.9f;
+
+  std::vector<std::uint8_t> datagram;
+  visualiser::robot::HexapodTelemetryState telemetry{};
+  std::string packet_kind;
+  bool ok = true;
+
+  hexapod_telemetry::EncodeControlFrame(datagram, frame);
+  ok = ok && expect(visualiser::parsing::ParseTelemetryBinaryPacket(datagram.data(), datagram.size(), telemetry, packet_kind),
+                    "control frame parsed");
+  ok = ok && expect(packet_kind == "control_frame", "control frame kind");
+  ok = ok && expect(telemetry.has_joints && nearlyEqual(telemetry.angles_deg[3][1], 42.5f), "commanded angles applied");
+  ok = ok && expect(telemetry.body_pose.valid && nearlyEqual(telemetry.body_pose.position.z, 0.3f) &&
+                        nearlyEqual(telemetry.body_pose.yaw_rad, 1.25f),
+                    "body pose applied");
+  ok = ok && expect(telemetry.status.valid && telemetry.status.timestamp_ms == 2500 &&
+                        telemetry.status.loop_counter == 1250 && telemetry.status.active_mode == 3,
+                    "status applied");
+  ok = ok && expect(telemetry.status.bus_ok && !telemetry.status.estimator_valid, "status flags applied");
+  ok = ok && expect(telemetry.status.contact_mask == std::optional<std::uint8_t>{0b101010}, "contact mask applied");
+  ok = ok && expect(nearlyEqual(telemetry.status.voltage, 11.8f), "voltage applied");
+
+  hexapod_telemetry::EncodeFusionSummary(datagram, fusion);
+  ok = ok && expect(visualiser::parsing::ParseTelemetryBinaryPacket(datagram.data(), datagram.size(), telemetry, packet_kind),
+                    "fusion summary parsed");
+  ok = ok && expect(packet_kind == "fusion_summary", "fusion summary kind");
+  ok = ok && expect(telemetry.status.fusion_model_trust.has_value() &&
+                        nearlyEqual(static_cast<float>(*telemetry.status.fusion_model_trust), 0.7f),
+                    "fusion trust applied");
+  ok = ok && expect(telemetry.status.fusion_resync_requested == std::optional<bool>{true}, "fusion flags applied");
+
+  // Navigation summaries also arrive through the generic packet dispatcher.
+  hexapod_telemetry::EncodeNavigationSummary(datagram, nav);
+  std::map<std::uint32_t, visualiser::scene::EntityState> entities;
+  visualiser::scene::TerrainPatchState terrain;
+  const auto dispatched = visualiser::parsing::ParsePacket(AsPayload(datagram), entities, terrain, telemetry);
+  ok = ok && expect(dispatched.accepted && dispatched.packet_kind == "navigation_summary", "navigation summary dispatched");
+  ok = ok && expect(telemetry.status.nav_lifecycle == std::optional<int>{1} &&
+                        telemetry.status.nav_map_fresh == std::optional<bool>{true} &&
+                        telemetry.status.nav_replan_count == std::optional<std::size_t>{4},
+                    "navigation summary applied");
+
+  datagram.pop_back();
+  const auto truncated = visualiser::parsing::ParsePacket(AsPayload(datagram), entities, terrain, telemetry);
+  ok = ok && expect(!truncated.accepted, "truncated binary telemetry rejected");
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
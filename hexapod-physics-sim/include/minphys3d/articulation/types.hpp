@@ -115,4 +115,66 @@ struct ArtChain {
     }
 };
 
+// ---------------------------------------------------------------------------
+// ReducedArtTree — reduced-coordinate articulated tree
+// ---------------------------------------------------------------------------
+// With `World::ArticulationConfig::enableReducedCoordinateTrees`, the ArtChains that share a
+// root body are merged into one tree and the servo joints on it stop being anchor / axis PGS
+// rows: every impulse on a tree body is propagated through the exact articulated-body inertia
+// (Featherstone ABA in impulse form), so the links only ever move along their joint DOFs.
+//
+// All spatial quantities are world-aligned and taken about one reference point per tree
+// (`origin`, the root COM when the tree is prepared), so no per-link transforms are needed.
+// Links are stored root first and every parent precedes its children.
+
+struct ReducedArtLink {
+    std::uint32_t bodyIdx = 0;
+    // Incoming ServoJoint (parent = joint.a, this link = joint.b); kNoJoint for the root.
+    std::uint32_t jointIdx = ArtLink::kNoJoint;
+    int parent = -1;
+
+    // ---- per-substep caches (filled by PrepareReducedArticulationTrees) ----
+    // Unit twist of the joint about `origin`: {axis, axis × (origin − anchor)}.
+    SpatialVec s{};
+    // Rigid spatial inertia of the link about `origin`.
+    SpatialInertia I{};
+    // Articulated inertia of the subtree rooted at this link, and U = IA·s, 1 / (s^T·IA·s).
+    ArticulatedInertia IA{};
+    SpatialVec U{};
+    Real invD = 0.0;
+
+    // ---- impulse propagation scratch (left zeroed between propagations) ----
+    SpatialVec p{};    // bias impulse of the subtree: −(applied impulses) + child terms
+    SpatialVec dV{};   // spatial velocity change about `origin`
+    Real u = 0.0;      // generalized impulse at the joint, −s^T·p
+    bool pending = false;
+    // Joint angle sampled before the end-of-substep pose rebuild.
+    Real angle = 0.0;
+};
+
+struct ReducedArtTree {
+    std::vector<ReducedArtLink> links;
+    Vec3 origin{};
+    // The root body is dynamic: its six DOFs are solved through the factored root inertia.
+    bool floatingBase = false;
+    // Cleared when a tree body sleeps or the root inertia cannot be factored; the tree's joints
+    // then stay on the maximal-coordinate rows for the substep.
+    bool active = false;
+    // Spatial velocity of a non-dynamic root about `origin` (fixed base only).
+    SpatialVec rootVelocity{};
+    // Pivoted LDL^T factor of the root articulated inertia (floating base only).
+    double rootL[6][6]{};
+    double rootD[6]{};
+    int rootPerm[6]{};
+    // Links touched by the pending propagation.
+    std::vector<std::uint32_t> pendingLinks;
+};
+
+// Tree / link of a body in `World::reducedArtTrees_`; `tree == kNone` for bodies outside them.
+struct ReducedArtBodySlot {
+    static constexpr std::uint32_t kNone = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t tree = kNone;
+    std::uint32_t link = 0;
+};
+
 } // namespace minphys3d
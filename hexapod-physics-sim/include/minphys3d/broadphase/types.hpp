@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 #include "minphys3d/collision/shapes.hpp"
 
@@ -28,4 +29,37 @@ struct BroadphaseProxy {
     bool valid = false;
 };
 
+/// Sort-and-sweep state for `BroadphaseBackend::SweepAndPrune`. `order` holds the swept proxies
+/// sorted by fat-box min on the sweep `axis` and persists across queries, so a query only
+/// insertion-sorts the proxies that refit. `proxy*` are the per-body pair filters, refreshed each
+/// query. The order is then split into pruning boxes (slabs across a second axis, each split into
+/// a moving and a static segment at `boxStart`) and packed per bound: `A` is the sweep axis, `B`
+/// the slab axis, `C` the third. `sweptPairs` and the `pair*` buffers sort the sweep's output.
+struct SweepAndPruneState {
+    std::vector<std::uint32_t> order;
+    std::vector<Real> orderKey;
+    std::vector<AABB> orderBox;
+    std::vector<std::uint8_t> inOrder;
+    std::vector<std::uint8_t> proxyFlags;
+    std::vector<std::uint32_t> proxyGroup;
+    std::vector<std::uint32_t> proxyMask;
+    std::vector<std::uint32_t> boxStart;
+    std::vector<std::uint32_t> boxFill;
+    std::vector<std::uint32_t> entrySource;
+    std::vector<std::uint32_t> bodyId;
+    std::vector<Real> minA;
+    std::vector<Real> maxA;
+    std::vector<Real> minB;
+    std::vector<Real> maxB;
+    std::vector<Real> minC;
+    std::vector<Real> maxC;
+    std::vector<std::uint8_t> flags;
+    std::vector<std::uint32_t> group;
+    std::vector<std::uint32_t> mask;
+    std::vector<Pair> sweptPairs;
+    std::vector<Pair> pairSortScratch;
+    std::vector<std::uint32_t> pairBucketStart;
+    int axis = -1;
+};
+
 } // namespace minphys3d
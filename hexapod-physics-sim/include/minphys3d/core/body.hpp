@@ -73,7 +73,7 @@ struct Body {
 /// Returns the vector from the primitive origin (mid-height, center of the flat diameter) to the uniform-density COM.
 inline Vec3 HalfCylinderComOffsetFromShapeOriginLocal(Real radius) {
     constexpr Real kPi = 3.14159265;
-    return {0.0, 0.0, 4.0 * radius / (3.0 * kPi)};
+    return {0.0, 0.0, static_cast<Real>(4.0 * radius / (3.0 * kPi))};
 }
 
 /// World-space primitive frame origin used for collision geometry (equals `body.position` when `centerOfMassLocal` is zero).
@@ -396,9 +396,9 @@ inline void Body::RecomputeMassProperties() {
     } else if (shape == ShapeType::Compound) {
         if (!TryCompoundInvInertiaFromChildren(*this, invInertiaLocal)) {
             const Vec3 localHalfExtents = CompoundLocalBoundsHalfExtents(*this);
-            const Real wx = std::max(localHalfExtents.x * 2.0, kEpsilon);
-            const Real wy = std::max(localHalfExtents.y * 2.0, kEpsilon);
-            const Real wz = std::max(localHalfExtents.z * 2.0, kEpsilon);
+            const Real wx = std::max<Real>(localHalfExtents.x * 2.0, kEpsilon);
+            const Real wy = std::max<Real>(localHalfExtents.y * 2.0, kEpsilon);
+            const Real wz = std::max<Real>(localHalfExtents.z * 2.0, kEpsilon);
 
             const Real ix = (mass / 12.0) * (wy * wy + wz * wz);
             const Real iy = (mass / 12.0) * (wx * wx + wz * wz);
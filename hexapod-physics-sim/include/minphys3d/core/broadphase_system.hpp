@@ -29,12 +29,12 @@ struct BroadphaseUpdateContext {
 };
 
 struct BroadphaseContext {
-    std::function<std::vector<Pair>()> computePotentialPairs;
+    std::function<const std::vector<Pair>&()> computePotentialPairs;
 };
 
 class BroadphaseSystem {
 public:
-    std::vector<Pair> ComputePotentialPairs(const BroadphaseContext& context) const;
+    const std::vector<Pair>& ComputePotentialPairs(const BroadphaseContext& context) const;
     void UpdateProxies(const BroadphaseUpdateContext& context) const;
 };
 
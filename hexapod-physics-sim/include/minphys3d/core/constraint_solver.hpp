@@ -1,14 +1,23 @@
 #pragma once
 
-#include <functional>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <vector>
 
 #include "minphys3d/core/subsystems.hpp"
+#include "minphys3d/core/worker_pool.hpp"
 #include "minphys3d/core/world.hpp"
 #include "minphys3d/core/world_resource_monitoring.hpp"
+#include "minphys3d/solver/island_ordering.hpp"
 
 namespace minphys3d::core_internal {
 
+/// `Hooks` supplies the per-row joint kernels (`SolveDistanceJoint`, ..., `SolveServoJoint`), the
+/// coloured-batch fork/join (`ParallelFor(pool, taskCount, task)`) and, with solver telemetry on,
+/// `Telemetry()`. It is a concrete type, so every call below resolves statically and the kernels
+/// can be inlined into the island sweep. Built once per substep by `World`.
+template <typename Hooks>
 struct ConstraintSolverContext {
     std::vector<Body>& bodies;
     std::vector<Manifold>& manifolds;
@@ -19,29 +28,313 @@ struct ConstraintSolverContext {
     std::vector<FixedJoint>& fixedJoints;
     std::vector<PrismaticJoint>& prismaticJoints;
     std::vector<ServoJoint>& servoJoints;
-    const ContactSolverContext& contactContext;
+    const ContactSolverContext<Hooks>& contactContext;
     const ContactSolverConfig& contactSolverConfig;
+    const Hooks& hooks;
     // When non-null, island ordering is read from this cache instead of being recomputed each call.
     const std::vector<IslandOrderResult>* precomputedIslandOrders = nullptr;
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-    World::SolverTelemetry* solverTelemetry = nullptr;
-#endif
-
-    std::function<void(ContactSolver&, const ContactSolverContext&, Manifold&)> solveContactsInManifold;
-    std::function<void(DistanceJoint&)> solveDistanceJoint;
-    std::function<void(HingeJoint&)> solveHingeJoint;
-    std::function<void(BallSocketJoint&)> solveBallSocketJoint;
-    std::function<void(FixedJoint&)> solveFixedJoint;
-    std::function<void(PrismaticJoint&)> solvePrismaticJoint;
-    std::function<void(ServoJoint&)> solveServoJoint;
-    /// When non-null, `SolveIslands` records nested self-time (contacts / joint type loops). Not used in tests
-    /// that build `ConstraintSolverContext` without the extra field; defaults to `nullptr` via brace init in `World` only.
+    /// When non-null, `SolveIslands` records nested self-time (contacts / joint type loops).
     world_resource_monitoring::Profiler* worldResourceProfiler = nullptr;
+    /// When non-null, only these island indices are solved (in list order); used by the parallel
+    /// island solve so each batch touches a disjoint set of bodies.
+    const std::vector<std::size_t>* islandIndices = nullptr;
+    /// When non-null (parallel to `islands`), row kinds with a non-empty colouring are swept colour
+    /// by colour instead of in island order (see `GraphColoringConfig`).
+    const std::vector<IslandColoring>* islandColorings = nullptr;
+    /// Pool handed to `Hooks::ParallelFor` for coloured batches; nullptr runs each colour inline.
+    WorkerPool* colorPool = nullptr;
+    std::size_t parallelThreadCount = 1;
+    std::uint32_t minColorRowsPerThread = 1;
 };
 
 class ConstraintSolver {
 public:
-    void SolveIslands(const ConstraintSolverContext& context) const;
+    template <typename Hooks>
+    void SolveIslands(const ConstraintSolverContext<Hooks>& context) const;
 };
 
+namespace constraint_solver_detail {
+
+// Sweeps coloured rows colour by colour. Rows of one colour share no dynamic body, so a colour is
+// split into contiguous chunks across `Hooks::ParallelFor`; the result is the same as solving
+// the colour inline. Within a chunk, rows are handed to `solveBatch(rows, count)` up to `Width`
+// at a time (in sweep order). The overflow colour (if any) always runs sequentially, one row per
+// call.
+template <std::size_t Width, typename Hooks, typename SolveBatch>
+void SolveColoredRowBatches(const ConstraintSolverContext<Hooks>& context,
+                            const ConstraintColoring& coloring,
+                            bool reverse,
+                            SolveBatch&& solveBatch) {
+    const auto solveChunk = [&](std::size_t begin, std::size_t end, std::size_t width, bool backwards) {
+        std::array<std::size_t, Width> rows{};
+        std::size_t count = 0;
+        for (std::size_t step = begin; step < end; ++step) {
+            const std::size_t i = backwards ? end - 1u - (step - begin) : step;
+            rows[count++] = coloring.indices[i];
+            if (count == width) {
+                solveBatch(rows.data(), count);
+                count = 0;
+            }
+        }
+        if (count > 0) {
+            solveBatch(rows.data(), count);
+        }
+    };
+
+    const std::size_t colorCount = coloring.ColorCount();
+    for (std::size_t step = 0; step < colorCount; ++step) {
+        const std::size_t color = reverse ? colorCount - 1u - step : step;
+        const std::size_t begin = coloring.colorOffsets[color];
+        const std::size_t end = coloring.colorOffsets[color + 1u];
+        const bool sequential = coloring.lastColorSequential && color + 1u == colorCount;
+        const std::size_t width = sequential ? 1u : Width;
+
+        std::size_t taskCount = 1;
+        if (!sequential && context.colorPool != nullptr && context.parallelThreadCount > 1) {
+            const std::size_t minRows = std::max<std::size_t>(context.minColorRowsPerThread, 1u);
+            taskCount = std::min(context.parallelThreadCount, (end - begin) / minRows);
+        }
+        if (taskCount <= 1) {
+            solveChunk(begin, end, width, reverse);
+            continue;
+        }
+        const std::size_t rowCount = end - begin;
+        context.hooks.ParallelFor(*context.colorPool, taskCount, [&](std::size_t task) {
+            const std::size_t chunkBegin = begin + rowCount * task / taskCount;
+            const std::size_t chunkEnd = begin + rowCount * (task + 1u) / taskCount;
+            solveChunk(chunkBegin, chunkEnd, width, false);
+        });
+    }
+}
+
+template <typename Hooks, typename SolveRow>
+void SolveColoredRows(const ConstraintSolverContext<Hooks>& context,
+                      const ConstraintColoring& coloring,
+                      bool reverse,
+                      SolveRow&& solveRow) {
+    SolveColoredRowBatches<1>(context, coloring, reverse, [&](const std::size_t* rows, std::size_t) {
+        solveRow(rows[0]);
+    });
+}
+
+} // namespace constraint_solver_detail
+
+template <typename Hooks>
+void ConstraintSolver::SolveIslands(const ConstraintSolverContext<Hooks>& context) const {
+    ContactSolver solver;
+    using world_resource_monitoring::Section;
+    using world_resource_monitoring::toIndex;
+
+    const std::size_t islandSolveCount =
+        context.islandIndices ? context.islandIndices->size() : context.islands.size();
+    for (std::size_t solveIdx = 0; solveIdx < islandSolveCount; ++solveIdx) {
+        const std::size_t islandIdx = context.islandIndices ? (*context.islandIndices)[solveIdx] : solveIdx;
+        const Island& island = context.islands[islandIdx];
+
+        IslandOrderResult onDemandOrder;
+        const IslandOrderResult* orderPtr = nullptr;
+        if (context.precomputedIslandOrders && islandIdx < context.precomputedIslandOrders->size()) {
+            orderPtr = &(*context.precomputedIslandOrders)[islandIdx];
+        } else {
+            if (context.worldResourceProfiler) {
+                const auto _scope = context.worldResourceProfiler->scope(
+                    toIndex(Section::SolveIslandsIslandOrder));
+                onDemandOrder = solver_internal::ComputeIslandOrder(
+                    island, context.bodies, context.manifolds, context.contactSolverConfig);
+            } else {
+                onDemandOrder = solver_internal::ComputeIslandOrder(
+                    island, context.bodies, context.manifolds, context.contactSolverConfig);
+            }
+            orderPtr = &onDemandOrder;
+        }
+        const IslandOrderResult& islandOrder = *orderPtr;
+
+        const std::vector<std::size_t>& manifoldOrder = islandOrder.manifoldOrder;
+        const IslandSolveOrdering ordering = islandOrder.orderingUsed;
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+        if (islandOrder.supportDepthApplied) {
+            ++context.hooks.Telemetry().supportDepthOrderApplied;
+        } else {
+            ++context.hooks.Telemetry().supportDepthOrderBypassed;
+        }
+#endif
+
+        const IslandColoring* coloring =
+            (context.islandColorings && islandIdx < context.islandColorings->size())
+            ? &(*context.islandColorings)[islandIdx]
+            : nullptr;
+        const bool colorContacts = coloring && coloring->manifolds.ColorCount() > 0;
+        const bool colorHinges = coloring && coloring->hinges.ColorCount() > 0;
+        const bool colorServos = coloring && coloring->servos.ColorCount() > 0;
+        const auto solveManifold = [&](std::size_t mi) {
+            solver.SolveContactsInManifold(context.contactContext, context.manifolds[mi]);
+        };
+        const auto solveHinge = [&](std::size_t hi) { context.hooks.SolveHingeJoint(context.hingeJoints[hi]); };
+        const auto solveServo = [&](std::size_t si) { context.hooks.SolveServoJoint(context.servoJoints[si]); };
+
+        // Wide4: lane-pack the manifolds of each coloured batch; a manifold that cannot be a
+        // lane (or a batch left with one) takes the scalar kernel.
+        const auto solveManifoldBatch = [&](const std::size_t* rows, std::size_t count) {
+            std::array<Manifold*, solver_internal::kContactRowLanes> lanes{};
+            std::size_t laneCount = 0;
+            for (std::size_t r = 0; r < count; ++r) {
+                Manifold& manifold = context.manifolds[rows[r]];
+                if (count > 1 && ContactSolver::IsWideRowEligible(manifold)) {
+                    lanes[laneCount++] = &manifold;
+                } else {
+                    solveManifold(rows[r]);
+                }
+            }
+            if (laneCount == 1) {
+                solver.SolveContactsInManifold(context.contactContext, *lanes[0]);
+            } else if (laneCount > 1) {
+                solver.SolveContactsInManifolds4(context.contactContext, lanes.data(), laneCount);
+            }
+        };
+        const bool wideContactRows = context.contactSolverConfig.rowKernel == ContactRowKernel::Wide4;
+        const auto solveColoredContacts = [&](bool reverse) {
+            if (wideContactRows) {
+                constraint_solver_detail::SolveColoredRowBatches<solver_internal::kContactRowLanes>(
+                    context, coloring->manifolds, reverse, solveManifoldBatch);
+            } else {
+                constraint_solver_detail::SolveColoredRows(context, coloring->manifolds, reverse, solveManifold);
+            }
+        };
+
+        auto solveOrder = [&](const std::vector<std::size_t>& order) {
+            if (colorContacts) {
+                solveColoredContacts(false);
+                return;
+            }
+            for (std::size_t mi : order) {
+                solveManifold(mi);
+            }
+        };
+        auto solveOrderReverse = [&](const std::vector<std::size_t>& order) {
+            if (colorContacts) {
+                solveColoredContacts(true);
+                return;
+            }
+            for (auto it = order.rbegin(); it != order.rend(); ++it) {
+                solveManifold(*it);
+            }
+        };
+        auto solveHinges = [&]() {
+            if (colorHinges) {
+                constraint_solver_detail::SolveColoredRows(context, coloring->hinges, false, solveHinge);
+                return;
+            }
+            for (std::size_t hi : island.hinges) {
+                solveHinge(hi);
+            }
+        };
+        auto solveServos = [&]() {
+            if (colorServos) {
+                constraint_solver_detail::SolveColoredRows(context, coloring->servos, false, solveServo);
+                return;
+            }
+            for (std::size_t si : island.servos) {
+                solveServo(si);
+            }
+        };
+
+        if (context.worldResourceProfiler) {
+            {
+                const auto _s = context.worldResourceProfiler->scope(
+                    toIndex(Section::SolveIslandsContactsForward));
+                solveOrder(manifoldOrder);
+            }
+        } else {
+            solveOrder(manifoldOrder);
+        }
+
+        if (ordering == IslandSolveOrdering::ShockPropagation && manifoldOrder.size() > 1) {
+            if (context.worldResourceProfiler) {
+                const auto _s = context.worldResourceProfiler->scope(
+                    toIndex(Section::SolveIslandsContactsShock));
+                solveOrderReverse(manifoldOrder);
+            } else {
+                solveOrderReverse(manifoldOrder);
+            }
+        }
+
+        if (context.worldResourceProfiler) {
+            {
+                const auto _s = context.worldResourceProfiler->scope(
+                    toIndex(Section::SolveIslandsDistanceJoints));
+                for (std::size_t ji : island.joints) {
+                    context.hooks.SolveDistanceJoint(context.joints[ji]);
+                }
+            }
+        } else {
+            for (std::size_t ji : island.joints) {
+                context.hooks.SolveDistanceJoint(context.joints[ji]);
+            }
+        }
+
+        if (context.worldResourceProfiler) {
+            {
+                const auto _s = context.worldResourceProfiler->scope(
+                    toIndex(Section::SolveIslandsHingeJoints));
+                solveHinges();
+            }
+        } else {
+            solveHinges();
+        }
+
+        if (context.worldResourceProfiler) {
+            {
+                const auto _s = context.worldResourceProfiler->scope(
+                    toIndex(Section::SolveIslandsBallSocketJoints));
+                for (std::size_t bi : island.ballSockets) {
+                    context.hooks.SolveBallSocketJoint(context.ballSocketJoints[bi]);
+                }
+            }
+        } else {
+            for (std::size_t bi : island.ballSockets) {
+                context.hooks.SolveBallSocketJoint(context.ballSocketJoints[bi]);
+            }
+        }
+
+        if (context.worldResourceProfiler) {
+            {
+                const auto _s = context.worldResourceProfiler->scope(
+                    toIndex(Section::SolveIslandsFixedJoints));
+                for (std::size_t fi : island.fixeds) {
+                    context.hooks.SolveFixedJoint(context.fixedJoints[fi]);
+                }
+            }
+        } else {
+            for (std::size_t fi : island.fixeds) {
+                context.hooks.SolveFixedJoint(context.fixedJoints[fi]);
+            }
+        }
+
+        if (context.worldResourceProfiler) {
+            {
+                const auto _s = context.worldResourceProfiler->scope(
+                    toIndex(Section::SolveIslandsPrismaticJoints));
+                for (std::size_t pi : island.prismatics) {
+                    context.hooks.SolvePrismaticJoint(context.prismaticJoints[pi]);
+                }
+            }
+        } else {
+            for (std::size_t pi : island.prismatics) {
+                context.hooks.SolvePrismaticJoint(context.prismaticJoints[pi]);
+            }
+        }
+
+        if (context.worldResourceProfiler) {
+            {
+                const auto _s = context.worldResourceProfiler->scope(
+                    toIndex(Section::SolveIslandsServoJoints));
+                solveServos();
+            }
+        } else {
+            solveServos();
+        }
+    }
+}
+
+
 } // namespace minphys3d::core_internal
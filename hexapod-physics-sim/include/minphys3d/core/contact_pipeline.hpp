@@ -4,13 +4,18 @@
 
 namespace minphys3d::core_internal {
 
+template <typename Hooks>
 struct ContactPipelineContext {
-    const ContactSolverContext& solverContext;
+    const ContactSolverContext<Hooks>& solverContext;
 };
 
 class ContactPipeline {
 public:
-    void BuildManifolds(const ContactPipelineContext& context) const;
+    template <typename Hooks>
+    void BuildManifolds(const ContactPipelineContext<Hooks>& context) const {
+        ContactSolver solver;
+        solver.BuildManifolds(context.solverContext);
+    }
 };
 
 } // namespace minphys3d::core_internal
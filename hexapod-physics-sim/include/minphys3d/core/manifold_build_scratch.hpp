@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "minphys3d/solver/types.hpp"
+
+namespace minphys3d::core_internal {
+
+/// Working buffers for one manifold build (`ContactSolver::BuildManifolds` and
+/// `World::ManifoldManager::Process`). Nothing in here survives a build; the buffers are kept
+/// only for their capacity, so once they have seen the frame's high-water mark grouping,
+/// ordering and merging contacts never touch the heap.
+struct ManifoldBuildScratch {
+    /// (pair key, contact index): sorted, each run is one manifold's contacts in generation order.
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> contactsByPair;
+    /// Start of each run in `contactsByPair`, in manifold order.
+    std::vector<std::uint32_t> runStarts;
+    /// (pair key, manifold index) of the previous build, sorted for warm-start lookups.
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> previousByPair;
+    /// (contact key, slot) of the points being merged by key in `ManifoldManager::Process`.
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> mergeOrder;
+    std::vector<Contact> mergedContacts;
+};
+
+} // namespace minphys3d::core_internal
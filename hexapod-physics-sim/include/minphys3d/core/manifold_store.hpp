@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "minphys3d/solver/types.hpp"
+
+namespace minphys3d::core_internal {
+
+/// One manifold build: the manifolds and the contact pool their `ManifoldContacts` slices view
+/// into. Moves and swaps hand the pool's buffer over, so the slices stay valid; a copy gets a new
+/// buffer, so copying rebinds every slice to the copy's own pool.
+struct ManifoldStore {
+    std::vector<Manifold> manifolds;
+    std::vector<Contact> contacts;
+
+    ManifoldStore() = default;
+    ManifoldStore(const ManifoldStore& other) : manifolds(other.manifolds), contacts(other.contacts) {
+        RebindSlices();
+    }
+    ManifoldStore& operator=(const ManifoldStore& other) {
+        if (this != &other) {
+            manifolds = other.manifolds;
+            contacts = other.contacts;
+            RebindSlices();
+        }
+        return *this;
+    }
+    ManifoldStore(ManifoldStore&&) noexcept = default;
+    ManifoldStore& operator=(ManifoldStore&&) noexcept = default;
+
+    void swap(ManifoldStore& other) noexcept {
+        manifolds.swap(other.manifolds);
+        contacts.swap(other.contacts);
+    }
+
+private:
+    void RebindSlices() {
+        for (Manifold& manifold : manifolds) {
+            manifold.contacts.Bind(
+                contacts.data(), manifold.contacts.offset(), static_cast<std::uint32_t>(manifold.contacts.size()));
+        }
+    }
+};
+
+} // namespace minphys3d::core_internal
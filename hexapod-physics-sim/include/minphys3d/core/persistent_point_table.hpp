@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "minphys3d/core/world_types.hpp"
+#include "minphys3d/math/vec3.hpp"
+
+namespace minphys3d::core_internal {
+
+/// Cached impulse state of one persistent contact point, carried across steps for warm starting.
+struct PersistentPointImpulseState {
+    SolverReal normalImpulseSum = 0.0;
+    SolverReal tangentImpulseSum0 = 0.0;
+    SolverReal tangentImpulseSum1 = 0.0;
+    std::uint16_t persistenceAge = 0;
+    bool anchorsValid = false;
+    Vec3 localAnchorA{0.0, 0.0, 0.0};
+    Vec3 localAnchorB{0.0, 0.0, 0.0};
+    Vec3 worldPoint{0.0, 0.0, 0.0};
+};
+
+/// Flat store of persistent contact points. Points are appended manifold by manifold, so each
+/// manifold owns one contiguous slot range; an open-addressed index maps `ManifoldKey` to that
+/// range. `Clear()` keeps every buffer's capacity, so once the table has seen its high-water mark
+/// rebuilding it and matching against it never touch the heap.
+///
+/// Each slot also carries a claim flag so a matching pass can hand every previous point to at
+/// most one new contact without a side `unordered_set`.
+class PersistentPointTable {
+public:
+    struct Range {
+        std::uint32_t begin = 0;
+        std::uint32_t count = 0;
+    };
+
+    void Clear() {
+        keys_.clear();
+        states_.clear();
+        claimed_.clear();
+        manifolds_.clear();
+        std::fill(index_.begin(), index_.end(), 0u);
+        claimedCount_ = 0;
+    }
+
+    /// Starts the slot range for `manifold`; following `Upsert` calls land in it. A manifold key
+    /// must be opened at most once between `Clear()` calls.
+    void BeginManifold(const ManifoldKey& manifold) {
+        if ((manifolds_.size() + 1u) * 2u > index_.size()) {
+            Rehash(std::max<std::size_t>(16u, index_.size() * 2u));
+        }
+        manifolds_.push_back({manifold, {static_cast<std::uint32_t>(keys_.size()), 0u}});
+        InsertIndex(static_cast<std::uint32_t>(manifolds_.size() - 1u));
+    }
+
+    /// Writes `state` under `key` in the open manifold, overwriting an earlier point with the
+    /// same key (matches `unordered_map::operator[]` assignment).
+    void Upsert(const PersistentPointKey& key, const PersistentPointImpulseState& state) {
+        Range& range = manifolds_.back().range;
+        for (std::uint32_t slot = range.begin; slot < range.begin + range.count; ++slot) {
+            if (keys_[slot] == key) {
+                states_[slot] = state;
+                return;
+            }
+        }
+        keys_.push_back(key);
+        states_.push_back(state);
+        claimed_.push_back(0u);
+        ++range.count;
+    }
+
+    /// Slot range of `manifold`, empty if it holds no points.
+    Range Find(const ManifoldKey& manifold) const {
+        if (index_.empty()) {
+            return {};
+        }
+        const std::size_t mask = index_.size() - 1u;
+        for (std::size_t bucket = ManifoldKeyHash{}(manifold) & mask;; bucket = (bucket + 1u) & mask) {
+            const std::uint32_t entry = index_[bucket];
+            if (entry == 0u) {
+                return {};
+            }
+            if (manifolds_[entry - 1u].key == manifold) {
+                return manifolds_[entry - 1u].range;
+            }
+        }
+    }
+
+    void ResetClaims() {
+        std::fill(claimed_.begin(), claimed_.end(), 0u);
+        claimedCount_ = 0;
+    }
+    bool IsClaimed(std::uint32_t slot) const { return claimed_[slot] != 0u; }
+    void Claim(std::uint32_t slot) {
+        claimedCount_ += claimed_[slot] == 0u ? 1u : 0u;
+        claimed_[slot] = 1u;
+    }
+    std::size_t ClaimedCount() const { return claimedCount_; }
+
+    std::size_t Size() const { return keys_.size(); }
+    const PersistentPointKey& Key(std::uint32_t slot) const { return keys_[slot]; }
+    const PersistentPointImpulseState& State(std::uint32_t slot) const { return states_[slot]; }
+
+    /// Visits every buffer with a snapshot archive (`snapshot_archive.hpp`); the open-addressed
+    /// index and claim flags are stored as-is, so a restored table probes and matches identically.
+    template <typename Archive>
+    void Transfer(Archive& archive) {
+        archive.PodVector(keys_);
+        archive.PodVector(states_);
+        archive.PodVector(claimed_);
+        archive.PodVector(manifolds_);
+        archive.PodVector(index_);
+        archive.Pod(claimedCount_);
+    }
+
+private:
+    struct ManifoldEntry {
+        ManifoldKey key{};
+        Range range{};
+    };
+
+    void InsertIndex(std::uint32_t manifoldIndex) {
+        const std::size_t mask = index_.size() - 1u;
+        std::size_t bucket = ManifoldKeyHash{}(manifolds_[manifoldIndex].key) & mask;
+        while (index_[bucket] != 0u) {
+            bucket = (bucket + 1u) & mask;
+        }
+        index_[bucket] = manifoldIndex + 1u;
+    }
+
+    void Rehash(std::size_t bucketCount) {
+        index_.assign(bucketCount, 0u);
+        for (std::uint32_t i = 0; i < manifolds_.size(); ++i) {
+            InsertIndex(i);
+        }
+    }
+
+    std::vector<PersistentPointKey> keys_;
+    std::vector<PersistentPointImpulseState> states_;
+    std::vector<std::uint8_t> claimed_;
+    std::vector<ManifoldEntry> manifolds_;
+    /// Open-addressed (linear probing, power-of-two size, load <= 1/2); 0 = empty, else manifold index + 1.
+    std::vector<std::uint32_t> index_;
+    std::size_t claimedCount_ = 0;
+};
+
+} // namespace minphys3d::core_internal
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace minphys3d::core_internal {
+
+/// Appends raw field bytes to a snapshot payload (see `World::CaptureSnapshot`).
+///
+/// `SnapshotWriter` and `SnapshotReader` expose the same visiting interface, so one templated
+/// field list (`Transfer(Archive&)`) serves both capture and restore and the two can never drift
+/// apart. Trivially copyable values are stored as their native bytes; the blob header carries a
+/// layout fingerprint so a blob is only ever read back by a build with the same layout.
+class SnapshotWriter {
+public:
+    static constexpr bool kReading = false;
+
+    explicit SnapshotWriter(std::vector<std::uint8_t>& out) : out_(out) {}
+
+    template <typename T>
+    void Pod(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "snapshot Pod() needs a trivially copyable type");
+        Bytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+    void PodVector(std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>, "snapshot PodVector() needs a trivially copyable type");
+        std::uint64_t count = values.size();
+        Pod(count);
+        Bytes(values.data(), values.size() * sizeof(T));
+    }
+
+    /// Element count of a vector whose elements the caller then visits one by one.
+    template <typename T>
+    std::size_t Elements(std::vector<T>& values) {
+        std::uint64_t count = values.size();
+        Pod(count);
+        return values.size();
+    }
+
+    /// Bucket count and entries. The bucket count is kept because iteration order of an
+    /// `unordered_map` depends on it, and some per-frame maps are iterated by the pipeline.
+    template <typename Key, typename Value, typename Hash>
+    void PodMap(std::unordered_map<Key, Value, Hash>& map) {
+        static_assert(std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value>,
+                      "snapshot PodMap() needs trivially copyable keys and values");
+        std::uint64_t buckets = map.bucket_count();
+        std::uint64_t count = map.size();
+        Pod(buckets);
+        Pod(count);
+        for (const auto& [key, value] : map) {
+            Bytes(&key, sizeof(Key));
+            Bytes(&value, sizeof(Value));
+        }
+    }
+
+    bool Ok() const { return true; }
+
+private:
+    void Bytes(const void* data, std::size_t size) {
+        if (size == 0) {
+            return;
+        }
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+        out_.insert(out_.end(), bytes, bytes + size);
+    }
+
+    std::vector<std::uint8_t>& out_;
+};
+
+/// Reads a payload written by `SnapshotWriter`. Every read is bounds-checked; the first short
+/// read latches `Ok() == false` and later reads become no-ops.
+class SnapshotReader {
+public:
+    static constexpr bool kReading = true;
+
+    SnapshotReader(const std::uint8_t* data, std::size_t size) : data_(data), size_(size) {}
+
+    template <typename T>
+    void Pod(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "snapshot Pod() needs a trivially copyable type");
+        Bytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+    void PodVector(std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>, "snapshot PodVector() needs a trivially copyable type");
+        const std::size_t count = ReadCount(sizeof(T));
+        values.resize(count);
+        Bytes(values.data(), count * sizeof(T));
+    }
+
+    template <typename T>
+    std::size_t Elements(std::vector<T>& values) {
+        const std::size_t count = ReadCount(1u);
+        values.resize(count);
+        return count;
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    void PodMap(std::unordered_map<Key, Value, Hash>& map) {
+        static_assert(std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value>,
+                      "snapshot PodMap() needs trivially copyable keys and values");
+        std::uint64_t buckets = 0;
+        Pod(buckets);
+        const std::size_t count = ReadCount(sizeof(Key) + sizeof(Value));
+        map.clear();
+        if (!ok_) {
+            return;
+        }
+        map.rehash(static_cast<std::size_t>(buckets));
+        for (std::size_t i = 0; i < count; ++i) {
+            Key key{};
+            Value value{};
+            Bytes(&key, sizeof(Key));
+            Bytes(&value, sizeof(Value));
+            map.emplace(key, value);
+        }
+    }
+
+    bool Ok() const { return ok_; }
+    /// Latches failure for a payload that reads cleanly but holds inconsistent values.
+    void Reject() { ok_ = false; }
+    std::size_t Remaining() const { return size_ - offset_; }
+
+private:
+    /// Reads an element count and rejects it unless that many elements can still fit.
+    std::size_t ReadCount(std::size_t minElementBytes) {
+        std::uint64_t count = 0;
+        Pod(count);
+        if (!ok_ || count > Remaining() / minElementBytes) {
+            ok_ = false;
+            return 0;
+        }
+        return static_cast<std::size_t>(count);
+    }
+
+    void Bytes(void* data, std::size_t size) {
+        if (!ok_ || size > Remaining()) {
+            ok_ = false;
+            return;
+        }
+        if (size == 0) {
+            return;
+        }
+        std::memcpy(data, data_ + offset_, size);
+        offset_ += size;
+    }
+
+    const std::uint8_t* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t offset_ = 0;
+    bool ok_ = true;
+};
+
+} // namespace minphys3d::core_internal
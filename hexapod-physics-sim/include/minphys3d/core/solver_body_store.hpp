@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "minphys3d/core/body.hpp"
+
+namespace minphys3d::core_internal {
+
+/// View of the solver-visible state of one body. The PGS kernels only ever read pose, inverse
+/// mass and sleep state and write velocities, so they take this instead of `Body&`; material
+/// and shape fields stay on `body`. Fields are named like their `Body` counterparts so kernel
+/// code reads the same whichever storage backs the view.
+struct SolverBodyRef {
+    const Body& body;
+    const Vec3& position;
+    const Quat& orientation;
+    Vec3& velocity;
+    Vec3& angularVelocity;
+    Real invMass;
+    bool isSleeping;
+};
+
+/// Structure-of-arrays mirror of the fields in `SolverBodyRef`, gathered from `Body` right before
+/// the PGS iterations and scattered back (velocities only) right after. The iteration loop then
+/// streams a few dense arrays instead of striding over whole `Body` records. World-space inverse
+/// inertia already lives in its own array (`World::bodyInvInertiaWorld_`) and is not duplicated.
+struct SolverBodyStore {
+    std::vector<Vec3> position;
+    std::vector<Quat> orientation;
+    std::vector<Vec3> velocity;
+    std::vector<Vec3> angularVelocity;
+    std::vector<Real> invMass;
+    std::vector<std::uint8_t> sleeping;
+    /// True between `Gather` and `Scatter`; while false `Ref` views `Body` fields directly.
+    bool active = false;
+
+    void Gather(const std::vector<Body>& bodies) {
+        const std::size_t count = bodies.size();
+        position.resize(count);
+        orientation.resize(count);
+        velocity.resize(count);
+        angularVelocity.resize(count);
+        invMass.resize(count);
+        sleeping.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const Body& body = bodies[i];
+            position[i] = body.position;
+            orientation[i] = body.orientation;
+            velocity[i] = body.velocity;
+            angularVelocity[i] = body.angularVelocity;
+            invMass[i] = body.invMass;
+            sleeping[i] = body.isSleeping ? 1u : 0u;
+        }
+        active = true;
+    }
+
+    /// Writes solved velocities back. Pose, mass and sleep state are read-only during the solve.
+    void Scatter(std::vector<Body>& bodies) {
+        for (std::size_t i = 0; i < bodies.size(); ++i) {
+            bodies[i].velocity = velocity[i];
+            bodies[i].angularVelocity = angularVelocity[i];
+        }
+        active = false;
+    }
+
+    SolverBodyRef Ref(std::vector<Body>& bodies, std::uint32_t id) {
+        Body& body = bodies[id];
+        if (!active) {
+            return {body, body.position, body.orientation, body.velocity, body.angularVelocity,
+                    body.invMass, body.isSleeping};
+        }
+        return {body, position[id], orientation[id], velocity[id], angularVelocity[id],
+                invMass[id], sleeping[id] != 0u};
+    }
+};
+
+} // namespace minphys3d::core_internal
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "minphys3d/math/mat3.hpp"
+#include "minphys3d/math/vec3.hpp"
+
+namespace minphys3d::core_internal {
+
+/// Per-substep state of the residual-driven PGS early exit (`SolverConvergenceConfig`). Rebuilt
+/// before the first velocity pass of every substep; the buffers are kept only for their capacity.
+struct SolverConvergenceScratch {
+    /// Solver velocities at the end of the previous pass, per body (only island bodies are read).
+    std::vector<Vec3> velocity;
+    std::vector<Vec3> angularVelocity;
+    /// World inertia (inverse of `bodyInvInertiaWorld_`), per body, to turn Δω into an impulse.
+    std::vector<Mat3> inertiaWorld;
+    /// Islands still iterating, ascending; handed to `SolveIslands` as the island subset.
+    std::vector<std::size_t> activeIslands;
+    /// Per island: 1 while iterating.
+    std::vector<std::uint8_t> islandActive;
+    /// Per island: 1 when a joint position error exceeds `jointPositionTolerance`; such islands never
+    /// retire.
+    std::vector<std::uint8_t> islandPinned;
+    /// Per island: impulse deltas of the last pass it ran.
+    std::vector<Real> islandLinearDelta;
+    std::vector<Real> islandAngularDelta;
+    /// `islandSolveBatches_` restricted to `activeIslands` (parallel island solve only).
+    std::vector<std::vector<std::size_t>> activeBatches;
+};
+
+} // namespace minphys3d::core_internal
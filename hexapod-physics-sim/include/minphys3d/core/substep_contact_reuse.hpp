@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "minphys3d/math/quat.hpp"
+#include "minphys3d/math/vec3.hpp"
+
+namespace minphys3d::core_internal {
+
+/// Body poses at the last full contact build, for `SubstepContactReuseConfig`. Captured right after
+/// `BuildManifolds`; a later substep may keep those manifolds while every body stays within the
+/// motion budget of its captured pose.
+struct SubstepContactReuseState {
+    /// Per body, at the last build.
+    std::vector<Vec3> position;
+    std::vector<Quat> orientation;
+    /// Farthest AABB corner from the body origin (-1 when unbounded): bounds how far a surface
+    /// point moves for a given rotation.
+    std::vector<Real> boundingRadius;
+    std::vector<std::uint8_t> sleeping;
+    /// Sum of all joint list sizes; joints change which pairs the narrowphase skips.
+    std::uint64_t jointCount = 0;
+    /// Substeps solved on the captured manifolds since the last build.
+    std::uint32_t consecutiveReuses = 0;
+    /// Cleared whenever something the motion test cannot see changes (terrain).
+    bool valid = false;
+};
+
+} // namespace minphys3d::core_internal
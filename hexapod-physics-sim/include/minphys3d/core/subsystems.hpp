@@ -4,42 +4,26 @@
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <limits>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "minphys3d/collision/shapes.hpp"
 #include "minphys3d/core/world.hpp"
+#include "minphys3d/solver/contact_rows_wide.hpp"
 
 namespace minphys3d::core_internal {
 
+/// `Handlers` supplies one member per specialised pair routine (`SphereSphere(a, b)`, ...) plus
+/// `SelectConvexDispatchRoute(shapeA, shapeB)` and `ConvexOverlap(a, b)`. It is a concrete type,
+/// so `DispatchSpecialized` calls resolve statically and can be inlined.
+template <typename Handlers>
 struct NarrowphaseContext {
     const std::vector<Body>& bodies;
     const std::vector<Pair>& pairs;
-    std::function<ConvexDispatchRoute(ShapeType, ShapeType)> selectConvexDispatchRoute;
-    std::function<bool(std::uint32_t, std::uint32_t)> genericConvexOverlap;
-    std::function<void(std::uint32_t, std::uint32_t)> sphereSphere;
-    std::function<void(std::uint32_t, std::uint32_t)> sphereCapsule;
-    std::function<void(std::uint32_t, std::uint32_t)> capsuleCapsule;
-    std::function<void(std::uint32_t, std::uint32_t)> capsulePlane;
-    std::function<void(std::uint32_t, std::uint32_t)> capsuleBox;
-    std::function<void(std::uint32_t, std::uint32_t)> spherePlane;
-    std::function<void(std::uint32_t, std::uint32_t)> boxPlane;
-    std::function<void(std::uint32_t, std::uint32_t)> sphereBox;
-    std::function<void(std::uint32_t, std::uint32_t)> boxBox;
-    std::function<void(std::uint32_t, std::uint32_t)> convexPlane;
-    std::function<void(std::uint32_t, std::uint32_t)> convexConvexEpa;
-    std::function<void(std::uint32_t, std::uint32_t)> sphereCylinder;
-    std::function<void(std::uint32_t, std::uint32_t)> cylinderBox;
-    std::function<void(std::uint32_t, std::uint32_t)> cylinderCylinder;
-    std::function<void(std::uint32_t, std::uint32_t)> capsuleCylinder;
-    std::function<void(std::uint32_t, std::uint32_t)> sphereHalfCylinder;
-    std::function<void(std::uint32_t, std::uint32_t)> halfCylinderBox;
-    std::function<void(std::uint32_t, std::uint32_t)> halfCylinderCylinder;
-    std::function<void(std::uint32_t, std::uint32_t)> halfCylinderHalfCylinder;
-    std::function<void(std::uint32_t, std::uint32_t)> capsuleHalfCylinder;
+    const Handlers& handlers;
 };
 
 class NarrowphaseSystem {
@@ -64,95 +48,102 @@ public:
         return shape == ShapeType::HalfCylinder;
     }
 
-    static void DispatchSpecialized(const NarrowphaseContext& context, const Pair& pair, const Body& a, const Body& b) {
+    template <typename Handlers>
+    static void DispatchSpecialized(const NarrowphaseContext<Handlers>& context, const Pair& pair, const Body& a, const Body& b) {
         const bool aBoxLike = IsBoxLikeShape(a.shape);
         const bool bBoxLike = IsBoxLikeShape(b.shape);
 
         if (a.shape == ShapeType::Sphere && b.shape == ShapeType::Sphere) {
-            context.sphereSphere(pair.a, pair.b);
+            context.handlers.SphereSphere(pair.a, pair.b);
         } else if (a.shape == ShapeType::Sphere && b.shape == ShapeType::Capsule) {
-            context.sphereCapsule(pair.a, pair.b);
+            context.handlers.SphereCapsule(pair.a, pair.b);
         } else if (a.shape == ShapeType::Capsule && b.shape == ShapeType::Sphere) {
-            context.sphereCapsule(pair.b, pair.a);
+            context.handlers.SphereCapsule(pair.b, pair.a);
         } else if (a.shape == ShapeType::Capsule && b.shape == ShapeType::Capsule) {
-            context.capsuleCapsule(pair.a, pair.b);
+            context.handlers.CapsuleCapsule(pair.a, pair.b);
         } else if (a.shape == ShapeType::Capsule && b.shape == ShapeType::Plane) {
-            context.capsulePlane(pair.a, pair.b);
+            context.handlers.CapsulePlane(pair.a, pair.b);
         } else if (a.shape == ShapeType::Plane && b.shape == ShapeType::Capsule) {
-            context.capsulePlane(pair.b, pair.a);
+            context.handlers.CapsulePlane(pair.b, pair.a);
         } else if (a.shape == ShapeType::Capsule && bBoxLike) {
-            context.capsuleBox(pair.a, pair.b);
+            context.handlers.CapsuleBox(pair.a, pair.b);
         } else if (aBoxLike && b.shape == ShapeType::Capsule) {
-            context.capsuleBox(pair.b, pair.a);
+            context.handlers.CapsuleBox(pair.b, pair.a);
         } else if (a.shape == ShapeType::Sphere && b.shape == ShapeType::Plane) {
-            context.spherePlane(pair.a, pair.b);
+            context.handlers.SpherePlane(pair.a, pair.b);
         } else if (a.shape == ShapeType::Plane && b.shape == ShapeType::Sphere) {
-            context.spherePlane(pair.b, pair.a);
+            context.handlers.SpherePlane(pair.b, pair.a);
         } else if (aBoxLike && b.shape == ShapeType::Plane) {
-            context.boxPlane(pair.a, pair.b);
+            context.handlers.BoxPlane(pair.a, pair.b);
         } else if (a.shape == ShapeType::Plane && bBoxLike) {
-            context.boxPlane(pair.b, pair.a);
+            context.handlers.BoxPlane(pair.b, pair.a);
         } else if (a.shape == ShapeType::Sphere && bBoxLike) {
-            context.sphereBox(pair.a, pair.b);
+            context.handlers.SphereBox(pair.a, pair.b);
         } else if (aBoxLike && b.shape == ShapeType::Sphere) {
-            context.sphereBox(pair.b, pair.a);
+            context.handlers.SphereBox(pair.b, pair.a);
         } else if (IsCylinderFamily(a.shape) && b.shape == ShapeType::Plane) {
-            context.convexPlane(pair.a, pair.b);
+            context.handlers.ConvexPlane(pair.a, pair.b);
         } else if (a.shape == ShapeType::Plane && IsCylinderFamily(b.shape)) {
-            context.convexPlane(pair.b, pair.a);
+            context.handlers.ConvexPlane(pair.b, pair.a);
         } else if (aBoxLike && bBoxLike) {
-            context.boxBox(pair.a, pair.b);
+            context.handlers.BoxBox(pair.a, pair.b);
         } else if (a.shape == ShapeType::Sphere && IsFullCylinderShape(b.shape)) {
-            context.sphereCylinder(pair.a, pair.b);
+            context.handlers.SphereCylinder(pair.a, pair.b);
         } else if (IsFullCylinderShape(a.shape) && b.shape == ShapeType::Sphere) {
-            context.sphereCylinder(pair.b, pair.a);
+            context.handlers.SphereCylinder(pair.b, pair.a);
         } else if (IsFullCylinderShape(a.shape) && bBoxLike) {
-            context.cylinderBox(pair.a, pair.b);
+            context.handlers.CylinderBox(pair.a, pair.b);
         } else if (aBoxLike && IsFullCylinderShape(b.shape)) {
-            context.cylinderBox(pair.b, pair.a);
+            context.handlers.CylinderBox(pair.b, pair.a);
         } else if (IsFullCylinderShape(a.shape) && IsFullCylinderShape(b.shape)) {
-            context.cylinderCylinder(pair.a, pair.b);
+            context.handlers.CylinderCylinder(pair.a, pair.b);
         } else if (a.shape == ShapeType::Capsule && IsFullCylinderShape(b.shape)) {
-            context.capsuleCylinder(pair.a, pair.b);
+            context.handlers.CapsuleCylinder(pair.a, pair.b);
         } else if (IsFullCylinderShape(a.shape) && b.shape == ShapeType::Capsule) {
-            context.capsuleCylinder(pair.b, pair.a);
+            context.handlers.CapsuleCylinder(pair.b, pair.a);
         } else if (a.shape == ShapeType::Sphere && IsHalfCylinderShape(b.shape)) {
-            context.sphereHalfCylinder(pair.a, pair.b);
+            context.handlers.SphereHalfCylinder(pair.a, pair.b);
         } else if (IsHalfCylinderShape(a.shape) && b.shape == ShapeType::Sphere) {
-            context.sphereHalfCylinder(pair.b, pair.a);
+            context.handlers.SphereHalfCylinder(pair.b, pair.a);
         } else if (IsHalfCylinderShape(a.shape) && bBoxLike) {
-            context.halfCylinderBox(pair.a, pair.b);
+            context.handlers.HalfCylinderBox(pair.a, pair.b);
         } else if (aBoxLike && IsHalfCylinderShape(b.shape)) {
-            context.halfCylinderBox(pair.b, pair.a);
+            context.handlers.HalfCylinderBox(pair.b, pair.a);
         } else if (IsHalfCylinderShape(a.shape) && IsFullCylinderShape(b.shape)) {
-            context.halfCylinderCylinder(pair.a, pair.b);
+            context.handlers.HalfCylinderCylinder(pair.a, pair.b);
         } else if (IsFullCylinderShape(a.shape) && IsHalfCylinderShape(b.shape)) {
-            context.halfCylinderCylinder(pair.b, pair.a);
+            context.handlers.HalfCylinderCylinder(pair.b, pair.a);
         } else if (IsHalfCylinderShape(a.shape) && IsHalfCylinderShape(b.shape)) {
-            context.halfCylinderHalfCylinder(pair.a, pair.b);
+            context.handlers.HalfCylinderHalfCylinder(pair.a, pair.b);
         } else if (a.shape == ShapeType::Capsule && IsHalfCylinderShape(b.shape)) {
-            context.capsuleHalfCylinder(pair.a, pair.b);
+            context.handlers.CapsuleHalfCylinder(pair.a, pair.b);
         } else if (IsHalfCylinderShape(a.shape) && b.shape == ShapeType::Capsule) {
-            context.capsuleHalfCylinder(pair.b, pair.a);
+            context.handlers.CapsuleHalfCylinder(pair.b, pair.a);
         } else if (
             (IsCylinderFamily(a.shape) && IsConvexPrimitiveShape(b.shape) && b.shape != ShapeType::Plane)
             || (IsCylinderFamily(b.shape) && IsConvexPrimitiveShape(a.shape) && a.shape != ShapeType::Plane)) {
-            context.convexConvexEpa(pair.a, pair.b);
+            context.handlers.ConvexConvexEPA(pair.a, pair.b);
         }
     }
 
-    void GenerateContacts(const NarrowphaseContext& context) const {
-        for (const Pair& pair : context.pairs) {
+    template <typename Handlers>
+    void GenerateContacts(const NarrowphaseContext<Handlers>& context) const {
+        GenerateContacts(context, 0, context.pairs.size());
+    }
+
+    /// Pairs `[begin, end)` of `context.pairs` only (one slice of a parallel narrowphase).
+    template <typename Handlers>
+    void GenerateContacts(const NarrowphaseContext<Handlers>& context, std::size_t begin, std::size_t end) const {
+        for (std::size_t pairIndex = begin; pairIndex < end; ++pairIndex) {
+            const Pair& pair = context.pairs[pairIndex];
             const Body& a = context.bodies[pair.a];
             const Body& b = context.bodies[pair.b];
             const bool eligibleConvex = IsConvexShape(a.shape) && IsConvexShape(b.shape);
-            const ConvexDispatchRoute route = (eligibleConvex && context.selectConvexDispatchRoute)
-                ? context.selectConvexDispatchRoute(a.shape, b.shape)
+            const ConvexDispatchRoute route = eligibleConvex
+                ? context.handlers.SelectConvexDispatchRoute(a.shape, b.shape)
                 : ConvexDispatchRoute::SpecializedOnly;
 
-            const bool genericOverlap = (!eligibleConvex || !context.genericConvexOverlap)
-                ? true
-                : context.genericConvexOverlap(pair.a, pair.b);
+            const bool genericOverlap = eligibleConvex ? context.handlers.ConvexOverlap(pair.a, pair.b) : true;
 
             if (route == ConvexDispatchRoute::GenericOnly) {
                 if (!genericOverlap) {
@@ -170,6 +161,10 @@ public:
     }
 };
 
+/// `Hooks` supplies the World-side callbacks used by `ContactSolver` (manifold bookkeeping,
+/// normal solves, impulse application, telemetry counters). Only the members a given entry point
+/// calls need to exist: `BuildManifolds` and `SolveContactsInManifold` use disjoint sets.
+template <typename Hooks>
 struct ContactSolverContext {
     std::vector<Body>& bodies;
     std::vector<Contact>& contacts;
@@ -179,54 +174,76 @@ struct ContactSolverContext {
     // Constant across PGS iterations; nullptr is permitted for callers that haven't
     // populated it yet (will fall back to Body::InvInertiaWorld()).
     const std::vector<Mat3>* bodyInvInertiaWorld = nullptr;
-    std::function<bool(const ManifoldKey&, const Contact&, Real&, std::array<Real, 2>&, std::uint16_t&)> tryGetPersistentImpulseState;
-    std::function<void(Manifold&, const Manifold*)> manageManifoldContacts;
-    std::function<void(Manifold&)> refreshManifoldBlockCache;
-    std::function<void(Manifold&)> selectBlockSolvePair;
-    std::function<void(const Manifold&)> recordSelectedPairHistory;
-    std::function<void(Manifold&)> solveManifoldNormalImpulses;
-    std::function<int(const Manifold&, std::uint64_t)> findBlockSlot;
-    std::function<void(Body&, Body&, const Mat3&, const Mat3&, const Vec3&, const Vec3&, const Vec3&)> applyImpulse;
-    std::function<void(bool)> recordTangentBasisState;
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-    std::function<void(FrictionBudgetNormalSupportSource)> recordFrictionBudgetSaturation;
-    std::function<void(bool)> recordManifoldTangentReprojection;
-#endif
+    // World's solver body mirror; nullptr (or an inactive store) solves on `bodies` directly.
+    SolverBodyStore* solverBodies = nullptr;
+    const Hooks& hooks;
     const ContactSolverConfig& config;
+    // `BuildManifolds` only: receives every manifold's contacts (see `ManifoldContacts`), and
+    // its reusable working buffers.
+    std::vector<Contact>* manifoldContactPool = nullptr;
+    ManifoldBuildScratch* buildScratch = nullptr;
 };
 
 class ContactSolver {
 public:
-    void BuildManifolds(const ContactSolverContext& context) const {
+    template <typename Hooks>
+    static SolverBodyRef SolverBody(const ContactSolverContext<Hooks>& context, std::uint32_t id) {
+        if (context.solverBodies != nullptr) {
+            return context.solverBodies->Ref(context.bodies, id);
+        }
+        Body& body = context.bodies[id];
+        return {body, body.position, body.orientation, body.velocity, body.angularVelocity, body.invMass,
+                body.isSleeping};
+    }
+
+    template <typename Hooks>
+    void BuildManifolds(const ContactSolverContext<Hooks>& context) const {
+        assert(context.manifoldContactPool != nullptr && context.buildScratch != nullptr);
+        std::vector<Contact>& pool = *context.manifoldContactPool;
+        ManifoldBuildScratch& scratch = *context.buildScratch;
         context.manifolds.clear();
-        // Group contacts into manifolds by (a,b) pair via O(1) hash lookup.
-        // Was an O(M) linear scan per contact, scaling O(C*M) overall.
-        std::unordered_map<std::uint64_t, std::size_t> pairKeyToIdx;
-        pairKeyToIdx.reserve(context.contacts.size());
-        for (const Contact& c : context.contacts) {
+
+        // Group contacts into manifolds by (a,b) pair. Sorting (pair key, contact index) leaves
+        // one run per pair with its contacts in generation order; each run is copied into one
+        // contiguous slice of `pool`, which the manifold then views.
+        std::vector<std::pair<std::uint64_t, std::uint32_t>>& byPair = scratch.contactsByPair;
+        byPair.clear();
+        for (std::size_t i = 0; i < context.contacts.size(); ++i) {
+            const Contact& c = context.contacts[i];
             const std::uint32_t lo = std::min(c.a, c.b);
             const std::uint32_t hi = std::max(c.a, c.b);
-            const std::uint64_t key = (static_cast<std::uint64_t>(lo) << 32) | hi;
-            auto it = pairKeyToIdx.find(key);
-            if (it != pairKeyToIdx.end()) {
-                Manifold& m = context.manifolds[it->second];
-                m.contacts.push_back(c);
-                m.normal = c.normal;
-            } else {
-                Manifold m;
-                m.a = c.a;
-                m.b = c.b;
-                m.normal = c.normal;
-                m.manifoldType = c.manifoldType;
-                m.contacts.push_back(c);
-                pairKeyToIdx.emplace(key, context.manifolds.size());
-                context.manifolds.push_back(m);
+            byPair.emplace_back((static_cast<std::uint64_t>(lo) << 32) | hi, static_cast<std::uint32_t>(i));
+        }
+        std::sort(byPair.begin(), byPair.end());
+        std::vector<std::uint32_t>& runStarts = scratch.runStarts;
+        runStarts.clear();
+        for (std::uint32_t i = 0; i < byPair.size(); ++i) {
+            if (i == 0u || byPair[i].first != byPair[i - 1u].first) {
+                runStarts.push_back(i);
             }
         }
+        // Deterministic ordering sorts manifolds by pair key, which is unique per manifold, so
+        // the runs are already in that order. Otherwise manifolds follow their first contact.
+        if (!context.config.enableDeterministicOrdering) {
+            std::sort(runStarts.begin(), runStarts.end(), [&](std::uint32_t lhs, std::uint32_t rhs) {
+                return byPair[lhs].second < byPair[rhs].second;
+            });
+        }
 
-        if (context.config.enableDeterministicOrdering) {
-            for (Manifold& m : context.manifolds) {
-                std::stable_sort(m.contacts.begin(), m.contacts.end(), [](const Contact& lhs, const Contact& rhs) {
+        pool.resize(context.contacts.size());
+        std::uint32_t poolCursor = 0;
+        for (const std::uint32_t start : runStarts) {
+            std::uint32_t end = start + 1u;
+            while (end < byPair.size() && byPair[end].first == byPair[start].first) {
+                ++end;
+            }
+            const Contact& first = context.contacts[byPair[start].second];
+            const Contact& last = context.contacts[byPair[end - 1u].second];
+            if (context.config.enableDeterministicOrdering) {
+                // The index tie-break gives the stable-sort order without its temporary buffer.
+                std::sort(byPair.begin() + start, byPair.begin() + end, [&](const auto& lhsEntry, const auto& rhsEntry) {
+                    const Contact& lhs = context.contacts[lhsEntry.second];
+                    const Contact& rhs = context.contacts[rhsEntry.second];
                     if (lhs.key != rhs.key) {
                         return lhs.key < rhs.key;
                     }
@@ -242,34 +259,42 @@ public:
                     if (lhs.point.x != rhs.point.x) {
                         return lhs.point.x < rhs.point.x;
                     }
-                    return lhs.point.z < rhs.point.z;
+                    if (lhs.point.z != rhs.point.z) {
+                        return lhs.point.z < rhs.point.z;
+                    }
+                    return lhsEntry.second < rhsEntry.second;
                 });
             }
-            std::stable_sort(context.manifolds.begin(), context.manifolds.end(), [](const Manifold& lhs, const Manifold& rhs) {
-                if (lhs.pairKey() != rhs.pairKey()) {
-                    return lhs.pairKey() < rhs.pairKey();
-                }
-                if (lhs.manifoldType != rhs.manifoldType) {
-                    return lhs.manifoldType < rhs.manifoldType;
-                }
-                return lhs.contacts.size() < rhs.contacts.size();
-            });
+            for (std::uint32_t i = start; i < end; ++i) {
+                pool[poolCursor + (i - start)] = context.contacts[byPair[i].second];
+            }
+            Manifold m;
+            m.a = first.a;
+            m.b = first.b;
+            m.normal = last.normal;
+            m.manifoldType = first.manifoldType;
+            m.contacts.Bind(pool.data(), poolCursor, end - start);
+            poolCursor += end - start;
+            context.manifolds.push_back(m);
         }
 
-        // Build a one-shot pairKey -> previous-manifold pointer table so the per-new-manifold
-        // warm-start lookup below is O(1) instead of O(prev_M).
-        std::unordered_map<std::uint64_t, const Manifold*> previousByPairKey;
-        previousByPairKey.reserve(context.previousManifolds.size());
-        for (const Manifold& old : context.previousManifolds) {
-            previousByPairKey.emplace(old.pairKey(), &old);
+        // Sorted (pair key, index) table of the previous build for the per-manifold warm-start
+        // lookup below.
+        std::vector<std::pair<std::uint64_t, std::uint32_t>>& previousByPair = scratch.previousByPair;
+        previousByPair.clear();
+        for (std::size_t i = 0; i < context.previousManifolds.size(); ++i) {
+            previousByPair.emplace_back(context.previousManifolds[i].pairKey(), static_cast<std::uint32_t>(i));
         }
+        std::sort(previousByPair.begin(), previousByPair.end());
         for (Manifold& m : context.manifolds) {
             if (!m.contacts.empty()) {
                 m.manifoldType = m.contacts.front().manifoldType;
             }
             const Manifold* previous = nullptr;
-            if (auto it = previousByPairKey.find(m.pairKey()); it != previousByPairKey.end()) {
-                previous = it->second;
+            const auto it = std::lower_bound(
+                previousByPair.begin(), previousByPair.end(), std::pair<std::uint64_t, std::uint32_t>{m.pairKey(), 0u});
+            if (it != previousByPair.end() && it->first == m.pairKey()) {
+                previous = &context.previousManifolds[it->second];
                 m.blockNormalImpulseSum = previous->blockNormalImpulseSum;
                 m.blockContactKeys = previous->blockContactKeys;
                 m.blockSlotValid = previous->blockSlotValid;
@@ -278,7 +303,7 @@ public:
             m.lowQuality = false;
             m.blockSolveEligible = false;
             m.usedBlockSolve = false;
-            context.manageManifoldContacts(m, previous);
+            context.hooks.ManageManifoldContacts(m, previous);
 
             if (previous == nullptr) {
                 m.blockNormalImpulseSum = {0.0, 0.0};
@@ -305,10 +330,10 @@ public:
 
             const ManifoldKey manifoldId{std::min(m.a, m.b), std::max(m.a, m.b), m.manifoldType};
             for (Contact& c : m.contacts) {
-                Real normalImpulse = 0.0;
-                std::array<Real, 2> tangentImpulse{0.0, 0.0};
+                SolverReal normalImpulse = 0.0;
+                std::array<SolverReal, 2> tangentImpulse{0.0, 0.0};
                 std::uint16_t persistenceAge = 0;
-                if (context.tryGetPersistentImpulseState(manifoldId, c, normalImpulse, tangentImpulse, persistenceAge)) {
+                if (context.hooks.TryGetPersistentImpulseState(manifoldId, c, normalImpulse, tangentImpulse, persistenceAge)) {
                     c.normalImpulseSum = normalImpulse;
                     c.tangentImpulseSum0 = tangentImpulse[0];
                     c.tangentImpulseSum1 = tangentImpulse[1];
@@ -329,27 +354,285 @@ public:
                 m.manifoldTangentImpulseSum = {old0, old1};
                 m.manifoldTangentImpulseValid = true;
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                if (context.recordManifoldTangentReprojection) {
-                    context.recordManifoldTangentReprojection(true);
-                }
+                context.hooks.RecordManifoldTangentReprojection(true);
 #endif
             } else {
                 m.manifoldTangentImpulseSum = {0.0, 0.0};
                 m.manifoldTangentImpulseValid = false;
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                if (context.recordManifoldTangentReprojection) {
-                    context.recordManifoldTangentReprojection(false);
+                context.hooks.RecordManifoldTangentReprojection(false);
+#endif
+            }
+
+            context.hooks.RefreshManifoldBlockCache(m);
+            context.hooks.SelectBlockSolvePair(m);
+            context.hooks.RecordSelectedPairHistory(m);
+        }
+    }
+
+    /// Whether `SolveContactsInManifolds4` can take `manifold` as a lane: every contact must run
+    /// from `manifold.a` to `manifold.b`, so the lane's body pair serves all of its rows.
+    static bool IsWideRowEligible(const Manifold& manifold) {
+        if (manifold.contacts.empty()) {
+            return false;
+        }
+        return std::all_of(manifold.contacts.begin(), manifold.contacts.end(), [&](const Contact& c) {
+            return c.a == manifold.a && c.b == manifold.b;
+        });
+    }
+
+    template <typename Hooks>
+    void SolveContactsInManifold(const ContactSolverContext<Hooks>& context, Manifold& manifold) const {
+        AssertBlockSelection(manifold);
+        context.hooks.SolveManifoldNormalImpulses(manifold);
+        SyncBlockNormalImpulses(context, manifold);
+
+        Vec3 manifoldRelativeVelocity = SolverBody(context, manifold.b).velocity - SolverBody(context, manifold.a).velocity;
+        if (!manifold.contacts.empty()) {
+            manifoldRelativeVelocity = {};
+            for (const Contact& c : manifold.contacts) {
+                const SolverBodyRef a = SolverBody(context, c.a);
+                const SolverBodyRef b = SolverBody(context, c.b);
+                const Vec3 ra = c.point - a.position;
+                const Vec3 rb = c.point - b.position;
+                const Vec3 va = a.velocity + Cross(a.angularVelocity, ra);
+                const Vec3 vb = b.velocity + Cross(b.angularVelocity, rb);
+                manifoldRelativeVelocity += (vb - va);
+            }
+            manifoldRelativeVelocity = manifoldRelativeVelocity / static_cast<float>(manifold.contacts.size());
+        }
+
+        FrictionSetup friction{};
+        if (!BeginManifoldFriction(context, manifold, manifoldRelativeVelocity, friction)) {
+            return;
+        }
+        const Real mu = friction.mu;
+        const Real manifoldBudget = friction.manifoldBudget;
+        const bool useManifoldBudget = friction.useManifoldBudget;
+        std::array<SolverReal, 2> accumulatedTangent = friction.accumulatedTangent;
+        Real meanSlipSpeed = 0.0;
+        std::uint32_t slipSamples = 0;
+
+        for (Contact& c : manifold.contacts) {
+            const SolverBodyRef a = SolverBody(context, c.a);
+            const SolverBodyRef b = SolverBody(context, c.b);
+
+            // Read from the world's per-body cache (refreshed once per substep) when available;
+            // fall back to recomputing only if the caller hasn't populated the cache.
+            const Mat3 invIA = (context.bodyInvInertiaWorld != nullptr)
+                ? (*context.bodyInvInertiaWorld)[c.a]
+                : a.body.InvInertiaWorld();
+            const Mat3 invIB = (context.bodyInvInertiaWorld != nullptr)
+                ? (*context.bodyInvInertiaWorld)[c.b]
+                : b.body.InvInertiaWorld();
+            const Vec3 ra = c.point - a.position;
+            const Vec3 rb = c.point - b.position;
+
+            const Vec3 va2 = a.velocity + Cross(a.angularVelocity, ra);
+            const Vec3 vb2 = b.velocity + Cross(b.angularVelocity, rb);
+            const Vec3 rv2 = vb2 - va2;
+            const Real slipSpeed = std::sqrt(
+                Dot(rv2, manifold.t0) * Dot(rv2, manifold.t0)
+                + Dot(rv2, manifold.t1) * Dot(rv2, manifold.t1));
+            meanSlipSpeed += slipSpeed;
+            ++slipSamples;
+            const Vec3 raCrossT0 = Cross(ra, manifold.t0);
+            const Vec3 rbCrossT0 = Cross(rb, manifold.t0);
+            const Vec3 raCrossT1 = Cross(ra, manifold.t1);
+            const Vec3 rbCrossT1 = Cross(rb, manifold.t1);
+            Real tangentMass0 = a.invMass + b.invMass + Dot(raCrossT0, invIA * raCrossT0) + Dot(rbCrossT0, invIB * rbCrossT0);
+            Real tangentMass1 = context.config.enableTwoAxisFrictionSolve
+                ? (a.invMass + b.invMass + Dot(raCrossT1, invIA * raCrossT1) + Dot(rbCrossT1, invIB * rbCrossT1))
+                : std::numeric_limits<float>::infinity();
+            context.hooks.AdjustTangentMasses(manifold, c, tangentMass0, tangentMass1);
+            if (tangentMass0 <= kEpsilon || tangentMass1 <= kEpsilon) {
+                continue;
+            }
+
+            const std::array<SolverReal, 2> oldT{c.tangentImpulseSum0, c.tangentImpulseSum1};
+            std::array<SolverReal, 2> newT{
+                c.tangentImpulseSum0 - Dot(rv2, manifold.t0) / tangentMass0,
+                c.tangentImpulseSum1 - Dot(rv2, manifold.t1) / tangentMass1};
+            if (!context.config.enableTwoAxisFrictionSolve) {
+                newT[1] = 0.0;
+            }
+            if (friction.canUseStick && manifold.stickConstraintActive) {
+                const Real retention = std::clamp<Real>(context.config.stickImpulseRetention, 0.0, 1.0);
+                newT[0] = retention * oldT[0] + (1.0 - retention) * newT[0];
+                newT[1] = retention * oldT[1] + (1.0 - retention) * newT[1];
+            }
+
+            const Real perContactLimit = mu * std::max<Real>(c.normalImpulseSum, 0.0);
+            const Real contactLenSq = newT[0] * newT[0] + newT[1] * newT[1];
+            if (contactLenSq > perContactLimit * perContactLimit && perContactLimit > kEpsilon) {
+                const Real scale = perContactLimit / std::sqrt(contactLenSq);
+                newT[0] *= scale;
+                newT[1] *= scale;
+            } else if (perContactLimit <= kEpsilon) {
+                newT = {0.0, 0.0};
+            }
+
+            std::array<SolverReal, 2> candidateAccumulated{
+                accumulatedTangent[0] - oldT[0] + newT[0],
+                accumulatedTangent[1] - oldT[1] + newT[1]};
+            if (useManifoldBudget) {
+                if (context.config.frictionBudgetUseRadialClamp) {
+                    const Real lenSq = candidateAccumulated[0] * candidateAccumulated[0]
+                        + candidateAccumulated[1] * candidateAccumulated[1];
+                    const Real maxLenSq = manifoldBudget * manifoldBudget;
+                    if (lenSq > maxLenSq && manifoldBudget > kEpsilon) {
+                        const Real scale = manifoldBudget / std::sqrt(lenSq);
+                        newT[0] = oldT[0] + (newT[0] - oldT[0]) * scale;
+                        newT[1] = oldT[1] + (newT[1] - oldT[1]) * scale;
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+                        context.hooks.RecordFrictionBudgetSaturation(context.config.frictionBudgetNormalSupportSource);
+#endif
+                    }
+                } else {
+                    newT[0] = std::clamp<SolverReal>(newT[0], -manifoldBudget, manifoldBudget);
+                    newT[1] = std::clamp<SolverReal>(newT[1], -manifoldBudget, manifoldBudget);
+                }
+            }
+
+            c.tangentImpulseSum0 = newT[0];
+            c.tangentImpulseSum1 = newT[1];
+            c.tangentImpulseSum = c.tangentImpulseSum0;
+            const Real lambdaT0 = c.tangentImpulseSum0 - oldT[0];
+            const Real lambdaT1 = c.tangentImpulseSum1 - oldT[1];
+            const Vec3 tangentImpulse = lambdaT0 * manifold.t0 + lambdaT1 * manifold.t1;
+            context.hooks.ApplyImpulse(a, b, invIA, invIB, ra, rb, tangentImpulse);
+            accumulatedTangent[0] += lambdaT0;
+            accumulatedTangent[1] += lambdaT1;
+        }
+        FinishManifoldFriction(context, manifold, friction, accumulatedTangent, meanSlipSpeed, slipSamples);
+    }
+
+    /// `ContactRowKernel::Wide4`: solves up to four manifolds of one colour (no shared dynamic
+    /// body, each passing `IsWideRowEligible`) as lanes. Block / face-4 normal solves still run
+    /// per manifold; the scalar normal rows and all friction rows run lane-packed on a gathered
+    /// copy of the lanes' bodies. Results are bit-identical to `SolveContactsInManifold` on each
+    /// (to rounding in the mixed build; see `solver/contact_rows_wide.hpp`).
+    template <typename Hooks>
+    void SolveContactsInManifolds4(const ContactSolverContext<Hooks>& context,
+                                   Manifold* const* lanes,
+                                   std::size_t laneCount) const {
+        using solver_internal::kContactRowLanes;
+        assert(laneCount <= kContactRowLanes);
+        std::array<typename Hooks::ManifoldNormalRoute, kContactRowLanes> routes{};
+        for (std::size_t l = 0; l < laneCount; ++l) {
+            AssertBlockSelection(*lanes[l]);
+            routes[l] = context.hooks.BeginManifoldNormalSolve(*lanes[l]);
+        }
+
+        // Gathered after the block solves, which write the bodies directly.
+        solver_internal::ContactBodyLanes bodies{};
+        for (std::size_t l = 0; l < laneCount; ++l) {
+            GatherBodyLane(context, lanes[l]->a, l, bodies.positionA, bodies.velocityA, bodies.angularVelocityA,
+                           bodies.invMassA, bodies.invInertiaA, bodies.writableA);
+            GatherBodyLane(context, lanes[l]->b, l, bodies.positionB, bodies.velocityB, bodies.angularVelocityB,
+                           bodies.invMassB, bodies.invInertiaB, bodies.writableB);
+        }
+
+        context.hooks.SolveNormalRows4(lanes, routes.data(), laneCount, bodies);
+
+        solver_internal::FrictionManifoldLanes frictionLanes{};
+        std::array<FrictionSetup, kContactRowLanes> friction{};
+        std::array<bool, kContactRowLanes> hasFriction{};
+        std::size_t rowCount = 0;
+        for (std::size_t l = 0; l < laneCount; ++l) {
+            Manifold& manifold = *lanes[l];
+            context.hooks.FinishManifoldNormalSolve(manifold, routes[l]);
+            SyncBlockNormalImpulses(context, manifold);
+
+            Vec3 manifoldRelativeVelocity{};
+            for (const Contact& c : manifold.contacts) {
+                const Vec3 ra = c.point - bodies.positionA.Get(l);
+                const Vec3 rb = c.point - bodies.positionB.Get(l);
+                const Vec3 va = bodies.velocityA.Get(l) + Cross(bodies.angularVelocityA.Get(l), ra);
+                const Vec3 vb = bodies.velocityB.Get(l) + Cross(bodies.angularVelocityB.Get(l), rb);
+                manifoldRelativeVelocity += (vb - va);
+            }
+            manifoldRelativeVelocity = manifoldRelativeVelocity / static_cast<float>(manifold.contacts.size());
+
+            hasFriction[l] = BeginManifoldFriction(context, manifold, manifoldRelativeVelocity, friction[l]);
+            if (!hasFriction[l]) {
+                continue;
+            }
+            frictionLanes.t0.Set(l, manifold.t0);
+            frictionLanes.t1.Set(l, manifold.t1);
+            frictionLanes.mu[l] = friction[l].mu;
+            frictionLanes.budget[l] = friction[l].manifoldBudget;
+            frictionLanes.accumulatedTangent0[l] = friction[l].accumulatedTangent[0];
+            frictionLanes.accumulatedTangent1[l] = friction[l].accumulatedTangent[1];
+            frictionLanes.stickBlend[l] = friction[l].canUseStick && manifold.stickConstraintActive;
+            frictionLanes.useBudget[l] = friction[l].useManifoldBudget;
+            rowCount = std::max(rowCount, manifold.contacts.size());
+        }
+
+        const solver_internal::FrictionRowParams params{
+            context.config.enableTwoAxisFrictionSolve,
+            context.config.frictionBudgetUseRadialClamp,
+            std::clamp<Real>(context.config.stickImpulseRetention, 0.0, 1.0),
+        };
+        for (std::size_t ci = 0; ci < rowCount; ++ci) {
+            solver_internal::FrictionRowLanes rows{};
+            for (std::size_t l = 0; l < laneCount; ++l) {
+                if (!hasFriction[l] || ci >= lanes[l]->contacts.size()) {
+                    continue;
+                }
+                const Contact& c = lanes[l]->contacts[ci];
+                rows.point.Set(l, c.point);
+                rows.tangentImpulse0[l] = c.tangentImpulseSum0;
+                rows.tangentImpulse1[l] = c.tangentImpulseSum1;
+                rows.normalImpulseSum[l] = c.normalImpulseSum;
+                rows.active[l] = true;
+            }
+            solver_internal::SolveFrictionRows(bodies, rows, frictionLanes, params);
+            for (std::size_t l = 0; l < laneCount; ++l) {
+                if (!rows.solved[l]) {
+                    continue;
+                }
+                Contact& c = lanes[l]->contacts[ci];
+                c.tangentImpulseSum0 = rows.tangentImpulse0[l];
+                c.tangentImpulseSum1 = rows.tangentImpulse1[l];
+                c.tangentImpulseSum = c.tangentImpulseSum0;
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+                if (rows.budgetSaturated[l]) {
+                    context.hooks.RecordFrictionBudgetSaturation(context.config.frictionBudgetNormalSupportSource);
                 }
 #endif
             }
+        }
 
-            context.refreshManifoldBlockCache(m);
-            context.selectBlockSolvePair(m);
-            context.recordSelectedPairHistory(m);
+        for (std::size_t l = 0; l < laneCount; ++l) {
+            if (hasFriction[l]) {
+                FinishManifoldFriction(context,
+                                       *lanes[l],
+                                       friction[l],
+                                       {frictionLanes.accumulatedTangent0[l], frictionLanes.accumulatedTangent1[l]},
+                                       frictionLanes.slipSpeedSum[l],
+                                       static_cast<std::uint32_t>(frictionLanes.slipSamples[l]));
+            }
+            ScatterBodyLane(context, lanes[l]->a, l, bodies.velocityA, bodies.angularVelocityA, bodies.writableA);
+            ScatterBodyLane(context, lanes[l]->b, l, bodies.velocityB, bodies.angularVelocityB, bodies.writableB);
         }
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+        ++context.hooks.Telemetry().contactRowBatches4;
+        context.hooks.Telemetry().contactRowBatchLanes += laneCount;
+#endif
     }
 
-    void SolveContactsInManifold(const ContactSolverContext& context, Manifold& manifold) const {
+private:
+    /// Manifold constants of the friction pass, from `BeginManifoldFriction`.
+    struct FrictionSetup {
+        Real mu = 0.0;
+        Real manifoldBudget = 0.0;
+        bool useManifoldBudget = false;
+        bool canUseStick = false;
+        std::array<SolverReal, 2> accumulatedTangent{0.0, 0.0};
+    };
+
+    static void AssertBlockSelection(const Manifold& manifold) {
         if (manifold.contacts.size() >= 2) {
             const int selected0 = manifold.selectedBlockContactIndices[0];
             const int selected1 = manifold.selectedBlockContactIndices[1];
@@ -367,38 +650,33 @@ public:
             assert(blockSlotsPopulated);
             assert(blockKeysPopulated);
         }
+    }
 
-        context.solveManifoldNormalImpulses(manifold);
+    template <typename Hooks>
+    static void SyncBlockNormalImpulses(const ContactSolverContext<Hooks>& context, Manifold& manifold) {
         if (manifold.contacts.size() >= 2) {
             for (Contact& c : manifold.contacts) {
-                const int slot = context.findBlockSlot(manifold, c.key);
+                const int slot = context.hooks.FindBlockSlot(manifold, c.key);
                 if (slot >= 0) {
                     manifold.blockNormalImpulseSum[slot] = c.normalImpulseSum;
                 }
             }
         }
+    }
 
-        Vec3 manifoldRelativeVelocity = context.bodies[manifold.b].velocity - context.bodies[manifold.a].velocity;
-        if (!manifold.contacts.empty()) {
-            manifoldRelativeVelocity = {};
-            for (const Contact& c : manifold.contacts) {
-                const Body& a = context.bodies[c.a];
-                const Body& b = context.bodies[c.b];
-                const Vec3 ra = c.point - a.position;
-                const Vec3 rb = c.point - b.position;
-                const Vec3 va = a.velocity + Cross(a.angularVelocity, ra);
-                const Vec3 vb = b.velocity + Cross(b.angularVelocity, rb);
-                manifoldRelativeVelocity += (vb - va);
-            }
-            manifoldRelativeVelocity = manifoldRelativeVelocity / static_cast<float>(manifold.contacts.size());
-        }
-
+    /// Tangent frame, warm-start reprojection and friction budget of `manifold`. Returns false
+    /// (after clearing the tangent impulses) when no stable frame exists and friction is skipped.
+    template <typename Hooks>
+    static bool BeginManifoldFriction(const ContactSolverContext<Hooks>& context,
+                                      Manifold& manifold,
+                                      const Vec3& manifoldRelativeVelocity,
+                                      FrictionSetup& out) {
         Vec3 manifoldT0{};
         Vec3 manifoldT1{};
         const bool reuseBasisHint = manifold.tangentBasisValid;
         const Vec3 previousT0 = manifold.t0;
         const Vec3 previousT1 = manifold.t1;
-        const std::array<Real, 2> previousManifoldImpulse = manifold.manifoldTangentImpulseSum;
+        const std::array<SolverReal, 2> previousManifoldImpulse = manifold.manifoldTangentImpulseSum;
         const bool previousImpulseValid = manifold.manifoldTangentImpulseValid && manifold.tangentBasisValid;
         const Vec3* preferredTangent = manifold.tangentBasisValid ? &manifold.t0 : nullptr;
         const bool basisValid = World::ComputeStableTangentFrame(
@@ -406,9 +684,7 @@ public:
         manifold.t0 = manifoldT0;
         manifold.t1 = manifoldT1;
         manifold.tangentBasisValid = basisValid;
-        if (context.recordTangentBasisState) {
-            context.recordTangentBasisState(basisValid && reuseBasisHint);
-        }
+        context.hooks.RecordTangentBasisState(basisValid && reuseBasisHint);
         if (basisValid && previousImpulseValid) {
             const Vec3 worldImpulse = previousManifoldImpulse[0] * previousT0 + previousManifoldImpulse[1] * previousT1;
             manifold.manifoldTangentImpulseSum = {Dot(worldImpulse, manifold.t0), Dot(worldImpulse, manifold.t1)};
@@ -422,13 +698,13 @@ public:
                 c.tangentImpulseSum1 = 0.0;
                 c.tangentImpulseSum = 0.0;
             }
-            return;
+            return false;
         }
 
         const auto sumAllContactSupport = [&]() {
             Real total = 0.0;
             for (const Contact& c : manifold.contacts) {
-                total += std::max(c.normalImpulseSum, 0.0);
+                total += std::max<Real>(c.normalImpulseSum, 0.0);
             }
             return total;
         };
@@ -436,7 +712,7 @@ public:
             Real total = 0.0;
             for (int idx : manifold.selectedBlockContactIndices) {
                 if (idx >= 0 && static_cast<std::size_t>(idx) < manifold.contacts.size()) {
-                    total += std::max(manifold.contacts[static_cast<std::size_t>(idx)].normalImpulseSum, 0.0);
+                    total += std::max<Real>(manifold.contacts[static_cast<std::size_t>(idx)].normalImpulseSum, 0.0);
                 }
             }
             return total;
@@ -453,7 +729,7 @@ public:
                 totalNormalSupport = allContactSupport;
                 break;
             case FrictionBudgetNormalSupportSource::BlendedSelectedPairAndManifold: {
-                const Real selectedWeight = std::max(context.config.frictionBudgetSelectedPairBlendWeight, 0.0);
+                const Real selectedWeight = std::max<Real>(context.config.frictionBudgetSelectedPairBlendWeight, 0.0);
                 const Real manifoldWeight = 1.0;
                 const Real weightedSum = selectedWeight * selectedPairSupport + manifoldWeight * allContactSupport;
                 const Real denom = selectedWeight + manifoldWeight;
@@ -461,116 +737,34 @@ public:
                 break;
             }
         }
-        const Body& firstA = context.bodies[manifold.contacts.front().a];
-        const Body& firstB = context.bodies[manifold.contacts.front().b];
+        // Every contact joins the manifold's body pair and the friction mix is symmetric, so
+        // the pair's bodies stand in for the first contact's (the manifold may be empty here).
+        const Body& firstA = context.bodies[manifold.a];
+        const Body& firstB = context.bodies[manifold.b];
         const Real muS = 0.5 * (firstA.staticFriction + firstB.staticFriction);
         const Real muD = 0.5 * (firstA.dynamicFriction + firstB.dynamicFriction);
-        const Real mu = std::max(std::max(muS, muD), 0.0);
-        const Real manifoldBudget = std::max(0.0, context.config.manifoldFrictionBudgetScale) * mu * totalNormalSupport;
-        const bool useManifoldBudget = context.config.enableManifoldFrictionBudget && manifoldBudget > 0.0;
-        const bool canUseStick = context.config.enablePersistentStickConstraints
+        out.mu = std::max<Real>(std::max(muS, muD), 0.0);
+        out.manifoldBudget = std::max<Real>(0.0, context.config.manifoldFrictionBudgetScale) * out.mu * totalNormalSupport;
+        out.useManifoldBudget = context.config.enableManifoldFrictionBudget && out.manifoldBudget > 0.0;
+        out.canUseStick = context.config.enablePersistentStickConstraints
             && manifold.manifoldTangentImpulseValid
             && manifold.contacts.size() >= 2;
 
-        std::array<Real, 2> accumulatedTangent{0.0, 0.0};
+        out.accumulatedTangent = {0.0, 0.0};
         if (manifold.manifoldTangentImpulseValid) {
-            accumulatedTangent = manifold.manifoldTangentImpulseSum;
+            out.accumulatedTangent = manifold.manifoldTangentImpulseSum;
         }
-        Real meanSlipSpeed = 0.0;
-        std::uint32_t slipSamples = 0;
-
-        for (Contact& c : manifold.contacts) {
-            Body& a = context.bodies[c.a];
-            Body& b = context.bodies[c.b];
-
-            // Read from the world's per-body cache (refreshed once per substep) when available;
-            // fall back to recomputing only if the caller hasn't populated the cache.
-            const Mat3 invIA = (context.bodyInvInertiaWorld != nullptr)
-                ? (*context.bodyInvInertiaWorld)[c.a]
-                : a.InvInertiaWorld();
-            const Mat3 invIB = (context.bodyInvInertiaWorld != nullptr)
-                ? (*context.bodyInvInertiaWorld)[c.b]
-                : b.InvInertiaWorld();
-            const Vec3 ra = c.point - a.position;
-            const Vec3 rb = c.point - b.position;
-
-            const Vec3 va2 = a.velocity + Cross(a.angularVelocity, ra);
-            const Vec3 vb2 = b.velocity + Cross(b.angularVelocity, rb);
-            const Vec3 rv2 = vb2 - va2;
-            const Real slipSpeed = std::sqrt(
-                Dot(rv2, manifold.t0) * Dot(rv2, manifold.t0)
-                + Dot(rv2, manifold.t1) * Dot(rv2, manifold.t1));
-            meanSlipSpeed += slipSpeed;
-            ++slipSamples;
-            const Vec3 raCrossT0 = Cross(ra, manifold.t0);
-            const Vec3 rbCrossT0 = Cross(rb, manifold.t0);
-            const Vec3 raCrossT1 = Cross(ra, manifold.t1);
-            const Vec3 rbCrossT1 = Cross(rb, manifold.t1);
-            const Real tangentMass0 = a.invMass + b.invMass + Dot(raCrossT0, invIA * raCrossT0) + Dot(rbCrossT0, invIB * rbCrossT0);
-            const Real tangentMass1 = context.config.enableTwoAxisFrictionSolve
-                ? (a.invMass + b.invMass + Dot(raCrossT1, invIA * raCrossT1) + Dot(rbCrossT1, invIB * rbCrossT1))
-                : std::numeric_limits<float>::infinity();
-            if (tangentMass0 <= kEpsilon || tangentMass1 <= kEpsilon) {
-                continue;
-            }
-
-            const std::array<Real, 2> oldT{c.tangentImpulseSum0, c.tangentImpulseSum1};
-            std::array<Real, 2> newT{
-                c.tangentImpulseSum0 - Dot(rv2, manifold.t0) / tangentMass0,
-                c.tangentImpulseSum1 - Dot(rv2, manifold.t1) / tangentMass1};
-            if (!context.config.enableTwoAxisFrictionSolve) {
-                newT[1] = 0.0;
-            }
-            if (canUseStick && manifold.stickConstraintActive) {
-                const Real retention = std::clamp(context.config.stickImpulseRetention, 0.0, 1.0);
-                newT[0] = retention * oldT[0] + (1.0 - retention) * newT[0];
-                newT[1] = retention * oldT[1] + (1.0 - retention) * newT[1];
-            }
-
-            const Real perContactLimit = mu * std::max(c.normalImpulseSum, 0.0);
-            const Real contactLenSq = newT[0] * newT[0] + newT[1] * newT[1];
-            if (contactLenSq > perContactLimit * perContactLimit && perContactLimit > kEpsilon) {
-                const Real scale = perContactLimit / std::sqrt(contactLenSq);
-                newT[0] *= scale;
-                newT[1] *= scale;
-            } else if (perContactLimit <= kEpsilon) {
-                newT = {0.0, 0.0};
-            }
-
-            std::array<Real, 2> candidateAccumulated{
-                accumulatedTangent[0] - oldT[0] + newT[0],
-                accumulatedTangent[1] - oldT[1] + newT[1]};
-            if (useManifoldBudget) {
-                if (context.config.frictionBudgetUseRadialClamp) {
-                    const Real lenSq = candidateAccumulated[0] * candidateAccumulated[0]
-                        + candidateAccumulated[1] * candidateAccumulated[1];
-                    const Real maxLenSq = manifoldBudget * manifoldBudget;
-                    if (lenSq > maxLenSq && manifoldBudget > kEpsilon) {
-                        const Real scale = manifoldBudget / std::sqrt(lenSq);
-                        newT[0] = oldT[0] + (newT[0] - oldT[0]) * scale;
-                        newT[1] = oldT[1] + (newT[1] - oldT[1]) * scale;
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                        if (context.recordFrictionBudgetSaturation) {
-                            context.recordFrictionBudgetSaturation(context.config.frictionBudgetNormalSupportSource);
-                        }
-#endif
-                    }
-                } else {
-                    newT[0] = std::clamp(newT[0], -manifoldBudget, manifoldBudget);
-                    newT[1] = std::clamp(newT[1], -manifoldBudget, manifoldBudget);
-                }
-            }
+        return true;
+    }
 
-            c.tangentImpulseSum0 = newT[0];
-            c.tangentImpulseSum1 = newT[1];
-            c.tangentImpulseSum = c.tangentImpulseSum0;
-            const Real lambdaT0 = c.tangentImpulseSum0 - oldT[0];
-            const Real lambdaT1 = c.tangentImpulseSum1 - oldT[1];
-            const Vec3 tangentImpulse = lambdaT0 * manifold.t0 + lambdaT1 * manifold.t1;
-            context.applyImpulse(a, b, invIA, invIB, ra, rb, tangentImpulse);
-            accumulatedTangent[0] += lambdaT0;
-            accumulatedTangent[1] += lambdaT1;
-        }
+    /// Stores the manifold tangent impulse and updates the persistent stick state.
+    template <typename Hooks>
+    static void FinishManifoldFriction(const ContactSolverContext<Hooks>& context,
+                                       Manifold& manifold,
+                                       const FrictionSetup& friction,
+                                       const std::array<SolverReal, 2>& accumulatedTangent,
+                                       Real meanSlipSpeed,
+                                       std::uint32_t slipSamples) {
         manifold.manifoldTangentImpulseSum = accumulatedTangent;
         manifold.manifoldTangentImpulseValid = true;
         const Real averageSlip = (slipSamples > 0) ? (meanSlipSpeed / static_cast<float>(slipSamples)) : std::numeric_limits<float>::infinity();
@@ -578,7 +772,7 @@ public:
             manifold.contacts.begin(),
             manifold.contacts.end(),
             [&](const Contact& c) { return c.persistenceAge >= context.config.stickMinPersistenceAge; });
-        const bool shouldStick = canUseStick
+        const bool shouldStick = friction.canUseStick
             && stableAgedContacts
             && averageSlip <= context.config.stickVelocityThreshold;
         if (shouldStick) {
@@ -591,6 +785,41 @@ public:
             manifold.stickConstraintAge = 0;
         }
     }
+
+    template <typename Hooks>
+    static void GatherBodyLane(const ContactSolverContext<Hooks>& context,
+                               std::uint32_t id,
+                               std::size_t lane,
+                               solver_internal::Vec3Lanes& position,
+                               solver_internal::Vec3Lanes& velocity,
+                               solver_internal::Vec3Lanes& angularVelocity,
+                               solver_internal::RealLanes& invMass,
+                               solver_internal::Mat3Lanes& invInertia,
+                               solver_internal::MaskLanes& writable) {
+        const SolverBodyRef body = SolverBody(context, id);
+        position.Set(lane, body.position);
+        velocity.Set(lane, body.velocity);
+        angularVelocity.Set(lane, body.angularVelocity);
+        invMass[lane] = body.invMass;
+        invInertia.Set(lane, (context.bodyInvInertiaWorld != nullptr) ? (*context.bodyInvInertiaWorld)[id]
+                                                                      : body.body.InvInertiaWorld());
+        writable[lane] = !body.isSleeping && body.invMass != 0.0;
+    }
+
+    template <typename Hooks>
+    static void ScatterBodyLane(const ContactSolverContext<Hooks>& context,
+                                std::uint32_t id,
+                                std::size_t lane,
+                                const solver_internal::Vec3Lanes& velocity,
+                                const solver_internal::Vec3Lanes& angularVelocity,
+                                const solver_internal::MaskLanes& writable) {
+        if (!writable[lane]) {
+            return;
+        }
+        const SolverBodyRef body = SolverBody(context, id);
+        body.velocity = velocity.Get(lane);
+        body.angularVelocity = angularVelocity.Get(lane);
+    }
 };
 
 struct JointSolverContext {
@@ -621,6 +850,9 @@ struct JointSolverContext {
     /// Maximum error magnitude (meters) fed into the servo anchor position correction per pass.
     /// 0 = disabled. See JointSolverConfig::servoAnchorCorrectionMaxM.
     Real servoAnchorCorrectionMaxM = 0.0;
+    /// When non-null and `(*mask)[jointIndex] != 0`, skip every servo position row of that joint
+    /// (reduced-coordinate tree joints, whose links are posed by `World` instead).
+    const std::vector<std::uint8_t>* skipServoJointMask = nullptr;
 };
 
 inline Real WrapJointAngle(Real angle) {
@@ -671,7 +903,7 @@ inline Real ComputeServoJointAngle(const Body& a, const Body& b, const ServoJoin
 /// This keeps the correction directly focused on the axis mismatch instead of averaging it down
 /// through the high-fanout hub path.
 inline Vec3 ComputeServoAxisAlignmentCorrection(const ServoJoint& j, const Vec3& axisA, const Vec3& axisB) {
-    const Real stab = std::clamp(j.angleStabilizationScale, 0.0, 1.0);
+    const Real stab = std::clamp<Real>(j.angleStabilizationScale, 0.0, 1.0);
     if (stab <= 1e-7) {
         return {};
     }
@@ -906,10 +1138,15 @@ public:
                         && (*context.skipServoHingeSnapMask)[ji] != 0u) {
                         continue;
                     }
+                    if (context.skipServoJointMask != nullptr
+                        && ji < context.skipServoJointMask->size()
+                        && (*context.skipServoJointMask)[ji] != 0u) {
+                        continue;
+                    }
                     Body& a = context.bodies[j.a];
                     Body& b = context.bodies[j.b];
                     if (a.invMass + b.invMass <= kEpsilon) continue;
-                    const Real stab = std::clamp(j.angleStabilizationScale, 0.0, 1.0);
+                    const Real stab = std::clamp<Real>(j.angleStabilizationScale, 0.0, 1.0);
                     if (stab <= 1e-7) continue;
 
                     Vec3 axisA = Rotate(a.orientation, j.localAxisA);
@@ -928,11 +1165,11 @@ public:
                     const Vec3 refB = ResolveJointReference(b.orientation, j.localReferenceB, axisA);
                     const Real hingeAngle = SignedAngleAroundAxis(refA, refB, axisA);
                     const Real targetError = WrapJointAngle(hingeAngle - j.targetAngle);
-                    const Real maxServoSpeed = std::max(0.0, j.maxServoSpeed);
+                    const Real maxServoSpeed = std::max<Real>(0.0, j.maxServoSpeed);
                     const Real maxAngleCorrection = maxServoSpeed > 0.0
-                        ? std::min(0.06 * stab, maxServoSpeed * context.substepDt)
+                        ? std::min<Real>(0.06 * stab, maxServoSpeed * context.substepDt)
                         : 0.06 * stab;
-                    const Real clampedAngle = std::clamp(
+                    const Real clampedAngle = std::clamp<Real>(
                         0.15 * stab * targetError, -maxAngleCorrection, maxAngleCorrection);
                     if (std::abs(clampedAngle) > 1e-5) {
                         const Vec3 hc = clampedAngle * axisA;
@@ -956,11 +1193,16 @@ public:
 
             for (int pass = 0; pass < servoPositionPasses; ++pass) {
                 for (std::size_t ji = 0; ji < context.servoJoints.size(); ++ji) {
+                    if (context.skipServoJointMask != nullptr
+                        && ji < context.skipServoJointMask->size()
+                        && (*context.skipServoJointMask)[ji] != 0u) {
+                        continue;
+                    }
                     ServoJoint& j = context.servoJoints[ji];
                     Body& a = context.bodies[j.a];
                     Body& b = context.bodies[j.b];
                     if (a.invMass + b.invMass <= kEpsilon) continue;
-                    const Real stab = std::clamp(j.angleStabilizationScale, 0.0, 1.0);
+                    const Real stab = std::clamp<Real>(j.angleStabilizationScale, 0.0, 1.0);
 
                     const Vec3 ra = Rotate(a.orientation, j.localAnchorA);
                     const Vec3 rb = Rotate(b.orientation, j.localAnchorB);
@@ -1005,11 +1247,11 @@ public:
                     const Vec3 refB = ResolveJointReference(b.orientation, j.localReferenceB, axisA);
                     const Real hingeAngle = SignedAngleAroundAxis(refA, refB, axisA);
                     const Real targetError = WrapJointAngle(hingeAngle - j.targetAngle);
-                    const Real maxServoSpeed = std::max(0.0, j.maxServoSpeed);
+                    const Real maxServoSpeed = std::max<Real>(0.0, j.maxServoSpeed);
                     const Real maxAngleCorrection = maxServoSpeed > 0.0
-                        ? std::min(0.06 * stab, maxServoSpeed * context.substepDt / std::max(servoPositionPasses, 1))
+                        ? std::min<Real>(0.06 * stab, maxServoSpeed * context.substepDt / std::max(servoPositionPasses, 1))
                         : 0.06 * stab;
-                    const Real clampedAngleCorrection = std::clamp(
+                    const Real clampedAngleCorrection = std::clamp<Real>(
                         0.15 * stab * targetError, -maxAngleCorrection, maxAngleCorrection);
                     if (std::abs(clampedAngleCorrection) > 1e-5) {
                         ApplyAngularPositionCorrection(a, b, clampedAngleCorrection * axisA);
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace minphys3d {
+
+/// Height grid shared between a terrain producer (the demo `TerrainPatch`) and `World`. The
+/// producer writes cells in place and reports each changed rectangle through `MarkDirty`; only the
+/// `kTileCells`-square tiles that rectangle overlaps take the new revision. `World` reads the
+/// buffer directly, so re-attaching after an update copies nothing, and terrain contacts on
+/// untouched tiles keep their feature ids (and warm-start impulses) across updates.
+///
+/// The buffer must not be written while `World::Step` runs.
+class TerrainHeightfieldBuffer {
+public:
+    static constexpr int kTileCells = 16;
+
+    /// Sizes the grid to `rows` x `cols` filled with `height` and marks every tile dirty. The
+    /// collision layer is left empty (reads fall back to the surface layer). Only reallocates
+    /// when the cell count grows past the current capacity.
+    void Reset(int rows, int cols, float height) {
+        rows_ = std::max(rows, 0);
+        cols_ = std::max(cols, 0);
+        surfaceHeightsM_.assign(CellCount(), height);
+        collisionHeightsM_.clear();
+        tileRows_ = (rows_ + kTileCells - 1) / kTileCells;
+        tileCols_ = (cols_ + kTileCells - 1) / kTileCells;
+        tileRevisions_.assign(static_cast<std::size_t>(tileRows_ * tileCols_), 0u);
+        MarkAllDirty();
+    }
+
+    int Rows() const { return rows_; }
+    int Cols() const { return cols_; }
+    std::size_t CellCount() const { return static_cast<std::size_t>(rows_ * cols_); }
+
+    std::vector<float>& SurfaceHeights() { return surfaceHeightsM_; }
+    const std::vector<float>& SurfaceHeights() const { return surfaceHeightsM_; }
+    /// Optional conservative layer with the surface layout; empty when unused.
+    std::vector<float>& RawCollisionHeights() { return collisionHeightsM_; }
+    const std::vector<float>& RawCollisionHeights() const { return collisionHeightsM_; }
+    /// Layer contact generation samples: the collision layer when present, else the surface.
+    const std::vector<float>& CollisionHeights() const {
+        return collisionHeightsM_.empty() ? surfaceHeightsM_ : collisionHeightsM_;
+    }
+
+    /// Bumps the global revision and stamps it on every tile overlapping the inclusive cell
+    /// rectangle [row0, row1] x [col0, col1]. Empty or out-of-grid rectangles are ignored.
+    void MarkDirty(int row0, int row1, int col0, int col1) {
+        row0 = std::max(row0, 0);
+        col0 = std::max(col0, 0);
+        row1 = std::min(row1, rows_ - 1);
+        col1 = std::min(col1, cols_ - 1);
+        if (row0 > row1 || col0 > col1) {
+            return;
+        }
+        ++revision_;
+        for (int tr = row0 / kTileCells; tr <= row1 / kTileCells; ++tr) {
+            for (int tc = col0 / kTileCells; tc <= col1 / kTileCells; ++tc) {
+                tileRevisions_[static_cast<std::size_t>(tr * tileCols_ + tc)] = revision_;
+            }
+        }
+    }
+
+    void MarkAllDirty() { MarkDirty(0, rows_ - 1, 0, cols_ - 1); }
+
+    std::uint64_t Revision() const { return revision_; }
+
+    /// Revision of the tile holding cell (row, col).
+    std::uint64_t TileRevision(int row, int col) const {
+        return tileRevisions_[static_cast<std::size_t>((row / kTileCells) * tileCols_ + col / kTileCells)];
+    }
+
+    /// Number of cells in tiles stamped after `revision`.
+    std::uint64_t DirtyCellsSince(std::uint64_t revision) const {
+        std::uint64_t cells = 0;
+        for (int tr = 0; tr < tileRows_; ++tr) {
+            const int tileHeight = std::min(kTileCells, rows_ - tr * kTileCells);
+            for (int tc = 0; tc < tileCols_; ++tc) {
+                if (tileRevisions_[static_cast<std::size_t>(tr * tileCols_ + tc)] <= revision) {
+                    continue;
+                }
+                const int tileWidth = std::min(kTileCells, cols_ - tc * kTileCells);
+                cells += static_cast<std::uint64_t>(tileHeight * tileWidth);
+            }
+        }
+        return cells;
+    }
+
+    /// Visits every field with a snapshot archive (`snapshot_archive.hpp`).
+    template <typename Archive>
+    void Transfer(Archive& archive) {
+        archive.Pod(rows_);
+        archive.Pod(cols_);
+        archive.Pod(tileRows_);
+        archive.Pod(tileCols_);
+        archive.Pod(revision_);
+        archive.PodVector(surfaceHeightsM_);
+        archive.PodVector(collisionHeightsM_);
+        archive.PodVector(tileRevisions_);
+    }
+
+private:
+    int rows_ = 0;
+    int cols_ = 0;
+    int tileRows_ = 0;
+    int tileCols_ = 0;
+    std::uint64_t revision_ = 0;
+    std::vector<float> surfaceHeightsM_{};
+    std::vector<float> collisionHeightsM_{};
+    std::vector<std::uint64_t> tileRevisions_{};
+};
+
+} // namespace minphys3d
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace minphys3d::core_internal {
+
+/// Small fixed-size fork/join pool for solver passes. The calling thread always participates,
+/// so a pool of `threadCount` runs `threadCount - 1` background workers. Task indices are
+/// claimed dynamically; callers that need deterministic results must make each task write
+/// only task-owned state (the assignment of tasks to threads is not stable).
+class WorkerPool {
+public:
+    explicit WorkerPool(std::size_t threadCount);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    WorkerPool(WorkerPool&&) = delete;
+    WorkerPool& operator=(WorkerPool&&) = delete;
+
+    [[nodiscard]] std::size_t ThreadCount() const;
+
+    /// Runs `task(i)` for every `i` in `[0, taskCount)` and blocks until all have finished.
+    /// Concurrent `ParallelFor` calls from different threads are serialised.
+    void ParallelFor(std::size_t taskCount, const std::function<void(std::size_t)>& task);
+
+private:
+    struct State;
+    std::unique_ptr<State> state_;
+};
+
+/// Lazily created pool owned by a copyable aggregate (e.g. `World`). Copies start without a pool
+/// so two copies never share worker threads; the pool is (re)built on the next `Acquire`.
+class WorkerPoolHandle {
+public:
+    WorkerPoolHandle();
+    ~WorkerPoolHandle();
+    WorkerPoolHandle(const WorkerPoolHandle&);
+    WorkerPoolHandle& operator=(const WorkerPoolHandle&);
+    WorkerPoolHandle(WorkerPoolHandle&&) noexcept;
+    WorkerPoolHandle& operator=(WorkerPoolHandle&&) noexcept;
+
+    /// Returns a pool with exactly `threadCount` participants, or nullptr when `threadCount <= 1`.
+    WorkerPool* Acquire(std::size_t threadCount);
+    void Reset();
+
+private:
+    std::unique_ptr<WorkerPool> pool_;
+};
+
+} // namespace minphys3d::core_internal
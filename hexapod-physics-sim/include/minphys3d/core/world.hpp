@@ -6,6 +6,7 @@
 #include <cmath>
 #include <cstdint>
 #include <limits>
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -25,30 +26,75 @@
 
 #include "minphys3d/articulation/types.hpp"
 #include "minphys3d/broadphase/types.hpp"
+#include "minphys3d/collision/ray_packet.hpp"
 #include "minphys3d/core/body.hpp"
+#include "minphys3d/core/manifold_build_scratch.hpp"
+#include "minphys3d/core/manifold_store.hpp"
+#include "minphys3d/core/persistent_point_table.hpp"
+#include "minphys3d/core/solver_body_store.hpp"
+#include "minphys3d/core/solver_convergence.hpp"
+#include "minphys3d/core/substep_contact_reuse.hpp"
+#include "minphys3d/core/terrain_heightfield.hpp"
+#include "minphys3d/core/worker_pool.hpp"
 #include "minphys3d/core/world_resource_monitoring.hpp"
 #include "minphys3d/core/world_types.hpp"
 #include "minphys3d/joints/types.hpp"
 #include "minphys3d/narrowphase/epa.hpp"
 #include "minphys3d/narrowphase/gjk.hpp"
 #include "minphys3d/narrowphase/dispatch.hpp"
+#include "minphys3d/solver/contact_rows_wide.hpp"
 #include "minphys3d/solver/types.hpp"
 
 namespace minphys3d {
 
+namespace core_internal {
+template <typename Hooks>
+struct ConstraintSolverContext;
+} // namespace core_internal
+
 enum class ResourceMonitoringMode : std::uint8_t {
     Full,
     TopLevel,
     Off,
 };
 
-/// Expanded collision shapes for a body (primitive or compound children), used by contact generation.
-struct ResolvedCollisionShape {
-    Body body{};
+/// World-space view of one collision primitive: a primitive body, or one compound child placed by
+/// its parent's pose. Plain data, rebuilt each contact build into `World`'s shape pool.
+struct CollisionShapeView {
+    ShapeType shape = ShapeType::Sphere;
+    Vec3 position{};
+    /// Support origin: `position`, except for half-cylinders (see `BodyWorldShapeOrigin`).
+    Vec3 shapeOrigin{};
+    Quat orientation{};
+    Real radius = 0.5;
+    Real halfHeight = 0.5;
+    Vec3 halfExtents{0.5, 0.5, 0.5};
+    Vec3 planeNormal{0.0, 1.0, 0.0};
+    Real planeOffset = 0.0;
     AABB bounds{};
     std::uint32_t encodedFeature = 0;
 };
 
+/// Node of a compound's local BVH over its shape views. Leaves (`count > 0`) cover `count` entries
+/// of the body's BVH item list from `first`; inner nodes keep their left child next in the pool
+/// and their right child at `first` (relative to the body's first node).
+struct CollisionShapeBvhNode {
+    AABB bounds{};
+    std::uint32_t first = 0;
+    std::uint32_t count = 0;
+};
+
+/// A body's slice of the shape pool (and, for large compounds, of the BVH node pool).
+struct ResolvedCollisionShapes {
+    std::uint32_t firstShape = 0;
+    std::uint32_t shapeCount = 0;
+    std::uint32_t firstNode = 0;
+    /// 0 when the body has too few shapes for a BVH; queries then scan the slice.
+    std::uint32_t nodeCount = 0;
+    /// Union of the shape bounds.
+    AABB bounds{};
+};
+
 struct TerrainContactCandidate {
     std::uint32_t row = 0;
     std::uint32_t col = 0;
@@ -78,6 +124,9 @@ public:
         bool useConservativeCollision = false;
         std::vector<float> surfaceHeightsM{};
         std::vector<float> collisionHeightsM{};
+        /// When set, heights are read in place from this buffer and the two vectors above stay
+        /// empty; `revision` then follows the buffer and terrain contact ids use its tile revisions.
+        std::shared_ptr<const TerrainHeightfieldBuffer> sharedHeights{};
     };
 
     explicit World(Vec3 gravity = {0.0, -9.81, 0.0});
@@ -142,14 +191,53 @@ public:
         /// When true (default), generalized force `u` includes the PD channel `D * servoBias`.
         /// When false, `u` uses only `s^T P_a` plus `ServoJoint::articulationDriveTorque`.
         bool includeServoPdBiasInArticulationU = true;
+        /// Reduced-coordinate mode for the servo trees found by `BuildArticulationChains`: chains
+        /// sharing a root body are merged into one tree, and every impulse on a tree body is
+        /// propagated through the exact articulated-body inertia (Featherstone ABA, impulse form)
+        /// instead of being held together by maximal-coordinate joint rows. Anchor and axis rows
+        /// of tree joints are dropped, servo hinge rows and contacts on tree bodies use the
+        /// articulated effective mass, and link poses are rebuilt from the joint angles at the
+        /// end of every substep, so joint gaps stay at zero whatever the iteration count.
+        /// Replaces the ABI pre-correction and chain position passes above for those chains.
+        /// Default off.
+        bool enableReducedCoordinateTrees = false;
     };
     void SetArticulationConfig(const ArticulationConfig& config);
     ArticulationConfig GetArticulationConfig() const;
 
+    /// Opt-in multi-threaded constraint solve. Islands never share a dynamic body, so solving
+    /// them on different threads is bit-identical to the serial path; only wall time changes.
+    struct ParallelSolveConfig {
+        /// Solver threads including the thread calling `Step` (the World owns a pool of
+        /// `threadCount - 1` workers). 0 or 1 keeps the serial path.
+        std::uint32_t threadCount = 0;
+        /// Islands are dispatched to the pool only when at least two exist and their summed
+        /// `EstimateIslandSolveCost` reaches this value; small scenes stay on the calling thread.
+        std::uint64_t minParallelIslandCost = 48;
+        /// The primitive narrowphase is split across the pool only from this many broadphase
+        /// pairs. Each task fills its own contact / seed buffers, merged in pair order, so the
+        /// result is bit-identical to the serial pass.
+        std::uint32_t minParallelNarrowphasePairs = 256;
+    };
+    void SetParallelSolveConfig(const ParallelSolveConfig& config);
+    const ParallelSolveConfig& GetParallelSolveConfig() const;
+
+    /// Storage used for body state during the PGS velocity iterations.
+    struct SolverBodyConfig {
+        /// When true, pose / velocity / inverse mass are mirrored into a structure-of-arrays
+        /// store for the iteration loop and velocities are written back to `Body` afterwards.
+        /// The arithmetic is identical either way; false solves directly on `Body` (A/B baseline).
+        bool useSoAMirror = true;
+    };
+    void SetSolverBodyConfig(const SolverBodyConfig& config);
+    const SolverBodyConfig& GetSolverBodyConfig() const;
+
     const ContactSolverConfig& GetContactSolverConfig() const;
     const JointSolverConfig& GetJointSolverConfig() const;
     const BroadphaseConfig& GetBroadphaseConfig() const;
     const BroadphaseMetrics& GetBroadphaseMetrics() const;
+    /// Attaches (or refreshes) the terrain heightfield. With `terrain.sharedHeights` set this is
+    /// O(tiles): nothing is copied and only tiles stamped since the last call count as dirty.
     void SetTerrainHeightfield(TerrainHeightfieldAttachment terrain);
     void ClearTerrainHeightfield();
     bool HasTerrainHeightfield() const;
@@ -161,6 +249,50 @@ public:
         Real churnRatio = 0.0;
     };
     const PersistenceMatchDiagnostics& GetPersistenceMatchDiagnostics() const;
+    /// Heap allocations per `Step` (see `world_resource_monitoring::HeapAllocationStats`).
+    const world_resource_monitoring::HeapAllocationStats& GetHeapAllocationStats() const;
+
+    /// PGS velocity passes actually run by the last `Step` (`ContactSolverConfig::convergence`).
+    /// With the monitor off every substep runs the requested count and nothing converges early.
+    struct SolverIterationStats {
+        std::uint32_t lastStepSubsteps = 0;
+        /// Passes summed over the substeps of the last step (relaxation passes not included).
+        std::uint32_t lastStepIterations = 0;
+        std::uint32_t lastStepMaxSubstepIterations = 0;
+        /// Island passes actually solved vs. islands x iteration cap, summed over substeps.
+        std::uint64_t lastStepIslandIterations = 0;
+        std::uint64_t lastStepIslandIterationCap = 0;
+        /// Islands retired below the tolerances before the cap, summed over substeps.
+        std::uint32_t lastStepIslandsConverged = 0;
+        /// Largest impulse change in the final pass of an island allowed to retire, and largest
+        /// joint position error (monitor on only).
+        Real lastStepMaxLinearImpulseDelta = 0.0;
+        Real lastStepMaxAngularImpulseDelta = 0.0;
+        Real lastStepMaxJointPositionError = 0.0;
+        std::uint64_t totalSteps = 0;
+        std::uint64_t totalIterations = 0;
+    };
+    const SolverIterationStats& GetSolverIterationStats() const;
+
+    /// Substeps that ran the narrowphase vs. solved on the previous substep's manifolds
+    /// (`ContactSolverConfig::substepContactReuse`). With reuse off every substep is a build.
+    struct ContactReuseStats {
+        std::uint32_t lastStepContactBuilds = 0;
+        std::uint32_t lastStepContactReuses = 0;
+        std::uint64_t totalContactBuilds = 0;
+        std::uint64_t totalContactReuses = 0;
+    };
+    const ContactReuseStats& GetContactReuseStats() const;
+
+    /// Primitive pairs the last contact build ran through the narrowphase and the number of tasks
+    /// they were split into (1 on the serial path; see `ParallelSolveConfig`), plus the compound
+    /// child shape pairs whose bounds overlapped and went to an exact test.
+    struct NarrowphaseStats {
+        std::uint32_t lastPrimitivePairs = 0;
+        std::uint32_t lastTasks = 0;
+        std::uint32_t lastCompoundShapePairs = 0;
+    };
+    const NarrowphaseStats& GetNarrowphaseStats() const;
 
     struct TopologySnapshot {
         std::uint32_t bodyCount = 0;
@@ -173,8 +305,34 @@ public:
         std::uint32_t maxIslandManifoldCount = 0;
         std::uint32_t maxIslandJointCount = 0;
         std::uint32_t maxIslandServoCount = 0;
+        /// Sum / max of `EstimateIslandSolveCost` over islands (PGS row-count proxy used to
+        /// balance islands across solver threads).
+        std::uint64_t totalIslandSolveCost = 0;
+        std::uint64_t maxIslandSolveCost = 0;
+        /// Largest colour count over islands for graph-coloured contact / joint (hinge + servo)
+        /// rows; 0 when graph colouring is off (see `GraphColoringConfig`).
+        std::uint32_t maxIslandContactColorCount = 0;
+        std::uint32_t maxIslandJointColorCount = 0;
     };
     [[nodiscard]] TopologySnapshot SnapshotTopology() const;
+
+    /// Binary checkpoint of the simulation state: bodies, joints (servo integrators and
+    /// warm-start impulses included), contacts and manifolds, the persistent contact point
+    /// tables, the broadphase tree and pair cache, narrowphase caches, the terrain attachment and
+    /// the solver configs. Stepping a world restored from it reproduces the captured world bit for
+    /// bit. Execution settings (`ParallelSolveConfig`, resource monitoring, debug logging) are not
+    /// captured and stay as configured on the restoring world. The blob is only readable by a
+    /// build with the same layout; it is not a portable file format.
+    [[nodiscard]] std::vector<std::uint8_t> CaptureSnapshot() const;
+    /// Replaces the simulation state with a blob from `CaptureSnapshot`. Returns false and leaves
+    /// the world untouched when the blob is truncated, fails its checksum, or was written by a
+    /// build with a different layout. Reuses existing buffer capacity, so repeated restores into
+    /// the same world (e.g. rollouts branching from one checkpoint) settle to no allocations.
+    bool RestoreSnapshot(const std::uint8_t* data, std::size_t size);
+    bool RestoreSnapshot(const std::vector<std::uint8_t>& snapshot) {
+        return RestoreSnapshot(snapshot.data(), snapshot.size());
+    }
+
     void SetNarrowphaseDispatchPolicy(NarrowphaseDispatchPolicy policy);
     NarrowphaseDispatchPolicy GetNarrowphaseDispatchPolicy() const;
     static bool ComputeStableTangentFrame(
@@ -272,6 +430,9 @@ public:
         std::uint64_t anchorReuseFallbackCount = 0;
         std::uint64_t supportDepthOrderApplied = 0;
         std::uint64_t supportDepthOrderBypassed = 0;
+        /// `ContactRowKernel::Wide4` batches and the manifolds solved through them.
+        std::uint64_t contactRowBatches4 = 0;
+        std::uint64_t contactRowBatchLanes = 0;
         std::uint64_t jointBlockSolveUsed = 0;
         std::uint64_t jointBlockFallbackDegenerate = 0;
         std::uint64_t jointBlockFallbackConditionEstimate = 0;
@@ -331,9 +492,9 @@ public:
         }
         constexpr Real kTinyDir = 1.0e-30;
         const Vec3 invDir{
-            (std::abs(dir.x) > kTinyDir) ? 1.0 / dir.x : std::copysign(1.0e30, dir.x),
-            (std::abs(dir.y) > kTinyDir) ? 1.0 / dir.y : std::copysign(1.0e30, dir.y),
-            (std::abs(dir.z) > kTinyDir) ? 1.0 / dir.z : std::copysign(1.0e30, dir.z),
+            (std::abs(dir.x) > kTinyDir) ? Real(1) / dir.x : std::copysign(Real(1.0e30), dir.x),
+            (std::abs(dir.y) > kTinyDir) ? Real(1) / dir.y : std::copysign(Real(1.0e30), dir.y),
+            (std::abs(dir.z) > kTinyDir) ? Real(1) / dir.z : std::copysign(Real(1.0e30), dir.z),
         };
 
         auto rayHitsBox = [&](const AABB& box) -> bool {
@@ -349,7 +510,7 @@ public:
             const Real tz2 = (box.max.z - origin.z) * invDir.z;
             tmin = std::max(tmin, std::min(tz1, tz2));
             tmax = std::min(tmax, std::max(tz1, tz2));
-            return tmax >= std::max(tmin, 0.0) && tmin <= maxT;
+            return tmax >= std::max<Real>(tmin, 0.0) && tmin <= maxT;
         };
 
         // Scenes have <128 bodies; stack of 128 is more than enough for any tree depth.
@@ -375,6 +536,46 @@ public:
         }
     }
 
+    /// Packet form of QueryRayCandidates: one BVH walk for every ray of `packet`. Each node is
+    /// slab-tested against all lanes at once and a child only keeps the lanes that entered its
+    /// parent; `cb(bodyId, lanes)` receives the lanes whose ray reaches that leaf's fat-AABB.
+    /// `cb` may lower `packet.tMax[lane]` (e.g. to the closest hit so far) to prune the rest of
+    /// the walk for that lane.
+    template <typename Callback>
+    void QueryRayPacketCandidates(RayPacket& packet, Callback&& cb) const {
+        if (rootNode_ < 0 || treeNodes_.empty() || packet.count == 0) {
+            return;
+        }
+
+        constexpr int kStackCapacity = 128;
+        std::int32_t stack[kStackCapacity];
+        RayPacketMask stackLanes[kStackCapacity];
+        int sp = 0;
+        stack[sp] = rootNode_;
+        stackLanes[sp++] = packet.ActiveMask();
+        while (sp > 0) {
+            --sp;
+            const std::int32_t nodeId = stack[sp];
+            const RayPacketMask parentLanes = stackLanes[sp];
+            if (nodeId < 0) {
+                continue;
+            }
+            const TreeNode& node = treeNodes_[static_cast<std::size_t>(nodeId)];
+            const RayPacketMask lanes = RayPacketHitsBox(packet, node.box) & parentLanes;
+            if (lanes == 0) {
+                continue;
+            }
+            if (node.IsLeaf()) {
+                cb(static_cast<std::uint32_t>(node.bodyId), lanes);
+            } else if (sp + 2 <= kStackCapacity) {
+                stack[sp] = node.left;
+                stackLanes[sp++] = lanes;
+                stack[sp] = node.right;
+                stackLanes[sp++] = lanes;
+            }
+        }
+    }
+
     const ServoJoint& GetServoJoint(std::uint32_t id) const;
     ServoJoint& GetServoJointMutable(std::uint32_t id);
 
@@ -385,6 +586,8 @@ public:
     // Read-only access to articulation chains detected by BuildArticulationChains().
     // Updated each substep (after BuildIslands()); empty before the first Step().
     const std::vector<ArtChain>& GetArticulationChains() const { return articulationChains_; }
+    // Reduced-coordinate trees (`ArticulationConfig::enableReducedCoordinateTrees`); empty otherwise.
+    const std::vector<ReducedArtTree>& GetReducedArticulationTrees() const { return reducedArtTrees_; }
 
     std::uint32_t CreateDistanceJoint(std::uint32_t a, std::uint32_t b, const Vec3& worldAnchorA, const Vec3& worldAnchorB, Real stiffness = 1.0, Real damping = 0.1);
 
@@ -486,6 +689,11 @@ private:
     static std::uint64_t ComputeShapeGeometrySignature(const Body& body);
     void RefreshShapeRevisionCounters();
     bool ConvexOverlapWithCache(std::uint32_t a, std::uint32_t b);
+    /// Primitive-pair narrowphase over `pairs`, on the solver pool when it is large enough.
+    void RunNarrowphase(const std::vector<Pair>& pairs);
+    /// Inserts the warm-start cache entry of every convex pair, in pair order, so parallel tasks
+    /// only look entries up. False when the inserts could overflow the cache (serial pass then).
+    bool PrepareParallelNarrowphaseCache(const std::vector<Pair>& pairs);
     void EmitConvexManifoldSeeds();
     static bool IsZeroInertia(const Mat3& m);
     static bool TryGetPlaneNormal(const Body& plane, Vec3& outNormal);
@@ -598,6 +806,8 @@ private:
         Real penetration,
         std::uint8_t manifoldType = 0,
         std::uint64_t canonicalFeatureId = 0);
+    /// Appends a contact built by `AddContact` and applies its wake rule.
+    void CommitContact(const Contact& c);
 
     static int FindBlockSlot(const Manifold& manifold, std::uint64_t contactKey);
 
@@ -620,7 +830,7 @@ private:
 
     static bool ContactComesBefore(const Contact& lhs, const Contact& rhs);
 
-    static void SortManifoldContacts(std::vector<Contact>& contacts);
+    static void SortManifoldContacts(ManifoldContacts& contacts);
 
     struct ManifoldQualityScore {
         Real penetration = 0.0;
@@ -631,7 +841,7 @@ private:
 
     static ManifoldQualityScore ComputeManifoldQualityScore(const Manifold& manifold);
 
-    static void ReduceManifoldToMaxPoints(Manifold& manifold, std::size_t maxPoints = 4);
+    static void ReduceManifoldToMaxPoints(Manifold& manifold, std::size_t maxPoints = kMaxManifoldContacts);
 
     class ManifoldManager {
     public:
@@ -647,34 +857,34 @@ private:
     void ManageManifoldContacts(Manifold& manifold, const Manifold* previous);
 
     void BuildManifolds();
+    /// Substep contact reuse: whether every body is still within `maxBodyMotion` of its pose at
+    /// the last build, re-projecting the kept contacts, and recording the poses after a build.
+    bool CanReuseSubstepContacts() const;
+    void ReprojectReusedContacts();
+    void CaptureSubstepContactReuseReference();
+    std::uint64_t TotalJointCount() const;
 
-    struct PersistentPointImpulseState {
-        Real normalImpulseSum = 0.0;
-        Real tangentImpulseSum0 = 0.0;
-        Real tangentImpulseSum1 = 0.0;
-        std::uint16_t persistenceAge = 0;
-        bool anchorsValid = false;
-        Vec3 localAnchorA{0.0, 0.0, 0.0};
-        Vec3 localAnchorB{0.0, 0.0, 0.0};
-        Vec3 worldPoint{0.0, 0.0, 0.0};
-    };
+    using PersistentPointImpulseState = core_internal::PersistentPointImpulseState;
 
     struct PersistentPointMatchCandidate {
         PersistentPointKey key{};
         PersistentPointImpulseState state{};
         Real localAnchorDriftSq = 0.0;
         Real worldAnchorDriftSq = 0.0;
+        /// Slot of the matched point in the table it came from (for `PersistentPointTable::Claim`).
+        std::uint32_t slot = 0;
     };
 
     static bool PersistentPointCandidateLess(
         const PersistentPointMatchCandidate& lhs,
         const PersistentPointMatchCandidate& rhs);
 
+    /// Best unclaimed point in `range` of `previousState` for `contact` (same feature, anchors within
+    /// the drift thresholds). Scans only that manifold's slots; no hashing, no allocation.
     static bool TryMatchPersistentPoint(
-        const std::unordered_map<PersistentPointKey, PersistentPointImpulseState, PersistentPointKeyHash>& previousState,
-        const ManifoldKey& manifoldId,
+        const core_internal::PersistentPointTable& previousState,
+        core_internal::PersistentPointTable::Range range,
         const Contact& contact,
-        const std::unordered_set<PersistentPointKey, PersistentPointKeyHash>& usedKeys,
         PersistentPointMatchCandidate& outCandidate);
 
     void CapturePersistentPointImpulseState(const std::vector<Manifold>& manifolds);
@@ -693,12 +903,41 @@ private:
     // Called after PrepareServoJointSolves() each substep (Phase 1b+).
     void PrepareArticulatedInertias();
 
-    std::vector<Pair> ComputePotentialPairs() const;
+    // Reduced-coordinate trees (`ArticulationConfig::enableReducedCoordinateTrees`), defined in
+    // world_reduced_articulation.cpp. `BuildReducedArticulationTrees` merges the chains sharing a
+    // root into `reducedArtTrees_` right after BuildArticulationChains(); the prepare pass takes
+    // the place of PrepareArticulatedInertias(): it factors the articulated inertias, projects
+    // body velocities onto the tree DOFs and rescales the servo hinge rows to the articulated
+    // mass. From then until the end of the velocity iterations `ApplyImpulse` /
+    // `ApplyAngularImpulse` route tree bodies through `ApplyReducedTreeImpulse`.
+    void BuildReducedArticulationTrees();
+    void PrepareReducedArticulationTrees();
+    bool IsReducedTreeBody(std::uint32_t bodyId) const;
+    // Returns false when neither body is on an active tree (caller applies the rigid update).
+    bool ApplyReducedTreeImpulse(const core_internal::SolverBodyRef& a,
+                                 const core_internal::SolverBodyRef& b,
+                                 const Mat3& invIA,
+                                 const Mat3& invIB,
+                                 const Vec3& ra,
+                                 const Vec3& rb,
+                                 const Vec3& impulse,
+                                 const Vec3& angularImpulse);
+    // Δ(vb − va) at `point` per unit impulse (+b, −a); false when neither body is on a tree.
+    bool ComputeReducedContactCompliance(const Contact& c, Mat3& compliance);
+    // Friction-row override of the rigid tangent masses (`SolverHooks`).
+    void ApplyReducedTangentMasses(const Manifold& manifold, const Contact& c, Real& mass0, Real& mass1) const;
+    // Rebuilds link poses from the joint angles (root pose kept); end of every substep.
+    void ProjectReducedArticulationPoses();
+
+    /// Sorted by (a, b); the reference stays valid until the next call.
+    const std::vector<Pair>& ComputePotentialPairs() const;
+    /// Tree traversal merged with the still-valid cached pairs; appends sorted pairs.
+    void CollectDynamicTreePairs(std::vector<Pair>& out) const;
+    /// Appends every eligible pair, unsorted (`BroadphaseBackend::SweepAndPrune`).
+    void CollectSweepAndPrunePairs(std::vector<Pair>& out) const;
 
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
     std::vector<Pair> ComputePotentialPairsBruteForce() const;
-
-    static std::unordered_set<std::uint64_t> PairSetFromPairs(const std::vector<Pair>& pairs);
 #endif
 
     void GenerateContacts();
@@ -783,6 +1022,10 @@ private:
         Vec3 rbCrossN{};            // Cross(rb, c.normal)
         Real normalMass = 0.0;    // invMassSum + raCrossN·invIA·raCrossN + rbCrossN·invIB·rbCrossN
         Real invNormalMass = 0.0; // 1 / normalMass (zero when normalMass <= kEpsilon)
+        // Point compliance (Δ relative velocity per unit impulse) through a reduced-coordinate
+        // tree; set when either body is on an active tree and then also drives friction rows.
+        Mat3 reducedCompliance{};
+        bool hasReducedCompliance = false;
     };
 
     struct ManifoldPrep {
@@ -795,6 +1038,28 @@ private:
 
     void SolveNormalScalar(Contact& c, const ContactPrep& prep);
 
+    // Velocity-independent half of a normal row: normal mass, penetration bias, soft-contact
+    // constants and the split-impulse side effect. Shared by `SolveNormalScalar` and the Wide4
+    // lanes; returns false when the row is skipped (degenerate normal mass).
+    struct NormalRowSetup {
+        Real normalMass = 0.0;
+        Real restitution = 0.0;
+        Real biasTerm = 0.0;
+        Real maxSafeSeparatingSpeed = 0.0;
+        Real softBias = 0.0;
+        Real softenedMass = 0.0;
+        bool biasGated = false;
+        bool softEligible = false;
+    };
+
+    bool PrepareNormalRow(const Contact& c,
+                          const ContactPrep& prep,
+                          const Body& bodyA,
+                          const Body& bodyB,
+                          Real invMassA,
+                          Real invMassB,
+                          NormalRowSetup& out);
+
     enum class BlockSolveFallbackReason {
         None,
         Ineligible,
@@ -856,8 +1121,43 @@ private:
     bool SolveNormalBlock2(Manifold& manifold, BlockSolveFallbackReason& fallbackReason, Real& determinantOrConditionEstimate);
     bool SolveNormalProjected4(Manifold& manifold, BlockSolveFallbackReason& fallbackReason, Real& conditionEstimate);
 
+    // Normal-row routing of one manifold. `BeginManifoldNormalSolve` runs the Block2 / face-4
+    // solve when the manifold qualifies and reports which contacts still need scalar rows;
+    // `FinishManifoldNormalSolve` records the post-solve telemetry. Between the two the rows run
+    // either one at a time (`SolveManifoldNormalImpulses`) or lane-packed (`SolveNormalRows4`).
+    struct ManifoldNormalRoute {
+        enum class Rows : std::uint8_t { None, All, AllButBlockPair };
+        Rows rows = Rows::All;
+        std::array<int, 2> blockPair{-1, -1};
+        std::array<int, 2> selectedIndices{-1, -1};
+        BlockSolveFallbackReason fallbackReason = BlockSolveFallbackReason::None;
+        Real determinantOrConditionEstimate = std::numeric_limits<float>::quiet_NaN();
+
+        bool SolvesRow(std::size_t contactIndex) const {
+            switch (rows) {
+                case Rows::None:
+                    return false;
+                case Rows::All:
+                    return true;
+                case Rows::AllButBlockPair:
+                    break;
+            }
+            const int index = static_cast<int>(contactIndex);
+            return index != blockPair[0] && index != blockPair[1];
+        }
+    };
+
+    ManifoldNormalRoute BeginManifoldNormalSolve(Manifold& manifold);
+
+    void FinishManifoldNormalSolve(Manifold& manifold, const ManifoldNormalRoute& route);
+
     void SolveManifoldNormalImpulses(Manifold& manifold);
 
+    void SolveNormalRows4(Manifold* const* lanes,
+                          const ManifoldNormalRoute* routes,
+                          std::size_t laneCount,
+                          solver_internal::ContactBodyLanes& bodies);
+
     void SolveContactsInManifold(Manifold& manifold);
 
     void SolveDistanceJoint(DistanceJoint& j);
@@ -868,8 +1168,8 @@ private:
         NonFiniteResult,
     };
     bool SolveHingeAnchorBlock3x3(
-        Body& a,
-        Body& b,
+        const core_internal::SolverBodyRef& a,
+        const core_internal::SolverBodyRef& b,
         const Mat3& invIA,
         const Mat3& invIB,
         const Vec3& ra,
@@ -978,11 +1278,55 @@ private:
 
     void PrepareIslandOrders();
 
-    void SolveIslands();
+    /// Relative PGS cost of one island (weighted contact + joint row count).
+    std::uint64_t EstimateIslandSolveCost(const Island& island) const;
+
+    /// Partition islands into per-thread batches (longest-processing-time greedy on
+    /// `EstimateIslandSolveCost`). Clears the batches when the serial path should be used.
+    void PrepareIslandSolveBatches();
+
+    /// Graph-colour contact / hinge / servo rows of islands large enough for
+    /// `ContactSolverConfig::coloring` (and `JointSolverConfig::useGraphColoring`).
+    void PrepareIslandColorings();
+
+    /// Static-dispatch adapters that forward the `core_internal` narrowphase / contact / constraint
+    /// templates to the private World routines below (defined in `world_solver_hooks.hpp`).
+    struct NarrowphaseHandlers;
+    struct ManifoldBuildHooks;
+    struct SolverHooks;
+    using SolverContext = core_internal::ConstraintSolverContext<SolverHooks>;
+
+    /// PGS velocity iterations plus the optional relaxation pass. Builds the solver context once
+    /// and reuses it for every `SolveIslands` sweep of the substep.
+    void SolveVelocityIterations(int solverIterations);
+
+    /// One PGS pass. `islandIndices` (ascending) restricts it to a subset of islands, with
+    /// `islandBatches` the matching restriction of `islandSolveBatches_`; null solves every island.
+    void SolveIslands(const SolverContext& context,
+                      const std::vector<std::size_t>* islandIndices = nullptr,
+                      const std::vector<std::vector<std::size_t>>* islandBatches = nullptr);
+
+    /// Residual-driven early exit (`SolverConvergenceConfig`): `BeginSolverConvergence` measures
+    /// joint gaps before the first pass; `UpdateSolverConvergence` runs after each pass, retires
+    /// islands whose impulse deltas fell below the tolerances once `minIterations` passes are done
+    /// and returns the number of islands still iterating.
+    void BeginSolverConvergence();
+    std::size_t UpdateSolverConvergence(int completedIterations);
+    Real MaxIslandJointPositionError(const Island& island) const;
+
+    /// One PGS pass over `islandIndices` (all islands when null). Telemetry goes to
+    /// `ActiveSolverTelemetry()`; nested profiler sections only when `recordNestedSections`.
+    /// Colour batches are spread over `colorPool` when non-null, otherwise solved inline.
+    void SolveIslandSet(const SolverContext& context,
+                        const std::vector<std::size_t>* islandIndices,
+                        bool recordNestedSections,
+                        core_internal::WorkerPool* colorPool);
 
     /// Optional per-servo mask: when set, `JointSolver` skips axis + hinge snap for those joints
-    /// (anchors still solved). Used with `enableChainPositionSolve`.
-    void SolveJointPositions(const std::vector<std::uint8_t>* skipServoHingeSnapMask = nullptr);
+    /// (anchors still solved). Used with `enableChainPositionSolve`. `skipServoJointMask` drops
+    /// the servo position rows entirely (reduced-coordinate tree joints).
+    void SolveJointPositions(const std::vector<std::uint8_t>* skipServoHingeSnapMask = nullptr,
+                             const std::vector<std::uint8_t>* skipServoJointMask = nullptr);
 
     void SolveArticulationChainPositions();
     void BeginSplitImpulseSubstep();
@@ -991,8 +1335,8 @@ private:
     bool TryComputeAnchorSeparation(const Contact& c, Real& outPenetration) const;
 
     void ApplyImpulse(
-        Body& a,
-        Body& b,
+        const core_internal::SolverBodyRef& a,
+        const core_internal::SolverBodyRef& b,
         const Mat3& invIA,
         const Mat3& invIB,
         const Vec3& ra,
@@ -1000,12 +1344,15 @@ private:
         const Vec3& impulse);
 
     void ApplyAngularImpulse(
-        Body& a,
-        Body& b,
+        const core_internal::SolverBodyRef& a,
+        const core_internal::SolverBodyRef& b,
         const Mat3& invIA,
         const Mat3& invIB,
         const Vec3& angularImpulse);
 
+    /// Solver view of body `id`: the SoA mirror while it is gathered, otherwise `Body` fields.
+    core_internal::SolverBodyRef SolverBody(std::uint32_t id) { return solverBodies_.Ref(bodies_, id); }
+
     void PositionalCorrection();
 
     void UpdateSleeping();
@@ -1062,7 +1409,28 @@ private:
         }
     };
 
-    [[nodiscard]] const std::vector<ResolvedCollisionShape>& ResolvedCollisionShapesForBody(std::uint32_t bodyId);
+    static constexpr std::size_t kNarrowphaseCacheCapacity = 4096;
+
+    /// Output of one parallel narrowphase task (a contiguous slice of the primitive pairs).
+    /// `AddContact` / `ConvexOverlapWithCache` write here instead of the world while a task runs.
+    struct NarrowphaseTaskBuffer {
+        std::vector<Contact> contacts;
+        std::vector<std::pair<ConvexSeedKey, EpaPenetrationResult>> seeds;
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+        SolverTelemetry telemetry{};
+#endif
+    };
+    static thread_local NarrowphaseTaskBuffer* threadNarrowphaseBuffer_;
+
+    [[nodiscard]] ResolvedCollisionShapes ResolvedCollisionShapesForBody(std::uint32_t bodyId);
+    /// Appends the pool indices of `resolved`'s shapes whose bounds overlap `bounds`, ascending.
+    void QueryCollisionShapes(
+        const ResolvedCollisionShapes& resolved, const AABB& bounds, std::vector<std::uint32_t>& outShapes) const;
+
+    /// Snapshot field list shared by capture and restore (`world_snapshot.cpp`).
+    template <typename Archive>
+    void TransferSnapshotState(Archive& archive);
+    static std::uint64_t SnapshotLayoutFingerprint();
 
     Vec3 gravity_{};
     Real maxBodyLinearSpeed_ = 120.0;
@@ -1082,11 +1450,18 @@ private:
     std::vector<Mat3> bodyInvInertiaWorld_;
     std::vector<std::uint32_t> shapeRevisionCounters_;
     std::vector<std::uint64_t> shapeGeometrySignatures_;
-    std::vector<std::vector<ResolvedCollisionShape>> resolvedCollisionShapesCache_;
+    /// Per body, its slice of the shape pools below (valid when built this frame).
+    std::vector<ResolvedCollisionShapes> resolvedCollisionShapesCache_;
     /// Incremented at each `GenerateContacts()` so cached expansions are not reused across substeps
-    /// (child world transforms depend on pose, not only shape revision).
+    /// (child world transforms depend on pose, not only shape revision); the pools are cleared then.
     std::uint32_t resolvedCollisionShapesCacheFrame_ = 0;
     std::vector<std::uint32_t> resolvedCollisionShapesCacheBuiltFrame_;
+    std::vector<CollisionShapeView> collisionShapePool_;
+    /// Parallel to `collisionShapePool_`: each BVH body's shape indices, partitioned by leaf.
+    std::vector<std::uint32_t> collisionShapeBvhItems_;
+    std::vector<CollisionShapeBvhNode> collisionShapeBvhNodes_;
+    std::vector<std::uint32_t> compoundShapeQueryScratchA_;
+    std::vector<std::uint32_t> compoundShapeQueryScratchB_;
     std::vector<Vec3> splitLinearPositionDelta_;
     std::vector<Vec3> splitAngularPositionDelta_;
     std::vector<BroadphaseProxy> proxies_;
@@ -1095,13 +1470,25 @@ private:
     std::int32_t freeNode_ = -1;
     std::size_t lastBroadphaseMovedProxyCount_ = 0;
     std::vector<std::uint32_t> movedProxyIds_;
+    /// Persistent pair buffer (see `ComputePotentialPairs`): the sorted pairs of the last query,
+    /// the scratch the next query merges into, and the stamps that deduplicate the move buffer.
     mutable std::vector<Pair> cachedPotentialPairs_{};
-    mutable std::unordered_set<std::uint64_t> cachedPotentialPairKeySet_{};
+    mutable std::vector<Pair> potentialPairScratch_{};
+    mutable std::vector<Pair> traversedPairScratch_{};
+    mutable std::vector<std::uint32_t> proxyMoveStamps_{};
+    mutable std::uint32_t proxyMoveGeneration_ = 0;
+    mutable std::vector<std::uint32_t> uniqueMovedProxyIds_{};
+    mutable std::vector<std::int32_t> pairQueryStack_{};
+    mutable SweepAndPruneState sweepAndPrune_{};
+    std::vector<std::pair<std::int32_t, std::uint32_t>> broadphaseDepthStack_{};
     mutable std::vector<std::uint8_t> previousBodyActiveState_{};
     std::vector<Contact> contacts_;
     std::vector<Contact> previousContacts_;
-    std::vector<Manifold> manifolds_;
-    std::vector<Manifold> previousManifolds_;
+    // Current and previous manifold builds, each with the contact pool its slices view into;
+    // swapped at the start of each substep so the previous build is never copied.
+    core_internal::ManifoldStore manifoldStore_;
+    core_internal::ManifoldStore previousManifoldStore_;
+    core_internal::ManifoldBuildScratch manifoldBuildScratch_{};
     mutable world_resource_monitoring::Profiler resource_profiler_{world_resource_monitoring::kSectionLabels};
     std::vector<Island> islands_;
     std::vector<IslandOrderResult> islandOrders_;
@@ -1117,9 +1504,30 @@ private:
     // Rebuilt every substep; indexed root-to-leaf.
     std::vector<ArtChain> articulationChains_;
     ArticulationConfig articulationConfig_{};
+    ParallelSolveConfig parallelSolveConfig_{};
+    core_internal::WorkerPoolHandle solverWorkerPool_{};
+    SolverBodyConfig solverBodyConfig_{};
+    core_internal::SolverBodyStore solverBodies_{};
+    /// Island indices per solver thread, rebuilt each substep by `PrepareIslandSolveBatches()`.
+    std::vector<std::vector<std::size_t>> islandSolveBatches_{};
+    core_internal::SolverConvergenceScratch solverConvergence_{};
+    SolverIterationStats solverIterationStats_{};
+    core_internal::SubstepContactReuseState substepContactReuse_{};
+    ContactReuseStats contactReuseStats_{};
+    /// Per-island row colourings (parallel to `islands_`), empty when graph colouring is off.
+    std::vector<IslandColoring> islandColorings_{};
+    std::vector<std::uint64_t> islandColorMaskScratch_{};
     /// `bodies_.size()` entries; `kInvalidArticulationChain` if body is not a chain leaf.
     std::vector<std::uint32_t> artChainIndexForLeafBody_{};
     static constexpr std::uint32_t kInvalidArticulationChain = std::numeric_limits<std::uint32_t>::max();
+    /// Reduced-coordinate trees, rebuilt every substep (capacity kept) when enabled.
+    std::vector<ReducedArtTree> reducedArtTrees_{};
+    /// `bodies_.size()` entries while trees exist: tree / link of each body.
+    std::vector<ReducedArtBodySlot> reducedArtBodySlots_{};
+    /// Per-servo index: 1 for joints of an active tree (skipped by the joint position pass).
+    std::vector<std::uint8_t> reducedArtJointMask_{};
+    /// True from the reduced prepare pass until the velocity iterations end.
+    bool reducedArtImpulseRouting_ = false;
     // Scratch: forward world-space inertia per body, rebuilt each substep inside
     // `PrepareArticulatedInertias()` (not used by `RefreshBodyWorldInertias()`).
     std::vector<Mat3> bodyInertiaWorld_;
@@ -1141,10 +1549,20 @@ private:
     mutable bool servoPositionUseVelocityBiasesCached_ = false;
     mutable bool servoPositionUseVelocityBiasesCacheValid_ = false;
     std::uint64_t servoPositionSolveSubstepCounter_ = 0;
-    std::unordered_map<PersistentPointKey, PersistentPointImpulseState, PersistentPointKeyHash> persistentPointImpulses_;
+    core_internal::PersistentPointTable persistentPointImpulses_{};
+    /// Previous-generation table, swapped with `persistentPointImpulses_` by each capture.
+    core_internal::PersistentPointTable persistentPointImpulsesPrevious_{};
     PersistenceMatchDiagnostics persistenceMatchDiagnostics_{};
+    world_resource_monitoring::HeapAllocationStats heapAllocationStats_{};
+    std::uint64_t warmStartHeapAllocationsThisStep_ = 0;
+    std::uint64_t broadphaseHeapAllocationsThisStep_ = 0;
+    std::vector<std::uint32_t> collisionComponentScratch_;
+    std::vector<Pair> primitivePairScratch_;
+    std::vector<Pair> compoundPairScratch_;
     std::unordered_map<NarrowphaseCacheKey, NarrowphaseCache, NarrowphaseCacheKeyHash> narrowphaseCache_;
     std::unordered_map<ConvexSeedKey, EpaPenetrationResult, ConvexSeedKeyHash> convexManifoldSeeds_;
+    std::vector<NarrowphaseTaskBuffer> narrowphaseTaskBuffers_{};
+    NarrowphaseStats narrowphaseStats_{};
     TerrainHeightfieldAttachment terrainAttachment_{};
     std::uint32_t terrainAttachmentBodyId_ = kInvalidBodyId;
     std::vector<TerrainContactCandidate> terrainContactCandidatesScratch_{};
@@ -1155,7 +1573,15 @@ private:
         return debugLogStream_ != nullptr ? debugLogStream_ : stderr;
     }
 
+    /// Counters written by PGS kernels. Resolves to `solverTelemetry_` unless the calling thread
+    /// runs a parallel solve task, which records into its own scratch (merged after the pass).
+    SolverTelemetry& ActiveSolverTelemetry() {
+        return threadSolverTelemetry_ != nullptr ? *threadSolverTelemetry_ : solverTelemetry_;
+    }
+    static thread_local SolverTelemetry* threadSolverTelemetry_;
+
     SolverTelemetry solverTelemetry_{};
+    std::vector<SolverTelemetry> parallelSolveTelemetry_{};
     bool debugContactPersistence_ = false;
     bool debugBlockSolveRouting_ = false;
     std::FILE* debugLogStream_ = stderr;
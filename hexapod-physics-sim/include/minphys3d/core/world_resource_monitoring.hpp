@@ -4,6 +4,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 
 // Per-call profiler scopes inside the PGS inner loop (SolveServoJoint, SolveContactsInManifold, ...)
 // fire 100k+ times per benchmark and each pays ~70 ns for two std::chrono::steady_clock::now()
@@ -15,6 +16,16 @@
 #define MINPHYS3D_PROFILE_INNER_LOOPS 0
 #endif
 
+// Heap allocation counting replaces the global `operator new` (src/core/heap_allocation_counter.cpp)
+// with a malloc wrapper that bumps a thread-local counter. Only targets linking the counter object
+// library replace allocation, and the counters stay zero elsewhere. The tests that require zero
+// allocations always link it. Other tools link it through `minphys3d_count_heap_allocations()`
+// when the CMake option MINPHYS3D_COUNT_HEAP_ALLOCATIONS is on (off by default), which also sets
+// `kHeapAllocationCountingEnabled`.
+#ifndef MINPHYS3D_COUNT_HEAP_ALLOCATIONS
+#define MINPHYS3D_COUNT_HEAP_ALLOCATIONS 0
+#endif
+
 namespace minphys3d::world_resource_monitoring {
 
 inline constexpr std::size_t kMaxSections = 44;
@@ -127,4 +138,39 @@ inline constexpr std::size_t toIndex(Section section) {
     return static_cast<std::size_t>(section);
 }
 
+inline constexpr bool kHeapAllocationCountingEnabled = MINPHYS3D_COUNT_HEAP_ALLOCATIONS != 0;
+
+/// `operator new` calls made so far on this thread (0 forever when counting is compiled out).
+inline thread_local std::uint64_t threadHeapAllocationCount = 0;
+
+/// Adds the number of allocations made on this thread during its lifetime to `sink`.
+class HeapAllocationScope {
+public:
+    explicit HeapAllocationScope(std::uint64_t& sink) : sink_(sink), start_(threadHeapAllocationCount) {}
+    HeapAllocationScope(const HeapAllocationScope&) = delete;
+    HeapAllocationScope& operator=(const HeapAllocationScope&) = delete;
+    ~HeapAllocationScope() { sink_ += threadHeapAllocationCount - start_; }
+
+private:
+    std::uint64_t& sink_;
+    std::uint64_t start_;
+};
+
+/// Per-`World::Step` heap allocation counts on the stepping thread. Work handed to solver pool
+/// threads is not included.
+struct HeapAllocationStats {
+    /// Whole last step.
+    std::uint64_t lastStep = 0;
+    /// Persistent-point capture and warm-start matching within the last step; expected to be zero
+    /// once the persistent-point tables have reached their high-water mark.
+    std::uint64_t lastStepWarmStart = 0;
+    /// Proxy updates and potential-pair generation within the last step; zero once the pair
+    /// buffers have reached their high-water mark and the tree stops growing (telemetry builds
+    /// with `BroadphaseConfig::validatePairsAgainstBruteForce` also count the reference list).
+    std::uint64_t lastStepBroadphase = 0;
+    std::uint64_t maxStep = 0;
+    std::uint64_t totalSteps = 0;
+    std::uint64_t totalAllocations = 0;
+};
+
 } // namespace minphys3d::world_resource_monitoring
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "minphys3d/core/constraint_solver.hpp"
+#include "minphys3d/core/subsystems.hpp"
+#include "minphys3d/core/world.hpp"
+
+namespace minphys3d {
+
+// Hook types passed to the `core_internal` templates. Each member forwards to one private World
+// routine; being nested in `World` they have private access, and being concrete types every call
+// site in the templates binds statically (no `std::function` in the per-pair / per-row paths).
+
+struct World::NarrowphaseHandlers {
+    World& world;
+
+    ConvexDispatchRoute SelectConvexDispatchRoute(ShapeType a, ShapeType b) const {
+        return world.SelectConvexDispatchRoute(a, b);
+    }
+    bool ConvexOverlap(std::uint32_t a, std::uint32_t b) const { return world.ConvexOverlapWithCache(a, b); }
+    void SphereSphere(std::uint32_t a, std::uint32_t b) const { world.SphereSphere(a, b); }
+    void SphereCapsule(std::uint32_t a, std::uint32_t b) const { world.SphereCapsule(a, b); }
+    void CapsuleCapsule(std::uint32_t a, std::uint32_t b) const { world.CapsuleCapsule(a, b); }
+    void CapsulePlane(std::uint32_t a, std::uint32_t b) const { world.CapsulePlane(a, b); }
+    void CapsuleBox(std::uint32_t a, std::uint32_t b) const { world.CapsuleBox(a, b); }
+    void SpherePlane(std::uint32_t a, std::uint32_t b) const { world.SpherePlane(a, b); }
+    void BoxPlane(std::uint32_t a, std::uint32_t b) const { world.BoxPlane(a, b); }
+    void SphereBox(std::uint32_t a, std::uint32_t b) const { world.SphereBox(a, b); }
+    void BoxBox(std::uint32_t a, std::uint32_t b) const { world.BoxBox(a, b); }
+    void ConvexPlane(std::uint32_t a, std::uint32_t b) const { world.ConvexPlane(a, b); }
+    void ConvexConvexEPA(std::uint32_t a, std::uint32_t b) const { world.ConvexConvexEPA(a, b); }
+    void SphereCylinder(std::uint32_t a, std::uint32_t b) const { world.SphereCylinder(a, b); }
+    void CylinderBox(std::uint32_t a, std::uint32_t b) const { world.CylinderBox(a, b); }
+    void CylinderCylinder(std::uint32_t a, std::uint32_t b) const { world.CylinderCylinder(a, b); }
+    void CapsuleCylinder(std::uint32_t a, std::uint32_t b) const { world.CapsuleCylinder(a, b); }
+    void SphereHalfCylinder(std::uint32_t a, std::uint32_t b) const { world.SphereHalfCylinder(a, b); }
+    void HalfCylinderBox(std::uint32_t a, std::uint32_t b) const { world.HalfCylinderBox(a, b); }
+    void HalfCylinderCylinder(std::uint32_t a, std::uint32_t b) const { world.HalfCylinderCylinder(a, b); }
+    void HalfCylinderHalfCylinder(std::uint32_t a, std::uint32_t b) const { world.HalfCylinderHalfCylinder(a, b); }
+    void CapsuleHalfCylinder(std::uint32_t a, std::uint32_t b) const { world.CapsuleHalfCylinder(a, b); }
+};
+
+/// `ContactSolver::BuildManifolds` callbacks: warm-start matching and manifold bookkeeping.
+struct World::ManifoldBuildHooks {
+    World& world;
+    /// Slot range of the manifold whose contacts are being matched; contacts arrive grouped by
+    /// manifold, so the table index is probed once per manifold rather than once per contact.
+    mutable ManifoldKey resolvedManifold{};
+    mutable core_internal::PersistentPointTable::Range resolvedRange{};
+    mutable bool hasResolvedManifold = false;
+
+    bool TryGetPersistentImpulseState(const ManifoldKey& manifoldId,
+                                      const Contact& contact,
+                                      SolverReal& normal,
+                                      std::array<SolverReal, 2>& tangent,
+                                      std::uint16_t& age) const {
+        const world_resource_monitoring::HeapAllocationScope allocationScope(world.warmStartHeapAllocationsThisStep_);
+        core_internal::PersistentPointTable& table = world.persistentPointImpulses_;
+        if (!hasResolvedManifold || !(resolvedManifold == manifoldId)) {
+            resolvedManifold = manifoldId;
+            resolvedRange = table.Find(manifoldId);
+            hasResolvedManifold = true;
+        }
+        PersistentPointMatchCandidate match{};
+        if (!TryMatchPersistentPoint(table, resolvedRange, contact, match)) {
+            return false;
+        }
+        table.Claim(match.slot);
+        normal = match.state.normalImpulseSum;
+        tangent = {match.state.tangentImpulseSum0, match.state.tangentImpulseSum1};
+        age = match.state.persistenceAge;
+        return true;
+    }
+    void ManageManifoldContacts(Manifold& manifold, const Manifold* previous) const {
+        world.ManageManifoldContacts(manifold, previous);
+    }
+    void RefreshManifoldBlockCache(Manifold& manifold) const { World::RefreshManifoldBlockCache(manifold); }
+    void SelectBlockSolvePair(Manifold& manifold) const { world.SelectBlockSolvePair(manifold); }
+    void RecordSelectedPairHistory(const Manifold& manifold) const {
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+        world.RecordSelectedPairHistory(manifold);
+#else
+        (void)manifold;
+#endif
+    }
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+    void RecordManifoldTangentReprojection(bool reprojected) const {
+        if (reprojected) {
+            ++world.ActiveSolverTelemetry().tangentImpulseReprojected;
+        } else {
+            ++world.ActiveSolverTelemetry().tangentImpulseReset;
+        }
+    }
+#endif
+};
+
+/// PGS callbacks for `ContactSolver::SolveContactsInManifold` and `ConstraintSolver::SolveIslands`.
+struct World::SolverHooks {
+    World& world;
+
+    using ManifoldNormalRoute = World::ManifoldNormalRoute;
+
+    void SolveManifoldNormalImpulses(Manifold& manifold) const { world.SolveManifoldNormalImpulses(manifold); }
+    ManifoldNormalRoute BeginManifoldNormalSolve(Manifold& manifold) const {
+        return world.BeginManifoldNormalSolve(manifold);
+    }
+    void FinishManifoldNormalSolve(Manifold& manifold, const ManifoldNormalRoute& route) const {
+        world.FinishManifoldNormalSolve(manifold, route);
+    }
+    void SolveNormalRows4(Manifold* const* lanes,
+                          const ManifoldNormalRoute* routes,
+                          std::size_t laneCount,
+                          solver_internal::ContactBodyLanes& bodies) const {
+        world.SolveNormalRows4(lanes, routes, laneCount, bodies);
+    }
+    int FindBlockSlot(const Manifold& manifold, std::uint64_t contactKey) const {
+        return World::FindBlockSlot(manifold, contactKey);
+    }
+    void ApplyImpulse(const core_internal::SolverBodyRef& a,
+                      const core_internal::SolverBodyRef& b,
+                      const Mat3& invIA,
+                      const Mat3& invIB,
+                      const Vec3& ra,
+                      const Vec3& rb,
+                      const Vec3& impulse) const {
+        world.ApplyImpulse(a, b, invIA, invIB, ra, rb, impulse);
+    }
+    // Reduced-coordinate trees replace the rigid tangent masses with the articulated ones.
+    void AdjustTangentMasses(const Manifold& manifold, const Contact& c, Real& mass0, Real& mass1) const {
+        if (world.reducedArtImpulseRouting_) {
+            world.ApplyReducedTangentMasses(manifold, c, mass0, mass1);
+        }
+    }
+    void RecordTangentBasisState(bool reusedBasis) const {
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+        if (reusedBasis) {
+            ++world.ActiveSolverTelemetry().tangentBasisReused;
+        } else {
+            ++world.ActiveSolverTelemetry().tangentBasisResets;
+        }
+#else
+        (void)reusedBasis;
+#endif
+    }
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+    void RecordFrictionBudgetSaturation(FrictionBudgetNormalSupportSource source) const {
+        SolverTelemetry& telemetry = world.ActiveSolverTelemetry();
+        ++telemetry.manifoldFrictionBudgetSaturated;
+        switch (source) {
+            case FrictionBudgetNormalSupportSource::SelectedBlockPairOnly:
+                ++telemetry.manifoldFrictionBudgetSaturatedSelectedPair;
+                break;
+            case FrictionBudgetNormalSupportSource::AllManifoldContacts:
+                ++telemetry.manifoldFrictionBudgetSaturatedAllContacts;
+                break;
+            case FrictionBudgetNormalSupportSource::BlendedSelectedPairAndManifold:
+                ++telemetry.manifoldFrictionBudgetSaturatedBlended;
+                break;
+        }
+    }
+    SolverTelemetry& Telemetry() const { return world.ActiveSolverTelemetry(); }
+#endif
+
+    void SolveDistanceJoint(DistanceJoint& joint) const { world.SolveDistanceJoint(joint); }
+    void SolveHingeJoint(HingeJoint& joint) const { world.SolveHingeJoint(joint); }
+    void SolveBallSocketJoint(BallSocketJoint& joint) const { world.SolveBallSocketJoint(joint); }
+    void SolveFixedJoint(FixedJoint& joint) const { world.SolveFixedJoint(joint); }
+    void SolvePrismaticJoint(PrismaticJoint& joint) const { world.SolvePrismaticJoint(joint); }
+    void SolveServoJoint(ServoJoint& joint) const { world.SolveServoJoint(joint); }
+
+    /// Colour chunk `task` records telemetry into its own scratch; merged by `SolveIslands`.
+    template <typename Task>
+    void ParallelFor(core_internal::WorkerPool& pool, std::size_t taskCount, Task&& task) const {
+        pool.ParallelFor(taskCount, [this, &task](std::size_t taskIdx) {
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+            SolverTelemetry* const previous = World::threadSolverTelemetry_;
+            World::threadSolverTelemetry_ = &world.parallelSolveTelemetry_[taskIdx];
+#endif
+            task(taskIdx);
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+            World::threadSolverTelemetry_ = previous;
+#endif
+        });
+    }
+};
+
+} // namespace minphys3d
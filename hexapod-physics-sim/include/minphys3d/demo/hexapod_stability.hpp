@@ -28,12 +28,12 @@ inline Vec3 BodyUpVectorStability(const Quat& orientation) {
 
 inline Real BodyRollRadStability(const Quat& orientation) {
     const Vec3 up = BodyUpVectorStability(orientation);
-    return std::atan2(up.x, std::max(up.y, 1.0e-6));
+    return std::atan2(up.x, std::max<Real>(up.y, 1.0e-6));
 }
 
 inline Real BodyPitchRadStability(const Quat& orientation) {
     const Vec3 up = BodyUpVectorStability(orientation);
-    return std::atan2(-up.z, std::max(up.y, 1.0e-6));
+    return std::atan2(-up.z, std::max<Real>(up.y, 1.0e-6));
 }
 
 // --- Ground / contact rollups (moved from scenes.cpp; used for standing metrics) ---
@@ -87,7 +87,7 @@ inline std::array<HexapodLegContactRollup, 6> SummarizeHexapodGroundContacts(
         ++summary->manifolds;
         summary->points += static_cast<int>(manifold.contacts.size());
         for (const Contact& contact : manifold.contacts) {
-            summary->totalNormalImpulse += std::max(contact.normalImpulseSum, 0.0);
+            summary->totalNormalImpulse += std::max<Real>(contact.normalImpulseSum, 0.0);
             summary->maxPenetration = std::max(summary->maxPenetration, contact.penetration);
         }
     }
@@ -115,8 +115,8 @@ inline void UpdateHexapodStandingStats(
     Real max_joint_speed_rad_s) {
     stats.minBodyHeight = std::min(stats.minBodyHeight, chassis.position.y);
     stats.maxBodyHeight = std::max(stats.maxBodyHeight, chassis.position.y);
-    stats.maxAbsRollDeg = std::max(stats.maxAbsRollDeg, std::abs(roll_rad) * 180.0 / kHexapodStabilityPi);
-    stats.maxAbsPitchDeg = std::max(stats.maxAbsPitchDeg, std::abs(pitch_rad) * 180.0 / kHexapodStabilityPi);
+    stats.maxAbsRollDeg = std::max<Real>(stats.maxAbsRollDeg, std::abs(roll_rad) * 180.0 / kHexapodStabilityPi);
+    stats.maxAbsPitchDeg = std::max<Real>(stats.maxAbsPitchDeg, std::abs(pitch_rad) * 180.0 / kHexapodStabilityPi);
     stats.maxJointSpeedRadS = std::max(stats.maxJointSpeedRadS, max_joint_speed_rad_s);
     stats.minContactManifolds = std::min(stats.minContactManifolds, contact_manifolds);
     stats.minContactPoints = std::min(stats.minContactPoints, contact_points);
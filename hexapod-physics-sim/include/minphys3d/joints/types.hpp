@@ -16,7 +16,7 @@ struct DistanceJoint {
     Real restLength = 1.0;
     Real stiffness = 1.0;
     Real damping = 0.1;
-    Real impulseSum = 0.0;
+    SolverReal impulseSum = 0.0;
 };
 
 struct HingeJoint {
@@ -39,7 +39,7 @@ struct HingeJoint {
     bool motorEnabled = false;
     Real motorSpeed = 0.0;
     Real maxMotorTorque = 0.0;
-    Real motorImpulseSum = 0.0;
+    SolverReal motorImpulseSum = 0.0;
 };
 
 struct BallSocketJoint {
@@ -82,7 +82,7 @@ struct PrismaticJoint {
     bool motorEnabled = false;
     Real motorSpeed = 0.0;
     Real maxMotorForce = 0.0;
-    Real motorImpulseSum = 0.0;
+    SolverReal motorImpulseSum = 0.0;
 };
 
 struct ServoJoint {
@@ -99,7 +99,7 @@ struct ServoJoint {
     Real impulseZ = 0.0;
     Real angularImpulse1 = 0.0;
     Real angularImpulse2 = 0.0;
-    Real servoImpulseSum = 0.0;
+    SolverReal servoImpulseSum = 0.0;
     Real targetAngle = 0.0;
     Real maxServoTorque = 0.0;
     /// Max axis speed (rad/s) the servo bias is allowed to request; 0 disables the clamp.
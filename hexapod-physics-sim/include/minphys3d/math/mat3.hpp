@@ -6,19 +6,26 @@
 
 namespace minphys3d {
 
-struct Mat3 {
-    Real m[3][3]{};
-
-    static Mat3 Identity() {
-        Mat3 r{};
-        r.m[0][0] = 1.0;
-        r.m[1][1] = 1.0;
-        r.m[2][2] = 1.0;
+/// Row-major 3x3 matrix over scalar `T`; the engine uses `Mat3` (`BasicMat3<Real>`).
+template <typename T>
+struct BasicMat3 {
+    using Scalar = T;
+
+    T m[3][3]{};
+
+    static BasicMat3 Identity() {
+        BasicMat3 r{};
+        r.m[0][0] = T(1);
+        r.m[1][1] = T(1);
+        r.m[2][2] = T(1);
         return r;
     }
 };
 
-inline Vec3 operator*(const Mat3& A, const Vec3& v) {
+using Mat3 = BasicMat3<Real>;
+
+template <typename T>
+inline BasicVec3<T> operator*(const BasicMat3<T>& A, const BasicVec3<T>& v) {
     return {
         A.m[0][0] * v.x + A.m[0][1] * v.y + A.m[0][2] * v.z,
         A.m[1][0] * v.x + A.m[1][1] * v.y + A.m[1][2] * v.z,
@@ -26,20 +33,23 @@ inline Vec3 operator*(const Mat3& A, const Vec3& v) {
     };
 }
 
-inline Mat3 operator*(const Mat3& A, const Mat3& B) {
-    Mat3 r{};
+template <typename T>
+inline BasicMat3<T> operator*(const BasicMat3<T>& A, const BasicMat3<T>& B) {
+    BasicMat3<T> r{};
     for (int i = 0; i < 3; ++i) for (int j = 0; j < 3; ++j) for (int k = 0; k < 3; ++k) r.m[i][j] += A.m[i][k] * B.m[k][j];
     return r;
 }
 
-inline Mat3 Transpose(const Mat3& A) {
-    Mat3 r{};
+template <typename T>
+inline BasicMat3<T> Transpose(const BasicMat3<T>& A) {
+    BasicMat3<T> r{};
     for (int i = 0; i < 3; ++i) for (int j = 0; j < 3; ++j) r.m[i][j] = A.m[j][i];
     return r;
 }
 
-inline Mat3 operator+(const Mat3& A, const Mat3& B) {
-    Mat3 r{};
+template <typename T>
+inline BasicMat3<T> operator+(const BasicMat3<T>& A, const BasicMat3<T>& B) {
+    BasicMat3<T> r{};
     for (int i = 0; i < 3; ++i) {
         for (int j = 0; j < 3; ++j) {
             r.m[i][j] = A.m[i][j] + B.m[i][j];
@@ -48,8 +58,9 @@ inline Mat3 operator+(const Mat3& A, const Mat3& B) {
     return r;
 }
 
-inline Mat3 operator-(const Mat3& A, const Mat3& B) {
-    Mat3 r{};
+template <typename T>
+inline BasicMat3<T> operator-(const BasicMat3<T>& A, const BasicMat3<T>& B) {
+    BasicMat3<T> r{};
     for (int i = 0; i < 3; ++i) {
         for (int j = 0; j < 3; ++j) {
             r.m[i][j] = A.m[i][j] - B.m[i][j];
@@ -58,8 +69,9 @@ inline Mat3 operator-(const Mat3& A, const Mat3& B) {
     return r;
 }
 
-inline Mat3 operator*(Real s, const Mat3& M) {
-    Mat3 r{};
+template <typename T>
+inline BasicMat3<T> operator*(typename BasicMat3<T>::Scalar s, const BasicMat3<T>& M) {
+    BasicMat3<T> r{};
     for (int i = 0; i < 3; ++i) {
         for (int j = 0; j < 3; ++j) {
             r.m[i][j] = s * M.m[i][j];
@@ -68,8 +80,9 @@ inline Mat3 operator*(Real s, const Mat3& M) {
     return r;
 }
 
-inline Mat3 OuterProduct(const Vec3& u, const Vec3& v) {
-    Mat3 r{};
+template <typename T>
+inline BasicMat3<T> OuterProduct(const BasicVec3<T>& u, const BasicVec3<T>& v) {
+    BasicMat3<T> r{};
     r.m[0][0] = u.x * v.x;
     r.m[0][1] = u.x * v.y;
     r.m[0][2] = u.x * v.z;
@@ -91,25 +104,26 @@ inline Mat3 ScaleIdentity(Real s) {
 }
 
 // General 3×3 inverse; returns false if singular.
-inline bool InvertMat3(const Mat3& a, Mat3& out) {
-    const Real c00 = a.m[1][1] * a.m[2][2] - a.m[1][2] * a.m[2][1];
-    const Real c01 = a.m[1][2] * a.m[2][0] - a.m[1][0] * a.m[2][2];
-    const Real c02 = a.m[1][0] * a.m[2][1] - a.m[1][1] * a.m[2][0];
-
-    const Real det = a.m[0][0] * c00 + a.m[0][1] * c01 + a.m[0][2] * c02;
-    if (!(std::abs(det) > 1e-18)) {
+template <typename T>
+inline bool InvertMat3(const BasicMat3<T>& a, BasicMat3<T>& out) {
+    const T c00 = a.m[1][1] * a.m[2][2] - a.m[1][2] * a.m[2][1];
+    const T c01 = a.m[1][2] * a.m[2][0] - a.m[1][0] * a.m[2][2];
+    const T c02 = a.m[1][0] * a.m[2][1] - a.m[1][1] * a.m[2][0];
+
+    const T det = a.m[0][0] * c00 + a.m[0][1] * c01 + a.m[0][2] * c02;
+    if (!(std::abs(det) > T(1e-18))) {
         return false;
     }
 
-    const Real invDet = 1.0 / det;
+    const T invDet = T(1) / det;
 
-    const Real c10 = a.m[0][2] * a.m[2][1] - a.m[0][1] * a.m[2][2];
-    const Real c11 = a.m[0][0] * a.m[2][2] - a.m[0][2] * a.m[2][0];
-    const Real c12 = a.m[0][1] * a.m[2][0] - a.m[0][0] * a.m[2][1];
+    const T c10 = a.m[0][2] * a.m[2][1] - a.m[0][1] * a.m[2][2];
+    const T c11 = a.m[0][0] * a.m[2][2] - a.m[0][2] * a.m[2][0];
+    const T c12 = a.m[0][1] * a.m[2][0] - a.m[0][0] * a.m[2][1];
 
-    const Real c20 = a.m[0][1] * a.m[1][2] - a.m[0][2] * a.m[1][1];
-    const Real c21 = a.m[0][2] * a.m[1][0] - a.m[0][0] * a.m[1][2];
-    const Real c22 = a.m[0][0] * a.m[1][1] - a.m[0][1] * a.m[1][0];
+    const T c20 = a.m[0][1] * a.m[1][2] - a.m[0][2] * a.m[1][1];
+    const T c21 = a.m[0][2] * a.m[1][0] - a.m[0][0] * a.m[1][2];
+    const T c22 = a.m[0][0] * a.m[1][1] - a.m[0][1] * a.m[1][0];
 
     out.m[0][0] = c00 * invDet;
     out.m[0][1] = c10 * invDet;
@@ -123,28 +137,29 @@ inline bool InvertMat3(const Mat3& a, Mat3& out) {
     return true;
 }
 
-inline Mat3 RotationMatrix(const Quat& q_) {
-    const Quat q = Normalize(q_);
-    const Real xx = q.x * q.x;
-    const Real yy = q.y * q.y;
-    const Real zz = q.z * q.z;
-    const Real xy = q.x * q.y;
-    const Real xz = q.x * q.z;
-    const Real yz = q.y * q.z;
-    const Real wx = q.w * q.x;
-    const Real wy = q.w * q.y;
-    const Real wz = q.w * q.z;
-
-    Mat3 r{};
-    r.m[0][0] = 1.0 - 2.0 * (yy + zz);
-    r.m[0][1] = 2.0 * (xy - wz);
-    r.m[0][2] = 2.0 * (xz + wy);
-    r.m[1][0] = 2.0 * (xy + wz);
-    r.m[1][1] = 1.0 - 2.0 * (xx + zz);
-    r.m[1][2] = 2.0 * (yz - wx);
-    r.m[2][0] = 2.0 * (xz - wy);
-    r.m[2][1] = 2.0 * (yz + wx);
-    r.m[2][2] = 1.0 - 2.0 * (xx + yy);
+template <typename T>
+inline BasicMat3<T> RotationMatrix(const BasicQuat<T>& q_) {
+    const BasicQuat<T> q = Normalize(q_);
+    const T xx = q.x * q.x;
+    const T yy = q.y * q.y;
+    const T zz = q.z * q.z;
+    const T xy = q.x * q.y;
+    const T xz = q.x * q.z;
+    const T yz = q.y * q.z;
+    const T wx = q.w * q.x;
+    const T wy = q.w * q.y;
+    const T wz = q.w * q.z;
+
+    BasicMat3<T> r{};
+    r.m[0][0] = T(1) - T(2) * (yy + zz);
+    r.m[0][1] = T(2) * (xy - wz);
+    r.m[0][2] = T(2) * (xz + wy);
+    r.m[1][0] = T(2) * (xy + wz);
+    r.m[1][1] = T(1) - T(2) * (xx + zz);
+    r.m[1][2] = T(2) * (yz - wx);
+    r.m[2][0] = T(2) * (xz - wy);
+    r.m[2][1] = T(2) * (yz + wx);
+    r.m[2][2] = T(1) - T(2) * (xx + yy);
     return r;
 }
 
@@ -16,20 +16,32 @@ namespace minphys3d {
 #define MINPHYS3D_DETAIL_QUAT_VECTOR_ROTATE_FAST 0
 #endif
 
-struct Quat {
-    Real w = 1.0;
-    Real x = 0.0;
-    Real y = 0.0;
-    Real z = 0.0;
+/// Unit quaternion (w, x, y, z) over scalar `T`; the engine uses `Quat` (`BasicQuat<Real>`).
+template <typename T>
+struct BasicQuat {
+    using Scalar = T;
 
-    Quat() = default;
-    Quat(Real w_, Real x_, Real y_, Real z_) : w(w_), x(x_), y(y_), z(z_) {}
+    T w = T(1);
+    T x = T(0);
+    T y = T(0);
+    T z = T(0);
 
-    Quat operator+(const Quat& rhs) const { return {w + rhs.w, x + rhs.x, y + rhs.y, z + rhs.z}; }
-    Quat operator*(Real s) const { return {w * s, x * s, y * s, z * s}; }
+    BasicQuat() = default;
+    BasicQuat(T w_, T x_, T y_, T z_) : w(w_), x(x_), y(y_), z(z_) {}
+
+    BasicQuat operator+(const BasicQuat& rhs) const { return {w + rhs.w, x + rhs.x, y + rhs.y, z + rhs.z}; }
+    BasicQuat operator*(T s) const { return {w * s, x * s, y * s, z * s}; }
 };
 
-inline Quat operator*(const Quat& a, const Quat& b) {
+using Quat = BasicQuat<Real>;
+
+template <typename To, typename From>
+BasicQuat<To> CastQuat(const BasicQuat<From>& q) {
+    return {static_cast<To>(q.w), static_cast<To>(q.x), static_cast<To>(q.y), static_cast<To>(q.z)};
+}
+
+template <typename T>
+inline BasicQuat<T> operator*(const BasicQuat<T>& a, const BasicQuat<T>& b) {
     return {
         a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
         a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
@@ -38,19 +50,22 @@ inline Quat operator*(const Quat& a, const Quat& b) {
     };
 }
 
-inline Quat Conjugate(const Quat& q) { return {q.w, -q.x, -q.y, -q.z}; }
-inline Quat Normalize(const Quat& q) {
-    const Real len = std::sqrt(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
-    if (len <= kEpsilon) return {1.0, 0.0, 0.0, 0.0};
+template <typename T>
+inline BasicQuat<T> Conjugate(const BasicQuat<T>& q) { return {q.w, -q.x, -q.y, -q.z}; }
+template <typename T>
+inline BasicQuat<T> Normalize(const BasicQuat<T>& q) {
+    const T len = std::sqrt(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+    if (len <= ScalarTraits<T>::kEpsilon) return {T(1), T(0), T(0), T(0)};
     return {q.w / len, q.x / len, q.y / len, q.z / len};
 }
 
 #if MINPHYS3D_DETAIL_QUAT_VECTOR_ROTATE_FAST
 // Cross-product form: t = 2*(q_vec × v); v' = v + q.w*t + q_vec × t
-inline Vec3 Rotate(const Quat& q, const Vec3& v) {
-    const Real tx = 2.0 * (q.y * v.z - q.z * v.y);
-    const Real ty = 2.0 * (q.z * v.x - q.x * v.z);
-    const Real tz = 2.0 * (q.x * v.y - q.y * v.x);
+template <typename T>
+inline BasicVec3<T> Rotate(const BasicQuat<T>& q, const BasicVec3<T>& v) {
+    const T tx = T(2) * (q.y * v.z - q.z * v.y);
+    const T ty = T(2) * (q.z * v.x - q.x * v.z);
+    const T tz = T(2) * (q.x * v.y - q.y * v.x);
     return {
         v.x + q.w * tx + (q.y * tz - q.z * ty),
         v.y + q.w * ty + (q.z * tx - q.x * tz),
@@ -58,10 +73,11 @@ inline Vec3 Rotate(const Quat& q, const Vec3& v) {
     };
 }
 
-inline Vec3 RotateInverse(const Quat& q, const Vec3& v) {
-    const Real tx = 2.0 * (q.y * v.z - q.z * v.y);
-    const Real ty = 2.0 * (q.z * v.x - q.x * v.z);
-    const Real tz = 2.0 * (q.x * v.y - q.y * v.x);
+template <typename T>
+inline BasicVec3<T> RotateInverse(const BasicQuat<T>& q, const BasicVec3<T>& v) {
+    const T tx = T(2) * (q.y * v.z - q.z * v.y);
+    const T ty = T(2) * (q.z * v.x - q.x * v.z);
+    const T tz = T(2) * (q.x * v.y - q.y * v.x);
     return {
         v.x - q.w * tx + (q.y * tz - q.z * ty),
         v.y - q.w * ty + (q.z * tx - q.x * tz),
@@ -69,16 +85,18 @@ inline Vec3 RotateInverse(const Quat& q, const Vec3& v) {
     };
 }
 #else
-inline Vec3 Rotate(const Quat& q, const Vec3& v) {
-    const Quat p{0.0, v.x, v.y, v.z};
-    const Quat t = q * p * Conjugate(q);
+template <typename T>
+inline BasicVec3<T> Rotate(const BasicQuat<T>& q, const BasicVec3<T>& v) {
+    const BasicQuat<T> p{T(0), v.x, v.y, v.z};
+    const BasicQuat<T> t = q * p * Conjugate(q);
     return {t.x, t.y, t.z};
 }
 
-inline Vec3 RotateInverse(const Quat& q, const Vec3& v) {
-    const Quat qc = Conjugate(q);
-    const Quat p{0.0, v.x, v.y, v.z};
-    const Quat t = qc * p * q;
+template <typename T>
+inline BasicVec3<T> RotateInverse(const BasicQuat<T>& q, const BasicVec3<T>& v) {
+    const BasicQuat<T> qc = Conjugate(q);
+    const BasicQuat<T> p{T(0), v.x, v.y, v.z};
+    const BasicQuat<T> t = qc * p * q;
     return {t.x, t.y, t.z};
 }
 #endif
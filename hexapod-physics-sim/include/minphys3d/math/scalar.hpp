@@ -1,11 +1,56 @@
 #pragma once
 
+// Build-time precision of a minphys3d library (set per target by CMake; see
+// `minphys3d_core_f32` / `minphys3d_core_mixed`). Every translation unit linked into one binary
+// must agree on it.
+//  - MINPHYS3D_PRECISION_F64 (default): all state and solver arithmetic in double.
+//  - MINPHYS3D_PRECISION_F32: everything in float (matches the float32 wire format).
+//  - MINPHYS3D_PRECISION_MIXED: geometry, body state, broadphase / narrowphase and ray casts in
+//    float; solver impulse accumulators and error sums (`SolverReal`) in double.
+#define MINPHYS3D_PRECISION_F64 0
+#define MINPHYS3D_PRECISION_F32 1
+#define MINPHYS3D_PRECISION_MIXED 2
+#ifndef MINPHYS3D_PRECISION
+#define MINPHYS3D_PRECISION MINPHYS3D_PRECISION_F64
+#endif
+
 namespace minphys3d {
 
+template <typename T>
+struct ScalarTraits;
+
+template <>
+struct ScalarTraits<double> {
+    static constexpr double kEpsilon = 1e-9;
+    static constexpr const char* kName = "f64";
+};
+
+template <>
+struct ScalarTraits<float> {
+    static constexpr float kEpsilon = 1e-9f;
+    static constexpr const char* kName = "f32";
+};
+
 /// Internal scalar type for minphys3d dynamics and collision (CPU-side).
 /// UDP / `physics_sim_protocol` remain float32; widen/narrow at serve I/O only.
+#if MINPHYS3D_PRECISION == MINPHYS3D_PRECISION_F64
 using Real = double;
+using SolverReal = double;
+#elif MINPHYS3D_PRECISION == MINPHYS3D_PRECISION_F32
+using Real = float;
+using SolverReal = float;
+#elif MINPHYS3D_PRECISION == MINPHYS3D_PRECISION_MIXED
+using Real = float;
+using SolverReal = double;
+#else
+#error "MINPHYS3D_PRECISION must be MINPHYS3D_PRECISION_F64, _F32 or _MIXED"
+#endif
+
+constexpr Real kEpsilon = ScalarTraits<Real>::kEpsilon;
 
-constexpr Real kEpsilon = 1e-9;
+/// Short label of the build precision ("f64", "f32", "mixed") for benches and logs.
+constexpr const char* PrecisionName() {
+    return MINPHYS3D_PRECISION == MINPHYS3D_PRECISION_MIXED ? "mixed" : ScalarTraits<Real>::kName;
+}
 
 } // namespace minphys3d
@@ -324,6 +324,51 @@ inline SpatialVec SpatialForceTranslateByOffset(const SpatialVec& f, const Vec3&
     return {f.ang + Cross(offsetRefBMinusRefA, f.lin), f.lin};
 }
 
+// ---------------------------------------------------------------------------
+// ArticulatedInertia
+//   General symmetric 6×6 spatial inertia in the same [angular; linear] basis:
+//
+//     [ angAng     angLin ]
+//     [ angLin^T   linLin ]
+//
+//   `SpatialInertia` only holds rigid-body inertias (its lower-right block is m·I3). Once a
+//   revolute DOF has been factored out (I − U·U^T / D) that block is a general symmetric
+//   matrix, so the exact ABA passes of the reduced-coordinate tree solve keep this form.
+// ---------------------------------------------------------------------------
+
+struct ArticulatedInertia {
+    Mat3 angAng{};
+    Mat3 angLin{};
+    Mat3 linLin{};
+};
+
+inline ArticulatedInertia ToArticulatedInertia(const SpatialInertia& I) {
+    return {I.Ioo, I.mCross, ScaleIdentity(I.mass)};
+}
+
+inline ArticulatedInertia& operator+=(ArticulatedInertia& A, const ArticulatedInertia& B) {
+    A.angAng = A.angAng + B.angAng;
+    A.angLin = A.angLin + B.angLin;
+    A.linLin = A.linLin + B.linLin;
+    return A;
+}
+
+inline SpatialVec SpatialMul(const ArticulatedInertia& I, const SpatialVec& v) {
+    return {
+        I.angAng * v.ang + I.angLin * v.lin,
+        Transpose(I.angLin) * v.ang + I.linLin * v.lin,
+    };
+}
+
+// Schur complement of a factored 1-DOF joint: I − U·U^T / D with U = I·s and D = s^T·I·s.
+inline ArticulatedInertia SubtractJointProjection(const ArticulatedInertia& I, const SpatialVec& U, Real invD) {
+    return {
+        I.angAng - invD * OuterProduct(U.ang, U.ang),
+        I.angLin - invD * OuterProduct(U.ang, U.lin),
+        I.linLin - invD * OuterProduct(U.lin, U.lin),
+    };
+}
+
 struct SpatialSolveDiagnostics {
     bool regularized = false;
     bool failed = false;
@@ -356,15 +401,25 @@ inline void AssembleSpatialSolveSystem(const SpatialInertia& I, double M[6][6])
     }
 }
 
-inline bool FactorSpatialSolveSystem(
-    const SpatialInertia& I,
+inline void AssembleSpatialSolveSystem(const ArticulatedInertia& I, double M[6][6]) {
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            M[i][j] = static_cast<double>(I.angAng.m[i][j]);
+            M[i][j + 3] = static_cast<double>(I.angLin.m[i][j]);
+            M[j + 3][i] = static_cast<double>(I.angLin.m[i][j]);
+            M[i + 3][j + 3] = static_cast<double>(I.linLin.m[i][j]);
+        }
+    }
+}
+
+// Pivoted LDL^T of the assembled system `A` (overwritten).
+inline bool FactorSpatialSolveMatrix(
+    double A[6][6],
     double L[6][6],
     double D[6],
     int perm[6],
     SpatialSolveDiagnostics* diagnostics)
 {
-    double A[6][6]{};
-    AssembleSpatialSolveSystem(I, A);
     for (int i = 0; i < 6; ++i) {
         A[i][i] += kSpatialSolveDiagRidge;
         perm[i] = i;
@@ -447,6 +502,30 @@ inline bool FactorSpatialSolveSystem(
     return true;
 }
 
+inline bool FactorSpatialSolveSystem(
+    const SpatialInertia& I,
+    double L[6][6],
+    double D[6],
+    int perm[6],
+    SpatialSolveDiagnostics* diagnostics)
+{
+    double A[6][6]{};
+    AssembleSpatialSolveSystem(I, A);
+    return FactorSpatialSolveMatrix(A, L, D, perm, diagnostics);
+}
+
+inline bool FactorSpatialSolveSystem(
+    const ArticulatedInertia& I,
+    double L[6][6],
+    double D[6],
+    int perm[6],
+    SpatialSolveDiagnostics* diagnostics)
+{
+    double A[6][6]{};
+    AssembleSpatialSolveSystem(I, A);
+    return FactorSpatialSolveMatrix(A, L, D, perm, diagnostics);
+}
+
 inline bool SolveSpatialFactorized(
     const double L[6][6],
     const double D[6],
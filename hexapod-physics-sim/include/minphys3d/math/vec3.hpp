@@ -6,42 +6,64 @@
 
 namespace minphys3d {
 
-struct Vec3 {
-    Real x = 0.0;
-    Real y = 0.0;
-    Real z = 0.0;
-
-    Vec3() = default;
-    Vec3(Real x_, Real y_, Real z_) : x(x_), y(y_), z(z_) {}
-
-    Vec3 operator+(const Vec3& rhs) const { return {x + rhs.x, y + rhs.y, z + rhs.z}; }
-    Vec3 operator-(const Vec3& rhs) const { return {x - rhs.x, y - rhs.y, z - rhs.z}; }
-    Vec3 operator-() const { return {-x, -y, -z}; }
-    Vec3 operator*(Real s) const { return {x * s, y * s, z * s}; }
-    Vec3 operator/(Real s) const { return {x / s, y / s, z / s}; }
-
-    Vec3& operator+=(const Vec3& rhs) { x += rhs.x; y += rhs.y; z += rhs.z; return *this; }
-    Vec3& operator-=(const Vec3& rhs) { x -= rhs.x; y -= rhs.y; z -= rhs.z; return *this; }
-    Vec3& operator*=(Real s) { x *= s; y *= s; z *= s; return *this; }
+/// 3-vector over scalar `T`; the engine uses `Vec3` (`BasicVec3<Real>`). Scalar arguments of the
+/// free operators are not deduced, so `0.5 * v` works for any `T`.
+template <typename T>
+struct BasicVec3 {
+    using Scalar = T;
+
+    T x = T(0);
+    T y = T(0);
+    T z = T(0);
+
+    BasicVec3() = default;
+    BasicVec3(T x_, T y_, T z_) : x(x_), y(y_), z(z_) {}
+
+    BasicVec3 operator+(const BasicVec3& rhs) const { return {x + rhs.x, y + rhs.y, z + rhs.z}; }
+    BasicVec3 operator-(const BasicVec3& rhs) const { return {x - rhs.x, y - rhs.y, z - rhs.z}; }
+    BasicVec3 operator-() const { return {-x, -y, -z}; }
+    BasicVec3 operator*(T s) const { return {x * s, y * s, z * s}; }
+    BasicVec3 operator/(T s) const { return {x / s, y / s, z / s}; }
+
+    BasicVec3& operator+=(const BasicVec3& rhs) { x += rhs.x; y += rhs.y; z += rhs.z; return *this; }
+    BasicVec3& operator-=(const BasicVec3& rhs) { x -= rhs.x; y -= rhs.y; z -= rhs.z; return *this; }
+    BasicVec3& operator*=(T s) { x *= s; y *= s; z *= s; return *this; }
 };
 
-inline Vec3 operator*(Real s, const Vec3& v) { return {v.x * s, v.y * s, v.z * s}; }
-inline Real Dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
-inline Vec3 Cross(const Vec3& a, const Vec3& b) { return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x}; }
-inline Real LengthSquared(const Vec3& v) { return Dot(v, v); }
-inline Real Length(const Vec3& v) { return std::sqrt(LengthSquared(v)); }
-inline bool TryNormalize(const Vec3& in, Vec3& out) {
-    const Real len = Length(in);
-    if (len <= kEpsilon) {
+using Vec3 = BasicVec3<Real>;
+
+/// Converts between precisions (e.g. a float-side LiDAR or wire buffer and `Vec3`).
+template <typename To, typename From>
+BasicVec3<To> CastVec3(const BasicVec3<From>& v) {
+    return {static_cast<To>(v.x), static_cast<To>(v.y), static_cast<To>(v.z)};
+}
+
+template <typename T>
+inline BasicVec3<T> operator*(typename BasicVec3<T>::Scalar s, const BasicVec3<T>& v) { return {v.x * s, v.y * s, v.z * s}; }
+template <typename T>
+inline T Dot(const BasicVec3<T>& a, const BasicVec3<T>& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+template <typename T>
+inline BasicVec3<T> Cross(const BasicVec3<T>& a, const BasicVec3<T>& b) {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+template <typename T>
+inline T LengthSquared(const BasicVec3<T>& v) { return Dot(v, v); }
+template <typename T>
+inline T Length(const BasicVec3<T>& v) { return std::sqrt(LengthSquared(v)); }
+template <typename T>
+inline bool TryNormalize(const BasicVec3<T>& in, BasicVec3<T>& out) {
+    const T len = Length(in);
+    if (len <= ScalarTraits<T>::kEpsilon) {
         out = {};
         return false;
     }
     out = in / len;
     return true;
 }
-inline Vec3 Normalize(const Vec3& v) {
-    Vec3 out{};
-    if (!TryNormalize(v, out)) return {1.0, 0.0, 0.0};
+template <typename T>
+inline BasicVec3<T> Normalize(const BasicVec3<T>& v) {
+    BasicVec3<T> out{};
+    if (!TryNormalize(v, out)) return {T(1), T(0), T(0)};
     return out;
 }
 
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "minphys3d/core/body.hpp"
+#include "minphys3d/core/world.hpp"
+#include "minphys3d/solver/types.hpp"
+
+namespace minphys3d::solver_internal {
+
+/// Greedy graph colouring of the contact / hinge / servo rows of one island. Rows of the same
+/// colour never share a dynamic body, so a colour can be solved in any order (or concurrently)
+/// with identical results. Contacts are coloured in `order.manifoldOrder`, so the support-depth
+/// / shock-propagation order decides which manifold claims the lower colour on a conflict.
+/// `bodyColorMaskScratch` is resized to `bodies.size()` and left all-zero on return.
+void ComputeIslandColoring(const Island& island,
+                           const IslandOrderResult& order,
+                           const std::vector<Body>& bodies,
+                           const std::vector<Manifold>& manifolds,
+                           const std::vector<HingeJoint>& hingeJoints,
+                           const std::vector<ServoJoint>& servoJoints,
+                           bool colorContacts,
+                           bool colorJoints,
+                           std::uint8_t maxColors,
+                           IslandColoring& out,
+                           std::vector<std::uint64_t>& bodyColorMaskScratch);
+
+} // namespace minphys3d::solver_internal
@@ -0,0 +1,301 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "minphys3d/math/mat3.hpp"
+#include "minphys3d/math/scalar.hpp"
+#include "minphys3d/math/vec3.hpp"
+
+namespace minphys3d::solver_internal {
+
+// Four-lane contact rows for `ContactRowKernel::Wide4`. A lane is one manifold of a colour batch,
+// so lanes never share a dynamic body and row `j` of a batch is "contact `j` of every lane".
+// Each kernel is one loop over the lanes whose body is the scalar row in the same operation
+// order, with the branches folded into selects; the loops vectorise (release builds keep FP
+// contraction off), and every lane ends bit-identical to the scalar path in the f64 and f32
+// builds. In the mixed build GCC's -O3 basic-block vectoriser compiles the scalar rows' mixed
+// float/double arithmetic differently, and the two paths agree only to a few float ulps.
+
+constexpr std::size_t kContactRowLanes = 4;
+
+struct alignas(32) RealLanes {
+    Real v[kContactRowLanes]{};
+
+    Real& operator[](std::size_t lane) { return v[lane]; }
+    const Real& operator[](std::size_t lane) const { return v[lane]; }
+};
+
+/// Impulse accumulators, kept in `SolverReal` like the `Contact` / manifold sums they mirror.
+struct alignas(32) SolverRealLanes {
+    SolverReal v[kContactRowLanes]{};
+
+    SolverReal& operator[](std::size_t lane) { return v[lane]; }
+    const SolverReal& operator[](std::size_t lane) const { return v[lane]; }
+};
+
+struct MaskLanes {
+    bool v[kContactRowLanes]{};
+
+    bool& operator[](std::size_t lane) { return v[lane]; }
+    const bool& operator[](std::size_t lane) const { return v[lane]; }
+};
+
+struct Vec3Lanes {
+    RealLanes x{};
+    RealLanes y{};
+    RealLanes z{};
+
+    Vec3 Get(std::size_t lane) const { return {x[lane], y[lane], z[lane]}; }
+    void Set(std::size_t lane, const Vec3& value) {
+        x[lane] = value.x;
+        y[lane] = value.y;
+        z[lane] = value.z;
+    }
+};
+
+struct Mat3Lanes {
+    RealLanes m[3][3]{};
+
+    Mat3 Get(std::size_t lane) const {
+        Mat3 out{};
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                out.m[i][j] = m[i][j][lane];
+            }
+        }
+        return out;
+    }
+    void Set(std::size_t lane, const Mat3& value) {
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                m[i][j][lane] = value.m[i][j];
+            }
+        }
+    }
+};
+
+/// Body pair of every lane, gathered once per batch and scattered back after its last row.
+struct ContactBodyLanes {
+    Vec3Lanes positionA{};
+    Vec3Lanes positionB{};
+    Vec3Lanes velocityA{};
+    Vec3Lanes velocityB{};
+    Vec3Lanes angularVelocityA{};
+    Vec3Lanes angularVelocityB{};
+    RealLanes invMassA{};
+    RealLanes invMassB{};
+    Mat3Lanes invInertiaA{};
+    Mat3Lanes invInertiaB{};
+    /// False for sleeping and static bodies, which `World::ApplyImpulse` never writes.
+    MaskLanes writableA{};
+    MaskLanes writableB{};
+};
+
+/// `World::ApplyImpulse` on every lane with `active` set.
+inline void ApplyImpulseLanes(ContactBodyLanes& bodies,
+                              const MaskLanes& active,
+                              const Vec3Lanes& ra,
+                              const Vec3Lanes& rb,
+                              const Vec3Lanes& impulse) {
+    for (std::size_t l = 0; l < kContactRowLanes; ++l) {
+        const Vec3 j = impulse.Get(l);
+        const bool writeA = active[l] && bodies.writableA[l];
+        const bool writeB = active[l] && bodies.writableB[l];
+        const Vec3 dvA = j * bodies.invMassA[l];
+        const Vec3 dwA = bodies.invInertiaA.Get(l) * Cross(ra.Get(l), j);
+        const Vec3 dvB = j * bodies.invMassB[l];
+        const Vec3 dwB = bodies.invInertiaB.Get(l) * Cross(rb.Get(l), j);
+        Vec3 vA = bodies.velocityA.Get(l);
+        Vec3 wA = bodies.angularVelocityA.Get(l);
+        Vec3 vB = bodies.velocityB.Get(l);
+        Vec3 wB = bodies.angularVelocityB.Get(l);
+        vA -= dvA;
+        wA -= dwA;
+        vB += dvB;
+        wB += dwB;
+        bodies.velocityA.Set(l, writeA ? vA : bodies.velocityA.Get(l));
+        bodies.angularVelocityA.Set(l, writeA ? wA : bodies.angularVelocityA.Get(l));
+        bodies.velocityB.Set(l, writeB ? vB : bodies.velocityB.Get(l));
+        bodies.angularVelocityB.Set(l, writeB ? wB : bodies.angularVelocityB.Get(l));
+    }
+}
+
+/// One normal row per lane. Everything that does not depend on the relative velocity (normal
+/// mass, penetration bias, soft-contact constants, split-impulse side effects) is evaluated per
+/// lane by `World` before the call; see `World::SolveNormalScalar` for the scalar form.
+struct NormalRowLanes {
+    Vec3Lanes normal{};
+    Vec3Lanes ra{};
+    Vec3Lanes rb{};
+    RealLanes normalMass{};
+    SolverRealLanes impulseSum{};
+    /// `clamp(min(restitutionA, restitutionB), 0, 1)`; applied only above the cutoff speed.
+    RealLanes restitution{};
+    /// Velocity bias applied while the separating velocity is at most `maxSafeSeparatingSpeed`.
+    RealLanes biasTerm{};
+    RealLanes maxSafeSeparatingSpeed{};
+    RealLanes softBias{};
+    RealLanes softenedMass{};
+    MaskLanes active{};
+    MaskLanes biasGated{};
+    MaskLanes softEligible{};
+};
+
+struct NormalRowParams {
+    Real restitutionCutoffSpeed = 0.0;
+    Real softContactMaxNormalSpeed = 0.0;
+};
+
+inline void SolveNormalRows(ContactBodyLanes& bodies, NormalRowLanes& rows, const NormalRowParams& params) {
+    Vec3Lanes impulse{};
+    for (std::size_t l = 0; l < kContactRowLanes; ++l) {
+        const Vec3 n = rows.normal.Get(l);
+        const Vec3 va = bodies.velocityA.Get(l) + Cross(bodies.angularVelocityA.Get(l), rows.ra.Get(l));
+        const Vec3 vb = bodies.velocityB.Get(l) + Cross(bodies.angularVelocityB.Get(l), rows.rb.Get(l));
+        const Real separatingVelocity = Dot(vb - va, n);
+        const Real speedIntoContact = -separatingVelocity;
+        const Real restitution =
+            (speedIntoContact <= 0.0 || speedIntoContact < params.restitutionCutoffSpeed) ? 0.0 : rows.restitution[l];
+        const Real normalMass = rows.normalMass[l];
+        const Real biasTerm =
+            (rows.biasGated[l] && separatingVelocity <= rows.maxSafeSeparatingSpeed[l]) ? rows.biasTerm[l] : 0.0;
+        const bool soft = rows.softEligible[l]
+            && std::abs(separatingVelocity) <= params.softContactMaxNormalSpeed
+            && separatingVelocity <= 0.0;
+
+        const Real lambdaSoft = (rows.softBias[l] - separatingVelocity) / std::max(rows.softenedMass[l], kEpsilon);
+        Real lambdaN = -(1.0 + restitution) * separatingVelocity / normalMass;
+        lambdaN = biasTerm > 0.0 ? lambdaN + biasTerm / normalMass : lambdaN;
+
+        const SolverReal oldImpulse = rows.impulseSum[l];
+        const SolverReal newImpulse = std::max<SolverReal>(0.0, oldImpulse + (soft ? lambdaSoft : lambdaN));
+        rows.impulseSum[l] = rows.active[l] ? newImpulse : oldImpulse;
+        const Real delta = newImpulse - oldImpulse;
+        impulse.Set(l, delta * n);
+    }
+    ApplyImpulseLanes(bodies, rows.active, rows.ra, rows.rb, impulse);
+}
+
+/// Per-lane manifold state of the friction pass: constants from the manifold prelude plus the
+/// running sums the scalar loop keeps in locals.
+struct FrictionManifoldLanes {
+    Vec3Lanes t0{};
+    Vec3Lanes t1{};
+    RealLanes mu{};
+    RealLanes budget{};
+    SolverRealLanes accumulatedTangent0{};
+    SolverRealLanes accumulatedTangent1{};
+    RealLanes slipSpeedSum{};
+    RealLanes slipSamples{};
+    MaskLanes stickBlend{};
+    MaskLanes useBudget{};
+};
+
+struct FrictionRowLanes {
+    Vec3Lanes point{};
+    SolverRealLanes tangentImpulse0{};
+    SolverRealLanes tangentImpulse1{};
+    SolverRealLanes normalImpulseSum{};
+    MaskLanes active{};
+    /// Output: rows that passed the tangent-mass check and wrote their impulses.
+    MaskLanes solved{};
+    /// Output: rows whose radial manifold budget clamp engaged.
+    MaskLanes budgetSaturated{};
+};
+
+struct FrictionRowParams {
+    bool twoAxis = true;
+    bool radialBudgetClamp = true;
+    /// `clamp(stickImpulseRetention, 0, 1)`.
+    Real stickRetention = 0.0;
+};
+
+inline void SolveFrictionRows(ContactBodyLanes& bodies,
+                              FrictionRowLanes& rows,
+                              FrictionManifoldLanes& manifolds,
+                              const FrictionRowParams& params) {
+    Vec3Lanes ra{};
+    Vec3Lanes rb{};
+    Vec3Lanes impulse{};
+    for (std::size_t l = 0; l < kContactRowLanes; ++l) {
+        const Vec3 point = rows.point.Get(l);
+        const Vec3 t0 = manifolds.t0.Get(l);
+        const Vec3 t1 = manifolds.t1.Get(l);
+        const Vec3 raL = point - bodies.positionA.Get(l);
+        const Vec3 rbL = point - bodies.positionB.Get(l);
+        ra.Set(l, raL);
+        rb.Set(l, rbL);
+
+        const Vec3 va = bodies.velocityA.Get(l) + Cross(bodies.angularVelocityA.Get(l), raL);
+        const Vec3 vb = bodies.velocityB.Get(l) + Cross(bodies.angularVelocityB.Get(l), rbL);
+        const Vec3 rv = vb - va;
+        const Real vt0 = Dot(rv, t0);
+        const Real vt1 = Dot(rv, t1);
+        const Real slipSpeed = std::sqrt(vt0 * vt0 + vt1 * vt1);
+        const bool active = rows.active[l];
+        manifolds.slipSpeedSum[l] = active ? manifolds.slipSpeedSum[l] + slipSpeed : manifolds.slipSpeedSum[l];
+        manifolds.slipSamples[l] = active ? manifolds.slipSamples[l] + 1.0 : manifolds.slipSamples[l];
+
+        const Mat3 invIA = bodies.invInertiaA.Get(l);
+        const Mat3 invIB = bodies.invInertiaB.Get(l);
+        const Vec3 raCrossT0 = Cross(raL, t0);
+        const Vec3 rbCrossT0 = Cross(rbL, t0);
+        const Vec3 raCrossT1 = Cross(raL, t1);
+        const Vec3 rbCrossT1 = Cross(rbL, t1);
+        const Real invMassSum = bodies.invMassA[l] + bodies.invMassB[l];
+        const Real tangentMass0 = invMassSum + Dot(raCrossT0, invIA * raCrossT0) + Dot(rbCrossT0, invIB * rbCrossT0);
+        const Real tangentMass1 = params.twoAxis
+            ? (invMassSum + Dot(raCrossT1, invIA * raCrossT1) + Dot(rbCrossT1, invIB * rbCrossT1))
+            : static_cast<Real>(std::numeric_limits<float>::infinity());
+        const bool solved = active && !(tangentMass0 <= kEpsilon || tangentMass1 <= kEpsilon);
+
+        const SolverReal old0 = rows.tangentImpulse0[l];
+        const SolverReal old1 = rows.tangentImpulse1[l];
+        SolverReal new0 = old0 - vt0 / tangentMass0;
+        SolverReal new1 = params.twoAxis ? old1 - vt1 / tangentMass1 : 0.0;
+        const bool stick = manifolds.stickBlend[l];
+        new0 = stick ? params.stickRetention * old0 + (1.0 - params.stickRetention) * new0 : new0;
+        new1 = stick ? params.stickRetention * old1 + (1.0 - params.stickRetention) * new1 : new1;
+
+        const Real mu = manifolds.mu[l];
+        const Real perContactLimit = mu * std::max<Real>(rows.normalImpulseSum[l], 0.0);
+        const Real contactLenSq = new0 * new0 + new1 * new1;
+        const bool clampContact = contactLenSq > perContactLimit * perContactLimit && perContactLimit > kEpsilon;
+        const bool zeroContact = !clampContact && perContactLimit <= kEpsilon;
+        const Real contactScale = perContactLimit / std::sqrt(contactLenSq);
+        new0 = clampContact ? new0 * contactScale : (zeroContact ? 0.0 : new0);
+        new1 = clampContact ? new1 * contactScale : (zeroContact ? 0.0 : new1);
+
+        const Real budget = manifolds.budget[l];
+        const SolverReal candidate0 = manifolds.accumulatedTangent0[l] - old0 + new0;
+        const SolverReal candidate1 = manifolds.accumulatedTangent1[l] - old1 + new1;
+        const Real lenSq = candidate0 * candidate0 + candidate1 * candidate1;
+        const bool useBudget = manifolds.useBudget[l];
+        const bool saturated = useBudget && params.radialBudgetClamp && lenSq > budget * budget && budget > kEpsilon;
+        const bool boxClamp = useBudget && !params.radialBudgetClamp;
+        const Real budgetScale = budget / std::sqrt(lenSq);
+        new0 = saturated ? old0 + (new0 - old0) * budgetScale
+                         : (boxClamp ? std::clamp<SolverReal>(new0, -budget, budget) : new0);
+        new1 = saturated ? old1 + (new1 - old1) * budgetScale
+                         : (boxClamp ? std::clamp<SolverReal>(new1, -budget, budget) : new1);
+
+        rows.tangentImpulse0[l] = solved ? new0 : old0;
+        rows.tangentImpulse1[l] = solved ? new1 : old1;
+        rows.solved[l] = solved;
+        rows.budgetSaturated[l] = solved && saturated;
+        const Real lambdaT0 = new0 - old0;
+        const Real lambdaT1 = new1 - old1;
+        impulse.Set(l, lambdaT0 * t0 + lambdaT1 * t1);
+        manifolds.accumulatedTangent0[l] =
+            solved ? manifolds.accumulatedTangent0[l] + lambdaT0 : manifolds.accumulatedTangent0[l];
+        manifolds.accumulatedTangent1[l] =
+            solved ? manifolds.accumulatedTangent1[l] + lambdaT1 : manifolds.accumulatedTangent1[l];
+    }
+    ApplyImpulseLanes(bodies, rows.solved, ra, rb, impulse);
+}
+
+} // namespace minphys3d::solver_internal
@@ -1,9 +1,10 @@
 #pragma once
 
 #include <array>
+#include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
-#include <unordered_map>
 #include <vector>
 
 #include "minphys3d/math/vec3.hpp"
@@ -48,6 +49,72 @@ struct OrderingConfig {
     std::uint8_t support_depth_relaxation_passes = 4;
 };
 
+/// Graph-coloured PGS inside an island: rows are grouped into colours that share no dynamic body
+/// and each colour is swept as one batch, split across the World worker pool
+/// (`World::ParallelSolveConfig::threadCount`). Changes the Gauss-Seidel row order relative to the
+/// default sweep, but the result depends only on the colouring, never on the thread count.
+struct GraphColoringConfig {
+    /// Colour contact manifolds (JointSolverConfig::useGraphColoring covers hinge/servo rows).
+    bool enabled = false;
+    /// Islands with fewer coloured rows than this keep the plain sequential sweep.
+    std::uint32_t minIslandRows = 16;
+    /// Colours with fewer rows than this many per thread are solved on the calling thread.
+    std::uint32_t minRowsPerThread = 4;
+    /// Colour budget (1..64); rows that find no free colour go to a trailing sequential batch.
+    std::uint8_t maxColors = 32;
+};
+
+/// Residual-driven early exit for the PGS velocity iterations. After every pass each island
+/// measures the largest impulse any of its bodies received during that pass (m·|Δv| and
+/// |I·Δω|); an island whose impulse deltas drop below the tolerances is retired and skips the
+/// remaining passes of the substep. Joint position error cannot change inside the velocity loop,
+/// so it is measured once per substep: an island with a joint position error (anchor gap,
+/// distance joint length error, prismatic off-axis offset or limit overshoot) above
+/// `jointPositionTolerance` keeps iterating to the cap. Off by default (fixed iteration count).
+struct SolverConvergenceConfig {
+    bool enabled = false;
+    /// Passes every island runs before it may retire.
+    std::uint16_t minIterations = 4;
+    /// Upper bound on passes per substep; 0 uses the `solverIterations` passed to `World::Step`.
+    std::uint16_t maxIterations = 0;
+    /// Largest per-body linear impulse change (N·s) of one pass that still counts as converged.
+    /// Looser values cut touchdown substeps of the hexapod short enough to change its landing.
+    Real linearImpulseTolerance = 1.0e-5;
+    /// Largest per-body angular impulse change (N·m·s) of one pass that still counts as converged.
+    Real angularImpulseTolerance = 1.0e-6;
+    /// Largest joint position error (m) of an island that may retire early.
+    Real jointPositionTolerance = 1.0e-3;
+};
+
+/// Substep contact reuse. A substep may skip the broadphase update, narrowphase and manifold
+/// build and keep the manifolds of the last build when no body has moved more than
+/// `maxBodyMotion` since then (translation plus rotation times the body's bounding radius).
+/// Each kept contact is re-projected from its body-local anchors: the point moves with the
+/// bodies and the penetration is re-measured along the manifold normal
+/// (`World::TryComputeAnchorSeparation`); its accumulated impulses are the warm start. A build
+/// is forced after `maxConsecutiveReuses` reused substeps, whether or not they fall in the same
+/// `Step`, and whenever a body or joint is added, a body changes sleep state or the terrain is
+/// set. Changing a body's shape through `World::GetBody` is only picked up at the next build.
+/// Off by default.
+struct SubstepContactReuseConfig {
+    bool enabled = false;
+    /// Largest motion (m) of any body since the last build that still reuses its contacts.
+    /// Two bodies can close a gap by twice this before a new contact appears.
+    Real maxBodyMotion = 0.002;
+    std::uint16_t maxConsecutiveReuses = 3;
+};
+
+/// Kernel for the contact rows of coloured manifold batches.
+enum class ContactRowKernel : std::uint8_t {
+    /// One manifold at a time (the reference path).
+    Scalar = 0,
+    /// Up to four manifolds of one colour are packed into lanes and their normal and friction
+    /// rows are stepped together; results match `Scalar` bit for bit (to rounding in the mixed
+    /// precision build). Needs coloured islands (`GraphColoringConfig::enabled`); uncoloured
+    /// sweeps always use `Scalar`.
+    Wide4 = 1,
+};
+
 struct ContactSolverConfig {
     Real bounceVelocityThreshold = 0.0;
     Real restitutionSuppressionSpeed = 0.0;
@@ -99,6 +166,10 @@ struct ContactSolverConfig {
     ToiSolverConfig toi{};
     Block4MatrixConfig block4{};
     OrderingConfig ordering{};
+    GraphColoringConfig coloring{};
+    ContactRowKernel rowKernel = ContactRowKernel::Scalar;
+    SolverConvergenceConfig convergence{};
+    SubstepContactReuseConfig substepContactReuse{};
 
     // Staged rollout controls for manifold-level 2D friction budgeting.
     bool enableTwoAxisFrictionSolve = true;
@@ -185,9 +256,24 @@ struct JointSolverConfig {
     /// decoupled formulation and the diagnostic suite (stand quiescence, substep convergence)
     /// confirms equivalence or improvement.
     bool enableServoStiffnessDampingDecoupling = false;
+
+    /// Solve hinge and servo rows colour-by-colour (see `GraphColoringConfig`; the colour budget
+    /// and batch thresholds are shared with `ContactSolverConfig::coloring`).
+    bool useGraphColoring = false;
+};
+
+/// Potential-pair generator. The dynamic tree is maintained either way (ray and scene queries
+/// walk it); the backend only decides how `World` finds overlapping fat boxes.
+enum class BroadphaseBackend : std::uint8_t {
+    /// Per-proxy tree queries, with the quasi-static pair cache and moved-set-only traversal.
+    DynamicTree = 0,
+    /// Incremental sort-and-sweep on the axis with the largest spread of proxy centres. Suited to
+    /// many nearly static bodies laid out on a grid; every query sweeps all proxies.
+    SweepAndPrune = 1,
 };
 
 struct BroadphaseConfig {
+    BroadphaseBackend backend = BroadphaseBackend::DynamicTree;
     Real baseFatAabbMargin = 0.1;
     Real linearVelocityMarginScale = 1.0;
     Real angularVelocityMarginScale = 0.5;
@@ -204,6 +290,9 @@ struct BroadphaseConfig {
     Real fullRebuildQueryNodeVisitsPerProxyThreshold = 256.0;
     bool enableMovedSetOnlyUpdates = true;
     bool enablePairCacheReuseForQuasiStatic = true;
+    /// Telemetry builds only: assert every pair query against the O(N^2) brute-force pair list.
+    /// Benchmarks at large body counts turn this off.
+    bool validatePairsAgainstBruteForce = true;
 
     std::uint32_t minStepsBetweenRebuilds = 8;
 };
@@ -217,6 +306,9 @@ struct BroadphaseMetrics {
     Real pairGenerationMs = 0.0;
     Real pairCacheHitRate = 0.0;
     std::uint32_t queryNodeVisits = 0;
+    /// Sweep-and-prune only: pairs whose sweep-axis intervals overlapped and were tested on the
+    /// other two axes.
+    std::uint32_t sweepCandidates = 0;
     std::uint32_t pairCacheQueries = 0;
     std::uint32_t pairCacheHits = 0;
     std::uint32_t validProxyCount = 0;
@@ -231,11 +323,11 @@ struct Contact {
     Vec3 normal{};
     Vec3 point{};
     Real penetration = 0.0;
-    Real normalImpulseSum = 0.0;
+    SolverReal normalImpulseSum = 0.0;
     // Legacy scalar tangent accumulator retained for compatibility/migration.
-    Real tangentImpulseSum = 0.0;
-    Real tangentImpulseSum0 = 0.0;
-    Real tangentImpulseSum1 = 0.0;
+    SolverReal tangentImpulseSum = 0.0;
+    SolverReal tangentImpulseSum0 = 0.0;
+    SolverReal tangentImpulseSum1 = 0.0;
     std::uint8_t manifoldType = 0;
     std::uint64_t key = 0;
     std::uint64_t featureKey = 0;
@@ -246,13 +338,137 @@ struct Contact {
     bool anchorsValid = false;
 };
 
+/// Contact points a manifold keeps once `World::ManifoldManager` has merged and reduced them.
+inline constexpr std::size_t kMaxManifoldContacts = 4;
+
+/// A manifold's contacts: `size()` consecutive entries, starting at `offset()`, of a per-frame
+/// contact pool owned by the World. Reads and iteration mirror `std::vector<Contact>`, but the
+/// slice owns no storage: copying a Manifold copies a pointer and two indices, and the slice
+/// stays valid until its pool is refilled (the World swaps current and previous pools rather
+/// than copying them, which keeps both pools' elements in place). Whatever copies a pool must
+/// `Bind` its slices again; `core_internal::ManifoldStore` does this when a World is copied.
+class ManifoldContacts {
+public:
+    using value_type = Contact;
+    using size_type = std::size_t;
+    using iterator = Contact*;
+    using const_iterator = const Contact*;
+
+    void Bind(Contact* pool, std::uint32_t offset, std::uint32_t count) {
+        data_ = pool + offset;
+        offset_ = offset;
+        count_ = count;
+    }
+    std::uint32_t offset() const { return offset_; }
+
+    std::size_t size() const { return count_; }
+    bool empty() const { return count_ == 0u; }
+    Contact* data() { return data_; }
+    const Contact* data() const { return data_; }
+    Contact* begin() { return data_; }
+    Contact* end() { return data_ + count_; }
+    const Contact* begin() const { return data_; }
+    const Contact* end() const { return data_ + count_; }
+    Contact& operator[](std::size_t i) {
+        assert(i < count_);
+        return data_[i];
+    }
+    const Contact& operator[](std::size_t i) const {
+        assert(i < count_);
+        return data_[i];
+    }
+    Contact& front() { return (*this)[0]; }
+    Contact& back() { return (*this)[count_ - 1u]; }
+    const Contact& front() const { return (*this)[0]; }
+    const Contact& back() const { return (*this)[count_ - 1u]; }
+
+    /// Shrinks the slice; pool entries past the new end are left untouched.
+    void resize(std::size_t count) {
+        assert(count <= count_);
+        count_ = static_cast<std::uint32_t>(count);
+    }
+    void clear() { count_ = 0u; }
+
+private:
+    Contact* data_ = nullptr;
+    std::uint32_t offset_ = 0;
+    std::uint32_t count_ = 0;
+};
+
+/// Per-contact impulse state [normal, tangent0, tangent1] keyed by contact key, stored inline.
+/// Between builds it holds at most the manifold's own contact keys; while a build refreshes it,
+/// the inherited keys and the new ones coexist until stale keys are dropped, hence twice
+/// `kMaxManifoldContacts`.
+class ContactImpulseCache {
+public:
+    static constexpr std::size_t kCapacity = 2u * kMaxManifoldContacts;
+
+    std::array<Real, 3>* Find(std::uint64_t key) {
+        for (std::uint32_t i = 0; i < count_; ++i) {
+            if (keys_[i] == key) {
+                return &impulses_[i];
+            }
+        }
+        return nullptr;
+    }
+    const std::array<Real, 3>* Find(std::uint64_t key) const {
+        return const_cast<ContactImpulseCache*>(this)->Find(key);
+    }
+
+    /// Entry for `key`, zero-initialised when new (like `unordered_map::operator[]`). A full
+    /// cache drops its oldest entry to make room.
+    std::array<Real, 3>& Ensure(std::uint64_t key) {
+        if (std::array<Real, 3>* existing = Find(key)) {
+            return *existing;
+        }
+        assert(count_ < kCapacity);
+        if (count_ == kCapacity) {
+            Erase(0u);
+        }
+        keys_[count_] = key;
+        impulses_[count_] = {0.0, 0.0, 0.0};
+        return impulses_[count_++];
+    }
+
+    /// Drops every entry whose key fails `keep(key)`, preserving the order of the rest.
+    template <typename Keep>
+    void RetainIf(Keep keep) {
+        std::uint32_t kept = 0;
+        for (std::uint32_t i = 0; i < count_; ++i) {
+            if (keep(keys_[i])) {
+                keys_[kept] = keys_[i];
+                impulses_[kept] = impulses_[i];
+                ++kept;
+            }
+        }
+        count_ = kept;
+    }
+
+    std::size_t size() const { return count_; }
+    bool empty() const { return count_ == 0u; }
+    void clear() { count_ = 0u; }
+
+private:
+    void Erase(std::uint32_t index) {
+        for (std::uint32_t i = index + 1u; i < count_; ++i) {
+            keys_[i - 1u] = keys_[i];
+            impulses_[i - 1u] = impulses_[i];
+        }
+        --count_;
+    }
+
+    std::array<std::uint64_t, kCapacity> keys_{};
+    std::array<std::array<Real, 3>, kCapacity> impulses_{};
+    std::uint32_t count_ = 0;
+};
+
 struct Manifold {
     std::uint32_t a = 0;
     std::uint32_t b = 0;
     Vec3 normal{};
     std::uint8_t manifoldType = 0;
-    std::vector<Contact> contacts;
-    std::array<Real, 2> blockNormalImpulseSum{0.0, 0.0};
+    ManifoldContacts contacts;
+    std::array<SolverReal, 2> blockNormalImpulseSum{0.0, 0.0};
     std::array<std::uint64_t, 2> blockContactKeys{0u, 0u};
     std::array<bool, 2> blockSlotValid{false, false};
     std::array<int, 2> selectedBlockContactIndices{-1, -1};
@@ -260,12 +476,11 @@ struct Manifold {
     Vec3 t0{};
     Vec3 t1{};
     bool tangentBasisValid = false;
-    std::array<Real, 2> manifoldTangentImpulseSum{0.0, 0.0};
+    std::array<SolverReal, 2> manifoldTangentImpulseSum{0.0, 0.0};
     bool manifoldTangentImpulseValid = false;
     bool stickConstraintActive = false;
     std::uint16_t stickConstraintAge = 0;
-    // Cached per-contact impulse state: [normal, tangent0, tangent1].
-    std::unordered_map<std::uint64_t, std::array<Real, 3>> cachedImpulseByContactKey{};
+    ContactImpulseCache cachedImpulseByContactKey{};
     bool selectedBlockPairPersistent = false;
     bool selectedBlockPairQualityPass = false;
     bool lowQuality = false;
@@ -273,8 +488,8 @@ struct Manifold {
     bool usedBlockSolve = false;
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
     struct BlockSolveDebugCounters {
-        std::array<Real, 2> selectedPreNormalImpulses{0.0, 0.0};
-        std::array<Real, 2> selectedPostNormalImpulses{0.0, 0.0};
+        std::array<SolverReal, 2> selectedPreNormalImpulses{0.0, 0.0};
+        std::array<SolverReal, 2> selectedPostNormalImpulses{0.0, 0.0};
         Real selectedPairPenetrationStep = 0.0;
         std::uint32_t blockSolveUsedCount = 0;
         std::uint32_t scalarFallbackIneligibleCount = 0;
@@ -313,6 +528,25 @@ struct IslandOrderResult {
     bool supportDepthApplied = false;
 };
 
+/// Rows of one constraint kind grouped by colour: colour `c` is
+/// `indices[colorOffsets[c] .. colorOffsets[c + 1])`. Empty when the kind is not coloured.
+struct ConstraintColoring {
+    std::vector<std::size_t> indices;
+    std::vector<std::uint32_t> colorOffsets;
+    /// The last colour holds rows that overflowed the colour budget and must run sequentially.
+    bool lastColorSequential = false;
+
+    [[nodiscard]] std::size_t ColorCount() const {
+        return colorOffsets.empty() ? 0u : colorOffsets.size() - 1u;
+    }
+};
+
+struct IslandColoring {
+    ConstraintColoring manifolds;
+    ConstraintColoring hinges;
+    ConstraintColoring servos;
+};
+
 
 inline bool ValidateContactSolverConfig(const ContactSolverConfig& config) {
     constexpr Real kMinSaneToiStep = 1e-9;
@@ -325,6 +559,9 @@ inline bool ValidateContactSolverConfig(const ContactSolverConfig& config) {
     if (!std::isfinite(config.block4.symmetry_tolerance) || config.block4.symmetry_tolerance < 0.0) {
         return false;
     }
+    if (config.coloring.maxColors < 1 || config.coloring.maxColors > 64) {
+        return false;
+    }
     return true;
 }
 
@@ -341,6 +578,24 @@ inline ContactSolverConfig SanitizeContactSolverConfig(const ContactSolverConfig
     if (!std::isfinite(sanitized.block4.symmetry_tolerance) || sanitized.block4.symmetry_tolerance < 0.0) {
         sanitized.block4.symmetry_tolerance = defaults.block4.symmetry_tolerance;
     }
+    if (sanitized.coloring.maxColors < 1 || sanitized.coloring.maxColors > 64) {
+        sanitized.coloring.maxColors = defaults.coloring.maxColors;
+    }
+    if (sanitized.convergence.minIterations < 1) {
+        sanitized.convergence.minIterations = 1;
+    }
+    if (!std::isfinite(sanitized.convergence.linearImpulseTolerance)
+        || sanitized.convergence.linearImpulseTolerance < 0.0) {
+        sanitized.convergence.linearImpulseTolerance = defaults.convergence.linearImpulseTolerance;
+    }
+    if (!std::isfinite(sanitized.convergence.angularImpulseTolerance)
+        || sanitized.convergence.angularImpulseTolerance < 0.0) {
+        sanitized.convergence.angularImpulseTolerance = defaults.convergence.angularImpulseTolerance;
+    }
+    if (!std::isfinite(sanitized.convergence.jointPositionTolerance)
+        || sanitized.convergence.jointPositionTolerance < 0.0) {
+        sanitized.convergence.jointPositionTolerance = defaults.convergence.jointPositionTolerance;
+    }
 
     return sanitized;
 }
@@ -0,0 +1,151 @@
+// Dynamic tree vs sweep-and-prune pair generation (`BroadphaseConfig::backend`).
+//  1. The example scenes under assets/scenes/examples/ (small; shows per-query overhead).
+//  2. A procedural rubble field: a ground plane, a 60x60 grid of static terrain blocks and
+//     1,400 dynamic boxes and capsules dropped onto it (5,001 bodies). No spheres: sphere TOI
+//     sweeps test every body and would dominate the step.
+// Each scene is built once per backend and stepped for the same number of steps. Reported per
+// backend: pairs per query, mean pair-generation time, mean `World::Step` time. Both backends
+// must return the same pair count every step; the bench exits non-zero if they diverge.
+#include "demo/scene_json.hpp"
+#include "minphys3d/core/world.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace minphys3d;
+using BenchClock = std::chrono::steady_clock;
+
+constexpr Real kStepDt = 1.0 / 120.0;
+
+struct BackendRun {
+    double pairsPerQuery = 0.0;
+    double meanPairGenerationUs = 0.0;
+    double meanStepUs = 0.0;
+    std::vector<std::size_t> pairCounts;
+};
+
+void UseBackend(World& world, BroadphaseBackend backend) {
+    BroadphaseConfig config = world.GetBroadphaseConfig();
+    config.backend = backend;
+    config.validatePairsAgainstBruteForce = false;
+    world.SetBroadphaseConfig(config);
+}
+
+BackendRun RunBackend(const std::function<bool(World&, int&)>& build,
+                      BroadphaseBackend backend,
+                      int warmupSteps,
+                      int measuredSteps) {
+    World world{Vec3{0.0, -9.81, 0.0}};
+    int iterations = 8;
+    if (!build(world, iterations)) {
+        std::exit(EXIT_FAILURE);
+    }
+    UseBackend(world, backend);
+    for (int i = 0; i < warmupSteps; ++i) {
+        world.Step(kStepDt, iterations);
+    }
+    BackendRun run{};
+    double stepSeconds = 0.0;
+    double pairMs = 0.0;
+    double pairs = 0.0;
+    for (int i = 0; i < measuredSteps; ++i) {
+        const auto start = BenchClock::now();
+        world.Step(kStepDt, iterations);
+        stepSeconds += std::chrono::duration<double>(BenchClock::now() - start).count();
+        pairMs += static_cast<double>(world.GetBroadphaseMetrics().pairGenerationMs);
+        const std::size_t pairCount = world.BroadphasePairCount();
+        pairs += static_cast<double>(pairCount);
+        run.pairCounts.push_back(pairCount);
+    }
+    run.pairsPerQuery = pairs / measuredSteps;
+    run.meanPairGenerationUs = pairMs * 1.0e3 / measuredSteps;
+    run.meanStepUs = stepSeconds * 1.0e6 / measuredSteps;
+    return run;
+}
+
+bool BuildRubbleField(World& world, int& iterations) {
+    iterations = 8;
+    Body ground{};
+    ground.shape = ShapeType::Plane;
+    ground.isStatic = true;
+    world.CreateBody(ground);
+
+    constexpr int kGrid = 60;
+    constexpr Real kCell = 0.5;
+    std::mt19937 rng(2024u);
+    std::uniform_real_distribution<Real> unit(0.0, 1.0);
+    for (int i = 0; i < kGrid * kGrid; ++i) {
+        Body block{};
+        block.shape = ShapeType::Box;
+        block.isStatic = true;
+        block.halfExtents = {0.24, 0.05 + 0.15 * unit(rng), 0.24};
+        block.position = {kCell * static_cast<Real>(i % kGrid), block.halfExtents.y, kCell * static_cast<Real>(i / kGrid)};
+        world.CreateBody(block);
+    }
+    for (int i = 0; i < 1400; ++i) {
+        Body rubble{};
+        rubble.shape = i % 3 == 1 ? ShapeType::Capsule : ShapeType::Box;
+        rubble.radius = 0.06 + 0.04 * unit(rng);
+        rubble.halfHeight = 0.08;
+        rubble.halfExtents = {0.05 + 0.05 * unit(rng), 0.05 + 0.03 * unit(rng), 0.05 + 0.05 * unit(rng)};
+        rubble.position = {kCell * kGrid * unit(rng), 0.5 + 0.8 * unit(rng), kCell * kGrid * unit(rng)};
+        rubble.orientation = Normalize(Quat{1.0, unit(rng) - 0.5, unit(rng) - 0.5, unit(rng) - 0.5});
+        world.CreateBody(rubble);
+    }
+    return true;
+}
+
+bool Compare(const char* label, const std::function<bool(World&, int&)>& build, int warmupSteps, int measuredSteps) {
+    const BackendRun tree = RunBackend(build, BroadphaseBackend::DynamicTree, warmupSteps, measuredSteps);
+    const BackendRun sap = RunBackend(build, BroadphaseBackend::SweepAndPrune, warmupSteps, measuredSteps);
+    std::printf("%s\n", label);
+    std::printf("  %-16s pairs=%9.1f  pair_gen_us=%9.1f  step_us=%10.1f\n",
+                "dynamic tree", tree.pairsPerQuery, tree.meanPairGenerationUs, tree.meanStepUs);
+    std::printf("  %-16s pairs=%9.1f  pair_gen_us=%9.1f  step_us=%10.1f  pair_gen_speedup=%.2fx\n",
+                "sweep-and-prune",
+                sap.pairsPerQuery,
+                sap.meanPairGenerationUs,
+                sap.meanStepUs,
+                sap.meanPairGenerationUs > 0.0 ? tree.meanPairGenerationUs / sap.meanPairGenerationUs : 0.0);
+    if (tree.pairCounts != sap.pairCounts) {
+        std::printf("  MISMATCH: backends produced different pair counts\n");
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    const char* examples[] = {
+        "assets/scenes/examples/stack_minimal.json",
+        "assets/scenes/examples/joints_distance.json",
+        "assets/scenes/examples/compound_preview.json",
+    };
+    bool ok = true;
+    for (const char* path : examples) {
+        const std::string scenePath = path;
+        ok = Compare(path,
+                     [&scenePath](World& world, int& iterations) {
+                         std::string error;
+                         if (!demo::AppendWorldFromMinphysSceneJsonFile(scenePath, world, iterations, error)) {
+                             std::fprintf(stderr, "%s: %s\n", scenePath.c_str(), error.c_str());
+                             return false;
+                         }
+                         return true;
+                     },
+                     30,
+                     600)
+            && ok;
+    }
+    ok = Compare("rubble field (5001 bodies)", BuildRubbleField, 60, 120) && ok;
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
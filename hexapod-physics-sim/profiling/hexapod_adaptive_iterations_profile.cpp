@@ -0,0 +1,158 @@
+#include "demo/frame_sink.cpp"
+#include "demo/scenes.cpp"
+// Fixed vs. residual-driven PGS iteration count (`ContactSolverConfig::convergence`) on the
+// hexapod pose-hold stability scene. Reports substep wall time, the velocity passes actually run
+// per substep and the pose-hold metrics of `test_hexapod_live_pose_hold`, so a tolerance change
+// can be judged on both speed and stability. `--iterations N` sets the cap for both runs.
+#include "demo/scenes.hpp"
+#include "minphys3d/core/world.hpp"
+#include "minphys3d/demo/hexapod_stability.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+namespace {
+
+using namespace minphys3d;
+using namespace minphys3d::demo;
+using BenchClock = std::chrono::steady_clock;
+
+struct ProfileOptions {
+    int frames = 240;
+    int rounds = 3;
+    int iterations = kHexapodPoseHoldBenchmarkSolverIterations;
+    int minIterations = 4;
+    Real linearTolerance = SolverConvergenceConfig{}.linearImpulseTolerance;
+    Real angularTolerance = SolverConvergenceConfig{}.angularImpulseTolerance;
+    Real jointTolerance = SolverConvergenceConfig{}.jointPositionTolerance;
+};
+
+struct ProfileResult {
+    double substepMs = 0.0;
+    double iterationsPerSubstep = 0.0;
+    std::uint32_t minSubstepIterations = 0;
+    /// Island passes solved / islands x cap.
+    double islandPassFraction = 0.0;
+    HexapodPoseHoldMetrics metrics{};
+};
+
+ProfileResult RunProfile(const ProfileOptions& options, bool adaptive) {
+    World world(Vec3{0.0, -9.81, 0.0});
+    const HexapodSceneObjects scene = BuildHexapodScene(world);
+    RelaxBuiltInHexapodServos(world, scene);
+    ApplyHexapodPoseHoldStabilityTuning(world, scene);
+    if (adaptive) {
+        ContactSolverConfig config = world.GetContactSolverConfig();
+        config.convergence.enabled = true;
+        config.convergence.minIterations = static_cast<std::uint16_t>(options.minIterations);
+        config.convergence.linearImpulseTolerance = options.linearTolerance;
+        config.convergence.angularImpulseTolerance = options.angularTolerance;
+        config.convergence.jointPositionTolerance = options.jointTolerance;
+        world.SetContactSolverConfig(config);
+    }
+
+    constexpr Real kFrameDt = 1.0 / 60.0;
+    const int kSubsteps = kHexapodPoseHoldBenchmarkSubstepsPerFrame;
+    const Real subDt = kFrameDt / static_cast<Real>(kSubsteps);
+    ProfileResult result{};
+    result.minSubstepIterations = static_cast<std::uint32_t>(options.iterations);
+    std::uint64_t iterations = 0;
+    std::uint64_t substeps = 0;
+    std::uint64_t islandPasses = 0;
+    std::uint64_t islandPassCap = 0;
+    BenchClock::duration stepTime{};
+    for (int frame = 0; frame < options.frames; ++frame) {
+        for (int sub = 0; sub < kSubsteps; ++sub) {
+            const auto t0 = BenchClock::now();
+            world.Step(subDt, options.iterations);
+            stepTime += BenchClock::now() - t0;
+            const World::SolverIterationStats& stats = world.GetSolverIterationStats();
+            iterations += stats.lastStepIterations;
+            substeps += stats.lastStepSubsteps;
+            islandPasses += stats.lastStepIslandIterations;
+            islandPassCap += stats.lastStepIslandIterationCap;
+            result.minSubstepIterations = std::min(result.minSubstepIterations, stats.lastStepMaxSubstepIterations);
+            AccumulateHexapodPoseHoldFromSubstep(world, scene, scene.body, frame, result.metrics);
+        }
+    }
+    FinalizeHexapodPoseHold(world.GetBody(scene.body), result.metrics);
+    const double steps = static_cast<double>(options.frames * kSubsteps);
+    result.substepMs = std::chrono::duration<double, std::milli>(stepTime).count() / steps;
+    result.iterationsPerSubstep = static_cast<double>(iterations) / static_cast<double>(std::max<std::uint64_t>(substeps, 1));
+    result.islandPassFraction =
+        islandPassCap > 0 ? static_cast<double>(islandPasses) / static_cast<double>(islandPassCap) : 0.0;
+    return result;
+}
+
+void PrintResult(const char* label, int round, const ProfileResult& r) {
+    std::printf("%-8s round=%d  substep_ms=%8.4f  iters/substep=%6.2f  min_iters=%2u  island_passes=%5.1f%%  "
+                "peak_lin=%.4f  peak_lin_settled=%.4f  peak_ang=%.4f  peak_err=%.4f  final_speed=%.5f  "
+                "final_y=%.5f\n",
+                label,
+                round,
+                r.substepMs,
+                r.iterationsPerSubstep,
+                r.minSubstepIterations,
+                100.0 * r.islandPassFraction,
+                static_cast<double>(r.metrics.peakLinear),
+                static_cast<double>(r.metrics.peakLinearSettled),
+                static_cast<double>(r.metrics.peakAngular),
+                static_cast<double>(r.metrics.peakJointErrorRad),
+                static_cast<double>(r.metrics.finalSpeed),
+                static_cast<double>(r.metrics.finalPosition.y));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    ProfileOptions options{};
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) {
+            options.frames = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--rounds" && i + 1 < argc) {
+            options.rounds = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--iterations" && i + 1 < argc) {
+            options.iterations = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--min-iterations" && i + 1 < argc) {
+            options.minIterations = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--linear-tol" && i + 1 < argc) {
+            options.linearTolerance = std::atof(argv[++i]);
+        } else if (arg == "--angular-tol" && i + 1 < argc) {
+            options.angularTolerance = std::atof(argv[++i]);
+        } else if (arg == "--joint-tol" && i + 1 < argc) {
+            options.jointTolerance = std::atof(argv[++i]);
+        } else {
+            std::cerr << "usage: hexapod_adaptive_iterations_profile [--frames N] [--rounds N] [--iterations N]\n"
+                         "       [--min-iterations N] [--linear-tol N*s] [--angular-tol N*m*s] [--joint-tol m]\n";
+            return 2;
+        }
+    }
+
+    std::cout << "workload: hexapod pose hold " << options.frames << " frames @ 60Hz outer, "
+              << kHexapodPoseHoldBenchmarkSubstepsPerFrame << " substeps, cap " << options.iterations
+              << " solver iters/substep; adaptive min " << options.minIterations << ", tol lin "
+              << options.linearTolerance << " ang " << options.angularTolerance << " joint "
+              << options.jointTolerance << "\n";
+
+    double bestFixedMs = 1e300;
+    double bestAdaptiveMs = 1e300;
+    for (int round = 0; round < options.rounds; ++round) {
+        const ProfileResult fixed = RunProfile(options, false);
+        const ProfileResult adaptive = RunProfile(options, true);
+        bestFixedMs = std::min(bestFixedMs, fixed.substepMs);
+        bestAdaptiveMs = std::min(bestAdaptiveMs, adaptive.substepMs);
+        PrintResult("fixed", round, fixed);
+        PrintResult("adaptive", round, adaptive);
+    }
+    std::printf("best  fixed_ms=%8.4f  adaptive_ms=%8.4f  speedup=%.3fx\n",
+                bestFixedMs,
+                bestAdaptiveMs,
+                bestFixedMs / bestAdaptiveMs);
+    return 0;
+}
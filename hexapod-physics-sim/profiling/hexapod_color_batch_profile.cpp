@@ -0,0 +1,116 @@
+#include "demo/frame_sink.cpp"
+#include "demo/scenes.cpp"
+// Substep wall time vs graph-colour count on the hexapod pose-hold stability scene.
+// Runs the plain sequential sweep, then graph-coloured PGS (contacts + hinge/servo rows) over a
+// sweep of colour budgets, each at 1 solver thread and at `--threads N`.
+#include "demo/scenes.hpp"
+#include "minphys3d/core/world.hpp"
+#include "minphys3d/demo/hexapod_stability.hpp"
+#include "minphys3d/solver/types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include <thread>
+
+namespace {
+
+using namespace minphys3d;
+using namespace minphys3d::demo;
+
+struct ProfileResult {
+    double substepMs = 0.0;
+    std::uint32_t contactColors = 0;
+    std::uint32_t jointColors = 0;
+    Real chassisHeight = 0.0;
+};
+
+ProfileResult RunProfile(bool colored, std::uint8_t maxColors, std::uint32_t threads, int frames) {
+    World world(Vec3{0.0, -9.81, 0.0});
+    const HexapodSceneObjects scene = BuildHexapodScene(world);
+    RelaxBuiltInHexapodServos(world, scene);
+    ApplyHexapodPoseHoldStabilityTuning(world, scene);
+
+    ContactSolverConfig contact_cfg = world.GetContactSolverConfig();
+    contact_cfg.coloring.enabled = colored;
+    contact_cfg.coloring.maxColors = maxColors;
+    contact_cfg.coloring.minIslandRows = 0;
+    world.SetContactSolverConfig(contact_cfg);
+    JointSolverConfig joint_cfg = world.GetJointSolverConfig();
+    joint_cfg.useGraphColoring = colored;
+    world.SetJointSolverConfig(joint_cfg);
+    World::ParallelSolveConfig parallel_cfg = world.GetParallelSolveConfig();
+    parallel_cfg.threadCount = threads;
+    world.SetParallelSolveConfig(parallel_cfg);
+
+    constexpr Real kFrameDt = 1.0 / 60.0;
+    const int kSubsteps = kHexapodPoseHoldBenchmarkSubstepsPerFrame;
+    const Real subDt = kFrameDt / static_cast<Real>(kSubsteps);
+
+    ProfileResult result{};
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (int sub = 0; sub < kSubsteps; ++sub) {
+            world.Step(subDt, kHexapodPoseHoldBenchmarkSolverIterations);
+            const World::TopologySnapshot topology = world.SnapshotTopology();
+            result.contactColors = std::max(result.contactColors, topology.maxIslandContactColorCount);
+            result.jointColors = std::max(result.jointColors, topology.maxIslandJointColorCount);
+        }
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    result.substepMs = std::chrono::duration<double, std::milli>(t1 - t0).count()
+        / static_cast<double>(frames * kSubsteps);
+    result.chassisHeight = world.GetBody(scene.body).position.y;
+    return result;
+}
+
+void PrintRow(const char* mode, int maxColors, std::uint32_t threads, const ProfileResult& r, double baselineMs) {
+    std::printf("%-12s  max_colors=%3d  threads=%2u  contact_colors=%3u  joint_colors=%3u  substep_ms=%8.4f  "
+                "speedup=%5.2fx  chassis_y=%.4f\n",
+                mode,
+                maxColors,
+                threads,
+                r.contactColors,
+                r.jointColors,
+                r.substepMs,
+                baselineMs / std::max(r.substepMs, 1e-9),
+                static_cast<double>(r.chassisHeight));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = 120;
+    std::uint32_t threads = std::max(2u, std::thread::hardware_concurrency());
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) {
+            frames = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--threads" && i + 1 < argc) {
+            threads = static_cast<std::uint32_t>(std::max(1, std::atoi(argv[++i])));
+        } else {
+            std::cerr << "usage: hexapod_color_batch_profile [--frames N] [--threads N]\n";
+            return 2;
+        }
+    }
+
+    std::cout << "workload: hexapod pose hold " << frames << " frames @ 60Hz outer, "
+              << kHexapodPoseHoldBenchmarkSubstepsPerFrame << " substeps, "
+              << kHexapodPoseHoldBenchmarkSolverIterations << " solver iters/substep\n";
+
+    const ProfileResult baseline = RunProfile(false, 32, 1, frames);
+    PrintRow("sequential", 0, 1, baseline, baseline.substepMs);
+
+    constexpr std::array<std::uint8_t, 5> kColorBudgets{2, 4, 8, 16, 32};
+    for (const std::uint8_t maxColors : kColorBudgets) {
+        PrintRow("colored", maxColors, 1, RunProfile(true, maxColors, 1, frames), baseline.substepMs);
+        if (threads > 1) {
+            PrintRow("colored", maxColors, threads, RunProfile(true, maxColors, threads, frames), baseline.substepMs);
+        }
+    }
+    return 0;
+}
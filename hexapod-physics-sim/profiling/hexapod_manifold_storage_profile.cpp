@@ -0,0 +1,123 @@
+#include "demo/frame_sink.cpp"
+#include "demo/scenes.cpp"
+// Substep wall time and heap allocations of the contact / manifold storage on the hexapod
+// pose-hold stability scene. After `--warmup N` frames every buffer should be at its
+// high-water mark, so the steady-state allocation columns show what a `World::Step` still
+// allocates. The final chassis state is printed as hex floats so runs of two builds can be
+// compared bit for bit.
+#include "demo/scenes.hpp"
+#include "minphys3d/core/world.hpp"
+#include "minphys3d/demo/hexapod_stability.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+namespace {
+
+using namespace minphys3d;
+using namespace minphys3d::demo;
+using BenchClock = std::chrono::steady_clock;
+
+struct ProfileResult {
+    double substepMs = 0.0;
+    double allocationsPerStep = 0.0;
+    std::uint64_t maxAllocationsPerStep = 0;
+    std::uint32_t contacts = 0;
+    std::uint32_t manifolds = 0;
+    Vec3 chassisPosition{};
+    Vec3 chassisVelocity{};
+};
+
+ProfileResult RunProfile(int warmupFrames, int frames) {
+    World world(Vec3{0.0, -9.81, 0.0});
+    const HexapodSceneObjects scene = BuildHexapodScene(world);
+    RelaxBuiltInHexapodServos(world, scene);
+    ApplyHexapodPoseHoldStabilityTuning(world, scene);
+
+    constexpr Real kFrameDt = 1.0 / 60.0;
+    const int kSubsteps = kHexapodPoseHoldBenchmarkSubstepsPerFrame;
+    const Real subDt = kFrameDt / static_cast<Real>(kSubsteps);
+    for (int frame = 0; frame < warmupFrames; ++frame) {
+        for (int sub = 0; sub < kSubsteps; ++sub) {
+            world.Step(subDt, kHexapodPoseHoldBenchmarkSolverIterations);
+        }
+    }
+
+    ProfileResult result{};
+    std::uint64_t allocations = 0;
+    const auto t0 = BenchClock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (int sub = 0; sub < kSubsteps; ++sub) {
+            world.Step(subDt, kHexapodPoseHoldBenchmarkSolverIterations);
+            const std::uint64_t lastStep = world.GetHeapAllocationStats().lastStep;
+            allocations += lastStep;
+            result.maxAllocationsPerStep = std::max(result.maxAllocationsPerStep, lastStep);
+        }
+    }
+    const auto t1 = BenchClock::now();
+    const double steps = static_cast<double>(frames * kSubsteps);
+    result.substepMs = std::chrono::duration<double, std::milli>(t1 - t0).count() / steps;
+    result.allocationsPerStep = static_cast<double>(allocations) / steps;
+    const World::TopologySnapshot topology = world.SnapshotTopology();
+    result.contacts = topology.contactCount;
+    result.manifolds = topology.manifoldCount;
+    result.chassisPosition = world.GetBody(scene.body).position;
+    result.chassisVelocity = world.GetBody(scene.body).velocity;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int warmupFrames = 60;
+    int frames = 240;
+    int rounds = 3;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--warmup" && i + 1 < argc) {
+            warmupFrames = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--frames" && i + 1 < argc) {
+            frames = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--rounds" && i + 1 < argc) {
+            rounds = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::cerr << "usage: hexapod_manifold_storage_profile [--warmup N] [--frames N] [--rounds N]\n";
+            return 2;
+        }
+    }
+
+    std::cout << "workload: hexapod pose hold " << warmupFrames << " warmup + " << frames << " frames @ 60Hz outer, "
+              << kHexapodPoseHoldBenchmarkSubstepsPerFrame << " substeps, "
+              << kHexapodPoseHoldBenchmarkSolverIterations << " solver iters/substep\n";
+    if (!world_resource_monitoring::kHeapAllocationCountingEnabled) {
+        std::cout << "heap allocation counting is compiled out (MINPHYS3D_COUNT_HEAP_ALLOCATIONS=OFF)\n";
+    }
+
+    double bestMs = 1e300;
+    ProfileResult last{};
+    for (int round = 0; round < rounds; ++round) {
+        last = RunProfile(warmupFrames, frames);
+        bestMs = std::min(bestMs, last.substepMs);
+        std::printf("round=%d  substep_ms=%8.4f  allocs/step=%8.2f  max_allocs/step=%llu  contacts=%u  manifolds=%u\n",
+                    round,
+                    last.substepMs,
+                    last.allocationsPerStep,
+                    static_cast<unsigned long long>(last.maxAllocationsPerStep),
+                    last.contacts,
+                    last.manifolds);
+    }
+    std::printf("best  substep_ms=%8.4f\n", bestMs);
+    std::printf("chassis position=(%a, %a, %a) velocity=(%a, %a, %a)\n",
+                static_cast<double>(last.chassisPosition.x),
+                static_cast<double>(last.chassisPosition.y),
+                static_cast<double>(last.chassisPosition.z),
+                static_cast<double>(last.chassisVelocity.x),
+                static_cast<double>(last.chassisVelocity.y),
+                static_cast<double>(last.chassisVelocity.z));
+    return 0;
+}
@@ -0,0 +1,146 @@
+#include "demo/frame_sink.cpp"
+#include "demo/scenes.cpp"
+// Maximal-coordinate servo joints vs. reduced-coordinate trees
+// (`ArticulationConfig::enableReducedCoordinateTrees`) on the hexapod pose-hold stability scene.
+// The maximal run uses `--iterations`; the reduced runs sweep `--reduced-iterations`. Reports
+// substep wall time, the pose-hold metrics of `test_hexapod_live_pose_hold` and the largest
+// servo anchor gap seen after any substep, so iteration count can be traded against stability.
+#include "demo/scenes.hpp"
+#include "minphys3d/core/world.hpp"
+#include "minphys3d/demo/hexapod_stability.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using namespace minphys3d;
+using namespace minphys3d::demo;
+using BenchClock = std::chrono::steady_clock;
+
+struct ProfileOptions {
+    int frames = 240;
+    int rounds = 3;
+    int iterations = kHexapodPoseHoldBenchmarkSolverIterations;
+    std::vector<int> reducedIterations{4, 8, 12};
+};
+
+struct ProfileResult {
+    double substepMs = 0.0;
+    Real maxAnchorGap = 0.0;
+    HexapodPoseHoldMetrics metrics{};
+};
+
+Real MaxServoAnchorGap(const World& world, const HexapodSceneObjects& scene) {
+    Real gap = 0.0;
+    for (const LegLinkIds& leg : scene.legs) {
+        for (const std::uint32_t jointId : {leg.bodyToCoxaJoint, leg.coxaToFemurJoint, leg.femurToTibiaJoint}) {
+            const ServoJoint& joint = world.GetServoJoint(jointId);
+            const Body& a = world.GetBody(joint.a);
+            const Body& b = world.GetBody(joint.b);
+            const Vec3 pa = a.position + Rotate(a.orientation, joint.localAnchorA);
+            const Vec3 pb = b.position + Rotate(b.orientation, joint.localAnchorB);
+            gap = std::max(gap, Length(pb - pa));
+        }
+    }
+    return gap;
+}
+
+ProfileResult RunProfile(const ProfileOptions& options, bool reduced, int iterations) {
+    World world(Vec3{0.0, -9.81, 0.0});
+    const HexapodSceneObjects scene = BuildHexapodScene(world);
+    RelaxBuiltInHexapodServos(world, scene);
+    ApplyHexapodPoseHoldStabilityTuning(world, scene);
+    if (reduced) {
+        World::ArticulationConfig config = world.GetArticulationConfig();
+        config.enableReducedCoordinateTrees = true;
+        world.SetArticulationConfig(config);
+    }
+
+    constexpr Real kFrameDt = 1.0 / 60.0;
+    const int kSubsteps = kHexapodPoseHoldBenchmarkSubstepsPerFrame;
+    const Real subDt = kFrameDt / static_cast<Real>(kSubsteps);
+    ProfileResult result{};
+    BenchClock::duration stepTime{};
+    for (int frame = 0; frame < options.frames; ++frame) {
+        for (int sub = 0; sub < kSubsteps; ++sub) {
+            const auto t0 = BenchClock::now();
+            world.Step(subDt, iterations);
+            stepTime += BenchClock::now() - t0;
+            result.maxAnchorGap = std::max(result.maxAnchorGap, MaxServoAnchorGap(world, scene));
+            AccumulateHexapodPoseHoldFromSubstep(world, scene, scene.body, frame, result.metrics);
+        }
+    }
+    FinalizeHexapodPoseHold(world.GetBody(scene.body), result.metrics);
+    const double steps = static_cast<double>(options.frames * kSubsteps);
+    result.substepMs = std::chrono::duration<double, std::milli>(stepTime).count() / steps;
+    return result;
+}
+
+void PrintResult(const char* label, int iterations, int round, const ProfileResult& r) {
+    std::printf("%-8s iters=%2d round=%d  substep_ms=%8.4f  max_anchor_gap=%.6f  peak_lin=%.4f  "
+                "peak_lin_settled=%.4f  peak_ang=%.4f  peak_err=%.4f  final_speed=%.5f  final_y=%.5f\n",
+                label,
+                iterations,
+                round,
+                r.substepMs,
+                static_cast<double>(r.maxAnchorGap),
+                static_cast<double>(r.metrics.peakLinear),
+                static_cast<double>(r.metrics.peakLinearSettled),
+                static_cast<double>(r.metrics.peakAngular),
+                static_cast<double>(r.metrics.peakJointErrorRad),
+                static_cast<double>(r.metrics.finalSpeed),
+                static_cast<double>(r.metrics.finalPosition.y));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    ProfileOptions options{};
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) {
+            options.frames = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--rounds" && i + 1 < argc) {
+            options.rounds = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--iterations" && i + 1 < argc) {
+            options.iterations = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--reduced-iterations" && i + 1 < argc) {
+            options.reducedIterations.assign(1, std::max(1, std::atoi(argv[++i])));
+        } else {
+            std::cerr << "usage: hexapod_reduced_articulation_profile [--frames N] [--rounds N] [--iterations N]\n"
+                         "       [--reduced-iterations N]\n";
+            return 2;
+        }
+    }
+
+    std::cout << "workload: hexapod pose hold " << options.frames << " frames @ 60Hz outer, "
+              << kHexapodPoseHoldBenchmarkSubstepsPerFrame << " substeps; maximal " << options.iterations
+              << " solver iters/substep\n";
+
+    double bestMaximalMs = 1e300;
+    std::vector<double> bestReducedMs(options.reducedIterations.size(), 1e300);
+    for (int round = 0; round < options.rounds; ++round) {
+        const ProfileResult maximal = RunProfile(options, false, options.iterations);
+        bestMaximalMs = std::min(bestMaximalMs, maximal.substepMs);
+        PrintResult("maximal", options.iterations, round, maximal);
+        for (std::size_t k = 0; k < options.reducedIterations.size(); ++k) {
+            const ProfileResult reduced = RunProfile(options, true, options.reducedIterations[k]);
+            bestReducedMs[k] = std::min(bestReducedMs[k], reduced.substepMs);
+            PrintResult("reduced", options.reducedIterations[k], round, reduced);
+        }
+    }
+    std::printf("best  maximal_ms=%8.4f (iters=%d)\n", bestMaximalMs, options.iterations);
+    for (std::size_t k = 0; k < options.reducedIterations.size(); ++k) {
+        std::printf("best  reduced_ms=%8.4f (iters=%d)  speedup=%.3fx\n",
+                    bestReducedMs[k],
+                    options.reducedIterations[k],
+                    bestMaximalMs / bestReducedMs[k]);
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include "demo/frame_sink.cpp"
+#include "demo/scenes.cpp"
+// A/B substep wall time for the PGS body storage on the hexapod pose-hold stability scene:
+// solving directly on `Body` (AoS) vs the SoA solver-body mirror. Both layouts run the same
+// arithmetic, so the final chassis state must match bit for bit; only wall time may differ.
+// Runs alternate AoS / SoA for `--rounds N` to spread out frequency and cache noise.
+#include "demo/scenes.hpp"
+#include "minphys3d/core/world.hpp"
+#include "minphys3d/demo/hexapod_stability.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+
+namespace {
+
+using namespace minphys3d;
+using namespace minphys3d::demo;
+
+struct ProfileResult {
+    double substepMs = 0.0;
+    Vec3 chassisPosition{};
+    Vec3 chassisVelocity{};
+};
+
+ProfileResult RunProfile(bool useSoAMirror, int frames) {
+    World world(Vec3{0.0, -9.81, 0.0});
+    const HexapodSceneObjects scene = BuildHexapodScene(world);
+    RelaxBuiltInHexapodServos(world, scene);
+    ApplyHexapodPoseHoldStabilityTuning(world, scene);
+
+    World::SolverBodyConfig solver_body_cfg = world.GetSolverBodyConfig();
+    solver_body_cfg.useSoAMirror = useSoAMirror;
+    world.SetSolverBodyConfig(solver_body_cfg);
+
+    constexpr Real kFrameDt = 1.0 / 60.0;
+    const int kSubsteps = kHexapodPoseHoldBenchmarkSubstepsPerFrame;
+    const Real subDt = kFrameDt / static_cast<Real>(kSubsteps);
+
+    ProfileResult result{};
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (int sub = 0; sub < kSubsteps; ++sub) {
+            world.Step(subDt, kHexapodPoseHoldBenchmarkSolverIterations);
+        }
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    result.substepMs = std::chrono::duration<double, std::milli>(t1 - t0).count()
+        / static_cast<double>(frames * kSubsteps);
+    result.chassisPosition = world.GetBody(scene.body).position;
+    result.chassisVelocity = world.GetBody(scene.body).velocity;
+    return result;
+}
+
+bool SameState(const ProfileResult& a, const ProfileResult& b) {
+    return std::memcmp(&a.chassisPosition, &b.chassisPosition, sizeof(Vec3)) == 0
+        && std::memcmp(&a.chassisVelocity, &b.chassisVelocity, sizeof(Vec3)) == 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = 120;
+    int rounds = 3;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) {
+            frames = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--rounds" && i + 1 < argc) {
+            rounds = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::cerr << "usage: hexapod_solver_body_layout_profile [--frames N] [--rounds N]\n";
+            return 2;
+        }
+    }
+
+    std::cout << "workload: hexapod pose hold " << frames << " frames @ 60Hz outer, "
+              << kHexapodPoseHoldBenchmarkSubstepsPerFrame << " substeps, "
+              << kHexapodPoseHoldBenchmarkSolverIterations << " solver iters/substep\n";
+
+    double bestAoS = 1e300;
+    double bestSoA = 1e300;
+    bool identical = true;
+    for (int round = 0; round < rounds; ++round) {
+        const ProfileResult aos = RunProfile(false, frames);
+        const ProfileResult soa = RunProfile(true, frames);
+        identical = identical && SameState(aos, soa);
+        bestAoS = std::min(bestAoS, aos.substepMs);
+        bestSoA = std::min(bestSoA, soa.substepMs);
+        std::printf("round=%d  aos_substep_ms=%8.4f  soa_substep_ms=%8.4f  chassis_y=%.6f\n",
+                    round,
+                    aos.substepMs,
+                    soa.substepMs,
+                    static_cast<double>(soa.chassisPosition.y));
+    }
+    std::printf("best  aos_substep_ms=%8.4f  soa_substep_ms=%8.4f  speedup=%5.3fx  bit_identical=%s\n",
+                bestAoS,
+                bestSoA,
+                bestAoS / std::max(bestSoA, 1e-9),
+                identical ? "yes" : "NO");
+    return identical ? 0 : 1;
+}
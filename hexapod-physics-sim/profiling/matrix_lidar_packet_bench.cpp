@@ -0,0 +1,167 @@
+// Matrix LiDAR tracer throughput and its share of a serve step.
+//  1. Rays/second of one 64×8 scan: per-ray BVH walks vs 8×8 ray packets, serial and on a pool.
+//  2. Serve step latency: `World::Step` alone (LiDAR off) vs step + scan for each tracer. Serve
+//     mode only re-scans at the 64 Hz sensor cadence, so this is the latency of a capture step.
+// Scene: hexapod on a terrain patch with 48 static spheres / boxes / capsules / (half-)cylinders
+// scattered over the sensor's field of view. `--threads N` sets the pool size (default 4).
+#include "demo/frame_sink.cpp"
+#include "demo/matrix_lidar_sim.hpp"
+#include "demo/scenes.cpp"
+#include "demo/terrain_patch.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using namespace minphys3d;
+using namespace minphys3d::demo;
+using BenchClock = std::chrono::steady_clock;
+
+constexpr int kRaysPerScan = 64 * 8;
+constexpr Real kStepDt = 1.0 / 120.0;
+constexpr int kSolverIterations = 8;
+
+struct LidarBenchScene {
+    World world{Vec3{0.0, -9.81, 0.0}};
+    HexapodSceneObjects scene{};
+    TerrainPatch terrain{};
+};
+
+void BuildScene(LidarBenchScene& out) {
+    out.scene = BuildHexapodScene(out.world);
+    RelaxBuiltInHexapodServos(out.world, out.scene);
+    TerrainPatchConfig terrain_config{};
+    terrain_config.rows = 31;
+    terrain_config.cols = 31;
+    terrain_config.cell_size_m = 0.1;
+    out.terrain = TerrainPatch{terrain_config};
+    const Body& chassis = out.world.GetBody(out.scene.body);
+    out.terrain.initialize(out.world, chassis.position, 0.0);
+
+    const Quat q = Normalize(chassis.orientation);
+    const Vec3 forward = Normalize(Rotate(q, Vec3{0.0, 0.0, -1.0}));
+    const Vec3 right = Normalize(Rotate(q, Vec3{1.0, 0.0, 0.0}));
+    const Vec3 base = chassis.position;
+    const ShapeType shapes[] = {
+        ShapeType::Sphere, ShapeType::Box, ShapeType::Capsule, ShapeType::Cylinder, ShapeType::HalfCylinder};
+    for (int i = 0; i < 48; ++i) {
+        Body body{};
+        body.shape = shapes[i % 5];
+        body.isStatic = true;
+        const int ring = i / 8;
+        const int slot = i % 8 - 4;
+        body.position = base + forward * (0.5 + 0.3 * static_cast<Real>(ring))
+            + right * (0.15 * static_cast<Real>(slot) * (1.0 + 0.5 * static_cast<Real>(ring)));
+        body.position.y = 0.06 + 0.03 * static_cast<Real>(i % 3);
+        body.radius = 0.04;
+        body.halfHeight = 0.08;
+        body.halfExtents = {0.05, 0.05, 0.04};
+        body.orientation = Normalize(Quat{1.0, 0.15 * static_cast<Real>(slot), 0.0, 0.1 * static_cast<Real>(ring)});
+        out.world.CreateBody(body);
+    }
+    out.world.Step(kStepDt, kSolverIterations);
+}
+
+struct TracerMode {
+    const char* label;
+    MatrixLidarTraceOptions options;
+};
+
+double ScansPerSecond(const LidarBenchScene& scene, const MatrixLidarTraceOptions& options, int scans) {
+    physics_sim::StateResponse rsp{};
+    const Body& chassis = scene.world.GetBody(scene.scene.body);
+    const auto start = BenchClock::now();
+    for (int i = 0; i < scans; ++i) {
+        FillSimMatrixLidar64x8(scene.world, scene.scene, scene.terrain, chassis, rsp, options);
+    }
+    const double seconds = std::chrono::duration<double>(BenchClock::now() - start).count();
+    return static_cast<double>(scans) / seconds;
+}
+
+struct StepLatency {
+    double mean_us = 0.0;
+    double p99_us = 0.0;
+};
+
+// `options == nullptr` is LiDAR off. Each mode starts from a freshly built scene so all modes step
+// the same trajectory.
+StepLatency MeasureServeSteps(const MatrixLidarTraceOptions* options, int steps) {
+    LidarBenchScene scene{};
+    BuildScene(scene);
+    std::vector<double> samples;
+    samples.reserve(static_cast<std::size_t>(steps));
+    physics_sim::StateResponse rsp{};
+    for (int i = 0; i < steps; ++i) {
+        const auto start = BenchClock::now();
+        scene.world.Step(kStepDt, kSolverIterations);
+        if (options != nullptr) {
+            FillSimMatrixLidar64x8(
+                scene.world, scene.scene, scene.terrain, scene.world.GetBody(scene.scene.body), rsp, *options);
+        }
+        samples.push_back(std::chrono::duration<double, std::micro>(BenchClock::now() - start).count());
+    }
+    StepLatency latency{};
+    for (const double sample : samples) {
+        latency.mean_us += sample;
+    }
+    latency.mean_us /= static_cast<double>(samples.size());
+    std::sort(samples.begin(), samples.end());
+    latency.p99_us = samples[static_cast<std::size_t>(0.99 * static_cast<double>(samples.size() - 1))];
+    return latency;
+}
+
+int ParseThreads(int argc, char** argv) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::string_view{argv[i]} == "--threads") {
+            return std::max(2, std::atoi(argv[i + 1]));
+        }
+    }
+    return 4;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int threads = ParseThreads(argc, argv);
+    core_internal::WorkerPool pool{static_cast<std::size_t>(threads)};
+
+    TracerMode modes[3]{};
+    modes[0].label = "per-ray walk";
+    modes[0].options.use_packets = false;
+    modes[1].label = "8x8 packets";
+    modes[2].label = "8x8 packets + pool";
+    modes[2].options.pool = &pool;
+
+    LidarBenchScene scene{};
+    BuildScene(scene);
+    constexpr int kScans = 400;
+    std::printf("scene bodies=%u  pool_threads=%d  scans=%d\n", scene.world.GetBodyCount(), threads, kScans);
+    for (const TracerMode& mode : modes) {
+        (void)ScansPerSecond(scene, mode.options, 20);
+        const double scans_per_s = ScansPerSecond(scene, mode.options, kScans);
+        std::printf("  %-20s rays_per_s=%11.0f  scan_us=%8.1f\n",
+                    mode.label,
+                    scans_per_s * kRaysPerScan,
+                    1.0e6 / scans_per_s);
+    }
+
+    constexpr int kSteps = 300;
+    std::printf("serve step latency (step + scan every step, %d steps)\n", kSteps);
+    const StepLatency off = MeasureServeSteps(nullptr, kSteps);
+    std::printf("  %-20s mean_us=%8.1f  p99_us=%8.1f\n", "lidar off", off.mean_us, off.p99_us);
+    for (const TracerMode& mode : modes) {
+        const StepLatency on = MeasureServeSteps(&mode.options, kSteps);
+        std::printf("  %-20s mean_us=%8.1f  p99_us=%8.1f  lidar_share=%5.1f%%\n",
+                    mode.label,
+                    on.mean_us,
+                    on.p99_us,
+                    100.0 * (on.mean_us - off.mean_us) / on.mean_us);
+    }
+    return EXIT_SUCCESS;
+}
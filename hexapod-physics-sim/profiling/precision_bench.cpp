@@ -0,0 +1,174 @@
+// Float vs double A/B for the build precision (`MINPHYS3D_PRECISION`, math/scalar.hpp). Built once
+// per core library as precision_bench_f64 / precision_bench_f32 / precision_bench_mixed; run all
+// three and compare the lines (each prints its precision). Per scene: mean `World::Step` time and
+// an accuracy figure that should stay close to the f64 run.
+//  1. Hexapod standing on flat ground with its pose-hold servos (dt 1/240, 40 iterations):
+//     chassis drift from the settled position over 5 s.
+//  2. A box coasting 2 km from the origin without gravity for 4 s: distance from the exact path
+//     (constant velocity is exact under the integrator, so this is all rounding).
+//  3. 1,000 boxes and capsules dropped in a grid onto a plane: deepest contact penetration seen.
+//  4. 64x8 matrix LiDAR scans of the hexapod on a terrain patch: scan time and mean valid range.
+#include "demo/frame_sink.cpp"
+#include "demo/matrix_lidar_sim.hpp"
+#include "demo/scenes.cpp"
+#include "demo/terrain_patch.hpp"
+#include "minphys3d/demo/hexapod_stability.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+namespace {
+
+using namespace minphys3d;
+using namespace minphys3d::demo;
+using BenchClock = std::chrono::steady_clock;
+
+struct SceneResult {
+    double meanStepUs = 0.0;
+    double accuracy = 0.0;
+};
+
+template <typename StepFn>
+double TimeSteps(int steps, StepFn&& step) {
+    const auto start = BenchClock::now();
+    for (int i = 0; i < steps; ++i) {
+        step();
+    }
+    return std::chrono::duration<double, std::micro>(BenchClock::now() - start).count() / steps;
+}
+
+SceneResult RunHexapodStand() {
+    World world{Vec3{0.0, -9.81, 0.0}};
+    const HexapodSceneObjects scene = BuildHexapodScene(world);
+    RelaxBuiltInHexapodServos(world, scene);
+    ApplyHexapodPoseHoldStabilityTuning(world, scene);
+    constexpr Real kDt = 1.0 / 240.0;
+    constexpr int kIterations = 40;
+    for (int i = 0; i < 240; ++i) {
+        world.Step(kDt, kIterations);
+    }
+    const Vec3 settled = world.GetBody(scene.body).position;
+    SceneResult result{};
+    result.meanStepUs = TimeSteps(1200, [&] { world.Step(kDt, kIterations); });
+    result.accuracy = static_cast<double>(Length(world.GetBody(scene.body).position - settled));
+    return result;
+}
+
+SceneResult RunFarFieldCoast() {
+    World world{Vec3{0.0, 0.0, 0.0}};
+    constexpr double kStart[3] = {2000.0, 1.5, -1500.0};
+    constexpr double kVelocity[3] = {0.9, 0.0, 0.35};
+    Body box{};
+    box.shape = ShapeType::Box;
+    box.halfExtents = {0.2, 0.1, 0.15};
+    box.mass = 2.0;
+    box.position = {static_cast<Real>(kStart[0]), static_cast<Real>(kStart[1]), static_cast<Real>(kStart[2])};
+    box.velocity = {static_cast<Real>(kVelocity[0]), static_cast<Real>(kVelocity[1]), static_cast<Real>(kVelocity[2])};
+    const std::uint32_t id = world.CreateBody(box);
+    constexpr int kSteps = 960;
+    constexpr double kDt = 1.0 / 240.0;
+    SceneResult result{};
+    result.meanStepUs = TimeSteps(kSteps, [&] { world.Step(static_cast<Real>(kDt), 8); });
+    const Vec3 p = world.GetBody(id).position;
+    const double t = kSteps * kDt;
+    const double dx = static_cast<double>(p.x) - (kStart[0] + kVelocity[0] * t);
+    const double dz = static_cast<double>(p.z) - (kStart[2] + kVelocity[2] * t);
+    result.accuracy = std::sqrt(dx * dx + dz * dz);
+    return result;
+}
+
+SceneResult RunPile() {
+    World world{Vec3{0.0, -9.81, 0.0}};
+    BroadphaseConfig broadphase = world.GetBroadphaseConfig();
+    broadphase.validatePairsAgainstBruteForce = false;
+    world.SetBroadphaseConfig(broadphase);
+    Body ground{};
+    ground.shape = ShapeType::Plane;
+    ground.isStatic = true;
+    world.CreateBody(ground);
+    // 16x16 layers with random tilts: random positions would spawn overlapping bodies whose
+    // steps are then all depenetration.
+    constexpr int kPerRow = 16;
+    std::mt19937 rng(99u);
+    std::uniform_real_distribution<Real> unit(0.0, 1.0);
+    for (int i = 0; i < 1000; ++i) {
+        Body body{};
+        body.shape = i % 2 == 0 ? ShapeType::Box : ShapeType::Capsule;
+        body.halfExtents = {0.1, 0.08, 0.12};
+        body.radius = 0.07;
+        body.halfHeight = 0.1;
+        const Real column = static_cast<Real>(i % kPerRow);
+        const Real row = static_cast<Real>((i / kPerRow) % kPerRow);
+        const Real layer = static_cast<Real>(i / (kPerRow * kPerRow));
+        body.position = {Real(0.4) * column, Real(0.3) + Real(0.45) * layer, Real(0.4) * row};
+        body.orientation = Normalize(Quat{1.0, unit(rng) - Real(0.5), unit(rng) - Real(0.5), 0.0});
+        world.CreateBody(body);
+    }
+    double deepest = 0.0;
+    SceneResult result{};
+    result.meanStepUs = TimeSteps(240, [&] {
+        world.Step(1.0 / 120.0, 8);
+        for (const Manifold& manifold : world.DebugManifolds()) {
+            for (const Contact& contact : manifold.contacts) {
+                deepest = std::max(deepest, static_cast<double>(contact.penetration));
+            }
+        }
+    });
+    result.accuracy = deepest;
+    return result;
+}
+
+SceneResult RunLidar() {
+    World world{Vec3{0.0, -9.81, 0.0}};
+    const HexapodSceneObjects scene = BuildHexapodScene(world);
+    RelaxBuiltInHexapodServos(world, scene);
+    TerrainPatchConfig terrainConfig{};
+    terrainConfig.rows = 31;
+    terrainConfig.cols = 31;
+    terrainConfig.cell_size_m = 0.1;
+    TerrainPatch terrain{terrainConfig};
+    terrain.initialize(world, world.GetBody(scene.body).position, 0.0);
+    world.Step(1.0 / 120.0, 8);
+
+    physics_sim::StateResponse rsp{};
+    const Body& chassis = world.GetBody(scene.body);
+    constexpr int kScans = 200;
+    const auto start = BenchClock::now();
+    for (int i = 0; i < kScans; ++i) {
+        FillSimMatrixLidar64x8(world, scene, terrain, chassis, rsp, MatrixLidarTraceOptions{});
+    }
+    const double seconds = std::chrono::duration<double>(BenchClock::now() - start).count();
+    SceneResult result{};
+    result.meanStepUs = 1.0e6 * seconds / kScans;
+    double rangeSumMm = 0.0;
+    int rangeCount = 0;
+    for (const std::uint16_t rangeMm : rsp.matrix_lidar_ranges_mm) {
+        if (rangeMm != physics_sim::kMatrixLidarInvalidMm && rangeMm > 0u) {
+            rangeSumMm += rangeMm;
+            ++rangeCount;
+        }
+    }
+    result.accuracy = rangeCount > 0 ? 1.0e-3 * rangeSumMm / rangeCount : 0.0;
+    return result;
+}
+
+} // namespace
+
+int main() {
+    std::printf("precision=%s sizeof(Real)=%zu sizeof(SolverReal)=%zu\n",
+                PrecisionName(),
+                sizeof(Real),
+                sizeof(SolverReal));
+    const SceneResult stand = RunHexapodStand();
+    std::printf("  %-18s step_us=%9.1f  chassis_drift_m=%.3e\n", "hexapod stand", stand.meanStepUs, stand.accuracy);
+    const SceneResult coast = RunFarFieldCoast();
+    std::printf("  %-18s step_us=%9.1f  path_error_m=%.3e\n", "far-field coast", coast.meanStepUs, coast.accuracy);
+    const SceneResult pile = RunPile();
+    std::printf("  %-18s step_us=%9.1f  max_penetration_m=%.3e\n", "pile (1000)", pile.meanStepUs, pile.accuracy);
+    const SceneResult lidar = RunLidar();
+    std::printf("  %-18s scan_us=%9.1f  mean_range_m=%.6f\n", "lidar 64x8", lidar.meanStepUs, lidar.accuracy);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+#include "demo/frame_sink.cpp"
+#include "demo/scenes.cpp"
+// Per-iteration cost of the PGS dispatch path.
+//  1. Synthetic: one scalar contact row per manifold, swept over a body array, with the row kernel
+//     and impulse application reached through `std::function` (the old solver-context plumbing)
+//     vs through a statically dispatched hooks type (the current `ConstraintSolverContext<Hooks>`).
+//  2. Scene: marginal wall time of one extra `World::Step` solver iteration on the hexapod
+//     pose-hold stability scene, from the difference between a low and a high iteration count.
+#include "demo/scenes.hpp"
+#include "minphys3d/core/world.hpp"
+#include "minphys3d/demo/hexapod_stability.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using namespace minphys3d;
+using namespace minphys3d::demo;
+
+struct RowBody {
+    Vec3 velocity{};
+    Real invMass = 1.0;
+};
+
+struct Row {
+    std::uint32_t a = 0;
+    std::uint32_t b = 0;
+    Vec3 normal{0.0, 1.0, 0.0};
+    Real normalMass = 0.5;
+    Real bias = 0.01;
+    Real impulseSum = 0.0;
+};
+
+void ApplyRowImpulse(RowBody& a, RowBody& b, const Vec3& impulse) {
+    a.velocity -= impulse * a.invMass;
+    b.velocity += impulse * b.invMass;
+}
+
+void SolveRow(std::vector<RowBody>& bodies, Row& row, const std::function<void(RowBody&, RowBody&, const Vec3&)>& apply) {
+    RowBody& a = bodies[row.a];
+    RowBody& b = bodies[row.b];
+    const Real vn = Dot(b.velocity - a.velocity, row.normal);
+    const Real old = row.impulseSum;
+    row.impulseSum = std::max(old - (vn - row.bias) * row.normalMass, 0.0);
+    apply(a, b, (row.impulseSum - old) * row.normal);
+}
+
+struct ErasedContext {
+    std::vector<RowBody>& bodies;
+    std::function<void(std::vector<RowBody>&, Row&, const std::function<void(RowBody&, RowBody&, const Vec3&)>&)> solveRow;
+    std::function<void(RowBody&, RowBody&, const Vec3&)> applyImpulse;
+};
+
+struct StaticHooks {
+    std::vector<RowBody>& bodies;
+    void SolveRow(Row& row) const {
+        RowBody& a = bodies[row.a];
+        RowBody& b = bodies[row.b];
+        const Real vn = Dot(b.velocity - a.velocity, row.normal);
+        const Real old = row.impulseSum;
+        row.impulseSum = std::max(old - (vn - row.bias) * row.normalMass, 0.0);
+        ApplyRowImpulse(a, b, (row.impulseSum - old) * row.normal);
+    }
+};
+
+template <typename Hooks>
+struct StaticContext {
+    Hooks& hooks;
+};
+
+std::vector<Row> BuildRows(std::size_t bodyCount, std::size_t rowCount) {
+    std::vector<Row> rows(rowCount);
+    for (std::size_t i = 0; i < rowCount; ++i) {
+        rows[i].a = static_cast<std::uint32_t>(i % bodyCount);
+        rows[i].b = static_cast<std::uint32_t>((i * 7u + 1u) % bodyCount);
+    }
+    return rows;
+}
+
+double RunErased(std::size_t bodyCount, std::size_t rowCount, int iterations, Real& checksum) {
+    std::vector<RowBody> bodies(bodyCount);
+    std::vector<Row> rows = BuildRows(bodyCount, rowCount);
+    const ErasedContext context{
+        bodies,
+        [](std::vector<RowBody>& b, Row& row, const std::function<void(RowBody&, RowBody&, const Vec3&)>& apply) {
+            SolveRow(b, row, apply);
+        },
+        [](RowBody& a, RowBody& b, const Vec3& impulse) { ApplyRowImpulse(a, b, impulse); },
+    };
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int it = 0; it < iterations; ++it) {
+        for (Row& row : rows) {
+            context.solveRow(context.bodies, row, context.applyImpulse);
+        }
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    checksum = bodies.front().velocity.y;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / static_cast<double>(iterations * rowCount);
+}
+
+double RunStatic(std::size_t bodyCount, std::size_t rowCount, int iterations, Real& checksum) {
+    std::vector<RowBody> bodies(bodyCount);
+    std::vector<Row> rows = BuildRows(bodyCount, rowCount);
+    StaticHooks hooks{bodies};
+    const StaticContext<StaticHooks> context{hooks};
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int it = 0; it < iterations; ++it) {
+        for (Row& row : rows) {
+            context.hooks.SolveRow(row);
+        }
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    checksum = bodies.front().velocity.y;
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / static_cast<double>(iterations * rowCount);
+}
+
+double RunHexapod(int frames, int iterations) {
+    World world(Vec3{0.0, -9.81, 0.0});
+    const HexapodSceneObjects scene = BuildHexapodScene(world);
+    RelaxBuiltInHexapodServos(world, scene);
+    ApplyHexapodPoseHoldStabilityTuning(world, scene);
+
+    constexpr Real kFrameDt = 1.0 / 60.0;
+    const int kSubsteps = kHexapodPoseHoldBenchmarkSubstepsPerFrame;
+    const Real subDt = kFrameDt / static_cast<Real>(kSubsteps);
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (int sub = 0; sub < kSubsteps; ++sub) {
+            world.Step(subDt, iterations);
+        }
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(t1 - t0).count() / static_cast<double>(frames * kSubsteps);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = 60;
+    int rounds = 3;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) {
+            frames = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--rounds" && i + 1 < argc) {
+            rounds = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::cerr << "usage: solver_dispatch_microbench [--frames N] [--rounds N]\n";
+            return 2;
+        }
+    }
+
+    constexpr std::size_t kBodies = 64;
+    constexpr std::size_t kRows = 256;
+    constexpr int kRowIterations = 4000;
+    double bestErased = 1e300;
+    double bestStatic = 1e300;
+    Real erasedChecksum = 0.0;
+    Real staticChecksum = 0.0;
+    for (int round = 0; round < rounds; ++round) {
+        bestErased = std::min(bestErased, RunErased(kBodies, kRows, kRowIterations, erasedChecksum));
+        bestStatic = std::min(bestStatic, RunStatic(kBodies, kRows, kRowIterations, staticChecksum));
+    }
+    std::printf("synthetic rows=%zu bodies=%zu  std_function_ns_per_row=%7.3f  static_ns_per_row=%7.3f  "
+                "speedup=%5.2fx  checksum_match=%s\n",
+                kRows,
+                kBodies,
+                bestErased,
+                bestStatic,
+                bestErased / std::max(bestStatic, 1e-9),
+                erasedChecksum == staticChecksum ? "yes" : "NO");
+
+    const int lowIterations = kHexapodPoseHoldBenchmarkSolverIterations;
+    const int highIterations = 2 * kHexapodPoseHoldBenchmarkSolverIterations;
+    double bestLow = 1e300;
+    double bestHigh = 1e300;
+    for (int round = 0; round < rounds; ++round) {
+        bestLow = std::min(bestLow, RunHexapod(frames, lowIterations));
+        bestHigh = std::min(bestHigh, RunHexapod(frames, highIterations));
+    }
+    std::printf("hexapod frames=%d  substep_us@%d=%9.2f  substep_us@%d=%9.2f  us_per_iteration=%7.3f\n",
+                frames,
+                lowIterations,
+                bestLow,
+                highIterations,
+                bestHigh,
+                (bestHigh - bestLow) / static_cast<double>(highIterations - lowIterations));
+    return erasedChecksum == staticChecksum ? 0 : 1;
+}
@@ -0,0 +1,206 @@
+// Streaming terrain cost vs distance walked (`demo/terrain_tile_store.hpp`).
+// A 96 m x 96 m heightfield at 5 cm is written to a tiled height file, memory-mapped, and walked
+// in a lawnmower pattern at 1 m/s for increasing distances. Every 1/120 s step re-centres the
+// resident window (5x5 tiles of 32 cells), re-attaches it when it moved, plants six foot spheres
+// on the surface and steps the world; every 12th step casts a 64-ray LiDAR fan that reaches past
+// the window into the LOD grid. Reported per distance: mean and p99 step time split into
+// streaming / physics / LiDAR, window moves, tiles loaded from the file, distinct tiles visited
+// and resident fine-height bytes. Per-step cost should stay flat as the visited area grows.
+#include "demo/terrain_tile_store.hpp"
+#include "minphys3d/core/world.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+using namespace minphys3d;
+using BenchClock = std::chrono::steady_clock;
+
+constexpr Real kStepDt = 1.0 / 120.0;
+constexpr Real kWalkSpeed = 1.0;
+constexpr Real kCell = 0.05;
+constexpr int kSamples = 1920;
+constexpr Real kLaneLength = 88.0;
+constexpr Real kLaneSpacing = 2.0;
+constexpr Real kFootRadius = 0.03;
+
+Real AuthoredHeight(Real x, Real z) {
+    const Real rolling = 0.25 * std::sin(0.21 * x) * std::cos(0.17 * z) + 0.08 * std::sin(1.3 * x + 0.7 * z);
+    const Real steps = 0.04 * std::floor(std::fmod(std::abs(x + 2.0 * z), 3.0));
+    return rolling + steps;
+}
+
+// Lawnmower path inside the file footprint: lanes along +X/-X, shifting +Z between lanes.
+Vec3 PathPoint(Real distance) {
+    const Real lane_period = kLaneLength + kLaneSpacing;
+    const int lane = static_cast<int>(std::floor(distance / lane_period));
+    const Real along = distance - static_cast<Real>(lane) * lane_period;
+    const Real z0 = 4.0 + static_cast<Real>(lane) * kLaneSpacing;
+    if (along > kLaneLength) {
+        const Real x_end = (lane % 2 == 0) ? 4.0 + kLaneLength : 4.0;
+        return {x_end, 0.0, z0 + (along - kLaneLength)};
+    }
+    const Real x = (lane % 2 == 0) ? 4.0 + along : 4.0 + kLaneLength - along;
+    return {x, 0.0, z0};
+}
+
+struct WalkResult {
+    Real distance_m = 0.0;
+    double mean_step_us = 0.0;
+    double p99_step_us = 0.0;
+    double mean_stream_us = 0.0;
+    double mean_physics_us = 0.0;
+    double mean_lidar_scan_us = 0.0;
+    double lidar_hits_per_scan = 0.0;
+    std::uint64_t window_moves = 0;
+    std::uint64_t tile_loads = 0;
+    std::size_t tiles_visited = 0;
+    std::size_t resident_bytes = 0;
+};
+
+WalkResult Walk(const std::string& path, Real distance_m) {
+    demo::TerrainTileStoreConfig config{};
+    config.window_radius_tiles = 2;
+    config.cache_capacity_tiles = 64;
+    config.max_ray_distance_m = 12.0;
+    demo::TerrainTileStore store{config};
+    std::string error;
+    if (!store.Open(path, &error)) {
+        std::fprintf(stderr, "cannot open %s: %s\n", path.c_str(), error.c_str());
+        std::exit(EXIT_FAILURE);
+    }
+
+    World world{Vec3{0.0, -9.81, 0.0}};
+    store.UpdateWindow(PathPoint(0.0));
+    world.SetTerrainHeightfield(store.BuildTerrainHeightfieldAttachment());
+    const std::array<Vec3, 6> foot_offsets{{
+        {0.25, 0.0, 0.18}, {0.0, 0.0, 0.22}, {-0.25, 0.0, 0.18},
+        {0.25, 0.0, -0.18}, {0.0, 0.0, -0.22}, {-0.25, 0.0, -0.18},
+    }};
+    std::array<std::uint32_t, 6> feet{};
+    for (std::size_t i = 0; i < feet.size(); ++i) {
+        Body foot{};
+        foot.shape = ShapeType::Sphere;
+        foot.radius = kFootRadius;
+        foot.mass = 0.2;
+        feet[i] = world.CreateBody(foot);
+    }
+
+    const int steps = static_cast<int>(distance_m / (kWalkSpeed * kStepDt));
+    std::vector<double> step_us;
+    step_us.reserve(static_cast<std::size_t>(steps));
+    double stream_s = 0.0;
+    double physics_s = 0.0;
+    double lidar_s = 0.0;
+    int scans = 0;
+    std::uint64_t lidar_hits = 0;
+    std::unordered_set<std::uint64_t> visited;
+    const Real tile_span = 32.0 * kCell;
+    for (int step = 0; step < steps; ++step) {
+        const Vec3 robot = PathPoint(static_cast<Real>(step) * kWalkSpeed * kStepDt);
+        visited.insert((static_cast<std::uint64_t>(std::floor(robot.x / tile_span)) << 32u)
+                       | static_cast<std::uint32_t>(std::floor(robot.z / tile_span)));
+
+        const auto t0 = BenchClock::now();
+        if (store.UpdateWindow(robot)) {
+            world.SetTerrainHeightfield(store.BuildTerrainHeightfieldAttachment());
+        }
+        const auto t1 = BenchClock::now();
+        for (std::size_t i = 0; i < feet.size(); ++i) {
+            Body& foot = world.GetBody(feet[i]);
+            const Vec3 p = robot + foot_offsets[i];
+            foot.position = {p.x, store.SampleHeightWorld(p.x, p.z) + kFootRadius - 0.002, p.z};
+            foot.velocity = {};
+            foot.angularVelocity = {};
+        }
+        world.Step(kStepDt, 8);
+        const auto t2 = BenchClock::now();
+        if (step % 12 == 0) {
+            const Vec3 origin{robot.x, store.SampleHeightWorld(robot.x, robot.z) + 0.3, robot.z};
+            Real t_hit = 0.0;
+            for (int ray = 0; ray < 64; ++ray) {
+                const Real yaw = -0.8 + 1.6 * static_cast<Real>(ray % 16) / 15.0;
+                const Real pitch = -0.02 - 0.06 * static_cast<Real>(ray / 16);
+                const Vec3 dir = Normalize(Vec3{std::cos(yaw), pitch, std::sin(yaw)});
+                if (store.RaycastWorld(origin, dir, t_hit)) {
+                    ++lidar_hits;
+                }
+            }
+            ++scans;
+        }
+        const auto t3 = BenchClock::now();
+        stream_s += std::chrono::duration<double>(t1 - t0).count();
+        physics_s += std::chrono::duration<double>(t2 - t1).count();
+        lidar_s += std::chrono::duration<double>(t3 - t2).count();
+        step_us.push_back(std::chrono::duration<double, std::micro>(t3 - t0).count());
+    }
+
+    WalkResult result{};
+    result.distance_m = distance_m;
+    double total_us = 0.0;
+    for (const double us : step_us) {
+        total_us += us;
+    }
+    result.mean_step_us = total_us / static_cast<double>(steps);
+    std::sort(step_us.begin(), step_us.end());
+    result.p99_step_us = step_us[static_cast<std::size_t>(0.99 * static_cast<double>(steps - 1))];
+    result.mean_stream_us = stream_s * 1.0e6 / steps;
+    result.mean_physics_us = physics_s * 1.0e6 / steps;
+    result.mean_lidar_scan_us = lidar_s * 1.0e6 / std::max(scans, 1);
+    result.lidar_hits_per_scan = static_cast<double>(lidar_hits) / std::max(scans, 1);
+    result.window_moves = store.stats().window_moves;
+    result.tile_loads = store.stats().tile_loads;
+    result.tiles_visited = visited.size();
+    result.resident_bytes = store.resident_bytes();
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::string path = argc > 1 ? argv[1] : "terrain_tile_bench.mpht";
+    std::vector<float> heights(static_cast<std::size_t>(kSamples) * kSamples);
+    for (int row = 0; row < kSamples; ++row) {
+        for (int col = 0; col < kSamples; ++col) {
+            heights[static_cast<std::size_t>(row) * kSamples + static_cast<std::size_t>(col)] =
+                static_cast<float>(AuthoredHeight(static_cast<Real>(col) * kCell, static_cast<Real>(row) * kCell));
+        }
+    }
+    std::string error;
+    if (!demo::WriteTerrainHeightFile(path, heights, kSamples, kSamples, kCell, 0.0, 0.0, 32, 4, &error)) {
+        std::fprintf(stderr, "cannot write %s: %s\n", path.c_str(), error.c_str());
+        return EXIT_FAILURE;
+    }
+    heights = {};
+
+    std::printf("terrain_tile_bench: 96 m x 96 m @ 5 cm, 5x5-tile window, 64-tile LRU, 1 m/s, 120 Hz\n");
+    std::printf("%10s %10s %10s %10s %10s %13s %9s %8s %8s %8s %12s\n",
+                "walk_m", "step_us", "p99_us", "stream_us", "phys_us", "lidar_us/scan", "hits/scan",
+                "moves", "loads", "visited", "resident_KiB");
+    for (const Real distance : {10.0, 40.0, 160.0, 640.0}) {
+        const WalkResult r = Walk(path, distance);
+        std::printf("%10.0f %10.2f %10.2f %10.2f %10.2f %13.1f %9.1f %8llu %8llu %8zu %12zu\n",
+                    static_cast<double>(r.distance_m),
+                    r.mean_step_us,
+                    r.p99_step_us,
+                    r.mean_stream_us,
+                    r.mean_physics_us,
+                    r.mean_lidar_scan_us,
+                    r.lidar_hits_per_scan,
+                    static_cast<unsigned long long>(r.window_moves),
+                    static_cast<unsigned long long>(r.tile_loads),
+                    r.tiles_visited,
+                    r.resident_bytes / 1024u);
+    }
+    std::remove(path.c_str());
+    return EXIT_SUCCESS;
+}
@@ -2,8 +2,9 @@
 
 namespace minphys3d::core_internal {
 
-std::vector<Pair> BroadphaseSystem::ComputePotentialPairs(const BroadphaseContext& context) const {
-    return context.computePotentialPairs ? context.computePotentialPairs() : std::vector<Pair>{};
+const std::vector<Pair>& BroadphaseSystem::ComputePotentialPairs(const BroadphaseContext& context) const {
+    static const std::vector<Pair> kNoPairs{};
+    return context.computePotentialPairs ? context.computePotentialPairs() : kNoPairs;
 }
 
 void BroadphaseSystem::UpdateProxies(const BroadphaseUpdateContext& context) const {
@@ -373,7 +373,7 @@ void World::SphereCylinder(std::uint32_t sphereId, std::uint32_t cylId) {
     const Real denom = Dot(ab, ab);
     Real t = 0.0;
     if (denom > kEpsilon) {
-        t = std::clamp(Dot(s.position - segA, ab) / denom, 0.0, 1.0);
+        t = std::clamp<Real>(Dot(s.position - segA, ab) / denom, 0.0, 1.0);
     }
     const Vec3 closest = segA + ab * t;
     const Vec3 delta = closest - s.position;
@@ -561,7 +561,7 @@ void World::CylinderCylinder(std::uint32_t aId, std::uint32_t bId) {
     if (distSq > radiusSum * radiusSum) {
         return;
     }
-    const Real dist = std::sqrt(std::max(distSq, 0.0));
+    const Real dist = std::sqrt(std::max<Real>(distSq, 0.0));
     const Vec3 centerDelta = b.position - a.position;
     Vec3 normal = StableDirection(delta, {centerDelta, axisA, axisB, Cross(axisA, axisB)});
     if (Dot(normal, centerDelta) < 0.0) {
@@ -589,7 +589,7 @@ void World::CylinderCylinder(std::uint32_t aId, std::uint32_t bId) {
             if (Dot(epNormal, centerDelta) < 0.0) {
                 epNormal = -epNormal;
             }
-            const Real epDist = std::sqrt(std::max(epDistSq, 0.0));
+            const Real epDist = std::sqrt(std::max<Real>(epDistSq, 0.0));
             const std::uint8_t featureBProj = (tProj <= 1e-3) ? 0u : ((tProj >= 1.0 - 1e-3) ? 1u : 2u);
             const std::uint64_t mfid = CanonicalFeaturePairId(aId, bId, endpointFeature, featureBProj, 1u);
             AddContact(aId, bId, epNormal, endpointA + epNormal * a.radius, radiusSum - epDist, 16u, mfid);
@@ -620,7 +620,7 @@ void World::CapsuleCylinder(std::uint32_t capsuleId, std::uint32_t cylId) {
     if (distSq > radiusSum * radiusSum) {
         return;
     }
-    const Real dist = std::sqrt(std::max(distSq, 0.0));
+    const Real dist = std::sqrt(std::max<Real>(distSq, 0.0));
     const Vec3 centerDelta = cyl.position - cap.position;
     Vec3 normal = StableDirection(delta, {centerDelta, axisC, axisY, Cross(axisC, axisY)});
     if (Dot(normal, centerDelta) < 0.0) {
@@ -648,7 +648,7 @@ void World::CapsuleCylinder(std::uint32_t capsuleId, std::uint32_t cylId) {
             if (Dot(epN, centerDelta) < 0.0) {
                 epN = -epN;
             }
-            const Real epDist = std::sqrt(std::max(epSq, 0.0));
+            const Real epDist = std::sqrt(std::max<Real>(epSq, 0.0));
             const std::uint8_t cylFeat = (tProj <= 1e-3) ? 0u : ((tProj >= 1.0 - 1e-3) ? 1u : 2u);
             const std::uint64_t mfid = CanonicalFeaturePairId(capsuleId, cylId, capFeat, cylFeat, 1u);
             AddContact(capsuleId, cylId, epN, endpointCap + epN * cap.radius, radiusSum - epDist, 17u, mfid);
@@ -1118,9 +1118,9 @@ void World::HalfCylinderHalfCylinder(std::uint32_t aId, std::uint32_t bId) {
     AppendHalfCylinderSurfaceSamples(a, sA);
     AppendHalfCylinderSurfaceSamples(b, sB);
 
-    const Real rMin = std::min(std::min(a.radius, b.radius), 0.5);
+    const Real rMin = std::min<Real>(std::min(a.radius, b.radius), 0.5);
     const Real pairDist =
-        std::max(0.06 * rMin, std::min(0.18 * rMin, 0.25 * std::min(bestOverlap, 0.35)));
+        std::max(0.06 * rMin, std::min(0.18 * rMin, 0.25 * std::min<Real>(bestOverlap, 0.35)));
     const Real pairTolSq = pairDist * pairDist;
     const Real mergeTolSq = 1e-5;
     std::uint32_t geomId = 0;
@@ -1289,7 +1289,7 @@ void World::CapsuleHalfCylinder(std::uint32_t capsuleId, std::uint32_t halfCylin
             if (Dot(epN, centerDelta) < 0.0) {
                 epN = -epN;
             }
-            const Real epDist = std::sqrt(std::max(epSq, 0.0));
+            const Real epDist = std::sqrt(std::max<Real>(epSq, 0.0));
             const std::uint8_t hcFeat = (tProj <= 1e-3) ? 0u : ((tProj >= 1.0 - 1e-3) ? 1u : 2u);
             const std::uint64_t mfid = CanonicalFeaturePairId(capsuleId, halfCylinderId, capFeat, hcFeat, 1u);
             AddContact(capsuleId, halfCylinderId, epN, endpointCap + epN * cap.radius, radiusSum - epDist, 22u, mfid);
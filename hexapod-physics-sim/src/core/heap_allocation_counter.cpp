@@ -0,0 +1,66 @@
+#include "minphys3d/core/world_resource_monitoring.hpp"
+
+#include <cstdlib>
+#include <new>
+
+// Replacement global allocation functions feeding `threadHeapAllocationCount`, linked only into
+// the targets that read the counters: the no-allocation tests always, other tools through
+// `minphys3d_count_heap_allocations` (see CMakeLists.txt).
+// Only the unaligned forms are replaced: over-aligned types (e.g. `RayPacket`, whose lanes are
+// `alignas(32)`) allocate through the library's `std::align_val_t` forms, which pair with its own
+// aligned deletes and are not counted.
+
+namespace {
+
+void* CountedAllocate(std::size_t size) noexcept {
+    ++minphys3d::world_resource_monitoring::threadHeapAllocationCount;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    if (void* ptr = CountedAllocate(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* ptr = CountedAllocate(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return CountedAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return CountedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
@@ -0,0 +1,147 @@
+#include "minphys3d/core/worker_pool.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace minphys3d::core_internal {
+
+struct WorkerPool::State {
+    std::mutex dispatchMutex;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(std::size_t)>* task = nullptr;
+    std::size_t taskCount = 0;
+    std::atomic<std::size_t> nextTask{0};
+    std::size_t pendingWorkers = 0;
+    std::uint64_t generation = 0;
+    bool stop = false;
+    std::vector<std::thread> workers;
+
+    void RunTasks(const std::function<void(std::size_t)>& fn, std::size_t count) {
+        for (;;) {
+            const std::size_t index = nextTask.fetch_add(1, std::memory_order_relaxed);
+            if (index >= count) {
+                return;
+            }
+            fn(index);
+        }
+    }
+
+    void WorkerLoop() {
+        std::uint64_t seenGeneration = 0;
+        for (;;) {
+            const std::function<void(std::size_t)>* fn = nullptr;
+            std::size_t count = 0;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&]() { return stop || generation != seenGeneration; });
+                if (stop) {
+                    return;
+                }
+                seenGeneration = generation;
+                fn = task;
+                count = taskCount;
+            }
+            RunTasks(*fn, count);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--pendingWorkers == 0) {
+                    done.notify_one();
+                }
+            }
+        }
+    }
+};
+
+WorkerPool::WorkerPool(std::size_t threadCount)
+    : state_(std::make_unique<State>()) {
+    const std::size_t workerCount = threadCount > 1 ? threadCount - 1 : 0;
+    state_->workers.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i) {
+        state_->workers.emplace_back([state = state_.get()]() { state->WorkerLoop(); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->stop = true;
+    }
+    state_->wake.notify_all();
+    for (std::thread& worker : state_->workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+std::size_t WorkerPool::ThreadCount() const {
+    return state_->workers.size() + 1;
+}
+
+void WorkerPool::ParallelFor(std::size_t taskCount, const std::function<void(std::size_t)>& task) {
+    if (taskCount == 0) {
+        return;
+    }
+    if (state_->workers.empty() || taskCount == 1) {
+        for (std::size_t i = 0; i < taskCount; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> dispatchLock(state_->dispatchMutex);
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->task = &task;
+        state_->taskCount = taskCount;
+        state_->nextTask.store(0, std::memory_order_relaxed);
+        state_->pendingWorkers = state_->workers.size();
+        ++state_->generation;
+    }
+    state_->wake.notify_all();
+    state_->RunTasks(task, taskCount);
+    {
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        state_->done.wait(lock, [&]() { return state_->pendingWorkers == 0; });
+        state_->task = nullptr;
+        state_->taskCount = 0;
+    }
+}
+
+WorkerPoolHandle::WorkerPoolHandle() = default;
+WorkerPoolHandle::~WorkerPoolHandle() = default;
+
+WorkerPoolHandle::WorkerPoolHandle(const WorkerPoolHandle&) {}
+
+WorkerPoolHandle& WorkerPoolHandle::operator=(const WorkerPoolHandle& other) {
+    if (this != &other) {
+        pool_.reset();
+    }
+    return *this;
+}
+
+WorkerPoolHandle::WorkerPoolHandle(WorkerPoolHandle&&) noexcept = default;
+WorkerPoolHandle& WorkerPoolHandle::operator=(WorkerPoolHandle&&) noexcept = default;
+
+WorkerPool* WorkerPoolHandle::Acquire(std::size_t threadCount) {
+    if (threadCount <= 1) {
+        pool_.reset();
+        return nullptr;
+    }
+    if (!pool_ || pool_->ThreadCount() != threadCount) {
+        pool_ = std::make_unique<WorkerPool>(threadCount);
+    }
+    return pool_.get();
+}
+
+void WorkerPoolHandle::Reset() {
+    pool_.reset();
+}
+
+} // namespace minphys3d::core_internal
@@ -55,6 +55,25 @@ World::ArticulationConfig World::GetArticulationConfig() const {
     return articulationConfig_;
 }
 
+void World::SetParallelSolveConfig(const ParallelSolveConfig& config) {
+    parallelSolveConfig_ = config;
+    if (parallelSolveConfig_.threadCount <= 1) {
+        solverWorkerPool_.Reset();
+    }
+}
+
+const World::ParallelSolveConfig& World::GetParallelSolveConfig() const {
+    return parallelSolveConfig_;
+}
+
+void World::SetSolverBodyConfig(const SolverBodyConfig& config) {
+    solverBodyConfig_ = config;
+}
+
+const World::SolverBodyConfig& World::GetSolverBodyConfig() const {
+    return solverBodyConfig_;
+}
+
 void World::SetBroadphaseConfig(const BroadphaseConfig& config) {
     broadphaseConfig_ = config;
 }
@@ -79,6 +98,22 @@ const World::PersistenceMatchDiagnostics& World::GetPersistenceMatchDiagnostics(
     return persistenceMatchDiagnostics_;
 }
 
+const world_resource_monitoring::HeapAllocationStats& World::GetHeapAllocationStats() const {
+    return heapAllocationStats_;
+}
+
+const World::SolverIterationStats& World::GetSolverIterationStats() const {
+    return solverIterationStats_;
+}
+
+const World::ContactReuseStats& World::GetContactReuseStats() const {
+    return contactReuseStats_;
+}
+
+const World::NarrowphaseStats& World::GetNarrowphaseStats() const {
+    return narrowphaseStats_;
+}
+
 bool World::ComputeStableTangentFrame(
     const Vec3& manifoldNormal,
     const Vec3& relativeVelocity,
@@ -118,6 +153,8 @@ bool World::ComputeStableTangentFrame(
 }
 
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+thread_local World::SolverTelemetry* World::threadSolverTelemetry_ = nullptr;
+
 const World::SolverTelemetry& World::GetSolverTelemetry() const {
     return solverTelemetry_;
 }
@@ -158,55 +195,73 @@ std::uint32_t World::CreateBody(const Body& bodyDef) {
 }
 
 void World::SetTerrainHeightfield(TerrainHeightfieldAttachment terrain) {
+    substepContactReuse_.valid = false;
     if (!terrain.enabled || terrain.rows <= 1 || terrain.cols <= 1) {
         ClearTerrainHeightfield();
         return;
     }
     const std::size_t expectedCellCount = static_cast<std::size_t>(terrain.rows * terrain.cols);
-    if (terrain.surfaceHeightsM.size() != expectedCellCount) {
-        ClearTerrainHeightfield();
-        return;
-    }
-    if (terrain.collisionHeightsM.empty()) {
-        terrain.collisionHeightsM = terrain.surfaceHeightsM;
-    }
-    if (terrain.collisionHeightsM.size() != expectedCellCount) {
-        ClearTerrainHeightfield();
-        return;
-    }
     if (!std::isfinite(terrain.cellSizeM) || terrain.cellSizeM <= 0.0) {
         ClearTerrainHeightfield();
         return;
     }
 
     const bool hadAttachment = terrainAttachment_.enabled;
-    const std::size_t prevCellCount = terrainAttachment_.surfaceHeightsM.size();
-    std::uint64_t dirtyCells = 0;
-    if (hadAttachment
+    const bool sameGrid = hadAttachment
         && terrainAttachment_.rows == terrain.rows
         && terrainAttachment_.cols == terrain.cols
         && std::abs(terrainAttachment_.cellSizeM - terrain.cellSizeM) <= 1.0e-6
-        && std::abs(terrainAttachment_.baseHeightM - terrain.baseHeightM) <= 1.0e-6
-        && prevCellCount == expectedCellCount) {
-        const auto countDirty = [&](const std::vector<float>& previous, const std::vector<float>& current) {
-            std::uint64_t count = 0;
-            for (std::size_t i = 0; i < current.size(); ++i) {
-                if (i >= previous.size() || std::abs(previous[i] - current[i]) > 1.0e-6) {
-                    ++count;
-                }
-            }
-            return count;
-        };
-        dirtyCells = countDirty(terrainAttachment_.surfaceHeightsM, terrain.surfaceHeightsM);
-        const std::vector<float>& previousCollision = terrainAttachment_.collisionHeightsM.empty()
-            ? terrainAttachment_.surfaceHeightsM
-            : terrainAttachment_.collisionHeightsM;
-        dirtyCells = std::max(dirtyCells, countDirty(previousCollision, terrain.collisionHeightsM));
+        && std::abs(terrainAttachment_.baseHeightM - terrain.baseHeightM) <= 1.0e-6;
+    std::uint64_t dirtyCells = 0;
+    if (terrain.sharedHeights != nullptr) {
+        const TerrainHeightfieldBuffer& heights = *terrain.sharedHeights;
+        if (heights.Rows() != terrain.rows || heights.Cols() != terrain.cols
+            || heights.SurfaceHeights().size() != expectedCellCount
+            || heights.CollisionHeights().size() != expectedCellCount) {
+            ClearTerrainHeightfield();
+            return;
+        }
+        terrain.surfaceHeightsM.clear();
+        terrain.collisionHeightsM.clear();
+        // The previous attachment's revision is the buffer revision it last saw.
+        dirtyCells = sameGrid && terrainAttachment_.sharedHeights == terrain.sharedHeights
+            ? heights.DirtyCellsSince(terrainAttachment_.revision)
+            : expectedCellCount;
+        terrain.revision = heights.Revision();
     } else {
-        dirtyCells = expectedCellCount;
+        if (terrain.surfaceHeightsM.size() != expectedCellCount) {
+            ClearTerrainHeightfield();
+            return;
+        }
+        if (terrain.collisionHeightsM.empty()) {
+            terrain.collisionHeightsM = terrain.surfaceHeightsM;
+        }
+        if (terrain.collisionHeightsM.size() != expectedCellCount) {
+            ClearTerrainHeightfield();
+            return;
+        }
+        if (sameGrid && terrainAttachment_.sharedHeights == nullptr
+            && terrainAttachment_.surfaceHeightsM.size() == expectedCellCount) {
+            const auto countDirty = [&](const std::vector<float>& previous, const std::vector<float>& current) {
+                std::uint64_t count = 0;
+                for (std::size_t i = 0; i < current.size(); ++i) {
+                    if (i >= previous.size() || std::abs(previous[i] - current[i]) > 1.0e-6) {
+                        ++count;
+                    }
+                }
+                return count;
+            };
+            dirtyCells = countDirty(terrainAttachment_.surfaceHeightsM, terrain.surfaceHeightsM);
+            const std::vector<float>& previousCollision = terrainAttachment_.collisionHeightsM.empty()
+                ? terrainAttachment_.surfaceHeightsM
+                : terrainAttachment_.collisionHeightsM;
+            dirtyCells = std::max(dirtyCells, countDirty(previousCollision, terrain.collisionHeightsM));
+        } else {
+            dirtyCells = expectedCellCount;
+        }
+        terrain.revision = hadAttachment ? terrainAttachment_.revision + 1u : 1u;
     }
 
-    terrain.revision = hadAttachment ? terrainAttachment_.revision + 1u : 1u;
     terrainAttachment_ = std::move(terrain);
     terrainAttachment_.enabled = true;
 
@@ -258,6 +313,7 @@ void World::SetTerrainHeightfield(TerrainHeightfieldAttachment terrain) {
 
 void World::ClearTerrainHeightfield() {
     terrainAttachment_ = {};
+    substepContactReuse_.valid = false;
 }
 
 bool World::HasTerrainHeightfield() const {
@@ -459,15 +515,15 @@ std::uint32_t World::CreateServoJoint(
     j.localReferenceA = ComputeLocalDirection(bodies_.at(a), worldReference);
     j.localReferenceB = ComputeLocalDirection(bodies_.at(b), worldReference);
     j.targetAngle = targetAngle;
-    j.maxServoTorque = std::max(0.0, maxServoTorque);
-    j.positionGain = std::max(0.0, positionGain);
-    j.dampingGain = std::max(0.0, dampingGain);
-    j.integralGain = std::max(0.0, integralGain);
-    j.integralClamp = std::max(1e-5, integralClamp);
-    j.positionErrorSmoothing = std::max(0.0, positionErrorSmoothing);
-    j.maxCorrectionAngle = std::max(0.01, maxCorrectionAngle);
-    j.angleStabilizationScale = std::clamp(angleStabilizationScale, 0.0, 1.0);
-    j.maxServoSpeed = std::max(0.0, maxServoSpeed);
+    j.maxServoTorque = std::max<Real>(0.0, maxServoTorque);
+    j.positionGain = std::max<Real>(0.0, positionGain);
+    j.dampingGain = std::max<Real>(0.0, dampingGain);
+    j.integralGain = std::max<Real>(0.0, integralGain);
+    j.integralClamp = std::max<Real>(1e-5, integralClamp);
+    j.positionErrorSmoothing = std::max<Real>(0.0, positionErrorSmoothing);
+    j.maxCorrectionAngle = std::max<Real>(0.01, maxCorrectionAngle);
+    j.angleStabilizationScale = std::clamp<Real>(angleStabilizationScale, 0.0, 1.0);
+    j.maxServoSpeed = std::max<Real>(0.0, maxServoSpeed);
     servoJoints_.push_back(j);
     InvalidateServoAngleSampleCache();
     InvalidateServoPositionTopologyCache();
@@ -497,7 +553,7 @@ void World::PrepareServoJointControlSamples() {
         Real raw = angle - j.targetAngle;
         raw = std::remainder(raw, 6.28318530717958647692);
         if (j.positionErrorSmoothing > 0.0) {
-            const Real alpha = std::min(j.positionErrorSmoothing, 1.0);
+            const Real alpha = std::min<Real>(j.positionErrorSmoothing, 1.0);
             j.smoothedAngleError = j.smoothedAngleError + alpha * (raw - j.smoothedAngleError);
         } else {
             j.smoothedAngleError = raw;
@@ -521,7 +577,7 @@ void World::AccumulateServoAngleIntegrals(Real dt) {
         if (j.integralGain <= 0.0) {
             continue;
         }
-        const Real saturationRatio = std::abs(j.servoImpulseSum) / std::max(j.maxServoTorque, 1e-6);
+        const Real saturationRatio = std::abs(j.servoImpulseSum) / std::max<Real>(j.maxServoTorque, 1e-6);
         if (saturationRatio > 0.95) {
             j.integralAccum *= 0.9;
             continue;
@@ -546,14 +602,25 @@ void World::Step(Real dt, int solverIterations) {
     const auto step_scope =
         resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::Step));
     (void)step_scope;
+    const std::uint64_t heapAllocationsAtStepStart = world_resource_monitoring::threadHeapAllocationCount;
+    warmStartHeapAllocationsThisStep_ = 0;
+    broadphaseHeapAllocationsThisStep_ = 0;
+    {
+        const std::uint64_t totalSteps = solverIterationStats_.totalSteps;
+        const std::uint64_t totalIterations = solverIterationStats_.totalIterations;
+        solverIterationStats_ = {};
+        solverIterationStats_.totalSteps = totalSteps + 1;
+        solverIterationStats_.totalIterations = totalIterations;
+    }
+    contactReuseStats_.lastStepContactBuilds = 0;
+    contactReuseStats_.lastStepContactReuses = 0;
 
     AssertBodyInvariants();
-    previousContacts_ = contacts_;
-    previousManifolds_ = manifolds_;
-    CapturePersistentPointImpulseState(previousManifolds_);
+    CapturePersistentPointImpulseState(manifoldStore_.manifolds);
 
     const int substeps = ComputeSubsteps(dt);
     const Real subDt = dt / static_cast<float>(substeps);
+    solverIterationStats_.lastStepSubsteps = static_cast<std::uint32_t>(substeps);
 
     // Servo warm-start terms are accumulated inside a single Step to help the iterative solve converge.
     // Re-using the full cached impulse state across outer Steps can inject energy into free-floating
@@ -577,9 +644,7 @@ void World::Step(Real dt, int solverIterations) {
 #endif
         currentSubstepDt_ = subDt;
         if (stepIndex == 0) {
-            previousContacts_ = contacts_;
-            previousManifolds_ = manifolds_;
-            CapturePersistentPointImpulseState(previousManifolds_);
+            CapturePersistentPointImpulseState(manifoldStore_.manifolds);
         }
         // Body orientation is constant from here until IntegrateOrientation() runs at the end of
         // the substep, so refresh the per-body world inverse inertia cache once and let every
@@ -592,22 +657,39 @@ void World::Step(Real dt, int solverIterations) {
             (void)scope;
         }
         BeginSplitImpulseSubstep();
-        contacts_.clear();
-        manifolds_.clear();
-        {
-            const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::UpdateBroadphaseProxies));
-            UpdateBroadphaseProxies();
-            (void)scope;
-        }
-        {
-            const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::GenerateContacts));
-            GenerateContacts();
-            (void)scope;
-        }
-        {
-            const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::BuildManifolds));
-            BuildManifolds();
-            (void)scope;
+        if (CanReuseSubstepContacts()) {
+            // Nothing has moved far enough to change the contact set: keep the manifolds (and
+            // their accumulated impulses) and only refresh each point's depth from its anchors.
+            ReprojectReusedContacts();
+            ++substepContactReuse_.consecutiveReuses;
+            ++contactReuseStats_.lastStepContactReuses;
+            ++contactReuseStats_.totalContactReuses;
+        } else {
+            // The last build becomes the previous one. Swapping keeps every pool element in place,
+            // so the previous manifolds' contact slices stay valid without copying anything.
+            contacts_.swap(previousContacts_);
+            manifoldStore_.swap(previousManifoldStore_);
+            contacts_.clear();
+            manifoldStore_.manifolds.clear();
+            {
+                const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::UpdateBroadphaseProxies));
+                const world_resource_monitoring::HeapAllocationScope allocationScope(broadphaseHeapAllocationsThisStep_);
+                UpdateBroadphaseProxies();
+                (void)scope;
+            }
+            {
+                const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::GenerateContacts));
+                GenerateContacts();
+                (void)scope;
+            }
+            {
+                const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::BuildManifolds));
+                BuildManifolds();
+                (void)scope;
+            }
+            CaptureSubstepContactReuseReference();
+            ++contactReuseStats_.lastStepContactBuilds;
+            ++contactReuseStats_.totalContactBuilds;
         }
         {
             const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::BuildIslands));
@@ -617,7 +699,10 @@ void World::Step(Real dt, int solverIterations) {
         // Detect serial kinematic chains (ServoJoint trees) from the updated island topology.
         // Zero behaviour impact in Phase 1a; fills articulationChains_ for Phase 1b+.
         BuildArticulationChains();
+        BuildReducedArticulationTrees();
         PrepareIslandOrders();
+        PrepareIslandColorings();
+        PrepareIslandSolveBatches();
         {
             const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::WarmStartContacts));
             WarmStartContacts();
@@ -638,7 +723,11 @@ void World::Step(Real dt, int solverIterations) {
         {
             const auto scope = resource_profiler_.scope(
                 world_resource_monitoring::toIndex(world_resource_monitoring::Section::PrepareArticulatedInertias));
-            PrepareArticulatedInertias();
+            if (articulationConfig_.enableReducedCoordinateTrees) {
+                PrepareReducedArticulationTrees();
+            } else {
+                PrepareArticulatedInertias();
+            }
             (void)scope;
         }
         // Same idea for contacts: cache ra, rb, raCrossN, rbCrossN, normalMass once per
@@ -646,24 +735,15 @@ void World::Step(Real dt, int solverIterations) {
         // recompute the constraint Jacobian every PGS iteration.
         PrepareContactSolves();
 
-        solverRelaxationPassActive_ = false;
-        {
-            const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::SolveIslands));
-            for (int i = 0; i < solverIterations; ++i) {
-                SolveIslands();
-            }
-            (void)scope;
+        // Everything up to here may still write Body velocities (warm start, articulation
+        // pre-correction); the iteration loop below only touches solver body state.
+        if (solverBodyConfig_.useSoAMirror) {
+            solverBodies_.Gather(bodies_);
         }
-        if (contactSolverConfig_.enableRelaxationPass && contactSolverConfig_.relaxationIterations > 0) {
-            solverRelaxationPassActive_ = true;
-            {
-                const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::RelaxationPass));
-                for (std::uint8_t i = 0; i < contactSolverConfig_.relaxationIterations; ++i) {
-                    SolveIslands();
-                }
-                (void)scope;
-            }
-            solverRelaxationPassActive_ = false;
+        SolveVelocityIterations(solverIterations);
+        reducedArtImpulseRouting_ = false;
+        if (solverBodies_.active) {
+            solverBodies_.Scatter(bodies_);
         }
         {
             const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::ApplySplitStabilization));
@@ -695,6 +775,7 @@ void World::Step(Real dt, int solverIterations) {
         {
             const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::PositionalCorrection));
             PositionalCorrection();
+            ProjectReducedArticulationPoses();
             (void)scope;
         }
         {
@@ -712,13 +793,20 @@ void World::Step(Real dt, int solverIterations) {
             ClampBodyVelocities();
             (void)scope;
         }
-        previousContacts_ = contacts_;
-        previousManifolds_ = manifolds_;
-        CapturePersistentPointImpulseState(previousManifolds_);
+        CapturePersistentPointImpulseState(manifoldStore_.manifolds);
         AssertBodyInvariants();
     }
 
     AccumulateServoAngleIntegrals(dt);
+
+    const std::uint64_t stepAllocations =
+        world_resource_monitoring::threadHeapAllocationCount - heapAllocationsAtStepStart;
+    heapAllocationStats_.lastStep = stepAllocations;
+    heapAllocationStats_.lastStepWarmStart = warmStartHeapAllocationsThisStep_;
+    heapAllocationStats_.lastStepBroadphase = broadphaseHeapAllocationsThisStep_;
+    heapAllocationStats_.maxStep = std::max(heapAllocationStats_.maxStep, stepAllocations);
+    ++heapAllocationStats_.totalSteps;
+    heapAllocationStats_.totalAllocations += stepAllocations;
 }
 
 world_resource_monitoring::SectionSummary World::SnapshotResourceSections(bool reset_window) const {
@@ -749,7 +837,7 @@ World::TopologySnapshot World::SnapshotTopology() const {
     TopologySnapshot snapshot{};
     snapshot.bodyCount = static_cast<std::uint32_t>(bodies_.size());
     snapshot.contactCount = static_cast<std::uint32_t>(contacts_.size());
-    snapshot.manifoldCount = static_cast<std::uint32_t>(manifolds_.size());
+    snapshot.manifoldCount = static_cast<std::uint32_t>(manifoldStore_.manifolds.size());
     snapshot.islandCount = static_cast<std::uint32_t>(islands_.size());
 
     for (const Body& body : bodies_) {
@@ -772,6 +860,15 @@ World::TopologySnapshot World::SnapshotTopology() const {
             + island.servos.size());
         snapshot.maxIslandJointCount = std::max(snapshot.maxIslandJointCount, jointCount);
         snapshot.maxIslandServoCount = std::max(snapshot.maxIslandServoCount, static_cast<std::uint32_t>(island.servos.size()));
+        const std::uint64_t solveCost = EstimateIslandSolveCost(island);
+        snapshot.totalIslandSolveCost += solveCost;
+        snapshot.maxIslandSolveCost = std::max(snapshot.maxIslandSolveCost, solveCost);
+    }
+    for (const IslandColoring& coloring : islandColorings_) {
+        snapshot.maxIslandContactColorCount = std::max(
+            snapshot.maxIslandContactColorCount, static_cast<std::uint32_t>(coloring.manifolds.ColorCount()));
+        snapshot.maxIslandJointColorCount = std::max(snapshot.maxIslandJointColorCount,
+            static_cast<std::uint32_t>(coloring.hinges.ColorCount() + coloring.servos.ColorCount()));
     }
 
     return snapshot;
@@ -806,7 +903,7 @@ std::size_t World::BroadphasePairCount() const {
 }
 
 const std::vector<Manifold>& World::DebugManifolds() const {
-    return manifolds_;
+    return manifoldStore_.manifolds;
 }
 
 std::size_t World::BruteForcePairCount() const {
@@ -948,22 +1045,22 @@ int World::ComputeSubsteps(Real dt) const {
         }
         Real characteristic = 1.0;
         if (body.shape == ShapeType::Sphere) {
-            characteristic = std::max(body.radius, 0.05);
+            characteristic = std::max<Real>(body.radius, 0.05);
         } else if (body.shape == ShapeType::Box) {
-            characteristic = std::max({body.halfExtents.x, body.halfExtents.y, body.halfExtents.z, 0.05});
+            characteristic = std::max<Real>({body.halfExtents.x, body.halfExtents.y, body.halfExtents.z, 0.05});
         } else if (body.shape == ShapeType::Capsule) {
-            characteristic = std::max(body.radius, 0.05);
+            characteristic = std::max<Real>(body.radius, 0.05);
         } else if (body.shape == ShapeType::Cylinder || body.shape == ShapeType::HalfCylinder) {
-            characteristic = std::max({body.radius, body.halfHeight, 0.05});
+            characteristic = std::max<Real>({body.radius, body.halfHeight, 0.05});
         } else if (body.shape == ShapeType::Compound) {
             const AABB bounds = body.ComputeAABB();
             const Vec3 halfExtents = 0.5 * (bounds.max - bounds.min);
-            characteristic = std::max({halfExtents.x, halfExtents.y, halfExtents.z, 0.05});
+            characteristic = std::max<Real>({halfExtents.x, halfExtents.y, halfExtents.z, 0.05});
         }
         const Real travel = Length(body.velocity) * dt;
         maxRatio = std::max(maxRatio, travel / (characteristic * kMaxSubstepDistanceFactor));
     }
-    return std::clamp(static_cast<int>(std::ceil(std::max(1.0, maxRatio))), 1, 8);
+    return std::clamp(static_cast<int>(std::ceil(std::max<Real>(1.0, maxRatio))), 1, 8);
 }
 
 } // namespace minphys3d
@@ -3,8 +3,30 @@
 
 #include <algorithm>
 #include <chrono>
+#include <limits>
 
 namespace minphys3d {
+namespace {
+
+bool PairLess(const Pair& lhs, const Pair& rhs) {
+    return lhs.a < rhs.a || (lhs.a == rhs.a && lhs.b < rhs.b);
+}
+
+bool PairEqual(const Pair& lhs, const Pair& rhs) {
+    return lhs.a == rhs.a && lhs.b == rhs.b;
+}
+
+// `SweepAndPruneState::proxyFlags` bits.
+constexpr std::uint8_t kSweptProxy = 1u;
+constexpr std::uint8_t kStaticProxy = 2u;
+constexpr std::uint8_t kSleepingProxy = 4u;
+
+Real AxisComponent(const Vec3& v, int axis) {
+    return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+}
+
+} // namespace
+
 Real World::ComputeProxyMargin(const Body& body) const {
     const Real linearSweep = Length(body.velocity) * currentSubstepDt_ * broadphaseConfig_.linearVelocityMarginScale;
     Real radiusLike = 0.5;
@@ -19,7 +41,7 @@ Real World::ComputeProxyMargin(const Body& body) const {
     } else if (body.shape == ShapeType::Compound) {
         const AABB bounds = body.ComputeAABB();
         const Vec3 halfExtents = 0.5 * (bounds.max - bounds.min);
-        radiusLike = std::max(Length(halfExtents), 0.5);
+        radiusLike = std::max<Real>(Length(halfExtents), 0.5);
     }
     const Real angularSweep = Length(body.angularVelocity) * radiusLike * currentSubstepDt_ * broadphaseConfig_.angularVelocityMarginScale;
     const Real sweptMargin = linearSweep + angularSweep;
@@ -106,8 +128,8 @@ void World::UpdateBroadphaseQualityMetrics() {
     std::uint32_t maxDepth = 0;
     std::uint32_t leafCount = 0;
     std::uint64_t depthSum = 0;
-    std::vector<std::pair<std::int32_t, std::uint32_t>> stack;
-    stack.reserve(treeNodes_.size());
+    std::vector<std::pair<std::int32_t, std::uint32_t>>& stack = broadphaseDepthStack_;
+    stack.clear();
     stack.push_back({rootNode_, 0u});
     while (!stack.empty()) {
         const auto [nodeId, depth] = stack.back();
@@ -378,10 +400,10 @@ std::int32_t World::Balance(std::int32_t iA) {
         return iA;
     }
 
-std::vector<Pair> World::ComputePotentialPairs() const {
+const std::vector<Pair>& World::ComputePotentialPairs() const {
     const auto startTime = std::chrono::steady_clock::now();
-    std::vector<Pair> pairs;
     broadphaseMetrics_.queryNodeVisits = 0;
+    broadphaseMetrics_.sweepCandidates = 0;
     broadphaseMetrics_.queryNodeVisitsPerProxy = 0.0;
     broadphaseMetrics_.pairGenerationMs = 0.0;
     broadphaseMetrics_.pairCacheHitRate = 0.0;
@@ -389,43 +411,88 @@ std::vector<Pair> World::ComputePotentialPairs() const {
     broadphaseMetrics_.pairCacheHits = 0;
     broadphaseMetrics_.usedMovedSetOnlyUpdate = false;
     if (bodies_.empty() || rootNode_ == -1) {
-        return pairs;
+        cachedPotentialPairs_.clear();
+        return cachedPotentialPairs_;
     }
 
-    std::unordered_set<std::uint32_t> movedSet;
-    movedSet.reserve(movedProxyIds_.size() * 2);
-    for (const std::uint32_t movedId : movedProxyIds_) {
-        if (movedId < proxies_.size()) {
-            movedSet.insert(movedId);
-        }
+    std::vector<Pair>& pairs = potentialPairScratch_;
+    pairs.clear();
+    if (broadphaseConfig_.backend == BroadphaseBackend::SweepAndPrune) {
+        CollectSweepAndPrunePairs(pairs);
+    } else {
+        CollectDynamicTreePairs(pairs);
     }
 
-    std::unordered_set<std::uint64_t> seenPairs;
-    seenPairs.reserve(std::max<std::size_t>(bodies_.size() * 4, cachedPotentialPairKeySet_.size() * 2));
-    if (broadphaseConfig_.enablePairCacheReuseForQuasiStatic && !cachedPotentialPairs_.empty()) {
-        for (const Pair& cachedPair : cachedPotentialPairs_) {
-            ++broadphaseMetrics_.pairCacheQueries;
-            if (!IsPairEligible(cachedPair.a, cachedPair.b)) {
-                continue;
-            }
-            if (broadphaseConfig_.enableMovedSetOnlyUpdates
-                && !movedSet.empty()
-                && (movedSet.find(cachedPair.a) != movedSet.end() || movedSet.find(cachedPair.b) != movedSet.end())) {
-                continue;
-            }
-            const std::uint64_t key = MakePairKey(cachedPair.a, cachedPair.b);
-            if (seenPairs.insert(key).second) {
-                ++broadphaseMetrics_.pairCacheHits;
-                pairs.push_back(cachedPair);
-            }
+    const std::uint32_t validProxyCount = broadphaseMetrics_.validProxyCount;
+    if (validProxyCount > 0) {
+        broadphaseMetrics_.queryNodeVisitsPerProxy =
+            static_cast<float>(broadphaseMetrics_.queryNodeVisits) / static_cast<float>(validProxyCount);
+    }
+    if (broadphaseMetrics_.pairCacheQueries > 0) {
+        broadphaseMetrics_.pairCacheHitRate =
+            static_cast<float>(broadphaseMetrics_.pairCacheHits) / static_cast<float>(broadphaseMetrics_.pairCacheQueries);
+    }
+
+    // The scratch buffer becomes the cache and the old cache's storage becomes next query's
+    // scratch, so steady-state queries allocate nothing.
+    const bool pairsUnchanged =
+        pairs.size() == cachedPotentialPairs_.size()
+        && std::equal(pairs.begin(), pairs.end(), cachedPotentialPairs_.begin(), PairEqual);
+    if (!pairsUnchanged) {
+        std::swap(cachedPotentialPairs_, potentialPairScratch_);
+    }
+
+    const auto endTime = std::chrono::steady_clock::now();
+    broadphaseMetrics_.pairGenerationMs =
+        std::chrono::duration<Real, std::milli>(endTime - startTime).count();
+
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+    // Outside the timed region; both sides are sorted by (a, b).
+    if (broadphaseConfig_.validatePairsAgainstBruteForce) {
+        const std::vector<Pair> bruteForcePairs = ComputePotentialPairsBruteForce();
+        assert(std::equal(cachedPotentialPairs_.begin(), cachedPotentialPairs_.end(),
+                          bruteForcePairs.begin(), bruteForcePairs.end(), PairEqual));
+    }
+#endif
+    return cachedPotentialPairs_;
+}
+
+void World::CollectDynamicTreePairs(std::vector<Pair>& out) const {
+    // Move buffer: `movedProxyIds_` may list a proxy twice (refit and activity change), so it is
+    // deduplicated through per-proxy stamps. A proxy is moved this query iff its stamp equals
+    // `proxyMoveGeneration_`; bumping the generation clears every stamp at once.
+    if (proxyMoveStamps_.size() < proxies_.size()) {
+        proxyMoveStamps_.resize(proxies_.size(), 0u);
+    }
+    if (++proxyMoveGeneration_ == 0u) {
+        std::fill(proxyMoveStamps_.begin(), proxyMoveStamps_.end(), 0u);
+        proxyMoveGeneration_ = 1u;
+    }
+    const std::uint32_t moveGeneration = proxyMoveGeneration_;
+    uniqueMovedProxyIds_.clear();
+    for (const std::uint32_t movedId : movedProxyIds_) {
+        if (movedId < proxies_.size() && proxyMoveStamps_[movedId] != moveGeneration) {
+            proxyMoveStamps_[movedId] = moveGeneration;
+            uniqueMovedProxyIds_.push_back(movedId);
         }
     }
+    const auto isMoved = [&](std::uint32_t bodyId) { return proxyMoveStamps_[bodyId] == moveGeneration; };
+
+    const bool useMovedSetOnlyTraversal =
+        broadphaseConfig_.enableMovedSetOnlyUpdates
+        && broadphaseConfig_.enablePairCacheReuseForQuasiStatic
+        && !cachedPotentialPairs_.empty()
+        && !uniqueMovedProxyIds_.empty()
+        && uniqueMovedProxyIds_.size() < proxies_.size();
 
-    std::vector<std::int32_t> stack;
-    stack.reserve(treeNodes_.size());
+    std::vector<Pair>& traversed = traversedPairScratch_;
+    traversed.clear();
+    std::vector<std::int32_t>& stack = pairQueryStack_;
     // Dynamic-tree traversal uses fat-AABB overlap only. Collision masks/groups apply in
     // IsPairEligible at leaf pairs (and when revalidating the pair cache), not via internal-node pruning.
-    auto traverseProxy = [&](std::uint32_t bodyId) {
+    // Both ends of a pair may be traversed; only the lower id emits it then, so the traversal
+    // itself never produces duplicates.
+    auto traverseProxy = [&](std::uint32_t bodyId, bool traversingAll) {
         if (bodyId >= proxies_.size()) {
             return;
         }
@@ -447,13 +514,11 @@ std::vector<Pair> World::ComputePotentialPairs() const {
             }
             if (treeNodes_[nodeId].IsLeaf()) {
                 const std::uint32_t other = static_cast<std::uint32_t>(treeNodes_[nodeId].bodyId);
-                if (bodyId == other || !IsPairEligible(bodyId, other)) {
+                if (bodyId == other || (other < bodyId && (traversingAll || isMoved(other)))
+                    || !IsPairEligible(bodyId, other)) {
                     continue;
                 }
-                const std::uint64_t key = MakePairKey(bodyId, other);
-                if (seenPairs.insert(key).second) {
-                    pairs.push_back({std::min(bodyId, other), std::max(bodyId, other)});
-                }
+                traversed.push_back({std::min(bodyId, other), std::max(bodyId, other)});
                 continue;
             }
             stack.push_back(treeNodes_[nodeId].left);
@@ -461,59 +526,309 @@ std::vector<Pair> World::ComputePotentialPairs() const {
         }
     };
 
-    const bool useMovedSetOnlyTraversal =
-        broadphaseConfig_.enableMovedSetOnlyUpdates
-        && broadphaseConfig_.enablePairCacheReuseForQuasiStatic
-        && !cachedPotentialPairs_.empty()
-        && !movedSet.empty()
-        && movedSet.size() < proxies_.size();
-
     if (useMovedSetOnlyTraversal) {
         broadphaseMetrics_.usedMovedSetOnlyUpdate = true;
-        for (const std::uint32_t movedId : movedSet) {
-            traverseProxy(movedId);
+        for (const std::uint32_t movedId : uniqueMovedProxyIds_) {
+            traverseProxy(movedId, false);
         }
     } else {
         for (std::uint32_t bodyId = 0; bodyId < proxies_.size(); ++bodyId) {
-            traverseProxy(bodyId);
+            traverseProxy(bodyId, true);
         }
     }
 
-    const std::uint32_t validProxyCount = broadphaseMetrics_.validProxyCount;
-    if (validProxyCount > 0) {
-        broadphaseMetrics_.queryNodeVisitsPerProxy =
-            static_cast<float>(broadphaseMetrics_.queryNodeVisits) / static_cast<float>(validProxyCount);
+    std::sort(traversed.begin(), traversed.end(), PairLess);
+
+    // Sorted pair array: merge the still-valid cached pairs (already sorted) with the traversal
+    // output into `out`, dropping cached pairs the traversal rediscovered. With moved-set
+    // traversal the kept pairs never touch a moved proxy, so the two sides are disjoint.
+    std::size_t nextTraversed = 0;
+    if (broadphaseConfig_.enablePairCacheReuseForQuasiStatic && !cachedPotentialPairs_.empty()) {
+        const bool dropMovedPairs = broadphaseConfig_.enableMovedSetOnlyUpdates && !uniqueMovedProxyIds_.empty();
+        for (const Pair& cachedPair : cachedPotentialPairs_) {
+            ++broadphaseMetrics_.pairCacheQueries;
+            if (!IsPairEligible(cachedPair.a, cachedPair.b)) {
+                continue;
+            }
+            if (dropMovedPairs && (isMoved(cachedPair.a) || isMoved(cachedPair.b))) {
+                continue;
+            }
+            ++broadphaseMetrics_.pairCacheHits;
+            while (nextTraversed < traversed.size() && PairLess(traversed[nextTraversed], cachedPair)) {
+                out.push_back(traversed[nextTraversed++]);
+            }
+            if (nextTraversed < traversed.size() && PairEqual(traversed[nextTraversed], cachedPair)) {
+                ++nextTraversed;
+            }
+            out.push_back(cachedPair);
+        }
     }
-    if (broadphaseMetrics_.pairCacheQueries > 0) {
-        broadphaseMetrics_.pairCacheHitRate =
-            static_cast<float>(broadphaseMetrics_.pairCacheHits) / static_cast<float>(broadphaseMetrics_.pairCacheQueries);
+    out.insert(out.end(), traversed.begin() + static_cast<std::ptrdiff_t>(nextTraversed), traversed.end());
+}
+
+void World::CollectSweepAndPrunePairs(std::vector<Pair>& out) const {
+    SweepAndPruneState& sap = sweepAndPrune_;
+
+    // Membership and pair filters, read once per query in body order: drop proxies that left
+    // the tree and append the ones that joined. The insertion sort below moves a few newcomers
+    // into place; many trigger a full sort.
+    sap.inOrder.resize(proxies_.size(), 0u);
+    sap.proxyFlags.resize(proxies_.size());
+    sap.proxyGroup.resize(proxies_.size());
+    sap.proxyMask.resize(proxies_.size());
+    for (std::uint32_t bodyId = 0; bodyId < proxies_.size(); ++bodyId) {
+        const BroadphaseProxy& proxy = proxies_[bodyId];
+        const Body& body = bodies_[bodyId];
+        std::uint8_t flags = 0u;
+        if (proxy.valid && proxy.leaf >= 0 && !body.isTerrainAttachment) {
+            flags = kSweptProxy | (body.invMass == 0.0 ? kStaticProxy : 0u) | (body.isSleeping ? kSleepingProxy : 0u);
+        }
+        sap.proxyFlags[bodyId] = flags;
+        sap.proxyGroup[bodyId] = body.collisionGroup;
+        sap.proxyMask[bodyId] = body.collisionMask;
+    }
+    std::size_t keptCount = 0;
+    for (const std::uint32_t bodyId : sap.order) {
+        if (bodyId < proxies_.size() && (sap.proxyFlags[bodyId] & kSweptProxy) != 0u) {
+            sap.order[keptCount++] = bodyId;
+        } else if (bodyId < sap.inOrder.size()) {
+            sap.inOrder[bodyId] = 0u;
+        }
+    }
+    sap.order.resize(keptCount);
+    std::size_t addedCount = 0;
+    for (std::uint32_t bodyId = 0; bodyId < proxies_.size(); ++bodyId) {
+        if (sap.inOrder[bodyId] == 0u && (sap.proxyFlags[bodyId] & kSweptProxy) != 0u) {
+            sap.inOrder[bodyId] = 1u;
+            sap.order.push_back(bodyId);
+            ++addedCount;
+        }
+    }
+    const std::size_t count = sap.order.size();
+    sap.boxStart.assign(1, 0u);
+    sap.bodyId.clear();
+    if (count < 2) {
+        return;
     }
 
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-    const std::vector<Pair> bruteForcePairs = ComputePotentialPairsBruteForce();
-    assert(PairSetFromPairs(pairs) == PairSetFromPairs(bruteForcePairs));
-#endif
+    // Sweep along the axis with the largest spread of fat-box centres; the axis only changes
+    // when another one is clearly better, since a change costs a full sort. Pruning boxes are
+    // slabs across the axis with the next-largest spread.
+    Vec3 centreSum{};
+    Vec3 centreSquareSum{};
+    for (std::uint32_t bodyId = 0; bodyId < proxies_.size(); ++bodyId) {
+        if ((sap.proxyFlags[bodyId] & kSweptProxy) == 0u) {
+            continue;
+        }
+        const AABB& box = proxies_[bodyId].fatBox;
+        const Vec3 centre = 0.5 * (box.min + box.max);
+        centreSum += centre;
+        centreSquareSum += Vec3{centre.x * centre.x, centre.y * centre.y, centre.z * centre.z};
+    }
+    const Real invCount = 1.0 / static_cast<Real>(count);
+    const Vec3 mean = centreSum * invCount;
+    const Vec3 variance = centreSquareSum * invCount - Vec3{mean.x * mean.x, mean.y * mean.y, mean.z * mean.z};
+    int bestAxis = 0;
+    for (int axis = 1; axis < 3; ++axis) {
+        if (AxisComponent(variance, axis) > AxisComponent(variance, bestAxis)) {
+            bestAxis = axis;
+        }
+    }
+    const bool axisChanged =
+        sap.axis < 0 || AxisComponent(variance, bestAxis) > 1.25 * AxisComponent(variance, sap.axis);
+    if (axisChanged || addedCount * 8 > count) {
+        sap.axis = axisChanged ? bestAxis : sap.axis;
+        const int axis = sap.axis;
+        std::sort(sap.order.begin(), sap.order.end(), [this, axis](std::uint32_t lhs, std::uint32_t rhs) {
+            return AxisComponent(proxies_[lhs].fatBox.min, axis) < AxisComponent(proxies_[rhs].fatBox.min, axis);
+        });
+    }
+    const int axisA = sap.axis;
+    const int axisB = AxisComponent(variance, (axisA + 1) % 3) >= AxisComponent(variance, (axisA + 2) % 3)
+        ? (axisA + 1) % 3
+        : (axisA + 2) % 3;
+    const int axisC = 3 - axisA - axisB;
+
+    // Incremental sort: only refit proxies are out of place, so insertion sort on the sweep-axis
+    // min (kept alongside the ids) is close to linear. The fat boxes are then gathered in sweep
+    // order so the packing passes below read them sequentially.
+    sap.orderKey.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        sap.orderKey[i] = AxisComponent(proxies_[sap.order[i]].fatBox.min, axisA);
+    }
+    for (std::size_t i = 1; i < count; ++i) {
+        const Real key = sap.orderKey[i];
+        const std::uint32_t bodyId = sap.order[i];
+        std::size_t j = i;
+        while (j > 0 && sap.orderKey[j - 1] > key) {
+            sap.orderKey[j] = sap.orderKey[j - 1];
+            sap.order[j] = sap.order[j - 1];
+            --j;
+        }
+        sap.orderKey[j] = key;
+        sap.order[j] = bodyId;
+    }
+    sap.orderBox.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        sap.orderBox[i] = proxies_[sap.order[i]].fatBox;
+    }
 
-    const bool pairsUnchanged =
-        pairs.size() == cachedPotentialPairs_.size()
-        && std::equal(pairs.begin(), pairs.end(), cachedPotentialPairs_.begin(),
-                      [](const Pair& lhs, const Pair& rhs) { return lhs.a == rhs.a && lhs.b == rhs.b; });
-    if (!pairsUnchanged) {
-        cachedPotentialPairs_ = std::move(pairs);
-        cachedPotentialPairKeySet_.clear();
-        cachedPotentialPairKeySet_.reserve(cachedPotentialPairs_.size() * 2);
-        for (const Pair& pair : cachedPotentialPairs_) {
-            cachedPotentialPairKeySet_.insert(MakePairKey(pair.a, pair.b));
+    // Multi-box pruning: about `kProxiesPerBox` proxies per slab. A proxy is packed into every
+    // slab it overlaps, in sweep order, so each slab is its own sorted sweep list. Unbounded
+    // proxies (planes) do not widen the slab range.
+    constexpr std::size_t kProxiesPerBox = 64;
+    constexpr std::size_t kMaxBoxes = 64;
+    constexpr Real kUnboundedExtent = 1.0e6;
+    Real slabLow = std::numeric_limits<Real>::max();
+    Real slabHigh = std::numeric_limits<Real>::lowest();
+    for (const AABB& box : sap.orderBox) {
+        const Real lo = AxisComponent(box.min, axisB);
+        const Real hi = AxisComponent(box.max, axisB);
+        if (hi - lo < kUnboundedExtent) {
+            slabLow = std::min<Real>(slabLow, 0.5 * (lo + hi));
+            slabHigh = std::max<Real>(slabHigh, 0.5 * (lo + hi));
         }
     }
+    std::size_t boxCount = std::clamp<std::size_t>(count / kProxiesPerBox, 1, kMaxBoxes);
+    if (!(slabHigh > slabLow)) {
+        boxCount = 1;
+        slabLow = 0.0;
+        slabHigh = 1.0;
+    }
+    const Real slabScale = static_cast<Real>(boxCount) / (slabHigh - slabLow);
+    const auto slabOf = [&](Real value) {
+        const Real scaled = (value - slabLow) * slabScale;
+        if (!(scaled > 0.0)) {
+            return std::size_t{0};
+        }
+        return std::min(static_cast<std::size_t>(scaled), boxCount - 1);
+    };
 
-    const auto endTime = std::chrono::steady_clock::now();
-    broadphaseMetrics_.pairGenerationMs =
-        std::chrono::duration<Real, std::milli>(endTime - startTime).count();
-    if (pairsUnchanged) {
-        return pairs;
+    // Each slab is packed as two sorted segments, moving proxies then static ones
+    // (`boxStart[2 * slab]`, `[2 * slab + 1]`, `[2 * slab + 2]`): static pairs are never eligible,
+    // so the static segment is only swept against the moving one.
+    const auto segmentOf = [&sap](std::uint32_t bodyId, std::size_t slab) {
+        return 2 * slab + ((sap.proxyFlags[bodyId] & kStaticProxy) != 0u ? 1u : 0u);
+    };
+    sap.boxStart.assign(2 * boxCount + 1, 0u);
+    for (std::size_t i = 0; i < count; ++i) {
+        const AABB& box = sap.orderBox[i];
+        const std::size_t first = slabOf(AxisComponent(box.min, axisB));
+        const std::size_t last = slabOf(AxisComponent(box.max, axisB));
+        for (std::size_t slab = first; slab <= last; ++slab) {
+            ++sap.boxStart[segmentOf(sap.order[i], slab) + 1];
+        }
     }
-    return cachedPotentialPairs_;
+    for (std::size_t segment = 0; segment < 2 * boxCount; ++segment) {
+        sap.boxStart[segment + 1] += sap.boxStart[segment];
+    }
+    const std::size_t entryCount = sap.boxStart[2 * boxCount];
+    sap.entrySource.resize(entryCount);
+    sap.boxFill.assign(sap.boxStart.begin(), sap.boxStart.end() - 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        const AABB& box = sap.orderBox[i];
+        const std::size_t first = slabOf(AxisComponent(box.min, axisB));
+        const std::size_t last = slabOf(AxisComponent(box.max, axisB));
+        for (std::size_t slab = first; slab <= last; ++slab) {
+            sap.entrySource[sap.boxFill[segmentOf(sap.order[i], slab)]++] = static_cast<std::uint32_t>(i);
+        }
+    }
+    // Fill the packed arrays front to back from the placement above.
+    sap.bodyId.resize(entryCount);
+    sap.minA.resize(entryCount);
+    sap.maxA.resize(entryCount);
+    sap.minB.resize(entryCount);
+    sap.maxB.resize(entryCount);
+    sap.minC.resize(entryCount);
+    sap.maxC.resize(entryCount);
+    sap.flags.resize(entryCount);
+    sap.group.resize(entryCount);
+    sap.mask.resize(entryCount);
+    for (std::size_t e = 0; e < entryCount; ++e) {
+        const std::uint32_t i = sap.entrySource[e];
+        const std::uint32_t bodyId = sap.order[i];
+        const AABB& box = sap.orderBox[i];
+        sap.bodyId[e] = bodyId;
+        sap.minA[e] = AxisComponent(box.min, axisA);
+        sap.maxA[e] = AxisComponent(box.max, axisA);
+        sap.minB[e] = AxisComponent(box.min, axisB);
+        sap.maxB[e] = AxisComponent(box.max, axisB);
+        sap.minC[e] = AxisComponent(box.min, axisC);
+        sap.maxC[e] = AxisComponent(box.max, axisC);
+        sap.flags[e] = sap.proxyFlags[bodyId];
+        sap.group[e] = sap.proxyGroup[bodyId];
+        sap.mask[e] = sap.proxyMask[bodyId];
+    }
+
+    // Entries `i` and `j` already overlap on the sweep axis. The rest of `IsPairEligible` runs on
+    // the packed arrays: both asleep, the other two axes, collision filters. A pair spanning
+    // several slabs is reported only from the slab holding the larger of the two B mins.
+    std::uint32_t candidates = 0;
+    const auto testCandidate = [&](std::size_t i, std::size_t j, std::size_t slab) {
+        ++candidates;
+        if ((sap.flags[i] & sap.flags[j] & kSleepingProxy) != 0u
+            || sap.minB[j] > sap.maxB[i] || sap.maxB[j] < sap.minB[i]
+            || sap.minC[j] > sap.maxC[i] || sap.maxC[j] < sap.minC[i]
+            || (sap.group[i] & sap.mask[j]) == 0u || (sap.group[j] & sap.mask[i]) == 0u) {
+            return;
+        }
+        if (boxCount > 1 && slabOf(std::max(sap.minB[i], sap.minB[j])) != slab) {
+            return;
+        }
+        const std::uint32_t a = sap.bodyId[i];
+        const std::uint32_t b = sap.bodyId[j];
+        sap.sweptPairs.push_back({std::min(a, b), std::max(a, b)});
+    };
+    sap.sweptPairs.clear();
+    for (std::size_t slab = 0; slab < boxCount; ++slab) {
+        const std::size_t movingBegin = sap.boxStart[2 * slab];
+        const std::size_t movingEnd = sap.boxStart[2 * slab + 1];
+        const std::size_t fixedEnd = sap.boxStart[2 * slab + 2];
+        // Moving against moving: every later entry whose min is within this entry's max.
+        for (std::size_t i = movingBegin; i < movingEnd; ++i) {
+            for (std::size_t j = i + 1; j < movingEnd && sap.minA[j] <= sap.maxA[i]; ++j) {
+                testCandidate(i, j, slab);
+            }
+        }
+        // Moving against static, split by which of the two starts first on the sweep axis so
+        // each overlapping pair is visited once; both cursors only move forward.
+        std::size_t cursor = movingEnd;
+        for (std::size_t i = movingBegin; i < movingEnd; ++i) {
+            while (cursor < fixedEnd && sap.minA[cursor] < sap.minA[i]) {
+                ++cursor;
+            }
+            for (std::size_t j = cursor; j < fixedEnd && sap.minA[j] <= sap.maxA[i]; ++j) {
+                testCandidate(i, j, slab);
+            }
+        }
+        cursor = movingBegin;
+        for (std::size_t j = movingEnd; j < fixedEnd; ++j) {
+            while (cursor < movingEnd && sap.minA[cursor] <= sap.minA[j]) {
+                ++cursor;
+            }
+            for (std::size_t i = cursor; i < movingEnd && sap.minA[i] <= sap.maxA[j]; ++i) {
+                testCandidate(i, j, slab);
+            }
+        }
+    }
+    broadphaseMetrics_.sweepCandidates = candidates;
+
+    // Sweep order is not pair order: counting-sort by `b`, then stably by `a`, into `out`.
+    const auto countingSortPairs = [&sap](const std::vector<Pair>& from, std::vector<Pair>& to, bool byLowerId) {
+        sap.pairBucketStart.assign(sap.inOrder.size() + 1, 0u);
+        for (const Pair& pair : from) {
+            ++sap.pairBucketStart[(byLowerId ? pair.a : pair.b) + 1];
+        }
+        for (std::size_t id = 0; id + 1 < sap.pairBucketStart.size(); ++id) {
+            sap.pairBucketStart[id + 1] += sap.pairBucketStart[id];
+        }
+        to.resize(from.size());
+        for (const Pair& pair : from) {
+            to[sap.pairBucketStart[byLowerId ? pair.a : pair.b]++] = pair;
+        }
+    };
+    countingSortPairs(sap.sweptPairs, sap.pairSortScratch, false);
+    countingSortPairs(sap.pairSortScratch, out, true);
 }
 
 bool World::IsPairEligible(std::uint32_t a, std::uint32_t b) const {
@@ -3,7 +3,9 @@
 #include "minphys3d/core/contact_pipeline.hpp"
 #include "minphys3d/core/subsystems.hpp"
 #include "minphys3d/core/world.hpp"
+#include "minphys3d/core/world_solver_hooks.hpp"
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
 #include <limits>
@@ -13,7 +15,27 @@
 namespace minphys3d {
 namespace {
 
-ConvexSupport BuildConvexSupport(const Body& body) {
+// Shapes per leaf of a compound's local BVH; bodies with fewer than `kCompoundBvhMinShapes`
+// shapes get no tree and are scanned.
+constexpr std::uint32_t kCompoundBvhLeafShapes = 4;
+constexpr std::uint32_t kCompoundBvhMinShapes = 8;
+
+/// Geometry of a primitive body; `bounds` and `encodedFeature` are left for the caller.
+CollisionShapeView PrimitiveShapeView(const Body& body) {
+    CollisionShapeView view{};
+    view.shape = body.shape;
+    view.position = body.position;
+    view.shapeOrigin = (body.shape == ShapeType::HalfCylinder) ? BodyWorldShapeOrigin(body) : body.position;
+    view.orientation = body.orientation;
+    view.radius = body.radius;
+    view.halfHeight = body.halfHeight;
+    view.halfExtents = body.halfExtents;
+    view.planeNormal = body.planeNormal;
+    view.planeOffset = body.planeOffset;
+    return view;
+}
+
+ConvexSupport BuildConvexSupport(const CollisionShapeView& body) {
     if (body.shape == ShapeType::Sphere) {
         return ConvexSupport{
             body.position,
@@ -89,7 +111,7 @@ ConvexSupport BuildConvexSupport(const Body& body) {
     }
 
     if (body.shape == ShapeType::HalfCylinder) {
-        const Vec3 shapeOrigin = BodyWorldShapeOrigin(body);
+        const Vec3 shapeOrigin = body.shapeOrigin;
         return ConvexSupport{
             shapeOrigin,
             body.orientation,
@@ -162,54 +184,125 @@ ConvexSupport BuildConvexSupport(const Body& body) {
     return {};
 }
 
+ConvexSupport BuildConvexSupport(const Body& body) {
+    return BuildConvexSupport(PrimitiveShapeView(body));
+}
+
 std::uint32_t EncodeShapeFeature(bool fromCompound, std::uint32_t childIndex, ShapeType shape) {
     const std::uint32_t compactShape = static_cast<std::uint32_t>(shape) & 0xffu;
     const std::uint32_t childBits = fromCompound ? std::min(childIndex + 1u, 0x00ffffffu) : 0u;
     return (childBits << 8u) | compactShape;
 }
 
-Body MaterializeCompoundChild(const Body& parent, const CompoundChild& child) {
-    Body resolved = parent;
-    resolved.shape = child.shape;
-    resolved.position = parent.position + Rotate(parent.orientation, child.localPosition);
-    resolved.orientation = Normalize(parent.orientation * child.localOrientation);
-    resolved.radius = child.radius;
-    resolved.halfHeight = child.halfHeight;
-    resolved.halfExtents = child.halfExtents;
-    resolved.compoundChildren.clear();
-    return resolved;
+AABB ComputeShapeViewAABB(const CollisionShapeView& view) {
+    return ComputePrimitiveAABB(
+        view.shape,
+        view.shapeOrigin,
+        view.orientation,
+        view.radius,
+        view.halfHeight,
+        view.halfExtents,
+        view.planeNormal,
+        view.planeOffset);
 }
 
-std::vector<ResolvedCollisionShape> ResolveCollisionShapes(const Body& body) {
-    std::vector<ResolvedCollisionShape> resolved{};
+/// Places `child` by its parent's pose. Fields a child does not carry (the plane, and the centre
+/// of mass offset a half-cylinder child's support origin uses) come from the parent.
+CollisionShapeView CompoundChildShapeView(const Body& parent, const CompoundChild& child) {
+    CollisionShapeView view = PrimitiveShapeView(parent);
+    view.shape = child.shape;
+    view.position = parent.position + Rotate(parent.orientation, child.localPosition);
+    view.orientation = Normalize(parent.orientation * child.localOrientation);
+    view.shapeOrigin = (child.shape == ShapeType::HalfCylinder)
+        ? view.position - Rotate(Normalize(view.orientation), parent.centerOfMassLocal)
+        : view.position;
+    view.radius = child.radius;
+    view.halfHeight = child.halfHeight;
+    view.halfExtents = child.halfExtents;
+    return view;
+}
+
+/// Appends `body`'s shape views (the body itself, or each supported compound child; a compound
+/// with none falls back to its box) to `pool`.
+void AppendCollisionShapeViews(const Body& body, std::vector<CollisionShapeView>& pool) {
     if (!IsCompoundShape(body.shape)) {
-        resolved.push_back({body, body.ComputeAABB(), EncodeShapeFeature(false, 0u, body.shape)});
-        return resolved;
+        CollisionShapeView view = PrimitiveShapeView(body);
+        view.bounds = body.ComputeAABB();
+        view.encodedFeature = EncodeShapeFeature(false, 0u, body.shape);
+        pool.push_back(view);
+        return;
     }
 
+    const std::size_t first = pool.size();
     for (std::size_t childIndex = 0; childIndex < body.compoundChildren.size(); ++childIndex) {
         const CompoundChild& child = body.compoundChildren[childIndex];
         if (!IsCompoundChildShapeSupported(child.shape)) {
             continue;
         }
-        Body childBody = MaterializeCompoundChild(body, child);
-        resolved.push_back({
-            childBody,
-            childBody.ComputeAABB(),
-            EncodeShapeFeature(true, static_cast<std::uint32_t>(childIndex), child.shape),
-        });
+        CollisionShapeView view = CompoundChildShapeView(body, child);
+        view.bounds = ComputeShapeViewAABB(view);
+        view.encodedFeature = EncodeShapeFeature(true, static_cast<std::uint32_t>(childIndex), child.shape);
+        pool.push_back(view);
     }
 
-    if (resolved.empty()) {
-        Body fallback = body;
+    if (pool.size() == first) {
+        CollisionShapeView fallback = PrimitiveShapeView(body);
         fallback.shape = ShapeType::Box;
-        fallback.compoundChildren.clear();
-        resolved.push_back({fallback, fallback.ComputeAABB(), EncodeShapeFeature(true, 0u, fallback.shape)});
+        fallback.shapeOrigin = body.position;
+        fallback.bounds = ComputeShapeViewAABB(fallback);
+        fallback.encodedFeature = EncodeShapeFeature(true, 0u, fallback.shape);
+        pool.push_back(fallback);
     }
-    return resolved;
 }
 
-bool ComputeConvexPenetration(const Body& a, const Body& b, EpaPenetrationResult& outPenetration) {
+/// Builds the subtree over `items[begin, end)` (indices into `shapes`) at the back of `nodes`,
+/// splitting at the median centre along the widest axis of the centres. Node links are relative
+/// to `nodeBase`.
+void BuildCollisionShapeBvhNode(
+    const CollisionShapeView* shapes,
+    std::uint32_t* items,
+    std::uint32_t begin,
+    std::uint32_t end,
+    std::size_t nodeBase,
+    std::vector<CollisionShapeBvhNode>& nodes) {
+    const std::size_t nodeIndex = nodes.size();
+    nodes.emplace_back();
+    AABB bounds = shapes[items[begin]].bounds;
+    AABB centres{};
+    centres.min = centres.max = 0.5 * (bounds.min + bounds.max);
+    for (std::uint32_t i = begin + 1u; i < end; ++i) {
+        const AABB& shapeBounds = shapes[items[i]].bounds;
+        bounds = MergeAABB(bounds, shapeBounds);
+        const Vec3 centre = 0.5 * (shapeBounds.min + shapeBounds.max);
+        centres = MergeAABB(centres, AABB{centre, centre});
+    }
+    nodes[nodeIndex].bounds = bounds;
+
+    if (end - begin <= kCompoundBvhLeafShapes) {
+        nodes[nodeIndex].first = begin;
+        nodes[nodeIndex].count = end - begin;
+        return;
+    }
+
+    const Vec3 spread = centres.max - centres.min;
+    const int axis = (spread.x >= spread.y && spread.x >= spread.z) ? 0 : ((spread.y >= spread.z) ? 1 : 2);
+    const auto centreOnAxis = [shapes, axis](std::uint32_t item) {
+        const AABB& b = shapes[item].bounds;
+        return axis == 0 ? b.min.x + b.max.x : (axis == 1 ? b.min.y + b.max.y : b.min.z + b.max.z);
+    };
+    const std::uint32_t mid = begin + (end - begin) / 2u;
+    std::nth_element(items + begin, items + mid, items + end, [&centreOnAxis](std::uint32_t lhs, std::uint32_t rhs) {
+        const Real lhsCentre = centreOnAxis(lhs);
+        const Real rhsCentre = centreOnAxis(rhs);
+        return lhsCentre != rhsCentre ? lhsCentre < rhsCentre : lhs < rhs;
+    });
+    BuildCollisionShapeBvhNode(shapes, items, begin, mid, nodeBase, nodes);
+    nodes[nodeIndex].first = static_cast<std::uint32_t>(nodes.size() - nodeBase);
+    BuildCollisionShapeBvhNode(shapes, items, mid, end, nodeBase, nodes);
+}
+
+bool ComputeConvexPenetration(
+    const CollisionShapeView& a, const CollisionShapeView& b, EpaPenetrationResult& outPenetration) {
     const ConvexSupport supportA = BuildConvexSupport(a);
     const ConvexSupport supportB = BuildConvexSupport(b);
     if (!supportA.IsValid() || !supportB.IsValid()) {
@@ -250,9 +343,21 @@ bool ComputeConvexPenetration(const Body& a, const Body& b, EpaPenetrationResult
 }
 
 const std::vector<float>& TerrainCollisionHeights(const World::TerrainHeightfieldAttachment& terrain) {
+    if (terrain.sharedHeights != nullptr) {
+        return terrain.sharedHeights->CollisionHeights();
+    }
     return terrain.collisionHeightsM.empty() ? terrain.surfaceHeightsM : terrain.collisionHeightsM;
 }
 
+// Revision folded into a terrain cell's contact feature id: per tile for shared buffers, so only
+// contacts on re-written tiles lose their persistence; the whole attachment otherwise.
+std::uint64_t TerrainCellRevision(const World::TerrainHeightfieldAttachment& terrain, int row, int col) {
+    if (terrain.sharedHeights != nullptr) {
+        return terrain.sharedHeights->TileRevision(row, col);
+    }
+    return terrain.revision;
+}
+
 bool SampleTerrainCellBilinear(const World::TerrainHeightfieldAttachment& terrain,
                                 int row,
                                 int col,
@@ -278,8 +383,8 @@ bool SampleTerrainCellBilinear(const World::TerrainHeightfieldAttachment& terrai
 
     const Real cellX0 = terrain.gridOriginWorld.x + static_cast<float>(col) * terrain.cellSizeM;
     const Real cellZ0 = terrain.gridOriginWorld.z + static_cast<float>(row) * terrain.cellSizeM;
-    const Real tx = std::clamp((sampleX - cellX0) * invCell, 0.0, 1.0);
-    const Real tz = std::clamp((sampleZ - cellZ0) * invCell, 0.0, 1.0);
+    const Real tx = std::clamp<Real>((sampleX - cellX0) * invCell, 0.0, 1.0);
+    const Real tz = std::clamp<Real>((sampleZ - cellZ0) * invCell, 0.0, 1.0);
 
     const Real h00 = heights[idx00];
     const Real h10 = heights[idx10];
@@ -299,7 +404,7 @@ bool SampleTerrainCellBilinear(const World::TerrainHeightfieldAttachment& terrai
     return true;
 }
 
-Vec3 SphereTerrainSupportPoint(const Body& sphereBody, const Vec3& direction) {
+Vec3 SphereTerrainSupportPoint(const CollisionShapeView& sphereBody, const Vec3& direction) {
     Vec3 dir = direction;
     if (LengthSquared(dir) <= kEpsilon * kEpsilon) {
         dir = {1.0, 0.0, 0.0};
@@ -319,7 +424,7 @@ bool TerrainCellRangeForAabb(const World::TerrainHeightfieldAttachment& terrain,
         return false;
     }
 
-    const Real cellSize = std::max(terrain.cellSizeM, 1.0e-6);
+    const Real cellSize = std::max<Real>(terrain.cellSizeM, 1.0e-6);
     const Real minX = terrain.gridOriginWorld.x;
     const Real minZ = terrain.gridOriginWorld.z;
     const Real maxX = minX + static_cast<float>(terrain.cols - 1) * cellSize;
@@ -337,6 +442,8 @@ bool TerrainCellRangeForAabb(const World::TerrainHeightfieldAttachment& terrain,
 
 } // namespace
 
+thread_local World::NarrowphaseTaskBuffer* World::threadNarrowphaseBuffer_ = nullptr;
+
 void World::ConvexPlane(std::uint32_t convexBodyId, std::uint32_t planeId) {
     const Body& convex = bodies_[convexBodyId];
     const Body& plane = bodies_[planeId];
@@ -364,7 +471,7 @@ void World::ConvexConvexEPA(std::uint32_t bodyAId, std::uint32_t bodyBId) {
         return;
     }
     EpaPenetrationResult penetration{};
-    if (!ComputeConvexPenetration(ba, bb, penetration)) {
+    if (!ComputeConvexPenetration(PrimitiveShapeView(ba), PrimitiveShapeView(bb), penetration)) {
         return;
     }
     Vec3 normal = penetration.normal;
@@ -387,9 +494,10 @@ void World::ConvexConvexEPA(std::uint32_t bodyAId, std::uint32_t bodyBId) {
 std::uint64_t World::ComputeShapeGeometrySignature(const Body& body) {
     std::uint64_t seed = static_cast<std::uint64_t>(body.shape);
     auto mixFloat = [&seed](Real value) {
-        static_assert(sizeof(Real) == sizeof(std::uint64_t), "Real must be 64-bit for signature mixing");
+        // Widened so the signature has the same bit layout in every precision build.
+        const double wide = static_cast<double>(value);
         std::uint64_t bits = 0;
-        std::memcpy(&bits, &value, sizeof(bits));
+        std::memcpy(&bits, &wide, sizeof(bits));
         seed ^= bits + 0x9e3779b97f4a7c15ull + (seed << 6u) + (seed >> 2u);
     };
     auto mixU64 = [&seed](std::uint64_t value) {
@@ -450,14 +558,22 @@ bool World::ConvexOverlapWithCache(std::uint32_t a, std::uint32_t b) {
         shapeRevisionCounters_[lo],
         shapeRevisionCounters_[hi],
     };
-    auto [it, inserted] = narrowphaseCache_.try_emplace(key);
-    if (inserted && narrowphaseCache_.size() > 4096) {
-        narrowphaseCache_.clear();
-        it = narrowphaseCache_.try_emplace(key).first;
+    NarrowphaseTaskBuffer* const taskBuffer = threadNarrowphaseBuffer_;
+    NarrowphaseCache* cache = nullptr;
+    if (taskBuffer != nullptr) {
+        // Inserted by `PrepareParallelNarrowphaseCache`; each pair owns its entry.
+        cache = &narrowphaseCache_.find(key)->second;
+    } else {
+        auto [it, inserted] = narrowphaseCache_.try_emplace(key);
+        if (inserted && narrowphaseCache_.size() > kNarrowphaseCacheCapacity) {
+            narrowphaseCache_.clear();
+            it = narrowphaseCache_.try_emplace(key).first;
+        }
+        cache = &it->second;
     }
     const ConvexSupport supportA = BuildConvexSupport(bodies_[a]);
     const ConvexSupport supportB = BuildConvexSupport(bodies_[b]);
-    const GjkDistanceResult gjk = GjkDistance(supportA, supportB, {}, &it->second);
+    const GjkDistanceResult gjk = GjkDistance(supportA, supportB, {}, cache);
     if (!gjk.intersecting) {
         return false;
     }
@@ -470,27 +586,116 @@ bool World::ConvexOverlapWithCache(std::uint32_t a, std::uint32_t b) {
                 std::swap(epa.witnessA, epa.witnessB);
                 epa.normal = -epa.normal;
             }
-            convexManifoldSeeds_[ConvexSeedKey{lo, hi}] = epa;
+            if (taskBuffer != nullptr) {
+                taskBuffer->seeds.emplace_back(ConvexSeedKey{lo, hi}, epa);
+            } else {
+                convexManifoldSeeds_[ConvexSeedKey{lo, hi}] = epa;
+            }
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
             if (epa.usedFallback) {
-                ++solverTelemetry_.epaFallbackUsed;
+                ++ActiveSolverTelemetry().epaFallbackUsed;
             }
             if (epa.reachedIterationLimit) {
-                ++solverTelemetry_.epaIterationBailout;
+                ++ActiveSolverTelemetry().epaIterationBailout;
             }
             if (!epa.converged && !epa.reachedIterationLimit) {
-                ++solverTelemetry_.epaDegenerateFaces;
+                ++ActiveSolverTelemetry().epaDegenerateFaces;
             }
 #endif
         } else {
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-            ++solverTelemetry_.epaDuplicateSupports;
+            ++ActiveSolverTelemetry().epaDuplicateSupports;
 #endif
         }
     }
     return true;
 }
 
+bool World::PrepareParallelNarrowphaseCache(const std::vector<Pair>& pairs) {
+    std::size_t convexPairs = 0;
+    for (const Pair& pair : pairs) {
+        if (core_internal::NarrowphaseSystem::IsConvexShape(bodies_[pair.a].shape)
+            && core_internal::NarrowphaseSystem::IsConvexShape(bodies_[pair.b].shape)) {
+            ++convexPairs;
+        }
+    }
+    // The serial pass clears the whole cache when an insert overflows it, between two pairs;
+    // leave that case to it rather than reproduce the mid-pass clear here.
+    if (narrowphaseCache_.size() + convexPairs > kNarrowphaseCacheCapacity) {
+        return false;
+    }
+    // Same keys in the same order as the serial pass's `try_emplace` calls, so the map (and
+    // its iteration order) ends up identical.
+    for (const Pair& pair : pairs) {
+        if (!core_internal::NarrowphaseSystem::IsConvexShape(bodies_[pair.a].shape)
+            || !core_internal::NarrowphaseSystem::IsConvexShape(bodies_[pair.b].shape)) {
+            continue;
+        }
+        const std::uint32_t lo = std::min(pair.a, pair.b);
+        const std::uint32_t hi = std::max(pair.a, pair.b);
+        narrowphaseCache_.try_emplace(NarrowphaseCacheKey{lo, hi, shapeRevisionCounters_[lo], shapeRevisionCounters_[hi]});
+    }
+    return true;
+}
+
+void World::RunNarrowphase(const std::vector<Pair>& pairs) {
+    const core_internal::NarrowphaseSystem narrowphaseSystem;
+    const NarrowphaseHandlers handlers{*this};
+    const core_internal::NarrowphaseContext<NarrowphaseHandlers> context{bodies_, pairs, handlers};
+    narrowphaseStats_.lastPrimitivePairs = static_cast<std::uint32_t>(pairs.size());
+    narrowphaseStats_.lastTasks = 1;
+
+    core_internal::WorkerPool* pool = pairs.size() >= std::max<std::size_t>(parallelSolveConfig_.minParallelNarrowphasePairs, 2)
+        ? solverWorkerPool_.Acquire(parallelSolveConfig_.threadCount)
+        : nullptr;
+    if (pool == nullptr || !PrepareParallelNarrowphaseCache(pairs)) {
+        narrowphaseSystem.GenerateContacts(context);
+        return;
+    }
+
+    // A few slices per thread even out pairs of very different cost (EPA vs. sphere-sphere).
+    // Slices are fixed by pair index, so the merge below does not depend on which thread ran one.
+    const std::size_t taskCount = std::min(pairs.size(), pool->ThreadCount() * 4u);
+    if (narrowphaseTaskBuffers_.size() < taskCount) {
+        narrowphaseTaskBuffers_.resize(taskCount);
+    }
+    pool->ParallelFor(taskCount, [this, &pairs, &context, &narrowphaseSystem, taskCount](std::size_t task) {
+        NarrowphaseTaskBuffer& buffer = narrowphaseTaskBuffers_[task];
+        buffer.contacts.clear();
+        buffer.seeds.clear();
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+        buffer.telemetry = {};
+        threadSolverTelemetry_ = &buffer.telemetry;
+#endif
+        threadNarrowphaseBuffer_ = &buffer;
+        narrowphaseSystem.GenerateContacts(
+            context, pairs.size() * task / taskCount, pairs.size() * (task + 1u) / taskCount);
+        threadNarrowphaseBuffer_ = nullptr;
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+        threadSolverTelemetry_ = nullptr;
+#endif
+    });
+
+    // Replayed in pair order: seeds land in the map in the serial insertion order, and each
+    // contact's wake rule sees the sleep state left by the contacts before it.
+    for (std::size_t task = 0; task < taskCount; ++task) {
+        const NarrowphaseTaskBuffer& buffer = narrowphaseTaskBuffers_[task];
+        for (const auto& [key, seed] : buffer.seeds) {
+            convexManifoldSeeds_[key] = seed;
+        }
+        for (const Contact& c : buffer.contacts) {
+            CommitContact(c);
+        }
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+        solverTelemetry_.epaFallbackUsed += buffer.telemetry.epaFallbackUsed;
+        solverTelemetry_.epaIterationBailout += buffer.telemetry.epaIterationBailout;
+        solverTelemetry_.epaDegenerateFaces += buffer.telemetry.epaDegenerateFaces;
+        solverTelemetry_.epaDuplicateSupports += buffer.telemetry.epaDuplicateSupports;
+#endif
+    }
+    narrowphaseStats_.lastTasks = static_cast<std::uint32_t>(taskCount);
+}
+
 void World::SetNarrowphaseDispatchPolicy(NarrowphaseDispatchPolicy policy) {
     narrowphaseDispatchPolicy_ = policy;
 }
@@ -509,77 +714,24 @@ ConvexDispatchRoute World::SelectConvexDispatchRoute(ShapeType a, ShapeType b) c
 }
 
 void World::BuildManifolds() {
-        std::unordered_map<ManifoldKey, std::unordered_set<PersistentPointKey, PersistentPointKeyHash>, ManifoldKeyHash> warmStartUsedKeys;
-        core_internal::ContactSolverContext solverContext{
+        // Each build hands every cached point to at most one new contact.
+        persistentPointImpulses_.ResetClaims();
+        const ManifoldBuildHooks hooks{*this};
+        const core_internal::ContactSolverContext<ManifoldBuildHooks> solverContext{
             bodies_,
             contacts_,
-            manifolds_,
-            previousManifolds_,
+            manifoldStore_.manifolds,
+            previousManifoldStore_.manifolds,
             &bodyInvInertiaWorld_,
-            [this, &warmStartUsedKeys](const ManifoldKey& manifoldId, const Contact& contact, Real& normal, std::array<Real, 2>& tangent, std::uint16_t& age) {
-                PersistentPointMatchCandidate match{};
-                std::unordered_set<PersistentPointKey, PersistentPointKeyHash>& usedKeys = warmStartUsedKeys[manifoldId];
-                if (!TryMatchPersistentPoint(persistentPointImpulses_, manifoldId, contact, usedKeys, match)) {
-                    return false;
-                }
-                usedKeys.insert(match.key);
-                normal = match.state.normalImpulseSum;
-                tangent = {match.state.tangentImpulseSum0, match.state.tangentImpulseSum1};
-                age = match.state.persistenceAge;
-                return true;
-            },
-            [this](Manifold& manifold, const Manifold* previous) { ManageManifoldContacts(manifold, previous); },
-            [](Manifold& manifold) { RefreshManifoldBlockCache(manifold); },
-            [this](Manifold& manifold) { SelectBlockSolvePair(manifold); },
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-            [this](const Manifold& manifold) { RecordSelectedPairHistory(manifold); },
-#else
-            [](const Manifold&) {},
-#endif
-            [this](Manifold& manifold) { SolveManifoldNormalImpulses(manifold); },
-            [](const Manifold& manifold, std::uint64_t contactKey) { return FindBlockSlot(manifold, contactKey); },
-            [this](Body& a, Body& b, const Mat3& invIA, const Mat3& invIB, const Vec3& ra, const Vec3& rb, const Vec3& impulse) {
-                ApplyImpulse(a, b, invIA, invIB, ra, rb, impulse);
-            },
-            [this](bool reusedBasis) {
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                if (reusedBasis) {
-                    ++solverTelemetry_.tangentBasisReused;
-                } else {
-                    ++solverTelemetry_.tangentBasisResets;
-                }
-#else
-                (void)reusedBasis;
-#endif
-            },
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-            [this](FrictionBudgetNormalSupportSource source) {
-                ++solverTelemetry_.manifoldFrictionBudgetSaturated;
-                switch (source) {
-                    case FrictionBudgetNormalSupportSource::SelectedBlockPairOnly:
-                        ++solverTelemetry_.manifoldFrictionBudgetSaturatedSelectedPair;
-                        break;
-                    case FrictionBudgetNormalSupportSource::AllManifoldContacts:
-                        ++solverTelemetry_.manifoldFrictionBudgetSaturatedAllContacts;
-                        break;
-                    case FrictionBudgetNormalSupportSource::BlendedSelectedPairAndManifold:
-                        ++solverTelemetry_.manifoldFrictionBudgetSaturatedBlended;
-                        break;
-                }
-            },
-            [this](bool reprojected) {
-                if (reprojected) {
-                    ++solverTelemetry_.tangentImpulseReprojected;
-                } else {
-                    ++solverTelemetry_.tangentImpulseReset;
-                }
-            },
-#endif
+            &solverBodies_,
+            hooks,
             contactSolverConfig_,
+            &manifoldStore_.contacts,
+            &manifoldBuildScratch_,
         };
         const core_internal::ContactPipeline pipeline;
-        pipeline.BuildManifolds({solverContext});
-        for (Manifold& manifold : manifolds_) {
+        pipeline.BuildManifolds(core_internal::ContactPipelineContext<ManifoldBuildHooks>{solverContext});
+        for (Manifold& manifold : manifoldStore_.manifolds) {
             for (Contact& c : manifold.contacts) {
                 if (c.a >= bodies_.size() || c.b >= bodies_.size()) {
                     c.anchorsValid = false;
@@ -589,17 +741,98 @@ void World::BuildManifolds() {
                 const Body& b = bodies_[c.b];
                 c.localAnchorA = RotateInverse(a.orientation, c.point - a.position);
                 c.localAnchorB = RotateInverse(b.orientation, c.point - b.position);
-                c.referenceSeparation = std::max(c.penetration, 0.0);
+                c.referenceSeparation = std::max<Real>(c.penetration, 0.0);
                 c.anchorsValid = std::isfinite(c.referenceSeparation);
             }
         }
     }
 
+bool World::CanReuseSubstepContacts() const {
+        const SubstepContactReuseConfig& config = contactSolverConfig_.substepContactReuse;
+        const core_internal::SubstepContactReuseState& reference = substepContactReuse_;
+        if (!config.enabled || !reference.valid || reference.consecutiveReuses >= config.maxConsecutiveReuses
+            || reference.position.size() != bodies_.size() || reference.jointCount != TotalJointCount()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < bodies_.size(); ++i) {
+            const Body& body = bodies_[i];
+            if (static_cast<std::uint8_t>(body.isSleeping) != reference.sleeping[i]) {
+                return false;
+            }
+            const Real travel = Length(body.position - reference.position[i]);
+            // |vec(Δq)| = sin(θ/2), so 2|vec(Δq)| bounds the chord a unit radius sweeps.
+            const Quat delta = body.orientation * Conjugate(reference.orientation[i]);
+            const Real turn = 2.0 * Length(Vec3{delta.x, delta.y, delta.z});
+            const Real radius = reference.boundingRadius[i];
+            if (radius < 0.0) {
+                // Unbounded shape (plane): reuse only while it has not moved at all.
+                if (travel != 0.0 || turn != 0.0) {
+                    return false;
+                }
+                continue;
+            }
+            if (!(travel + turn * radius <= config.maxBodyMotion)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+void World::ReprojectReusedContacts() {
+        for (Manifold& manifold : manifoldStore_.manifolds) {
+            for (Contact& c : manifold.contacts) {
+                Real penetration = 0.0;
+                if (!TryComputeAnchorSeparation(c, penetration)) {
+                    continue;
+                }
+                const Body& a = bodies_[c.a];
+                const Body& b = bodies_[c.b];
+                const Vec3 worldAnchorA = a.position + Rotate(a.orientation, c.localAnchorA);
+                const Vec3 worldAnchorB = b.position + Rotate(b.orientation, c.localAnchorB);
+                c.point = 0.5 * (worldAnchorA + worldAnchorB);
+                c.penetration = penetration;
+            }
+        }
+    }
+
+void World::CaptureSubstepContactReuseReference() {
+        core_internal::SubstepContactReuseState& reference = substepContactReuse_;
+        reference.valid = contactSolverConfig_.substepContactReuse.enabled;
+        reference.consecutiveReuses = 0;
+        if (!reference.valid) {
+            return;
+        }
+        const std::size_t count = bodies_.size();
+        reference.position.resize(count);
+        reference.orientation.resize(count);
+        reference.boundingRadius.resize(count);
+        reference.sleeping.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const Body& body = bodies_[i];
+            reference.position[i] = body.position;
+            reference.orientation[i] = body.orientation;
+            const AABB box = body.ComputeAABB();
+            const Vec3 reach{
+                std::max(std::abs(box.min.x - body.position.x), std::abs(box.max.x - body.position.x)),
+                std::max(std::abs(box.min.y - body.position.y), std::abs(box.max.y - body.position.y)),
+                std::max(std::abs(box.min.z - body.position.z), std::abs(box.max.z - body.position.z))};
+            const Real radius = Length(reach);
+            reference.boundingRadius[i] = std::isfinite(radius) ? radius : -1.0;
+            reference.sleeping[i] = static_cast<std::uint8_t>(body.isSleeping);
+        }
+        reference.jointCount = TotalJointCount();
+    }
+
+std::uint64_t World::TotalJointCount() const {
+        return joints_.size() + hingeJoints_.size() + ballSocketJoints_.size() + fixedJoints_.size()
+            + prismaticJoints_.size() + servoJoints_.size();
+    }
+
 void World::GenerateContacts() {
-        std::vector<Pair> pairs;
-        std::vector<std::uint32_t> collisionComponent;
-        std::vector<Pair> primitivePairs;
-        std::vector<Pair> compoundPairs;
+        const std::vector<Pair>* potentialPairs = nullptr;
+        std::vector<std::uint32_t>& collisionComponent = collisionComponentScratch_;
+        std::vector<Pair>& primitivePairs = primitivePairScratch_;
+        std::vector<Pair>& compoundPairs = compoundPairScratch_;
 
         const auto findComponent = [&collisionComponent](std::uint32_t body_id) {
             std::uint32_t root = body_id;
@@ -628,16 +861,22 @@ void World::GenerateContacts() {
             RefreshShapeRevisionCounters();
             convexManifoldSeeds_.clear();
             ++resolvedCollisionShapesCacheFrame_;
+            collisionShapePool_.clear();
+            collisionShapeBvhItems_.clear();
+            collisionShapeBvhNodes_.clear();
             (void)scope;
         }
 
         {
             const auto scopePotential = resource_profiler_.scope(world_resource_monitoring::toIndex(
                 world_resource_monitoring::Section::GenerateContactsSubPotentialPairs));
+            const world_resource_monitoring::HeapAllocationScope allocationScope(broadphaseHeapAllocationsThisStep_);
             const core_internal::BroadphaseSystem broadphaseSystem;
-            pairs = broadphaseSystem.ComputePotentialPairs({[this]() { return ComputePotentialPairs(); }});
+            potentialPairs = &broadphaseSystem.ComputePotentialPairs(
+                {[this]() -> const std::vector<Pair>& { return ComputePotentialPairs(); }});
             (void)scopePotential;
         }
+        const std::vector<Pair>& pairs = *potentialPairs;
         {
             const auto scopeArticulation = resource_profiler_.scope(world_resource_monitoring::toIndex(
                 world_resource_monitoring::Section::GenerateContactsSubArticulationSplit));
@@ -696,30 +935,38 @@ void World::GenerateContacts() {
             (void)scopeArticulation;
         }
 
+        narrowphaseStats_.lastCompoundShapePairs = 0;
         auto generateCompoundPairContacts = [this](std::uint32_t bodyAId, std::uint32_t bodyBId) {
-            const std::vector<ResolvedCollisionShape>& shapesA = ResolvedCollisionShapesForBody(bodyAId);
-            const std::vector<ResolvedCollisionShape>& shapesB = ResolvedCollisionShapesForBody(bodyBId);
-
-            for (const ResolvedCollisionShape& shapeA : shapesA) {
-                for (const ResolvedCollisionShape& shapeB : shapesB) {
-                    if (!Overlaps(shapeA.bounds, shapeB.bounds)) {
-                        continue;
-                    }
-
-                    if (shapeA.body.shape == ShapeType::Plane && shapeB.body.shape == ShapeType::Plane) {
+            const ResolvedCollisionShapes resolvedA = ResolvedCollisionShapesForBody(bodyAId);
+            const ResolvedCollisionShapes resolvedB = ResolvedCollisionShapesForBody(bodyBId);
+
+            // Only A's shapes touching B at all can pair; each then visits B's overlapping shapes.
+            // Both queries return ascending indices, so contacts keep the all-pairs order.
+            std::vector<std::uint32_t>& candidatesA = compoundShapeQueryScratchA_;
+            std::vector<std::uint32_t>& candidatesB = compoundShapeQueryScratchB_;
+            candidatesA.clear();
+            QueryCollisionShapes(resolvedA, resolvedB.bounds, candidatesA);
+            for (const std::uint32_t shapeAIndex : candidatesA) {
+                const CollisionShapeView& shapeA = collisionShapePool_[shapeAIndex];
+                candidatesB.clear();
+                QueryCollisionShapes(resolvedB, shapeA.bounds, candidatesB);
+                narrowphaseStats_.lastCompoundShapePairs += static_cast<std::uint32_t>(candidatesB.size());
+                for (const std::uint32_t shapeBIndex : candidatesB) {
+                    const CollisionShapeView& shapeB = collisionShapePool_[shapeBIndex];
+                    if (shapeA.shape == ShapeType::Plane && shapeB.shape == ShapeType::Plane) {
                         continue;
                     }
 
-                    if (shapeA.body.shape == ShapeType::Plane || shapeB.body.shape == ShapeType::Plane) {
-                        const bool aIsPlane = shapeA.body.shape == ShapeType::Plane;
-                        const Body& plane = aIsPlane ? shapeA.body : shapeB.body;
-                        const Body& convex = aIsPlane ? shapeB.body : shapeA.body;
+                    if (shapeA.shape == ShapeType::Plane || shapeB.shape == ShapeType::Plane) {
+                        const bool aIsPlane = shapeA.shape == ShapeType::Plane;
+                        const CollisionShapeView& plane = aIsPlane ? shapeA : shapeB;
+                        const CollisionShapeView& convex = aIsPlane ? shapeB : shapeA;
                         const std::uint32_t convexBodyId = aIsPlane ? bodyBId : bodyAId;
                         const std::uint32_t planeBodyId = aIsPlane ? bodyAId : bodyBId;
                         const std::uint32_t convexFeature = aIsPlane ? shapeB.encodedFeature : shapeA.encodedFeature;
                         const std::uint32_t planeFeature = aIsPlane ? shapeA.encodedFeature : shapeB.encodedFeature;
                         Vec3 n{};
-                        if (!TryGetPlaneNormal(plane, n)) {
+                        if (!TryNormalize(plane.planeNormal, n)) {
                             continue;
                         }
                         const ConvexSupport support = BuildConvexSupport(convex);
@@ -736,21 +983,21 @@ void World::GenerateContacts() {
                         continue;
                     }
 
-                    if (!IsConvexPrimitiveShape(shapeA.body.shape) || !IsConvexPrimitiveShape(shapeB.body.shape)) {
+                    if (!IsConvexPrimitiveShape(shapeA.shape) || !IsConvexPrimitiveShape(shapeB.shape)) {
                         continue;
                     }
 
                     EpaPenetrationResult penetration{};
-                    if (!ComputeConvexPenetration(shapeA.body, shapeB.body, penetration)) {
+                    if (!ComputeConvexPenetration(shapeA, shapeB, penetration)) {
                         continue;
                     }
                     Vec3 normal = penetration.normal;
-                    if (Dot(normal, shapeB.body.position - shapeA.body.position) < 0.0) {
+                    if (Dot(normal, shapeB.position - shapeA.position) < 0.0) {
                         normal = -normal;
                     }
                     const std::uint16_t detail = static_cast<std::uint16_t>(
-                        (static_cast<std::uint16_t>(shapeA.body.shape) << 8u)
-                        | static_cast<std::uint16_t>(shapeB.body.shape));
+                        (static_cast<std::uint16_t>(shapeA.shape) << 8u)
+                        | static_cast<std::uint16_t>(shapeB.shape));
                     const std::uint64_t featureId = CanonicalFeaturePairId(
                         bodyAId,
                         bodyBId,
@@ -781,36 +1028,7 @@ void World::GenerateContacts() {
         {
             const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(
                 world_resource_monitoring::Section::GenerateContactsSubNarrowphase));
-            const core_internal::NarrowphaseSystem narrowphaseSystem;
-            const core_internal::NarrowphaseContext context{
-                bodies_,
-                primitivePairs,
-                [this](ShapeType a, ShapeType b) { return SelectConvexDispatchRoute(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) {
-                    return ConvexOverlapWithCache(a, b);
-                },
-                [this](std::uint32_t a, std::uint32_t b) { SphereSphere(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { SphereCapsule(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { CapsuleCapsule(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { CapsulePlane(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { CapsuleBox(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { SpherePlane(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { BoxPlane(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { SphereBox(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { BoxBox(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { ConvexPlane(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { ConvexConvexEPA(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { SphereCylinder(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { CylinderBox(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { CylinderCylinder(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { CapsuleCylinder(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { SphereHalfCylinder(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { HalfCylinderBox(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { HalfCylinderCylinder(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { HalfCylinderHalfCylinder(a, b); },
-                [this](std::uint32_t a, std::uint32_t b) { CapsuleHalfCylinder(a, b); },
-            };
-            narrowphaseSystem.GenerateContacts(context);
+            RunNarrowphase(primitivePairs);
             (void)scope;
         }
 
@@ -837,7 +1055,7 @@ void World::GenerateTerrainContacts() {
             return;
         }
 
-        const Real terrainInvCell = 1.0 / std::max(terrainAttachment_.cellSizeM, 1.0e-6);
+        const Real terrainInvCell = 1.0 / std::max<Real>(terrainAttachment_.cellSizeM, 1.0e-6);
         const Real cellSizeM = terrainAttachment_.cellSizeM;
         const std::uint32_t terrainBodyId = terrainAttachmentBodyId_;
         for (std::uint32_t bodyId = 0; bodyId < bodies_.size(); ++bodyId) {
@@ -854,11 +1072,9 @@ void World::GenerateTerrainContacts() {
             terrainContactCandidatesScratch_.reserve(16);
             terrainContactUsedCellKeysScratch_.reserve(32);
 
-            const std::vector<ResolvedCollisionShape>& shapes = ResolvedCollisionShapesForBody(bodyId);
-            for (const ResolvedCollisionShape& shape : shapes) {
-                if (shape.body.invMass == 0.0) {
-                    continue;
-                }
+            const ResolvedCollisionShapes resolved = ResolvedCollisionShapesForBody(bodyId);
+            for (std::uint32_t shapeIndex = 0; shapeIndex < resolved.shapeCount; ++shapeIndex) {
+                const CollisionShapeView& shape = collisionShapePool_[resolved.firstShape + shapeIndex];
                 int row0 = 0;
                 int row1 = 0;
                 int col0 = 0;
@@ -867,10 +1083,10 @@ void World::GenerateTerrainContacts() {
                     continue;
                 }
 
-                const bool sphereTerrainFastPath = (shape.body.shape == ShapeType::Sphere);
+                const bool sphereTerrainFastPath = (shape.shape == ShapeType::Sphere);
                 ConvexSupport convexSupport{};
                 if (!sphereTerrainFastPath) {
-                    convexSupport = BuildConvexSupport(shape.body);
+                    convexSupport = BuildConvexSupport(shape);
                     if (!convexSupport.IsValid()) {
                         continue;
                     }
@@ -887,8 +1103,8 @@ void World::GenerateTerrainContacts() {
                             terrainAttachment_.gridOriginWorld.z + static_cast<float>(row) * cellSizeM;
                         const Real cellX1 = cellX0 + cellSizeM;
                         const Real cellZ1 = cellZ0 + cellSizeM;
-                        const Real sampleX = std::clamp(shape.body.position.x, cellX0, cellX1);
-                        const Real sampleZ = std::clamp(shape.body.position.z, cellZ0, cellZ1);
+                        const Real sampleX = std::clamp(shape.position.x, cellX0, cellX1);
+                        const Real sampleZ = std::clamp(shape.position.z, cellZ0, cellZ1);
                         Real terrainHeight = 0.0;
                         Vec3 terrainNormal{};
                         if (!SampleTerrainCellBilinear(
@@ -897,9 +1113,12 @@ void World::GenerateTerrainContacts() {
                         }
 
                         const Vec3 supportPoint = sphereTerrainFastPath
-                            ? SphereTerrainSupportPoint(shape.body, -terrainNormal)
+                            ? SphereTerrainSupportPoint(shape, -terrainNormal)
                             : convexSupport.Support(-terrainNormal).point;
-                        const Real signedDistance = Dot(terrainNormal, supportPoint) - terrainHeight;
+                        // Distance to the tangent plane through the sampled surface point; measuring
+                        // against a plane through the world origin would skew with slope x distance.
+                        const Real signedDistance =
+                            Dot(terrainNormal, supportPoint - Vec3{sampleX, terrainHeight, sampleZ});
                         if (signedDistance >= 0.0) {
                             continue;
                         }
@@ -960,8 +1179,10 @@ void World::GenerateTerrainContacts() {
             for (const TerrainContactCandidate& candidate : terrainContactChosenScratch_) {
                 const std::uint32_t cellFeature =
                     candidate.row * static_cast<std::uint32_t>(terrainAttachment_.cols) + candidate.col;
+                const std::uint64_t cellRevision = TerrainCellRevision(
+                    terrainAttachment_, static_cast<int>(candidate.row), static_cast<int>(candidate.col));
                 const std::uint16_t detail = static_cast<std::uint16_t>(
-                    static_cast<std::uint16_t>(terrainAttachment_.revision & 0xffffu)
+                    static_cast<std::uint16_t>(cellRevision & 0xffffu)
                     ^ static_cast<std::uint16_t>(cellFeature & 0xffffu));
                 const std::uint64_t featureId = CanonicalFeaturePairId(
                     bodyId,
@@ -1007,20 +1228,86 @@ void World::EmitConvexManifoldSeeds() {
         }
     }
 
-const std::vector<ResolvedCollisionShape>& World::ResolvedCollisionShapesForBody(std::uint32_t bodyId) {
-    static const std::vector<ResolvedCollisionShape> kEmpty{};
+ResolvedCollisionShapes World::ResolvedCollisionShapesForBody(std::uint32_t bodyId) {
     if (bodyId >= bodies_.size()) {
-        return kEmpty;
+        return {};
     }
     if (resolvedCollisionShapesCache_.size() != bodies_.size()) {
         resolvedCollisionShapesCache_.resize(bodies_.size());
         resolvedCollisionShapesCacheBuiltFrame_.assign(bodies_.size(), 0u);
     }
-    if (resolvedCollisionShapesCacheBuiltFrame_[bodyId] != resolvedCollisionShapesCacheFrame_) {
-        resolvedCollisionShapesCache_[bodyId] = ResolveCollisionShapes(bodies_[bodyId]);
-        resolvedCollisionShapesCacheBuiltFrame_[bodyId] = resolvedCollisionShapesCacheFrame_;
+    if (resolvedCollisionShapesCacheBuiltFrame_[bodyId] == resolvedCollisionShapesCacheFrame_) {
+        return resolvedCollisionShapesCache_[bodyId];
+    }
+
+    ResolvedCollisionShapes resolved{};
+    resolved.firstShape = static_cast<std::uint32_t>(collisionShapePool_.size());
+    AppendCollisionShapeViews(bodies_[bodyId], collisionShapePool_);
+    resolved.shapeCount = static_cast<std::uint32_t>(collisionShapePool_.size()) - resolved.firstShape;
+    resolved.bounds = collisionShapePool_[resolved.firstShape].bounds;
+    for (std::uint32_t i = 1; i < resolved.shapeCount; ++i) {
+        resolved.bounds = MergeAABB(resolved.bounds, collisionShapePool_[resolved.firstShape + i].bounds);
+    }
+
+    collisionShapeBvhItems_.resize(collisionShapePool_.size());
+    if (resolved.shapeCount >= kCompoundBvhMinShapes) {
+        std::uint32_t* items = collisionShapeBvhItems_.data() + resolved.firstShape;
+        for (std::uint32_t i = 0; i < resolved.shapeCount; ++i) {
+            items[i] = i;
+        }
+        resolved.firstNode = static_cast<std::uint32_t>(collisionShapeBvhNodes_.size());
+        BuildCollisionShapeBvhNode(
+            collisionShapePool_.data() + resolved.firstShape,
+            items,
+            0u,
+            resolved.shapeCount,
+            resolved.firstNode,
+            collisionShapeBvhNodes_);
+        resolved.nodeCount = static_cast<std::uint32_t>(collisionShapeBvhNodes_.size()) - resolved.firstNode;
+    }
+
+    resolvedCollisionShapesCache_[bodyId] = resolved;
+    resolvedCollisionShapesCacheBuiltFrame_[bodyId] = resolvedCollisionShapesCacheFrame_;
+    return resolved;
+}
+
+void World::QueryCollisionShapes(
+    const ResolvedCollisionShapes& resolved, const AABB& bounds, std::vector<std::uint32_t>& outShapes) const {
+    if (resolved.nodeCount == 0u) {
+        for (std::uint32_t i = 0; i < resolved.shapeCount; ++i) {
+            if (Overlaps(collisionShapePool_[resolved.firstShape + i].bounds, bounds)) {
+                outShapes.push_back(resolved.firstShape + i);
+            }
+        }
+        return;
+    }
+
+    const std::size_t outBegin = outShapes.size();
+    const CollisionShapeBvhNode* nodes = collisionShapeBvhNodes_.data() + resolved.firstNode;
+    const std::uint32_t* items = collisionShapeBvhItems_.data() + resolved.firstShape;
+    // Median splits keep the depth near log2(shapes / leaf size), far below 64.
+    std::array<std::uint32_t, 64> stack{};
+    std::size_t stackSize = 0;
+    stack[stackSize++] = 0u;
+    while (stackSize > 0) {
+        const CollisionShapeBvhNode& node = nodes[stack[--stackSize]];
+        if (!Overlaps(node.bounds, bounds)) {
+            continue;
+        }
+        if (node.count > 0u) {
+            for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+                const std::uint32_t shapeIndex = resolved.firstShape + items[i];
+                if (Overlaps(collisionShapePool_[shapeIndex].bounds, bounds)) {
+                    outShapes.push_back(shapeIndex);
+                }
+            }
+            continue;
+        }
+        const std::uint32_t nodeIndex = static_cast<std::uint32_t>(&node - nodes);
+        stack[stackSize++] = node.first;
+        stack[stackSize++] = nodeIndex + 1u;
     }
-    return resolvedCollisionShapesCache_[bodyId];
+    std::sort(outShapes.begin() + static_cast<std::ptrdiff_t>(outBegin), outShapes.end());
 }
 
 void World::SphereSphere(std::uint32_t ia, std::uint32_t ib) {
@@ -1350,8 +1637,8 @@ void World::BoxBox(std::uint32_t aId, std::uint32_t bId) {
                 else local.z = value;
             }
             const Real edgeExtent = halfExtentAxis(box.halfExtents, axis);
-            const Vec3 p0 = box.position + Rotate(box.orientation, local - Vec3{axis == 0 ? edgeExtent : 0.0, axis == 1 ? edgeExtent : 0.0, axis == 2 ? edgeExtent : 0.0});
-            const Vec3 p1 = box.position + Rotate(box.orientation, local + Vec3{axis == 0 ? edgeExtent : 0.0, axis == 1 ? edgeExtent : 0.0, axis == 2 ? edgeExtent : 0.0});
+            const Vec3 p0 = box.position + Rotate(box.orientation, local - Vec3{axis == 0 ? edgeExtent : Real(0), axis == 1 ? edgeExtent : Real(0), axis == 2 ? edgeExtent : Real(0)});
+            const Vec3 p1 = box.position + Rotate(box.orientation, local + Vec3{axis == 0 ? edgeExtent : Real(0), axis == 1 ? edgeExtent : Real(0), axis == 2 ? edgeExtent : Real(0)});
             return std::pair<Vec3, Vec3>{p0, p1};
         };
         const auto closestPointsOnSegments = [](const Vec3& p1, const Vec3& q1, const Vec3& p2, const Vec3& q2) {
@@ -1368,24 +1655,24 @@ void World::BoxBox(std::uint32_t aId, std::uint32_t bId) {
                 return std::pair<Vec3, Vec3>{p1, p2};
             }
             if (aLen <= kEpsilon) {
-                t = std::clamp(f / (eLen + kEpsilon), 0.0, 1.0);
+                t = std::clamp<Real>(f / (eLen + kEpsilon), 0.0, 1.0);
             } else {
                 const Real c = Dot(d1, r);
                 if (eLen <= kEpsilon) {
-                    s = std::clamp(-c / (aLen + kEpsilon), 0.0, 1.0);
+                    s = std::clamp<Real>(-c / (aLen + kEpsilon), 0.0, 1.0);
                 } else {
                     const Real bDot = Dot(d1, d2);
                     const Real denom = aLen * eLen - bDot * bDot;
                     if (denom > kEpsilon) {
-                        s = std::clamp((bDot * f - c * eLen) / denom, 0.0, 1.0);
+                        s = std::clamp<Real>((bDot * f - c * eLen) / denom, 0.0, 1.0);
                     }
                     t = (bDot * s + f) / (eLen + kEpsilon);
                     if (t < 0.0) {
                         t = 0.0;
-                        s = std::clamp(-c / (aLen + kEpsilon), 0.0, 1.0);
+                        s = std::clamp<Real>(-c / (aLen + kEpsilon), 0.0, 1.0);
                     } else if (t > 1.0) {
                         t = 1.0;
-                        s = std::clamp((bDot - c) / (aLen + kEpsilon), 0.0, 1.0);
+                        s = std::clamp<Real>((bDot - c) / (aLen + kEpsilon), 0.0, 1.0);
                     }
                 }
             }
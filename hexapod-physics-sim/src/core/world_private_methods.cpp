@@ -16,18 +16,18 @@ Real World::ClosestPointParameter(const Vec3& a, const Vec3& b, const Vec3& p) {
         if (denom <= kEpsilon) {
             return 0.0;
         }
-        return std::clamp(Dot(p - a, ab) / denom, 0.0, 1.0);
+        return std::clamp<Real>(Dot(p - a, ab) / denom, 0.0, 1.0);
     }
 
 Real World::SmoothStep01(Real t) {
 
-        const Real x = std::clamp(t, 0.0, 1.0);
+        const Real x = std::clamp<Real>(t, 0.0, 1.0);
         return x * x * (3.0 - 2.0 * x);
     }
 
 Real World::EffectiveRestitutionCutoffSpeed() const {
 
-        return std::max({
+        return std::max<Real>({
             0.0,
             contactSolverConfig_.bounceVelocityThreshold,
             contactSolverConfig_.restitutionSuppressionSpeed,
@@ -40,7 +40,7 @@ Real World::ComputeRestitution(Real speedIntoContact, Real restitutionA, Real re
         if (speedIntoContact <= 0.0 || speedIntoContact < EffectiveRestitutionCutoffSpeed()) {
             return 0.0;
         }
-        return std::clamp(std::min(restitutionA, restitutionB), 0.0, 1.0);
+        return std::clamp<Real>(std::min(restitutionA, restitutionB), 0.0, 1.0);
     }
 
 Real World::ComputeHighMassRatioBoost(const Body& a, const Body& b) const {
@@ -55,8 +55,8 @@ Real World::ComputeHighMassRatioBoost(const Body& a, const Body& b) const {
             return 1.0;
         }
         const Real extra = (massRatio - contactSolverConfig_.highMassRatioThreshold)
-            / std::max(contactSolverConfig_.highMassRatioThreshold, 1.0);
-        return 1.0 + std::max(extra, 0.0);
+            / std::max<Real>(contactSolverConfig_.highMassRatioThreshold, 1.0);
+        return 1.0 + std::max<Real>(extra, 0.0);
     }
 
 void World::AdvanceDynamicBodies(Real dt) {
@@ -223,7 +223,7 @@ World::TOIEvent World::SweepSphereCapsule(std::uint32_t sphereId, std::uint32_t
             if (dist <= combinedRadius + 1e-4) {
                 TOIEvent hit;
                 hit.hit = true;
-                hit.toi = std::clamp(t, 0.0, maxDt);
+                hit.toi = std::clamp<Real>(t, 0.0, maxDt);
                 if (dist <= kEpsilon) {
                     delta = StableDirection(vRel, {{axis, -axis, {1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}}});
                     dist = 1.0;
@@ -363,7 +363,7 @@ void World::WakeConnectedBodies(std::uint32_t start) {
             stack.pop_back();
             WakeBody(bodies_[id]);
 
-            for (const Manifold& m : manifolds_) {
+            for (const Manifold& m : manifoldStore_.manifolds) {
                 std::uint32_t other = std::numeric_limits<std::uint32_t>::max();
                 if (m.a == id) other = m.b;
                 else if (m.b == id) other = m.a;
@@ -548,7 +548,7 @@ void World::AddContact(
         c.b = b;
         c.normal = normal;
         c.point = point;
-        c.penetration = std::max(penetration, 0.0);
+        c.penetration = std::max<Real>(penetration, 0.0);
         c.manifoldType = manifoldType;
         c.featureKey = canonicalFeatureId;
         c.key = ContactKeyStableValue(MakeContactKey(a, b, manifoldType, canonicalFeatureId));
@@ -557,9 +557,18 @@ void World::AddContact(
         assert(IsFinite(c.penetration));
         assert(c.penetration >= 0.0);
 
+        if (threadNarrowphaseBuffer_ != nullptr) {
+            // Parallel narrowphase task: committed (and its wake rule applied) in pair order later.
+            threadNarrowphaseBuffer_->contacts.push_back(c);
+            return;
+        }
+        CommitContact(c);
+    }
+
+void World::CommitContact(const Contact& c) {
         contacts_.push_back(c);
-        const Body& bodyA = bodies_[a];
-        const Body& bodyB = bodies_[b];
+        const Body& bodyA = bodies_[c.a];
+        const Body& bodyB = bodies_[c.b];
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
         if ((bodyA.collisionGroup == 0x0004u) || (bodyB.collisionGroup == 0x0004u)) {
             ++solverTelemetry_.terrainContactAdds;
@@ -572,8 +581,8 @@ void World::AddContact(
                                 || c.penetration >= kWakeContactPenetrationThreshold
                                 || contactTouchesSleepingBody;
         if (strongContact) {
-            WakeConnectedBodies(a);
-            WakeConnectedBodies(b);
+            WakeConnectedBodies(c.a);
+            WakeConnectedBodies(c.b);
         }
     }
 
@@ -589,25 +598,17 @@ int World::FindBlockSlot(const Manifold& manifold, std::uint64_t contactKey) {
 
 std::array<Real, 3>* World::FindPerContactImpulseCache(Manifold& manifold, std::uint64_t contactKey) {
 
-        auto it = manifold.cachedImpulseByContactKey.find(contactKey);
-        if (it == manifold.cachedImpulseByContactKey.end()) {
-            return nullptr;
-        }
-        return &it->second;
+        return manifold.cachedImpulseByContactKey.Find(contactKey);
     }
 
 const std::array<Real, 3>* World::FindPerContactImpulseCache(const Manifold& manifold, std::uint64_t contactKey) {
 
-        auto it = manifold.cachedImpulseByContactKey.find(contactKey);
-        if (it == manifold.cachedImpulseByContactKey.end()) {
-            return nullptr;
-        }
-        return &it->second;
+        return manifold.cachedImpulseByContactKey.Find(contactKey);
     }
 
 std::array<Real, 3>& World::EnsurePerContactImpulseCache(Manifold& manifold, std::uint64_t contactKey) {
 
-        return manifold.cachedImpulseByContactKey[contactKey];
+        return manifold.cachedImpulseByContactKey.Ensure(contactKey);
     }
 
 int World::FindFirstFreeBlockSlot(const std::array<bool, 2>& slotOccupied) {
@@ -629,7 +630,7 @@ int World::EnsureBlockSlotForContact(
         if (slot >= 0) {
             slotOccupied[slot] = true;
             std::array<Real, 3>& entry = EnsurePerContactImpulseCache(manifold, contact.key);
-            entry[0] = std::max(contact.normalImpulseSum, 0.0);
+            entry[0] = std::max<Real>(contact.normalImpulseSum, 0.0);
             entry[1] = contact.tangentImpulseSum0;
             entry[2] = contact.tangentImpulseSum1;
             return slot;
@@ -638,7 +639,7 @@ int World::EnsureBlockSlotForContact(
         slot = FindFirstFreeBlockSlot(slotOccupied);
         if (slot < 0) {
             std::array<Real, 3>& entry = EnsurePerContactImpulseCache(manifold, contact.key);
-            entry[0] = std::max(contact.normalImpulseSum, 0.0);
+            entry[0] = std::max<Real>(contact.normalImpulseSum, 0.0);
             entry[1] = contact.tangentImpulseSum0;
             entry[2] = contact.tangentImpulseSum1;
             return -1;
@@ -647,28 +648,28 @@ int World::EnsureBlockSlotForContact(
         manifold.blockSlotValid[slot] = true;
         manifold.blockContactKeys[slot] = contact.key;
         const std::array<Real, 3>& entry = EnsurePerContactImpulseCache(manifold, contact.key);
-        manifold.blockNormalImpulseSum[slot] = std::max(entry[0], 0.0);
+        manifold.blockNormalImpulseSum[slot] = std::max<Real>(entry[0], 0.0);
         slotOccupied[slot] = true;
         return slot;
     }
 
 void World::RefreshManifoldBlockCache(Manifold& manifold) {
 
-        std::unordered_set<std::uint64_t> currentKeys;
-        currentKeys.reserve(manifold.contacts.size());
+        // Runs after `ManifoldManager::Process`, so the manifold holds at most kMaxManifoldContacts.
+        assert(manifold.contacts.size() <= kMaxManifoldContacts);
         std::array<bool, 2> slotOccupied{false, false};
         std::array<int, 2> slotToContactIndex{-1, -1};
-        std::vector<std::size_t> contactVisitOrder;
-        contactVisitOrder.reserve(manifold.contacts.size());
-        for (std::size_t i = 0; i < manifold.contacts.size(); ++i) {
-            contactVisitOrder.push_back(i);
+        std::array<std::size_t, kMaxManifoldContacts> contactVisitOrder{};
+        const std::size_t contactCount = std::min(manifold.contacts.size(), kMaxManifoldContacts);
+        for (std::size_t i = 0; i < contactCount; ++i) {
+            contactVisitOrder[i] = i;
         }
-        if (manifold.contacts.size() >= 2
+        if (contactCount >= 2
             && manifold.selectedBlockContactKeys[0] != 0u
             && manifold.selectedBlockContactKeys[1] != 0u) {
-            std::stable_sort(
+            std::sort(
                 contactVisitOrder.begin(),
-                contactVisitOrder.end(),
+                contactVisitOrder.begin() + static_cast<std::ptrdiff_t>(contactCount),
                 [&](std::size_t lhs, std::size_t rhs) {
                     const bool lhsSelected = manifold.contacts[lhs].key == manifold.selectedBlockContactKeys[0]
                         || manifold.contacts[lhs].key == manifold.selectedBlockContactKeys[1];
@@ -681,12 +682,12 @@ void World::RefreshManifoldBlockCache(Manifold& manifold) {
                 });
         }
 
-        for (const std::size_t i : contactVisitOrder) {
+        for (std::size_t visit = 0; visit < contactCount; ++visit) {
+            const std::size_t i = contactVisitOrder[visit];
             Contact& contact = manifold.contacts[i];
-            currentKeys.insert(contact.key);
             std::array<Real, 3>& entry = EnsurePerContactImpulseCache(manifold, contact.key);
-            entry[0] = std::max(entry[0], 0.0);
-            contact.normalImpulseSum = std::max(entry[0], 0.0);
+            entry[0] = std::max<Real>(entry[0], 0.0);
+            contact.normalImpulseSum = std::max<Real>(entry[0], 0.0);
             contact.tangentImpulseSum0 = entry[1];
             contact.tangentImpulseSum1 = entry[2];
             contact.tangentImpulseSum = contact.tangentImpulseSum0;
@@ -696,13 +697,11 @@ void World::RefreshManifoldBlockCache(Manifold& manifold) {
             }
         }
 
-        for (auto it = manifold.cachedImpulseByContactKey.begin(); it != manifold.cachedImpulseByContactKey.end();) {
-            if (currentKeys.find(it->first) == currentKeys.end()) {
-                it = manifold.cachedImpulseByContactKey.erase(it);
-            } else {
-                ++it;
-            }
-        }
+        manifold.cachedImpulseByContactKey.RetainIf([&](std::uint64_t key) {
+            return std::any_of(manifold.contacts.begin(), manifold.contacts.end(), [key](const Contact& contact) {
+                return contact.key == key;
+            });
+        });
 
         for (int slot = 0; slot < 2; ++slot) {
             if (!slotOccupied[slot]) {
@@ -774,9 +773,11 @@ bool World::ContactComesBefore(const Contact& lhs, const Contact& rhs) {
         return StableContactFallbackKey(lhs) < StableContactFallbackKey(rhs);
     }
 
-void World::SortManifoldContacts(std::vector<Contact>& contacts) {
+void World::SortManifoldContacts(ManifoldContacts& contacts) {
 
-        std::stable_sort(contacts.begin(), contacts.end(), ContactComesBefore);
+        // Points are merged by key first, so `ContactComesBefore` is a total order here and a
+        // plain sort matches a stable one.
+        std::sort(contacts.begin(), contacts.end(), ContactComesBefore);
     }
 
 World::ManifoldQualityScore World::ComputeManifoldQualityScore(const Manifold& manifold) {
@@ -792,9 +793,9 @@ World::ManifoldQualityScore World::ComputeManifoldQualityScore(const Manifold& m
         normal = Normalize(normal);
         Vec3 centroid{0.0, 0.0, 0.0};
         for (const Contact& c : manifold.contacts) {
-            score.penetration += std::max(c.penetration, 0.0);
+            score.penetration += std::max<Real>(c.penetration, 0.0);
             centroid += c.point;
-            score.normalCoherence += std::max(0.0, Dot(Normalize(c.normal), normal));
+            score.normalCoherence += std::max<Real>(0.0, Dot(Normalize(c.normal), normal));
         }
         const Real invN = 1.0 / static_cast<float>(manifold.contacts.size());
         centroid *= invN;
@@ -827,11 +828,11 @@ void World::ReduceManifoldToMaxPoints(Manifold& manifold, std::size_t maxPoints)
         if (LengthSquared(manifoldNormal) <= kEpsilon) {
             manifoldNormal = {0.0, 1.0, 0.0};
         }
-        std::stable_sort(manifold.contacts.begin(), manifold.contacts.end(), [&](const Contact& lhs, const Contact& rhs) {
+        std::sort(manifold.contacts.begin(), manifold.contacts.end(), [&](const Contact& lhs, const Contact& rhs) {
             const Real lhsSpread = LengthSquared(lhs.point - centroid);
             const Real rhsSpread = LengthSquared(rhs.point - centroid);
-            const Real lhsScore = std::max(lhs.penetration, 0.0) + (0.25 * lhsSpread) + 0.25 * std::max(0.0, Dot(lhs.normal, manifoldNormal));
-            const Real rhsScore = std::max(rhs.penetration, 0.0) + (0.25 * rhsSpread) + 0.25 * std::max(0.0, Dot(rhs.normal, manifoldNormal));
+            const Real lhsScore = std::max<Real>(lhs.penetration, 0.0) + (0.25 * lhsSpread) + 0.25 * std::max<Real>(0.0, Dot(lhs.normal, manifoldNormal));
+            const Real rhsScore = std::max<Real>(rhs.penetration, 0.0) + (0.25 * rhsSpread) + 0.25 * std::max<Real>(0.0, Dot(rhs.normal, manifoldNormal));
             if (lhsScore != rhsScore) {
                 return lhsScore > rhsScore;
             }
@@ -842,30 +843,35 @@ void World::ReduceManifoldToMaxPoints(Manifold& manifold, std::size_t maxPoints)
 
 void World::ManifoldManager::Process(Manifold& manifold, const Manifold* previous) const {
 
-            const std::vector<Contact> originalContacts = manifold.contacts;
-            std::unordered_map<std::uint64_t, Contact> mergedByKey;
-            mergedByKey.reserve(manifold.contacts.size());
-            for (const Contact& contact : manifold.contacts) {
+            [[maybe_unused]] const std::size_t originalContactCount = manifold.contacts.size();
+            // Merge points sharing a key: the oldest wins, then the deepest, then the earliest.
+            // Sorting (key, slot) groups each key's points in slot order.
+            core_internal::ManifoldBuildScratch& scratch = world_.manifoldBuildScratch_;
+            scratch.mergeOrder.clear();
+            for (std::size_t i = 0; i < manifold.contacts.size(); ++i) {
+                const Contact& contact = manifold.contacts[i];
                 if (!std::isfinite(contact.penetration) || contact.penetration <= 0.0) {
                     continue;
                 }
-                auto it = mergedByKey.find(contact.key);
-                if (it == mergedByKey.end()) {
-                    mergedByKey.emplace(contact.key, contact);
+                scratch.mergeOrder.emplace_back(contact.key, static_cast<std::uint32_t>(i));
+            }
+            std::sort(scratch.mergeOrder.begin(), scratch.mergeOrder.end());
+            scratch.mergedContacts.clear();
+            for (std::size_t i = 0; i < scratch.mergeOrder.size(); ++i) {
+                const Contact& contact = manifold.contacts[scratch.mergeOrder[i].second];
+                if (i == 0u || scratch.mergeOrder[i].first != scratch.mergeOrder[i - 1u].first) {
+                    scratch.mergedContacts.push_back(contact);
                     continue;
                 }
-                Contact& existing = it->second;
+                Contact& existing = scratch.mergedContacts.back();
                 if (contact.persistenceAge > existing.persistenceAge
                     || (contact.persistenceAge == existing.persistenceAge && contact.penetration > existing.penetration)) {
                     existing = contact;
                 }
             }
-            manifold.contacts.clear();
-            manifold.contacts.reserve(mergedByKey.size());
-            for (const auto& [_, contact] : mergedByKey) {
-                manifold.contacts.push_back(contact);
-            }
-            ReduceManifoldToMaxPoints(manifold, 4);
+            std::copy(scratch.mergedContacts.begin(), scratch.mergedContacts.end(), manifold.contacts.begin());
+            manifold.contacts.resize(scratch.mergedContacts.size());
+            ReduceManifoldToMaxPoints(manifold, kMaxManifoldContacts);
             SortManifoldContacts(manifold.contacts);
             const ManifoldQualityScore qualityScore = ComputeManifoldQualityScore(manifold);
             manifold.lowQuality = qualityScore.total < 0.05 || qualityScore.normalCoherence < 0.5;
@@ -877,26 +883,35 @@ void World::ManifoldManager::Process(Manifold& manifold, const Manifold* previou
             } else {
                 ++world_.solverTelemetry_.manifoldQualityHigh;
             }
-            if (originalContacts.size() > manifold.contacts.size()) {
-                world_.solverTelemetry_.manifoldPointRemoves += (originalContacts.size() - manifold.contacts.size());
+            if (originalContactCount > manifold.contacts.size()) {
+                world_.solverTelemetry_.manifoldPointRemoves += (originalContactCount - manifold.contacts.size());
             }
             if (previous != nullptr) {
-                std::unordered_map<std::uint64_t, int> oldCounts;
-                std::unordered_map<std::uint64_t, int> newCounts;
-                for (const Contact& c : previous->contacts) {
-                    ++oldCounts[c.key];
-                }
-                for (const Contact& c : manifold.contacts) {
-                    ++newCounts[c.key];
-                }
-                for (const auto& [key, oldCount] : oldCounts) {
-                    const int newCount = newCounts.count(key) > 0 ? newCounts.at(key) : 0;
+                // Both sides hold at most kMaxManifoldContacts points, so per-key counts are
+                // linear scans.
+                const auto countKey = [](const ManifoldContacts& contacts, std::size_t end, std::uint64_t key) {
+                    return std::count_if(contacts.begin(), contacts.begin() + static_cast<std::ptrdiff_t>(end), [key](const Contact& c) {
+                        return c.key == key;
+                    });
+                };
+                for (std::size_t i = 0; i < previous->contacts.size(); ++i) {
+                    const std::uint64_t key = previous->contacts[i].key;
+                    if (countKey(previous->contacts, i, key) > 0) {
+                        continue;
+                    }
+                    const auto oldCount = countKey(previous->contacts, previous->contacts.size(), key);
+                    const auto newCount = countKey(manifold.contacts, manifold.contacts.size(), key);
                     if (newCount < oldCount) {
                         world_.solverTelemetry_.manifoldPointRemoves += static_cast<std::uint64_t>(oldCount - newCount);
                     }
                 }
-                for (const auto& [key, newCount] : newCounts) {
-                    const int oldCount = oldCounts.count(key) > 0 ? oldCounts.at(key) : 0;
+                for (std::size_t i = 0; i < manifold.contacts.size(); ++i) {
+                    const std::uint64_t key = manifold.contacts[i].key;
+                    if (countKey(manifold.contacts, i, key) > 0) {
+                        continue;
+                    }
+                    const auto newCount = countKey(manifold.contacts, manifold.contacts.size(), key);
+                    const auto oldCount = countKey(previous->contacts, previous->contacts.size(), key);
                     if (newCount > oldCount) {
                         world_.solverTelemetry_.manifoldPointAdds += static_cast<std::uint64_t>(newCount - oldCount);
                     }
@@ -945,23 +960,21 @@ bool World::PersistentPointCandidateLess(
     }
 
 bool World::TryMatchPersistentPoint(
-        const std::unordered_map<PersistentPointKey, PersistentPointImpulseState, PersistentPointKeyHash>& previousState,
-        const ManifoldKey& manifoldId,
+        const core_internal::PersistentPointTable& previousState,
+        core_internal::PersistentPointTable::Range range,
         const Contact& contact,
-        const std::unordered_set<PersistentPointKey, PersistentPointKeyHash>& usedKeys,
         PersistentPointMatchCandidate& outCandidate) {
 
         bool found = false;
         PersistentPointMatchCandidate bestCandidate{};
         const Real localThresholdSq = kPersistenceLocalAnchorDriftThreshold * kPersistenceLocalAnchorDriftThreshold;
         const Real worldThresholdSq = kPersistenceWorldAnchorDriftThreshold * kPersistenceWorldAnchorDriftThreshold;
-        for (const auto& [key, state] : previousState) {
-            if (!(key.manifold == manifoldId) || key.canonicalFeatureId != contact.featureKey) {
-                continue;
-            }
-            if (usedKeys.find(key) != usedKeys.end()) {
+        for (std::uint32_t slot = range.begin; slot < range.begin + range.count; ++slot) {
+            const PersistentPointKey& key = previousState.Key(slot);
+            if (key.canonicalFeatureId != contact.featureKey || previousState.IsClaimed(slot)) {
                 continue;
             }
+            const PersistentPointImpulseState& state = previousState.State(slot);
 
             Real localDriftSq = worldThresholdSq;
             Real worldDriftSq = worldThresholdSq;
@@ -984,6 +997,7 @@ bool World::TryMatchPersistentPoint(
             candidate.state = state;
             candidate.localAnchorDriftSq = localDriftSq;
             candidate.worldAnchorDriftSq = worldDriftSq;
+            candidate.slot = slot;
             if (!found || PersistentPointCandidateLess(candidate, bestCandidate)) {
                 found = true;
                 bestCandidate = candidate;
@@ -997,35 +1011,42 @@ bool World::TryMatchPersistentPoint(
 
 void World::CapturePersistentPointImpulseState(const std::vector<Manifold>& manifolds) {
 
-        const auto previousState = persistentPointImpulses_;
-        persistentPointImpulses_.clear();
-        std::unordered_set<PersistentPointKey, PersistentPointKeyHash> usedKeys;
+        const world_resource_monitoring::HeapAllocationScope allocationScope(warmStartHeapAllocationsThisStep_);
+        // Double-buffered: last capture becomes the match source, its buffers are reused for the
+        // new generation.
+        std::swap(persistentPointImpulses_, persistentPointImpulsesPrevious_);
+        core_internal::PersistentPointTable& previousState = persistentPointImpulsesPrevious_;
+        previousState.ResetClaims();
+        persistentPointImpulses_.Clear();
         std::uint64_t matchedPoints = 0;
         std::uint64_t newPoints = 0;
         for (const Manifold& manifold : manifolds) {
             const ManifoldKey manifoldId = MakeManifoldId(manifold.a, manifold.b, manifold.manifoldType);
+            const core_internal::PersistentPointTable::Range previousRange = previousState.Find(manifoldId);
+            persistentPointImpulses_.BeginManifold(manifoldId);
             for (const Contact& contact : manifold.contacts) {
                 PersistentPointKey pointKey = MakePersistentPointKey(manifoldId, contact.featureKey, 0u);
                 std::uint16_t persistenceAge = 1;
                 PersistentPointMatchCandidate match{};
-                if (TryMatchPersistentPoint(previousState, manifoldId, contact, usedKeys, match)) {
+                if (TryMatchPersistentPoint(previousState, previousRange, contact, match)) {
                     pointKey = match.key;
                     persistenceAge = static_cast<std::uint16_t>(
                         std::min<std::uint32_t>(static_cast<std::uint32_t>(match.state.persistenceAge) + 1u,
                                                 static_cast<std::uint32_t>(std::numeric_limits<std::uint16_t>::max())));
-                    usedKeys.insert(match.key);
+                    previousState.Claim(match.slot);
                     ++matchedPoints;
                 } else {
                     std::uint8_t maxOrdinal = 0u;
-                    for (const auto& [key, _] : previousState) {
-                        if (key.manifold == manifoldId && key.canonicalFeatureId == contact.featureKey) {
+                    for (std::uint32_t slot = previousRange.begin; slot < previousRange.begin + previousRange.count; ++slot) {
+                        const PersistentPointKey& key = previousState.Key(slot);
+                        if (key.canonicalFeatureId == contact.featureKey) {
                             maxOrdinal = static_cast<std::uint8_t>(std::max<std::uint32_t>(maxOrdinal, static_cast<std::uint32_t>(key.ordinal + 1u)));
                         }
                     }
                     pointKey.ordinal = maxOrdinal;
                     ++newPoints;
                 }
-                persistentPointImpulses_[pointKey] = {
+                persistentPointImpulses_.Upsert(pointKey, {
                     contact.normalImpulseSum,
                     contact.tangentImpulseSum0,
                     contact.tangentImpulseSum1,
@@ -1033,15 +1054,17 @@ void World::CapturePersistentPointImpulseState(const std::vector<Manifold>& mani
                     contact.anchorsValid,
                     contact.localAnchorA,
                     contact.localAnchorB,
-                    contact.point};
+                    contact.point});
             }
         }
+        const std::size_t previousCount = previousState.Size();
+        const std::size_t usedCount = previousState.ClaimedCount();
         persistenceMatchDiagnostics_.matchedPoints = matchedPoints;
         persistenceMatchDiagnostics_.newPoints = newPoints;
-        persistenceMatchDiagnostics_.droppedPoints = previousState.size() >= usedKeys.size()
-            ? static_cast<std::uint64_t>(previousState.size() - usedKeys.size())
+        persistenceMatchDiagnostics_.droppedPoints = previousCount >= usedCount
+            ? static_cast<std::uint64_t>(previousCount - usedCount)
             : 0u;
-        const Real denom = static_cast<float>(std::max<std::uint64_t>(1u, previousState.size()));
+        const Real denom = static_cast<float>(std::max<std::uint64_t>(1u, previousCount));
         persistenceMatchDiagnostics_.churnRatio = static_cast<float>(
             static_cast<double>(persistenceMatchDiagnostics_.droppedPoints + persistenceMatchDiagnostics_.newPoints) / denom);
     }
@@ -1069,8 +1092,8 @@ void World::BuildIslands() {
                 stack.pop_back();
                 island.bodies.push_back(bodyId);
 
-                for (std::size_t mi = 0; mi < manifolds_.size(); ++mi) {
-                    const Manifold& m = manifolds_[mi];
+                for (std::size_t mi = 0; mi < manifoldStore_.manifolds.size(); ++mi) {
+                    const Manifold& m = manifoldStore_.manifolds[mi];
                     std::uint32_t other = std::numeric_limits<std::uint32_t>::max();
                     if (m.a == bodyId) other = m.b;
                     else if (m.b == bodyId) other = m.a;
@@ -1233,16 +1256,6 @@ std::vector<Pair> World::ComputePotentialPairsBruteForce() const {
         }
         return pairs;
     }
-
-std::unordered_set<std::uint64_t> World::PairSetFromPairs(const std::vector<Pair>& pairs) {
-
-        std::unordered_set<std::uint64_t> pairSet;
-        pairSet.reserve(pairs.size());
-        for (const Pair& pair : pairs) {
-            pairSet.insert((static_cast<std::uint64_t>(pair.a) << 32) | pair.b);
-        }
-        return pairSet;
-    }
 #endif
 
 bool World::IsConvexShape(ShapeType shape) {
@@ -1287,20 +1300,20 @@ std::pair<Real, Real> World::ClosestSegmentParameters(const Vec3& p1, const Vec3
             return {0.0, 0.0};
         }
         if (aLen <= kEpsilon) {
-            t = std::clamp(f / eLen, 0.0, 1.0);
+            t = std::clamp<Real>(f / eLen, 0.0, 1.0);
             return {0.0, t};
         }
 
         const Real cTerm = Dot(d1, r);
         if (eLen <= kEpsilon) {
-            s = std::clamp(-cTerm / aLen, 0.0, 1.0);
+            s = std::clamp<Real>(-cTerm / aLen, 0.0, 1.0);
             return {s, 0.0};
         }
 
         const Real bDot = Dot(d1, d2);
         const Real denom = aLen * eLen - bDot * bDot;
         if (std::abs(denom) > kEpsilon) {
-            s = std::clamp((bDot * f - cTerm * eLen) / denom, 0.0, 1.0);
+            s = std::clamp<Real>((bDot * f - cTerm * eLen) / denom, 0.0, 1.0);
         } else {
             s = 0.0;
         }
@@ -1308,10 +1321,10 @@ std::pair<Real, Real> World::ClosestSegmentParameters(const Vec3& p1, const Vec3
         t = (bDot * s + f) / eLen;
         if (t < 0.0) {
             t = 0.0;
-            s = std::clamp(-cTerm / aLen, 0.0, 1.0);
+            s = std::clamp<Real>(-cTerm / aLen, 0.0, 1.0);
         } else if (t > 1.0) {
             t = 1.0;
-            s = std::clamp((bDot - cTerm) / aLen, 0.0, 1.0);
+            s = std::clamp<Real>((bDot - cTerm) / aLen, 0.0, 1.0);
         }
 
         return {s, t};
@@ -1322,7 +1335,7 @@ World::SegmentBoxClosest World::ClosestSegmentPointToBox(const Vec3& segA, const
         const Vec3 d = segB - segA;
         auto eval = [&](Real t) {
             SegmentBoxClosest result;
-            result.t = std::clamp(t, 0.0, 1.0);
+            result.t = std::clamp<Real>(t, 0.0, 1.0);
             result.segmentPoint = segA + d * result.t;
             result.boxPoint = ClampPointToExtents(result.segmentPoint, extents);
             result.distSq = LengthSquared(result.segmentPoint - result.boxPoint);
@@ -1414,7 +1427,7 @@ void World::SphereCapsule(std::uint32_t sphereId, std::uint32_t capsuleId) {
         const Real denom = Dot(ab, ab);
         Real t = 0.0;
         if (denom > kEpsilon) {
-            t = std::clamp(Dot(s.position - a, ab) / denom, 0.0, 1.0);
+            t = std::clamp<Real>(Dot(s.position - a, ab) / denom, 0.0, 1.0);
         }
         const Vec3 closest = a + ab * t;
         const Vec3 delta = closest - s.position;
@@ -1455,7 +1468,7 @@ void World::CapsuleCapsule(std::uint32_t aId, std::uint32_t bId) {
             return;
         }
 
-        const Real dist = std::sqrt(std::max(distSq, 0.0));
+        const Real dist = std::sqrt(std::max<Real>(distSq, 0.0));
         const Vec3 centerDelta = b.position - a.position;
         Vec3 normal = StableDirection(delta, {centerDelta, axisA, axisB, Cross(axisA, axisB)});
         if (Dot(normal, centerDelta) < 0.0) {
@@ -1483,7 +1496,7 @@ void World::CapsuleCapsule(std::uint32_t aId, std::uint32_t bId) {
                 if (Dot(endpointNormal, centerDelta) < 0.0) {
                     endpointNormal = -endpointNormal;
                 }
-                const Real endpointDist = std::sqrt(std::max(endpointDistSq, 0.0));
+                const Real endpointDist = std::sqrt(std::max<Real>(endpointDistSq, 0.0));
                 const std::uint8_t featureBProj = (tProj <= 1e-3) ? 0u : ((tProj >= 1.0 - 1e-3) ? 1u : 2u);
                 const std::uint64_t manifoldFeatureId = CanonicalFeaturePairId(aId, bId, endpointFeature, featureBProj, 1u);
                 AddContact(aId, bId, endpointNormal, endpointA + endpointNormal * a.radius, radiusSum - endpointDist, 5u, manifoldFeatureId);
@@ -1511,18 +1524,18 @@ void World::CapsuleBox(std::uint32_t capsuleId, std::uint32_t boxId) {
         }
 
         const Vec3 localDelta = closest.segmentPoint - closest.boxPoint;
-        const Real dist = std::sqrt(std::max(closest.distSq, 0.0));
+        const Real dist = std::sqrt(std::max<Real>(closest.distSq, 0.0));
         Vec3 normalLocal = StableDirection(localDelta, {closest.segmentPoint, segB - segA, axis, {0.0, 1.0, 0.0}});
         if (closest.distSq <= kEpsilon * kEpsilon) {
             const Real dx = b.halfExtents.x - std::abs(closest.segmentPoint.x);
             const Real dy = b.halfExtents.y - std::abs(closest.segmentPoint.y);
             const Real dz = b.halfExtents.z - std::abs(closest.segmentPoint.z);
             if (dx <= dy && dx <= dz) {
-                normalLocal = {(closest.segmentPoint.x >= 0.0) ? 1.0 : -1.0, 0.0, 0.0};
+                normalLocal = {(closest.segmentPoint.x >= 0.0) ? Real(1) : Real(-1), 0.0, 0.0};
             } else if (dy <= dz) {
-                normalLocal = {0.0, (closest.segmentPoint.y >= 0.0) ? 1.0 : -1.0, 0.0};
+                normalLocal = {0.0, (closest.segmentPoint.y >= 0.0) ? Real(1) : Real(-1), 0.0};
             } else {
-                normalLocal = {0.0, 0.0, (closest.segmentPoint.z >= 0.0) ? 1.0 : -1.0};
+                normalLocal = {0.0, 0.0, (closest.segmentPoint.z >= 0.0) ? Real(1) : Real(-1)};
             }
         }
         const Vec3 normalWorld = Rotate(b.orientation, normalLocal);
@@ -1613,13 +1626,13 @@ void World::SphereBox(std::uint32_t sphereId, std::uint32_t boxId) {
 
             Vec3 normalLocal;
             if (dx <= dy && dx <= dz) {
-                normalLocal = {(sphereCenterLocal.x >= 0.0) ? 1.0 : -1.0, 0.0, 0.0};
+                normalLocal = {(sphereCenterLocal.x >= 0.0) ? Real(1) : Real(-1), 0.0, 0.0};
                 penetration = s.radius + dx;
             } else if (dy <= dz) {
-                normalLocal = {0.0, (sphereCenterLocal.y >= 0.0) ? 1.0 : -1.0, 0.0};
+                normalLocal = {0.0, (sphereCenterLocal.y >= 0.0) ? Real(1) : Real(-1), 0.0};
                 penetration = s.radius + dy;
             } else {
-                normalLocal = {0.0, 0.0, (sphereCenterLocal.z >= 0.0) ? 1.0 : -1.0};
+                normalLocal = {0.0, 0.0, (sphereCenterLocal.z >= 0.0) ? Real(1) : Real(-1)};
                 penetration = s.radius + dz;
             }
 
@@ -1657,8 +1670,8 @@ void World::WarmStartJoints() {
             if (j.impulseSum == 0.0) {
                 continue;
             }
-            Body& a = bodies_[j.a];
-            Body& b = bodies_[j.b];
+            const core_internal::SolverBodyRef a = SolverBody(j.a);
+            const core_internal::SolverBodyRef b = SolverBody(j.b);
             const Vec3 ra = Rotate(a.orientation, j.localAnchorA);
             const Vec3 rb = Rotate(b.orientation, j.localAnchorB);
             const Vec3 delta = (b.position + rb) - (a.position + ra);
@@ -1676,8 +1689,8 @@ void World::WarmStartJoints() {
             if (linearSum + angularSum <= kEpsilon) {
                 continue;
             }
-            Body& a = bodies_[j.a];
-            Body& b = bodies_[j.b];
+            const core_internal::SolverBodyRef a = SolverBody(j.a);
+            const core_internal::SolverBodyRef b = SolverBody(j.b);
             const Mat3& invIA = bodyInvInertiaWorld_[j.a];
             const Mat3& invIB = bodyInvInertiaWorld_[j.b];
             const Vec3 ra = Rotate(a.orientation, j.localAnchorA);
@@ -1699,8 +1712,8 @@ void World::WarmStartJoints() {
             if (std::abs(j.impulseX) + std::abs(j.impulseY) + std::abs(j.impulseZ) <= kEpsilon) {
                 continue;
             }
-            Body& a = bodies_[j.a];
-            Body& b = bodies_[j.b];
+            const core_internal::SolverBodyRef a = SolverBody(j.a);
+            const core_internal::SolverBodyRef b = SolverBody(j.b);
             const Vec3 ra = Rotate(a.orientation, j.localAnchorA);
             const Vec3 rb = Rotate(b.orientation, j.localAnchorB);
             ApplyImpulse(a, b, bodyInvInertiaWorld_[j.a], bodyInvInertiaWorld_[j.b], ra, rb, {j.impulseX, j.impulseY, j.impulseZ});
@@ -1712,8 +1725,8 @@ void World::WarmStartJoints() {
             if (linearSum + angularSum <= kEpsilon) {
                 continue;
             }
-            Body& a = bodies_[j.a];
-            Body& b = bodies_[j.b];
+            const core_internal::SolverBodyRef a = SolverBody(j.a);
+            const core_internal::SolverBodyRef b = SolverBody(j.b);
             const Mat3& invIA = bodyInvInertiaWorld_[j.a];
             const Mat3& invIB = bodyInvInertiaWorld_[j.b];
             const Vec3 ra = Rotate(a.orientation, j.localAnchorA);
@@ -1727,8 +1740,8 @@ void World::WarmStartJoints() {
             if (sum <= kEpsilon) {
                 continue;
             }
-            Body& a = bodies_[j.a];
-            Body& b = bodies_[j.b];
+            const core_internal::SolverBodyRef a = SolverBody(j.a);
+            const core_internal::SolverBodyRef b = SolverBody(j.b);
             const Mat3& invIA = bodyInvInertiaWorld_[j.a];
             const Mat3& invIB = bodyInvInertiaWorld_[j.b];
             const Vec3 ra = Rotate(a.orientation, j.localAnchorA);
@@ -1748,8 +1761,8 @@ void World::WarmStartJoints() {
             if (linearSum + angularSum <= kEpsilon) {
                 continue;
             }
-            Body& a = bodies_[j.a];
-            Body& b = bodies_[j.b];
+            const core_internal::SolverBodyRef a = SolverBody(j.a);
+            const core_internal::SolverBodyRef b = SolverBody(j.b);
             const Mat3& invIA = bodyInvInertiaWorld_[j.a];
             const Mat3& invIB = bodyInvInertiaWorld_[j.b];
             const Vec3 ra = Rotate(a.orientation, j.localAnchorA);
@@ -1767,77 +1780,101 @@ void World::WarmStartJoints() {
         }
     }
 
-void World::SolveNormalScalar(Contact& c, const ContactPrep& prep) {
-
-        Body& a = bodies_[c.a];
-        Body& b = bodies_[c.b];
-
-        const Mat3& invIA = bodyInvInertiaWorld_[c.a];
-        const Mat3& invIB = bodyInvInertiaWorld_[c.b];
-
-        const Vec3& ra = prep.ra;
-        const Vec3& rb = prep.rb;
-
-        const Vec3 va = a.velocity + Cross(a.angularVelocity, ra);
-        const Vec3 vb = b.velocity + Cross(b.angularVelocity, rb);
-        const Vec3 relativeVelocity = vb - va;
-        const Real separatingVelocity = Dot(relativeVelocity, c.normal);
+bool World::PrepareNormalRow(const Contact& c,
+                             const ContactPrep& prep,
+                             const Body& bodyA,
+                             const Body& bodyB,
+                             Real invMassA,
+                             Real invMassB,
+                             NormalRowSetup& out) {
 
-        const Real speedIntoContact = -separatingVelocity;
-        const Real restitution = ComputeRestitution(speedIntoContact, a.restitution, b.restitution);
         const Real normalMass = prep.normalMass;
         if (normalMass <= kEpsilon) {
-            return;
+            return false;
         }
+        out.normalMass = normalMass;
+        out.restitution = std::clamp<Real>(std::min(bodyA.restitution, bodyB.restitution), 0.0, 1.0);
 
-        Real biasTerm = 0.0;
         Real penetration = c.penetration;
         if (c.anchorsValid && c.persistenceAge >= contactSolverConfig_.manifoldAnchorReuseMinAge) {
             Real anchorPenetration = 0.0;
             if (TryComputeAnchorSeparation(c, anchorPenetration)) {
                 penetration = anchorPenetration;
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                ++solverTelemetry_.anchorReuseHitCount;
+                ++ActiveSolverTelemetry().anchorReuseHitCount;
 #endif
             } else {
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                ++solverTelemetry_.anchorReuseFallbackCount;
+                ++ActiveSolverTelemetry().anchorReuseFallbackCount;
 #endif
             }
         }
-        const Real penetrationError = std::max(penetration - contactSolverConfig_.penetrationSlop, 0.0);
-        const Real massRatioBoost = ComputeHighMassRatioBoost(a, b);
+        const Real penetrationError = std::max<Real>(penetration - contactSolverConfig_.penetrationSlop, 0.0);
+        const Real massRatioBoost = ComputeHighMassRatioBoost(bodyA, bodyB);
         if (contactSolverConfig_.useSplitImpulse && !solverRelaxationPassActive_) {
             if (penetrationError > 0.0) {
-                if (normalMass > kEpsilon) {
-                    const Real boostedFactor = contactSolverConfig_.splitImpulseCorrectionFactor
-                        * (1.0 + contactSolverConfig_.highMassRatioSplitImpulseBoost * (massRatioBoost - 1.0));
-                    const Real correctionMagnitude = boostedFactor * penetrationError / normalMass;
-                    const Vec3 correction = correctionMagnitude * c.normal;
-                    AccumulateSplitImpulseCorrection(c.a, -correction * a.invMass, {0.0, 0.0, 0.0});
-                    AccumulateSplitImpulseCorrection(c.b, correction * b.invMass, {0.0, 0.0, 0.0});
-                }
+                const Real boostedFactor = contactSolverConfig_.splitImpulseCorrectionFactor
+                    * (1.0 + contactSolverConfig_.highMassRatioSplitImpulseBoost * (massRatioBoost - 1.0));
+                const Real correctionMagnitude = boostedFactor * penetrationError / normalMass;
+                const Vec3 correction = correctionMagnitude * c.normal;
+                AccumulateSplitImpulseCorrection(c.a, -correction * invMassA, {0.0, 0.0, 0.0});
+                AccumulateSplitImpulseCorrection(c.b, correction * invMassB, {0.0, 0.0, 0.0});
             }
         } else if (currentSubstepDt_ > kEpsilon && !solverRelaxationPassActive_) {
-            const Real maxSafeSeparatingSpeed = penetrationError / currentSubstepDt_;
-            if (separatingVelocity <= maxSafeSeparatingSpeed) {
-                const Real boostedBias = contactSolverConfig_.penetrationBiasFactor
-                    * (1.0 + contactSolverConfig_.highMassRatioBiasBoost * (massRatioBoost - 1.0));
-                biasTerm = (boostedBias * penetrationError) / currentSubstepDt_;
-                biasTerm = std::min(biasTerm, std::max(contactSolverConfig_.penetrationBiasMaxSpeed, 0.0));
-            }
-        }
-        if (contactSolverConfig_.softContactBiasRate > 0.0
+            // Applied only while the contact separates no faster than this (see the row solve).
+            out.biasGated = true;
+            out.maxSafeSeparatingSpeed = penetrationError / currentSubstepDt_;
+            const Real boostedBias = contactSolverConfig_.penetrationBiasFactor
+                * (1.0 + contactSolverConfig_.highMassRatioBiasBoost * (massRatioBoost - 1.0));
+            out.biasTerm = (boostedBias * penetrationError) / currentSubstepDt_;
+            out.biasTerm = std::min(out.biasTerm, std::max<Real>(contactSolverConfig_.penetrationBiasMaxSpeed, 0.0));
+        }
+        out.softEligible = contactSolverConfig_.softContactBiasRate > 0.0
             && contactSolverConfig_.softContactCompliance > 0.0
-            && c.persistenceAge >= contactSolverConfig_.softContactMinAge
+            && c.persistenceAge >= contactSolverConfig_.softContactMinAge;
+        if (out.softEligible) {
+            out.softBias = (contactSolverConfig_.softContactBiasRate * penetrationError)
+                / std::max(currentSubstepDt_, kEpsilon);
+            out.softenedMass = normalMass + contactSolverConfig_.softContactCompliance;
+        }
+        return true;
+    }
+
+void World::SolveNormalScalar(Contact& c, const ContactPrep& prep) {
+
+        const core_internal::SolverBodyRef a = SolverBody(c.a);
+        const core_internal::SolverBodyRef b = SolverBody(c.b);
+
+        NormalRowSetup row{};
+        if (!PrepareNormalRow(c, prep, a.body, b.body, a.invMass, b.invMass, row)) {
+            return;
+        }
+
+        const Mat3& invIA = bodyInvInertiaWorld_[c.a];
+        const Mat3& invIB = bodyInvInertiaWorld_[c.b];
+
+        const Vec3& ra = prep.ra;
+        const Vec3& rb = prep.rb;
+
+        const Vec3 va = a.velocity + Cross(a.angularVelocity, ra);
+        const Vec3 vb = b.velocity + Cross(b.angularVelocity, rb);
+        const Vec3 relativeVelocity = vb - va;
+        const Real separatingVelocity = Dot(relativeVelocity, c.normal);
+
+        const Real speedIntoContact = -separatingVelocity;
+        const Real restitution = ComputeRestitution(speedIntoContact, a.body.restitution, b.body.restitution);
+        const Real normalMass = row.normalMass;
+
+        Real biasTerm = 0.0;
+        if (row.biasGated && separatingVelocity <= row.maxSafeSeparatingSpeed) {
+            biasTerm = row.biasTerm;
+        }
+        if (row.softEligible
             && std::abs(separatingVelocity) <= contactSolverConfig_.softContactMaxNormalSpeed
             && separatingVelocity <= 0.0) {
-            const Real softBias = (contactSolverConfig_.softContactBiasRate * penetrationError)
-                / std::max(currentSubstepDt_, kEpsilon);
-            const Real softenedMass = normalMass + contactSolverConfig_.softContactCompliance;
-            const Real lambdaSoft = (softBias - separatingVelocity) / std::max(softenedMass, kEpsilon);
-            const Real oldNormalImpulse = c.normalImpulseSum;
-            c.normalImpulseSum = std::max(0.0, c.normalImpulseSum + lambdaSoft);
+            const Real lambdaSoft = (row.softBias - separatingVelocity) / std::max(row.softenedMass, kEpsilon);
+            const SolverReal oldNormalImpulse = c.normalImpulseSum;
+            c.normalImpulseSum = std::max<SolverReal>(0.0, c.normalImpulseSum + lambdaSoft);
             const Real softDelta = c.normalImpulseSum - oldNormalImpulse;
             ApplyImpulse(a, b, invIA, invIB, ra, rb, softDelta * c.normal);
             return;
@@ -1847,8 +1884,8 @@ void World::SolveNormalScalar(Contact& c, const ContactPrep& prep) {
         if (biasTerm > 0.0) {
             lambdaN += biasTerm / normalMass;
         }
-        const Real oldNormalImpulse = c.normalImpulseSum;
-        c.normalImpulseSum = std::max(0.0, c.normalImpulseSum + lambdaN);
+        const SolverReal oldNormalImpulse = c.normalImpulseSum;
+        c.normalImpulseSum = std::max<SolverReal>(0.0, c.normalImpulseSum + lambdaN);
         lambdaN = c.normalImpulseSum - oldNormalImpulse;
         ApplyImpulse(a, b, invIA, invIB, ra, rb, lambdaN * c.normal);
     }
@@ -1964,8 +2001,8 @@ void World::RecordManifoldSolveTelemetry(const Manifold& manifold,
             }
         };
 
-        accumulate(solverTelemetry_.manifoldSolveScope);
-        accumulate(solverTelemetry_.manifoldTypeBuckets[manifold.manifoldType]);
+        accumulate(ActiveSolverTelemetry().manifoldSolveScope);
+        accumulate(ActiveSolverTelemetry().manifoldTypeBuckets[manifold.manifoldType]);
     }
 #endif
 
@@ -2164,7 +2201,7 @@ void World::SelectBlockSolvePair(Manifold& manifold) const {
         const auto computePairQuality = [&](const Contact& a, const Contact& b) {
             const Real penetration = a.penetration + b.penetration;
             const Real spread = LengthSquared(a.point - b.point);
-            const Real supportAreaProxy = spread * std::max(0.0, penetration) * kSupportAreaProxyScale;
+            const Real supportAreaProxy = spread * std::max<Real>(0.0, penetration) * kSupportAreaProxyScale;
             const Vec3 midPoint = 0.5 * (a.point + b.point);
             const Vec3 centers = 0.5 * (bodies_[manifold.a].position + bodies_[manifold.b].position);
             const Real lever = LengthSquared(midPoint - centers);
@@ -2231,7 +2268,7 @@ void World::SelectBlockSolvePair(Manifold& manifold) const {
                 candidate.penetration = a.penetration + b.penetration;
                 candidate.spread = LengthSquared(a.point - b.point);
                 candidate.supportAreaProxy =
-                    candidate.spread * std::max(0.0, candidate.penetration) * kSupportAreaProxyScale;
+                    candidate.spread * std::max<Real>(0.0, candidate.penetration) * kSupportAreaProxyScale;
                 const Vec3 midPoint = 0.5 * (a.point + b.point);
                 candidate.lever = LengthSquared(midPoint - centers);
                 candidate.ageMin = static_cast<int>(std::min(a.persistenceAge, b.persistenceAge));
@@ -2317,6 +2354,10 @@ bool World::IsBlockSolveEligible(const Manifold& manifold, BlockSolveFallbackRea
         if (manifold.contacts.size() < 2) {
             return false;
         }
+        // Block solves assume rigid effective masses; reduced-tree contacts stay on scalar rows.
+        if (reducedArtImpulseRouting_ && (IsReducedTreeBody(manifold.a) || IsReducedTreeBody(manifold.b))) {
+            return false;
+        }
 
         const std::uint32_t typeBit = (manifold.manifoldType < 32u) ? (1u << manifold.manifoldType) : 0u;
         if (typeBit == 0u || (contactSolverConfig_.blockManifoldTypeMask & typeBit) == 0u) {
@@ -2415,7 +2456,7 @@ bool World::EnsureStableTwoPointOrder(Manifold& manifold) {
         }
         std::swap(manifold.contacts[0], manifold.contacts[1]);
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-        ++solverTelemetry_.reorderDetected;
+        ++ActiveSolverTelemetry().reorderDetected;
 #endif
         return true;
     }
@@ -2475,7 +2516,7 @@ bool World::IsFace4PointBlockEligible(const Manifold& manifold, BlockSolveFallba
                     *outReason = BlockSolveFallbackReason::PersistenceGate;
                 }
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                ++solverTelemetry_.face4BlockedByFrictionCoherenceGate;
+                ++ActiveSolverTelemetry().face4BlockedByFrictionCoherenceGate;
 #endif
                 return false;
             }
@@ -2490,7 +2531,7 @@ bool World::IsFace4PointBlockEligible(const Manifold& manifold, BlockSolveFallba
                     *outReason = BlockSolveFallbackReason::PersistenceGate;
                 }
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                ++solverTelemetry_.face4BlockedByFrictionCoherenceGate;
+                ++ActiveSolverTelemetry().face4BlockedByFrictionCoherenceGate;
 #endif
                 return false;
             }
@@ -2498,20 +2539,14 @@ bool World::IsFace4PointBlockEligible(const Manifold& manifold, BlockSolveFallba
         return true;
     }
 
-void World::SolveManifoldNormalImpulses(Manifold& manifold) {
-
-        if (manifold.contacts.empty()) {
-            return;
-        }
-        // Look up this manifold's solver-prep cache by pointer offset; manifolds_ is not
-        // resized between PrepareContactSolves() and the PGS loop so the offset is stable.
-        const std::size_t manifoldIdx = static_cast<std::size_t>(&manifold - manifolds_.data());
-        const ManifoldPrep& mPrep = manifoldPreps_[manifoldIdx];
+World::ManifoldNormalRoute World::BeginManifoldNormalSolve(Manifold& manifold) {
 
+        ManifoldNormalRoute route{};
+        route.selectedIndices = manifold.selectedBlockContactIndices;
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
         ResetBlockSolveDebugStep(manifold);
-        const int selectedIdx0 = manifold.selectedBlockContactIndices[0];
-        const int selectedIdx1 = manifold.selectedBlockContactIndices[1];
+        const int selectedIdx0 = route.selectedIndices[0];
+        const int selectedIdx1 = route.selectedIndices[1];
         if (selectedIdx0 >= 0 && selectedIdx1 >= 0
             && selectedIdx0 != selectedIdx1
             && static_cast<std::size_t>(std::max(selectedIdx0, selectedIdx1)) < manifold.contacts.size()) {
@@ -2529,21 +2564,22 @@ void World::SolveManifoldNormalImpulses(Manifold& manifold) {
 
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
         if (manifold.blockSolveEligible) {
-            ++solverTelemetry_.blockSolveEligible;
+            ++ActiveSolverTelemetry().blockSolveEligible;
         }
 #endif
 
         if (!manifold.blockSolveEligible) {
+            route.fallbackReason = ineligibleReason;
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-            ++solverTelemetry_.scalarPathIneligible;
+            ++ActiveSolverTelemetry().scalarPathIneligible;
             if (ineligibleReason == BlockSolveFallbackReason::TypePolicy) {
-                ++solverTelemetry_.blockRejectedByTypePolicy;
+                ++ActiveSolverTelemetry().blockRejectedByTypePolicy;
             } else if (ineligibleReason == BlockSolveFallbackReason::QualityGate
                        || ineligibleReason == BlockSolveFallbackReason::PersistenceGate) {
-                ++solverTelemetry_.blockRejectedByQualityOrPersistence;
+                ++ActiveSolverTelemetry().blockRejectedByQualityOrPersistence;
             }
             if (ineligibleReason == BlockSolveFallbackReason::PersistenceGate) {
-                ++solverTelemetry_.scalarFallbackPersistenceGate;
+                ++ActiveSolverTelemetry().scalarFallbackPersistenceGate;
             }
             IncrementBlockSolveFallbackCounter(manifold, ineligibleReason);
             if (debugBlockSolveRouting_) {
@@ -2559,21 +2595,7 @@ void World::SolveManifoldNormalImpulses(Manifold& manifold) {
                     manifold.selectedBlockPairPersistent ? 1 : 0);
             }
 #endif
-            for (std::size_t ci = 0; ci < manifold.contacts.size(); ++ci) {
-                SolveNormalScalar(manifold.contacts[ci], mPrep.contacts[ci]);
-            }
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-            if (selectedIdx0 >= 0 && selectedIdx1 >= 0
-                && static_cast<std::size_t>(std::max(selectedIdx0, selectedIdx1)) < manifold.contacts.size()) {
-                manifold.blockSolveDebug.selectedPostNormalImpulses = {
-                    manifold.contacts[static_cast<std::size_t>(selectedIdx0)].normalImpulseSum,
-                    manifold.contacts[static_cast<std::size_t>(selectedIdx1)].normalImpulseSum};
-            }
-            const Real impulseContinuityMetric = std::abs(manifold.blockSolveDebug.selectedPostNormalImpulses[0] - manifold.blockSolveDebug.selectedPreNormalImpulses[0])
-                + std::abs(manifold.blockSolveDebug.selectedPostNormalImpulses[1] - manifold.blockSolveDebug.selectedPreNormalImpulses[1]);
-            RecordManifoldSolveTelemetry(manifold, ineligibleReason, std::numeric_limits<float>::quiet_NaN(), impulseContinuityMetric);
-#endif
-            return;
+            return route;
         }
 
         BlockSolveFallbackReason fallbackReason = BlockSolveFallbackReason::None;
@@ -2583,27 +2605,29 @@ void World::SolveManifoldNormalImpulses(Manifold& manifold) {
         if (contactSolverConfig_.useFace4PointNormalBlock
             && IsFace4PointBlockEligible(manifold, &fallbackReason)) {
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-            ++solverTelemetry_.face4Attempted;
+            ++ActiveSolverTelemetry().face4Attempted;
 #endif
             blockSolved = SolveNormalProjected4(manifold, fallbackReason, determinantOrConditionEstimate);
             if (blockSolved) {
                 usedFace4 = true;
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                ++solverTelemetry_.face4Used;
+                ++ActiveSolverTelemetry().face4Used;
 #endif
             } else {
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                ++solverTelemetry_.face4FallbackToBlock2;
+                ++ActiveSolverTelemetry().face4FallbackToBlock2;
 #endif
             }
         }
         if (!blockSolved) {
             blockSolved = SolveNormalBlock2(manifold, fallbackReason, determinantOrConditionEstimate);
         }
+        route.fallbackReason = fallbackReason;
+        route.determinantOrConditionEstimate = determinantOrConditionEstimate;
         if (blockSolved) {
             manifold.usedBlockSolve = true;
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-            ++solverTelemetry_.blockSolveUsed;
+            ++ActiveSolverTelemetry().blockSolveUsed;
             ++manifold.blockSolveDebug.blockSolveUsedCount;
             if (debugBlockSolveRouting_) {
                 std::fprintf(
@@ -2617,56 +2641,47 @@ void World::SolveManifoldNormalImpulses(Manifold& manifold) {
 #endif
             // Face-4 projected solve already resolves all contact normals in a 4-point manifold.
             // Only run scalar extras for Block2, where the selected pair covers a strict subset.
-            if (!usedFace4) {
-                const int blockIdx0 = manifold.selectedBlockContactIndices[0];
-                const int blockIdx1 = manifold.selectedBlockContactIndices[1];
-                for (std::size_t i = 0; i < manifold.contacts.size(); ++i) {
-                    if (static_cast<int>(i) == blockIdx0 || static_cast<int>(i) == blockIdx1) {
-                        continue;
-                    }
-                    SolveNormalScalar(manifold.contacts[i], mPrep.contacts[i]);
-                }
+            if (usedFace4) {
+                route.rows = ManifoldNormalRoute::Rows::None;
+            } else {
+                route.rows = ManifoldNormalRoute::Rows::AllButBlockPair;
+                route.blockPair = manifold.selectedBlockContactIndices;
             }
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-            const Real impulseContinuityMetric = std::abs(manifold.blockSolveDebug.selectedPostNormalImpulses[0] - manifold.blockSolveDebug.selectedPreNormalImpulses[0])
-                + std::abs(manifold.blockSolveDebug.selectedPostNormalImpulses[1] - manifold.blockSolveDebug.selectedPreNormalImpulses[1]);
-            RecordManifoldSolveTelemetry(manifold, fallbackReason, determinantOrConditionEstimate, impulseContinuityMetric);
-#endif
-            return;
+            return route;
         }
 
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
         switch (fallbackReason) {
             case BlockSolveFallbackReason::InvalidManifoldNormal:
-                ++solverTelemetry_.scalarFallbackInvalidNormal;
+                ++ActiveSolverTelemetry().scalarFallbackInvalidNormal;
                 break;
             case BlockSolveFallbackReason::TypePolicy:
-                ++solverTelemetry_.blockRejectedByTypePolicy;
+                ++ActiveSolverTelemetry().blockRejectedByTypePolicy;
                 break;
             case BlockSolveFallbackReason::QualityGate:
-                ++solverTelemetry_.blockRejectedByQualityOrPersistence;
+                ++ActiveSolverTelemetry().blockRejectedByQualityOrPersistence;
                 break;
             case BlockSolveFallbackReason::PersistenceGate:
-                ++solverTelemetry_.scalarFallbackPersistenceGate;
-                ++solverTelemetry_.blockRejectedByQualityOrPersistence;
+                ++ActiveSolverTelemetry().scalarFallbackPersistenceGate;
+                ++ActiveSolverTelemetry().blockRejectedByQualityOrPersistence;
                 break;
             case BlockSolveFallbackReason::ContactNormalMismatch:
-                ++solverTelemetry_.scalarFallbackNormalMismatch;
+                ++ActiveSolverTelemetry().scalarFallbackNormalMismatch;
                 break;
             case BlockSolveFallbackReason::MissingBlockSlots:
-                ++solverTelemetry_.scalarFallbackMissingSlots;
+                ++ActiveSolverTelemetry().scalarFallbackMissingSlots;
                 break;
             case BlockSolveFallbackReason::DegenerateMassMatrix:
-                ++solverTelemetry_.scalarFallbackDegenerateSystem;
+                ++ActiveSolverTelemetry().scalarFallbackDegenerateSystem;
                 break;
             case BlockSolveFallbackReason::ConditionEstimateExceeded:
-                ++solverTelemetry_.scalarFallbackConditionEstimate;
+                ++ActiveSolverTelemetry().scalarFallbackConditionEstimate;
                 break;
             case BlockSolveFallbackReason::LcpFailure:
-                ++solverTelemetry_.scalarFallbackLcpFailure;
+                ++ActiveSolverTelemetry().scalarFallbackLcpFailure;
                 break;
             case BlockSolveFallbackReason::NonFiniteResult:
-                ++solverTelemetry_.scalarFallbackNonFinite;
+                ++ActiveSolverTelemetry().scalarFallbackNonFinite;
                 break;
             case BlockSolveFallbackReason::Ineligible:
                 break;
@@ -2683,18 +2698,23 @@ void World::SolveManifoldNormalImpulses(Manifold& manifold) {
                 static_cast<unsigned>(manifold.manifoldType),
                 static_cast<int>(fallbackReason));
         }
-#endif
-
-        for (std::size_t ci = 0; ci < manifold.contacts.size(); ++ci) {
-            SolveNormalScalar(manifold.contacts[ci], mPrep.contacts[ci]);
-        }
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
         if (contactSolverConfig_.useFace4PointNormalBlock
             && manifold.manifoldType == 9
             && manifold.contacts.size() == 4) {
-            ++solverTelemetry_.face4FallbackToScalar;
+            ++ActiveSolverTelemetry().face4FallbackToScalar;
         }
-        if (selectedIdx0 >= 0 && selectedIdx1 >= 0
+#endif
+        return route;
+    }
+
+void World::FinishManifoldNormalSolve(Manifold& manifold, const ManifoldNormalRoute& route) {
+
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+        // Block solves record their own post-solve impulses for the selected pair.
+        const int selectedIdx0 = route.selectedIndices[0];
+        const int selectedIdx1 = route.selectedIndices[1];
+        if (!manifold.usedBlockSolve
+            && selectedIdx0 >= 0 && selectedIdx1 >= 0
             && static_cast<std::size_t>(std::max(selectedIdx0, selectedIdx1)) < manifold.contacts.size()) {
             manifold.blockSolveDebug.selectedPostNormalImpulses = {
                 manifold.contacts[static_cast<std::size_t>(selectedIdx0)].normalImpulseSum,
@@ -2702,40 +2722,127 @@ void World::SolveManifoldNormalImpulses(Manifold& manifold) {
         }
         const Real impulseContinuityMetric = std::abs(manifold.blockSolveDebug.selectedPostNormalImpulses[0] - manifold.blockSolveDebug.selectedPreNormalImpulses[0])
             + std::abs(manifold.blockSolveDebug.selectedPostNormalImpulses[1] - manifold.blockSolveDebug.selectedPreNormalImpulses[1]);
-        RecordManifoldSolveTelemetry(manifold, fallbackReason, determinantOrConditionEstimate, impulseContinuityMetric);
+        RecordManifoldSolveTelemetry(
+            manifold, route.fallbackReason, route.determinantOrConditionEstimate, impulseContinuityMetric);
+#else
+        (void)manifold;
+        (void)route;
 #endif
     }
 
+void World::SolveManifoldNormalImpulses(Manifold& manifold) {
+
+        if (manifold.contacts.empty()) {
+            return;
+        }
+        // Look up this manifold's solver-prep cache by pointer offset; the manifold list is not
+        // resized between PrepareContactSolves() and the PGS loop so the offset is stable.
+        const std::size_t manifoldIdx = static_cast<std::size_t>(&manifold - manifoldStore_.manifolds.data());
+        const ManifoldPrep& mPrep = manifoldPreps_[manifoldIdx];
+
+        const ManifoldNormalRoute route = BeginManifoldNormalSolve(manifold);
+        for (std::size_t ci = 0; ci < manifold.contacts.size(); ++ci) {
+            if (route.SolvesRow(ci)) {
+                SolveNormalScalar(manifold.contacts[ci], mPrep.contacts[ci]);
+            }
+        }
+        FinishManifoldNormalSolve(manifold, route);
+    }
+
+void World::SolveNormalRows4(Manifold* const* lanes,
+                             const ManifoldNormalRoute* routes,
+                             std::size_t laneCount,
+                             solver_internal::ContactBodyLanes& bodies) {
+
+        std::size_t rowCount = 0;
+        for (std::size_t l = 0; l < laneCount; ++l) {
+            rowCount = std::max(rowCount, lanes[l]->contacts.size());
+        }
+        const solver_internal::NormalRowParams params{
+            EffectiveRestitutionCutoffSpeed(),
+            contactSolverConfig_.softContactMaxNormalSpeed,
+        };
+        for (std::size_t ci = 0; ci < rowCount; ++ci) {
+            solver_internal::NormalRowLanes rows{};
+            bool anyActive = false;
+            for (std::size_t l = 0; l < laneCount; ++l) {
+                Manifold& manifold = *lanes[l];
+                if (ci >= manifold.contacts.size() || !routes[l].SolvesRow(ci)) {
+                    continue;
+                }
+                const Contact& c = manifold.contacts[ci];
+                const std::size_t manifoldIdx =
+                    static_cast<std::size_t>(&manifold - manifoldStore_.manifolds.data());
+                const ContactPrep& prep = manifoldPreps_[manifoldIdx].contacts[ci];
+                NormalRowSetup setup{};
+                if (!PrepareNormalRow(c, prep, bodies_[c.a], bodies_[c.b], bodies.invMassA[l], bodies.invMassB[l], setup)) {
+                    continue;
+                }
+                rows.normal.Set(l, c.normal);
+                rows.ra.Set(l, prep.ra);
+                rows.rb.Set(l, prep.rb);
+                rows.normalMass[l] = setup.normalMass;
+                rows.impulseSum[l] = c.normalImpulseSum;
+                rows.restitution[l] = setup.restitution;
+                rows.biasTerm[l] = setup.biasTerm;
+                rows.maxSafeSeparatingSpeed[l] = setup.maxSafeSeparatingSpeed;
+                rows.softBias[l] = setup.softBias;
+                rows.softenedMass[l] = setup.softenedMass;
+                rows.active[l] = true;
+                rows.biasGated[l] = setup.biasGated;
+                rows.softEligible[l] = setup.softEligible;
+                anyActive = true;
+            }
+            if (!anyActive) {
+                continue;
+            }
+            solver_internal::SolveNormalRows(bodies, rows, params);
+            for (std::size_t l = 0; l < laneCount; ++l) {
+                if (rows.active[l]) {
+                    lanes[l]->contacts[ci].normalImpulseSum = rows.impulseSum[l];
+                }
+            }
+        }
+    }
+
 void World::ApplyImpulse(
-        Body& a,
-        Body& b,
+        const core_internal::SolverBodyRef& a,
+        const core_internal::SolverBodyRef& b,
         const Mat3& invIA,
         const Mat3& invIB,
         const Vec3& ra,
         const Vec3& rb,
         const Vec3& impulse) {
 
-        if (!a.isSleeping) {
+        if (reducedArtImpulseRouting_ && ApplyReducedTreeImpulse(a, b, invIA, invIB, ra, rb, impulse, {})) {
+            return;
+        }
+        // Static bodies (zero inverse mass and world inertia) are skipped outright: the update
+        // would be a no-op, and a shared ground body is touched by every island in a parallel solve.
+        if (!a.isSleeping && a.invMass != 0.0) {
             a.velocity -= impulse * a.invMass;
             a.angularVelocity -= invIA * Cross(ra, impulse);
         }
-        if (!b.isSleeping) {
+        if (!b.isSleeping && b.invMass != 0.0) {
             b.velocity += impulse * b.invMass;
             b.angularVelocity += invIB * Cross(rb, impulse);
         }
     }
 
 void World::ApplyAngularImpulse(
-        Body& a,
-        Body& b,
+        const core_internal::SolverBodyRef& a,
+        const core_internal::SolverBodyRef& b,
         const Mat3& invIA,
         const Mat3& invIB,
         const Vec3& angularImpulse) {
 
-        if (!a.isSleeping) {
+        if (reducedArtImpulseRouting_ && ApplyReducedTreeImpulse(a, b, invIA, invIB, {}, {}, {}, angularImpulse)) {
+            return;
+        }
+        if (!a.isSleeping && a.invMass != 0.0) {
             a.angularVelocity -= invIA * angularImpulse;
         }
-        if (!b.isSleeping) {
+        if (!b.isSleeping && b.invMass != 0.0) {
             b.angularVelocity += invIB * angularImpulse;
         }
     }
@@ -2746,7 +2853,7 @@ void World::PositionalCorrection() {
             return;
         }
 
-        for (const Manifold& manifold : manifolds_) {
+        for (const Manifold& manifold : manifoldStore_.manifolds) {
             for (const Contact& c : manifold.contacts) {
                 Body& a = bodies_[c.a];
                 Body& b = bodies_[c.b];
@@ -2756,7 +2863,7 @@ void World::PositionalCorrection() {
                     continue;
                 }
 
-                const Real correctionMagnitude = std::max(c.penetration - contactSolverConfig_.penetrationSlop, 0.0)
+                const Real correctionMagnitude = std::max<Real>(c.penetration - contactSolverConfig_.penetrationSlop, 0.0)
                     * contactSolverConfig_.positionalCorrectionPercent / invMassSum;
                 const Vec3 correction = correctionMagnitude * c.normal;
 
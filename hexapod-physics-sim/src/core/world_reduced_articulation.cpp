@@ -0,0 +1,464 @@
+#include "minphys3d/core/subsystems.hpp"
+#include "minphys3d/core/world.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace minphys3d {
+
+namespace {
+
+// Joints whose articulated effective mass D = s^T·IA·s falls below this are treated as
+// degenerate; the tree is left on the maximal-coordinate rows for the substep.
+constexpr Real kReducedTreeMinD = 1.0e-9;
+
+// Spatial impulse about `origin` of a linear impulse `J` at `point` plus an angular impulse `L`.
+SpatialVec ImpulseAbout(const Vec3& origin, const Vec3& point, const Vec3& J, const Vec3& L) {
+    return {Cross(point - origin, J) + L, J};
+}
+
+Vec3 PointVelocityChange(const SpatialVec& dV, const Vec3& origin, const Vec3& point) {
+    return dV.lin + Cross(dV.ang, point - origin);
+}
+
+// Adds an applied spatial impulse on `link` and marks its path to the root for propagation.
+void SeedImpulse(ReducedArtTree& tree, std::uint32_t link, const SpatialVec& impulse) {
+    ReducedArtLink& target = tree.links[link];
+    target.p = target.p - impulse;
+    for (int i = static_cast<int>(link); i >= 0 && !tree.links[static_cast<std::size_t>(i)].pending;
+         i = tree.links[static_cast<std::size_t>(i)].parent) {
+        tree.links[static_cast<std::size_t>(i)].pending = true;
+        tree.pendingLinks.push_back(static_cast<std::uint32_t>(i));
+    }
+}
+
+// Impulse-form ABA: the seeded impulses are folded tip→root into the parents' bias impulses,
+// then the velocity changes are recovered root→tip. Leaves `dV` on every link and the
+// propagation scratch cleared.
+void PropagateImpulses(ReducedArtTree& tree) {
+    std::sort(tree.pendingLinks.begin(), tree.pendingLinks.end(), std::greater<std::uint32_t>{});
+    for (const std::uint32_t i : tree.pendingLinks) {
+        if (i == 0u) {
+            continue;
+        }
+        ReducedArtLink& link = tree.links[i];
+        link.u = -DotSpatial(link.s, link.p);
+        ReducedArtLink& parent = tree.links[static_cast<std::size_t>(link.parent)];
+        parent.p += link.p + (link.u * link.invD) * link.U;
+    }
+
+    ReducedArtLink& root = tree.links[0];
+    root.dV = SpatialVec{};
+    if (tree.floatingBase && root.pending) {
+        SpatialVec solved{};
+        if (spatial_internal::SolveSpatialFactorized(tree.rootL, tree.rootD, tree.rootPerm, root.p, solved)) {
+            root.dV = -1.0 * solved;
+        }
+    }
+    for (std::size_t i = 1; i < tree.links.size(); ++i) {
+        ReducedArtLink& link = tree.links[i];
+        const SpatialVec& parentDV = tree.links[static_cast<std::size_t>(link.parent)].dV;
+        const Real dq = ((link.pending ? link.u : 0.0) - DotSpatial(link.U, parentDV)) * link.invD;
+        link.dV = parentDV + dq * link.s;
+    }
+
+    for (const std::uint32_t i : tree.pendingLinks) {
+        ReducedArtLink& link = tree.links[i];
+        link.p = SpatialVec{};
+        link.u = 0.0;
+        link.pending = false;
+    }
+    tree.pendingLinks.clear();
+}
+
+// Adds each link's `dV` to its body velocities (COM velocity from the spatial velocity about
+// `origin`). `bodyRef(index)` returns a `SolverBodyRef`-like view.
+template <typename BodyRefFn>
+void ApplyTreeVelocityChanges(const ReducedArtTree& tree, BodyRefFn&& bodyRef) {
+    for (const ReducedArtLink& link : tree.links) {
+        auto body = bodyRef(link.bodyIdx);
+        if (body.isSleeping || body.invMass == 0.0) {
+            continue;
+        }
+        body.angularVelocity += link.dV.ang;
+        body.velocity += PointVelocityChange(link.dV, tree.origin, body.position);
+    }
+}
+
+Quat AxisAngleQuat(const Vec3& unitAxis, Real angle) {
+    const Real halfAngle = Real(0.5) * angle;
+    const Real s = std::sin(halfAngle);
+    return {std::cos(halfAngle), unitAxis.x * s, unitAxis.y * s, unitAxis.z * s};
+}
+
+// Shortest-arc rotation taking unit `from` onto unit `to`.
+Quat ShortestArcQuat(const Vec3& from, const Vec3& to) {
+    const Real d = Dot(from, to);
+    if (d < Real(-1) + Real(1e-6)) {
+        const Vec3 perpendicular = core_internal::JointReferenceFallback(from);
+        return {0.0, perpendicular.x, perpendicular.y, perpendicular.z};
+    }
+    const Vec3 c = Cross(from, to);
+    return Normalize(Quat{Real(1) + d, c.x, c.y, c.z});
+}
+
+// Relative orientation conj(qA)·qB of an ideal hinge at `angle`: local axis B turned onto local
+// axis A, then B's reference turned `angle` past A's about that axis, so that
+// `ComputeServoJointAngle` reads back `angle`.
+Quat HingeRelativeOrientation(const ServoJoint& joint, Real angle) {
+    Vec3 axisA{};
+    Vec3 axisB{};
+    if (!TryNormalize(joint.localAxisA, axisA) || !TryNormalize(joint.localAxisB, axisB)) {
+        return Quat{};
+    }
+    const Quat align = ShortestArcQuat(axisB, axisA);
+    const Vec3 refA = core_internal::ResolveJointReference(Quat{}, joint.localReferenceA, axisA);
+    const Vec3 refB = core_internal::ResolveJointReference(align, joint.localReferenceB, axisA);
+    const Real twist = core_internal::SignedAngleAroundAxis(refB, refA, axisA) + angle;
+    return AxisAngleQuat(axisA, twist) * align;
+}
+
+} // namespace
+
+void World::BuildReducedArticulationTrees() {
+    reducedArtImpulseRouting_ = false;
+    if (!articulationConfig_.enableReducedCoordinateTrees || articulationChains_.empty()) {
+        reducedArtTrees_.clear();
+        reducedArtBodySlots_.clear();
+        reducedArtJointMask_.clear();
+        return;
+    }
+
+    reducedArtBodySlots_.assign(bodies_.size(), ReducedArtBodySlot{});
+    reducedArtJointMask_.assign(servoJoints_.size(), 0u);
+
+    // Chains sharing a root become one tree; the tree entries are reused for their capacity.
+    std::size_t treeCount = 0;
+    for (const ArtChain& chain : articulationChains_) {
+        if (chain.links.size() < 2) {
+            continue;
+        }
+        const std::uint32_t rootBody = chain.links[0].bodyIdx;
+        std::uint32_t treeIdx = reducedArtBodySlots_[rootBody].tree;
+        if (treeIdx == ReducedArtBodySlot::kNone) {
+            treeIdx = static_cast<std::uint32_t>(treeCount++);
+            if (reducedArtTrees_.size() < treeCount) {
+                reducedArtTrees_.emplace_back();
+            }
+            ReducedArtTree& tree = reducedArtTrees_[treeIdx];
+            tree.links.clear();
+            tree.pendingLinks.clear();
+            tree.active = false;
+            ReducedArtLink root{};
+            root.bodyIdx = rootBody;
+            tree.links.push_back(root);
+            reducedArtBodySlots_[rootBody] = {treeIdx, 0u};
+        }
+        ReducedArtTree& tree = reducedArtTrees_[treeIdx];
+        // Chain link li >= 1 lands at base + li - 1; chain parents precede their children.
+        const std::uint32_t base = static_cast<std::uint32_t>(tree.links.size());
+        for (std::size_t li = 1; li < chain.links.size(); ++li) {
+            const ArtLink& src = chain.links[li];
+            ReducedArtLink link{};
+            link.bodyIdx = src.bodyIdx;
+            link.jointIdx = src.jointIdx;
+            link.parent = src.parent == 0 ? 0 : static_cast<int>(base) + src.parent - 1;
+            reducedArtBodySlots_[src.bodyIdx] = {treeIdx, static_cast<std::uint32_t>(tree.links.size())};
+            tree.links.push_back(link);
+        }
+    }
+    reducedArtTrees_.resize(treeCount);
+}
+
+bool World::IsReducedTreeBody(std::uint32_t bodyId) const {
+    if (bodyId >= reducedArtBodySlots_.size()) {
+        return false;
+    }
+    const std::uint32_t tree = reducedArtBodySlots_[bodyId].tree;
+    return tree != ReducedArtBodySlot::kNone && reducedArtTrees_[tree].active;
+}
+
+void World::PrepareReducedArticulationTrees() {
+    artChainIndexForLeafBody_.assign(bodies_.size(), kInvalidArticulationChain);
+    reducedArtImpulseRouting_ = false;
+    std::fill(reducedArtJointMask_.begin(), reducedArtJointMask_.end(), 0u);
+    if (reducedArtTrees_.empty() || servoJointPreps_.size() != servoJoints_.size()) {
+        return;
+    }
+    const Real dt = currentSubstepDt_;
+
+    for (ReducedArtTree& tree : reducedArtTrees_) {
+        tree.active = false;
+        bool usable = true;
+        for (std::size_t i = 0; i < tree.links.size() && usable; ++i) {
+            const Body& body = bodies_[tree.links[i].bodyIdx];
+            usable = !body.isSleeping && (i == 0 || (body.invMass > 0.0 && body.mass > kEpsilon));
+        }
+        if (!usable) {
+            continue;
+        }
+
+        const Body& rootBody = bodies_[tree.links[0].bodyIdx];
+        tree.floatingBase = rootBody.invMass > 0.0;
+        tree.origin = rootBody.position;
+
+        // Rigid inertias and joint twists about the tree origin.
+        for (std::size_t i = 0; i < tree.links.size(); ++i) {
+            ReducedArtLink& link = tree.links[i];
+            const Body& body = bodies_[link.bodyIdx];
+            link.I = SpatialInertia{};
+            if (body.invMass > 0.0) {
+                const Mat3 R = RotationMatrix(body.orientation);
+                Mat3 Ilocal{};
+                if (!InvertMat3(body.invInertiaLocal, Ilocal)) {
+                    usable = false;
+                    break;
+                }
+                link.I = SpatialInertiaFromBody(body.mass, R * Ilocal * Transpose(R), body.position, tree.origin);
+            }
+            link.IA = ToArticulatedInertia(link.I);
+            if (i > 0) {
+                const ServoJoint& joint = servoJoints_[link.jointIdx];
+                const Body& parentBody = bodies_[joint.a];
+                const Vec3 axis = servoJointPreps_[link.jointIdx].axisA;
+                const Vec3 anchor = parentBody.position + Rotate(parentBody.orientation, joint.localAnchorA);
+                link.s = {axis, Cross(axis, tree.origin - anchor)};
+            }
+        }
+        // Tip→root articulated inertias.
+        for (std::size_t i = tree.links.size() - 1; usable && i > 0; --i) {
+            ReducedArtLink& link = tree.links[i];
+            link.U = SpatialMul(link.IA, link.s);
+            const Real D = DotSpatial(link.s, link.U);
+            if (!std::isfinite(D) || D <= kReducedTreeMinD) {
+                usable = false;
+                break;
+            }
+            link.invD = 1.0 / D;
+            tree.links[static_cast<std::size_t>(link.parent)].IA += SubtractJointProjection(link.IA, link.U, link.invD);
+        }
+        if (usable && tree.floatingBase) {
+            usable = spatial_internal::FactorSpatialSolveSystem(
+                tree.links[0].IA, tree.rootL, tree.rootD, tree.rootPerm, nullptr);
+        }
+        if (!usable) {
+            continue;
+        }
+        tree.active = true;
+        for (std::size_t i = 1; i < tree.links.size(); ++i) {
+            reducedArtJointMask_[tree.links[i].jointIdx] = 1u;
+        }
+
+        // Project the body velocities onto the tree DOFs, keeping the tree's momentum: each link
+        // hands its momentum (relative to a fixed base) to the propagation as an impulse. Drive
+        // torques are added as equal and opposite angular impulses across their joints.
+        tree.rootVelocity = SpatialVec{};
+        if (!tree.floatingBase) {
+            tree.rootVelocity = {rootBody.angularVelocity,
+                                 rootBody.velocity + Cross(rootBody.angularVelocity, tree.origin - rootBody.position)};
+        }
+        for (std::size_t i = 0; i < tree.links.size(); ++i) {
+            const ReducedArtLink& link = tree.links[i];
+            const Body& body = bodies_[link.bodyIdx];
+            if (body.invMass <= 0.0) {
+                continue;
+            }
+            const SpatialVec velocity{body.angularVelocity,
+                                      body.velocity + Cross(body.angularVelocity, tree.origin - body.position)};
+            SeedImpulse(tree, static_cast<std::uint32_t>(i), SpatialMul(link.I, velocity - tree.rootVelocity));
+            if (i > 0) {
+                const Real drive = servoJoints_[link.jointIdx].articulationDriveTorque * dt;
+                if (drive != 0.0) {
+                    SeedImpulse(tree, static_cast<std::uint32_t>(i), {drive * link.s.ang, Vec3{}});
+                    SeedImpulse(tree, static_cast<std::uint32_t>(link.parent), {-drive * link.s.ang, Vec3{}});
+                }
+            }
+        }
+        PropagateImpulses(tree);
+        for (const ReducedArtLink& link : tree.links) {
+            Body& body = bodies_[link.bodyIdx];
+            if (body.invMass <= 0.0) {
+                continue;
+            }
+            const SpatialVec V = tree.rootVelocity + link.dV;
+            body.angularVelocity = V.ang;
+            body.velocity = PointVelocityChange(V, tree.origin, body.position);
+        }
+
+        // Tree joints: anchor and axis rows are implied by the coordinates; the hinge row keeps
+        // its PD law but is rescaled to the articulated effective mass. Hinge softness is
+        // proportional to the effective inverse mass, so scaling the cached denominators by
+        // wRigid / wArt is exact.
+        for (std::size_t i = 1; i < tree.links.size(); ++i) {
+            const ReducedArtLink& link = tree.links[i];
+            ServoJoint& joint = servoJoints_[link.jointIdx];
+            ServoJointPrep& prep = servoJointPreps_[link.jointIdx];
+            prep.skipAnchor = true;
+            prep.skipAngular = true;
+            joint.impulseX = joint.impulseY = joint.impulseZ = 0.0;
+            joint.angularImpulse1 = joint.angularImpulse2 = 0.0;
+            if (!prep.hingeActive) {
+                continue;
+            }
+            SeedImpulse(tree, static_cast<std::uint32_t>(i), {link.s.ang, Vec3{}});
+            SeedImpulse(tree, static_cast<std::uint32_t>(link.parent), {-1.0 * link.s.ang, Vec3{}});
+            PropagateImpulses(tree);
+            const Real wArt =
+                Dot(link.s.ang, link.dV.ang - tree.links[static_cast<std::size_t>(link.parent)].dV.ang);
+            if (!(wArt > kEpsilon) || !(prep.invWHingeForSpeed > 0.0)) {
+                continue;
+            }
+            const Real scale = 1.0 / (prep.invWHingeForSpeed * wArt);
+            prep.invDenomHinge *= scale;
+            prep.invDenomHingePos *= scale;
+            prep.invDenomHingeDamp *= scale;
+            prep.invWHingeForSpeed = 1.0 / wArt;
+        }
+        reducedArtImpulseRouting_ = true;
+    }
+}
+
+bool World::ApplyReducedTreeImpulse(const core_internal::SolverBodyRef& a,
+                                    const core_internal::SolverBodyRef& b,
+                                    const Mat3& invIA,
+                                    const Mat3& invIB,
+                                    const Vec3& ra,
+                                    const Vec3& rb,
+                                    const Vec3& impulse,
+                                    const Vec3& angularImpulse) {
+    const auto slotOf = [this](const core_internal::SolverBodyRef& ref) -> const ReducedArtBodySlot* {
+        const std::size_t idx = static_cast<std::size_t>(&ref.body - bodies_.data());
+        if (ref.invMass == 0.0 || ref.isSleeping || idx >= reducedArtBodySlots_.size()) {
+            return nullptr;
+        }
+        const ReducedArtBodySlot& slot = reducedArtBodySlots_[idx];
+        if (slot.tree == ReducedArtBodySlot::kNone || !reducedArtTrees_[slot.tree].active) {
+            return nullptr;
+        }
+        return &slot;
+    };
+    const ReducedArtBodySlot* slotA = slotOf(a);
+    const ReducedArtBodySlot* slotB = slotOf(b);
+    if (slotA == nullptr && slotB == nullptr) {
+        return false;
+    }
+
+    if (slotA == nullptr && !a.isSleeping && a.invMass != 0.0) {
+        a.velocity -= impulse * a.invMass;
+        a.angularVelocity -= invIA * (Cross(ra, impulse) + angularImpulse);
+    }
+    if (slotB == nullptr && !b.isSleeping && b.invMass != 0.0) {
+        b.velocity += impulse * b.invMass;
+        b.angularVelocity += invIB * (Cross(rb, impulse) + angularImpulse);
+    }
+
+    const auto solverBody = [this](std::uint32_t id) { return SolverBody(id); };
+    if (slotA != nullptr) {
+        ReducedArtTree& tree = reducedArtTrees_[slotA->tree];
+        SeedImpulse(tree, slotA->link, -1.0 * ImpulseAbout(tree.origin, a.position + ra, impulse, angularImpulse));
+        if (slotB == nullptr || slotB->tree != slotA->tree) {
+            PropagateImpulses(tree);
+            ApplyTreeVelocityChanges(tree, solverBody);
+        }
+    }
+    if (slotB != nullptr) {
+        ReducedArtTree& tree = reducedArtTrees_[slotB->tree];
+        SeedImpulse(tree, slotB->link, ImpulseAbout(tree.origin, b.position + rb, impulse, angularImpulse));
+        PropagateImpulses(tree);
+        ApplyTreeVelocityChanges(tree, solverBody);
+    }
+    return true;
+}
+
+bool World::ComputeReducedContactCompliance(const Contact& c, Mat3& compliance) {
+    const auto slotOf = [this](std::uint32_t id) -> const ReducedArtBodySlot* {
+        return IsReducedTreeBody(id) && bodies_[id].invMass > 0.0 ? &reducedArtBodySlots_[id] : nullptr;
+    };
+    const ReducedArtBodySlot* slotA = slotOf(c.a);
+    const ReducedArtBodySlot* slotB = slotOf(c.b);
+    if (slotA == nullptr && slotB == nullptr) {
+        return false;
+    }
+
+    // Point velocity change of body `id` per impulse `J` at the contact point (rigid bodies).
+    const auto rigidResponse = [this, &c](std::uint32_t id, const Vec3& J) -> Vec3 {
+        const Body& body = bodies_[id];
+        if (body.invMass == 0.0 || body.isSleeping) {
+            return Vec3{};
+        }
+        const Vec3 r = c.point - body.position;
+        return J * body.invMass + Cross(bodyInvInertiaWorld_[id] * Cross(r, J), r);
+    };
+
+    const Vec3 basis[3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+    for (int k = 0; k < 3; ++k) {
+        const Vec3& e = basis[k];
+        Vec3 dva = slotA == nullptr ? -1.0 * rigidResponse(c.a, e) : Vec3{};
+        Vec3 dvb = slotB == nullptr ? rigidResponse(c.b, e) : Vec3{};
+        if (slotA != nullptr) {
+            ReducedArtTree& tree = reducedArtTrees_[slotA->tree];
+            SeedImpulse(tree, slotA->link, ImpulseAbout(tree.origin, c.point, -1.0 * e, Vec3{}));
+            if (slotB == nullptr || slotB->tree != slotA->tree) {
+                PropagateImpulses(tree);
+            }
+        }
+        if (slotB != nullptr) {
+            ReducedArtTree& tree = reducedArtTrees_[slotB->tree];
+            SeedImpulse(tree, slotB->link, ImpulseAbout(tree.origin, c.point, e, Vec3{}));
+            PropagateImpulses(tree);
+            dvb = PointVelocityChange(tree.links[slotB->link].dV, tree.origin, c.point);
+        }
+        if (slotA != nullptr) {
+            const ReducedArtTree& tree = reducedArtTrees_[slotA->tree];
+            dva = PointVelocityChange(tree.links[slotA->link].dV, tree.origin, c.point);
+        }
+        const Vec3 column = dvb - dva;
+        compliance.m[0][k] = column.x;
+        compliance.m[1][k] = column.y;
+        compliance.m[2][k] = column.z;
+    }
+    return true;
+}
+
+void World::ApplyReducedTangentMasses(const Manifold& manifold, const Contact& c, Real& mass0, Real& mass1) const {
+    const std::size_t manifoldIdx = static_cast<std::size_t>(&manifold - manifoldStore_.manifolds.data());
+    if (manifoldIdx >= manifoldPreps_.size()) {
+        return;
+    }
+    const std::size_t contactIdx = static_cast<std::size_t>(&c - manifold.contacts.data());
+    const ManifoldPrep& prep = manifoldPreps_[manifoldIdx];
+    if (contactIdx >= prep.contacts.size() || !prep.contacts[contactIdx].hasReducedCompliance) {
+        return;
+    }
+    const Mat3& K = prep.contacts[contactIdx].reducedCompliance;
+    mass0 = Dot(manifold.t0, K * manifold.t0);
+    if (std::isfinite(mass1)) {
+        mass1 = Dot(manifold.t1, K * manifold.t1);
+    }
+}
+
+void World::ProjectReducedArticulationPoses() {
+    for (ReducedArtTree& tree : reducedArtTrees_) {
+        if (!tree.active) {
+            continue;
+        }
+        // Angles are sampled from the integrated poses before any link is moved.
+        for (std::size_t i = 1; i < tree.links.size(); ++i) {
+            ReducedArtLink& link = tree.links[i];
+            const ServoJoint& joint = servoJoints_[link.jointIdx];
+            link.angle = core_internal::ComputeServoJointAngle(bodies_[joint.a], bodies_[joint.b], joint);
+        }
+        for (std::size_t i = 1; i < tree.links.size(); ++i) {
+            const ReducedArtLink& link = tree.links[i];
+            const ServoJoint& joint = servoJoints_[link.jointIdx];
+            const Body& parent = bodies_[joint.a];
+            Body& child = bodies_[joint.b];
+            child.orientation = Normalize(parent.orientation * HingeRelativeOrientation(joint, link.angle));
+            child.position = parent.position + Rotate(parent.orientation, joint.localAnchorA)
+                - Rotate(child.orientation, joint.localAnchorB);
+        }
+    }
+}
+
+} // namespace minphys3d
@@ -0,0 +1,310 @@
+#include "minphys3d/core/snapshot_archive.hpp"
+#include "minphys3d/core/world.hpp"
+
+#include <cstring>
+#include <memory>
+
+namespace minphys3d {
+namespace {
+
+constexpr std::uint32_t kSnapshotMagic = 0x5350484du; // "MHPS" little-endian; byte-swapped on a foreign host.
+// 2: `cachedPotentialPairs_` is stored sorted. 3: terrain attachment carries its shared buffer.
+// 4: manifold contacts are slices of stored pools; impulse caches are flat.
+// 5: substep contact reuse reference poses.
+constexpr std::uint32_t kSnapshotVersion = 5u;
+
+struct SnapshotHeader {
+    std::uint32_t magic = kSnapshotMagic;
+    std::uint32_t version = kSnapshotVersion;
+    std::uint64_t layoutFingerprint = 0;
+    std::uint64_t payloadBytes = 0;
+    std::uint64_t payloadChecksum = 0;
+};
+
+constexpr std::uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+constexpr std::uint64_t kFnvPrime = 1099511628211ull;
+
+std::uint64_t Fnv1a(const std::uint8_t* data, std::size_t size, std::uint64_t hash = kFnvOffsetBasis) {
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= kFnvPrime;
+    }
+    return hash;
+}
+
+template <typename Archive>
+void TransferCompoundChildren(Archive& archive, std::vector<CompoundChild>& children) {
+    archive.PodVector(children);
+}
+
+// Body is trivially copyable apart from its compound child list, so it is visited field by
+// field; adding a Body field means adding it here (the layout fingerprint catches the size).
+template <typename Archive>
+void TransferBody(Archive& archive, Body& body) {
+    archive.Pod(body.shape);
+    archive.Pod(body.position);
+    archive.Pod(body.velocity);
+    archive.Pod(body.force);
+    archive.Pod(body.orientation);
+    archive.Pod(body.angularVelocity);
+    archive.Pod(body.torque);
+    archive.Pod(body.radius);
+    archive.Pod(body.halfHeight);
+    archive.Pod(body.halfExtents);
+    TransferCompoundChildren(archive, body.compoundChildren);
+    archive.Pod(body.planeNormal);
+    archive.Pod(body.planeOffset);
+    archive.Pod(body.mass);
+    archive.Pod(body.invMass);
+    archive.Pod(body.invInertiaLocal);
+    archive.Pod(body.restitution);
+    archive.Pod(body.staticFriction);
+    archive.Pod(body.dynamicFriction);
+    archive.Pod(body.linearDamping);
+    archive.Pod(body.angularDamping);
+    archive.Pod(body.isStatic);
+    archive.Pod(body.isSleeping);
+    archive.Pod(body.isTerrainAttachment);
+    archive.Pod(body.sleepCounter);
+    archive.Pod(body.collisionGroup);
+    archive.Pod(body.collisionMask);
+    archive.Pod(body.centerOfMassLocal);
+}
+
+// `contactPool` must already hold the pool the manifold's contacts are a slice of.
+template <typename Archive>
+void TransferManifold(Archive& archive, Manifold& manifold, std::vector<Contact>& contactPool) {
+    archive.Pod(manifold.a);
+    archive.Pod(manifold.b);
+    archive.Pod(manifold.normal);
+    archive.Pod(manifold.manifoldType);
+    std::uint32_t contactOffset = manifold.contacts.offset();
+    std::uint32_t contactCount = static_cast<std::uint32_t>(manifold.contacts.size());
+    archive.Pod(contactOffset);
+    archive.Pod(contactCount);
+    if constexpr (Archive::kReading) {
+        if (static_cast<std::uint64_t>(contactOffset) + contactCount > contactPool.size()) {
+            archive.Reject();
+            contactOffset = 0;
+            contactCount = 0;
+        }
+        manifold.contacts.Bind(contactPool.data(), contactOffset, contactCount);
+    }
+    archive.Pod(manifold.blockNormalImpulseSum);
+    archive.Pod(manifold.blockContactKeys);
+    archive.Pod(manifold.blockSlotValid);
+    archive.Pod(manifold.selectedBlockContactIndices);
+    archive.Pod(manifold.selectedBlockContactKeys);
+    archive.Pod(manifold.t0);
+    archive.Pod(manifold.t1);
+    archive.Pod(manifold.tangentBasisValid);
+    archive.Pod(manifold.manifoldTangentImpulseSum);
+    archive.Pod(manifold.manifoldTangentImpulseValid);
+    archive.Pod(manifold.stickConstraintActive);
+    archive.Pod(manifold.stickConstraintAge);
+    archive.Pod(manifold.cachedImpulseByContactKey);
+    archive.Pod(manifold.selectedBlockPairPersistent);
+    archive.Pod(manifold.selectedBlockPairQualityPass);
+    archive.Pod(manifold.lowQuality);
+    archive.Pod(manifold.blockSolveEligible);
+    archive.Pod(manifold.usedBlockSolve);
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+    archive.Pod(manifold.blockSolveDebug);
+#endif
+}
+
+template <typename Archive>
+void TransferManifolds(Archive& archive, std::vector<Manifold>& manifolds, std::vector<Contact>& contactPool) {
+    archive.PodVector(contactPool);
+    const std::size_t count = archive.Elements(manifolds);
+    for (std::size_t i = 0; i < count && archive.Ok(); ++i) {
+        TransferManifold(archive, manifolds[i], contactPool);
+    }
+}
+
+template <typename Archive>
+void TransferTerrainAttachment(Archive& archive, World::TerrainHeightfieldAttachment& terrain) {
+    archive.Pod(terrain.enabled);
+    archive.Pod(terrain.revision);
+    archive.Pod(terrain.rows);
+    archive.Pod(terrain.cols);
+    archive.Pod(terrain.cellSizeM);
+    archive.Pod(terrain.gridOriginWorld);
+    archive.Pod(terrain.centerWorld);
+    archive.Pod(terrain.planeNormal);
+    archive.Pod(terrain.planeHeightM);
+    archive.Pod(terrain.baseHeightM);
+    archive.Pod(terrain.useConservativeCollision);
+    archive.PodVector(terrain.surfaceHeightsM);
+    archive.PodVector(terrain.collisionHeightsM);
+    // A shared buffer is stored by value; a restored world owns a private copy with the same
+    // tile revisions, so terrain contact ids match the captured world.
+    bool sharedHeights = terrain.sharedHeights != nullptr;
+    archive.Pod(sharedHeights);
+    if constexpr (Archive::kReading) {
+        terrain.sharedHeights.reset();
+        if (sharedHeights && archive.Ok()) {
+            auto heights = std::make_shared<TerrainHeightfieldBuffer>();
+            heights->Transfer(archive);
+            terrain.sharedHeights = std::move(heights);
+        }
+    } else if (sharedHeights) {
+        const_cast<TerrainHeightfieldBuffer&>(*terrain.sharedHeights).Transfer(archive);
+    }
+}
+
+} // namespace
+
+std::uint64_t World::SnapshotLayoutFingerprint() {
+    const std::uint64_t sizes[] = {
+        sizeof(Real),
+        sizeof(Body),
+        sizeof(CompoundChild),
+        sizeof(Contact),
+        sizeof(Manifold),
+        sizeof(BroadphaseProxy),
+        sizeof(TreeNode),
+        sizeof(Pair),
+        sizeof(DistanceJoint),
+        sizeof(HingeJoint),
+        sizeof(BallSocketJoint),
+        sizeof(FixedJoint),
+        sizeof(PrismaticJoint),
+        sizeof(ServoJoint),
+        sizeof(ContactSolverConfig),
+        sizeof(JointSolverConfig),
+        sizeof(BroadphaseConfig),
+        sizeof(BroadphaseMetrics),
+        sizeof(ArticulationConfig),
+        sizeof(SolverBodyConfig),
+        sizeof(NarrowphaseCacheKey),
+        sizeof(NarrowphaseCache),
+        sizeof(ConvexSeedKey),
+        sizeof(EpaPenetrationResult),
+        sizeof(PersistentPointKey),
+        sizeof(core_internal::PersistentPointImpulseState),
+        sizeof(TerrainHeightfieldAttachment),
+        MINPHYS3D_SOLVER_TELEMETRY_ENABLED,
+    };
+    return Fnv1a(reinterpret_cast<const std::uint8_t*>(sizes), sizeof(sizes));
+}
+
+// Everything the next `Step` reads that is not rebuilt from scratch before use. Per-substep
+// derived state (islands and their colourings, joint / manifold preps, articulation chains,
+// the solver-body mirror, split-impulse deltas, terrain contact scratch) is rebuilt by the
+// pipeline and therefore not stored.
+template <typename Archive>
+void World::TransferSnapshotState(Archive& archive) {
+    archive.Pod(gravity_);
+    archive.Pod(maxBodyLinearSpeed_);
+    archive.Pod(maxBodyAngularSpeed_);
+    archive.Pod(contactSolverConfig_);
+    archive.Pod(jointSolverConfig_);
+    archive.Pod(broadphaseConfig_);
+    archive.Pod(broadphaseMetrics_);
+    archive.Pod(broadphaseStepCounter_);
+    archive.Pod(lastBroadphaseRebuildStep_);
+    archive.Pod(narrowphaseDispatchPolicy_);
+    archive.Pod(currentSubstepDt_);
+    archive.Pod(articulationConfig_);
+    archive.Pod(solverBodyConfig_);
+
+    const std::size_t bodyCount = archive.Elements(bodies_);
+    for (std::size_t i = 0; i < bodyCount && archive.Ok(); ++i) {
+        TransferBody(archive, bodies_[i]);
+    }
+    archive.PodVector(bodyInvInertiaWorld_);
+    archive.PodVector(shapeRevisionCounters_);
+    archive.PodVector(shapeGeometrySignatures_);
+    archive.Pod(resolvedCollisionShapesCacheFrame_);
+
+    archive.PodVector(proxies_);
+    archive.PodVector(treeNodes_);
+    archive.Pod(rootNode_);
+    archive.Pod(freeNode_);
+    archive.Pod(lastBroadphaseMovedProxyCount_);
+    archive.PodVector(movedProxyIds_);
+    archive.PodVector(cachedPotentialPairs_);
+    archive.PodVector(previousBodyActiveState_);
+
+    archive.PodVector(contacts_);
+    archive.PodVector(previousContacts_);
+    TransferManifolds(archive, manifoldStore_.manifolds, manifoldStore_.contacts);
+    TransferManifolds(archive, previousManifoldStore_.manifolds, previousManifoldStore_.contacts);
+
+    archive.PodVector(joints_);
+    archive.PodVector(hingeJoints_);
+    archive.PodVector(ballSocketJoints_);
+    archive.PodVector(fixedJoints_);
+    archive.PodVector(prismaticJoints_);
+    archive.PodVector(servoJoints_);
+    archive.PodVector(servoAngleSampleCache_);
+    archive.Pod(servoAngleSampleCacheValid_);
+    archive.Pod(servoPositionSolveSubstepCounter_);
+    archive.PodVector(substepContactReuse_.position);
+    archive.PodVector(substepContactReuse_.orientation);
+    archive.PodVector(substepContactReuse_.boundingRadius);
+    archive.PodVector(substepContactReuse_.sleeping);
+    archive.Pod(substepContactReuse_.jointCount);
+    archive.Pod(substepContactReuse_.consecutiveReuses);
+    archive.Pod(substepContactReuse_.valid);
+
+    persistentPointImpulses_.Transfer(archive);
+    persistentPointImpulsesPrevious_.Transfer(archive);
+    archive.Pod(persistenceMatchDiagnostics_);
+
+    archive.PodMap(narrowphaseCache_);
+    archive.PodMap(convexManifoldSeeds_);
+
+    TransferTerrainAttachment(archive, terrainAttachment_);
+    archive.Pod(terrainAttachmentBodyId_);
+}
+
+std::vector<std::uint8_t> World::CaptureSnapshot() const {
+    std::vector<std::uint8_t> blob(sizeof(SnapshotHeader));
+    core_internal::SnapshotWriter writer(blob);
+    // The field list is shared with restore and so takes a mutable world; the writer only reads.
+    const_cast<World*>(this)->TransferSnapshotState(writer);
+
+    SnapshotHeader header{};
+    header.layoutFingerprint = SnapshotLayoutFingerprint();
+    header.payloadBytes = blob.size() - sizeof(SnapshotHeader);
+    header.payloadChecksum = Fnv1a(blob.data() + sizeof(SnapshotHeader), blob.size() - sizeof(SnapshotHeader));
+    std::memcpy(blob.data(), &header, sizeof(header));
+    return blob;
+}
+
+bool World::RestoreSnapshot(const std::uint8_t* data, std::size_t size) {
+    if (data == nullptr || size < sizeof(SnapshotHeader)) {
+        return false;
+    }
+    SnapshotHeader header{};
+    std::memcpy(&header, data, sizeof(header));
+    const std::uint8_t* payload = data + sizeof(SnapshotHeader);
+    const std::size_t payloadBytes = size - sizeof(SnapshotHeader);
+    if (header.magic != kSnapshotMagic || header.version != kSnapshotVersion
+        || header.layoutFingerprint != SnapshotLayoutFingerprint() || header.payloadBytes != payloadBytes
+        || header.payloadChecksum != Fnv1a(payload, payloadBytes)) {
+        return false;
+    }
+
+    // The header and checksum are verified before the first field is written, so a rejected blob
+    // never leaves the world half restored. A blob that passes them was written by this layout.
+    core_internal::SnapshotReader reader(payload, payloadBytes);
+    TransferSnapshotState(reader);
+    assert(reader.Ok() && reader.Remaining() == 0);
+
+    // Rebuilt on demand: resolved collision shapes are keyed by
+    // `resolvedCollisionShapesCacheFrame_`, the sweep-and-prune order is re-sorted from the
+    // restored proxies, and the servo topology flag is recomputed from the restored joints.
+    sweepAndPrune_.axis = -1;
+    resolvedCollisionShapesCache_.clear();
+    resolvedCollisionShapesCacheBuiltFrame_.clear();
+    collisionShapePool_.clear();
+    collisionShapeBvhItems_.clear();
+    collisionShapeBvhNodes_.clear();
+    InvalidateServoPositionTopologyCache();
+    return reader.Ok();
+}
+
+} // namespace minphys3d
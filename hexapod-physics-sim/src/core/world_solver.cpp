@@ -2,8 +2,10 @@
 #include "minphys3d/core/sleep_system.hpp"
 #include "minphys3d/core/subsystems.hpp"
 #include "minphys3d/core/world.hpp"
+#include "minphys3d/core/world_solver_hooks.hpp"
 #include "minphys3d/solver/block2_solver.hpp"
 #include "minphys3d/solver/block4_solver.hpp"
+#include "minphys3d/solver/constraint_coloring.hpp"
 #include "minphys3d/solver/island_ordering.hpp"
 
 #include <chrono>
@@ -141,12 +143,111 @@ bool ComputeUseVelocityBiasesForServoPosition(
     return maxFanout > kFanoutThreshold;
 }
 
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+void MergeManifoldSolveBucket(World::SolverTelemetry::ManifoldSolveBucket& into,
+                              const World::SolverTelemetry::ManifoldSolveBucket& from) {
+    into.solveCount += from.solveCount;
+    into.manifoldContactCount += from.manifoldContactCount;
+    into.selectedBlockSize += from.selectedBlockSize;
+    into.blockUsed += from.blockUsed;
+    into.fallbackUsed += from.fallbackUsed;
+    into.fallbackReason.none += from.fallbackReason.none;
+    into.fallbackReason.ineligible += from.fallbackReason.ineligible;
+    into.fallbackReason.persistenceGate += from.fallbackReason.persistenceGate;
+    into.fallbackReason.invalidManifoldNormal += from.fallbackReason.invalidManifoldNormal;
+    into.fallbackReason.contactNormalMismatch += from.fallbackReason.contactNormalMismatch;
+    into.fallbackReason.missingBlockSlots += from.fallbackReason.missingBlockSlots;
+    into.fallbackReason.degenerateMassMatrix += from.fallbackReason.degenerateMassMatrix;
+    into.fallbackReason.conditionEstimateExceeded += from.fallbackReason.conditionEstimateExceeded;
+    into.fallbackReason.lcpFailure += from.fallbackReason.lcpFailure;
+    into.fallbackReason.nonFiniteResult += from.fallbackReason.nonFiniteResult;
+    into.determinantOrConditionEstimate += from.determinantOrConditionEstimate;
+    into.determinantOrConditionEstimateSamples += from.determinantOrConditionEstimateSamples;
+    into.impulseContinuityMetric += from.impulseContinuityMetric;
+    into.impulseContinuityMetricSamples += from.impulseContinuityMetricSamples;
+}
+
+/// Folds a parallel island batch's counters into the world telemetry. Integer counters match the
+/// serial pass exactly; the bucket `double` sums may differ in the last bits (summation order).
+void MergeSolverTelemetry(World::SolverTelemetry& into, const World::SolverTelemetry& from) {
+    into.blockSolveEligible += from.blockSolveEligible;
+    into.blockSolveUsed += from.blockSolveUsed;
+    into.scalarPathIneligible += from.scalarPathIneligible;
+    into.scalarFallbackPersistenceGate += from.scalarFallbackPersistenceGate;
+    into.scalarFallbackInvalidNormal += from.scalarFallbackInvalidNormal;
+    into.scalarFallbackNormalMismatch += from.scalarFallbackNormalMismatch;
+    into.scalarFallbackMissingSlots += from.scalarFallbackMissingSlots;
+    into.scalarFallbackDegenerateSystem += from.scalarFallbackDegenerateSystem;
+    into.scalarFallbackConditionEstimate += from.scalarFallbackConditionEstimate;
+    into.scalarFallbackLcpFailure += from.scalarFallbackLcpFailure;
+    into.scalarFallbackNonFinite += from.scalarFallbackNonFinite;
+    into.reorderDetected += from.reorderDetected;
+    into.featureIdChurnEvents += from.featureIdChurnEvents;
+    into.topologyChangeEvents += from.topologyChangeEvents;
+    into.impulseResetPoints += from.impulseResetPoints;
+    into.selectedPairOscillationEvents += from.selectedPairOscillationEvents;
+    into.manifoldPointAdds += from.manifoldPointAdds;
+    into.manifoldPointRemoves += from.manifoldPointRemoves;
+    into.manifoldPointReorders += from.manifoldPointReorders;
+    into.manifoldQualityLow += from.manifoldQualityLow;
+    into.manifoldQualityMedium += from.manifoldQualityMedium;
+    into.manifoldQualityHigh += from.manifoldQualityHigh;
+    into.tangentBasisResets += from.tangentBasisResets;
+    into.tangentBasisReused += from.tangentBasisReused;
+    into.tangentImpulseReprojected += from.tangentImpulseReprojected;
+    into.tangentImpulseReset += from.tangentImpulseReset;
+    into.manifoldFrictionBudgetSaturated += from.manifoldFrictionBudgetSaturated;
+    into.manifoldFrictionBudgetSaturatedSelectedPair += from.manifoldFrictionBudgetSaturatedSelectedPair;
+    into.manifoldFrictionBudgetSaturatedAllContacts += from.manifoldFrictionBudgetSaturatedAllContacts;
+    into.manifoldFrictionBudgetSaturatedBlended += from.manifoldFrictionBudgetSaturatedBlended;
+    into.blockRejectedByTypePolicy += from.blockRejectedByTypePolicy;
+    into.blockRejectedByQualityOrPersistence += from.blockRejectedByQualityOrPersistence;
+    into.face4Attempted += from.face4Attempted;
+    into.face4Used += from.face4Used;
+    into.face4FallbackToBlock2 += from.face4FallbackToBlock2;
+    into.face4FallbackToScalar += from.face4FallbackToScalar;
+    into.face4BlockedByFrictionCoherenceGate += from.face4BlockedByFrictionCoherenceGate;
+    into.anchorReuseHitCount += from.anchorReuseHitCount;
+    into.anchorReuseFallbackCount += from.anchorReuseFallbackCount;
+    into.supportDepthOrderApplied += from.supportDepthOrderApplied;
+    into.supportDepthOrderBypassed += from.supportDepthOrderBypassed;
+    into.contactRowBatches4 += from.contactRowBatches4;
+    into.contactRowBatchLanes += from.contactRowBatchLanes;
+    into.jointBlockSolveUsed += from.jointBlockSolveUsed;
+    into.jointBlockFallbackDegenerate += from.jointBlockFallbackDegenerate;
+    into.jointBlockFallbackConditionEstimate += from.jointBlockFallbackConditionEstimate;
+    into.jointBlockFallbackNonFinite += from.jointBlockFallbackNonFinite;
+    into.epaFallbackUsed += from.epaFallbackUsed;
+    into.epaIterationBailout += from.epaIterationBailout;
+    into.epaDegenerateFaces += from.epaDegenerateFaces;
+    into.epaDuplicateSupports += from.epaDuplicateSupports;
+    into.terrainContactAdds += from.terrainContactAdds;
+    into.terrainCellsTested += from.terrainCellsTested;
+    into.terrainContactsEmitted += from.terrainContactsEmitted;
+    into.terrainManifoldMerges += from.terrainManifoldMerges;
+    into.terrainCacheHits += from.terrainCacheHits;
+    into.terrainDirtyCellRefreshes += from.terrainDirtyCellRefreshes;
+    into.articulationContactComplianceAccepted += from.articulationContactComplianceAccepted;
+    into.articulationContactComplianceRejected += from.articulationContactComplianceRejected;
+    into.articulationPassCSkippedContacts += from.articulationPassCSkippedContacts;
+    into.articulationPassCSkippedConditioning += from.articulationPassCSkippedConditioning;
+    into.articulationPassCSkippedDeltaClamp += from.articulationPassCSkippedDeltaClamp;
+    into.articulationPositionSkippedConditioning += from.articulationPositionSkippedConditioning;
+    into.articulationSpatialSolveFailures += from.articulationSpatialSolveFailures;
+    into.articulationSpatialSolveRegularized += from.articulationSpatialSolveRegularized;
+    MergeManifoldSolveBucket(into.manifoldSolveScope, from.manifoldSolveScope);
+    for (const auto& [type, bucket] : from.manifoldTypeBuckets) {
+        MergeManifoldSolveBucket(into.manifoldTypeBuckets[type], bucket);
+    }
+}
+#endif
+
 } // namespace
 
 void World::ResolveTOIPipeline(Real dt) {
         Real remaining = dt;
         const int maxToiIterations = std::max(contactSolverConfig_.toi.max_iterations, 1);
-        const Real toiMinTimeStep = std::max(contactSolverConfig_.toi.min_time_step, 1e-9);
+        const Real toiMinTimeStep = std::max<Real>(contactSolverConfig_.toi.min_time_step, 1e-9);
         int iterations = 0;
         while (remaining > toiMinTimeStep && iterations < maxToiIterations) {
             const TOIEvent hit = FindEarliestTOI(remaining);
@@ -156,14 +257,14 @@ void World::ResolveTOIPipeline(Real dt) {
                 break;
             }
 
-            const Real advanceTime = std::max(0.0, hit.toi);
+            const Real advanceTime = std::max<Real>(0.0, hit.toi);
             if (advanceTime > 0.0) {
                 AdvanceDynamicBodies(advanceTime);
                 remaining -= advanceTime;
             }
             ResolveTOIImpact(hit);
             if (hit.toi <= toiMinTimeStep) {
-                remaining = std::max(0.0, remaining - toiMinTimeStep);
+                remaining = std::max<Real>(0.0, remaining - toiMinTimeStep);
             }
             ++iterations;
         }
@@ -174,7 +275,7 @@ void World::ResolveTOIPipeline(Real dt) {
     }
 
 void World::WarmStartContacts() {
-        for (Manifold& m : manifolds_) {
+        for (Manifold& m : manifoldStore_.manifolds) {
             EnsureStableTwoPointOrder(m);
             std::vector<bool> skipPerContactNormal(m.contacts.size(), false);
             const int selected0 = m.selectedBlockContactIndices[0];
@@ -193,8 +294,8 @@ void World::WarmStartContacts() {
                         if (slot >= 0) {
                             const Real cachedNormalImpulse = m.blockNormalImpulseSum[slot];
                             if (cachedNormalImpulse != 0.0) {
-                                Body& a = bodies_[c.a];
-                                Body& b = bodies_[c.b];
+                                const core_internal::SolverBodyRef a = SolverBody(c.a);
+                                const core_internal::SolverBodyRef b = SolverBody(c.b);
                                 const Mat3& invIA = bodyInvInertiaWorld_[c.a];
                                 const Mat3& invIB = bodyInvInertiaWorld_[c.b];
                                 const Vec3 ra = c.point - a.position;
@@ -214,12 +315,12 @@ void World::WarmStartContacts() {
             if (useManifoldTangentWarmStart) {
                 Real totalNormal = 0.0;
                 for (const Contact& c : m.contacts) {
-                    totalNormal += std::max(c.normalImpulseSum, 0.0);
+                    totalNormal += std::max<Real>(c.normalImpulseSum, 0.0);
                 }
                 const Real equalWeight = 1.0 / static_cast<Real>(m.contacts.size());
                 for (Contact& c : m.contacts) {
                     const Real w = totalNormal > kEpsilon
-                        ? std::max(c.normalImpulseSum, 0.0) / totalNormal
+                        ? std::max<Real>(c.normalImpulseSum, 0.0) / totalNormal
                         : equalWeight;
                     c.tangentImpulseSum0 = w * m.manifoldTangentImpulseSum[0];
                     c.tangentImpulseSum1 = w * m.manifoldTangentImpulseSum[1];
@@ -229,7 +330,7 @@ void World::WarmStartContacts() {
             for (Contact& c : m.contacts) {
                 if (const std::array<Real, 3>* cached = FindPerContactImpulseCache(m, c.key)) {
                     // Normal impulse warm-start source precedence is unchanged: per-contact cache always applies.
-                    c.normalImpulseSum = std::max((*cached)[0], 0.0);
+                    c.normalImpulseSum = std::max<Real>((*cached)[0], 0.0);
                     // Tangent warm-start precedence:
                     // 1) Manifold tangent accumulator (when manifold basis + impulses are valid).
                     // 2) Per-contact cache fallback only when manifold tangent basis is unavailable/invalid.
@@ -250,8 +351,8 @@ void World::WarmStartContacts() {
                     continue;
                 }
 
-                Body& a = bodies_[c.a];
-                Body& b = bodies_[c.b];
+                const core_internal::SolverBodyRef a = SolverBody(c.a);
+                const core_internal::SolverBodyRef b = SolverBody(c.b);
                 const Mat3& invIA = bodyInvInertiaWorld_[c.a];
                 const Mat3& invIB = bodyInvInertiaWorld_[c.b];
                 const Vec3 ra = c.point - a.position;
@@ -267,7 +368,7 @@ void World::WarmStartContacts() {
                 const Vec3 impulse = normalImpulse + tangentImpulse;
                 ApplyImpulse(a, b, invIA, invIB, ra, rb, impulse);
                 std::array<Real, 3>& cacheEntry = EnsurePerContactImpulseCache(m, c.key);
-                cacheEntry[0] = std::max(c.normalImpulseSum, 0.0);
+                cacheEntry[0] = std::max<Real>(c.normalImpulseSum, 0.0);
                 cacheEntry[1] = c.tangentImpulseSum0;
                 cacheEntry[2] = c.tangentImpulseSum1;
                 ++contactIndex;
@@ -293,8 +394,8 @@ bool World::SolveNormalBlock2(Manifold& manifold, BlockSolveFallbackReason& fall
 
         Contact& c0 = manifold.contacts[static_cast<std::size_t>(idx0)];
         Contact& c1 = manifold.contacts[static_cast<std::size_t>(idx1)];
-        Body& a = bodies_[c0.a];
-        Body& b = bodies_[c0.b];
+        const core_internal::SolverBodyRef a = SolverBody(c0.a);
+        const core_internal::SolverBodyRef b = SolverBody(c0.b);
         const std::uint32_t bodyAIndex = c0.a;
         const std::uint32_t bodyBIndex = c0.b;
 
@@ -317,7 +418,7 @@ bool World::SolveNormalBlock2(Manifold& manifold, BlockSolveFallbackReason& fall
         // substep by PrepareContactSolves. The block solver internals still rebuild K
         // from invIA/invIB/ra/rb (separate optimisation target); here we only avoid
         // recomputing the rhs effective masses on every PGS iteration.
-        const std::size_t mIdx = static_cast<std::size_t>(&manifold - manifolds_.data());
+        const std::size_t mIdx = static_cast<std::size_t>(&manifold - manifoldStore_.manifolds.data());
         const ManifoldPrep& mPrep = manifoldPreps_[mIdx];
         const ContactPrep& prep0 = mPrep.contacts[static_cast<std::size_t>(idx0)];
         const ContactPrep& prep1 = mPrep.contacts[static_cast<std::size_t>(idx1)];
@@ -345,11 +446,11 @@ bool World::SolveNormalBlock2(Manifold& manifold, BlockSolveFallbackReason& fall
 
         const auto computeRhs = [&](Contact& c, const Vec3& contactNormal, Real separatingVelocity, Real contactNormalMass) {
             const Real speedIntoContact = -separatingVelocity;
-            const Real restitution = ComputeRestitution(speedIntoContact, a.restitution, b.restitution);
-            const Real massRatioBoost = ComputeHighMassRatioBoost(a, b);
+            const Real restitution = ComputeRestitution(speedIntoContact, a.body.restitution, b.body.restitution);
+            const Real massRatioBoost = ComputeHighMassRatioBoost(a.body, b.body);
 
             Real biasTerm = 0.0;
-            const Real penetrationError = std::max(c.penetration - contactSolverConfig_.penetrationSlop, 0.0);
+            const Real penetrationError = std::max<Real>(c.penetration - contactSolverConfig_.penetrationSlop, 0.0);
             if (contactSolverConfig_.useSplitImpulse && !solverRelaxationPassActive_) {
                 if (penetrationError > 0.0 && contactNormalMass > kEpsilon) {
                     const Real boostedFactor = contactSolverConfig_.splitImpulseCorrectionFactor
@@ -365,10 +466,10 @@ bool World::SolveNormalBlock2(Manifold& manifold, BlockSolveFallbackReason& fall
                     const Real boostedBias = contactSolverConfig_.penetrationBiasFactor
                         * (1.0 + contactSolverConfig_.highMassRatioBiasBoost * (massRatioBoost - 1.0));
                     biasTerm = (boostedBias * penetrationError) / currentSubstepDt_;
-                    biasTerm = std::min(biasTerm, std::max(contactSolverConfig_.penetrationBiasMaxSpeed, 0.0));
+                    biasTerm = std::min(biasTerm, std::max<Real>(contactSolverConfig_.penetrationBiasMaxSpeed, 0.0));
                 }
             }
-            return -(1.0 + restitution) * separatingVelocity + std::max(biasTerm, 0.0);
+            return -(Real(1) + restitution) * separatingVelocity + std::max<Real>(biasTerm, 0.0);
         };
 
         solver_internal::Block2SolveInput solveInput{};
@@ -378,8 +479,8 @@ bool World::SolveNormalBlock2(Manifold& manifold, BlockSolveFallbackReason& fall
         solveInput.blockDiagonalMinimum = contactSolverConfig_.blockDiagonalMinimum;
         solveInput.blockDeterminantEpsilon = contactSolverConfig_.blockDeterminantEpsilon;
         solveInput.blockConditionEstimateMax = contactSolverConfig_.blockConditionEstimateMax;
-        solveInput.contacts[0] = {normal0, ra0, rb0, std::max(c0.normalImpulseSum, 0.0), computeRhs(c0, normal0, vn0, k11)};
-        solveInput.contacts[1] = {normal1, ra1, rb1, std::max(c1.normalImpulseSum, 0.0), computeRhs(c1, normal1, vn1, k22)};
+        solveInput.contacts[0] = {normal0, ra0, rb0, std::max<Real>(c0.normalImpulseSum, 0.0), computeRhs(c0, normal0, vn0, k11)};
+        solveInput.contacts[1] = {normal1, ra1, rb1, std::max<Real>(c1.normalImpulseSum, 0.0), computeRhs(c1, normal1, vn1, k22)};
 
         const solver_internal::Block2SolveResult result = solver_internal::SolveBlock2NormalLcp(solveInput);
         determinantOrConditionEstimate = result.conditionEstimate;
@@ -417,8 +518,8 @@ bool World::SolveNormalProjected4(Manifold& manifold, BlockSolveFallbackReason&
 
         const std::uint32_t bodyAIndex = manifold.contacts[0].a;
         const std::uint32_t bodyBIndex = manifold.contacts[0].b;
-        Body& a = bodies_[bodyAIndex];
-        Body& b = bodies_[bodyBIndex];
+        const core_internal::SolverBodyRef a = SolverBody(bodyAIndex);
+        const core_internal::SolverBodyRef b = SolverBody(bodyBIndex);
         const Mat3& invIA = bodyInvInertiaWorld_[bodyAIndex];
         const Mat3& invIB = bodyInvInertiaWorld_[bodyBIndex];
         const Vec3 manifoldNormal = Normalize(manifold.normal);
@@ -440,7 +541,7 @@ bool World::SolveNormalProjected4(Manifold& manifold, BlockSolveFallbackReason&
         solveInput.face4MinArea = contactSolverConfig_.face4MinArea;
         solveInput.symmetryTolerance = contactSolverConfig_.block4.symmetry_tolerance;
 
-        const std::size_t mIdx = static_cast<std::size_t>(&manifold - manifolds_.data());
+        const std::size_t mIdx = static_cast<std::size_t>(&manifold - manifoldStore_.manifolds.data());
         const ManifoldPrep& mPrep = manifoldPreps_[mIdx];
         for (int i = 0; i < 4; ++i) {
             Contact& c = manifold.contacts[static_cast<std::size_t>(i)];
@@ -456,17 +557,17 @@ bool World::SolveNormalProjected4(Manifold& manifold, BlockSolveFallbackReason&
             const Vec3 vb = b.velocity + Cross(b.angularVelocity, rb);
             const Real vn = Dot(vb - va, normal);
             const Real speedIntoContact = -vn;
-            const Real restitution = ComputeRestitution(speedIntoContact, a.restitution, b.restitution);
+            const Real restitution = ComputeRestitution(speedIntoContact, a.body.restitution, b.body.restitution);
             Real biasTerm = 0.0;
-            const Real penetrationError = std::max(c.penetration - contactSolverConfig_.penetrationSlop, 0.0);
+            const Real penetrationError = std::max<Real>(c.penetration - contactSolverConfig_.penetrationSlop, 0.0);
             if (currentSubstepDt_ > kEpsilon && !contactSolverConfig_.useSplitImpulse && !solverRelaxationPassActive_) {
                 const Real maxSafeSeparatingSpeed = penetrationError / currentSubstepDt_;
                 if (vn <= maxSafeSeparatingSpeed) {
-                    const Real massRatioBoost = ComputeHighMassRatioBoost(a, b);
+                    const Real massRatioBoost = ComputeHighMassRatioBoost(a.body, b.body);
                     const Real boostedBias = contactSolverConfig_.penetrationBiasFactor
                         * (1.0 + contactSolverConfig_.highMassRatioBiasBoost * (massRatioBoost - 1.0));
                     biasTerm = (boostedBias * penetrationError) / currentSubstepDt_;
-                    biasTerm = std::min(biasTerm, std::max(contactSolverConfig_.penetrationBiasMaxSpeed, 0.0));
+                    biasTerm = std::min(biasTerm, std::max<Real>(contactSolverConfig_.penetrationBiasMaxSpeed, 0.0));
                 }
             }
             solveInput.contacts[static_cast<std::size_t>(i)] = {
@@ -474,8 +575,8 @@ bool World::SolveNormalProjected4(Manifold& manifold, BlockSolveFallbackReason&
                 normal,
                 ra,
                 rb,
-                std::max(c.normalImpulseSum, 0.0),
-                -(1.0 + restitution) * vn + std::max(biasTerm, 0.0),
+                std::max<Real>(c.normalImpulseSum, 0.0),
+                -(Real(1) + restitution) * vn + std::max<Real>(biasTerm, 0.0),
             };
         }
 
@@ -506,8 +607,8 @@ bool World::SolveNormalProjected4(Manifold& manifold, BlockSolveFallbackReason&
     }
 
 void World::SolveDistanceJoint(DistanceJoint& j) {
-        Body& a = bodies_[j.a];
-        Body& b = bodies_[j.b];
+        const core_internal::SolverBodyRef a = SolverBody(j.a);
+        const core_internal::SolverBodyRef b = SolverBody(j.b);
         const Mat3& invIA = bodyInvInertiaWorld_[j.a];
         const Mat3& invIB = bodyInvInertiaWorld_[j.b];
 
@@ -548,8 +649,8 @@ void World::SolveDistanceJoint(DistanceJoint& j) {
     }
 
 bool World::SolveHingeAnchorBlock3x3(
-        Body& a,
-        Body& b,
+        const core_internal::SolverBodyRef& a,
+        const core_internal::SolverBodyRef& b,
         const Mat3& invIA,
         const Mat3& invIB,
         const Vec3& ra,
@@ -669,8 +770,8 @@ void World::SolveHingeJoint(HingeJoint& j) {
         const std::size_t idx = static_cast<std::size_t>(&j - hingeJoints_.data());
         const HingeJointPrep& prep = hingeJointPreps_[idx];
 
-        Body& a = bodies_[j.a];
-        Body& b = bodies_[j.b];
+        const core_internal::SolverBodyRef a = SolverBody(j.a);
+        const core_internal::SolverBodyRef b = SolverBody(j.b);
         const Mat3& invIA = bodyInvInertiaWorld_[j.a];
         const Mat3& invIB = bodyInvInertiaWorld_[j.b];
 
@@ -687,7 +788,7 @@ void World::SolveHingeJoint(HingeJoint& j) {
                 j.impulseZ += lambda.z;
                 ApplyImpulse(a, b, invIA, invIB, prep.ra, prep.rb, lambda);
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                ++solverTelemetry_.jointBlockSolveUsed;
+                ++ActiveSolverTelemetry().jointBlockSolveUsed;
 #endif
             }
         } else {
@@ -759,16 +860,16 @@ void World::SolveHingeJoint(HingeJoint& j) {
         if (j.motorEnabled) {
             const Vec3 relAngVel = b.angularVelocity - a.angularVelocity;
             Real lambda = -(Dot(relAngVel, prep.axisA) - j.motorSpeed) * prep.invEffMassHinge;
-            const Real oldImpulse = j.motorImpulseSum;
-            j.motorImpulseSum = std::clamp(j.motorImpulseSum + lambda, -j.maxMotorTorque, j.maxMotorTorque);
+            const SolverReal oldImpulse = j.motorImpulseSum;
+            j.motorImpulseSum = std::clamp<SolverReal>(j.motorImpulseSum + lambda, -j.maxMotorTorque, j.maxMotorTorque);
             lambda = j.motorImpulseSum - oldImpulse;
             ApplyAngularImpulse(a, b, invIA, invIB, lambda * prep.axisA);
         }
     }
 
 void World::SolveBallSocketJoint(BallSocketJoint& j) {
-        Body& a = bodies_[j.a];
-        Body& b = bodies_[j.b];
+        const core_internal::SolverBodyRef a = SolverBody(j.a);
+        const core_internal::SolverBodyRef b = SolverBody(j.b);
         const Mat3& invIA = bodyInvInertiaWorld_[j.a];
         const Mat3& invIB = bodyInvInertiaWorld_[j.b];
 
@@ -816,8 +917,8 @@ void World::SolveBallSocketJoint(BallSocketJoint& j) {
     }
 
 void World::SolveFixedJoint(FixedJoint& j) {
-        Body& a = bodies_[j.a];
-        Body& b = bodies_[j.b];
+        const core_internal::SolverBodyRef a = SolverBody(j.a);
+        const core_internal::SolverBodyRef b = SolverBody(j.b);
         const Mat3& invIA = bodyInvInertiaWorld_[j.a];
         const Mat3& invIB = bodyInvInertiaWorld_[j.b];
 
@@ -862,8 +963,8 @@ void World::SolveFixedJoint(FixedJoint& j) {
     }
 
 void World::SolvePrismaticJoint(PrismaticJoint& j) {
-        Body& a = bodies_[j.a];
-        Body& b = bodies_[j.b];
+        const core_internal::SolverBodyRef a = SolverBody(j.a);
+        const core_internal::SolverBodyRef b = SolverBody(j.b);
         const Mat3& invIA = bodyInvInertiaWorld_[j.a];
         const Mat3& invIB = bodyInvInertiaWorld_[j.b];
 
@@ -938,8 +1039,8 @@ void World::SolvePrismaticJoint(PrismaticJoint& j) {
                 + Dot(rbCrossAxis, invIB * rbCrossAxis);
             if (effMass > kEpsilon) {
                 Real lambda = -(Dot(relVel, axis) - j.motorSpeed) / effMass;
-                const Real oldImpulse = j.motorImpulseSum;
-                j.motorImpulseSum = std::clamp(j.motorImpulseSum + lambda, -j.maxMotorForce, j.maxMotorForce);
+                const SolverReal oldImpulse = j.motorImpulseSum;
+                j.motorImpulseSum = std::clamp<SolverReal>(j.motorImpulseSum + lambda, -j.maxMotorForce, j.maxMotorForce);
                 lambda = j.motorImpulseSum - oldImpulse;
                 ApplyImpulse(a, b, invIA, invIB, ra, rb, lambda * axis);
             }
@@ -947,12 +1048,12 @@ void World::SolvePrismaticJoint(PrismaticJoint& j) {
     }
 
 void World::PrepareContactSolves() {
-        const std::size_t numManifolds = manifolds_.size();
+        const std::size_t numManifolds = manifoldStore_.manifolds.size();
         if (manifoldPreps_.size() < numManifolds) {
             manifoldPreps_.resize(numManifolds);
         }
         for (std::size_t mi = 0; mi < numManifolds; ++mi) {
-            const Manifold& m = manifolds_[mi];
+            const Manifold& m = manifoldStore_.manifolds[mi];
             ManifoldPrep& prep = manifoldPreps_[mi];
             const std::size_t numContacts = m.contacts.size();
             if (prep.contacts.size() != numContacts) {
@@ -1036,6 +1137,11 @@ void World::PrepareContactSolves() {
                     }
                 }
                 cp.normalMass = sideA + sideB;
+                cp.hasReducedCompliance =
+                    reducedArtImpulseRouting_ && ComputeReducedContactCompliance(c, cp.reducedCompliance);
+                if (cp.hasReducedCompliance) {
+                    cp.normalMass = Dot(c.normal, cp.reducedCompliance * c.normal);
+                }
                 cp.invNormalMass = (cp.normalMass > kEpsilon) ? (1.0 / cp.normalMass) : 0.0;
             }
         }
@@ -1248,8 +1354,8 @@ void World::PrepareArticulatedInertias() {
     const SpatialVec spatialGravity{Vec3{0.0, 0.0, 0.0}, gravity_};
     const bool       velocityPreCorr = articulationConfig_.enableVelocityPreCorrection;
     const bool       hasSupportContacts = std::any_of(
-        manifolds_.begin(),
-        manifolds_.end(),
+        manifoldStore_.manifolds.begin(),
+        manifoldStore_.manifolds.end(),
         [this](const Manifold& manifold) {
             if (manifold.contacts.empty()) {
                 return false;
@@ -1461,7 +1567,7 @@ void World::PrepareArticulatedInertias() {
     }
 
     std::vector<std::uint8_t> articulationChainHasContacts(articulationChains_.size(), 0u);
-    for (const Manifold& manifold : manifolds_) {
+    for (const Manifold& manifold : manifoldStore_.manifolds) {
         if (manifold.contacts.empty()) {
             continue;
         }
@@ -1782,7 +1888,7 @@ void World::PrepareArticulatedInertias() {
     if (chassisMvp || chassisTree) {
         constexpr Real kChassisMaxDw = 10.0;
         constexpr Real kChassisMaxDv = 8.0;
-        const Real     gain = std::clamp(articulationConfig_.chassisCouplingGain, 0.0, 4.0);
+        const Real     gain = std::clamp<Real>(articulationConfig_.chassisCouplingGain, 0.0, 4.0);
 
         chassisCouplingWrenchSum_.assign(nBodies, SpatialVec{});
         chassisCouplingChainCount_.assign(nBodies, 0u);
@@ -2113,12 +2219,12 @@ void World::PrepareServoJointSolves() {
         // Match the constants used in the original SolveServoJoint axis-alignment block.
         constexpr Real kAxisAlignOmega = 260.0;
         constexpr Real kAxisAlignZeta  = 1.12;
-        const Real axisDenom = std::max(2.0 * kAxisAlignZeta + dt * kAxisAlignOmega, kEpsilon);
+        const Real axisDenom = std::max<Real>(2.0 * kAxisAlignZeta + dt * kAxisAlignOmega, kEpsilon);
         const Real invAxisDenom = 1.0 / axisDenom;
         const Real axisGammaCoeff = invAxisDenom / (dt * kAxisAlignOmega);
         const Real axisBiasCoeff = kAxisAlignOmega * invAxisDenom;
-        const Real resumeScale = std::max(1.0, jointSolverConfig_.servoEarlyOutResumeScale);
-        const Real impulseGuard = std::max(0.0, jointSolverConfig_.servoEarlyOutImpulseGuardFraction);
+        const Real resumeScale = std::max<Real>(1.0, jointSolverConfig_.servoEarlyOutResumeScale);
+        const Real impulseGuard = std::max<Real>(0.0, jointSolverConfig_.servoEarlyOutImpulseGuardFraction);
         const Real wakeErrorSq = kWakeContactPenetrationThreshold * kWakeContactPenetrationThreshold;
         const Real wakeSpeedSq = kWakeJointRelativeSpeedThreshold * kWakeJointRelativeSpeedThreshold;
         const Real anchorErrorEnter = jointSolverConfig_.servoAnchorEarlyOutError;
@@ -2276,13 +2382,11 @@ void World::PrepareServoJointSolves() {
                 // Diagnostic: log when the anchor bias cap fires.
                 // Enable with MINPHYS_DIAG_LOG=1.
                 if (biasCapped) {
-                    static bool s_diag_init = false;
-                    static bool s_diag_enabled = false;
-                    if (!s_diag_init) {
+                    // Function-local static init is thread-safe; several worlds may step at once.
+                    static const bool s_diag_enabled = []() {
                         const char* v = std::getenv("MINPHYS_DIAG_LOG");
-                        s_diag_enabled = v && v[0] != '\0' && v[0] != '0';
-                        s_diag_init = true;
-                    }
+                        return v && v[0] != '\0' && v[0] != '0';
+                    }();
                     if (s_diag_enabled) {
                         std::fprintf(stderr,
                             "[DIAG_BIAS] anchor_err=%.4f capped_to=%.4f\n",
@@ -2385,7 +2489,7 @@ void World::PrepareServoJointSolves() {
                 const Real det2 = K11 * K22 - K12 * K12;
                 // Require strict positivity and well-conditioning; use the per-row fallback
                 // otherwise so we never inject NaN/Inf into the velocity stream.
-                if (det2 > kEpsilon * std::max(K11 * K22, 1.0)) {
+                if (det2 > kEpsilon * std::max<Real>(K11 * K22, 1.0)) {
                     const Real invDet2 = 1.0 / det2;
                     prep.invK2aa = K22 * invDet2;
                     prep.invK2ab = -K12 * invDet2;
@@ -2423,7 +2527,7 @@ void World::PrepareServoJointSolves() {
 
                 const Real omega = j.positionGain;
                 const Real zeta = j.dampingGain;
-                const Real hingeDenom = std::max(2.0 * zeta + dt * omega, kEpsilon);
+                const Real hingeDenom = std::max<Real>(2.0 * zeta + dt * omega, kEpsilon);
                 const Real invHingeDenom = 1.0 / hingeDenom;
                 const Real hingeGamma = wHinge * invHingeDenom / (dt * omega);
                 const Real clampedError = std::clamp(positionError, -j.maxCorrectionAngle, j.maxCorrectionAngle);
@@ -2497,8 +2601,8 @@ void World::SolveServoJoint(ServoJoint& j) {
         const std::size_t idx = static_cast<std::size_t>(&j - servoJoints_.data());
         const ServoJointPrep& prep = servoJointPreps_[idx];
 
-        Body& a = bodies_[j.a];
-        Body& b = bodies_[j.b];
+        const core_internal::SolverBodyRef a = SolverBody(j.a);
+        const core_internal::SolverBodyRef b = SolverBody(j.b);
         const Mat3& invIA = bodyInvInertiaWorld_[j.a];
         const Mat3& invIB = bodyInvInertiaWorld_[j.b];
         const Real dampingFactor = jointSolverConfig_.hingeAnchorDampingFactor;
@@ -2589,9 +2693,9 @@ void World::SolveServoJoint(ServoJoint& j) {
                     const Vec3 relAngVel = b.angularVelocity - a.angularVelocity;
                     const Real omegaAxis = Dot(relAngVel, prep.axisA);
                     Real lambda = -(omegaAxis + prep.servoBiasPos) * prep.invDenomHingePos;
-                    const Real oldImpulse = j.servoImpulseSum;
+                    const SolverReal oldImpulse = j.servoImpulseSum;
                     j.servoImpulseSum =
-                        std::clamp(j.servoImpulseSum + lambda, -j.maxServoTorque, j.maxServoTorque);
+                        std::clamp<SolverReal>(j.servoImpulseSum + lambda, -j.maxServoTorque, j.maxServoTorque);
                     lambda = j.servoImpulseSum - oldImpulse;
                     if (lambda != 0.0) {
                         ApplyAngularImpulse(a, b, invIA, invIB, lambda * prep.axisA);
@@ -2602,9 +2706,9 @@ void World::SolveServoJoint(ServoJoint& j) {
                     const Vec3 relAngVel = b.angularVelocity - a.angularVelocity;
                     const Real omegaAxis = Dot(relAngVel, prep.axisA);
                     Real lambda = -omegaAxis * prep.invDenomHingeDamp;
-                    const Real oldImpulse = j.servoImpulseSum;
+                    const SolverReal oldImpulse = j.servoImpulseSum;
                     j.servoImpulseSum =
-                        std::clamp(j.servoImpulseSum + lambda, -j.maxServoTorque, j.maxServoTorque);
+                        std::clamp<SolverReal>(j.servoImpulseSum + lambda, -j.maxServoTorque, j.maxServoTorque);
                     lambda = j.servoImpulseSum - oldImpulse;
                     if (lambda != 0.0) {
                         ApplyAngularImpulse(a, b, invIA, invIB, lambda * prep.axisA);
@@ -2614,9 +2718,9 @@ void World::SolveServoJoint(ServoJoint& j) {
                 const Vec3 relAngVel = b.angularVelocity - a.angularVelocity;
                 const Real omegaAxis = Dot(relAngVel, prep.axisA);
                 Real servoLambda = -(omegaAxis + prep.servoBias) * prep.invDenomHinge;
-                const Real oldImpulse = j.servoImpulseSum;
+                const SolverReal oldImpulse = j.servoImpulseSum;
                 j.servoImpulseSum =
-                    std::clamp(j.servoImpulseSum + servoLambda, -j.maxServoTorque, j.maxServoTorque);
+                    std::clamp<SolverReal>(j.servoImpulseSum + servoLambda, -j.maxServoTorque, j.maxServoTorque);
                 servoLambda = j.servoImpulseSum - oldImpulse;
                 ApplyAngularImpulse(a, b, invIA, invIB, servoLambda * prep.axisA);
             }
@@ -2626,7 +2730,7 @@ void World::SolveServoJoint(ServoJoint& j) {
                 const Real clampedOmegaAxis = std::clamp(postOmegaAxis, -prep.maxServoSpeed, prep.maxServoSpeed);
                 if (std::abs(clampedOmegaAxis - postOmegaAxis) > 1e-6) {
                     Real speedLambda = (clampedOmegaAxis - postOmegaAxis) * prep.invWHingeForSpeed;
-                    const Real speedImpulse = std::clamp(j.servoImpulseSum + speedLambda, -j.maxServoTorque, j.maxServoTorque);
+                    const SolverReal speedImpulse = std::clamp<SolverReal>(j.servoImpulseSum + speedLambda, -j.maxServoTorque, j.maxServoTorque);
                     speedLambda = speedImpulse - j.servoImpulseSum;
                     j.servoImpulseSum = speedImpulse;
                     ApplyAngularImpulse(a, b, invIA, invIB, speedLambda * prep.axisA);
@@ -2638,72 +2742,15 @@ void World::SolveServoJoint(ServoJoint& j) {
 
 void World::SolveContactsInManifold(Manifold& manifold) {
         core_internal::ContactSolver solver;
-        std::unordered_map<ManifoldKey, std::unordered_set<PersistentPointKey, PersistentPointKeyHash>, ManifoldKeyHash> warmStartUsedKeys;
-        core_internal::ContactSolverContext context{
+        const SolverHooks hooks{*this};
+        const core_internal::ContactSolverContext<SolverHooks> context{
             bodies_,
             contacts_,
-            manifolds_,
-            previousManifolds_,
+            manifoldStore_.manifolds,
+            previousManifoldStore_.manifolds,
             &bodyInvInertiaWorld_,
-            [this, &warmStartUsedKeys](const ManifoldKey& manifoldId, const Contact& contact, Real& normal, std::array<Real, 2>& tangent, std::uint16_t& age) {
-                PersistentPointMatchCandidate match{};
-                std::unordered_set<PersistentPointKey, PersistentPointKeyHash>& usedKeys = warmStartUsedKeys[manifoldId];
-                if (!TryMatchPersistentPoint(persistentPointImpulses_, manifoldId, contact, usedKeys, match)) {
-                    return false;
-                }
-                usedKeys.insert(match.key);
-                normal = match.state.normalImpulseSum;
-                tangent = {match.state.tangentImpulseSum0, match.state.tangentImpulseSum1};
-                age = match.state.persistenceAge;
-                return true;
-            },
-            [this](Manifold& manifold, const Manifold* previous) { ManageManifoldContacts(manifold, previous); },
-            [](Manifold& manifold) { RefreshManifoldBlockCache(manifold); },
-            [this](Manifold& manifold) { SelectBlockSolvePair(manifold); },
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-            [this](const Manifold& manifold) { RecordSelectedPairHistory(manifold); },
-#else
-            [](const Manifold&) {},
-#endif
-            [this](Manifold& m) { SolveManifoldNormalImpulses(m); },
-            [](const Manifold& m, std::uint64_t key) { return FindBlockSlot(m, key); },
-            [this](Body& a, Body& b, const Mat3& invIA, const Mat3& invIB, const Vec3& ra, const Vec3& rb, const Vec3& impulse) {
-                ApplyImpulse(a, b, invIA, invIB, ra, rb, impulse);
-            },
-            [this](bool reusedBasis) {
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                if (reusedBasis) {
-                    ++solverTelemetry_.tangentBasisReused;
-                } else {
-                    ++solverTelemetry_.tangentBasisResets;
-                }
-#else
-                (void)reusedBasis;
-#endif
-            },
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-            [this](FrictionBudgetNormalSupportSource source) {
-                ++solverTelemetry_.manifoldFrictionBudgetSaturated;
-                switch (source) {
-                    case FrictionBudgetNormalSupportSource::SelectedBlockPairOnly:
-                        ++solverTelemetry_.manifoldFrictionBudgetSaturatedSelectedPair;
-                        break;
-                    case FrictionBudgetNormalSupportSource::AllManifoldContacts:
-                        ++solverTelemetry_.manifoldFrictionBudgetSaturatedAllContacts;
-                        break;
-                    case FrictionBudgetNormalSupportSource::BlendedSelectedPairAndManifold:
-                        ++solverTelemetry_.manifoldFrictionBudgetSaturatedBlended;
-                        break;
-                }
-            },
-            [this](bool reprojected) {
-                if (reprojected) {
-                    ++solverTelemetry_.tangentImpulseReprojected;
-                } else {
-                    ++solverTelemetry_.tangentImpulseReset;
-                }
-            },
-#endif
+            &solverBodies_,
+            hooks,
             contactSolverConfig_,
         };
         solver.SolveContactsInManifold(context, manifold);
@@ -2718,7 +2765,8 @@ bool World::ComputeServoPositionUseVelocityBiases() const {
         return servoPositionUseVelocityBiasesCached_;
     }
 
-void World::SolveJointPositions(const std::vector<std::uint8_t>* skipServoHingeSnapMask) {
+void World::SolveJointPositions(const std::vector<std::uint8_t>* skipServoHingeSnapMask,
+                                const std::vector<std::uint8_t>* skipServoJointMask) {
         const auto _scope = resource_profiler_.scope(
             world_resource_monitoring::toIndex(world_resource_monitoring::Section::SolveJointPositionsServo));
         core_internal::JointSolver jointSolver;
@@ -2740,6 +2788,7 @@ void World::SolveJointPositions(const std::vector<std::uint8_t>* skipServoHingeS
             &servoPositionAngularCountScratch_,
             skipServoHingeSnapMask,
             jointSolverConfig_.servoAnchorCorrectionMaxM,
+            skipServoJointMask,
         };
         jointSolver.SolveJointPositions(context);
     }
@@ -2797,7 +2846,7 @@ void World::SolveArticulationChainPositions() {
             if (a.invMass + b.invMass <= kEpsilon) {
                 continue;
             }
-            const Real stab = std::clamp(sj.angleStabilizationScale, 0.0, 1.0);
+            const Real stab = std::clamp<Real>(sj.angleStabilizationScale, 0.0, 1.0);
             if (stab <= 1e-7) {
                 continue;
             }
@@ -2823,9 +2872,9 @@ void World::SolveArticulationChainPositions() {
                 core_internal::ComputeServoJointAngle(a, b, sj);
             const Real targetError =
                 core_internal::WrapJointAngle(hingeAngle - sj.targetAngle);
-            const Real maxServoSpeed = std::max(0.0, sj.maxServoSpeed);
+            const Real maxServoSpeed = std::max<Real>(0.0, sj.maxServoSpeed);
             const Real maxAngleCorrection = maxServoSpeed > 0.0
-                ? std::min(0.06 * stab, maxServoSpeed * subDt)
+                ? std::min<Real>(0.06 * stab, maxServoSpeed * subDt)
                 : 0.06 * stab;
             const Real Dji = chain.D[linkIdx];
             const Real dScale = std::min(1.0, 0.25 / std::max(Dji, kEpsilon));
@@ -2845,7 +2894,9 @@ void World::SolveArticulationPositions() {
         SolveArticulationChainPositions();
         maskPtr = &servoSkipHingeSnapMask_;
     }
-    SolveJointPositions(maskPtr);
+    // Reduced-coordinate tree joints are exact; their links are posed by
+    // `ProjectReducedArticulationPoses` instead.
+    SolveJointPositions(maskPtr, reducedArtJointMask_.empty() ? nullptr : &reducedArtJointMask_);
 }
 
 void World::BeginSplitImpulseSubstep() {
@@ -2857,7 +2908,7 @@ void World::AccumulateSplitImpulseCorrection(std::uint32_t bodyId, const Vec3& l
         if (bodyId >= splitLinearPositionDelta_.size()) {
             return;
         }
-        if (bodies_[bodyId].isSleeping) {
+        if (bodies_[bodyId].isSleeping || bodies_[bodyId].invMass == 0.0) {
             return;
         }
         splitLinearPositionDelta_[bodyId] += linearDelta;
@@ -2886,7 +2937,7 @@ bool World::TryComputeAnchorSeparation(const Contact& c, Real& outPenetration) c
         const Vec3 worldAnchorA = a.position + Rotate(a.orientation, c.localAnchorA);
         const Vec3 worldAnchorB = b.position + Rotate(b.orientation, c.localAnchorB);
         const Real separation = Dot(worldAnchorB - worldAnchorA, c.normal);
-        const Real penetration = std::max(0.0, c.referenceSeparation - separation);
+        const Real penetration = std::max<Real>(0.0, c.referenceSeparation - separation);
         if (!std::isfinite(penetration)) {
             return false;
         }
@@ -2899,84 +2950,115 @@ void World::PrepareIslandOrders() {
     islandOrders_.reserve(islands_.size());
     for (const Island& island : islands_) {
         islandOrders_.push_back(
-            solver_internal::ComputeIslandOrder(island, bodies_, manifolds_, contactSolverConfig_));
+            solver_internal::ComputeIslandOrder(
+                island, bodies_, manifoldStore_.manifolds, contactSolverConfig_));
     }
 }
 
-void World::SolveIslands() {
-        std::unordered_map<ManifoldKey, std::unordered_set<PersistentPointKey, PersistentPointKeyHash>, ManifoldKeyHash> warmStartUsedKeys;
-        core_internal::ContactSolverContext contactContext{
+void World::PrepareIslandColorings() {
+    const GraphColoringConfig& config = contactSolverConfig_.coloring;
+    const bool colorContacts = config.enabled;
+    const bool colorJoints = jointSolverConfig_.useGraphColoring;
+    if (!colorContacts && !colorJoints) {
+        islandColorings_.clear();
+        return;
+    }
+
+    islandColorings_.resize(islands_.size());
+    for (std::size_t i = 0; i < islands_.size(); ++i) {
+        const Island& island = islands_[i];
+        const std::size_t rowCount = (colorContacts ? island.manifolds.size() : 0u)
+            + (colorJoints ? island.hinges.size() + island.servos.size() : 0u);
+        // Rows on a reduced-coordinate tree all write the whole tree, so its island stays serial.
+        const bool reducedTree = !reducedArtTrees_.empty()
+            && std::any_of(island.bodies.begin(), island.bodies.end(), [this](std::uint32_t body) {
+                   return reducedArtBodySlots_[body].tree != ReducedArtBodySlot::kNone;
+               });
+        const bool eligible = rowCount >= config.minIslandRows && i < islandOrders_.size() && !reducedTree;
+        solver_internal::ComputeIslandColoring(island,
+                                               eligible ? islandOrders_[i] : IslandOrderResult{},
+                                               bodies_,
+                                               manifoldStore_.manifolds,
+                                               hingeJoints_,
+                                               servoJoints_,
+                                               eligible && colorContacts,
+                                               eligible && colorJoints,
+                                               config.maxColors,
+                                               islandColorings_[i],
+                                               islandColorMaskScratch_);
+    }
+}
+
+std::uint64_t World::EstimateIslandSolveCost(const Island& island) const {
+    // Weights approximate scalar PGS rows per iteration: a contact point is one normal plus two
+    // friction rows, the 6-DOF joints (servo / hinge / fixed / prismatic) about six, a ball socket
+    // three and a distance joint one. The constant keeps empty islands from looking free.
+    std::uint64_t contactCount = 0;
+    for (std::size_t mi : island.manifolds) {
+        contactCount += manifoldStore_.manifolds[mi].contacts.size();
+    }
+    const std::uint64_t sixRowJointCount =
+        island.servos.size() + island.hinges.size() + island.fixeds.size() + island.prismatics.size();
+    return 1u + 3u * contactCount + 6u * sixRowJointCount + 3u * island.ballSockets.size() + island.joints.size();
+}
+
+void World::PrepareIslandSolveBatches() {
+    for (std::vector<std::size_t>& batch : islandSolveBatches_) {
+        batch.clear();
+    }
+    const std::size_t threadCount = parallelSolveConfig_.threadCount;
+    if (threadCount <= 1 || islands_.size() < 2) {
+        islandSolveBatches_.clear();
+        return;
+    }
+
+    std::vector<std::pair<std::uint64_t, std::size_t>> costs;
+    costs.reserve(islands_.size());
+    std::uint64_t totalCost = 0;
+    for (std::size_t i = 0; i < islands_.size(); ++i) {
+        const std::uint64_t cost = EstimateIslandSolveCost(islands_[i]);
+        costs.emplace_back(cost, i);
+        totalCost += cost;
+    }
+    if (totalCost < parallelSolveConfig_.minParallelIslandCost) {
+        islandSolveBatches_.clear();
+        return;
+    }
+
+    // Longest-processing-time greedy: heaviest island first onto the lightest batch. Ties break on
+    // index so the partition depends only on topology, never on timing.
+    std::sort(costs.begin(), costs.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first != rhs.first ? lhs.first > rhs.first : lhs.second < rhs.second;
+    });
+    const std::size_t batchCount = std::min(threadCount, islands_.size());
+    islandSolveBatches_.resize(batchCount);
+    std::vector<std::uint64_t> batchCost(batchCount, 0);
+    for (const auto& [cost, islandIdx] : costs) {
+        const std::size_t target = static_cast<std::size_t>(
+            std::min_element(batchCost.begin(), batchCost.end()) - batchCost.begin());
+        batchCost[target] += cost;
+        islandSolveBatches_[target].push_back(islandIdx);
+    }
+    for (std::vector<std::size_t>& batch : islandSolveBatches_) {
+        std::sort(batch.begin(), batch.end());
+    }
+}
+
+void World::SolveVelocityIterations(int solverIterations) {
+        const SolverHooks hooks{*this};
+        const core_internal::ContactSolverContext<SolverHooks> contactContext{
             bodies_,
             contacts_,
-            manifolds_,
-            previousManifolds_,
+            manifoldStore_.manifolds,
+            previousManifoldStore_.manifolds,
             &bodyInvInertiaWorld_,
-            [this, &warmStartUsedKeys](const ManifoldKey& manifoldId, const Contact& contact, Real& normal, std::array<Real, 2>& tangent, std::uint16_t& age) {
-                PersistentPointMatchCandidate match{};
-                std::unordered_set<PersistentPointKey, PersistentPointKeyHash>& usedKeys = warmStartUsedKeys[manifoldId];
-                if (!TryMatchPersistentPoint(persistentPointImpulses_, manifoldId, contact, usedKeys, match)) {
-                    return false;
-                }
-                usedKeys.insert(match.key);
-                normal = match.state.normalImpulseSum;
-                tangent = {match.state.tangentImpulseSum0, match.state.tangentImpulseSum1};
-                age = match.state.persistenceAge;
-                return true;
-            },
-            [this](Manifold& manifold, const Manifold* previous) { ManageManifoldContacts(manifold, previous); },
-            [](Manifold& manifold) { RefreshManifoldBlockCache(manifold); },
-            [this](Manifold& manifold) { SelectBlockSolvePair(manifold); },
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-            [this](const Manifold& manifold) { RecordSelectedPairHistory(manifold); },
-#else
-            [](const Manifold&) {},
-#endif
-            [this](Manifold& manifold) { SolveManifoldNormalImpulses(manifold); },
-            [](const Manifold& manifold, std::uint64_t contactKey) { return FindBlockSlot(manifold, contactKey); },
-            [this](Body& a, Body& b, const Mat3& invIA, const Mat3& invIB, const Vec3& ra, const Vec3& rb, const Vec3& impulse) {
-                ApplyImpulse(a, b, invIA, invIB, ra, rb, impulse);
-            },
-            [this](bool reusedBasis) {
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                if (reusedBasis) {
-                    ++solverTelemetry_.tangentBasisReused;
-                } else {
-                    ++solverTelemetry_.tangentBasisResets;
-                }
-#else
-                (void)reusedBasis;
-#endif
-            },
-#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-            [this](FrictionBudgetNormalSupportSource source) {
-                ++solverTelemetry_.manifoldFrictionBudgetSaturated;
-                switch (source) {
-                    case FrictionBudgetNormalSupportSource::SelectedBlockPairOnly:
-                        ++solverTelemetry_.manifoldFrictionBudgetSaturatedSelectedPair;
-                        break;
-                    case FrictionBudgetNormalSupportSource::AllManifoldContacts:
-                        ++solverTelemetry_.manifoldFrictionBudgetSaturatedAllContacts;
-                        break;
-                    case FrictionBudgetNormalSupportSource::BlendedSelectedPairAndManifold:
-                        ++solverTelemetry_.manifoldFrictionBudgetSaturatedBlended;
-                        break;
-                }
-            },
-            [this](bool reprojected) {
-                if (reprojected) {
-                    ++solverTelemetry_.tangentImpulseReprojected;
-                } else {
-                    ++solverTelemetry_.tangentImpulseReset;
-                }
-            },
-#endif
+            &solverBodies_,
+            hooks,
             contactSolverConfig_,
         };
-
-        const core_internal::ConstraintSolver constraintSolver;
-        const core_internal::ConstraintSolverContext context{
+        const SolverContext context{
             bodies_,
-            manifolds_,
+            manifoldStore_.manifolds,
             islands_,
             joints_,
             hingeJoints_,
@@ -2986,30 +3068,273 @@ void World::SolveIslands() {
             servoJoints_,
             contactContext,
             contactSolverConfig_,
+            hooks,
             islandOrders_.empty() ? nullptr : &islandOrders_,
+            nullptr,
+            nullptr,
+            islandColorings_.empty() ? nullptr : &islandColorings_,
+            nullptr,
+            1u,
+            contactSolverConfig_.coloring.minRowsPerThread,
+        };
+
+        solverRelaxationPassActive_ = false;
+        const SolverConvergenceConfig& convergence = contactSolverConfig_.convergence;
+        const int iterationCap = std::max(
+            0, convergence.enabled && convergence.maxIterations > 0 ? static_cast<int>(convergence.maxIterations)
+                                                                    : solverIterations);
+        int iterations = 0;
+        {
+            const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::SolveIslands));
+            if (!convergence.enabled) {
+                for (; iterations < iterationCap; ++iterations) {
+                    SolveIslands(context);
+                }
+                solverIterationStats_.lastStepIslandIterations +=
+                    static_cast<std::uint64_t>(iterationCap) * islands_.size();
+            } else {
+                BeginSolverConvergence();
+                const bool batchIslands = islandSolveBatches_.size() > 1;
+                std::size_t activeIslands = solverConvergence_.activeIslands.size();
+                while (iterations < iterationCap && activeIslands > 0) {
+                    SolveIslands(context,
+                                 &solverConvergence_.activeIslands,
+                                 batchIslands ? &solverConvergence_.activeBatches : nullptr);
+                    solverIterationStats_.lastStepIslandIterations += activeIslands;
+                    ++iterations;
+                    activeIslands = UpdateSolverConvergence(iterations);
+                }
+                solverIterationStats_.lastStepIslandsConverged +=
+                    static_cast<std::uint32_t>(islands_.size() - activeIslands);
+                for (std::size_t islandIdx = 0; islandIdx < islands_.size(); ++islandIdx) {
+                    solverIterationStats_.lastStepMaxLinearImpulseDelta = std::max(
+                        solverIterationStats_.lastStepMaxLinearImpulseDelta, solverConvergence_.islandLinearDelta[islandIdx]);
+                    solverIterationStats_.lastStepMaxAngularImpulseDelta = std::max(
+                        solverIterationStats_.lastStepMaxAngularImpulseDelta, solverConvergence_.islandAngularDelta[islandIdx]);
+                }
+            }
+            (void)scope;
+        }
+        solverIterationStats_.lastStepIterations += static_cast<std::uint32_t>(iterations);
+        solverIterationStats_.lastStepMaxSubstepIterations =
+            std::max(solverIterationStats_.lastStepMaxSubstepIterations, static_cast<std::uint32_t>(iterations));
+        solverIterationStats_.lastStepIslandIterationCap += static_cast<std::uint64_t>(iterationCap) * islands_.size();
+        solverIterationStats_.totalIterations += static_cast<std::uint64_t>(iterations);
+        if (contactSolverConfig_.enableRelaxationPass && contactSolverConfig_.relaxationIterations > 0) {
+            solverRelaxationPassActive_ = true;
+            {
+                const auto scope = resource_profiler_.scope(world_resource_monitoring::toIndex(world_resource_monitoring::Section::RelaxationPass));
+                for (std::uint8_t i = 0; i < contactSolverConfig_.relaxationIterations; ++i) {
+                    SolveIslands(context);
+                }
+                (void)scope;
+            }
+            solverRelaxationPassActive_ = false;
+        }
+    }
+
+void World::SolveIslands(const SolverContext& context,
+                         const std::vector<std::size_t>* islandIndices,
+                         const std::vector<std::vector<std::size_t>>* islandBatches) {
+        core_internal::WorkerPool* pool = solverWorkerPool_.Acquire(parallelSolveConfig_.threadCount);
+        const std::vector<std::vector<std::size_t>>& batches =
+            islandBatches != nullptr ? *islandBatches : islandSolveBatches_;
+        const bool batchIslands = pool != nullptr && batches.size() > 1;
+        const bool parallelColors = pool != nullptr && !batchIslands && !islandColorings_.empty();
+        if (!batchIslands && !parallelColors) {
+            SolveIslandSet(context, islandIndices, true, nullptr);
+            return;
+        }
+
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+        parallelSolveTelemetry_.assign(batchIslands ? batches.size() : pool->ThreadCount(), SolverTelemetry{});
+#endif
+        if (batchIslands) {
+            // Batches own disjoint dynamic bodies, so each one can run the serial kernels unchanged.
+            // Nested profiler sections stay on the serial path (they would interleave across
+            // threads); coloured islands inside a batch sweep their colours inline.
+            pool->ParallelFor(batches.size(), [this, &context, &batches](std::size_t batchIdx) {
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+                threadSolverTelemetry_ = &parallelSolveTelemetry_[batchIdx];
+#endif
+                SolveIslandSet(context, &batches[batchIdx], false, nullptr);
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+                threadSolverTelemetry_ = nullptr;
+#endif
+            });
+        } else {
+            SolveIslandSet(context, islandIndices, true, pool);
+        }
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-            &solverTelemetry_,
+        for (const SolverTelemetry& taskTelemetry : parallelSolveTelemetry_) {
+            MergeSolverTelemetry(solverTelemetry_, taskTelemetry);
+        }
 #endif
-            [](core_internal::ContactSolver& solver, const core_internal::ContactSolverContext& context, Manifold& manifold) {
-                solver.SolveContactsInManifold(context, manifold);
-            },
-            [this](DistanceJoint& joint) { SolveDistanceJoint(joint); },
-            [this](HingeJoint& joint) { SolveHingeJoint(joint); },
-            [this](BallSocketJoint& joint) { SolveBallSocketJoint(joint); },
-            [this](FixedJoint& joint) { SolveFixedJoint(joint); },
-            [this](PrismaticJoint& joint) { SolvePrismaticJoint(joint); },
-            [this](ServoJoint& joint) { SolveServoJoint(joint); },
-            &resource_profiler_,
+    }
+
+void World::BeginSolverConvergence() {
+        core_internal::SolverConvergenceScratch& scratch = solverConvergence_;
+        const SolverConvergenceConfig& config = contactSolverConfig_.convergence;
+        const std::size_t bodyCount = bodies_.size();
+        scratch.velocity.resize(bodyCount);
+        scratch.angularVelocity.resize(bodyCount);
+        scratch.inertiaWorld.resize(bodyCount);
+        scratch.islandActive.assign(islands_.size(), 1u);
+        scratch.islandPinned.assign(islands_.size(), 0u);
+        scratch.islandLinearDelta.assign(islands_.size(), 0.0);
+        scratch.islandAngularDelta.assign(islands_.size(), 0.0);
+        scratch.activeIslands.clear();
+        for (std::size_t islandIdx = 0; islandIdx < islands_.size(); ++islandIdx) {
+            scratch.activeIslands.push_back(islandIdx);
+            const Real jointError = MaxIslandJointPositionError(islands_[islandIdx]);
+            solverIterationStats_.lastStepMaxJointPositionError =
+                std::max(solverIterationStats_.lastStepMaxJointPositionError, jointError);
+            if (jointError > config.jointPositionTolerance) {
+                // Never retires, so its residual is never measured.
+                scratch.islandPinned[islandIdx] = 1u;
+                continue;
+            }
+            for (const std::uint32_t id : islands_[islandIdx].bodies) {
+                if (!InvertMat3(bodyInvInertiaWorld_[id], scratch.inertiaWorld[id])) {
+                    scratch.inertiaWorld[id] = Mat3{};
+                }
+            }
+        }
+        // Per-batch assign keeps each batch's capacity from earlier substeps.
+        scratch.activeBatches.resize(islandSolveBatches_.size());
+        for (std::size_t batchIdx = 0; batchIdx < islandSolveBatches_.size(); ++batchIdx) {
+            scratch.activeBatches[batchIdx].assign(islandSolveBatches_[batchIdx].begin(),
+                                                   islandSolveBatches_[batchIdx].end());
+        }
+        UpdateSolverConvergence(0);
+    }
+
+std::size_t World::UpdateSolverConvergence(int completedIterations) {
+        core_internal::SolverConvergenceScratch& scratch = solverConvergence_;
+        const SolverConvergenceConfig& config = contactSolverConfig_.convergence;
+        const int minIterations = static_cast<int>(config.minIterations);
+        // Residuals are only needed from the first pass an island may retire after; the
+        // velocities are snapshotted one pass earlier.
+        if (completedIterations + 1 < minIterations) {
+            return scratch.activeIslands.size();
+        }
+        const bool measure = completedIterations >= minIterations;
+        const Real linearToleranceSq = config.linearImpulseTolerance * config.linearImpulseTolerance;
+        const Real angularToleranceSq = config.angularImpulseTolerance * config.angularImpulseTolerance;
+        std::size_t kept = 0;
+        bool retired = false;
+        for (const std::size_t islandIdx : scratch.activeIslands) {
+            if (scratch.islandPinned[islandIdx] != 0u) {
+                scratch.activeIslands[kept++] = islandIdx;
+                continue;
+            }
+            Real linearDeltaSq = 0.0;
+            Real angularDeltaSq = 0.0;
+            for (const std::uint32_t id : islands_[islandIdx].bodies) {
+                const core_internal::SolverBodyRef body = solverBodies_.Ref(bodies_, id);
+                if (measure && body.invMass > 0.0) {
+                    const Vec3 linearImpulse = (body.velocity - scratch.velocity[id]) / body.invMass;
+                    const Vec3 angularImpulse =
+                        scratch.inertiaWorld[id] * (body.angularVelocity - scratch.angularVelocity[id]);
+                    linearDeltaSq = std::max(linearDeltaSq, LengthSquared(linearImpulse));
+                    angularDeltaSq = std::max(angularDeltaSq, LengthSquared(angularImpulse));
+                }
+                scratch.velocity[id] = body.velocity;
+                scratch.angularVelocity[id] = body.angularVelocity;
+            }
+            if (!measure) {
+                scratch.activeIslands[kept++] = islandIdx;
+                continue;
+            }
+            scratch.islandLinearDelta[islandIdx] = std::sqrt(linearDeltaSq);
+            scratch.islandAngularDelta[islandIdx] = std::sqrt(angularDeltaSq);
+            if (linearDeltaSq <= linearToleranceSq && angularDeltaSq <= angularToleranceSq) {
+                scratch.islandActive[islandIdx] = 0u;
+                retired = true;
+            } else {
+                scratch.activeIslands[kept++] = islandIdx;
+            }
+        }
+        scratch.activeIslands.resize(kept);
+        if (retired) {
+            for (std::vector<std::size_t>& batch : scratch.activeBatches) {
+                batch.erase(std::remove_if(batch.begin(), batch.end(),
+                                           [&scratch](std::size_t islandIdx) {
+                                               return scratch.islandActive[islandIdx] == 0u;
+                                           }),
+                            batch.end());
+            }
+        }
+        return kept;
+    }
+
+Real World::MaxIslandJointPositionError(const Island& island) const {
+        const auto anchorGap = [this](std::uint32_t a, std::uint32_t b, const Vec3& localAnchorA, const Vec3& localAnchorB) {
+            const Body& bodyA = bodies_[a];
+            const Body& bodyB = bodies_[b];
+            return Length((bodyB.position + Rotate(bodyB.orientation, localAnchorB))
+                          - (bodyA.position + Rotate(bodyA.orientation, localAnchorA)));
         };
+        Real maxError = 0.0;
+        for (const std::size_t idx : island.joints) {
+            const DistanceJoint& j = joints_[idx];
+            const Real gap = anchorGap(j.a, j.b, j.localAnchorA, j.localAnchorB);
+            maxError = std::max(maxError, std::abs(gap - j.restLength));
+        }
+        for (const std::size_t idx : island.hinges) {
+            const HingeJoint& j = hingeJoints_[idx];
+            maxError = std::max(maxError, anchorGap(j.a, j.b, j.localAnchorA, j.localAnchorB));
+        }
+        for (const std::size_t idx : island.ballSockets) {
+            const BallSocketJoint& j = ballSocketJoints_[idx];
+            maxError = std::max(maxError, anchorGap(j.a, j.b, j.localAnchorA, j.localAnchorB));
+        }
+        for (const std::size_t idx : island.fixeds) {
+            const FixedJoint& j = fixedJoints_[idx];
+            maxError = std::max(maxError, anchorGap(j.a, j.b, j.localAnchorA, j.localAnchorB));
+        }
+        for (const std::size_t idx : island.prismatics) {
+            // Travel along the slide axis is the joint's free coordinate: only the offset across
+            // the axis and any overshoot of the translation limits count as error.
+            const PrismaticJoint& j = prismaticJoints_[idx];
+            const Body& bodyA = bodies_[j.a];
+            const Body& bodyB = bodies_[j.b];
+            const Vec3 offset = (bodyB.position + Rotate(bodyB.orientation, j.localAnchorB))
+                - (bodyA.position + Rotate(bodyA.orientation, j.localAnchorA));
+            const Vec3 axis = Normalize(Rotate(bodyA.orientation, j.localAxisA));
+            const Real translation = Dot(offset, axis);
+            maxError = std::max(maxError, Length(offset - translation * axis));
+            if (j.limitsEnabled) {
+                maxError = std::max(maxError, j.lowerTranslation - translation);
+                maxError = std::max(maxError, translation - j.upperTranslation);
+            }
+        }
+        for (const std::size_t idx : island.servos) {
+            const ServoJoint& j = servoJoints_[idx];
+            maxError = std::max(maxError, anchorGap(j.a, j.b, j.localAnchorA, j.localAnchorB));
+        }
+        return maxError;
+    }
+
+void World::SolveIslandSet(const SolverContext& context,
+                           const std::vector<std::size_t>* islandIndices,
+                           bool recordNestedSections,
+                           core_internal::WorkerPool* colorPool) {
+        SolverContext setContext = context;
+        setContext.worldResourceProfiler = recordNestedSections ? &resource_profiler_ : nullptr;
+        setContext.islandIndices = islandIndices;
+        setContext.colorPool = colorPool;
+        setContext.parallelThreadCount = colorPool != nullptr ? colorPool->ThreadCount() : 1u;
 
-        constraintSolver.SolveIslands(context);
+        const core_internal::ConstraintSolver constraintSolver;
+        constraintSolver.SolveIslands(setContext);
     }
 
 void World::UpdateSleeping() {
         const core_internal::SleepSystem sleepSystem;
         const core_internal::SleepSystemContext context{
             bodies_,
-            manifolds_,
+            manifoldStore_.manifolds,
             joints_,
             hingeJoints_,
             ballSocketJoints_,
@@ -1,10 +1,12 @@
 #include "demo/matrix_lidar_sim.hpp"
 
 #include "matrix_lidar_geometry.hpp"
+#include "minphys3d/collision/ray_packet.hpp"
 #include "minphys3d/core/body.hpp"
 #include "minphys3d/math/vec3.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <limits>
@@ -16,6 +18,14 @@ constexpr Real kMinRangeM = static_cast<float>(matrix_lidar_geom::kMinRangeMatri
 constexpr Real kMaxRangeM = static_cast<float>(matrix_lidar_geom::kMaxRangeMatrix64x8Mm) / 1000.0;
 constexpr int kMmResolution = 14;
 
+constexpr int kCols = 64;
+constexpr int kRows = 8;
+// Packet tiles are 8 columns × all 8 rows: neighbouring beams of a tile diverge by at most a few
+// degrees, so they mostly enter the same BVH nodes.
+constexpr int kTileCols = 8;
+constexpr int kTileCount = kCols / kTileCols;
+static_assert(kTileCols * kRows <= static_cast<int>(kRayPacketMaxRays), "a tile must fit one ray packet");
+
 // Build a bitset (1 byte per body) marking the bodies that LiDAR rays must skip.
 // Includes robot links (everything in scene.body_ids except the ground plane,
 // which is a valid LiDAR target) and the terrain heightfield attachment (the
@@ -59,131 +69,253 @@ bool RayPlaneHit(const Vec3& o,
     return true;
 }
 
-bool RaySphereHit(const Vec3& o, const Vec3& d, const Vec3& center, Real radius, Real& t_out) {
+// The solid primitives below are intersected as the interval [t_min, t_max] of the ray that lies
+// inside them. The reported hit is the entry point, or the exit point when the origin is inside.
+bool PickIntervalHit(Real t_min, Real t_max, Real& t_out) {
+    Real t_hit = t_min;
+    if (t_hit <= 1.0e-4) {
+        t_hit = t_max;
+    }
+    if (!std::isfinite(t_hit) || t_hit <= 1.0e-4) {
+        return false;
+    }
+    t_out = t_hit;
+    return true;
+}
+
+// Clips [in_min, in_max] to the part of the ray with lo <= origin + t * dir <= hi on one axis.
+bool ClipSlab(Real origin, Real dir, Real lo, Real hi, Real& in_min, Real& in_max) {
+    if (std::abs(dir) < 1.0e-8) {
+        return origin >= lo && origin <= hi;
+    }
+    Real t1 = (lo - origin) / dir;
+    Real t2 = (hi - origin) / dir;
+    if (t1 > t2) {
+        std::swap(t1, t2);
+    }
+    in_min = std::max(in_min, t1);
+    in_max = std::min(in_max, t2);
+    return in_min <= in_max;
+}
+
+bool RaySphereInterval(const Vec3& o, const Vec3& d, const Vec3& center, Real radius, Real& t_min, Real& t_max) {
     if (radius <= 1.0e-6) {
         return false;
     }
     const Vec3 oc = o - center;
+    const Real a = Dot(d, d);
     const Real b = Dot(oc, d);
     const Real c = Dot(oc, oc) - radius * radius;
-    const Real disc = b * b - c;
-    if (disc < 0.0) {
+    const Real disc = b * b - a * c;
+    if (disc < 0.0 || a <= 1.0e-12) {
         return false;
     }
     const Real s = std::sqrt(disc);
-    Real t = -b - s;
-    if (t <= 1.0e-4) {
-        t = -b + s;
+    t_min = (-b - s) / a;
+    t_max = (-b + s) / a;
+    return true;
+}
+
+// Infinite solid cylinder x² + z² <= r² about the local y axis.
+bool RayInfiniteCylinderInterval(const Vec3& o_l, const Vec3& d_l, Real radius, Real& t_min, Real& t_max) {
+    if (radius <= 1.0e-6) {
+        return false;
     }
-    if (!std::isfinite(t) || t <= 1.0e-4) {
+    const Real a = d_l.x * d_l.x + d_l.z * d_l.z;
+    const Real b = o_l.x * d_l.x + o_l.z * d_l.z;
+    const Real c = o_l.x * o_l.x + o_l.z * o_l.z - radius * radius;
+    if (a <= 1.0e-12) {
+        // Parallel to the axis: inside for the whole ray or not at all.
+        if (c > 0.0) {
+            return false;
+        }
+        t_min = -std::numeric_limits<Real>::infinity();
+        t_max = std::numeric_limits<Real>::infinity();
+        return true;
+    }
+    const Real disc = b * b - a * c;
+    if (disc < 0.0) {
         return false;
     }
-    t_out = t;
+    const Real s = std::sqrt(disc);
+    t_min = (-b - s) / a;
+    t_max = (-b + s) / a;
     return true;
 }
 
-bool RayObbHit(const Vec3& o,
-               const Vec3& d,
-               const Vec3& center,
-               const Quat& orientation,
-               const Vec3& half_extents,
-               Real& t_out) {
-    const Quat q_inv = Conjugate(Normalize(orientation));
-    const Vec3 o_l = Rotate(q_inv, o - center);
-    const Vec3 d_l = Rotate(q_inv, d);
-
-    Real t_min = -std::numeric_limits<float>::infinity();
-    Real t_max = std::numeric_limits<float>::infinity();
+// One convex primitive resolved for a scan: world pose, plus the sensor origin already moved into
+// its local frame so each beam only rotates its direction. A compound body yields one target per
+// supported child.
+struct LidarTarget {
+    ShapeType shape = ShapeType::Box;
+    Vec3 center{};
+    Quat inverse_orientation{};
+    Vec3 origin_local{};
+    Vec3 plane_normal{};
+    Vec3 half_extents{};
+    Real radius = 0.0;
+    Real half_height = 0.0;
+};
+
+LidarTarget MakeLidarTarget(ShapeType shape,
+                            const Vec3& center,
+                            const Quat& orientation,
+                            Real radius,
+                            Real half_height,
+                            const Vec3& half_extents,
+                            const Vec3& origin) {
+    LidarTarget target{};
+    target.shape = shape;
+    target.center = center;
+    target.inverse_orientation = Conjugate(Normalize(orientation));
+    target.origin_local = Rotate(target.inverse_orientation, origin - center);
+    target.half_extents = half_extents;
+    target.radius = radius;
+    target.half_height = half_height;
+    return target;
+}
 
-    const Real ox = o_l.x;
-    const Real oy = o_l.y;
-    const Real oz = o_l.z;
-    const Real dx = d_l.x;
-    const Real dy = d_l.y;
-    const Real dz = d_l.z;
-    const Real hx = half_extents.x;
-    const Real hy = half_extents.y;
-    const Real hz = half_extents.z;
-
-    auto slab = [&](Real origin, Real dir, Real he, Real& in_min, Real& in_max) -> bool {
-        if (std::abs(dir) < 1.0e-8) {
-            if (origin < -he || origin > he) {
-                return false;
+// Calls `fn(target)` for every primitive of `b`. Centres follow `Body::ComputeAABB`, so a beam's
+// exact hit always lies inside the fat-AABB that produced the candidate.
+template <typename Fn>
+void ForEachLidarTarget(const Body& b, const Vec3& origin, Fn&& fn) {
+    switch (b.shape) {
+        case ShapeType::Plane: {
+            LidarTarget target{};
+            target.shape = ShapeType::Plane;
+            target.center = b.position;
+            if (TryNormalize(b.planeNormal, target.plane_normal)) {
+                fn(target);
             }
-            return true;
+            return;
         }
-        Real t1 = (-he - origin) / dir;
-        Real t2 = (he - origin) / dir;
-        if (t1 > t2) {
-            std::swap(t1, t2);
+        case ShapeType::Sphere: {
+            LidarTarget target{};
+            target.shape = ShapeType::Sphere;
+            target.center = b.position;
+            target.radius = b.radius;
+            fn(target);
+            return;
         }
-        in_min = std::max(in_min, t1);
-        in_max = std::min(in_max, t2);
-        return in_min <= in_max;
-    };
-
-    if (!slab(ox, dx, hx, t_min, t_max)) {
-        return false;
-    }
-    if (!slab(oy, dy, hy, t_min, t_max)) {
-        return false;
-    }
-    if (!slab(oz, dz, hz, t_min, t_max)) {
-        return false;
+        case ShapeType::Box:
+            fn(MakeLidarTarget(ShapeType::Box, BodyWorldShapeOrigin(b), b.orientation, 0.0, 0.0, b.halfExtents, origin));
+            return;
+        case ShapeType::Capsule:
+        case ShapeType::Cylinder:
+            fn(MakeLidarTarget(b.shape, b.position, b.orientation, b.radius, b.halfHeight, {}, origin));
+            return;
+        case ShapeType::HalfCylinder:
+            fn(MakeLidarTarget(
+                ShapeType::HalfCylinder, BodyWorldShapeOrigin(b), b.orientation, b.radius, b.halfHeight, {}, origin));
+            return;
+        case ShapeType::Compound:
+            break;
     }
 
-    Real t_hit = t_min;
-    if (t_hit <= 1.0e-4) {
-        t_hit = t_max;
+    bool any_child = false;
+    for (const CompoundChild& child : b.compoundChildren) {
+        if (!IsCompoundChildShapeSupported(child.shape)) {
+            continue;
+        }
+        any_child = true;
+        const Vec3 child_position = b.position + Rotate(b.orientation, child.localPosition);
+        const Quat child_orientation = Normalize(b.orientation * child.localOrientation);
+        if (child.shape == ShapeType::Sphere) {
+            LidarTarget target{};
+            target.shape = ShapeType::Sphere;
+            target.center = child_position;
+            target.radius = child.radius;
+            fn(target);
+            continue;
+        }
+        fn(MakeLidarTarget(
+            child.shape, child_position, child_orientation, child.radius, child.halfHeight, child.halfExtents, origin));
     }
-    if (!std::isfinite(t_hit) || t_hit <= 1.0e-4) {
-        return false;
+    if (!any_child) {
+        fn(MakeLidarTarget(ShapeType::Box, b.position, b.orientation, 0.0, 0.0, b.halfExtents, origin));
     }
-    t_out = t_hit;
-    return true;
 }
 
-bool RayAabbHit(const Vec3& o, const Vec3& d, const AABB& box, Real& t_out) {
+bool RayTargetHit(const LidarTarget& target, const Vec3& origin, const Vec3& dir, Real& t_out) {
+    if (target.shape == ShapeType::Plane) {
+        return RayPlaneHit(origin, dir, target.center, target.plane_normal, t_out);
+    }
+
     Real t_min = -std::numeric_limits<float>::infinity();
     Real t_max = std::numeric_limits<float>::infinity();
+    if (target.shape == ShapeType::Sphere) {
+        if (!RaySphereInterval(origin, dir, target.center, target.radius, t_min, t_max)) {
+            return false;
+        }
+        return PickIntervalHit(t_min, t_max, t_out);
+    }
 
-    auto axis = [&](Real o_a, Real d_a, Real b_min, Real b_max) -> bool {
-        if (std::abs(d_a) < 1.0e-8) {
-            if (o_a < b_min || o_a > b_max) {
+    const Vec3& o_l = target.origin_local;
+    const Vec3 d_l = Rotate(target.inverse_orientation, dir);
+    switch (target.shape) {
+        case ShapeType::Box: {
+            const Vec3& he = target.half_extents;
+            if (!ClipSlab(o_l.x, d_l.x, -he.x, he.x, t_min, t_max) || !ClipSlab(o_l.y, d_l.y, -he.y, he.y, t_min, t_max)
+                || !ClipSlab(o_l.z, d_l.z, -he.z, he.z, t_min, t_max)) {
                 return false;
             }
-            return true;
+            return PickIntervalHit(t_min, t_max, t_out);
         }
-        Real inv = 1.0 / d_a;
-        Real t1 = (b_min - o_a) * inv;
-        Real t2 = (b_max - o_a) * inv;
-        if (t1 > t2) {
-            std::swap(t1, t2);
+        case ShapeType::Cylinder:
+        case ShapeType::HalfCylinder: {
+            if (!RayInfiniteCylinderInterval(o_l, d_l, target.radius, t_min, t_max)
+                || !ClipSlab(o_l.y, d_l.y, -target.half_height, target.half_height, t_min, t_max)) {
+                return false;
+            }
+            // Half-cylinder material is local z >= 0 (flat cut through the axis).
+            if (target.shape == ShapeType::HalfCylinder
+                && !ClipSlab(o_l.z, d_l.z, 0.0, std::numeric_limits<Real>::infinity(), t_min, t_max)) {
+                return false;
+            }
+            return PickIntervalHit(t_min, t_max, t_out);
         }
-        t_min = std::max(t_min, t1);
-        t_max = std::min(t_max, t2);
-        return t_min <= t_max;
-    };
-
-    if (!axis(o.x, d.x, box.min.x, box.max.x)) {
-        return false;
-    }
-    if (!axis(o.y, d.y, box.min.y, box.max.y)) {
-        return false;
-    }
-    if (!axis(o.z, d.z, box.min.z, box.max.z)) {
-        return false;
+        case ShapeType::Capsule: {
+            // Union of the side cylinder and the two end spheres; a capsule is convex, so the union of
+            // the pieces' intervals is a single interval.
+            Real entry = std::numeric_limits<Real>::infinity();
+            Real exit = -std::numeric_limits<Real>::infinity();
+            bool any = false;
+            Real side_min = t_min;
+            Real side_max = t_max;
+            if (RayInfiniteCylinderInterval(o_l, d_l, target.radius, side_min, side_max)
+                && ClipSlab(o_l.y, d_l.y, -target.half_height, target.half_height, side_min, side_max)) {
+                entry = std::min(entry, side_min);
+                exit = std::max(exit, side_max);
+                any = true;
+            }
+            for (const Real cap_y : {target.half_height, -target.half_height}) {
+                Real cap_min = 0.0;
+                Real cap_max = 0.0;
+                if (RaySphereInterval(o_l, d_l, Vec3{0.0, cap_y, 0.0}, target.radius, cap_min, cap_max)) {
+                    entry = std::min(entry, cap_min);
+                    exit = std::max(exit, cap_max);
+                    any = true;
+                }
+            }
+            return any && PickIntervalHit(entry, exit, t_out);
+        }
+        default:
+            return false;
     }
+}
 
-    Real t_hit = t_min;
-    if (t_hit <= 1.0e-4) {
-        t_hit = t_max;
-    }
-    if (!std::isfinite(t_hit) || t_hit <= 1.0e-4) {
-        return false;
-    }
-    t_out = t_hit;
-    return true;
+// Closest hit of `b` along one beam, or false. Shared by the per-ray and packet tracers so both
+// produce bit-identical ranges.
+bool RayBodyHit(const Body& b, const Vec3& origin, const Vec3& dir, Real& t_out) {
+    bool hit = false;
+    ForEachLidarTarget(b, origin, [&](const LidarTarget& target) {
+        Real t = 0.0;
+        if (RayTargetHit(target, origin, dir, t) && (!hit || t < t_out)) {
+            t_out = t;
+            hit = true;
+        }
+    });
+    return hit;
 }
 
 // `skip_bodies` marks the body IDs that should not contribute to the ray (robot
@@ -196,12 +328,10 @@ bool RayAabbHit(const Vec3& o, const Vec3& d, const AABB& box, Real& t_out) {
 // `World::QueryRayCandidates` and only test bodies whose fat-AABB is intersected
 // by the ray — turning what was O(N bodies) per ray into O(log N + hits).
 Real CastRay(const World& world,
-              const HexapodSceneObjects& scene,
               const TerrainPatch& terrain_patch,
               const std::vector<std::uint8_t>& skip_bodies,
               const Vec3& origin,
               const Vec3& dir_unit) {
-    (void)scene;
     Real best = kMaxRangeM + 1.0;
 
     Real terrain_hit = -1.0;
@@ -213,34 +343,8 @@ Real CastRay(const World& world,
         if (id < skip_bodies.size() && skip_bodies[id] != 0) {
             return;
         }
-        const Body& b = world.GetBody(id);
         Real t_hit = std::numeric_limits<float>::infinity();
-
-        if (b.shape == ShapeType::Plane) {
-            Vec3 n{};
-            if (!TryNormalize(b.planeNormal, n)) {
-                return;
-            }
-            if (!RayPlaneHit(origin, dir_unit, b.position, n, t_hit)) {
-                return;
-            }
-        } else if (b.shape == ShapeType::Sphere) {
-            if (!RaySphereHit(origin, dir_unit, b.position, b.radius, t_hit)) {
-                return;
-            }
-        } else if (b.shape == ShapeType::Box) {
-            const Vec3 c = BodyWorldShapeOrigin(b);
-            if (!RayObbHit(origin, dir_unit, c, b.orientation, b.halfExtents, t_hit)) {
-                return;
-            }
-        } else {
-            const AABB aabb = b.ComputeAABB();
-            if (!RayAabbHit(origin, dir_unit, aabb, t_hit)) {
-                return;
-            }
-        }
-
-        if (t_hit < best) {
+        if (RayBodyHit(world.GetBody(id), origin, dir_unit, t_hit) && t_hit < best) {
             best = t_hit;
         }
     });
@@ -251,6 +355,48 @@ Real CastRay(const World& world,
     return best;
 }
 
+// Packet form of CastRay for the beams pushed into `packet`; writes one range per lane to
+// `ranges_out` (-1 for no return). Every lane's traversal bound starts at its terrain hit and
+// shrinks to the closest hit so far, so bodies behind a nearer return are never visited. A body
+// is resolved into local-frame targets once for all lanes that reach it.
+void CastRayPacket(const World& world,
+                   const TerrainPatch& terrain_patch,
+                   const std::vector<std::uint8_t>& skip_bodies,
+                   RayPacket& packet,
+                   Real* ranges_out) {
+    std::array<Real, kRayPacketMaxRays> best{};
+    for (std::size_t lane = 0; lane < packet.count; ++lane) {
+        best[lane] = kMaxRangeM + 1.0;
+        Real terrain_hit = -1.0;
+        if (terrain_patch.RaycastWorld(packet.origin, packet.Direction(lane), terrain_hit)) {
+            best[lane] = terrain_hit;
+        }
+        packet.tMax[lane] = std::min(kMaxRangeM, best[lane]);
+    }
+
+    world.QueryRayPacketCandidates(packet, [&](std::uint32_t id, RayPacketMask lanes) {
+        if (id < skip_bodies.size() && skip_bodies[id] != 0) {
+            return;
+        }
+        ForEachLidarTarget(world.GetBody(id), packet.origin, [&](const LidarTarget& target) {
+            for (std::size_t lane = 0; lane < packet.count; ++lane) {
+                if (((lanes >> lane) & 1u) == 0u) {
+                    continue;
+                }
+                Real t_hit = std::numeric_limits<float>::infinity();
+                if (RayTargetHit(target, packet.origin, packet.Direction(lane), t_hit) && t_hit < best[lane]) {
+                    best[lane] = t_hit;
+                    packet.tMax[lane] = std::min(packet.tMax[lane], t_hit);
+                }
+            }
+        });
+    });
+
+    for (std::size_t lane = 0; lane < packet.count; ++lane) {
+        ranges_out[lane] = (best[lane] > kMaxRangeM || !std::isfinite(best[lane])) ? -1.0 : best[lane];
+    }
+}
+
 Vec3 ChassisForward(const Quat& q_body) {
     // Body local −Z is toward the front leg row (see `scenes.cpp` mount offsets).
     return Normalize(Rotate(q_body, Vec3{0.0, 0.0, -1.0}));
@@ -260,6 +406,59 @@ Vec3 ChassisUp(const Quat& q_body) {
     return Normalize(Rotate(q_body, Vec3{0.0, 1.0, 0.0}));
 }
 
+struct LidarFrame {
+    Vec3 origin{};
+    Vec3 optical_axis{};
+    Vec3 optical_right{};
+    Vec3 optical_up{};
+};
+
+LidarFrame MakeLidarFrame(const Body& chassis) {
+    const Quat q = Normalize(chassis.orientation);
+    const Vec3 forward = ChassisForward(q);
+    const Vec3 up = ChassisUp(q);
+    // Pitch the optical axis slightly down so central beams are not parallel to an infinite ground plane.
+    const Real kOpticalAxisPitchDownRad = static_cast<float>(matrix_lidar_geom::kOpticalAxisPitchDownRad);
+    LidarFrame frame{};
+    frame.optical_axis =
+        Normalize(forward * std::cos(kOpticalAxisPitchDownRad) - up * std::sin(kOpticalAxisPitchDownRad));
+    frame.optical_right = Normalize(Cross(up, frame.optical_axis));
+    frame.optical_up = Normalize(Cross(frame.optical_axis, frame.optical_right));
+
+    // Sensor origin: shared placement with server `matrix_lidar_geom` (minphys body frame).
+    frame.origin = chassis.position +
+                   Rotate(q,
+                          Vec3{static_cast<float>(matrix_lidar_geom::kSensorOffsetMinphysBodyXM),
+                               static_cast<float>(matrix_lidar_geom::kSensorOffsetMinphysBodyYM),
+                               static_cast<float>(matrix_lidar_geom::kSensorOffsetMinphysBodyZM)});
+    return frame;
+}
+
+/// Unit beam direction of cell (row, col); `cos_el_out` receives the cosine of its elevation.
+Vec3 BeamDirection(const LidarFrame& frame, int row, int col, Real* cos_el_out = nullptr) {
+    double az_d = 0.0;
+    double el_d = 0.0;
+    matrix_lidar_geom::cellAzElRad(
+        row,
+        kRows,
+        col,
+        kCols,
+        matrix_lidar_geom::kMatrix64x8FovHRad,
+        matrix_lidar_geom::kMatrix64x8FovVRad,
+        az_d,
+        el_d);
+    const Real az = static_cast<float>(az_d);
+    const Real el = static_cast<float>(el_d);
+
+    const Real c_el = std::cos(el);
+    if (cos_el_out != nullptr) {
+        *cos_el_out = c_el;
+    }
+    return Normalize(
+        frame.optical_axis * (c_el * std::cos(az)) + frame.optical_right * (c_el * std::sin(az))
+        + frame.optical_up * std::sin(el));
+}
+
 std::uint16_t RangeToWireMm(Real range_m) {
     if (range_m < kMinRangeM) {
         return physics_sim::kMatrixLidarInvalidMm;
@@ -272,69 +471,63 @@ std::uint16_t RangeToWireMm(Real range_m) {
     return static_cast<std::uint16_t>(clamped);
 }
 
+std::uint16_t HitToWireMm(Real hit_m) {
+    return hit_m < 0.0 ? physics_sim::kMatrixLidarInvalidMm : RangeToWireMm(hit_m);
+}
+
 } // namespace
 
 void FillSimMatrixLidar64x8(const World& world,
                             const HexapodSceneObjects& scene,
                             const TerrainPatch& terrain_patch,
                             const Body& chassis,
-                            physics_sim::StateResponse& rsp) {
+                            physics_sim::StateResponse& rsp,
+                            const MatrixLidarTraceOptions& options) {
     rsp.matrix_lidar_valid = 0;
     rsp.matrix_lidar_model = physics_sim::MatrixLidarModel::None;
     rsp.matrix_lidar_cols = 0;
     rsp.matrix_lidar_rows = 0;
     rsp.matrix_lidar_ranges_mm.fill(physics_sim::kMatrixLidarInvalidMm);
 
-    const Quat q = Normalize(chassis.orientation);
-    const Vec3 forward = ChassisForward(q);
-    const Vec3 up = ChassisUp(q);
-    // Pitch the optical axis slightly down so central beams are not parallel to an infinite ground plane.
-    const Real kOpticalAxisPitchDownRad = static_cast<float>(matrix_lidar_geom::kOpticalAxisPitchDownRad);
-    const Vec3 optical_axis =
-        Normalize(forward * std::cos(kOpticalAxisPitchDownRad) - up * std::sin(kOpticalAxisPitchDownRad));
-    const Vec3 optical_right = Normalize(Cross(up, optical_axis));
-    const Vec3 optical_up = Normalize(Cross(optical_axis, optical_right));
-
-    // Sensor origin: shared placement with server `matrix_lidar_geom` (minphys body frame).
-    const Vec3 sensor_origin = chassis.position +
-                               Rotate(q,
-                                      Vec3{static_cast<float>(matrix_lidar_geom::kSensorOffsetMinphysBodyXM),
-                                           static_cast<float>(matrix_lidar_geom::kSensorOffsetMinphysBodyYM),
-                                           static_cast<float>(matrix_lidar_geom::kSensorOffsetMinphysBodyZM)});
-
-    constexpr int kCols = 64;
-    constexpr int kRows = 8;
+    const LidarFrame frame = MakeLidarFrame(chassis);
 
     // Single skip-body bitset for the whole scan; see BuildLidarSkipBodies.
     const std::vector<std::uint8_t> skip_bodies = BuildLidarSkipBodies(world, scene);
 
-    for (int row = 0; row < kRows; ++row) {
-        for (int col = 0; col < kCols; ++col) {
-            double az_d = 0.0;
-            double el_d = 0.0;
-            matrix_lidar_geom::cellAzElRad(
-                row,
-                kRows,
-                col,
-                kCols,
-                matrix_lidar_geom::kMatrix64x8FovHRad,
-                matrix_lidar_geom::kMatrix64x8FovVRad,
-                az_d,
-                el_d);
-            const Real az = static_cast<float>(az_d);
-            const Real el = static_cast<float>(el_d);
-
-            const Real c_el = std::cos(el);
-            const Vec3 dir = Normalize(
-                optical_axis * (c_el * std::cos(az)) + optical_right * (c_el * std::sin(az))
-                + optical_up * std::sin(el));
-
-            const Real hit_m = CastRay(world, scene, terrain_patch, skip_bodies, sensor_origin, dir);
-            const std::size_t idx = static_cast<std::size_t>(row * kCols + col);
-            if (hit_m < 0.0) {
-                rsp.matrix_lidar_ranges_mm[idx] = physics_sim::kMatrixLidarInvalidMm;
-            } else {
-                rsp.matrix_lidar_ranges_mm[idx] = RangeToWireMm(hit_m);
+    if (!options.use_packets) {
+        for (int row = 0; row < kRows; ++row) {
+            for (int col = 0; col < kCols; ++col) {
+                const Vec3 dir = BeamDirection(frame, row, col);
+                const Real hit_m = CastRay(world, terrain_patch, skip_bodies, frame.origin, dir);
+                rsp.matrix_lidar_ranges_mm[static_cast<std::size_t>(row * kCols + col)] = HitToWireMm(hit_m);
+            }
+        }
+    } else {
+        // Each tile writes only its own cells, so the result does not depend on how tiles are
+        // distributed over the pool.
+        auto trace_tile = [&](std::size_t tile) {
+            const int col0 = static_cast<int>(tile) * kTileCols;
+            RayPacket packet{};
+            packet.origin = frame.origin;
+            for (int row = 0; row < kRows; ++row) {
+                for (int col = col0; col < col0 + kTileCols; ++col) {
+                    packet.Push(BeamDirection(frame, row, col), kMaxRangeM);
+                }
+            }
+            std::array<Real, kRayPacketMaxRays> hits{};
+            CastRayPacket(world, terrain_patch, skip_bodies, packet, hits.data());
+            std::size_t lane = 0;
+            for (int row = 0; row < kRows; ++row) {
+                for (int col = col0; col < col0 + kTileCols; ++col) {
+                    rsp.matrix_lidar_ranges_mm[static_cast<std::size_t>(row * kCols + col)] = HitToWireMm(hits[lane++]);
+                }
+            }
+        };
+        if (options.pool != nullptr) {
+            options.pool->ParallelFor(static_cast<std::size_t>(kTileCount), trace_tile);
+        } else {
+            for (std::size_t tile = 0; tile < static_cast<std::size_t>(kTileCount); ++tile) {
+                trace_tile(tile);
             }
         }
     }
@@ -360,53 +553,22 @@ void AppendMatrixLidarTerrainSamples(const World& world,
     }
     const int stride = std::max(1, terrain_config.lidar_sample_stride);
 
-    const Quat q = Normalize(chassis.orientation);
-    const Vec3 forward = ChassisForward(q);
-    const Vec3 up = ChassisUp(q);
-    const Real kOpticalAxisPitchDownRad = static_cast<float>(matrix_lidar_geom::kOpticalAxisPitchDownRad);
-    const Vec3 optical_axis =
-        Normalize(forward * std::cos(kOpticalAxisPitchDownRad) - up * std::sin(kOpticalAxisPitchDownRad));
-    const Vec3 optical_right = Normalize(Cross(up, optical_axis));
-    const Vec3 optical_up = Normalize(Cross(optical_axis, optical_right));
-
-    const Vec3 sensor_origin = chassis.position +
-                               Rotate(q,
-                                      Vec3{static_cast<float>(matrix_lidar_geom::kSensorOffsetMinphysBodyXM),
-                                           static_cast<float>(matrix_lidar_geom::kSensorOffsetMinphysBodyYM),
-                                           static_cast<float>(matrix_lidar_geom::kSensorOffsetMinphysBodyZM)});
-
-    constexpr int kCols = 64;
-    constexpr int kRows = 8;
+    const LidarFrame frame = MakeLidarFrame(chassis);
+    const Vec3& sensor_origin = frame.origin;
 
     const std::vector<std::uint8_t> skip_bodies = BuildLidarSkipBodies(world, scene);
 
     for (int row = 0; row < kRows; row += stride) {
         for (int col = 0; col < kCols; col += stride) {
-            double az_d = 0.0;
-            double el_d = 0.0;
-            matrix_lidar_geom::cellAzElRad(
-                row,
-                kRows,
-                col,
-                kCols,
-                matrix_lidar_geom::kMatrix64x8FovHRad,
-                matrix_lidar_geom::kMatrix64x8FovVRad,
-                az_d,
-                el_d);
-            const Real az = static_cast<float>(az_d);
-            const Real el = static_cast<float>(el_d);
-
-            const Real c_el = std::cos(el);
-            const Vec3 dir = Normalize(
-                optical_axis * (c_el * std::cos(az)) + optical_right * (c_el * std::sin(az))
-                + optical_up * std::sin(el));
+            Real c_el = 0.0;
+            const Vec3 dir = BeamDirection(frame, row, col, &c_el);
 
             Real t_terrain = -1.0;
             const bool terrain_hit = terrain_patch.RaycastWorld(sensor_origin, dir, t_terrain);
             if (!terrain_hit || t_terrain <= 1.0e-4) {
                 continue;
             }
-            const Real t_full = CastRay(world, scene, terrain_patch, skip_bodies, sensor_origin, dir);
+            const Real t_full = CastRay(world, terrain_patch, skip_bodies, sensor_origin, dir);
             if (t_full < 0.0 || !std::isfinite(t_full)) {
                 continue;
             }
@@ -421,10 +583,10 @@ void AppendMatrixLidarTerrainSamples(const World& world,
                 surface_confidence < terrain_config.lidar_min_surface_confidence) {
                 continue;
             }
-            const Real incidence = std::max(0.15, std::abs(dir.y));
+            const Real incidence = std::max<Real>(0.15, std::abs(dir.y));
             const Real conf =
-                terrain_config.lidar_sample_weight * surface_confidence * incidence * std::max(0.2, std::abs(c_el));
-            out_samples.push_back(TerrainSample{hit, hit.y, std::clamp(conf, 0.0, 1.0)});
+                terrain_config.lidar_sample_weight * surface_confidence * incidence * std::max<Real>(0.2, std::abs(c_el));
+            out_samples.push_back(TerrainSample{hit, hit.y, std::clamp<Real>(conf, 0.0, 1.0)});
         }
     }
 }
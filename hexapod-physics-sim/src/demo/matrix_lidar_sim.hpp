@@ -7,12 +7,22 @@
 
 namespace minphys3d::demo {
 
+struct MatrixLidarTraceOptions {
+    /// Trace 8×8 tiles of beams as ray packets that share one BVH walk. When false every beam walks
+    /// the BVH on its own (reference path; ranges are identical).
+    bool use_packets{true};
+    /// Optional pool the eight tiles are spread over (packet path only); null traces on the caller.
+    core_internal::WorkerPool* pool{nullptr};
+};
+
 /// Simulates the built-in 64×8 matrix LiDAR on the chassis and writes the `StateResponse` tail fields.
+/// Spheres, boxes, capsules, (half-)cylinders and compound children are intersected exactly.
 void FillSimMatrixLidar64x8(const World& world,
                             const HexapodSceneObjects& scene,
                             const TerrainPatch& terrain_patch,
                             const Body& chassis,
-                            physics_sim::StateResponse& rsp);
+                            physics_sim::StateResponse& rsp,
+                            const MatrixLidarTraceOptions& options = {});
 
 /// Appends sparse `TerrainSample`s from matrix LiDAR beams whose first hit matches the terrain patch
 /// (down-weighted via `TerrainPatchConfig::lidar_sample_weight` / stride).
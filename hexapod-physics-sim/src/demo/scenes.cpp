@@ -134,7 +134,7 @@ Quat QuaternionFromBasis(const Vec3& x_axis, const Vec3& y_axis, const Vec3& z_a
     if (trace > 0.0) {
         const Real s = std::sqrt(trace + 1.0) * 2.0;
         return Normalize(Quat{
-            0.25 * s,
+            Real(0.25) * s,
             (m21 - m12) / s,
             (m02 - m20) / s,
             (m10 - m01) / s,
@@ -144,7 +144,7 @@ Quat QuaternionFromBasis(const Vec3& x_axis, const Vec3& y_axis, const Vec3& z_a
         const Real s = std::sqrt(1.0 + m00 - m11 - m22) * 2.0;
         return Normalize(Quat{
             (m21 - m12) / s,
-            0.25 * s,
+            Real(0.25) * s,
             (m01 + m10) / s,
             (m02 + m20) / s,
         });
@@ -154,7 +154,7 @@ Quat QuaternionFromBasis(const Vec3& x_axis, const Vec3& y_axis, const Vec3& z_a
         return Normalize(Quat{
             (m02 - m20) / s,
             (m01 + m10) / s,
-            0.25 * s,
+            Real(0.25) * s,
             (m12 + m21) / s,
         });
     }
@@ -163,7 +163,7 @@ Quat QuaternionFromBasis(const Vec3& x_axis, const Vec3& y_axis, const Vec3& z_a
         (m10 - m01) / s,
         (m02 + m20) / s,
         (m12 + m21) / s,
-        0.25 * s,
+        Real(0.25) * s,
     });
 }
 
@@ -288,7 +288,7 @@ Real ComputeStandingBodyHeight() {
     // Extra clearance so the first contact frames do not start with feet intersecting the plane when
     // identical servos ramp holding torque (slightly conservative over analytic foot height).
     constexpr Real kSpawnHeightMargin = 0.002;
-    return std::max(kBodyToBottom, physics_sim::kHexapodFootRadiusM - foot_center_relative.y + 0.001) +
+    return std::max<Real>(kBodyToBottom, physics_sim::kHexapodFootRadiusM - foot_center_relative.y + 0.001) +
            kSpawnHeightMargin;
 }
 
@@ -452,7 +452,7 @@ void RelaxBuiltInHexapodServos(World& world, const HexapodSceneObjects& scene) {
     for (const std::uint32_t joint_id : HexapodServoJointIds(scene)) {
         ServoJoint& joint = world.GetServoJointMutable(joint_id);
         joint.integralGain = kIntegralToPositionRatio * joint.positionGain;
-        joint.integralClamp = std::max(joint.integralClamp, 0.75);
+        joint.integralClamp = std::max<Real>(joint.integralClamp, 0.75);
         joint.angleStabilizationScale = kAngleStabilizationScale;
     }
 }
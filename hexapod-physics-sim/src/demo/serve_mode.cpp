@@ -8,6 +8,7 @@
 #include "demo/serve_async.hpp"
 #include "demo/terrain_patch.hpp"
 #include "minphys3d/collision/shapes.hpp"
+#include "minphys3d/core/worker_pool.hpp"
 #include "minphys3d/core/world.hpp"
 #include "minphys3d/demo/hexapod_scene.hpp"
 #include "minphys3d/math/vec3.hpp"
@@ -157,6 +158,7 @@ struct CachedMatrixLidarFrame {
     std::array<std::uint16_t, physics_sim::kMatrixLidarMaxCells> ranges_mm{};
 };
 
+// The attachment references the patch's shared height buffer, so this copies no heights.
 void SyncTerrainHeightfield(World& world, const TerrainPatch& terrain_patch) {
     if (!terrain_patch.initialized()) {
         world.ClearTerrainHeightfield();
@@ -998,6 +1000,276 @@ PreviewFrameSnapshot BuildPreviewFrameSnapshot(int frame_index,
     return snapshot;
 }
 
+using ServeProfiler = resource_monitoring::SectionProfiler<kServeSectionLabels.size()>;
+
+/// One hosted world and the serve-loop state that follows it between messages. Plain `--serve`
+/// keeps one; `--serve-envs N` keeps N, addressed by the messages' `env_index`.
+struct ServeEnvironment {
+    World world{Vec3{0.0f, -9.81f, 0.0f}};
+    HexapodSceneObjects scene{};
+    int solver_iterations{8};
+    bool configured{false};
+    AssimilationState assimilation_state{};
+    TerrainPatch terrain_patch{};
+    std::vector<std::uint32_t> obstacle_body_ids{};
+    std::array<std::uint32_t, 18> wire_joints{};
+    std::array<float, 18> prev_angles{};
+    CachedMatrixLidarFrame cached_lidar_frame{};
+    std::uint64_t lidar_sim_time_us{0};
+    std::uint64_t next_lidar_capture_us{0};
+    /// Shared by every environment (`--lidar-threads`); null traces the scan on the stepping thread.
+    core_internal::WorkerPool* lidar_pool{nullptr};
+};
+
+/// Builds the hexapod scene (plus `scene_file`, when set) into `env`. Only the first environment
+/// logs, so N identical environments print one set of startup lines.
+bool BuildServeEnvironment(ServeEnvironment& env,
+                           const std::string& scene_file,
+                           ResourceMonitoringMode resource_monitoring_mode,
+                           int solver_threads,
+                           bool log) {
+    World& world = env.world;
+    world.SetResourceMonitoringMode(resource_monitoring_mode);
+    env.scene = BuildHexapodScene(world);
+    RelaxBuiltInHexapodServos(world, env.scene);
+    TerrainPatchConfig terrain_config{};
+    TerrainPatchSeed terrain_seed{};
+
+    if (!scene_file.empty()) {
+        std::string error;
+        int appended_joints = 0;
+        if (!AppendWorldFromMinphysSceneJsonFile(
+                scene_file, world, env.solver_iterations, error, &appended_joints, &terrain_config, &terrain_seed)) {
+            std::cerr << "[serve] failed to append scene file '" << scene_file << "': " << error << "\n";
+            return false;
+        }
+        if (log) {
+            std::cout << "[serve] appended scene file '" << scene_file << "' joints=" << appended_joints << "\n";
+        }
+    }
+
+    env.terrain_patch = TerrainPatch{terrain_config};
+    const Vec3 initial_center = world.GetBody(env.scene.body).position;
+    const Vec3 patch_center = terrain_seed.has_center ? terrain_seed.center : initial_center;
+    const float plane_height =
+        terrain_seed.has_plane_height ? terrain_seed.plane_height_m : world.GetBody(env.scene.plane).planeOffset;
+    const Vec3 plane_normal =
+        terrain_seed.has_plane_normal ? terrain_seed.plane_normal : world.GetBody(env.scene.plane).planeNormal;
+    env.terrain_patch.initialize(world, patch_center, plane_height, plane_normal);
+    SyncTerrainHeightfield(world, env.terrain_patch);
+
+    if (const char* no_contact_env = std::getenv("MINPHYS_HEXAPOD_NO_CONTACT_TEST");
+        no_contact_env != nullptr && no_contact_env[0] != '\0' && no_contact_env[0] != '0') {
+        world.SetGravity(Vec3{0.0f, 0.0f, 0.0f});
+        world.ClearTerrainHeightfield();
+        // Keep normal robot self-collision active to expose internal instability.
+        // "No contact" here means no terrain/ground contacts.
+        if (log) {
+            std::cout << "[serve] MINPHYS_HEXAPOD_NO_CONTACT_TEST enabled (zero-g + terrain contacts disabled, self-collision enabled)\n";
+        }
+    }
+
+    env.obstacle_body_ids = CollectObstacleBodyIds(world, env.scene);
+
+    JointSolverConfig joint_cfg = world.GetJointSolverConfig();
+    joint_cfg.servoPositionPasses = 8;
+    joint_cfg.hingeAnchorBiasFactor = 0.25f;
+    joint_cfg.hingeAnchorDampingFactor = 0.3f;
+    world.SetJointSolverConfig(joint_cfg);
+    world.SetBodyVelocityLimits(5.0f, 15.0f);
+
+    World::ParallelSolveConfig parallel_cfg = world.GetParallelSolveConfig();
+    parallel_cfg.threadCount = static_cast<std::uint32_t>(std::max(solver_threads, 1));
+    world.SetParallelSolveConfig(parallel_cfg);
+
+    if (const char* disable_pre_corr = std::getenv("MINPHYS_DISABLE_VELOCITY_PRECORR");
+        disable_pre_corr != nullptr && disable_pre_corr[0] != '\0' && disable_pre_corr[0] != '0') {
+        auto articulation_cfg = world.GetArticulationConfig();
+        articulation_cfg.enableVelocityPreCorrection = false;
+        articulation_cfg.enableVelocityPreCorrectionFullForwardPass = false;
+        articulation_cfg.enableVelocityPreCorrectionChassisCoupling = false;
+        articulation_cfg.enableVelocityPreCorrectionChassisArticulatedTree = false;
+        world.SetArticulationConfig(articulation_cfg);
+        if (log) {
+            std::cout << "[serve] MINPHYS_DISABLE_VELOCITY_PRECORR enabled\n";
+        }
+    }
+
+    env.wire_joints = ServoJointIdsInWireOrder(env.scene);
+    for (std::size_t i = 0; i < env.wire_joints.size(); ++i) {
+        env.prev_angles[i] = world.GetServoJointAngle(env.wire_joints[i]);
+    }
+    return true;
+}
+
+void RefreshMatrixLidarFrame(ServeEnvironment& env,
+                             ServeProfiler& serve_profiler,
+                             physics_sim::StateResponse& rsp,
+                             const float fusion_age_seconds,
+                             const bool advance_sensor_time) {
+    World& world = env.world;
+    const Body& chassis = world.GetBody(env.scene.body);
+    if (advance_sensor_time && std::isfinite(fusion_age_seconds) && fusion_age_seconds > 0.0f) {
+        env.lidar_sim_time_us += static_cast<std::uint64_t>(
+            std::llround(static_cast<double>(fusion_age_seconds) * 1.0e6));
+    }
+
+    const bool need_capture = !env.cached_lidar_frame.valid || env.lidar_sim_time_us >= env.next_lidar_capture_us;
+    if (!need_capture) {
+        writeCachedMatrixLidarFrame(env.cached_lidar_frame, rsp);
+        return;
+    }
+
+    {
+        const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::MatrixLidarScan));
+        MatrixLidarTraceOptions trace_options{};
+        trace_options.pool = env.lidar_pool;
+        FillSimMatrixLidar64x8(world, env.scene, env.terrain_patch, chassis, rsp, trace_options);
+        (void)scope;
+    }
+    rsp.matrix_lidar_timestamp_us = env.lidar_sim_time_us == 0 ? 1ULL : env.lidar_sim_time_us;
+
+    if (env.terrain_patch.config().lidar_fusion_enable) {
+        std::vector<TerrainSample> lidar_samples;
+        {
+            const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::MatrixLidarFusion));
+            AppendMatrixLidarTerrainSamples(
+                world, env.scene, env.terrain_patch, chassis, rsp, env.terrain_patch.config(), lidar_samples);
+            ApplyContactArbitrationToLidarSamples(
+                world, env.scene, env.assimilation_state, env.terrain_patch.config(), lidar_samples);
+            (void)scope;
+        }
+        if (!lidar_samples.empty()) {
+            Body& plane_body = world.GetBody(env.scene.plane);
+            // LiDAR fusion intentionally follows response generation: the response reports what this
+            // step saw, and the fused terrain influences subsequent contacts/rays.
+            const auto scope =
+                serve_profiler.scope(static_cast<std::size_t>(ServeSection::TerrainPatchUpdate));
+            env.terrain_patch.update(world,
+                                     world.GetBody(env.scene.body).position,
+                                     plane_body.planeOffset,
+                                     plane_body.planeNormal,
+                                     lidar_samples,
+                                     fusion_age_seconds);
+            SyncTerrainHeightfield(world, env.terrain_patch);
+            (void)scope;
+        }
+    }
+
+    CachedMatrixLidarFrame& cache = env.cached_lidar_frame;
+    cache.valid = true;
+    cache.timestamp_us = rsp.matrix_lidar_timestamp_us;
+    cache.model = static_cast<std::uint8_t>(rsp.matrix_lidar_model);
+    cache.cols = rsp.matrix_lidar_cols;
+    cache.rows = rsp.matrix_lidar_rows;
+    cache.ranges_mm = rsp.matrix_lidar_ranges_mm;
+
+    if (env.next_lidar_capture_us == 0) {
+        env.next_lidar_capture_us = kMatrixLidarFramePeriodUs;
+    }
+    while (env.next_lidar_capture_us <= env.lidar_sim_time_us) {
+        env.next_lidar_capture_us += kMatrixLidarFramePeriodUs;
+    }
+}
+
+void BeginStateResponse(const Body& chassis,
+                        std::uint32_t sequence_id,
+                        std::uint16_t env_index,
+                        physics_sim::StateResponse& rsp) {
+    rsp = physics_sim::StateResponse{};
+    rsp.message_type = static_cast<std::uint8_t>(physics_sim::MessageType::StateResponse);
+    rsp.sequence_id = sequence_id;
+    rsp.env_index = env_index;
+    rsp.body_position = {chassis.position.x, chassis.position.y, chassis.position.z};
+    rsp.body_orientation = {
+        chassis.orientation.w,
+        chassis.orientation.x,
+        chassis.orientation.y,
+        chassis.orientation.z,
+    };
+    rsp.body_linear_velocity = {chassis.velocity.x, chassis.velocity.y, chassis.velocity.z};
+    rsp.body_angular_velocity = {
+        chassis.angularVelocity.x,
+        chassis.angularVelocity.y,
+        chassis.angularVelocity.z,
+    };
+}
+
+/// `sequence_id == 0` snapshot: reports the current state without stepping.
+void PeekServeEnvironment(ServeEnvironment& env,
+                          std::uint16_t env_index,
+                          ServeProfiler& serve_profiler,
+                          physics_sim::StateResponse& rsp) {
+    const World& world = env.world;
+    BeginStateResponse(world.GetBody(env.scene.body), 0, env_index, rsp);
+    for (std::size_t i = 0; i < env.wire_joints.size(); ++i) {
+        rsp.joint_angles[i] = world.GetServoJointAngle(env.wire_joints[i]);
+        rsp.joint_velocities[i] = 0.0f;
+    }
+    const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::PackResponse));
+    FillFootContactsFromManifolds(world, env.scene, rsp.foot_contacts, rsp.foot_contact_normals);
+    FillObstacleFootprints(world, env.obstacle_body_ids, rsp);
+    RefreshMatrixLidarFrame(env, serve_profiler, rsp, 0.0f, false);
+    (void)scope;
+}
+
+/// Applies `step`'s joint targets, advances the world by `step.dt_seconds` and packs the reply.
+/// Touches only `env` (and the thread-safe profiler), so distinct environments may step concurrently.
+void StepServeEnvironment(ServeEnvironment& env,
+                          const physics_sim::StepCommand& step,
+                          ServeProfiler& serve_profiler,
+                          physics_sim::StateResponse& rsp) {
+    World& world = env.world;
+    {
+        const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::ApplyJointTargets));
+        for (std::size_t i = 0; i < env.wire_joints.size(); ++i) {
+            ServoJoint& sj = world.GetServoJointMutable(env.wire_joints[i]);
+            sj.targetAngle = step.joint_targets[i];
+        }
+        (void)scope;
+    }
+
+    for (std::size_t i = 0; i < env.wire_joints.size(); ++i) {
+        env.prev_angles[i] = world.GetServoJointAngle(env.wire_joints[i]);
+    }
+
+    const int physics_substeps = std::clamp(
+        static_cast<int>(std::ceil(step.dt_seconds / kServeMaxPhysicsSubstepSeconds)),
+        1,
+        kServeMaxPhysicsSubsteps);
+    const float substep_dt = step.dt_seconds / static_cast<float>(physics_substeps);
+    {
+        const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::PhysicsStep));
+        for (int substep_index = 0; substep_index < physics_substeps; ++substep_index) {
+            world.Step(substep_dt, env.solver_iterations);
+        }
+        (void)scope;
+    }
+
+    BeginStateResponse(world.GetBody(env.scene.body), step.sequence_id, step.env_index, rsp);
+
+    const float inv_dt = 1.0f / step.dt_seconds;
+    for (std::size_t i = 0; i < env.wire_joints.size(); ++i) {
+        const float ang_after = world.GetServoJointAngle(env.wire_joints[i]);
+        rsp.joint_angles[i] = ang_after;
+        // Joint angles are wrapped; unwrap delta first so crossing +/-pi does not
+        // produce a false ~2pi jump in one sample.
+        const float delta = WrapAngleRad(ang_after - env.prev_angles[i]);
+        rsp.joint_velocities[i] = delta * inv_dt;
+        env.prev_angles[i] = ang_after;
+    }
+
+    const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::PackResponse));
+    FillFootContactsFromManifolds(world, env.scene, rsp.foot_contacts, rsp.foot_contact_normals);
+    FillObstacleFootprints(world, env.obstacle_body_ids, rsp);
+    RefreshMatrixLidarFrame(env, serve_profiler, rsp, step.dt_seconds, true);
+    (void)scope;
+}
+
+std::uint16_t ServeMessageEnvIndex(const ServeInboundPayload& payload) {
+    return std::visit([](const auto& message) { return message.env_index; }, payload);
+}
+
 } // namespace
 
 int RunPhysicsServeMode(std::uint16_t listen_port,
@@ -1006,7 +1278,11 @@ int RunPhysicsServeMode(std::uint16_t listen_port,
                         int preview_udp_port,
                         const std::string& scene_file,
                         int preview_emit_stride,
-                        ResourceMonitoringMode resource_monitoring_mode) {
+                        ResourceMonitoringMode resource_monitoring_mode,
+                        int solver_threads,
+                        int env_count,
+                        int env_threads,
+                        int lidar_threads) {
     const int fd = OpenUdpSocketWithRetry();
     if (fd < 0) {
         std::cerr << "[serve] socket() failed\n";
@@ -1043,73 +1319,43 @@ int RunPhysicsServeMode(std::uint16_t listen_port,
         return 1;
     }
 
-    World world(Vec3{0.0f, -9.81f, 0.0f});
-    world.SetResourceMonitoringMode(resource_monitoring_mode);
-    HexapodSceneObjects scene = BuildHexapodScene(world);
-    RelaxBuiltInHexapodServos(world, scene);
-    int solver_iterations = 8;
-    AssimilationState assimilation_state{};
-    TerrainPatchConfig terrain_config{};
-    TerrainPatchSeed terrain_seed{};
-
-    if (!scene_file.empty()) {
-        std::string error;
-        int appended_joints = 0;
-        if (!AppendWorldFromMinphysSceneJsonFile(
-                scene_file, world, solver_iterations, error, &appended_joints, &terrain_config, &terrain_seed)) {
-            std::cerr << "[serve] failed to append scene file '" << scene_file << "': " << error << "\n";
+    const std::size_t environment_count =
+        std::min<std::size_t>(static_cast<std::size_t>(std::max(env_count, 1)), kServeMaxEnvironments);
+    std::vector<std::unique_ptr<ServeEnvironment>> environments;
+    environments.reserve(environment_count);
+    for (std::size_t env_index = 0; env_index < environment_count; ++env_index) {
+        auto env = std::make_unique<ServeEnvironment>();
+        if (!BuildServeEnvironment(*env, scene_file, resource_monitoring_mode, solver_threads, env_index == 0)) {
             ::close(wake_pipe[0]);
             ::close(wake_pipe[1]);
             ::close(fd);
             return 1;
         }
-        std::cout << "[serve] appended scene file '" << scene_file << "' joints=" << appended_joints << "\n";
-    }
-
-    TerrainPatch terrain_patch{terrain_config};
-    const Vec3 initial_center = world.GetBody(scene.body).position;
-    const Vec3 patch_center = terrain_seed.has_center ? terrain_seed.center : initial_center;
-    const float plane_height = terrain_seed.has_plane_height ? terrain_seed.plane_height_m : world.GetBody(scene.plane).planeOffset;
-    const Vec3 plane_normal = terrain_seed.has_plane_normal ? terrain_seed.plane_normal : world.GetBody(scene.plane).planeNormal;
-    terrain_patch.initialize(world, patch_center, plane_height, plane_normal);
-    SyncTerrainHeightfield(world, terrain_patch);
-
-    if (const char* no_contact_env = std::getenv("MINPHYS_HEXAPOD_NO_CONTACT_TEST");
-        no_contact_env != nullptr && no_contact_env[0] != '\0' && no_contact_env[0] != '0') {
-        world.SetGravity(Vec3{0.0f, 0.0f, 0.0f});
-        world.ClearTerrainHeightfield();
-        // Keep normal robot self-collision active to expose internal instability.
-        // "No contact" here means no terrain/ground contacts.
-        std::cout << "[serve] MINPHYS_HEXAPOD_NO_CONTACT_TEST enabled (zero-g + terrain contacts disabled, self-collision enabled)\n";
-    }
-
-    const std::vector<std::uint32_t> obstacle_body_ids = CollectObstacleBodyIds(world, scene);
-
-    JointSolverConfig joint_cfg = world.GetJointSolverConfig();
-    joint_cfg.servoPositionPasses = 8;
-    joint_cfg.hingeAnchorBiasFactor = 0.25f;
-    joint_cfg.hingeAnchorDampingFactor = 0.3f;
-    world.SetJointSolverConfig(joint_cfg);
-    world.SetBodyVelocityLimits(5.0f, 15.0f);
-
-    if (const char* disable_pre_corr = std::getenv("MINPHYS_DISABLE_VELOCITY_PRECORR");
-        disable_pre_corr != nullptr && disable_pre_corr[0] != '\0' && disable_pre_corr[0] != '0') {
-        auto articulation_cfg = world.GetArticulationConfig();
-        articulation_cfg.enableVelocityPreCorrection = false;
-        articulation_cfg.enableVelocityPreCorrectionFullForwardPass = false;
-        articulation_cfg.enableVelocityPreCorrectionChassisCoupling = false;
-        articulation_cfg.enableVelocityPreCorrectionChassisArticulatedTree = false;
-        world.SetArticulationConfig(articulation_cfg);
-        std::cout << "[serve] MINPHYS_DISABLE_VELOCITY_PRECORR enabled\n";
+        environments.push_back(std::move(env));
+    }
+    // Preview, resource snapshots and telemetry follow environment 0.
+    ServeEnvironment& primary = *environments.front();
+
+    // LiDAR tiles of whichever environment is scanning fan out over this pool; concurrent scans
+    // from several environments take turns (`WorkerPool::ParallelFor` serialises callers).
+    std::unique_ptr<core_internal::WorkerPool> lidar_pool{};
+    if (lidar_threads > 1) {
+        lidar_pool = std::make_unique<core_internal::WorkerPool>(static_cast<std::size_t>(lidar_threads));
+        for (const std::unique_ptr<ServeEnvironment>& env : environments) {
+            env->lidar_pool = lidar_pool.get();
+        }
     }
 
-    const std::array<std::uint32_t, 18> wire_joints = ServoJointIdsInWireOrder(scene);
-    std::array<float, 18> prev_angles{};
-    for (std::size_t i = 0; i < wire_joints.size(); ++i) {
-        prev_angles[i] = world.GetServoJointAngle(wire_joints[i]);
+    // Steps for distinct environments that are queued together run as one batch on this pool.
+    const std::size_t requested_env_threads = env_threads > 0
+        ? static_cast<std::size_t>(env_threads)
+        : std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    const std::size_t env_step_threads = std::min(environment_count, requested_env_threads);
+    std::unique_ptr<core_internal::WorkerPool> env_pool{};
+    if (env_step_threads > 1) {
+        env_pool = std::make_unique<core_internal::WorkerPool>(env_step_threads);
     }
 
-    bool configured = false;
     AsyncPreviewCounters preview_counters{};
     std::shared_ptr<FrameSink> preview_visual{};
     std::unique_ptr<AsyncPreviewDispatcher> preview_dispatcher{};
@@ -1119,77 +1365,9 @@ int RunPhysicsServeMode(std::uint16_t listen_port,
     std::uint64_t preview_step_counter = 0;
 
     ProcessResourceDiagnosticsState resource_diag{};
-    resource_monitoring::SectionProfiler<kServeSectionLabels.size()> serve_profiler{kServeSectionLabels};
+    ServeProfiler serve_profiler{kServeSectionLabels};
     ConfigureServeProfiler(serve_profiler, resource_monitoring_mode);
 
-    CachedMatrixLidarFrame cached_lidar_frame{};
-    std::uint64_t lidar_sim_time_us = 0;
-    std::uint64_t next_lidar_capture_us = 0;
-
-    auto refreshMatrixLidarFrame = [&](physics_sim::StateResponse& rsp,
-                                       const Body& chassis,
-                                       const float fusion_age_seconds,
-                                       const bool advance_sensor_time) {
-        if (advance_sensor_time && std::isfinite(fusion_age_seconds) && fusion_age_seconds > 0.0f) {
-            lidar_sim_time_us += static_cast<std::uint64_t>(
-                std::llround(static_cast<double>(fusion_age_seconds) * 1.0e6));
-        }
-
-        const bool need_capture = !cached_lidar_frame.valid || lidar_sim_time_us >= next_lidar_capture_us;
-        if (!need_capture) {
-            writeCachedMatrixLidarFrame(cached_lidar_frame, rsp);
-            return;
-        }
-
-        {
-            const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::MatrixLidarScan));
-            FillSimMatrixLidar64x8(world, scene, terrain_patch, chassis, rsp);
-            (void)scope;
-        }
-        rsp.matrix_lidar_timestamp_us = lidar_sim_time_us == 0 ? 1ULL : lidar_sim_time_us;
-
-        if (terrain_patch.config().lidar_fusion_enable) {
-            std::vector<TerrainSample> lidar_samples;
-            {
-                const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::MatrixLidarFusion));
-                AppendMatrixLidarTerrainSamples(
-                    world, scene, terrain_patch, chassis, rsp, terrain_patch.config(), lidar_samples);
-                ApplyContactArbitrationToLidarSamples(
-                    world, scene, assimilation_state, terrain_patch.config(), lidar_samples);
-                (void)scope;
-            }
-            if (!lidar_samples.empty()) {
-                Body& plane_body = world.GetBody(scene.plane);
-                // LiDAR fusion intentionally follows response generation: the response reports what this
-                // step saw, and the fused terrain influences subsequent contacts/rays.
-                const auto scope =
-                    serve_profiler.scope(static_cast<std::size_t>(ServeSection::TerrainPatchUpdate));
-                terrain_patch.update(world,
-                                     world.GetBody(scene.body).position,
-                                     plane_body.planeOffset,
-                                     plane_body.planeNormal,
-                                     lidar_samples,
-                                     fusion_age_seconds);
-                SyncTerrainHeightfield(world, terrain_patch);
-                (void)scope;
-            }
-        }
-
-        cached_lidar_frame.valid = true;
-        cached_lidar_frame.timestamp_us = rsp.matrix_lidar_timestamp_us;
-        cached_lidar_frame.model = static_cast<std::uint8_t>(rsp.matrix_lidar_model);
-        cached_lidar_frame.cols = rsp.matrix_lidar_cols;
-        cached_lidar_frame.rows = rsp.matrix_lidar_rows;
-        cached_lidar_frame.ranges_mm = rsp.matrix_lidar_ranges_mm;
-
-        if (next_lidar_capture_us == 0) {
-            next_lidar_capture_us = kMatrixLidarFramePeriodUs;
-        }
-        while (next_lidar_capture_us <= lidar_sim_time_us) {
-            next_lidar_capture_us += kMatrixLidarFramePeriodUs;
-        }
-    };
-
     if (preview_sink == SinkKind::Udp) {
         preview_visual = std::shared_ptr<FrameSink>(MakeFrameSink(preview_sink, preview_udp_host, preview_udp_port).release());
         preview_dispatcher = std::make_unique<AsyncPreviewDispatcher>(
@@ -1213,6 +1391,12 @@ int RunPhysicsServeMode(std::uint16_t listen_port,
     }
 
     std::cout << "[hexapod-physics-sim] serve mode UDP *:" << listen_port;
+    if (environment_count > 1) {
+        std::cout << "  envs=" << environment_count << "  env_threads=" << env_step_threads;
+    }
+    if (lidar_pool != nullptr) {
+        std::cout << "  lidar_threads=" << lidar_threads;
+    }
     if (preview_dispatcher != nullptr) {
         std::cout << "  preview UDP -> " << preview_udp_host << ":" << preview_udp_port;
         if (preview_stride > 1) {
@@ -1240,9 +1424,9 @@ int RunPhysicsServeMode(std::uint16_t listen_port,
             ? resource_monitoring::formatResourceSectionSummary(serve_profiler.topSections(10))
             : "disabled";
         const std::string world_sections_summary = sections_enabled
-            ? resource_monitoring::formatResourceSectionSummary(world.SnapshotResourceSections())
+            ? resource_monitoring::formatResourceSectionSummary(primary.world.SnapshotResourceSections())
             : "disabled";
-        const auto topology = world.SnapshotTopology();
+        const auto topology = primary.world.SnapshotTopology();
         std::fprintf(stdout,
                      "%s process_resource=%s serve_sections=%s world_sections=%s topology={bodies=%u dynamic=%u awake=%u contacts=%u manifolds=%u islands=%u max_island_bodies=%u max_island_manifolds=%u max_island_joints=%u max_island_servos=%u} preview={enqueued=%llu sent=%llu dropped=%llu} terrain={adds=%llu cells=%llu emitted=%llu merges=%llu cache_hits=%llu dirty=%llu} face4={attempted=%llu used=%llu fallback_block2=%llu fallback_scalar=%llu blocked_coherence=%llu}\n",
                      prefix,
@@ -1263,17 +1447,17 @@ int RunPhysicsServeMode(std::uint16_t listen_port,
                      static_cast<unsigned long long>(preview_counters.sent.load(std::memory_order_relaxed)),
                      static_cast<unsigned long long>(preview_counters.dropped.load(std::memory_order_relaxed)),
 #if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
-                     static_cast<unsigned long long>(world.GetSolverTelemetry().terrainContactAdds),
-                     static_cast<unsigned long long>(world.GetSolverTelemetry().terrainCellsTested),
-                     static_cast<unsigned long long>(world.GetSolverTelemetry().terrainContactsEmitted),
-                     static_cast<unsigned long long>(world.GetSolverTelemetry().terrainManifoldMerges),
-                     static_cast<unsigned long long>(world.GetSolverTelemetry().terrainCacheHits),
-                     static_cast<unsigned long long>(world.GetSolverTelemetry().terrainDirtyCellRefreshes),
-                     static_cast<unsigned long long>(world.GetSolverTelemetry().face4Attempted),
-                     static_cast<unsigned long long>(world.GetSolverTelemetry().face4Used),
-                     static_cast<unsigned long long>(world.GetSolverTelemetry().face4FallbackToBlock2),
-                     static_cast<unsigned long long>(world.GetSolverTelemetry().face4FallbackToScalar),
-                     static_cast<unsigned long long>(world.GetSolverTelemetry().face4BlockedByFrictionCoherenceGate)
+                     static_cast<unsigned long long>(primary.world.GetSolverTelemetry().terrainContactAdds),
+                     static_cast<unsigned long long>(primary.world.GetSolverTelemetry().terrainCellsTested),
+                     static_cast<unsigned long long>(primary.world.GetSolverTelemetry().terrainContactsEmitted),
+                     static_cast<unsigned long long>(primary.world.GetSolverTelemetry().terrainManifoldMerges),
+                     static_cast<unsigned long long>(primary.world.GetSolverTelemetry().terrainCacheHits),
+                     static_cast<unsigned long long>(primary.world.GetSolverTelemetry().terrainDirtyCellRefreshes),
+                     static_cast<unsigned long long>(primary.world.GetSolverTelemetry().face4Attempted),
+                     static_cast<unsigned long long>(primary.world.GetSolverTelemetry().face4Used),
+                     static_cast<unsigned long long>(primary.world.GetSolverTelemetry().face4FallbackToBlock2),
+                     static_cast<unsigned long long>(primary.world.GetSolverTelemetry().face4FallbackToScalar),
+                     static_cast<unsigned long long>(primary.world.GetSolverTelemetry().face4BlockedByFrictionCoherenceGate)
 #else
                      0ULL,
                      0ULL,
@@ -1421,177 +1605,147 @@ int RunPhysicsServeMode(std::uint16_t listen_port,
         }
     });
 
+    struct PendingServeStep {
+        ServePeerAddress peer{};
+        physics_sim::StepCommand command{};
+    };
+    std::vector<ServeInboundMessage> inbound_batch{};
+    std::vector<PendingServeStep> pending_steps{};
+    pending_steps.reserve(environment_count);
+    std::vector<physics_sim::StateResponse> step_responses(environment_count);
+    std::vector<std::uint8_t> env_step_pending(environment_count, 0u);
     physics_sim::StateResponse rsp{};
-    for (;;) {
-        ServeInboundMessage inbound{};
-        if (!inbound_queue.waitPopFor(inbound, std::chrono::milliseconds(100), shutdown_requested)) {
-            if (shutdown_requested.load(std::memory_order_acquire) && inbound_queue.empty()) {
-                break;
-            }
-            logResourceSnapshot();
-            continue;
-        }
+    bool reported_unknown_env = false;
 
-        if (const auto* cmd = std::get_if<physics_sim::ConfigCommand>(&inbound.payload)) {
-            {
-                const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::ApplyConfig));
-                world.SetGravity(Vec3{(*cmd).gravity[0], (*cmd).gravity[1], (*cmd).gravity[2]});
-                solver_iterations = (*cmd).solver_iterations > 0 ? (*cmd).solver_iterations : 8;
-                configured = true;
-                (void)scope;
+    // Runs the batched steps (at most one per environment, so each task owns its environment and
+    // response slot), then queues the replies in arrival order.
+    auto flushPendingSteps = [&]() {
+        if (pending_steps.empty()) {
+            return;
+        }
+        const auto stepSlot = [&](std::size_t slot) {
+            const physics_sim::StepCommand& command = pending_steps[slot].command;
+            StepServeEnvironment(*environments[command.env_index], command, serve_profiler, step_responses[slot]);
+        };
+        if (env_pool != nullptr && pending_steps.size() > 1) {
+            env_pool->ParallelFor(pending_steps.size(), stepSlot);
+        } else {
+            for (std::size_t slot = 0; slot < pending_steps.size(); ++slot) {
+                stepSlot(slot);
             }
-
-            physics_sim::ConfigAck ack{};
-            ack.message_type = static_cast<std::uint8_t>(physics_sim::MessageType::ConfigAck);
-            ack.body_count = world.GetBodyCount() - (world.HasTerrainHeightfield() ? 1u : 0u);
-            ack.joint_count = world.GetServoJointCount();
-            outbound_queue.push(PackServeOutboundPacket(inbound.peer, ack, physics_sim::kConfigAckBytes));
-            (void)WakeIoThread(wake_pipe[1]);
-            logResourceSnapshot();
-            continue;
         }
 
-        if (const auto* correction = std::get_if<physics_sim::StateCorrection>(&inbound.payload)) {
-            {
-                const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::ApplyCorrection));
-                (void)ApplyStateCorrection(world, scene, *correction, assimilation_state, terrain_patch, &serve_profiler);
-                (void)scope;
+        for (std::size_t slot = 0; slot < pending_steps.size(); ++slot) {
+            const PendingServeStep& pending = pending_steps[slot];
+            const std::uint16_t env_index = pending.command.env_index;
+            env_step_pending[env_index] = 0u;
+            outbound_queue.push(PackServeOutboundPacket(pending.peer, step_responses[slot], physics_sim::kStateResponseBytes));
+            if (env_index != 0) {
+                continue;
+            }
+            preview_sim_time_s += pending.command.dt_seconds;
+            const bool emit_preview =
+                preview_dispatcher != nullptr
+                && (preview_stride <= 1
+                    || (preview_step_counter % static_cast<std::uint64_t>(preview_stride) == 0ULL));
+            ++preview_step_counter;
+            if (emit_preview) {
+                preview_dispatcher->submit(BuildPreviewFrameSnapshot(preview_frame,
+                                                                     preview_sim_time_s,
+                                                                     primary.terrain_patch,
+                                                                     primary.world,
+                                                                     primary.scene,
+                                                                     primary.obstacle_body_ids));
+                ++preview_frame;
             }
-            cached_lidar_frame.valid = false;
-            lidar_sim_time_us = std::max(lidar_sim_time_us + 1, next_lidar_capture_us);
-            logResourceSnapshot();
-            continue;
         }
+        (void)WakeIoThread(wake_pipe[1]);
+        pending_steps.clear();
+    };
 
-        const auto* step = std::get_if<physics_sim::StepCommand>(&inbound.payload);
-        if (step == nullptr) {
+    for (;;) {
+        ServeInboundMessage inbound{};
+        if (!inbound_queue.waitPopFor(inbound, std::chrono::milliseconds(100), shutdown_requested)) {
+            if (shutdown_requested.load(std::memory_order_acquire) && inbound_queue.empty()) {
+                break;
+            }
             logResourceSnapshot();
             continue;
         }
-        if (!configured) {
-            logResourceSnapshot();
-            continue;
+        inbound_batch.clear();
+        inbound_batch.push_back(std::move(inbound));
+        while (inbound_queue.tryPop(inbound)) {
+            inbound_batch.push_back(std::move(inbound));
         }
 
-        if (step->sequence_id == 0) {
-            rsp = physics_sim::StateResponse{};
-            rsp.message_type = static_cast<std::uint8_t>(physics_sim::MessageType::StateResponse);
-            rsp.sequence_id = 0;
-
-            const Body& chassis = world.GetBody(scene.body);
-            rsp.body_position = {chassis.position.x, chassis.position.y, chassis.position.z};
-            rsp.body_orientation = {
-                chassis.orientation.w,
-                chassis.orientation.x,
-                chassis.orientation.y,
-                chassis.orientation.z,
-            };
-            rsp.body_linear_velocity = {chassis.velocity.x, chassis.velocity.y, chassis.velocity.z};
-            rsp.body_angular_velocity = {
-                chassis.angularVelocity.x,
-                chassis.angularVelocity.y,
-                chassis.angularVelocity.z,
-            };
-            for (std::size_t i = 0; i < wire_joints.size(); ++i) {
-                rsp.joint_angles[i] = world.GetServoJointAngle(wire_joints[i]);
-                rsp.joint_velocities[i] = 0.0f;
+        for (const ServeInboundMessage& message : inbound_batch) {
+            const std::uint16_t env_index = ServeMessageEnvIndex(message.payload);
+            if (env_index >= environment_count) {
+                if (!reported_unknown_env) {
+                    std::cerr << "[serve] dropping message for env_index " << env_index << " (serving "
+                              << environment_count << " environment(s))\n";
+                    reported_unknown_env = true;
+                }
+                continue;
             }
-            {
-                const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::PackResponse));
-                FillFootContactsFromManifolds(world, scene, rsp.foot_contacts, rsp.foot_contact_normals);
-                FillObstacleFootprints(world, obstacle_body_ids, rsp);
-                refreshMatrixLidarFrame(rsp, world.GetBody(scene.body), 0.0f, false);
-                (void)scope;
+            ServeEnvironment& env = *environments[env_index];
+            // Messages for one environment are handled in arrival order: anything behind a batched
+            // step of the same environment waits for the batch.
+            if (env_step_pending[env_index] != 0u) {
+                flushPendingSteps();
             }
-            outbound_queue.push(PackServeOutboundPacket(inbound.peer, rsp, physics_sim::kStateResponseBytes));
-            (void)WakeIoThread(wake_pipe[1]);
-            logResourceSnapshot();
-            continue;
-        }
 
-        if (step->dt_seconds <= 0.0f || !std::isfinite(step->dt_seconds)) {
-            logResourceSnapshot();
-            continue;
-        }
+            if (const auto* cmd = std::get_if<physics_sim::ConfigCommand>(&message.payload)) {
+                {
+                    const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::ApplyConfig));
+                    env.world.SetGravity(Vec3{(*cmd).gravity[0], (*cmd).gravity[1], (*cmd).gravity[2]});
+                    env.solver_iterations = (*cmd).solver_iterations > 0 ? (*cmd).solver_iterations : 8;
+                    env.configured = true;
+                    (void)scope;
+                }
 
-        {
-            const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::ApplyJointTargets));
-            for (std::size_t i = 0; i < wire_joints.size(); ++i) {
-                ServoJoint& sj = world.GetServoJointMutable(wire_joints[i]);
-                sj.targetAngle = step->joint_targets[i];
+                physics_sim::ConfigAck ack{};
+                ack.message_type = static_cast<std::uint8_t>(physics_sim::MessageType::ConfigAck);
+                ack.body_count = env.world.GetBodyCount() - (env.world.HasTerrainHeightfield() ? 1u : 0u);
+                ack.joint_count = env.world.GetServoJointCount();
+                ack.env_index = env_index;
+                outbound_queue.push(PackServeOutboundPacket(message.peer, ack, physics_sim::kConfigAckBytes));
+                (void)WakeIoThread(wake_pipe[1]);
+                continue;
             }
-            (void)scope;
-        }
 
-        for (std::size_t i = 0; i < wire_joints.size(); ++i) {
-            prev_angles[i] = world.GetServoJointAngle(wire_joints[i]);
-        }
-
-        const int physics_substeps = std::clamp(
-            static_cast<int>(std::ceil(step->dt_seconds / kServeMaxPhysicsSubstepSeconds)),
-            1,
-            kServeMaxPhysicsSubsteps);
-        const float substep_dt = step->dt_seconds / static_cast<float>(physics_substeps);
-        {
-            const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::PhysicsStep));
-            for (int substep_index = 0; substep_index < physics_substeps; ++substep_index) {
-                world.Step(substep_dt, solver_iterations);
+            if (const auto* correction = std::get_if<physics_sim::StateCorrection>(&message.payload)) {
+                {
+                    const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::ApplyCorrection));
+                    (void)ApplyStateCorrection(
+                        env.world, env.scene, *correction, env.assimilation_state, env.terrain_patch, &serve_profiler);
+                    (void)scope;
+                }
+                env.cached_lidar_frame.valid = false;
+                env.lidar_sim_time_us = std::max(env.lidar_sim_time_us + 1, env.next_lidar_capture_us);
+                continue;
             }
-            (void)scope;
-        }
 
-        rsp = physics_sim::StateResponse{};
-        rsp.message_type = static_cast<std::uint8_t>(physics_sim::MessageType::StateResponse);
-        rsp.sequence_id = step->sequence_id;
-
-        const Body& chassis = world.GetBody(scene.body);
-        rsp.body_position = {chassis.position.x, chassis.position.y, chassis.position.z};
-        rsp.body_orientation = {
-            chassis.orientation.w,
-            chassis.orientation.x,
-            chassis.orientation.y,
-            chassis.orientation.z,
-        };
-        rsp.body_linear_velocity = {chassis.velocity.x, chassis.velocity.y, chassis.velocity.z};
-        rsp.body_angular_velocity = {
-            chassis.angularVelocity.x,
-            chassis.angularVelocity.y,
-            chassis.angularVelocity.z,
-        };
-
-        const float inv_dt = 1.0f / step->dt_seconds;
-        for (std::size_t i = 0; i < wire_joints.size(); ++i) {
-            const float ang_after = world.GetServoJointAngle(wire_joints[i]);
-            rsp.joint_angles[i] = ang_after;
-            // Joint angles are wrapped; unwrap delta first so crossing +/-pi does not
-            // produce a false ~2pi jump in one sample.
-            const float delta = WrapAngleRad(ang_after - prev_angles[i]);
-            rsp.joint_velocities[i] = delta * inv_dt;
-            prev_angles[i] = ang_after;
-        }
+            const auto* step = std::get_if<physics_sim::StepCommand>(&message.payload);
+            if (step == nullptr || !env.configured) {
+                continue;
+            }
 
-        {
-            const auto scope = serve_profiler.scope(static_cast<std::size_t>(ServeSection::PackResponse));
-            FillFootContactsFromManifolds(world, scene, rsp.foot_contacts, rsp.foot_contact_normals);
-            FillObstacleFootprints(world, obstacle_body_ids, rsp);
-            refreshMatrixLidarFrame(rsp, world.GetBody(scene.body), step->dt_seconds, true);
-            (void)scope;
-        }
+            if (step->sequence_id == 0) {
+                PeekServeEnvironment(env, env_index, serve_profiler, rsp);
+                outbound_queue.push(PackServeOutboundPacket(message.peer, rsp, physics_sim::kStateResponseBytes));
+                (void)WakeIoThread(wake_pipe[1]);
+                continue;
+            }
 
-        outbound_queue.push(PackServeOutboundPacket(inbound.peer, rsp, physics_sim::kStateResponseBytes));
-        (void)WakeIoThread(wake_pipe[1]);
+            if (step->dt_seconds <= 0.0f || !std::isfinite(step->dt_seconds)) {
+                continue;
+            }
 
-        preview_sim_time_s += step->dt_seconds;
-        const bool emit_preview =
-            preview_dispatcher != nullptr
-            && (preview_stride <= 1
-                || (preview_step_counter % static_cast<std::uint64_t>(preview_stride) == 0ULL));
-        ++preview_step_counter;
-        if (emit_preview) {
-            preview_dispatcher->submit(
-                BuildPreviewFrameSnapshot(preview_frame, preview_sim_time_s, terrain_patch, world, scene, obstacle_body_ids));
-            ++preview_frame;
+            pending_steps.push_back(PendingServeStep{message.peer, *step});
+            env_step_pending[env_index] = 1u;
         }
+        flushPendingSteps();
 
         logResourceSnapshot();
     }
@@ -8,8 +8,15 @@
 
 namespace minphys3d::demo {
 
+/// Upper bound for `env_count` (each environment is a full hexapod world).
+inline constexpr int kServeMaxEnvironments = 1024;
+
 /// UDP serve loop: hexapod scene, step on StepCommand, reply with StateResponse.
 /// When `preview_sink` is `Udp`, each stepped frame is also sent as minphys scene UDP (OpenGL visualiser).
+/// `env_count` > 1 hosts that many independent copies of the scene; messages are routed by their
+/// `env_index`, and queued steps for distinct environments are stepped in parallel on
+/// `env_threads` threads (0 = hardware concurrency). Preview and resource logs follow environment 0.
+/// `lidar_threads` > 1 spreads each matrix LiDAR scan's ray packets over that many threads.
 /// Blocks until fatal socket error; returns non-zero on failure.
 int RunPhysicsServeMode(std::uint16_t listen_port,
                         SinkKind preview_sink = SinkKind::Dummy,
@@ -17,6 +24,10 @@ int RunPhysicsServeMode(std::uint16_t listen_port,
                         int preview_udp_port = 9870,
                         const std::string& scene_file = "",
                         int preview_emit_stride = 1,
-                        ResourceMonitoringMode resource_monitoring_mode = ResourceMonitoringMode::Full);
+                        ResourceMonitoringMode resource_monitoring_mode = ResourceMonitoringMode::Full,
+                        int solver_threads = 1,
+                        int env_count = 1,
+                        int env_threads = 0,
+                        int lidar_threads = 1);
 
 } // namespace minphys3d::demo
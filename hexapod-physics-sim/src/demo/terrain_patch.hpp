@@ -2,8 +2,12 @@
 
 // TerrainPatch: local height field (belief surface) over XZ with optional physics
 // collision cache. LiDAR / RaycastWorld use bilinear SampleHeightWorld; collision uses
-// the same field directly with an optional conservative top layer near steps.
+// the same field directly with an optional conservative top layer near steps. Heights live in a
+// TerrainHeightfieldBuffer shared with World, so syncing the physics attachment copies nothing and
+// only the tiles an update actually changed are re-stamped.
 
+#include "demo/terrain_tile_store.hpp"
+#include "minphys3d/core/terrain_heightfield.hpp"
 #include "minphys3d/core/world.hpp"
 #include "minphys3d/math/vec3.hpp"
 
@@ -12,7 +16,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
-#include <unordered_map>
+#include <memory>
 #include <vector>
 
 namespace minphys3d::demo {
@@ -72,15 +76,21 @@ public:
     Vec3 grid_origin_world() const { return {grid_world_origin_x_, 0.0, grid_world_origin_z_}; }
     const Vec3& last_normal() const { return last_normal_; }
     Real last_plane_height_m() const { return last_plane_height_m_; }
-    const std::vector<float>& surface_heights_m() const { return surface_heights_; }
+    const std::vector<float>& surface_heights_m() const { return heightfield_.buffer->SurfaceHeights(); }
     const std::vector<float>& confidences() const { return confidences_; }
     /// Populated when use_conservative_collision; same layout as surface_heights_m.
-    const std::vector<float>& collision_heights_m() const { return collision_heights_; }
-    bool has_collision_layer() const { return config_.use_conservative_collision && !collision_heights_.empty(); }
+    const std::vector<float>& collision_heights_m() const { return heightfield_.buffer->RawCollisionHeights(); }
+    bool has_collision_layer() const {
+        return config_.use_conservative_collision && !heightfield_.buffer->RawCollisionHeights().empty();
+    }
+    /// Height buffer written in place by update(); tile revisions track which cells changed.
+    std::shared_ptr<const TerrainHeightfieldBuffer> heightfield() const { return heightfield_.buffer; }
+    /// Attachment referencing heightfield() rather than copying it; cheap enough to rebuild and
+    /// re-attach after every update.
     World::TerrainHeightfieldAttachment BuildTerrainHeightfieldAttachment() const {
         World::TerrainHeightfieldAttachment attachment{};
         attachment.enabled = initialized_ && config_.rows > 1 && config_.cols > 1
-            && surface_heights_.size() == static_cast<std::size_t>(config_.rows * config_.cols);
+            && surface_heights_m().size() == static_cast<std::size_t>(config_.rows * config_.cols);
         attachment.rows = config_.rows;
         attachment.cols = config_.cols;
         attachment.cellSizeM = config_.cell_size_m;
@@ -90,10 +100,7 @@ public:
         attachment.planeHeightM = last_plane_height_m_;
         attachment.baseHeightM = base_height_m_;
         attachment.useConservativeCollision = config_.use_conservative_collision;
-        attachment.surfaceHeightsM = surface_heights_;
-        if (has_collision_layer()) {
-            attachment.collisionHeightsM = collision_heights_;
-        }
+        attachment.sharedHeights = heightfield_.buffer;
         return attachment;
     }
 
@@ -120,9 +127,12 @@ public:
 
         const std::size_t cell_count = static_cast<std::size_t>(config_.rows * config_.cols);
         body_ids_.clear();
-        surface_heights_.assign(cell_count, plane_height_m);
+        TerrainHeightfieldBuffer& heightfield = *heightfield_.buffer;
+        heightfield.Reset(config_.rows, config_.cols, static_cast<float>(plane_height_m));
+        if (config_.use_conservative_collision) {
+            heightfield.RawCollisionHeights().assign(cell_count, static_cast<float>(plane_height_m));
+        }
         confidences_.assign(cell_count, config_.plane_confidence);
-        collision_heights_.assign(cell_count, plane_height_m);
         initialized_ = true;
     }
 
@@ -150,6 +160,7 @@ public:
         const Real xmin_new = center_world_.x - half_span_x;
         const Real zmin_new = center_world_.z - half_span_z;
 
+        bool scrolled = false;
         if (config_.scroll_world_fixed) {
             if (!scroll_state_valid_) {
                 grid_world_origin_x_ = xmin_new;
@@ -160,6 +171,7 @@ public:
                 const int d_row = static_cast<int>(std::lround((zmin_new - grid_world_origin_z_) / config_.cell_size_m));
                 if (d_col != 0 || d_row != 0) {
                     ScrollBlitHeights(d_col, d_row, xmin_new, zmin_new, plane_height_m, center, normal, samples);
+                    scrolled = true;
                 }
                 grid_world_origin_x_ = xmin_new;
                 grid_world_origin_z_ = zmin_new;
@@ -172,12 +184,19 @@ public:
         const Real age_decay = ComputeAgeDecay(age_seconds);
         const Real blend = ComputeBlend(age_decay);
 
-        std::vector<std::vector<std::size_t>> cell_sample_lists;
-        std::vector<const std::vector<std::size_t>*> cell_sample_buckets;
-        if (config_.use_sample_binning && samples.size() >= 8) {
-            FillSampleBinsForCells(samples, cell_sample_lists, cell_sample_buckets);
+        const bool use_bins = config_.use_sample_binning && samples.size() >= 8;
+        if (use_bins) {
+            FillSampleBinsForCells(samples);
         }
 
+        // Bounding rectangle of cells whose stored height moved; only the tiles it overlaps are
+        // re-stamped in the shared buffer.
+        TerrainHeightfieldBuffer& heightfield = *heightfield_.buffer;
+        std::vector<float>& surface = heightfield.SurfaceHeights();
+        int dirty_row0 = config_.rows;
+        int dirty_row1 = -1;
+        int dirty_col0 = config_.cols;
+        int dirty_col1 = -1;
         Real min_height = std::numeric_limits<Real>::infinity();
         for (int row = 0; row < config_.rows; ++row) {
             for (int col = 0; col < config_.cols; ++col) {
@@ -185,14 +204,20 @@ public:
                 const Real z = grid_world_origin_z_ + static_cast<float>(row) * config_.cell_size_m;
 
                 const Real target_height =
-                    SampleTargetHeightBinned(center_world_, last_normal_, plane_height_m, x, z, samples, cell_sample_buckets);
-                const Real target_confidence =
-                    SampleTargetConfidenceBinned(samples, x, z, cell_sample_buckets);
+                    SampleTargetHeightBinned(center_world_, last_normal_, plane_height_m, x, z, samples, use_bins);
+                const Real target_confidence = SampleTargetConfidenceBinned(samples, x, z, use_bins);
                 const std::size_t idx = Index(row, col);
 
-                surface_heights_[idx] = surface_heights_[idx] * (1.0 - blend) + target_height * blend;
+                const float previous_height = surface[idx];
+                surface[idx] = surface[idx] * (1.0 - blend) + target_height * blend;
                 confidences_[idx] = confidences_[idx] * (1.0 - blend) + target_confidence * blend;
-                min_height = std::min(min_height, static_cast<Real>(surface_heights_[idx]));
+                min_height = std::min(min_height, static_cast<Real>(surface[idx]));
+                if (std::abs(surface[idx] - previous_height) > 1.0e-6f) {
+                    dirty_row0 = std::min(dirty_row0, row);
+                    dirty_row1 = std::max(dirty_row1, row);
+                    dirty_col0 = std::min(dirty_col0, col);
+                    dirty_col1 = std::max(dirty_col1, col);
+                }
             }
         }
 
@@ -201,12 +226,27 @@ public:
         }
         base_height_m_ = min_height - config_.base_margin_m;
 
+        std::vector<float>& collision = heightfield.RawCollisionHeights();
+        const bool had_collision_layer = !collision.empty();
+        bool full_refresh = scrolled;
         if (config_.use_conservative_collision) {
-            collision_heights_.resize(surface_heights_.size());
-            for (int row = 0; row < config_.rows; ++row) {
-                for (int col = 0; col < config_.cols; ++col) {
+            // A changed cell moves the 3x3 max of its neighbours, so the dirty rectangle grows by one.
+            dirty_row0 = std::max(dirty_row0 - 1, 0);
+            dirty_row1 = std::min(dirty_row1 + 1, config_.rows - 1);
+            dirty_col0 = std::max(dirty_col0 - 1, 0);
+            dirty_col1 = std::min(dirty_col1 + 1, config_.cols - 1);
+            if (collision.size() != surface.size()) {
+                collision.resize(surface.size());
+                full_refresh = true;
+            }
+            const int row_begin = full_refresh ? 0 : dirty_row0;
+            const int row_end = full_refresh ? config_.rows - 1 : dirty_row1;
+            const int col_begin = full_refresh ? 0 : dirty_col0;
+            const int col_end = full_refresh ? config_.cols - 1 : dirty_col1;
+            for (int row = row_begin; row <= row_end; ++row) {
+                for (int col = col_begin; col <= col_end; ++col) {
                     const std::size_t idx = Index(row, col);
-                    Real mx = surface_heights_[idx];
+                    Real mx = surface[idx];
                     for (int dr = -1; dr <= 1; ++dr) {
                         for (int dc = -1; dc <= 1; ++dc) {
                             const int nr = row + dr;
@@ -214,14 +254,21 @@ public:
                             if (nr < 0 || nr >= config_.rows || nc < 0 || nc >= config_.cols) {
                                 continue;
                             }
-                            mx = std::max(mx, static_cast<Real>(surface_heights_[Index(nr, nc)]));
+                            mx = std::max(mx, static_cast<Real>(surface[Index(nr, nc)]));
                         }
                     }
-                    collision_heights_[idx] = mx;
+                    collision[idx] = mx;
                 }
             }
         } else {
-            collision_heights_.clear();
+            collision.clear();
+            full_refresh = full_refresh || had_collision_layer;
+        }
+
+        if (full_refresh) {
+            heightfield.MarkAllDirty();
+        } else {
+            heightfield.MarkDirty(dirty_row0, dirty_row1, dirty_col0, dirty_col1);
         }
     }
 
@@ -232,7 +279,8 @@ public:
 
     /// Bilinear height and confidence at (x,z) for planner / diagnostics.
     Real SampleHeightAndConfidenceWorld(Real x, Real z, Real* out_confidence) const {
-        if (!initialized_ || config_.rows <= 0 || config_.cols <= 0 || surface_heights_.empty()) {
+        const std::vector<float>& surface_heights = surface_heights_m();
+        if (!initialized_ || config_.rows <= 0 || config_.cols <= 0 || surface_heights.empty()) {
             if (out_confidence != nullptr) {
                 *out_confidence = 0.0;
             }
@@ -247,10 +295,10 @@ public:
         const Real tx = coord.tx;
         const Real tz = coord.tz;
 
-        const Real h00 = surface_heights_[Index(z0, x0)];
-        const Real h10 = surface_heights_[Index(z0, x1)];
-        const Real h01 = surface_heights_[Index(z1, x0)];
-        const Real h11 = surface_heights_[Index(z1, x1)];
+        const Real h00 = surface_heights[Index(z0, x0)];
+        const Real h10 = surface_heights[Index(z0, x1)];
+        const Real h01 = surface_heights[Index(z1, x0)];
+        const Real h11 = surface_heights[Index(z1, x1)];
         const Real hx0 = h00 * (1.0 - tx) + h10 * tx;
         const Real hx1 = h01 * (1.0 - tx) + h11 * tx;
         const Real h = hx0 * (1.0 - tz) + hx1 * tz;
@@ -273,14 +321,43 @@ public:
         const Real h_r = SampleHeightWorld(x + delta, z);
         const Real h_d = SampleHeightWorld(x, z - delta);
         const Real h_u = SampleHeightWorld(x, z + delta);
-        Vec3 n{h_l - h_r, 2.0 * delta, h_d - h_u};
+        Vec3 n{h_l - h_r, Real(2) * delta, h_d - h_u};
         if (!TryNormalize(n, n)) {
             return {0.0, 1.0, 0.0};
         }
         return n;
     }
 
+    /// Optional pre-authored terrain (not owned) that answers rays the belief patch cannot:
+    /// everything beyond the patch footprint, at the store's fine or LOD resolution.
+    void set_far_field(const TerrainTileStore* far_field) { far_field_ = far_field; }
+    const TerrainTileStore* far_field() const { return far_field_; }
+
+    /// Belief-patch raycast, continued into the far field (when set) past the patch footprint.
     bool RaycastWorld(const Vec3& origin, const Vec3& dir_unit, Real& t_out) const {
+        if (RaycastPatch(origin, dir_unit, t_out)) {
+            return true;
+        }
+        if (far_field_ == nullptr) {
+            return false;
+        }
+        Real t_min = 0.0;
+        const Vec3 d = Normalize(dir_unit);
+        const Real xmin = grid_world_origin_x_;
+        const Real zmin = grid_world_origin_z_;
+        const Real xmax = xmin + static_cast<float>(config_.cols - 1) * config_.cell_size_m;
+        const Real zmax = zmin + static_cast<float>(config_.rows - 1) * config_.cell_size_m;
+        Real t_enter = 0.0;
+        Real t_exit = 0.0;
+        if (initialized_ && origin.x >= xmin && origin.x <= xmax && origin.z >= zmin && origin.z <= zmax &&
+            RaySlabEnterExitXz(origin, d, xmin, xmax, zmin, zmax, t_enter, t_exit)) {
+            t_min = t_exit;
+        }
+        return far_field_->RaycastWorld(origin, d, t_out, t_min);
+    }
+
+    /// Raycast against the belief patch only.
+    bool RaycastPatch(const Vec3& origin, const Vec3& dir_unit, Real& t_out) const {
         if (!initialized_) {
             return false;
         }
@@ -333,7 +410,7 @@ public:
         if (t_exit <= kEps) {
             return false;
         }
-        Real t = std::max(0.0, t_enter);
+        Real t = std::max<Real>(0.0, t_enter);
         if (t >= t_exit) {
             return false;
         }
@@ -369,7 +446,7 @@ public:
                 dt = t_exit - t;
             }
             Real t_end = std::min(t_exit, t + dt);
-            t_end = std::max(t_end, t + 1.0e-5);
+            t_end = std::max<Real>(t_end, t + 1.0e-5);
             Real analytic_hit = 0.0;
             if (FindBilinearCellHit(row, col, origin, d, cell_x0, cell_z0, t, t_end, analytic_hit)) {
                 t_out = analytic_hit;
@@ -390,11 +467,36 @@ private:
         Real tz{0.0};
     };
 
+    /// Owning handle to the shared height buffer. Copying a patch clones the buffer so two patches
+    /// never write the same storage a World may be reading.
+    struct HeightfieldHandle {
+        std::shared_ptr<TerrainHeightfieldBuffer> buffer{std::make_shared<TerrainHeightfieldBuffer>()};
+
+        HeightfieldHandle() = default;
+        HeightfieldHandle(const HeightfieldHandle& other)
+            : buffer(std::make_shared<TerrainHeightfieldBuffer>(*other.buffer)) {}
+        HeightfieldHandle& operator=(const HeightfieldHandle& other) {
+            if (this != &other) {
+                buffer = std::make_shared<TerrainHeightfieldBuffer>(*other.buffer);
+            }
+            return *this;
+        }
+    };
+
     TerrainPatchConfig config_{};
     std::vector<std::uint32_t> body_ids_{};
-    std::vector<float> surface_heights_{};
+    HeightfieldHandle heightfield_{};
+    const TerrainTileStore* far_field_{nullptr};
     std::vector<float> confidences_{};
-    std::vector<float> collision_heights_{};
+    // Scratch kept across updates so a steady-state update() does not touch the heap.
+    std::vector<float> scroll_heights_scratch_{};
+    std::vector<float> scroll_confidences_scratch_{};
+    std::vector<std::size_t> sample_bin_offsets_{};
+    std::vector<std::size_t> sample_bin_cursor_{};
+    std::vector<std::size_t> sample_bin_indices_{};
+    std::vector<std::size_t> sample_bin_of_{};
+    std::vector<std::size_t> cell_sample_offsets_{};
+    std::vector<std::size_t> cell_sample_indices_{};
     bool initialized_{false};
     Vec3 center_world_{0.0, 0.0, 0.0};
     Real base_height_m_{0.0};
@@ -424,8 +526,8 @@ private:
         const int z0 = ClampRow(static_cast<int>(std::floor(grid_z)));
         const int x1 = ClampCol(x0 + 1);
         const int z1 = ClampRow(z0 + 1);
-        const Real tx = std::clamp(grid_x - static_cast<float>(x0), 0.0, 1.0);
-        const Real tz = std::clamp(grid_z - static_cast<float>(z0), 0.0, 1.0);
+        const Real tx = std::clamp<Real>(grid_x - static_cast<float>(x0), 0.0, 1.0);
+        const Real tz = std::clamp<Real>(grid_z - static_cast<float>(z0), 0.0, 1.0);
         return GridCoord{x0, x1, z0, z1, tx, tz};
     }
 
@@ -449,11 +551,12 @@ private:
             return false;
         }
 
-        const Real inv_cell = 1.0 / std::max(config_.cell_size_m, 1.0e-6);
-        const Real h00 = surface_heights_[Index(row, col)];
-        const Real h10 = surface_heights_[Index(row, col + 1)];
-        const Real h01 = surface_heights_[Index(row + 1, col)];
-        const Real h11 = surface_heights_[Index(row + 1, col + 1)];
+        const Real inv_cell = 1.0 / std::max<Real>(config_.cell_size_m, 1.0e-6);
+        const std::vector<float>& surface_heights = surface_heights_m();
+        const Real h00 = surface_heights[Index(row, col)];
+        const Real h10 = surface_heights[Index(row, col + 1)];
+        const Real h01 = surface_heights[Index(row + 1, col)];
+        const Real h11 = surface_heights[Index(row + 1, col + 1)];
         const Real base = h00;
         const Real hx = h10 - h00;
         const Real hz = h01 - h00;
@@ -493,7 +596,7 @@ private:
             }
         } else {
             Real disc = qb * qb - 4.0 * qa * qc;
-            const Real disc_scale = std::max(1.0, qb * qb + std::abs(qa * qc));
+            const Real disc_scale = std::max<Real>(1.0, qb * qb + std::abs(qa * qc));
             if (disc < 0.0 && disc > -1.0e-6 * disc_scale) {
                 disc = 0.0;
             }
@@ -562,8 +665,9 @@ private:
                            const Vec3& center,
                            const Vec3& normal,
                            const std::vector<TerrainSample>& samples) {
-        std::vector<float> new_heights(surface_heights_.size());
-        std::vector<float> new_conf(confidences_.size());
+        std::vector<float>& surface_heights = heightfield_.buffer->SurfaceHeights();
+        scroll_heights_scratch_.resize(surface_heights.size());
+        scroll_confidences_scratch_.resize(confidences_.size());
         for (int row = 0; row < config_.rows; ++row) {
             for (int col = 0; col < config_.cols; ++col) {
                 const int src_col = col + d_col;
@@ -571,89 +675,113 @@ private:
                 const std::size_t dst = Index(row, col);
                 if (src_row >= 0 && src_row < config_.rows && src_col >= 0 && src_col < config_.cols) {
                     const std::size_t src = Index(src_row, src_col);
-                    new_heights[dst] = surface_heights_[src];
-                    new_conf[dst] = confidences_[src];
+                    scroll_heights_scratch_[dst] = surface_heights[src];
+                    scroll_confidences_scratch_[dst] = confidences_[src];
                 } else {
                     const Real x = xmin_new + static_cast<float>(col) * config_.cell_size_m;
                     const Real z = zmin_new + static_cast<float>(row) * config_.cell_size_m;
-                    new_heights[dst] = SampleTargetHeight(center, normal, plane_height_m, x, z, samples);
-                    new_conf[dst] = SampleTargetConfidence(samples, x, z);
+                    scroll_heights_scratch_[dst] = SampleTargetHeight(center, normal, plane_height_m, x, z, samples);
+                    scroll_confidences_scratch_[dst] = SampleTargetConfidence(samples, x, z);
                 }
             }
         }
-        surface_heights_.swap(new_heights);
-        confidences_.swap(new_conf);
+        surface_heights.swap(scroll_heights_scratch_);
+        confidences_.swap(scroll_confidences_scratch_);
     }
 
-    void FillSampleBinsForCells(const std::vector<TerrainSample>& samples,
-                                std::vector<std::vector<std::size_t>>& cell_lists,
-                                std::vector<const std::vector<std::size_t>*>& out_ptrs) const {
+    /// Builds per-cell candidate sample lists (CSR: cell_sample_offsets_ / cell_sample_indices_)
+    /// from a dense bin grid covering every cell's influence window. Samples are counting-sorted
+    /// into bins, so each bin, and hence each cell list, keeps ascending sample order.
+    void FillSampleBinsForCells(const std::vector<TerrainSample>& samples) {
         const std::size_t cell_count = static_cast<std::size_t>(config_.rows * config_.cols);
-        cell_lists.assign(cell_count, {});
-        const Real bin_w = std::max(1.0e-3, config_.sample_bin_size_m);
+        const Real bin_w = std::max<Real>(1.0e-3, config_.sample_bin_size_m);
         const Real radius = 3.5 * config_.influence_sigma_m;
         const Real anchor_x = grid_world_origin_x_;
         const Real anchor_z = grid_world_origin_z_;
-
-        std::unordered_map<std::int64_t, std::vector<std::size_t>> bins;
-        bins.reserve(samples.size() * 2 + 8);
+        const auto cell_x = [&](int col) { return grid_world_origin_x_ + static_cast<float>(col) * config_.cell_size_m; };
+        const auto cell_z = [&](int row) { return grid_world_origin_z_ + static_cast<float>(row) * config_.cell_size_m; };
+
+        // Window edges use the per-cell expressions below; samples outside reach no cell.
+        const int bx_min = static_cast<int>(std::floor((cell_x(0) - radius - anchor_x) / bin_w));
+        const int bx_max = static_cast<int>(std::floor((cell_x(config_.cols - 1) + radius - anchor_x) / bin_w));
+        const int bz_min = static_cast<int>(std::floor((cell_z(0) - radius - anchor_z) / bin_w));
+        const int bz_max = static_cast<int>(std::floor((cell_z(config_.rows - 1) + radius - anchor_z) / bin_w));
+        const std::size_t bins_x = static_cast<std::size_t>(bx_max - bx_min + 1);
+        const std::size_t bin_count = bins_x * static_cast<std::size_t>(bz_max - bz_min + 1);
+        constexpr std::size_t kNoBin = std::numeric_limits<std::size_t>::max();
+
+        sample_bin_offsets_.assign(bin_count + 1u, 0u);
+        sample_bin_of_.resize(samples.size());
         for (std::size_t si = 0; si < samples.size(); ++si) {
             const TerrainSample& s = samples[si];
-            const int ix = static_cast<int>(std::floor((s.world_position.x - anchor_x) / bin_w));
-            const int iz = static_cast<int>(std::floor((s.world_position.z - anchor_z) / bin_w));
-            const std::int64_t key =
-                (static_cast<std::int64_t>(ix) * 1000003LL) + static_cast<std::int64_t>(iz) * 9176LL;
-            bins[key].push_back(si);
+            const Real fx = std::floor((s.world_position.x - anchor_x) / bin_w);
+            const Real fz = std::floor((s.world_position.z - anchor_z) / bin_w);
+            if (!(fx >= bx_min && fx <= bx_max && fz >= bz_min && fz <= bz_max)) {
+                sample_bin_of_[si] = kNoBin;
+                continue;
+            }
+            const std::size_t bin = static_cast<std::size_t>(static_cast<int>(fz) - bz_min) * bins_x
+                + static_cast<std::size_t>(static_cast<int>(fx) - bx_min);
+            sample_bin_of_[si] = bin;
+            ++sample_bin_offsets_[bin + 1u];
+        }
+        for (std::size_t bin = 0; bin < bin_count; ++bin) {
+            sample_bin_offsets_[bin + 1u] += sample_bin_offsets_[bin];
+        }
+        sample_bin_cursor_.assign(sample_bin_offsets_.begin(), sample_bin_offsets_.end() - 1);
+        sample_bin_indices_.resize(sample_bin_offsets_[bin_count]);
+        for (std::size_t si = 0; si < samples.size(); ++si) {
+            if (sample_bin_of_[si] != kNoBin) {
+                sample_bin_indices_[sample_bin_cursor_[sample_bin_of_[si]]++] = si;
+            }
         }
 
+        cell_sample_offsets_.resize(cell_count + 1u);
+        cell_sample_indices_.clear();
         for (int row = 0; row < config_.rows; ++row) {
             for (int col = 0; col < config_.cols; ++col) {
-                const Real wx = grid_world_origin_x_ + static_cast<float>(col) * config_.cell_size_m;
-                const Real wz = grid_world_origin_z_ + static_cast<float>(row) * config_.cell_size_m;
+                const Real wx = cell_x(col);
+                const Real wz = cell_z(row);
                 const int ix0 = static_cast<int>(std::floor((wx - radius - anchor_x) / bin_w));
                 const int ix1 = static_cast<int>(std::floor((wx + radius - anchor_x) / bin_w));
                 const int iz0 = static_cast<int>(std::floor((wz - radius - anchor_z) / bin_w));
                 const int iz1 = static_cast<int>(std::floor((wz + radius - anchor_z) / bin_w));
-                std::vector<std::size_t>& out = cell_lists[Index(row, col)];
+                cell_sample_offsets_[Index(row, col)] = cell_sample_indices_.size();
                 for (int bz = iz0; bz <= iz1; ++bz) {
                     for (int bx = ix0; bx <= ix1; ++bx) {
-                        const std::int64_t key =
-                            (static_cast<std::int64_t>(bx) * 1000003LL) + static_cast<std::int64_t>(bz) * 9176LL;
-                        const auto found = bins.find(key);
-                        if (found == bins.end()) {
-                            continue;
-                        }
-                        for (std::size_t idx : found->second) {
-                            out.push_back(idx);
-                        }
+                        const std::size_t bin =
+                            static_cast<std::size_t>(bz - bz_min) * bins_x + static_cast<std::size_t>(bx - bx_min);
+                        cell_sample_indices_.insert(
+                            cell_sample_indices_.end(),
+                            sample_bin_indices_.begin() + static_cast<std::ptrdiff_t>(sample_bin_offsets_[bin]),
+                            sample_bin_indices_.begin() + static_cast<std::ptrdiff_t>(sample_bin_offsets_[bin + 1u]));
                     }
                 }
             }
         }
-
-        out_ptrs.assign(cell_count, nullptr);
-        for (std::size_t i = 0; i < cell_count; ++i) {
-            out_ptrs[i] = &cell_lists[i];
-        }
+        cell_sample_offsets_[cell_count] = cell_sample_indices_.size();
     }
 
-    Real SampleTargetConfidenceBinned(const std::vector<TerrainSample>& samples,
-                                       Real x,
-                                       Real z,
-                                       const std::vector<const std::vector<std::size_t>*>& buckets) const {
-        if (buckets.empty()) {
-            return SampleTargetConfidence(samples, x, z);
-        }
+    /// Cell whose candidate list covers (x, z).
+    std::size_t BinnedCellIndex(Real x, Real z) const {
         const int col = static_cast<int>(
-            std::floor((x - grid_world_origin_x_) / std::max(1.0e-6, config_.cell_size_m)));
+            std::floor((x - grid_world_origin_x_) / std::max<Real>(1.0e-6, config_.cell_size_m)));
         const int row = static_cast<int>(
-            std::floor((z - grid_world_origin_z_) / std::max(1.0e-6, config_.cell_size_m)));
-        const std::size_t idx = static_cast<std::size_t>(std::clamp(row, 0, config_.rows - 1) * config_.cols +
-                                                         std::clamp(col, 0, config_.cols - 1));
-        if (idx < buckets.size() && buckets[idx] != nullptr) {
-            return SampleTargetConfidenceIndices(samples, x, z, *buckets[idx]);
+            std::floor((z - grid_world_origin_z_) / std::max<Real>(1.0e-6, config_.cell_size_m)));
+        return static_cast<std::size_t>(std::clamp(row, 0, config_.rows - 1) * config_.cols +
+                                        std::clamp(col, 0, config_.cols - 1));
+    }
+
+    Real SampleTargetConfidenceBinned(const std::vector<TerrainSample>& samples, Real x, Real z, bool use_bins) const {
+        if (!use_bins) {
+            return SampleTargetConfidence(samples, x, z);
         }
-        return SampleTargetConfidence(samples, x, z);
+        const std::size_t idx = BinnedCellIndex(x, z);
+        return SampleTargetConfidenceIndices(samples,
+                                             x,
+                                             z,
+                                             cell_sample_indices_.data() + cell_sample_offsets_[idx],
+                                             cell_sample_indices_.data() + cell_sample_offsets_[idx + 1u]);
     }
 
     Real SampleTargetHeightBinned(const Vec3& center,
@@ -662,28 +790,29 @@ private:
                                    Real x,
                                    Real z,
                                    const std::vector<TerrainSample>& samples,
-                                   const std::vector<const std::vector<std::size_t>*>& buckets) const {
-        if (buckets.empty()) {
+                                   bool use_bins) const {
+        if (!use_bins) {
             return SampleTargetHeight(center, normal, plane_height_m, x, z, samples);
         }
-        const int col = static_cast<int>(
-            std::floor((x - grid_world_origin_x_) / std::max(1.0e-6, config_.cell_size_m)));
-        const int row = static_cast<int>(
-            std::floor((z - grid_world_origin_z_) / std::max(1.0e-6, config_.cell_size_m)));
-        const std::size_t idx = static_cast<std::size_t>(std::clamp(row, 0, config_.rows - 1) * config_.cols +
-                                                         std::clamp(col, 0, config_.cols - 1));
-        if (idx < buckets.size() && buckets[idx] != nullptr) {
-            return SampleTargetHeightIndices(center, normal, plane_height_m, x, z, samples, *buckets[idx]);
-        }
-        return SampleTargetHeight(center, normal, plane_height_m, x, z, samples);
+        const std::size_t idx = BinnedCellIndex(x, z);
+        return SampleTargetHeightIndices(center,
+                                         normal,
+                                         plane_height_m,
+                                         x,
+                                         z,
+                                         samples,
+                                         cell_sample_indices_.data() + cell_sample_offsets_[idx],
+                                         cell_sample_indices_.data() + cell_sample_offsets_[idx + 1u]);
     }
 
     Real SampleTargetConfidenceIndices(const std::vector<TerrainSample>& samples,
                                         Real x,
                                         Real z,
-                                        const std::vector<std::size_t>& indices) const {
+                                        const std::size_t* first,
+                                        const std::size_t* last) const {
         Real weight_sum = config_.plane_confidence;
-        for (std::size_t i : indices) {
+        for (const std::size_t* it = first; it != last; ++it) {
+            const std::size_t i = *it;
             if (i >= samples.size()) {
                 continue;
             }
@@ -691,7 +820,7 @@ private:
             const Real dx = x - sample.world_position.x;
             const Real dz = z - sample.world_position.z;
             const Real d2 = dx * dx + dz * dz;
-            const Real sigma2 = std::max(1.0e-6, config_.influence_sigma_m * config_.influence_sigma_m);
+            const Real sigma2 = std::max<Real>(1.0e-6, config_.influence_sigma_m * config_.influence_sigma_m);
             const Real influence = std::clamp(
                 sample.confidence * std::exp(-0.5 * d2 / sigma2),
                 0.0,
@@ -707,12 +836,14 @@ private:
                                     Real x,
                                     Real z,
                                     const std::vector<TerrainSample>& samples,
-                                    const std::vector<std::size_t>& indices) const {
+                                    const std::size_t* first,
+                                    const std::size_t* last) const {
         const Real plane_height = PlaneHeightAt(center, normal, plane_height_m, x, z);
         Real weighted_height = plane_height * config_.plane_confidence;
         Real weight_sum = config_.plane_confidence;
 
-        for (std::size_t i : indices) {
+        for (const std::size_t* it = first; it != last; ++it) {
+            const std::size_t i = *it;
             if (i >= samples.size()) {
                 continue;
             }
@@ -720,7 +851,7 @@ private:
             const Real dx = x - sample.world_position.x;
             const Real dz = z - sample.world_position.z;
             const Real d2 = dx * dx + dz * dz;
-            const Real sigma2 = std::max(1.0e-6, config_.influence_sigma_m * config_.influence_sigma_m);
+            const Real sigma2 = std::max<Real>(1.0e-6, config_.influence_sigma_m * config_.influence_sigma_m);
             const Real influence = std::clamp(
                 sample.confidence * std::exp(-0.5 * d2 / sigma2),
                 0.0,
@@ -744,7 +875,7 @@ private:
             const Real dx = x - sample.world_position.x;
             const Real dz = z - sample.world_position.z;
             const Real d2 = dx * dx + dz * dz;
-            const Real sigma2 = std::max(1.0e-6, config_.influence_sigma_m * config_.influence_sigma_m);
+            const Real sigma2 = std::max<Real>(1.0e-6, config_.influence_sigma_m * config_.influence_sigma_m);
             const Real influence = std::clamp(
                 sample.confidence * std::exp(-0.5 * d2 / sigma2),
                 0.0,
@@ -768,7 +899,7 @@ private:
             const Real dx = x - sample.world_position.x;
             const Real dz = z - sample.world_position.z;
             const Real d2 = dx * dx + dz * dz;
-            const Real sigma2 = std::max(1.0e-6, config_.influence_sigma_m * config_.influence_sigma_m);
+            const Real sigma2 = std::max<Real>(1.0e-6, config_.influence_sigma_m * config_.influence_sigma_m);
             const Real influence = std::clamp(
                 sample.confidence * std::exp(-0.5 * d2 / sigma2),
                 0.0,
@@ -793,7 +924,7 @@ private:
         } else {
             n = Normalize(n);
         }
-        const Real ny = std::max(std::abs(n.y), 0.25);
+        const Real ny = std::max<Real>(std::abs(n.y), 0.25);
         return plane_height - (n.x * (x - origin.x) + n.z * (z - origin.z)) / ny;
     }
 
@@ -804,14 +935,14 @@ private:
         if (age_seconds <= 0.0) {
             return 1.0;
         }
-        const Real t = std::max(0.0, age_seconds);
+        const Real t = std::max<Real>(0.0, age_seconds);
         return std::pow(0.5, t / config_.confidence_half_life_s);
     }
 
     Real ComputeBlend(Real age_decay) const {
-        const Real decay_component = 1.0 - std::clamp(age_decay, 0.0, 1.0);
+        const Real decay_component = 1.0 - std::clamp<Real>(age_decay, 0.0, 1.0);
         const Real blend = config_.base_update_blend + decay_component * config_.decay_update_boost;
-        return std::clamp(blend, 0.0, 1.0);
+        return std::clamp<Real>(blend, 0.0, 1.0);
     }
 };
 
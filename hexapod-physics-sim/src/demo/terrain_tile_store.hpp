@@ -0,0 +1,525 @@
+#pragma once
+
+// TerrainTileStore: large pre-authored heightfield streamed from a memory-mapped height file.
+// Fine tiles around a focus point (the robot) are copied into a fixed-capacity LRU cache and
+// composed into a resident window that World collides against through a shared
+// TerrainHeightfieldBuffer. A decimated LOD grid covering the whole file answers height samples
+// and LiDAR rays beyond the window. Per-step cost depends on the window and cache sizes only,
+// never on how much of the file has been traversed.
+//
+// Height file layout (host byte order, written by WriteTerrainHeightFile):
+//   TerrainHeightFileHeader
+//   fine tiles at fine_offset: tiles_z x tiles_x tiles in row-major tile order, each
+//     tile_cells x tile_cells floats row-major (+X along a row, +Z across rows)
+//   LOD grid at coarse_offset: coarse_rows x coarse_cols floats, every lod_factor-th fine sample
+
+#include "minphys3d/core/terrain_heightfield.hpp"
+#include "minphys3d/core/world.hpp"
+#include "minphys3d/math/vec3.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace minphys3d::demo {
+
+struct TerrainHeightFileHeader {
+    std::array<char, 4> magic{{'M', 'P', 'H', 'T'}};
+    std::uint32_t version{1};
+    std::uint32_t tile_cells{0};
+    std::uint32_t tiles_x{0};
+    std::uint32_t tiles_z{0};
+    std::uint32_t lod_factor{0};
+    std::uint32_t coarse_cols{0};
+    std::uint32_t coarse_rows{0};
+    float cell_size_m{0.0f};
+    float origin_x{0.0f};
+    float origin_z{0.0f};
+    std::uint32_t reserved{0};
+    std::uint64_t fine_offset{0};
+    std::uint64_t coarse_offset{0};
+};
+
+/// Writes `heights` (rows x cols samples, row-major, `cell_size_m` apart starting at
+/// (origin_x, origin_z)) as a tiled height file. The grid is padded to whole tiles by repeating
+/// its last row and column.
+inline bool WriteTerrainHeightFile(const std::string& path,
+                                   const std::vector<float>& heights,
+                                   int rows,
+                                   int cols,
+                                   Real cell_size_m,
+                                   Real origin_x,
+                                   Real origin_z,
+                                   int tile_cells = 32,
+                                   int lod_factor = 4,
+                                   std::string* error = nullptr) {
+    const auto fail = [&](const char* message) {
+        if (error != nullptr) {
+            *error = message;
+        }
+        return false;
+    };
+    if (rows < 2 || cols < 2 || heights.size() != static_cast<std::size_t>(rows * cols)) {
+        return fail("height grid must be at least 2x2 and match rows * cols");
+    }
+    if (tile_cells < 2 || lod_factor < 1 || !(cell_size_m > 0.0)) {
+        return fail("tile_cells must be >= 2, lod_factor >= 1 and cell_size_m > 0");
+    }
+
+    TerrainHeightFileHeader header{};
+    header.tile_cells = static_cast<std::uint32_t>(tile_cells);
+    header.tiles_x = static_cast<std::uint32_t>((cols + tile_cells - 1) / tile_cells);
+    header.tiles_z = static_cast<std::uint32_t>((rows + tile_cells - 1) / tile_cells);
+    header.lod_factor = static_cast<std::uint32_t>(lod_factor);
+    const int padded_cols = static_cast<int>(header.tiles_x) * tile_cells;
+    const int padded_rows = static_cast<int>(header.tiles_z) * tile_cells;
+    header.coarse_cols = static_cast<std::uint32_t>((padded_cols - 1) / lod_factor + 1);
+    header.coarse_rows = static_cast<std::uint32_t>((padded_rows - 1) / lod_factor + 1);
+    header.cell_size_m = static_cast<float>(cell_size_m);
+    header.origin_x = static_cast<float>(origin_x);
+    header.origin_z = static_cast<float>(origin_z);
+    header.fine_offset = sizeof(TerrainHeightFileHeader);
+    header.coarse_offset =
+        header.fine_offset + static_cast<std::uint64_t>(padded_rows) * static_cast<std::uint64_t>(padded_cols) * sizeof(float);
+
+    const auto padded = [&](int row, int col) {
+        return heights[static_cast<std::size_t>(std::min(row, rows - 1) * cols + std::min(col, cols - 1))];
+    };
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return fail("cannot open height file for writing");
+    }
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    std::vector<float> row_buffer(static_cast<std::size_t>(tile_cells));
+    for (int tz = 0; ok && tz < static_cast<int>(header.tiles_z); ++tz) {
+        for (int tx = 0; ok && tx < static_cast<int>(header.tiles_x); ++tx) {
+            for (int r = 0; ok && r < tile_cells; ++r) {
+                for (int c = 0; c < tile_cells; ++c) {
+                    row_buffer[static_cast<std::size_t>(c)] = padded(tz * tile_cells + r, tx * tile_cells + c);
+                }
+                ok = std::fwrite(row_buffer.data(), sizeof(float), row_buffer.size(), file) == row_buffer.size();
+            }
+        }
+    }
+    row_buffer.resize(header.coarse_cols);
+    for (int r = 0; ok && r < static_cast<int>(header.coarse_rows); ++r) {
+        for (int c = 0; c < static_cast<int>(header.coarse_cols); ++c) {
+            row_buffer[static_cast<std::size_t>(c)] = padded(r * lod_factor, c * lod_factor);
+        }
+        ok = std::fwrite(row_buffer.data(), sizeof(float), row_buffer.size(), file) == row_buffer.size();
+    }
+    ok = std::fclose(file) == 0 && ok;
+    return ok ? true : fail("short write to height file");
+}
+
+/// Read-only mapping of a height file; tiles and the LOD grid are read in place.
+class MappedTerrainHeightFile {
+public:
+    MappedTerrainHeightFile() = default;
+    MappedTerrainHeightFile(const MappedTerrainHeightFile&) = delete;
+    MappedTerrainHeightFile& operator=(const MappedTerrainHeightFile&) = delete;
+    ~MappedTerrainHeightFile() { Close(); }
+
+    bool Open(const std::string& path, std::string* error = nullptr) {
+        Close();
+        const auto fail = [&](const char* message) {
+            Close();
+            if (error != nullptr) {
+                *error = message;
+            }
+            return false;
+        };
+#if defined(_WIN32)
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+            return fail("cannot open height file");
+        }
+        fallback_.resize(static_cast<std::size_t>(in.tellg()));
+        in.seekg(0);
+        if (!in.read(reinterpret_cast<char*>(fallback_.data()), static_cast<std::streamsize>(fallback_.size()))) {
+            return fail("cannot read height file");
+        }
+        data_ = fallback_.data();
+        size_ = fallback_.size();
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return fail("cannot open height file");
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            return fail("cannot stat height file");
+        }
+        void* mapping = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            return fail("cannot map height file");
+        }
+        data_ = static_cast<const std::uint8_t*>(mapping);
+        size_ = static_cast<std::size_t>(st.st_size);
+#endif
+        if (size_ < sizeof(TerrainHeightFileHeader)) {
+            return fail("height file too small");
+        }
+        std::memcpy(&header_, data_, sizeof(header_));
+        const TerrainHeightFileHeader expected{};
+        if (header_.magic != expected.magic || header_.version != expected.version) {
+            return fail("not a version 1 MPHT height file");
+        }
+        const std::uint64_t tile_floats = static_cast<std::uint64_t>(header_.tile_cells) * header_.tile_cells;
+        const std::uint64_t fine_bytes = tile_floats * header_.tiles_x * header_.tiles_z * sizeof(float);
+        const std::uint64_t coarse_bytes =
+            static_cast<std::uint64_t>(header_.coarse_cols) * header_.coarse_rows * sizeof(float);
+        if (header_.tile_cells < 2 || header_.tiles_x == 0 || header_.tiles_z == 0 || header_.lod_factor == 0
+            || header_.coarse_cols == 0 || header_.coarse_rows == 0 || !(header_.cell_size_m > 0.0f)
+            || header_.fine_offset % alignof(float) != 0 || header_.coarse_offset % alignof(float) != 0
+            || header_.fine_offset + fine_bytes > size_ || header_.coarse_offset + coarse_bytes > size_) {
+            return fail("height file header does not match its size");
+        }
+        return true;
+    }
+
+    void Close() {
+#if defined(_WIN32)
+        fallback_.clear();
+#else
+        if (data_ != nullptr) {
+            ::munmap(const_cast<std::uint8_t*>(data_), size_);
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+        header_ = {};
+    }
+
+    bool is_open() const { return data_ != nullptr; }
+    const TerrainHeightFileHeader& header() const { return header_; }
+    std::size_t mapped_bytes() const { return size_; }
+
+    const float* tile(int tile_x, int tile_z) const {
+        const std::size_t tile_floats = static_cast<std::size_t>(header_.tile_cells) * header_.tile_cells;
+        const std::size_t index = static_cast<std::size_t>(tile_z) * header_.tiles_x + static_cast<std::size_t>(tile_x);
+        return reinterpret_cast<const float*>(data_ + header_.fine_offset) + index * tile_floats;
+    }
+
+    const float* coarse() const { return reinterpret_cast<const float*>(data_ + header_.coarse_offset); }
+
+private:
+    const std::uint8_t* data_{nullptr};
+    std::size_t size_{0};
+    TerrainHeightFileHeader header_{};
+#if defined(_WIN32)
+    std::vector<std::uint8_t> fallback_{};
+#endif
+};
+
+struct TerrainTileStoreConfig {
+    /// Resident window spans (2 * window_radius_tiles + 1)^2 fine tiles centred on the focus tile.
+    int window_radius_tiles{2};
+    /// Fine tiles kept in the LRU cache; raised to the window tile count when smaller.
+    int cache_capacity_tiles{64};
+    /// RaycastWorld gives up after this distance along the ray.
+    Real max_ray_distance_m{12.0};
+};
+
+struct TerrainTileStoreStats {
+    std::uint64_t window_moves{0};
+    /// Cache misses: tiles copied out of the mapped file.
+    std::uint64_t tile_loads{0};
+    std::uint64_t tile_cache_hits{0};
+    std::uint64_t tile_evictions{0};
+};
+
+class TerrainTileStore {
+public:
+    explicit TerrainTileStore(TerrainTileStoreConfig config = {})
+        : config_(config) {}
+
+    TerrainTileStore(const TerrainTileStore&) = delete;
+    TerrainTileStore& operator=(const TerrainTileStore&) = delete;
+
+    bool Open(const std::string& path, std::string* error = nullptr) {
+        window_valid_ = false;
+        stats_ = {};
+        if (!file_.Open(path, error)) {
+            return false;
+        }
+        const TerrainHeightFileHeader& header = file_.header();
+        tile_cells_ = static_cast<int>(header.tile_cells);
+        const int radius = std::max(config_.window_radius_tiles, 0);
+        window_tiles_x_ = std::min(2 * radius + 1, static_cast<int>(header.tiles_x));
+        window_tiles_z_ = std::min(2 * radius + 1, static_cast<int>(header.tiles_z));
+        const int capacity = std::max(config_.cache_capacity_tiles, window_tiles_x_ * window_tiles_z_);
+        const std::size_t tile_floats = static_cast<std::size_t>(tile_cells_ * tile_cells_);
+        slot_heights_.assign(static_cast<std::size_t>(capacity) * tile_floats, 0.0f);
+        slot_tile_.assign(static_cast<std::size_t>(capacity), kNoTile);
+        slot_last_use_.assign(static_cast<std::size_t>(capacity), 0u);
+        use_clock_ = 0;
+        window_ = std::make_shared<TerrainHeightfieldBuffer>();
+        window_->Reset(window_tiles_z_ * tile_cells_, window_tiles_x_ * tile_cells_, 0.0f);
+        return true;
+    }
+
+    bool is_open() const { return file_.is_open(); }
+    bool has_window() const { return window_valid_; }
+    const TerrainTileStoreStats& stats() const { return stats_; }
+    const MappedTerrainHeightFile& file() const { return file_; }
+    Real cell_size_m() const { return file_.header().cell_size_m; }
+    Real min_x() const { return file_.header().origin_x; }
+    Real min_z() const { return file_.header().origin_z; }
+    Real max_x() const { return min_x() + static_cast<Real>(file_.header().tiles_x * tile_cells_ - 1) * cell_size_m(); }
+    Real max_z() const { return min_z() + static_cast<Real>(file_.header().tiles_z * tile_cells_ - 1) * cell_size_m(); }
+    Vec3 window_origin_world() const {
+        return {min_x() + static_cast<Real>(window_tile_x0_ * tile_cells_) * cell_size_m(),
+                0.0,
+                min_z() + static_cast<Real>(window_tile_z0_ * tile_cells_) * cell_size_m()};
+    }
+    std::shared_ptr<const TerrainHeightfieldBuffer> window() const { return window_; }
+    /// Heap bytes held for fine heights (LRU cache plus resident window); fixed once opened.
+    std::size_t resident_bytes() const {
+        return (slot_heights_.capacity() + (window_ != nullptr ? window_->SurfaceHeights().capacity() : 0u))
+            * sizeof(float);
+    }
+
+    /// Re-centres the resident window on the tile under `focus`. Returns true when the window
+    /// moved (the attachment must then be re-synced); otherwise this is a couple of compares.
+    bool UpdateWindow(const Vec3& focus) {
+        if (!file_.is_open()) {
+            return false;
+        }
+        const TerrainHeightFileHeader& header = file_.header();
+        const Real tile_span = static_cast<Real>(tile_cells_) * cell_size_m();
+        const int focus_tx = static_cast<int>(std::floor((focus.x - min_x()) / tile_span));
+        const int focus_tz = static_cast<int>(std::floor((focus.z - min_z()) / tile_span));
+        const int radius = std::max(config_.window_radius_tiles, 0);
+        const int tx0 = std::clamp(focus_tx - radius, 0, static_cast<int>(header.tiles_x) - window_tiles_x_);
+        const int tz0 = std::clamp(focus_tz - radius, 0, static_cast<int>(header.tiles_z) - window_tiles_z_);
+        if (window_valid_ && tx0 == window_tile_x0_ && tz0 == window_tile_z0_) {
+            return false;
+        }
+        window_tile_x0_ = tx0;
+        window_tile_z0_ = tz0;
+        ComposeWindow();
+        window_valid_ = true;
+        ++stats_.window_moves;
+        return true;
+    }
+
+    /// Attachment referencing the resident window in place (see TerrainHeightfieldBuffer).
+    World::TerrainHeightfieldAttachment BuildTerrainHeightfieldAttachment() const {
+        World::TerrainHeightfieldAttachment attachment{};
+        attachment.enabled = window_valid_;
+        attachment.rows = window_->Rows();
+        attachment.cols = window_->Cols();
+        attachment.cellSizeM = cell_size_m();
+        attachment.gridOriginWorld = window_origin_world();
+        const Real half_x = 0.5 * static_cast<Real>(attachment.cols - 1) * cell_size_m();
+        const Real half_z = 0.5 * static_cast<Real>(attachment.rows - 1) * cell_size_m();
+        attachment.centerWorld = window_origin_world() + Vec3{half_x, window_min_height_m_, half_z};
+        attachment.planeHeightM = window_min_height_m_;
+        attachment.baseHeightM = window_min_height_m_;
+        attachment.sharedHeights = window_;
+        return attachment;
+    }
+
+    /// Bilinear height: fine inside the resident window, LOD grid elsewhere (clamped to the file).
+    Real SampleHeightWorld(Real x, Real z) const {
+        if (InWindow(x, z)) {
+            return SampleGrid(window_->SurfaceHeights().data(),
+                              window_->Cols(),
+                              window_->Rows(),
+                              window_origin_world().x,
+                              window_origin_world().z,
+                              cell_size_m(),
+                              x,
+                              z);
+        }
+        const TerrainHeightFileHeader& header = file_.header();
+        return SampleGrid(file_.coarse(),
+                          static_cast<int>(header.coarse_cols),
+                          static_cast<int>(header.coarse_rows),
+                          min_x(),
+                          min_z(),
+                          cell_size_m() * static_cast<Real>(header.lod_factor),
+                          x,
+                          z);
+    }
+
+    /// Marches the ray from `t_min` over the file footprint, half a cell per step inside the
+    /// window and half an LOD cell beyond it, and bisects the first sign change of height residual.
+    bool RaycastWorld(const Vec3& origin, const Vec3& dir_unit, Real& t_out, Real t_min = 0.0) const {
+        if (!file_.is_open()) {
+            return false;
+        }
+        const Vec3 d = Normalize(dir_unit);
+        if (!std::isfinite(d.x) || !std::isfinite(d.y) || !std::isfinite(d.z)) {
+            return false;
+        }
+        Real t = std::max<Real>(t_min, 0.0);
+        Real t_end = config_.max_ray_distance_m;
+        if (!ClipToFootprint(origin, d, t, t_end)) {
+            return false;
+        }
+        auto residual = [&](Real at) {
+            const Vec3 p = origin + d * at;
+            return p.y - SampleHeightWorld(p.x, p.z);
+        };
+        if (residual(t) <= 0.0) {
+            if (t > 1.0e-5) {
+                t_out = t;
+                return true;
+            }
+            return false;
+        }
+        const Real horizontal = std::max<Real>(std::sqrt(d.x * d.x + d.z * d.z), 0.25);
+        const Real fine_step = 0.5 * cell_size_m() / horizontal;
+        const Real coarse_step = fine_step * static_cast<Real>(file_.header().lod_factor);
+        while (t < t_end) {
+            const Vec3 p = origin + d * t;
+            const Real t_next = std::min(t_end, t + (InWindow(p.x, p.z) ? fine_step : coarse_step));
+            if (residual(t_next) <= 0.0) {
+                Real lo = t;
+                Real hi = t_next;
+                for (int i = 0; i < 16; ++i) {
+                    const Real mid = 0.5 * (lo + hi);
+                    if (residual(mid) > 0.0) {
+                        lo = mid;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                t_out = hi;
+                return true;
+            }
+            t = t_next;
+        }
+        return false;
+    }
+
+private:
+    static constexpr std::uint32_t kNoTile = std::numeric_limits<std::uint32_t>::max();
+
+    bool InWindow(Real x, Real z) const {
+        if (!window_valid_) {
+            return false;
+        }
+        const Vec3 origin = window_origin_world();
+        const Real span_x = static_cast<Real>(window_->Cols() - 1) * cell_size_m();
+        const Real span_z = static_cast<Real>(window_->Rows() - 1) * cell_size_m();
+        return x >= origin.x && x <= origin.x + span_x && z >= origin.z && z <= origin.z + span_z;
+    }
+
+    static Real SampleGrid(const float* heights, int cols, int rows, Real x0, Real z0, Real cell, Real x, Real z) {
+        const Real gx = std::clamp<Real>((x - x0) / cell, 0.0, static_cast<Real>(cols - 1));
+        const Real gz = std::clamp<Real>((z - z0) / cell, 0.0, static_cast<Real>(rows - 1));
+        const int c0 = std::min(static_cast<int>(gx), cols - 2);
+        const int r0 = std::min(static_cast<int>(gz), rows - 2);
+        const Real tx = gx - static_cast<Real>(c0);
+        const Real tz = gz - static_cast<Real>(r0);
+        const float* row0 = heights + static_cast<std::size_t>(r0) * static_cast<std::size_t>(cols);
+        const float* row1 = row0 + cols;
+        const Real h0 = row0[c0] * (1.0 - tx) + row0[c0 + 1] * tx;
+        const Real h1 = row1[c0] * (1.0 - tx) + row1[c0 + 1] * tx;
+        return h0 * (1.0 - tz) + h1 * tz;
+    }
+
+    bool ClipToFootprint(const Vec3& o, const Vec3& d, Real& t0, Real& t1) const {
+        const auto axis = [&](Real pos, Real dir, Real min_v, Real max_v) {
+            if (std::abs(dir) < 1.0e-8) {
+                return pos >= min_v && pos <= max_v;
+            }
+            Real t_near = (min_v - pos) / dir;
+            Real t_far = (max_v - pos) / dir;
+            if (t_near > t_far) {
+                std::swap(t_near, t_far);
+            }
+            t0 = std::max(t0, t_near);
+            t1 = std::min(t1, t_far);
+            return t0 <= t1;
+        };
+        return axis(o.x, d.x, min_x(), max_x()) && axis(o.z, d.z, min_z(), max_z());
+    }
+
+    /// Slot holding tile (tx, tz), loading it over the least recently used slot on a miss. Slots
+    /// stamped by the current composition are never evicted because the cache holds a full window.
+    std::size_t AcquireTile(int tx, int tz) {
+        const std::uint32_t key = static_cast<std::uint32_t>(tz) * file_.header().tiles_x + static_cast<std::uint32_t>(tx);
+        ++use_clock_;
+        std::size_t victim = 0;
+        for (std::size_t slot = 0; slot < slot_tile_.size(); ++slot) {
+            if (slot_tile_[slot] == key) {
+                slot_last_use_[slot] = use_clock_;
+                ++stats_.tile_cache_hits;
+                return slot;
+            }
+            if (slot_last_use_[slot] < slot_last_use_[victim]) {
+                victim = slot;
+            }
+        }
+        if (slot_tile_[victim] != kNoTile) {
+            ++stats_.tile_evictions;
+        }
+        const std::size_t tile_floats = static_cast<std::size_t>(tile_cells_ * tile_cells_);
+        std::memcpy(slot_heights_.data() + victim * tile_floats, file_.tile(tx, tz), tile_floats * sizeof(float));
+        slot_tile_[victim] = key;
+        slot_last_use_[victim] = use_clock_;
+        ++stats_.tile_loads;
+        return victim;
+    }
+
+    void ComposeWindow() {
+        std::vector<float>& heights = window_->SurfaceHeights();
+        const std::size_t tile_floats = static_cast<std::size_t>(tile_cells_ * tile_cells_);
+        const std::size_t window_cols = static_cast<std::size_t>(window_->Cols());
+        for (int wz = 0; wz < window_tiles_z_; ++wz) {
+            for (int wx = 0; wx < window_tiles_x_; ++wx) {
+                const float* tile = slot_heights_.data() + AcquireTile(window_tile_x0_ + wx, window_tile_z0_ + wz) * tile_floats;
+                for (int r = 0; r < tile_cells_; ++r) {
+                    float* dst = heights.data() + static_cast<std::size_t>(wz * tile_cells_ + r) * window_cols
+                        + static_cast<std::size_t>(wx * tile_cells_);
+                    std::memcpy(dst, tile + static_cast<std::size_t>(r * tile_cells_), static_cast<std::size_t>(tile_cells_) * sizeof(float));
+                }
+            }
+        }
+        window_min_height_m_ = heights.empty() ? 0.0 : *std::min_element(heights.begin(), heights.end());
+        // Every cell moved in world space, so every tile (and terrain contact id) is refreshed.
+        window_->MarkAllDirty();
+    }
+
+    TerrainTileStoreConfig config_{};
+    MappedTerrainHeightFile file_{};
+    TerrainTileStoreStats stats_{};
+    int tile_cells_{0};
+    int window_tiles_x_{0};
+    int window_tiles_z_{0};
+    int window_tile_x0_{0};
+    int window_tile_z0_{0};
+    bool window_valid_{false};
+    Real window_min_height_m_{0.0};
+    std::shared_ptr<TerrainHeightfieldBuffer> window_{};
+    std::vector<float> slot_heights_{};
+    std::vector<std::uint32_t> slot_tile_{};
+    std::vector<std::uint64_t> slot_last_use_{};
+    std::uint64_t use_clock_{0};
+};
+
+} // namespace minphys3d::demo
@@ -70,6 +70,12 @@ void PrintUsage(std::ostream& out) {
             "                            (same as demo: --udp-host / --udp-port, default 127.0.0.1:9870)\n"
            "  --serve-preview-stride N  With UDP preview: emit preview every N physics steps (default: 1)\n"
            "  --resource-monitoring MODE  Serve-mode resource instrumentation: full|top-level|off (default: full)\n"
+           "  --solver-threads N        With --serve: solve independent islands on N threads (default: 1)\n"
+           "  --serve-envs N            With --serve: host N independent hexapod worlds, addressed by the\n"
+           "                            messages' env_index (default: 1)\n"
+           "  --serve-env-threads N     With --serve-envs: step queued environments on N threads\n"
+           "                            (default: hardware concurrency)\n"
+           "  --lidar-threads N         With --serve: trace matrix LiDAR ray packets on N threads (default: 1)\n"
            "  -h, --help                Show this help\n";
 }
 
@@ -87,6 +93,10 @@ int main(int argc, char** argv) {
     bool serve_mode = false;
     int serve_port = 9871;
     int serve_preview_stride = 1;
+    int serve_solver_threads = 1;
+    int serve_env_count = 1;
+    int serve_env_threads = 0;
+    int serve_lidar_threads = 1;
     int solver_iterations = minphys3d::demo::kHexapodPoseHoldBenchmarkSolverIterations;
     minphys3d::ResourceMonitoringMode resource_monitoring_mode = minphys3d::ResourceMonitoringMode::Full;
     std::string scene_file;
@@ -227,6 +237,51 @@ int main(int argc, char** argv) {
             }
             continue;
         }
+        if (arg == "--solver-threads") {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for --solver-threads\n";
+                return 1;
+            }
+            if (!ParsePositiveInt(argv[++i], serve_solver_threads)) {
+                std::cerr << "Invalid --solver-threads (expected positive integer)\n";
+                return 1;
+            }
+            continue;
+        }
+        if (arg == "--serve-envs") {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for --serve-envs\n";
+                return 1;
+            }
+            if (!ParsePositiveInt(argv[++i], serve_env_count) || serve_env_count > minphys3d::demo::kServeMaxEnvironments) {
+                std::cerr << "Invalid --serve-envs (expected integer 1.." << minphys3d::demo::kServeMaxEnvironments
+                          << ")\n";
+                return 1;
+            }
+            continue;
+        }
+        if (arg == "--serve-env-threads") {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for --serve-env-threads\n";
+                return 1;
+            }
+            if (!ParsePositiveInt(argv[++i], serve_env_threads)) {
+                std::cerr << "Invalid --serve-env-threads (expected positive integer)\n";
+                return 1;
+            }
+            continue;
+        }
+        if (arg == "--lidar-threads") {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for --lidar-threads\n";
+                return 1;
+            }
+            if (!ParsePositiveInt(argv[++i], serve_lidar_threads)) {
+                std::cerr << "Invalid --lidar-threads (expected positive integer)\n";
+                return 1;
+            }
+            continue;
+        }
         if (arg == "--resource-monitoring") {
             if (i + 1 >= argc) {
                 std::cerr << "Missing value for --resource-monitoring (expected full|top-level|off)\n";
@@ -259,7 +314,11 @@ int main(int argc, char** argv) {
             udp_port,
             scene_file,
             serve_preview_stride,
-            resource_monitoring_mode);
+            resource_monitoring_mode,
+            serve_solver_threads,
+            serve_env_count,
+            serve_env_threads,
+            serve_lidar_threads);
     }
 
     if (interactive) {
@@ -141,7 +141,7 @@ bool ConservativeAdvanceRecover(
         const EpaVertex sb = Support(a, b, -normal);
         outWitnessA = 0.5 * (sa.pointA + sb.pointA);
         outWitnessB = 0.5 * (sa.pointB + sb.pointB);
-        outDepth = std::max(0.0, Dot(sa.pointA - sa.pointB, normal));
+        outDepth = std::max<Real>(0.0, Dot(sa.pointA - sa.pointB, normal));
         return outDepth > 0.0;
     }
 
@@ -171,7 +171,7 @@ bool ConservativeAdvanceRecover(
     }
 
     const Real geometricDepth = Dot(outWitnessA - outWitnessB, normal);
-    outDepth = std::max(geometricDepth, hi * 2.0);
+    outDepth = std::max<Real>(geometricDepth, hi * 2.0);
     return outDepth > 0.0;
 }
 
@@ -316,9 +316,9 @@ EpaPenetrationResult ComputePenetrationEPA(const ConvexSupport& a, const ConvexS
                 v = (d11 * d20 - d01 * d21) / denom;
                 w = (d00 * d21 - d01 * d20) / denom;
                 u = 1.0 - v - w;
-                u = std::clamp(u, 0.0, 1.0);
-                v = std::clamp(v, 0.0, 1.0);
-                w = std::clamp(w, 0.0, 1.0);
+                u = std::clamp<Real>(u, 0.0, 1.0);
+                v = std::clamp<Real>(v, 0.0, 1.0);
+                w = std::clamp<Real>(w, 0.0, 1.0);
                 const Real sum = u + v + w;
                 if (sum > kEpsilon) {
                     const Real inv = 1.0 / sum;
@@ -334,7 +334,7 @@ EpaPenetrationResult ComputePenetrationEPA(const ConvexSupport& a, const ConvexS
 
             out.witnessA = u * va.pointA + v * vb.pointA + w * vc.pointA;
             out.witnessB = u * va.pointB + v * vb.pointB + w * vc.pointB;
-            out.depth = std::max(0.0, Dot(out.witnessA - out.witnessB, face.normal));
+            out.depth = std::max<Real>(0.0, Dot(out.witnessA - out.witnessB, face.normal));
             out.normal = face.normal;
             if (Dot(b.Position() - a.Position(), out.normal) < 0.0) {
                 out.normal = -out.normal;
@@ -29,14 +29,14 @@ ClosestPointResult ClosestOnSegment(const GjkSimplex& simplex) {
     const Real denom = Dot(ab, ab);
     Real t = 0.0;
     if (denom > kEpsilon) {
-        t = std::clamp(-Dot(a, ab) / denom, 0.0, 1.0);
+        t = std::clamp<Real>(-Dot(a, ab) / denom, 0.0, 1.0);
     }
     const Vec3 p = a + t * ab;
 
     ClosestPointResult out;
     out.count = 2;
     out.indices = {0, 1, 0, 0};
-    out.weights = {1.0 - t, t, 0.0, 0.0};
+    out.weights = {Real(1) - t, t, 0.0, 0.0};
     out.closest = p;
     out.distanceSq = Dot(p, p);
     return out;
@@ -82,7 +82,7 @@ ClosestPointResult ClosestOnTriangle(const GjkSimplex& simplex) {
         ClosestPointResult out;
         out.count = 2;
         out.indices = {0, 1, 0, 0};
-        out.weights = {1.0 - v, v, 0.0, 0.0};
+        out.weights = {Real(1) - v, v, 0.0, 0.0};
         out.closest = p;
         out.distanceSq = Dot(p, p);
         return out;
@@ -108,7 +108,7 @@ ClosestPointResult ClosestOnTriangle(const GjkSimplex& simplex) {
         ClosestPointResult out;
         out.count = 2;
         out.indices = {0, 2, 0, 0};
-        out.weights = {1.0 - w, 0.0, w, 0.0};
+        out.weights = {Real(1) - w, 0.0, w, 0.0};
         out.closest = p;
         out.distanceSq = Dot(p, p);
         return out;
@@ -121,7 +121,7 @@ ClosestPointResult ClosestOnTriangle(const GjkSimplex& simplex) {
         ClosestPointResult out;
         out.count = 2;
         out.indices = {1, 2, 0, 0};
-        out.weights = {1.0 - w, w, 0.0, 0.0};
+        out.weights = {Real(1) - w, w, 0.0, 0.0};
         out.closest = p;
         out.distanceSq = Dot(p, p);
         return out;
@@ -304,7 +304,7 @@ GjkDistanceResult GjkDistance(const ConvexSupport& a, const ConvexSupport& b, co
         if (progress <= settings.supportEpsilon || std::abs(lastDistanceSq - distSq) <= settings.distanceEpsilon * settings.distanceEpsilon) {
             result.valid = true;
             result.intersecting = false;
-            result.distance = std::sqrt(std::max(distSq, 0.0));
+            result.distance = std::sqrt(std::max<Real>(distSq, 0.0));
             result.closestA = closestA;
             result.closestB = closestB;
             result.separatingAxis = -dir;
@@ -328,7 +328,7 @@ GjkDistanceResult GjkDistance(const ConvexSupport& a, const ConvexSupport& b, co
         if (duplicate) {
             result.valid = true;
             result.intersecting = false;
-            result.distance = std::sqrt(std::max(distSq, 0.0));
+            result.distance = std::sqrt(std::max<Real>(distSq, 0.0));
             result.closestA = closestA;
             result.closestB = closestB;
             result.separatingAxis = -dir;
@@ -41,8 +41,8 @@ Block2SolveResult SolveBlock2NormalLcp(const Block2SolveInput& input) {
         }
     }
 
-    const Real old0 = std::max(input.contacts[0].oldImpulse, 0.0);
-    const Real old1 = std::max(input.contacts[1].oldImpulse, 0.0);
+    const Real old0 = std::max<Real>(input.contacts[0].oldImpulse, 0.0);
+    const Real old1 = std::max<Real>(input.contacts[1].oldImpulse, 0.0);
     const Real q0 = input.contacts[0].rhs + k11 * old0 + k12 * old1;
     const Real q1 = input.contacts[1].rhs + k12 * old0 + k22 * old1;
 
@@ -67,18 +67,18 @@ Block2SolveResult SolveBlock2NormalLcp(const Block2SolveInput& input) {
         }
     }
     if (!solved && k11 > 1e-8) {
-        const auto w = residualW(std::max(0.0, q0 / k11), 0.0);
+        const auto w = residualW(std::max<Real>(0.0, q0 / k11), 0.0);
         if (w[1] >= -lcpEpsilon) {
-            new0 = std::max(0.0, q0 / k11);
+            new0 = std::max<Real>(0.0, q0 / k11);
             new1 = 0.0;
             solved = true;
         }
     }
     if (!solved && k22 > 1e-8) {
-        const auto w = residualW(0.0, std::max(0.0, q1 / k22));
+        const auto w = residualW(0.0, std::max<Real>(0.0, q1 / k22));
         if (w[0] >= -lcpEpsilon) {
             new0 = 0.0;
-            new1 = std::max(0.0, q1 / k22);
+            new1 = std::max<Real>(0.0, q1 / k22);
             solved = true;
         }
     }
@@ -100,8 +100,8 @@ Block2SolveResult SolveBlock2NormalLcp(const Block2SolveInput& input) {
         return result;
     }
 
-    new0 = std::max(0.0, new0);
-    new1 = std::max(0.0, new1);
+    new0 = std::max<Real>(0.0, new0);
+    new1 = std::max<Real>(0.0, new1);
     result.success = true;
     result.solvedImpulses = {new0, new1};
     result.impulseDeltas = {new0 - old0, new1 - old1};
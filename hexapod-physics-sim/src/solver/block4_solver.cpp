@@ -37,7 +37,7 @@ Block4SolveResult SolveBlock4ProjectedGaussSeidel(const Block4SolveInput& input)
     for (int i = 0; i < 4; ++i) {
         raCrossN[i] = Cross(input.contacts[i].ra, input.contacts[i].normal);
         rbCrossN[i] = Cross(input.contacts[i].rb, input.contacts[i].normal);
-        oldLambda[i] = std::max(input.contacts[i].oldImpulse, 0.0);
+        oldLambda[i] = std::max<Real>(input.contacts[i].oldImpulse, 0.0);
     }
 
     for (int i = 0; i < 4; ++i) {
@@ -56,7 +56,7 @@ Block4SolveResult SolveBlock4ProjectedGaussSeidel(const Block4SolveInput& input)
             return result;
         }
         for (int j = i + 1; j < 4; ++j) {
-            const Real scale = std::max(1.0, std::max(std::abs(K[i][j]), std::abs(K[j][i])));
+            const Real scale = std::max<Real>(1.0, std::max(std::abs(K[i][j]), std::abs(K[j][i])));
             if (std::abs(K[i][j] - K[j][i]) > input.symmetryTolerance * scale) {
                 result.fallbackReason = BlockSolveFallbackCode::DegenerateMassMatrix;
                 return result;
@@ -138,7 +138,7 @@ Block4SolveResult SolveBlock4ProjectedGaussSeidel(const Block4SolveInput& input)
         for (int i = 0; i < 4; ++i) {
             Real sum = 0.0;
             for (int j = 0; j < 4; ++j) if (i != j) sum += K[i][j] * lambda[j];
-            const Real nv = std::max(0.0, (rhs[i] - sum) / diagonal[i]);
+            const Real nv = std::max<Real>(0.0, (rhs[i] - sum) / diagonal[i]);
             maxDelta = std::max(maxDelta, std::abs(nv - lambda[i]));
             lambda[i] = nv;
         }
@@ -153,7 +153,7 @@ Block4SolveResult SolveBlock4ProjectedGaussSeidel(const Block4SolveInput& input)
             result.fallbackReason = BlockSolveFallbackCode::NonFiniteResult;
             return result;
         }
-        residual = std::max(residual, std::max(std::max(0.0, -wi), std::abs(lambda[i] * wi)));
+        residual = std::max(residual, std::max(std::max<Real>(0.0, -wi), std::abs(lambda[i] * wi)));
     }
     const Real residualThreshold = std::max(5e-4, 20.0 * input.face4ProjectedGaussSeidelEpsilon);
     if (residual > residualThreshold) {
@@ -0,0 +1,123 @@
+#include "minphys3d/solver/constraint_coloring.hpp"
+
+#include <algorithm>
+
+namespace minphys3d::solver_internal {
+namespace {
+
+constexpr std::uint8_t kMaxRepresentableColors = 64;
+
+// Colours rows in the given order. `rowBodies(row, a, b)` yields the two body ids of a row. Rows
+// that find no free colour below `maxColors` land in a trailing batch flagged sequential.
+template <typename RowBodies>
+void ColorRows(const std::vector<std::size_t>& rows,
+               const std::vector<Body>& bodies,
+               std::uint8_t maxColors,
+               RowBodies&& rowBodies,
+               ConstraintColoring& out,
+               std::vector<std::uint64_t>& bodyColorMask) {
+    out.indices.clear();
+    out.colorOffsets.clear();
+    out.lastColorSequential = false;
+    if (rows.empty()) {
+        return;
+    }
+
+    // Static and sleeping bodies never receive impulses, so they do not constrain colouring.
+    const auto participates = [&](std::uint32_t id) {
+        return bodies[id].invMass != 0.0 && !bodies[id].isSleeping;
+    };
+
+    std::vector<std::uint8_t> rowColor(rows.size(), 0);
+    std::vector<std::uint32_t> colorCounts(static_cast<std::size_t>(maxColors) + 1u, 0u);
+    std::uint8_t usedColors = 0;
+    bool overflow = false;
+    for (std::size_t r = 0; r < rows.size(); ++r) {
+        std::uint32_t a = 0;
+        std::uint32_t b = 0;
+        rowBodies(rows[r], a, b);
+        const bool aActive = participates(a);
+        const bool bActive = participates(b);
+        const std::uint64_t taken = (aActive ? bodyColorMask[a] : 0u) | (bActive ? bodyColorMask[b] : 0u);
+        std::uint8_t color = 0;
+        while (color < maxColors && (taken & (std::uint64_t{1} << color)) != 0u) {
+            ++color;
+        }
+        if (color == maxColors) {
+            overflow = true;
+        } else {
+            const std::uint64_t bit = std::uint64_t{1} << color;
+            if (aActive) {
+                bodyColorMask[a] |= bit;
+            }
+            if (bActive) {
+                bodyColorMask[b] |= bit;
+            }
+            usedColors = std::max<std::uint8_t>(usedColors, static_cast<std::uint8_t>(color + 1u));
+        }
+        rowColor[r] = color;
+        ++colorCounts[color];
+    }
+
+    // Counting sort by colour keeps the input order within each colour.
+    const std::size_t colorCount = static_cast<std::size_t>(usedColors) + (overflow ? 1u : 0u);
+    out.colorOffsets.resize(colorCount + 1u, 0u);
+    for (std::size_t c = 0; c < colorCount; ++c) {
+        const std::size_t source = (overflow && c + 1u == colorCount) ? maxColors : c;
+        out.colorOffsets[c + 1u] = out.colorOffsets[c] + colorCounts[source];
+    }
+    out.indices.resize(rows.size());
+    std::vector<std::uint32_t> cursor(out.colorOffsets.begin(), out.colorOffsets.end() - 1);
+    for (std::size_t r = 0; r < rows.size(); ++r) {
+        const std::size_t slot = rowColor[r] == maxColors ? colorCount - 1u : rowColor[r];
+        out.indices[cursor[slot]++] = rows[r];
+    }
+    out.lastColorSequential = overflow;
+
+    for (std::size_t row : rows) {
+        std::uint32_t a = 0;
+        std::uint32_t b = 0;
+        rowBodies(row, a, b);
+        bodyColorMask[a] = 0u;
+        bodyColorMask[b] = 0u;
+    }
+}
+
+} // namespace
+
+void ComputeIslandColoring(const Island& island,
+                           const IslandOrderResult& order,
+                           const std::vector<Body>& bodies,
+                           const std::vector<Manifold>& manifolds,
+                           const std::vector<HingeJoint>& hingeJoints,
+                           const std::vector<ServoJoint>& servoJoints,
+                           bool colorContacts,
+                           bool colorJoints,
+                           std::uint8_t maxColors,
+                           IslandColoring& out,
+                           std::vector<std::uint64_t>& bodyColorMaskScratch) {
+    maxColors = std::clamp<std::uint8_t>(maxColors, 1u, kMaxRepresentableColors);
+    bodyColorMaskScratch.resize(bodies.size(), 0u);
+    static const std::vector<std::size_t> kNoRows;
+
+    ColorRows(colorContacts ? order.manifoldOrder : kNoRows, bodies, maxColors,
+              [&](std::size_t mi, std::uint32_t& a, std::uint32_t& b) {
+                  a = manifolds[mi].a;
+                  b = manifolds[mi].b;
+              },
+              out.manifolds, bodyColorMaskScratch);
+    ColorRows(colorJoints ? island.hinges : kNoRows, bodies, maxColors,
+              [&](std::size_t hi, std::uint32_t& a, std::uint32_t& b) {
+                  a = hingeJoints[hi].a;
+                  b = hingeJoints[hi].b;
+              },
+              out.hinges, bodyColorMaskScratch);
+    ColorRows(colorJoints ? island.servos : kNoRows, bodies, maxColors,
+              [&](std::size_t si, std::uint32_t& a, std::uint32_t& b) {
+                  a = servoJoints[si].a;
+                  b = servoJoints[si].b;
+              },
+              out.servos, bodyColorMaskScratch);
+}
+
+} // namespace minphys3d::solver_internal
@@ -15,6 +15,7 @@
 #include "minphys3d/core/subsystems.hpp"
 #include "minphys3d/core/world.hpp"
 #include "minphys3d/demo/hexapod_scene.hpp"
+#include "minphys3d/demo/hexapod_stability.hpp"
 #include "minphys3d/math/spatial.hpp"
 #include "minphys3d/math/vec3.hpp"
 #include "minphys3d/math/mat3.hpp"
@@ -572,6 +573,7 @@ static void test_ArticulationConfig_roundTrip() {
     cfg.enableVelocityPreCorrectionForwardCoriolis              = true;
     cfg.enableSameAxisTwoDofShortcut                            = true;
     cfg.includeServoPdBiasInArticulationU                       = false;
+    cfg.enableReducedCoordinateTrees                            = true;
     world.SetArticulationConfig(cfg);
     const World::ArticulationConfig out = world.GetArticulationConfig();
     check(out.enableVelocityPreCorrection, "ArticulationConfig round-trip: velocity pre-correction");
@@ -592,6 +594,7 @@ static void test_ArticulationConfig_roundTrip() {
           "ArticulationConfig round-trip: same-axis 2-DOF shortcut flag");
     check(!out.includeServoPdBiasInArticulationU,
           "ArticulationConfig round-trip: includeServoPdBiasInArticulationU");
+    check(out.enableReducedCoordinateTrees, "ArticulationConfig round-trip: reduced-coordinate trees");
 }
 
 static void test_ABI_chain_u_nonzero_withServoBias() {
@@ -1136,6 +1139,99 @@ static void test_contact_heavy_hexapod_disables_passC() {
 #endif
 }
 
+static Real maxServoAnchorGap(const World& world) {
+    Real gap = 0.0;
+    for (std::uint32_t ji = 0; ji < world.GetServoJointCount(); ++ji) {
+        const ServoJoint& joint = world.GetServoJoint(ji);
+        const Body& a = world.GetBody(joint.a);
+        const Body& b = world.GetBody(joint.b);
+        gap = std::max(gap, Length((b.position + Rotate(b.orientation, joint.localAnchorB))
+                                   - (a.position + Rotate(a.orientation, joint.localAnchorA))));
+    }
+    return gap;
+}
+
+// Reduced-coordinate trees: a free-swinging pendulum on a static anchor stays on its circle
+// with one solver iteration, and its velocity stays tangential.
+static void test_ReducedTrees_pendulum_stays_on_joint() {
+    World world({0.0, -9.81, 0.0});
+    Body anchor;
+    anchor.shape = ShapeType::Box;
+    anchor.halfExtents = {0.05, 0.05, 0.05};
+    anchor.mass = 1.0;
+    anchor.isStatic = true;
+    anchor.position = {0.0, 1.0, 0.0};
+    const std::uint32_t anchorId = world.CreateBody(anchor);
+    Body bob;
+    bob.shape = ShapeType::Sphere;
+    bob.radius = 0.05;
+    bob.mass = 0.5;
+    bob.position = {0.0, 1.0, 0.5};
+    const std::uint32_t bobId = world.CreateBody(bob);
+    (void)world.CreateServoJoint(anchorId, bobId, {0.0, 1.0, 0.0}, {1.0, 0.0, 0.0},
+                                 /*targetAngle=*/0.0, /*maxTorque=*/0.0);
+
+    World::ArticulationConfig cfg{};
+    cfg.enableReducedCoordinateTrees = true;
+    world.SetArticulationConfig(cfg);
+    for (int i = 0; i < 60; ++i) {
+        world.Step(1.0 / 240.0, 1);
+    }
+
+    const std::vector<ReducedArtTree>& trees = world.GetReducedArticulationTrees();
+    check(trees.size() == 1u, "Reduced pendulum: one tree");
+    check(trees[0].links.size() == 2u && trees[0].active, "Reduced pendulum: active two-link tree");
+    check(!trees[0].floatingBase, "Reduced pendulum: static anchor is a fixed base");
+    const Body& b = world.GetBody(bobId);
+    assertBodyKinematicsFinite(b);
+    check(b.position.y < 0.9, "Reduced pendulum: bob swings down");
+    check(maxServoAnchorGap(world) < 1e-4, "Reduced pendulum: anchor gap stays closed");
+    const Vec3 radial = Normalize(b.position - Vec3{0.0, 1.0, 0.0});
+    // Velocities are projected at the start of the substep, so they lag the pose by ω·dt.
+    check(std::abs(Dot(b.velocity, radial)) < 0.05 * Length(b.velocity),
+          "Reduced pendulum: velocity is tangential");
+}
+
+// Reduced-coordinate trees on the pose-hold stability scene: the six legs merge into one
+// floating-base tree and hold the stance at a fraction of the default iteration count with
+// closed joints.
+static void test_ReducedTrees_hexapod_pose_hold() {
+    World world(Vec3{0.0, -9.81, 0.0});
+    const HexapodSceneObjects scene = BuildHexapodScene(world);
+    RelaxBuiltInHexapodServos(world, scene);
+    ApplyHexapodPoseHoldStabilityTuning(world, scene);
+    World::ArticulationConfig cfg = world.GetArticulationConfig();
+    cfg.enableReducedCoordinateTrees = true;
+    world.SetArticulationConfig(cfg);
+
+    constexpr int kFrames = 240;
+    constexpr int kIterations = 8;
+    const Real subDt = (1.0 / 60.0) / static_cast<Real>(kHexapodPoseHoldBenchmarkSubstepsPerFrame);
+    HexapodPoseHoldMetrics metrics{};
+    Real maxGap = 0.0;
+    for (int frame = 0; frame < kFrames; ++frame) {
+        for (int sub = 0; sub < kHexapodPoseHoldBenchmarkSubstepsPerFrame; ++sub) {
+            world.Step(subDt, kIterations);
+            maxGap = std::max(maxGap, maxServoAnchorGap(world));
+            AccumulateHexapodPoseHoldFromSubstep(world, scene, scene.body, frame, metrics);
+        }
+    }
+    FinalizeHexapodPoseHold(world.GetBody(scene.body), metrics);
+
+    const std::vector<ReducedArtTree>& trees = world.GetReducedArticulationTrees();
+    check(trees.size() == 1u, "Reduced hexapod: legs merge into one tree");
+    check(trees[0].links.size() == 19u, "Reduced hexapod: chassis + 18 leg links");
+    check(trees[0].links[0].bodyIdx == scene.body, "Reduced hexapod: chassis is the root");
+    check(trees[0].floatingBase && trees[0].active, "Reduced hexapod: active floating-base tree");
+    for (std::uint32_t bi = 0; bi < world.GetBodyCount(); ++bi) {
+        assertBodyKinematicsFinite(world.GetBody(bi));
+    }
+    check(maxGap < 1e-3, "Reduced hexapod: servo anchors stay closed");
+    check(metrics.peakJointErrorRad < 0.02, "Reduced hexapod: joints hold their targets");
+    check(metrics.peakLinearSettled < 0.02, "Reduced hexapod: chassis settles");
+    check(metrics.finalPosition.y > 0.09, "Reduced hexapod: chassis stays up");
+}
+
 // ---------------------------------------------------------------------------
 // main
 // ---------------------------------------------------------------------------
@@ -1240,6 +1336,12 @@ int main() {
     std::printf("test_BuildArticulationChains_Hexapod...\n");
     test_BuildArticulationChains_Hexapod();
 
+    std::printf("test_ReducedTrees_pendulum_stays_on_joint...\n");
+    test_ReducedTrees_pendulum_stays_on_joint();
+
+    std::printf("test_ReducedTrees_hexapod_pose_hold...\n");
+    test_ReducedTrees_hexapod_pose_hold();
+
     std::printf("All articulation tests PASSED.\n");
     return 0;
 }
@@ -1,5 +1,11 @@
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
 
 #include "minphys3d/core/world.hpp"
 
@@ -23,9 +29,89 @@ CompoundChild MakeBoxChild(const Vec3& halfExtents, const Vec3& localPosition) {
     return child;
 }
 
+// 4 x 4 x 4 grid of alternating boxes and spheres, `spacing` apart, centred on the body origin.
+Body MakeGridCompound(const Vec3& position, Real spacing) {
+    Body body;
+    body.shape = ShapeType::Compound;
+    body.mass = 4.0;
+    body.position = position;
+    const Real half = 0.5 * spacing;
+    for (int x = 0; x < 4; ++x) {
+        for (int y = 0; y < 4; ++y) {
+            for (int z = 0; z < 4; ++z) {
+                const Vec3 local{(x - 1.5) * spacing, (y - 1.5) * spacing, (z - 1.5) * spacing};
+                if ((x + y + z) % 2 == 0) {
+                    body.compoundChildren.push_back(MakeBoxChild({half, half, half}, local));
+                } else {
+                    body.compoundChildren.push_back(MakeSphereChild(half, local));
+                }
+            }
+        }
+    }
+    return body;
+}
+
+// Static 8 x 8 slab of boxes, `cell` wide and 0.1 thick, with its top face at y = 0.05.
+Body MakeSlabCompound(Real cell) {
+    Body body;
+    body.shape = ShapeType::Compound;
+    body.isStatic = true;
+    for (int x = 0; x < 8; ++x) {
+        for (int z = 0; z < 8; ++z) {
+            body.compoundChildren.push_back(
+                MakeBoxChild({0.5 * cell, 0.05, 0.5 * cell}, {(x - 3.5) * cell, 0.0, (z - 3.5) * cell}));
+        }
+    }
+    return body;
+}
+
+// Eight 64-child compounds dropped in two layers onto a 64-child slab; wall time of the run and
+// of the compound contact section, best of `rounds`.
+void BenchmarkLargeCompounds(int rounds) {
+    constexpr int kSteps = 240;
+    double bestStepMs = 1e300;
+    double bestCompoundMs = 1e300;
+    std::uint32_t peakShapePairs = 0;
+    for (int round = 0; round < rounds; ++round) {
+        World world({0.0, -9.81, 0.0});
+        world.CreateBody(MakeSlabCompound(0.5));
+        for (int layer = 0; layer < 2; ++layer) {
+            for (int i = 0; i < 4; ++i) {
+                const Vec3 position{(i % 2 == 0) ? -0.6 : 0.6, 0.4 + 0.7 * layer, (i < 2) ? -0.6 : 0.6};
+                world.CreateBody(MakeGridCompound(position, 0.12));
+            }
+        }
+        world.SetResourceMonitoringMode(ResourceMonitoringMode::Full);
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int step = 0; step < kSteps; ++step) {
+            world.Step(1.0 / 120.0, 12);
+            peakShapePairs = std::max(peakShapePairs, world.GetNarrowphaseStats().lastCompoundShapePairs);
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+        bestStepMs = std::min(bestStepMs, std::chrono::duration<double, std::milli>(t1 - t0).count());
+        const world_resource_monitoring::SectionSummary summary = world.SnapshotFullResourceSections(false);
+        for (std::size_t i = 0; i < summary.count; ++i) {
+            if (summary.sections[i].label != nullptr
+                && std::string_view(summary.sections[i].label) == "world.generate_contacts.compound") {
+                bestCompoundMs =
+                    std::min(bestCompoundMs, static_cast<double>(summary.sections[i].total_self_ns) / 1.0e6);
+            }
+        }
+    }
+    std::cout << std::fixed << std::setprecision(3) << "large compound benchmark: 8 x 64-child compounds on a "
+              << "64-child slab, " << kSteps << " steps (best of " << rounds << " rounds)\n"
+              << "  step_ms=" << bestStepMs << " compound_ms=" << bestCompoundMs
+              << " peak_child_pairs=" << peakShapePairs << "\n";
+}
+
 } // namespace
 
-int main() {
+int main(int argc, char** argv) {
+    if (argc >= 2 && std::string_view(argv[1]) == "--bench") {
+        BenchmarkLargeCompounds(argc >= 3 ? std::max(1, std::atoi(argv[2])) : 5);
+        return 0;
+    }
+
     {
         World world({0.0, -9.81, 0.0});
 
@@ -105,5 +191,26 @@ int main() {
         assert(out.position.x > 0.0);
     }
 
+    {
+        // 64-child compound resting on a 64-child slab: only its bottom layer meets the slab, and
+        // the local BVHs keep the exact tests near that instead of all 64 x 64 child pairs.
+        World world({0.0, -9.81, 0.0});
+        world.CreateBody(MakeSlabCompound(0.25));
+        const std::uint32_t gridId = world.CreateBody(MakeGridCompound({0.0, 0.5, 0.0}, 0.1));
+
+        std::uint32_t peakShapePairs = 0;
+        for (int i = 0; i < 240; ++i) {
+            world.Step(1.0 / 120.0, 12);
+            peakShapePairs = std::max(peakShapePairs, world.GetNarrowphaseStats().lastCompoundShapePairs);
+        }
+
+        // Bottom children reach 0.2 below the grid centre; the slab top is at y = 0.05.
+        const Body& settled = world.GetBody(gridId);
+        assert(std::isfinite(settled.position.y));
+        assert(settled.position.y > 0.2 && settled.position.y < 0.3);
+        assert(peakShapePairs > 0u);
+        assert(peakShapePairs < 64u * 64u / 8u);
+    }
+
     return 0;
 }
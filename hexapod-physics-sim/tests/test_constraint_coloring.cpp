@@ -0,0 +1,172 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "minphys3d/core/world.hpp"
+#include "minphys3d/solver/constraint_coloring.hpp"
+
+namespace {
+
+using namespace minphys3d;
+using namespace minphys3d::solver_internal;
+
+Manifold MakeManifold(std::uint32_t a, std::uint32_t b) {
+    Manifold manifold;
+    manifold.a = a;
+    manifold.b = b;
+    return manifold;
+}
+
+// Every row appears exactly once, and no colour (except a sequential overflow colour) touches
+// the same dynamic body twice.
+void AssertValidColoring(const ConstraintColoring& coloring,
+                         const std::vector<std::size_t>& rows,
+                         const std::vector<Body>& bodies,
+                         const std::vector<Manifold>& manifolds) {
+    assert(coloring.indices.size() == rows.size());
+    std::vector<int> seen(manifolds.size(), 0);
+    for (std::size_t c = 0; c < coloring.ColorCount(); ++c) {
+        const bool sequential = coloring.lastColorSequential && c + 1 == coloring.ColorCount();
+        std::vector<int> touched(bodies.size(), 0);
+        for (std::uint32_t i = coloring.colorOffsets[c]; i < coloring.colorOffsets[c + 1]; ++i) {
+            const Manifold& m = manifolds[coloring.indices[i]];
+            ++seen[coloring.indices[i]];
+            for (const std::uint32_t id : {m.a, m.b}) {
+                if (bodies[id].invMass == 0.0) {
+                    continue;
+                }
+                assert(sequential || touched[id] == 0);
+                ++touched[id];
+            }
+        }
+    }
+    for (const std::size_t row : rows) {
+        assert(seen[row] == 1);
+    }
+}
+
+void TestChainColoring() {
+    std::vector<Body> bodies(6);
+    bodies[0].invMass = 0.0;
+    // 0 = ground; 1..5 dynamic. Ground contacts never conflict with each other.
+    const std::vector<Manifold> manifolds = {
+        MakeManifold(1, 2), MakeManifold(2, 3), MakeManifold(3, 4), MakeManifold(4, 5),
+        MakeManifold(0, 1), MakeManifold(0, 3), MakeManifold(0, 5)};
+
+    Island island{};
+    island.bodies = {0, 1, 2, 3, 4, 5};
+    IslandOrderResult order{};
+    order.manifoldOrder = {0, 1, 2, 3, 4, 5, 6};
+
+    IslandColoring coloring;
+    std::vector<std::uint64_t> scratch;
+    ComputeIslandColoring(island, order, bodies, manifolds, {}, {}, true, false, 32, coloring, scratch);
+
+    AssertValidColoring(coloring.manifolds, order.manifoldOrder, bodies, manifolds);
+    assert(!coloring.manifolds.lastColorSequential);
+    assert(coloring.manifolds.ColorCount() == 3);
+    // Greedy in manifold order, and each colour keeps that order.
+    assert((coloring.manifolds.indices == std::vector<std::size_t>{0, 2, 6, 1, 3, 4, 5}));
+    assert(coloring.hinges.ColorCount() == 0);
+    assert(coloring.servos.ColorCount() == 0);
+    for (const std::uint64_t mask : scratch) {
+        assert(mask == 0u);
+    }
+
+    // The island order is the tie-break: reversing it swaps which chain links claim colour 0.
+    IslandOrderResult reversed{};
+    reversed.manifoldOrder = {3, 2, 1, 0, 4, 5, 6};
+    ComputeIslandColoring(island, reversed, bodies, manifolds, {}, {}, true, false, 32, coloring, scratch);
+    AssertValidColoring(coloring.manifolds, reversed.manifoldOrder, bodies, manifolds);
+    assert(coloring.manifolds.indices[0] == 3);
+}
+
+void TestColorBudgetOverflow() {
+    std::vector<Body> bodies(6);
+    // Star: every manifold touches hub body 0, so each needs its own colour.
+    std::vector<Manifold> manifolds;
+    for (std::uint32_t leaf = 1; leaf < 6; ++leaf) {
+        manifolds.push_back(MakeManifold(0, leaf));
+    }
+    Island island{};
+    IslandOrderResult order{};
+    order.manifoldOrder = {0, 1, 2, 3, 4};
+
+    IslandColoring coloring;
+    std::vector<std::uint64_t> scratch;
+    ComputeIslandColoring(island, order, bodies, manifolds, {}, {}, true, false, 2, coloring, scratch);
+    AssertValidColoring(coloring.manifolds, order.manifoldOrder, bodies, manifolds);
+    assert(coloring.manifolds.ColorCount() == 3);
+    assert(coloring.manifolds.lastColorSequential);
+    assert(coloring.manifolds.colorOffsets[3] - coloring.manifolds.colorOffsets[2] == 3);
+}
+
+World BuildBoxRowIsland() {
+    World world({0.0, -9.81, 0.0});
+    Body plane;
+    plane.shape = ShapeType::Plane;
+    plane.planeNormal = {0.0, 1.0, 0.0};
+    world.CreateBody(plane);
+    // Touching boxes side by side plus a second layer: a single island with many manifolds.
+    for (int layer = 0; layer < 2; ++layer) {
+        for (int i = 0; i < 8; ++i) {
+            Body box;
+            box.shape = ShapeType::Box;
+            box.halfExtents = {0.25, 0.25, 0.25};
+            box.mass = 1.0;
+            box.position = {-1.75 + 0.5 * static_cast<Real>(i) + 0.25 * static_cast<Real>(layer),
+                            0.25 + 0.5 * static_cast<Real>(layer), 0.0};
+            world.CreateBody(box);
+        }
+    }
+    ContactSolverConfig config = world.GetContactSolverConfig();
+    config.coloring.enabled = true;
+    config.coloring.minIslandRows = 0;
+    config.coloring.minRowsPerThread = 1;
+    world.SetContactSolverConfig(config);
+    return world;
+}
+
+bool SameBits(const Vec3& a, const Vec3& b) {
+    return std::memcmp(&a, &b, sizeof(Vec3)) == 0;
+}
+
+void TestColoredSolveIsThreadCountInvariant() {
+    World serial = BuildBoxRowIsland();
+    World parallel = BuildBoxRowIsland();
+    World::ParallelSolveConfig parallelConfig;
+    parallelConfig.threadCount = 4;
+    parallel.SetParallelSolveConfig(parallelConfig);
+
+    std::uint32_t maxColors = 0;
+    for (int step = 0; step < 120; ++step) {
+        serial.Step(1.0 / 120.0, 12);
+        parallel.Step(1.0 / 120.0, 12);
+        const World::TopologySnapshot topology = parallel.SnapshotTopology();
+        maxColors = std::max(maxColors, topology.maxIslandContactColorCount);
+        for (std::uint32_t id = 1; id < serial.GetBodyCount(); ++id) {
+            const Body& a = serial.GetBody(id);
+            const Body& b = parallel.GetBody(id);
+            if (!SameBits(a.position, b.position) || !SameBits(a.velocity, b.velocity)
+                || !SameBits(a.angularVelocity, b.angularVelocity)) {
+                std::cerr << "coloured solve diverged between 1 and 4 threads at step " << step << " body " << id
+                          << "\n";
+                assert(false);
+            }
+        }
+    }
+    assert(maxColors > 1);
+}
+
+} // namespace
+
+int main() {
+    TestChainColoring();
+    TestColorBudgetOverflow();
+    TestColoredSolveIsThreadCountInvariant();
+    std::cout << "test_constraint_coloring: PASS\n";
+    return 0;
+}
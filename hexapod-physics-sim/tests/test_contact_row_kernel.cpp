@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+
+#include "minphys3d/core/world.hpp"
+
+namespace {
+
+using namespace minphys3d;
+
+// `ContactRowKernel::Wide4` against the scalar kernel. Lanes replay the scalar row arithmetic in
+// the same order, so the tolerance below is zero: any drift means a lane diverged from its row.
+constexpr Real kAgreementTolerance = 0.0;
+
+void AddGround(World& world) {
+    Body plane;
+    plane.shape = ShapeType::Plane;
+    plane.planeNormal = {0.0, 1.0, 0.0};
+    world.CreateBody(plane);
+}
+
+void AddBox(World& world, const Vec3& position, const Vec3& halfExtents, Real mass, Real restitution = 0.2) {
+    Body box;
+    box.shape = ShapeType::Box;
+    box.position = position;
+    box.halfExtents = halfExtents;
+    box.mass = mass;
+    box.restitution = restitution;
+    world.CreateBody(box);
+}
+
+// Same layout as the regression suite's "tall stack tower": one island whose contact colours
+// hold three to four manifolds each.
+void BuildTallStack(World& world) {
+    AddGround(world);
+    for (int i = 0; i < 7; ++i) {
+        const Real x = (i % 2 == 0) ? 0.012 : -0.012;
+        AddBox(world, {x, 0.55 + 0.44 * static_cast<Real>(i), 0.0}, {0.28, 0.20, 0.28}, 1.0 + 0.15 * static_cast<Real>(i));
+    }
+}
+
+// Two layers of touching boxes: side contacts and stacked contacts in one wide island.
+void BuildBoxRows(World& world) {
+    AddGround(world);
+    for (int layer = 0; layer < 2; ++layer) {
+        for (int i = 0; i < 8; ++i) {
+            AddBox(world,
+                   {-1.75 + 0.5 * static_cast<Real>(i) + 0.25 * static_cast<Real>(layer),
+                    0.25 + 0.5 * static_cast<Real>(layer) + 0.05,
+                    0.0},
+                   {0.25, 0.25, 0.25},
+                   1.0 + 0.1 * static_cast<Real>(i),
+                   layer == 1 ? 0.3 : 0.2);
+        }
+    }
+}
+
+void Configure(World& world,
+               ContactRowKernel kernel,
+               const std::function<void(ContactSolverConfig&)>& tweak,
+               std::uint32_t threads) {
+    ContactSolverConfig config = world.GetContactSolverConfig();
+    config.coloring.enabled = true;
+    config.coloring.minIslandRows = 0;
+    config.coloring.minRowsPerThread = 1;
+    config.rowKernel = kernel;
+    if (tweak) {
+        tweak(config);
+    }
+    world.SetContactSolverConfig(config);
+    if (threads > 1) {
+        World::ParallelSolveConfig parallel;
+        parallel.threadCount = threads;
+        world.SetParallelSolveConfig(parallel);
+    }
+}
+
+Real MaxDeviation(const World& a, const World& b) {
+    Real deviation = 0.0;
+    const auto update = [&](const Vec3& u, const Vec3& v) {
+        deviation = std::max({deviation, std::abs(u.x - v.x), std::abs(u.y - v.y), std::abs(u.z - v.z)});
+    };
+    for (std::uint32_t id = 0; id < a.GetBodyCount(); ++id) {
+        const Body& ba = a.GetBody(id);
+        const Body& bb = b.GetBody(id);
+        update(ba.position, bb.position);
+        update(ba.velocity, bb.velocity);
+        update(ba.angularVelocity, bb.angularVelocity);
+    }
+    return deviation;
+}
+
+void ExpectAgreement(const char* name,
+                     const std::function<void(World&)>& build,
+                     const std::function<void(ContactSolverConfig&)>& tweak,
+                     std::uint32_t wideThreads,
+                     int steps) {
+    World scalar(Vec3{0.0, -9.81, 0.0});
+    World wide(Vec3{0.0, -9.81, 0.0});
+    build(scalar);
+    build(wide);
+    Configure(scalar, ContactRowKernel::Scalar, tweak, 1);
+    Configure(wide, ContactRowKernel::Wide4, tweak, wideThreads);
+
+    Real worst = 0.0;
+    std::uint64_t batches = 0;
+    std::uint64_t lanes = 0;
+    for (int step = 0; step < steps; ++step) {
+        scalar.Step(1.0 / 120.0, 12);
+        wide.Step(1.0 / 120.0, 12);
+        const Real deviation = MaxDeviation(scalar, wide);
+        worst = std::max(worst, deviation);
+        if (!(deviation <= kAgreementTolerance)) {
+            std::cerr << name << ": Wide4 diverged from scalar at step " << step << " (max |delta| = " << deviation
+                      << ")\n";
+            assert(false);
+        }
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+        // Telemetry covers the last step. Routing and clamp counters follow the rows, so they
+        // must agree as well.
+        const World::SolverTelemetry& scalarTelemetry = scalar.GetSolverTelemetry();
+        const World::SolverTelemetry& wideTelemetry = wide.GetSolverTelemetry();
+        assert(scalarTelemetry.contactRowBatches4 == 0);
+        assert(scalarTelemetry.blockSolveUsed == wideTelemetry.blockSolveUsed);
+        assert(scalarTelemetry.scalarPathIneligible == wideTelemetry.scalarPathIneligible);
+        assert(scalarTelemetry.anchorReuseHitCount == wideTelemetry.anchorReuseHitCount);
+        assert(scalarTelemetry.manifoldFrictionBudgetSaturated == wideTelemetry.manifoldFrictionBudgetSaturated);
+        assert(scalarTelemetry.tangentBasisReused == wideTelemetry.tangentBasisReused);
+        (void)scalarTelemetry;
+        batches += wideTelemetry.contactRowBatches4;
+        lanes += wideTelemetry.contactRowBatchLanes;
+#endif
+    }
+
+#if MINPHYS3D_SOLVER_TELEMETRY_ENABLED
+    assert(batches > 0);
+    assert(lanes >= 2 * batches);
+#endif
+    std::cout << name << ": batches=" << batches << " lanes=" << lanes << " max_delta=" << worst << "\n";
+}
+
+void TestTallStackDefaults() {
+    ExpectAgreement("tall stack", BuildTallStack, nullptr, 1, 240);
+}
+
+void TestBoxRowsSoftContactsAndRestitution() {
+    ExpectAgreement(
+        "box rows soft",
+        BuildBoxRows,
+        [](ContactSolverConfig& config) {
+            config.softContactBiasRate = 0.2;
+            config.softContactCompliance = 0.01;
+            config.restitutionVelocityCutoff = 0.05;
+            config.useSplitImpulse = false;
+            config.penetrationBiasFactor = 0.2;
+        },
+        1,
+        180);
+}
+
+void TestBoxRowsFrictionVariants() {
+    ExpectAgreement(
+        "box rows box-clamp",
+        BuildBoxRows,
+        [](ContactSolverConfig& config) {
+            config.frictionBudgetUseRadialClamp = false;
+            config.enableTwoAxisFrictionSolve = false;
+            config.useBlockSolver = false;
+        },
+        1,
+        180);
+}
+
+void TestWideKernelWithParallelColours() {
+    ExpectAgreement("box rows 4 threads", BuildBoxRows, nullptr, 4, 120);
+}
+
+} // namespace
+
+int main() {
+    TestTallStackDefaults();
+    TestBoxRowsSoftContactsAndRestitution();
+    TestBoxRowsFrictionVariants();
+    TestWideKernelWithParallelColours();
+    std::cout << "test_contact_row_kernel: PASS\n";
+    return 0;
+}
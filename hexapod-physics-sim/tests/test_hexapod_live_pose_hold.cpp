@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <iostream>
 
@@ -10,20 +12,43 @@ namespace {
 using namespace minphys3d;
 using namespace minphys3d::demo;
 
-HexapodPoseHoldMetrics RunLivePoseHoldScenario() {
+struct AdaptiveIterationUsage {
+    std::uint64_t iterations = 0;
+    std::uint64_t substeps = 0;
+    std::uint32_t minSubstepIterations = 0;
+    std::uint32_t maxSubstepIterations = 0;
+};
+
+HexapodPoseHoldMetrics RunLivePoseHoldScenario(bool adaptiveIterations = false,
+                                               AdaptiveIterationUsage* usage = nullptr) {
     World world({0.0, -9.81, 0.0});
     const HexapodSceneObjects scene = BuildHexapodScene(world);
     RelaxBuiltInHexapodServos(world, scene);
     ApplyHexapodPoseHoldStabilityTuning(world, scene);
+    if (adaptiveIterations) {
+        ContactSolverConfig config = world.GetContactSolverConfig();
+        config.convergence.enabled = true;
+        world.SetContactSolverConfig(config);
+    }
 
     HexapodPoseHoldMetrics metrics{};
     constexpr Real kFrameDt = 1.0 / 60.0;
+    if (usage != nullptr) {
+        usage->minSubstepIterations = static_cast<std::uint32_t>(kHexapodPoseHoldBenchmarkSolverIterations);
+    }
     for (int frame = 0; frame < 240; ++frame) {
         for (int substep = 0; substep < kHexapodPoseHoldBenchmarkSubstepsPerFrame; ++substep) {
             world.Step(
                 kFrameDt / static_cast<float>(kHexapodPoseHoldBenchmarkSubstepsPerFrame),
                 kHexapodPoseHoldBenchmarkSolverIterations);
             AccumulateHexapodPoseHoldFromSubstep(world, scene, scene.body, frame, metrics);
+            if (usage != nullptr) {
+                const World::SolverIterationStats& stats = world.GetSolverIterationStats();
+                usage->iterations += stats.lastStepIterations;
+                usage->substeps += stats.lastStepSubsteps;
+                usage->minSubstepIterations = std::min(usage->minSubstepIterations, stats.lastStepMaxSubstepIterations);
+                usage->maxSubstepIterations = std::max(usage->maxSubstepIterations, stats.lastStepMaxSubstepIterations);
+            }
         }
     }
 
@@ -68,5 +93,29 @@ int main() {
         return 1;
     }
 
+    // Residual-driven iteration count: stance frames do not converge below the default tolerances
+    // within the budget, so only substeps with nothing left to solve may stop early and the hold
+    // must match the fixed-count run.
+    AdaptiveIterationUsage usage{};
+    const minphys3d::demo::HexapodPoseHoldMetrics adaptive = RunLivePoseHoldScenario(true, &usage);
+    if (usage.maxSubstepIterations > static_cast<std::uint32_t>(kHexapodPoseHoldBenchmarkSolverIterations)
+        || usage.minSubstepIterations < minphys3d::SolverConvergenceConfig{}.minIterations
+        || usage.iterations > usage.substeps * kHexapodPoseHoldBenchmarkSolverIterations) {
+        std::cerr << "hex_live_hold adaptive iterations=" << usage.iterations << " substeps=" << usage.substeps
+                  << " min=" << usage.minSubstepIterations << " max=" << usage.maxSubstepIterations << "\n";
+        return 1;
+    }
+    constexpr minphys3d::Real kAdaptiveTolerance = 1.0e-3;
+    if (std::abs(adaptive.peakLinear - metrics.peakLinear) > kAdaptiveTolerance
+        || std::abs(adaptive.peakAngular - metrics.peakAngular) > kAdaptiveTolerance
+        || std::abs(adaptive.peakJointErrorRad - metrics.peakJointErrorRad) > kAdaptiveTolerance
+        || std::abs(adaptive.finalPosition.y - metrics.finalPosition.y) > kAdaptiveTolerance) {
+        std::cerr << "hex_live_hold adaptive peak_linear=" << adaptive.peakLinear << " fixed=" << metrics.peakLinear
+                  << " peak_angular=" << adaptive.peakAngular << " fixed=" << metrics.peakAngular
+                  << " peak_error=" << adaptive.peakJointErrorRad << " fixed=" << metrics.peakJointErrorRad
+                  << " final_y=" << adaptive.finalPosition.y << " fixed=" << metrics.finalPosition.y << "\n";
+        return 1;
+    }
+
     return 0;
 }
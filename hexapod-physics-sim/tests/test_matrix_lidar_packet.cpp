@@ -0,0 +1,172 @@
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+
+#include "demo/frame_sink.cpp"
+#include "demo/matrix_lidar_sim.cpp"
+#include "demo/scenes.cpp"
+#include "demo/terrain_patch.hpp"
+
+namespace {
+
+using namespace minphys3d;
+using namespace minphys3d::demo;
+
+bool Near(Real a, Real b, Real eps) {
+    return std::abs(a - b) <= eps;
+}
+
+Body StaticBody(ShapeType shape, const Vec3& position) {
+    Body body{};
+    body.shape = shape;
+    body.isStatic = true;
+    body.position = position;
+    body.radius = 0.1;
+    body.halfHeight = 0.2;
+    return body;
+}
+
+// Exact capsule / cylinder / half-cylinder hits, including rays that enter the AABB but miss the
+// rounded surface (the previous fallback reported those as AABB hits).
+void TestExactPrimitiveHits() {
+    const Vec3 down_z{0.0, 0.0, -1.0};
+    Real t = 0.0;
+
+    const Body capsule = StaticBody(ShapeType::Capsule, {});
+    assert(RayBodyHit(capsule, {0.0, 0.0, 2.0}, down_z, t) && Near(t, 1.9, 1.0e-9));
+    // Through the end cap: sphere of radius 0.1 at y = 0.2.
+    assert(RayBodyHit(capsule, {0.0, 0.25, 2.0}, down_z, t) && Near(t, 2.0 - std::sqrt(0.01 - 0.0025), 1.0e-9));
+    // Inside the AABB corner, outside the cap.
+    assert(!RayBodyHit(capsule, {0.09, 0.29, 2.0}, down_z, t));
+    // Origin inside: the exit point is reported.
+    assert(RayBodyHit(capsule, {0.0, 0.0, 0.0}, down_z, t) && Near(t, 0.1, 1.0e-9));
+
+    const Body cylinder = StaticBody(ShapeType::Cylinder, {});
+    assert(RayBodyHit(cylinder, {0.09, 0.0, 2.0}, down_z, t) && Near(t, 2.0 - std::sqrt(0.01 - 0.0081), 1.0e-9));
+    // Flat cap: straight down the axis.
+    assert(RayBodyHit(cylinder, {0.0, 2.0, 0.0}, {0.0, -1.0, 0.0}, t) && Near(t, 1.8, 1.0e-9));
+    // Diagonal ray 0.13 m from the axis: through the AABB corner, outside the round side.
+    const Vec3 diagonal = Normalize(Vec3{-1.0, 0.0, -1.0});
+    const Vec3 lateral = Normalize(Vec3{1.0, 0.0, -1.0});
+    assert(!RayBodyHit(cylinder, Vec3{2.0, 0.0, 2.0} + lateral * 0.13, diagonal, t));
+    assert(RayBodyHit(cylinder, Vec3{2.0, 0.0, 2.0} + lateral * 0.05, diagonal, t));
+
+    // Material is local z >= 0.
+    const Body half_cylinder = StaticBody(ShapeType::HalfCylinder, {});
+    const Vec3 down_x{-1.0, 0.0, 0.0};
+    assert(!RayBodyHit(half_cylinder, {2.0, 0.0, -0.05}, down_x, t));
+    assert(RayBodyHit(half_cylinder, {2.0, 0.0, 0.05}, down_x, t) && Near(t, 2.0 - std::sqrt(0.01 - 0.0025), 1.0e-9));
+
+    // Compound: the closest child wins.
+    Body compound = StaticBody(ShapeType::Compound, {});
+    CompoundChild far_child{};
+    far_child.shape = ShapeType::Box;
+    far_child.localPosition = {0.0, 0.0, -0.5};
+    far_child.halfExtents = {0.1, 0.1, 0.1};
+    CompoundChild near_child{};
+    near_child.shape = ShapeType::Capsule;
+    near_child.localPosition = {0.0, 0.0, 0.5};
+    near_child.radius = 0.05;
+    near_child.halfHeight = 0.1;
+    compound.compoundChildren = {far_child, near_child};
+    assert(RayBodyHit(compound, {0.0, 0.0, 2.0}, down_z, t) && Near(t, 1.45, 1.0e-9));
+    assert(RayBodyHit(compound, {0.0, 0.3, 2.0}, down_z, t) == false);
+}
+
+void AddObstacles(World& world, const Body& chassis) {
+    const Quat q = Normalize(chassis.orientation);
+    const Vec3 forward = Normalize(Rotate(q, Vec3{0.0, 0.0, -1.0}));
+    const Vec3 right = Normalize(Rotate(q, Vec3{1.0, 0.0, 0.0}));
+    const ShapeType shapes[] = {
+        ShapeType::Sphere, ShapeType::Box, ShapeType::Capsule, ShapeType::Cylinder, ShapeType::HalfCylinder};
+    int index = 0;
+    for (int ring = 0; ring < 3; ++ring) {
+        for (int slot = -3; slot <= 3; ++slot, ++index) {
+            const Real distance = 0.45 + 0.35 * static_cast<Real>(ring);
+            Body body = StaticBody(shapes[index % 5], {});
+            body.position = chassis.position + forward * distance + right * (0.12 * static_cast<Real>(slot) * (1.0 + ring));
+            body.position.y = 0.08 + 0.04 * static_cast<Real>(ring);
+            body.radius = 0.04;
+            body.halfHeight = 0.07;
+            body.halfExtents = {0.05, 0.06, 0.04};
+            body.orientation = Normalize(Quat{1.0, 0.2 * static_cast<Real>(slot), 0.0, 0.1 * static_cast<Real>(ring)});
+            world.CreateBody(body);
+        }
+    }
+}
+
+// Each member is initialised from the ones declared before it, so none is default-built and then
+// overwritten.
+struct LidarScene {
+    explicit LidarScene(bool with_obstacles)
+        : world(Vec3{0.0, -9.81, 0.0}), scene(BuildHexapodScene(world)), terrain(TerrainConfig()) {
+        RelaxBuiltInHexapodServos(world, scene);
+        terrain.initialize(world, world.GetBody(scene.body).position, 0.0);
+        if (with_obstacles) {
+            AddObstacles(world, world.GetBody(scene.body));
+        }
+        // One step builds the broadphase tree the tracers walk.
+        world.Step(1.0 / 120.0, 8);
+    }
+
+    static TerrainPatchConfig TerrainConfig() {
+        TerrainPatchConfig config{};
+        config.rows = 21;
+        config.cols = 21;
+        config.cell_size_m = 0.1;
+        return config;
+    }
+
+    World world;
+    HexapodSceneObjects scene;
+    TerrainPatch terrain;
+};
+
+physics_sim::StateResponse Scan(const LidarScene& scene, const MatrixLidarTraceOptions& options) {
+    physics_sim::StateResponse rsp{};
+    FillSimMatrixLidar64x8(
+        scene.world, scene.scene, scene.terrain, scene.world.GetBody(scene.scene.body), rsp, options);
+    assert(rsp.matrix_lidar_valid == 1);
+    return rsp;
+}
+
+// Packet traversal (serial and on a pool) must reproduce the per-ray tracer cell for cell.
+void TestPacketMatchesPerRayTrace() {
+    const LidarScene clear(false);
+    const LidarScene cluttered(true);
+
+    MatrixLidarTraceOptions per_ray{};
+    per_ray.use_packets = false;
+    MatrixLidarTraceOptions packets{};
+    core_internal::WorkerPool pool{3};
+    MatrixLidarTraceOptions pooled{};
+    pooled.pool = &pool;
+
+    for (const LidarScene* scene : {&clear, &cluttered}) {
+        const physics_sim::StateResponse reference = Scan(*scene, per_ray);
+        assert(Scan(*scene, packets).matrix_lidar_ranges_mm == reference.matrix_lidar_ranges_mm);
+        assert(Scan(*scene, pooled).matrix_lidar_ranges_mm == reference.matrix_lidar_ranges_mm);
+    }
+
+    const auto clear_ranges = Scan(clear, packets).matrix_lidar_ranges_mm;
+    const auto cluttered_ranges = Scan(cluttered, packets).matrix_lidar_ranges_mm;
+    int obstacle_cells = 0;
+    int valid_cells = 0;
+    for (std::size_t i = 0; i < clear_ranges.size(); ++i) {
+        obstacle_cells += cluttered_ranges[i] != clear_ranges[i] ? 1 : 0;
+        valid_cells += clear_ranges[i] != physics_sim::kMatrixLidarInvalidMm ? 1 : 0;
+    }
+    std::cout << "valid_cells=" << valid_cells << " obstacle_cells=" << obstacle_cells << "\n";
+    assert(valid_cells > 0);
+    assert(obstacle_cells >= 32);
+}
+
+} // namespace
+
+int main() {
+    TestExactPrimitiveHits();
+    TestPacketMatchesPerRayTrace();
+    std::cout << "test_matrix_lidar_packet: PASS\n";
+    return 0;
+}
@@ -0,0 +1,219 @@
+// Integration: fork hexapod-physics-sim --serve --serve-envs 3 and step the environments together.
+// Environments 0 and 2 get identical commands and must stay bit-identical; environment 1 runs in
+// zero gravity and must diverge. Messages for an out-of-range env_index are dropped.
+
+#include "physics_sim_protocol.hpp"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr std::size_t kEnvCount = 3;
+constexpr int kStepCount = 60;
+
+bool sendAll(int fd, const void* data, std::size_t len) {
+    const auto* p = reinterpret_cast<const char*>(data);
+    std::size_t off = 0;
+    while (off < len) {
+        const ssize_t n = ::send(fd, p + off, len - off, 0);
+        if (n <= 0) {
+            return false;
+        }
+        off += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+bool recvAll(int fd, void* data, std::size_t len) {
+    auto* p = reinterpret_cast<char*>(data);
+    std::size_t off = 0;
+    while (off < len) {
+        const ssize_t n = ::recv(fd, p + off, len - off, 0);
+        if (n <= 0) {
+            return false;
+        }
+        off += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+int openUdpSocketWithRetry() {
+    for (int attempt = 0; attempt < 5; ++attempt) {
+        const int fd = ::socket(AF_INET, SOCK_DGRAM, 0);
+        if (fd >= 0) {
+            return fd;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(25));
+    }
+    return -1;
+}
+
+bool sendConfig(int fd, std::uint16_t env_index, float gravity_y) {
+    physics_sim::ConfigCommand cfg{};
+    cfg.gravity = {0.0f, gravity_y, 0.0f};
+    cfg.solver_iterations = 16;
+    cfg.env_index = env_index;
+    return sendAll(fd, &cfg, physics_sim::kConfigCommandBytes);
+}
+
+bool recvAck(int fd, physics_sim::ConfigAck& ack) {
+    alignas(physics_sim::ConfigAck) char ack_buf[sizeof(physics_sim::ConfigAck)]{};
+    return recvAll(fd, ack_buf, physics_sim::kConfigAckBytes)
+        && physics_sim::tryDecodeConfigAck(ack_buf, physics_sim::kConfigAckBytes, ack);
+}
+
+bool sameState(const physics_sim::StateResponse& a, const physics_sim::StateResponse& b) {
+    return a.body_position == b.body_position && a.body_orientation == b.body_orientation
+        && a.body_linear_velocity == b.body_linear_velocity && a.body_angular_velocity == b.body_angular_velocity
+        && a.joint_angles == b.joint_angles && a.joint_velocities == b.joint_velocities
+        && a.foot_contacts == b.foot_contacts;
+}
+
+int fail(int fd, pid_t pid, const char* message, int code) {
+    std::cerr << "test_serve_ipc_envs: " << message << "\n";
+    ::close(fd);
+    ::kill(pid, SIGTERM);
+    ::waitpid(pid, nullptr, 0);
+    return code;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+#if !defined(__linux__)
+    std::cerr << "test_serve_ipc_envs: Linux-only (fork/exec)\n";
+    return 0;
+#else
+    if (argc < 2) {
+        std::cerr << "usage: test_serve_ipc_envs PATH_TO_hexapod-physics-sim\n";
+        return 0;
+    }
+
+    constexpr int kPort = 20980;
+    const char* sim_exe = argv[1];
+
+    pid_t pid = ::fork();
+    if (pid < 0) {
+        std::cerr << "fork failed\n";
+        return 2;
+    }
+    if (pid == 0) {
+        const std::string port_str = std::to_string(kPort);
+        const std::string env_str = std::to_string(kEnvCount);
+        ::execl(sim_exe,
+                sim_exe,
+                "--serve",
+                "--serve-port",
+                port_str.c_str(),
+                "--serve-envs",
+                env_str.c_str(),
+                "--serve-env-threads",
+                env_str.c_str(),
+                "--resource-monitoring",
+                "off",
+                nullptr);
+        std::perror("execl");
+        _exit(127);
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    const int fd = openUdpSocketWithRetry();
+    if (fd < 0) {
+        std::cerr << "socket failed\n";
+        ::kill(pid, SIGTERM);
+        ::waitpid(pid, nullptr, 0);
+        return 3;
+    }
+    timeval timeout{};
+    timeout.tv_sec = 5;
+    (void)::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<std::uint16_t>(kPort));
+    if (::inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr) != 1) {
+        return fail(fd, pid, "inet_pton failed", 4);
+    }
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        return fail(fd, pid, "connect failed", 5);
+    }
+
+    // Out-of-range config is dropped: the first ack must come from the valid command behind it.
+    if (!sendConfig(fd, static_cast<std::uint16_t>(kEnvCount), -9.81f)) {
+        return fail(fd, pid, "send out-of-range ConfigCommand failed", 6);
+    }
+    for (std::uint16_t env = 0; env < kEnvCount; ++env) {
+        if (!sendConfig(fd, env, env == 1 ? 0.0f : -9.81f)) {
+            return fail(fd, pid, "send ConfigCommand failed", 6);
+        }
+        physics_sim::ConfigAck ack{};
+        if (!recvAck(fd, ack)) {
+            return fail(fd, pid, "ConfigAck recv failed", 7);
+        }
+        if (ack.env_index != env || ack.joint_count < 18) {
+            return fail(fd, pid, "unexpected ConfigAck", 8);
+        }
+    }
+
+    std::array<physics_sim::StateResponse, kEnvCount> latest{};
+    for (int step_index = 0; step_index < kStepCount; ++step_index) {
+        // Send every environment's step before reading any reply so the host batches them.
+        for (std::uint16_t env = 0; env < kEnvCount; ++env) {
+            physics_sim::StepCommand step{};
+            step.sequence_id = static_cast<std::uint32_t>(step_index + 1);
+            step.dt_seconds = 1.0f / 60.0f;
+            step.env_index = env;
+            if (!sendAll(fd, &step, physics_sim::kStepCommandBytes)) {
+                return fail(fd, pid, "send StepCommand failed", 9);
+            }
+        }
+        std::array<bool, kEnvCount> seen{};
+        for (std::size_t reply = 0; reply < kEnvCount; ++reply) {
+            alignas(physics_sim::StateResponse) char rsp_buf[sizeof(physics_sim::StateResponse)]{};
+            physics_sim::StateResponse rsp{};
+            if (!recvAll(fd, rsp_buf, physics_sim::kStateResponseBytes)
+                || !physics_sim::tryDecodeStateResponse(rsp_buf, physics_sim::kStateResponseBytes, rsp)) {
+                return fail(fd, pid, "StateResponse recv failed", 10);
+            }
+            if (rsp.env_index >= kEnvCount || seen[rsp.env_index]
+                || rsp.sequence_id != static_cast<std::uint32_t>(step_index + 1)) {
+                return fail(fd, pid, "unexpected StateResponse routing", 11);
+            }
+            seen[rsp.env_index] = true;
+            latest[rsp.env_index] = rsp;
+        }
+        if (!sameState(latest[0], latest[2])) {
+            return fail(fd, pid, "identical environments diverged", 12);
+        }
+    }
+
+    const float fall_0 = latest[0].body_position[1];
+    const float fall_1 = latest[1].body_position[1];
+    if (!std::isfinite(fall_0) || !std::isfinite(fall_1) || std::abs(fall_0 - fall_1) < 1.0e-4f) {
+        return fail(fd, pid, "zero-gravity environment did not diverge", 13);
+    }
+
+    ::close(fd);
+    ::kill(pid, SIGTERM);
+    ::waitpid(pid, nullptr, 0);
+    std::cout << "test_serve_ipc_envs ok body_y=[" << latest[0].body_position[1] << ", " << latest[1].body_position[1]
+              << ", " << latest[2].body_position[1] << "]\n";
+    return 0;
+#endif
+}
@@ -256,6 +256,74 @@ bool CheckDeterministicServoChain() {
     return true;
 }
 
+bool CheckAdaptiveIterationsServoChainBounded() {
+    struct AdaptiveRun {
+        ScenarioMetrics metrics;
+        std::uint64_t iterations = 0;
+        std::uint64_t iterationCap = 0;
+    };
+    auto runScenario = [](bool adaptive) {
+        World world({0.0, -9.81, 0.0});
+        if (adaptive) {
+            ContactSolverConfig config = world.GetContactSolverConfig();
+            config.convergence.enabled = true;
+            world.SetContactSolverConfig(config);
+        }
+        Body base = MakeBoxBody({0.0, 2.0, 0.0}, {0.20, 0.12, 0.12}, 1.0, true);
+        const std::uint32_t base_id = world.CreateBody(base);
+        const ServoChain chain = BuildPlanarServoChain(
+            world,
+            base_id,
+            world.GetBody(base_id).position + Vec3{0.20, 0.0, 0.0},
+            2,
+            0.18,
+            0.08,
+            0.20,
+            10.0,
+            14.0,
+            2.0);
+
+        AdaptiveRun run;
+        constexpr Real kDt = 1.0 / 120.0;
+        constexpr int kIterations = 28;
+        for (int step = 0; step < 600; ++step) {
+            world.Step(kDt, kIterations);
+            const World::SolverIterationStats& stats = world.GetSolverIterationStats();
+            run.iterations += stats.lastStepIterations;
+            run.iterationCap += static_cast<std::uint64_t>(stats.lastStepSubsteps) * kIterations;
+            run.metrics.peakLinear = std::max(run.metrics.peakLinear, MaxLinkLinearSpeed(world, chain.linkBodies));
+            run.metrics.maxError = std::max(run.metrics.maxError, MaxServoAngleError(world, chain.servoJoints));
+            for (const std::uint32_t id : chain.linkBodies) {
+                run.metrics.finite = run.metrics.finite && BodyStateFinite(world.GetBody(id));
+            }
+        }
+        return run;
+    };
+
+    const AdaptiveRun fixed = runScenario(false);
+    const AdaptiveRun adaptive = runScenario(true);
+    if (!adaptive.metrics.finite) {
+        std::cerr << "adaptive_iters encountered non-finite state\n";
+        return false;
+    }
+    if (fixed.iterations != fixed.iterationCap || adaptive.iterations > adaptive.iterationCap) {
+        std::cerr << "adaptive_iters iterations fixed=" << fixed.iterations << "/" << fixed.iterationCap
+                  << " adaptive=" << adaptive.iterations << "/" << adaptive.iterationCap << "\n";
+        return false;
+    }
+    if (adaptive.metrics.peakLinear > fixed.metrics.peakLinear + 0.05) {
+        std::cerr << "adaptive_iters peak_linear=" << adaptive.metrics.peakLinear
+                  << " fixed=" << fixed.metrics.peakLinear << "\n";
+        return false;
+    }
+    if (adaptive.metrics.maxError > fixed.metrics.maxError + 0.01) {
+        std::cerr << "adaptive_iters max_error=" << adaptive.metrics.maxError
+                  << " fixed=" << fixed.metrics.maxError << "\n";
+        return false;
+    }
+    return true;
+}
+
 bool CheckZeroGravityServoDrift() {
     World world({0.0, 0.0, 0.0});
 
@@ -444,6 +512,7 @@ int main() {
     ok = CheckFreefallChainMotionBounded() && ok;
     ok = CheckLoadedSingleChainMotionBounded() && ok;
     ok = CheckDeterministicServoChain() && ok;
+    ok = CheckAdaptiveIterationsServoChainBounded() && ok;
     ok = CheckZeroGravityServoDrift() && ok;
     ok = CheckFiveLinkFreefallLong() && ok;
     ok = CheckVisualServoArmPresetRemainsBounded() && ok;
@@ -0,0 +1,172 @@
+#include "demo/terrain_patch.hpp"
+#include "minphys3d/core/world.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using minphys3d::Real;
+using minphys3d::Vec3;
+using minphys3d::World;
+using minphys3d::demo::TerrainPatch;
+using minphys3d::demo::TerrainPatchConfig;
+using minphys3d::demo::TerrainSample;
+
+bool expect(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAIL: " << message << '\n';
+        return false;
+    }
+    return true;
+}
+
+// 128x128 patch fused from a LiDAR-like cluster of hits in one corner, far from the resting sphere.
+TerrainPatchConfig FusionPatchConfig() {
+    TerrainPatchConfig config{};
+    config.rows = 128;
+    config.cols = 128;
+    config.cell_size_m = 0.05;
+    config.use_sample_binning = true;
+    config.use_conservative_collision = true;
+    return config;
+}
+
+std::vector<TerrainSample> CornerSamples() {
+    std::vector<TerrainSample> samples;
+    for (int i = 0; i < 64; ++i) {
+        TerrainSample sample{};
+        sample.world_position = {-2.9 + 0.05 * static_cast<Real>(i % 8), 0.0, -2.9 + 0.05 * static_cast<Real>(i / 8)};
+        sample.height_m = 0.04 + 0.002 * static_cast<Real>(i % 5);
+        sample.confidence = 0.9;
+        samples.push_back(sample);
+    }
+    return samples;
+}
+
+std::uint32_t AddRestingSphere(World& world) {
+    minphys3d::Body sphere{};
+    sphere.shape = minphys3d::ShapeType::Sphere;
+    sphere.radius = 0.05;
+    sphere.mass = 1.0;
+    sphere.position = {2.0, 0.049, 2.0};
+    return world.CreateBody(sphere);
+}
+
+const minphys3d::Contact* FirstContactOf(const World& world, std::uint32_t bodyId) {
+    for (const minphys3d::Manifold& manifold : world.DebugManifolds()) {
+        if ((manifold.a == bodyId || manifold.b == bodyId) && !manifold.contacts.empty()) {
+            return &manifold.contacts.front();
+        }
+    }
+    return nullptr;
+}
+
+bool testUpdatesStampOnlyChangedTilesWithoutAllocating() {
+    World world{Vec3{0.0, -9.81, 0.0}};
+    TerrainPatch patch{FusionPatchConfig()};
+    patch.initialize(world, Vec3{0.0, 0.0, 0.0}, 0.0);
+    world.SetTerrainHeightfield(patch.BuildTerrainHeightfieldAttachment());
+    const std::uint32_t sphereId = AddRestingSphere(world);
+    const std::vector<TerrainSample> samples = CornerSamples();
+
+    const auto fuse = [&]() {
+        patch.update(world, Vec3{0.0, 0.0, 0.0}, 0.0, Vec3{0.0, 1.0, 0.0}, samples);
+        world.SetTerrainHeightfield(patch.BuildTerrainHeightfieldAttachment());
+    };
+    std::uint64_t warmupAllocations = 0;
+    for (int warmup = 0; warmup < 4; ++warmup) {
+        {
+            minphys3d::world_resource_monitoring::HeapAllocationScope scope{warmupAllocations};
+            fuse();
+        }
+        world.Step(1.0 / 60.0, 8);
+    }
+    // The first fusion builds the attachment, so zero means allocations are not being counted.
+    if (!expect(warmupAllocations > 0,
+                "heap allocation counting is inactive; link minphys3d_heap_allocation_counter into this test")) {
+        return false;
+    }
+
+    const minphys3d::TerrainHeightfieldBuffer& heights = *patch.heightfield();
+    const std::uint64_t farTileRevision = heights.TileRevision(100, 100);
+    const std::uint64_t nearTileRevision = heights.TileRevision(5, 5);
+    const float* storage = heights.SurfaceHeights().data();
+    const minphys3d::Contact* before = FirstContactOf(world, sphereId);
+    if (!expect(before != nullptr, "sphere should rest on the attached terrain")) {
+        return false;
+    }
+    const std::uint64_t featureKey = before->featureKey;
+
+    std::uint64_t updateAllocations = 0;
+    for (int frame = 0; frame < 20; ++frame) {
+        {
+            minphys3d::world_resource_monitoring::HeapAllocationScope scope{updateAllocations};
+            fuse();
+        }
+        world.Step(1.0 / 60.0, 8);
+    }
+
+    if (!expect(heights.TileRevision(100, 100) == farTileRevision, "untouched tiles should keep their revision") ||
+        !expect(heights.TileRevision(5, 5) > nearTileRevision, "tiles under fused samples should be re-stamped") ||
+        !expect(heights.SurfaceHeights().data() == storage, "updates should write the shared buffer in place")) {
+        return false;
+    }
+    const minphys3d::Contact* after = FirstContactOf(world, sphereId);
+    if (!expect(after != nullptr && after->featureKey == featureKey,
+                "contacts on untouched tiles should keep their feature id across syncs") ||
+        !expect(after->persistenceAge > 10, "contacts on untouched tiles should keep warm starting")) {
+        return false;
+    }
+    return expect(updateAllocations == 0, "steady-state terrain update and sync should not allocate");
+}
+
+bool testSharedAttachmentMatchesCopiedAttachment() {
+    TerrainPatch patch{FusionPatchConfig()};
+    World scratch{};
+    patch.initialize(scratch, Vec3{0.0, 0.0, 0.0}, 0.0);
+    std::vector<TerrainSample> samples = CornerSamples();
+    for (TerrainSample& sample : samples) {
+        sample.world_position.x += 4.9;
+        sample.world_position.z += 4.9;
+    }
+    patch.update(scratch, Vec3{0.0, 0.0, 0.0}, 0.0, Vec3{0.0, 1.0, 0.0}, samples);
+
+    World shared{Vec3{0.0, -9.81, 0.0}};
+    shared.SetTerrainHeightfield(patch.BuildTerrainHeightfieldAttachment());
+    World copied{Vec3{0.0, -9.81, 0.0}};
+    World::TerrainHeightfieldAttachment copy = patch.BuildTerrainHeightfieldAttachment();
+    copy.sharedHeights.reset();
+    copy.surfaceHeightsM = patch.surface_heights_m();
+    copy.collisionHeightsM = patch.collision_heights_m();
+    copied.SetTerrainHeightfield(copy);
+
+    const std::uint32_t sharedSphere = AddRestingSphere(shared);
+    const std::uint32_t copiedSphere = AddRestingSphere(copied);
+    shared.Step(1.0 / 60.0, 8);
+    copied.Step(1.0 / 60.0, 8);
+
+    const minphys3d::Contact* a = FirstContactOf(shared, sharedSphere);
+    const minphys3d::Contact* b = FirstContactOf(copied, copiedSphere);
+    if (!expect(a != nullptr && b != nullptr, "both attachments should produce terrain contacts")) {
+        return false;
+    }
+    return expect(a->penetration == b->penetration && a->normal.y == b->normal.y && a->point.x == b->point.x,
+                  "shared and copied attachments should produce identical contact geometry");
+}
+
+} // namespace
+
+int main() {
+    if (!testUpdatesStampOnlyChangedTilesWithoutAllocating()) {
+        return EXIT_FAILURE;
+    }
+    if (!testSharedAttachmentMatchesCopiedAttachment()) {
+        return EXIT_FAILURE;
+    }
+    std::cout << "test_terrain_heightfield_incremental ok\n";
+    return EXIT_SUCCESS;
+}
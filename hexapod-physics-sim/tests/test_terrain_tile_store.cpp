@@ -0,0 +1,177 @@
+#include "demo/terrain_patch.hpp"
+#include "demo/terrain_tile_store.hpp"
+#include "minphys3d/core/world.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using minphys3d::Real;
+using minphys3d::Vec3;
+using minphys3d::World;
+using minphys3d::demo::TerrainTileStore;
+using minphys3d::demo::TerrainTileStoreConfig;
+
+constexpr int kRows = 260;
+constexpr int kCols = 300;
+constexpr Real kCell = 0.05;
+constexpr Real kOriginX = -1.0;
+constexpr Real kOriginZ = -2.0;
+
+float AuthoredHeight(int row, int col) {
+    const Real x = kOriginX + static_cast<Real>(col) * kCell;
+    const Real z = kOriginZ + static_cast<Real>(row) * kCell;
+    return static_cast<float>(0.1 * std::sin(x) + 0.05 * std::cos(1.3 * z));
+}
+
+bool expect(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAIL: " << message << '\n';
+        return false;
+    }
+    return true;
+}
+
+std::string WriteAuthoredFile() {
+    std::vector<float> heights(static_cast<std::size_t>(kRows * kCols));
+    for (int row = 0; row < kRows; ++row) {
+        for (int col = 0; col < kCols; ++col) {
+            heights[static_cast<std::size_t>(row * kCols + col)] = AuthoredHeight(row, col);
+        }
+    }
+    const std::string path = (std::filesystem::temp_directory_path() / "test_terrain_tile_store.mpht").string();
+    std::string error;
+    if (!minphys3d::demo::WriteTerrainHeightFile(path, heights, kRows, kCols, kCell, kOriginX, kOriginZ, 32, 4, &error)) {
+        std::cerr << "FAIL: writing height file: " << error << '\n';
+        return {};
+    }
+    return path;
+}
+
+bool testWindowStreamingAndLod(TerrainTileStore& store) {
+    if (!expect(!store.BuildTerrainHeightfieldAttachment().enabled, "no attachment before the first window")) {
+        return false;
+    }
+    const Vec3 focus{2.0, 0.0, 2.0};
+    if (!expect(store.UpdateWindow(focus), "first update should build the window") ||
+        !expect(!store.UpdateWindow(focus + Vec3{0.1, 0.0, 0.1}), "moving inside a tile should not move the window")) {
+        return false;
+    }
+
+    // Fine samples inside the window reproduce the authored grid.
+    const int col = 60;
+    const int row = 80;
+    const Real x = kOriginX + static_cast<Real>(col) * kCell;
+    const Real z = kOriginZ + static_cast<Real>(row) * kCell;
+    if (!expect(std::abs(store.SampleHeightWorld(x, z) - AuthoredHeight(row, col)) < 1.0e-6,
+                "window samples should match the authored heights")) {
+        return false;
+    }
+    // Beyond the 3x3 tile window the LOD grid answers; its nodes are authored samples too.
+    const Real far_x = kOriginX + 280.0 * kCell;
+    const Real far_z = kOriginZ + 240.0 * kCell;
+    if (!expect(std::abs(store.SampleHeightWorld(far_x, far_z) - AuthoredHeight(240, 280)) < 1.0e-6,
+                "LOD samples should match the authored heights at LOD nodes")) {
+        return false;
+    }
+
+    const std::size_t resident = store.resident_bytes();
+    const std::uint64_t loads_before = store.stats().tile_loads;
+    for (int i = 0; i < 8; ++i) {
+        store.UpdateWindow(focus + Vec3{1.6 * static_cast<Real>(i), 0.0, 0.0});
+    }
+    const std::uint64_t hits_before_return = store.stats().tile_cache_hits;
+    for (int i = 7; i >= 0; --i) {
+        store.UpdateWindow(focus + Vec3{1.6 * static_cast<Real>(i), 0.0, 0.0});
+    }
+    return expect(store.stats().tile_loads > loads_before, "walking should stream new tiles in") &&
+           expect(store.stats().tile_cache_hits > hits_before_return, "walking back should hit the LRU cache") &&
+           expect(store.stats().tile_evictions > 0, "a bounded cache should evict") &&
+           expect(store.resident_bytes() == resident, "resident memory should not grow with distance walked");
+}
+
+bool testWorldCollidesWithWindow(TerrainTileStore& store) {
+    const Vec3 focus{3.0, 0.0, 3.0};
+    store.UpdateWindow(focus);
+    World world{Vec3{0.0, -9.81, 0.0}};
+    world.SetTerrainHeightfield(store.BuildTerrainHeightfieldAttachment());
+    minphys3d::Body sphere{};
+    sphere.shape = minphys3d::ShapeType::Sphere;
+    sphere.radius = 0.05;
+    sphere.mass = 1.0;
+    sphere.position = {focus.x, store.SampleHeightWorld(focus.x, focus.z) + 0.2, focus.z};
+    const std::uint32_t sphere_id = world.CreateBody(sphere);
+    // The window sits metres from the world origin on a slope, so contact depth must be measured
+    // against the local tangent plane for the sphere to ride (and roll down) the surface.
+    Real worst_gap = 0.0;
+    for (int i = 0; i < 120; ++i) {
+        world.Step(1.0 / 60.0, 8);
+        const Vec3 p = world.GetBody(sphere_id).position;
+        if (i >= 40) {
+            worst_gap = std::max(worst_gap, std::abs(p.y - (store.SampleHeightWorld(p.x, p.z) + 0.05)));
+        }
+    }
+    return expect(worst_gap < 0.01, "sphere should ride the sloped streamed window");
+}
+
+bool testRaycasts(const TerrainTileStore& store) {
+    const Vec3 focus{3.0, 0.0, 3.0};
+    Real t = 0.0;
+    const Vec3 down{0.0, -1.0, 0.0};
+    if (!expect(store.RaycastWorld(Vec3{focus.x, 1.0, focus.z}, down, t), "downward ray should hit") ||
+        !expect(std::abs((1.0 - t) - store.SampleHeightWorld(focus.x, focus.z)) < 1.0e-4, "downward hit height")) {
+        return false;
+    }
+    const Vec3 origin{focus.x, 0.3, focus.z};
+    const Vec3 dir = minphys3d::Normalize(Vec3{1.0, -0.05, 0.6});
+    if (!expect(store.RaycastWorld(origin, dir, t), "shallow ray should reach LOD terrain")) {
+        return false;
+    }
+    const Vec3 hit = origin + dir * t;
+    if (!expect(std::abs(hit.y - store.SampleHeightWorld(hit.x, hit.z)) < 1.0e-3, "shallow ray hit lies on the surface")) {
+        return false;
+    }
+
+    // The belief patch covers only ~0.7 m around the robot; the far field answers past it.
+    World world{};
+    minphys3d::demo::TerrainPatch patch{};
+    patch.initialize(world, Vec3{focus.x, 0.0, focus.z}, 0.0);
+    Real patch_t = 0.0;
+    if (!expect(!patch.RaycastWorld(origin, dir, patch_t), "belief patch alone should miss the shallow ray")) {
+        return false;
+    }
+    patch.set_far_field(&store);
+    return expect(patch.RaycastWorld(origin, dir, patch_t), "patch ray should continue into the far field") &&
+           expect(std::abs(patch_t - t) < 1.0e-3, "far-field hit should match the store's own raycast");
+}
+
+} // namespace
+
+int main() {
+    const std::string path = WriteAuthoredFile();
+    if (path.empty()) {
+        return EXIT_FAILURE;
+    }
+    TerrainTileStoreConfig config{};
+    config.window_radius_tiles = 1;
+    config.cache_capacity_tiles = 12;
+    TerrainTileStore store{config};
+    std::string error;
+    if (!store.Open(path, &error)) {
+        std::cerr << "FAIL: opening height file: " << error << '\n';
+        return EXIT_FAILURE;
+    }
+    const bool ok = testWindowStreamingAndLod(store) && testWorldCollidesWithWindow(store) && testRaycasts(store);
+    std::filesystem::remove(path);
+    if (!ok) {
+        return EXIT_FAILURE;
+    }
+    std::cout << "test_terrain_tile_store ok\n";
+    return EXIT_SUCCESS;
+}
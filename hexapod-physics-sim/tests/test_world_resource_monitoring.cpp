@@ -82,11 +82,70 @@ bool testTerrainHeavyWorldProfiling() {
 #endif
 }
 
+bool testWarmStartMatchingDoesNotAllocate() {
+    minphys3d::World world{minphys3d::Vec3{0.0, -9.81, 0.0}};
+    // The brute-force pair cross-check allocates its reference list; keep it out of the count.
+    minphys3d::BroadphaseConfig broadphase = world.GetBroadphaseConfig();
+    broadphase.validatePairsAgainstBruteForce = false;
+    world.SetBroadphaseConfig(broadphase);
+    minphys3d::Body ground{};
+    ground.shape = minphys3d::ShapeType::Plane;
+    ground.planeNormal = minphys3d::Vec3{0.0, 1.0, 0.0};
+    world.CreateBody(ground);
+    for (int i = 0; i < 4; ++i) {
+        minphys3d::Body box{};
+        box.shape = minphys3d::ShapeType::Box;
+        box.halfExtents = minphys3d::Vec3{0.25, 0.25, 0.25};
+        box.mass = 1.0;
+        box.position = minphys3d::Vec3{0.0, 0.25 + 0.5 * static_cast<minphys3d::Real>(i), 0.0};
+        world.CreateBody(box);
+    }
+
+    // The column topples and comes to rest within ~130 steps; after that contact counts (and with
+    // them the persistent-point table high-water mark) stop growing.
+    std::uint64_t warmup_allocations = 0;
+    for (int i = 0; i < 240; ++i) {
+        world.Step(1.0 / 120.0, 10);
+        warmup_allocations += world.GetHeapAllocationStats().lastStep;
+    }
+    // Growing the contact buffers allocates, so zero here means nothing is being counted and the
+    // zero-allocation checks below would pass vacuously.
+    if (!expect(warmup_allocations > 0,
+                "heap allocation counting is inactive; link minphys3d_heap_allocation_counter into this test")) {
+        return false;
+    }
+    std::uint64_t warm_start_allocations = 0;
+    std::uint64_t broadphase_allocations = 0;
+    std::uint64_t step_allocations = 0;
+    for (int i = 0; i < 120; ++i) {
+        world.Step(1.0 / 120.0, 10);
+        warm_start_allocations += world.GetHeapAllocationStats().lastStepWarmStart;
+        broadphase_allocations += world.GetHeapAllocationStats().lastStepBroadphase;
+        step_allocations += world.GetHeapAllocationStats().lastStep;
+    }
+    if (!expect(world.GetPersistenceMatchDiagnostics().matchedPoints > 0,
+                "resting stack should warm start from persistent points")) {
+        return false;
+    }
+    if (!expect(world.GetHeapAllocationStats().totalSteps == 360, "allocation stats should count every step")) {
+        return false;
+    }
+    std::cout << "steady-state allocations: step=" << step_allocations / 120 << "/step warm_start="
+              << warm_start_allocations << " broadphase=" << broadphase_allocations << '\n';
+    if (!expect(broadphase_allocations == 0, "broadphase pair generation should not allocate once buffers are warm")) {
+        return false;
+    }
+    return expect(warm_start_allocations == 0, "warm-start matching should not allocate once tables are warm");
+}
+
 } // namespace
 
 int main() {
     if (!testTerrainHeavyWorldProfiling()) {
         return EXIT_FAILURE;
     }
+    if (!testWarmStartMatchingDoesNotAllocate()) {
+        return EXIT_FAILURE;
+    }
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,246 @@
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "demo/frame_sink.cpp"
+#include "demo/scenes.cpp"
+#include "demo/terrain_patch.hpp"
+#include "minphys3d/demo/hexapod_stability.hpp"
+
+namespace {
+
+using namespace minphys3d;
+using namespace minphys3d::demo;
+
+constexpr Real kStepDt = 1.0 / 120.0;
+constexpr int kSolverIterations = 12;
+constexpr int kSettleSteps = 60;
+constexpr int kReplaySteps = 90;
+
+void check(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAIL: " << message << '\n';
+        std::exit(1);
+    }
+}
+
+// Dynamic state that a replay must reproduce exactly; compared with operator== on Real, so a
+// single differing bit anywhere fails the test.
+struct StateDigest {
+    std::vector<Real> values;
+    std::vector<std::uint32_t> counts;
+
+    bool operator==(const StateDigest& other) const {
+        return values == other.values && counts == other.counts;
+    }
+};
+
+void PushVec3(std::vector<Real>& out, const Vec3& v) {
+    out.push_back(v.x);
+    out.push_back(v.y);
+    out.push_back(v.z);
+}
+
+StateDigest Digest(const World& world) {
+    StateDigest digest;
+    for (std::uint32_t id = 0; id < world.GetBodyCount(); ++id) {
+        const Body& body = world.GetBody(id);
+        PushVec3(digest.values, body.position);
+        PushVec3(digest.values, body.velocity);
+        PushVec3(digest.values, body.angularVelocity);
+        digest.values.push_back(body.orientation.w);
+        digest.values.push_back(body.orientation.x);
+        digest.values.push_back(body.orientation.y);
+        digest.values.push_back(body.orientation.z);
+        digest.counts.push_back(body.isSleeping ? 1u : 0u);
+    }
+    for (std::uint32_t id = 0; id < world.GetServoJointCount(); ++id) {
+        const ServoJoint& servo = world.GetServoJoint(id);
+        digest.values.push_back(servo.servoImpulseSum);
+        digest.values.push_back(servo.integralAccum);
+        digest.values.push_back(servo.smoothedAngleError);
+    }
+    const std::vector<Manifold>& manifolds = world.DebugManifolds();
+    digest.counts.push_back(static_cast<std::uint32_t>(manifolds.size()));
+    for (const Manifold& manifold : manifolds) {
+        digest.counts.push_back(static_cast<std::uint32_t>(manifold.contacts.size()));
+        for (const Contact& contact : manifold.contacts) {
+            digest.values.push_back(contact.normalImpulseSum);
+            digest.values.push_back(contact.tangentImpulseSum0);
+            digest.values.push_back(contact.tangentImpulseSum1);
+            digest.counts.push_back(contact.persistenceAge);
+        }
+    }
+    return digest;
+}
+
+// Steps `world` and nudges every servo target part way through, so the replay exercises the
+// servo integrators and not only a settled pose.
+void Replay(World& world) {
+    for (int step = 0; step < kReplaySteps; ++step) {
+        if (step == kReplaySteps / 3) {
+            for (std::uint32_t id = 0; id < world.GetServoJointCount(); ++id) {
+                world.GetServoJointMutable(id).targetAngle += 0.15;
+            }
+        }
+        world.Step(kStepDt, kSolverIterations);
+    }
+}
+
+void BuildHexapod(World& world) {
+    const HexapodSceneObjects scene = BuildHexapodScene(world);
+    RelaxBuiltInHexapodServos(world, scene);
+    ApplyHexapodPoseHoldStabilityTuning(world, scene);
+}
+
+void BuildTerrainDrop(World& world) {
+    TerrainPatchConfig terrainConfig{};
+    terrainConfig.rows = 10;
+    terrainConfig.cols = 10;
+    terrainConfig.cell_size_m = 0.08;
+    terrainConfig.base_margin_m = 0.03;
+    terrainConfig.min_cell_thickness_m = 0.02;
+    TerrainPatch terrain{terrainConfig};
+    terrain.initialize(world, Vec3{0.0, 0.0, 0.0}, 0.0);
+    world.SetTerrainHeightfield(terrain.BuildTerrainHeightfieldAttachment());
+
+    for (int i = 0; i < 4; ++i) {
+        Body body{};
+        body.shape = (i % 2 == 0) ? ShapeType::Sphere : ShapeType::Box;
+        body.radius = 0.05;
+        body.halfExtents = {0.05, 0.04, 0.06};
+        body.mass = 1.0 + 0.2 * static_cast<Real>(i);
+        body.position = {-0.15 + 0.1 * static_cast<Real>(i), 0.08 + 0.06 * static_cast<Real>(i), 0.02};
+        body.angularVelocity = {0.3, 0.0, -0.2 * static_cast<Real>(i)};
+        world.CreateBody(body);
+    }
+}
+
+void ExpectDeterministicReplay(const char* name, const std::function<void(World&)>& build) {
+    World world(Vec3{0.0, -9.81, 0.0});
+    build(world);
+    for (int step = 0; step < kSettleSteps; ++step) {
+        world.Step(kStepDt, kSolverIterations);
+    }
+    const std::string scene(name);
+    check(!world.DebugManifolds().empty(), scene + ": settled scene should have contacts");
+
+    const std::vector<std::uint8_t> snapshot = world.CaptureSnapshot();
+    Replay(world);
+    const StateDigest reference = Digest(world);
+
+    // Rewind the same world: everything the replay mutated must come back from the blob.
+    bool restored = world.RestoreSnapshot(snapshot);
+    check(restored, scene + ": restoring into the captured world should succeed");
+    Replay(world);
+    check(Digest(world) == reference, scene + ": replay after a rewind should match the first run");
+
+    // A branch that diverges must not leak into the next rewind.
+    restored = world.RestoreSnapshot(snapshot);
+    check(restored, scene + ": second rewind should succeed");
+    for (int step = 0; step < 20; ++step) {
+        world.GetBody(world.GetBodyCount() - 1u).velocity.y += 0.5;
+        world.Step(kStepDt, kSolverIterations);
+    }
+    check(!(Digest(world) == reference), scene + ": the perturbed branch should diverge");
+    restored = world.RestoreSnapshot(snapshot);
+    check(restored, scene + ": rewind after the perturbed branch should succeed");
+    Replay(world);
+    check(Digest(world) == reference, scene + ": the perturbed branch leaked into the next rewind");
+
+    // A fresh world with different execution settings restores the same simulation state.
+    World fresh;
+    World::ParallelSolveConfig parallel;
+    parallel.threadCount = 4;
+    parallel.minParallelIslandCost = 0;
+    fresh.SetParallelSolveConfig(parallel);
+    restored = fresh.RestoreSnapshot(snapshot);
+    check(restored, scene + ": restoring into a fresh world should succeed");
+    check(fresh.GetBodyCount() == world.GetBodyCount(), scene + ": fresh world should restore every body");
+    Replay(fresh);
+    check(Digest(fresh) == reference, scene + ": fresh world replay should match the original");
+
+    std::cout << name << ": snapshot_bytes=" << snapshot.size() << " bodies=" << world.GetBodyCount()
+              << " manifolds=" << world.DebugManifolds().size() << "\n";
+}
+
+void TestRejectsDamagedBlobs() {
+    World world(Vec3{0.0, -9.81, 0.0});
+    BuildTerrainDrop(world);
+    for (int step = 0; step < 10; ++step) {
+        world.Step(kStepDt, kSolverIterations);
+    }
+    const std::vector<std::uint8_t> snapshot = world.CaptureSnapshot();
+    const StateDigest before = Digest(world);
+
+    std::vector<std::uint8_t> truncated(snapshot.begin(), snapshot.end() - 1);
+    bool restored = world.RestoreSnapshot(truncated);
+    check(!restored, "a truncated blob should be rejected");
+    restored = world.RestoreSnapshot(nullptr, 0);
+    check(!restored, "an empty blob should be rejected");
+
+    std::vector<std::uint8_t> corrupted = snapshot;
+    corrupted[corrupted.size() / 2] ^= 0x10u;
+    restored = world.RestoreSnapshot(corrupted);
+    check(!restored, "a blob with a flipped bit should be rejected");
+
+    std::vector<std::uint8_t> badMagic = snapshot;
+    badMagic[0] ^= 0xFFu;
+    restored = world.RestoreSnapshot(badMagic);
+    check(!restored, "a blob with a bad magic should be rejected");
+
+    // Rejected blobs leave the world as it was.
+    check(Digest(world) == before, "rejected blobs should leave the world untouched");
+    restored = world.RestoreSnapshot(snapshot);
+    check(restored, "the intact blob should still restore");
+    check(Digest(world) == before, "restoring the intact blob should reproduce the captured state");
+}
+
+// Manifold contact slices point into their World's contact pools; a copied World must view its own
+// pools, so it still replays correctly after the source is gone.
+void TestCopiedWorldOwnsItsManifolds() {
+    auto source = std::make_unique<World>(Vec3{0.0, -9.81, 0.0});
+    BuildTerrainDrop(*source);
+    for (int step = 0; step < kSettleSteps; ++step) {
+        source->Step(kStepDt, kSolverIterations);
+    }
+    check(!source->DebugManifolds().empty(), "copy source should have contacts");
+
+    World copied(*source);
+    World assigned;
+    assigned = *source;
+    for (const World* copy : {&copied, &assigned}) {
+        const std::vector<Manifold>& own = copy->DebugManifolds();
+        const std::vector<Manifold>& original = source->DebugManifolds();
+        check(own.size() == original.size(), "a copied world should keep every manifold");
+        for (std::size_t i = 0; i < own.size(); ++i) {
+            check(own[i].contacts.size() == original[i].contacts.size(),
+                  "a copied manifold should keep its contact count");
+            check(own[i].contacts.empty() || own[i].contacts.data() != original[i].contacts.data(),
+                  "a copied manifold should view the copy's own contact pool");
+        }
+    }
+
+    Replay(*source);
+    const StateDigest reference = Digest(*source);
+    source.reset();
+    Replay(copied);
+    check(Digest(copied) == reference, "a copy-constructed world should replay its destroyed source");
+    Replay(assigned);
+    check(Digest(assigned) == reference, "a copy-assigned world should replay its destroyed source");
+}
+
+} // namespace
+
+int main() {
+    ExpectDeterministicReplay("hexapod", BuildHexapod);
+    ExpectDeterministicReplay("terrain drop", BuildTerrainDrop);
+    TestRejectsDamagedBlobs();
+    TestCopiedWorldOwnsItsManifolds();
+    std::cout << "test_world_snapshot: PASS\n";
+    return 0;
+}
@@ -16,6 +16,7 @@ struct ParsedToml
   std::string serialDevice{"/dev/ttyACM0"};
   int baudRate{115200};
   int timeout{100};
+  bool pipelinedBus{false};
   std::vector<float> minMaxPulses{};
 
   double simInitialVoltageV{12.0};
@@ -33,10 +34,12 @@ struct ParsedToml
   bool logToFile{true};
   std::string replayLogFilePath{};
   bool replayLogToFile{false};
+  std::string replayLogFormat{"jsonl"};
   std::string telemetryHost{"127.0.0.1"};
   int telemetryPort{9870};
   double telemetryPublishRateHz{30.0};
   double telemetryGeometryResendIntervalSec{1.0};
+  bool telemetryBinaryStream{false};
 
   bool telemetryEnabled{false};
   std::string telemetryUdpHost{"127.0.0.1"};
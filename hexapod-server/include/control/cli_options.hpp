@@ -28,6 +28,7 @@ struct CliOptions
   std::optional<int> telemetryPortOverride;
   std::optional<double> telemetryPublishRateHzOverride;
   std::optional<double> telemetryGeometryResendIntervalSecOverride;
+  std::optional<bool> telemetryBinaryStreamOverride;
   std::optional<bool> investigationDisableTerrainStanceBiasOverride;
   std::optional<bool> investigationDisableTerrainSwingClearanceOverride;
   std::optional<bool> investigationDisableTerrainSwingXYNudgeOverride;
@@ -260,15 +260,24 @@ struct TelemetryConfig {
     int port{9870};
     double publish_rate_hz{30.0};
     double geometry_resend_interval_sec{1.0};
+    /** Also send `hexapod_telemetry_protocol.hpp` frames every control step, independent of publish_rate_hz. */
+    bool binary_stream{false};
     std::string udp_host{"127.0.0.1"};
     int udp_port{kDefaultTelemetryUdpPort};
     std::chrono::milliseconds publish_period{std::chrono::milliseconds{kDefaultTelemetryPublishPeriodMs}};
     std::chrono::milliseconds geometry_refresh_period{std::chrono::milliseconds{kDefaultTelemetryGeometryRefreshPeriodMs}};
 };
 
+enum class ReplayLogFormat : std::uint8_t {
+    Jsonl = 0,
+    /** `replay_binary.hpp`; convert with `hexapod-replay-to-jsonl`. */
+    Binary = 1,
+};
+
 struct ReplayLogConfig {
     bool enabled{false};
     std::string file_path{};
+    ReplayLogFormat format{ReplayLogFormat::Jsonl};
 };
 
 /** Tuning for `NavLocomotionBridge` when used by scenarios / callers (not applied automatically in core loop yet). */
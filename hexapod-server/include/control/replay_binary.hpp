@@ -0,0 +1,120 @@
+#pragma once
+
+#include "replay_json.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * Binary replay log (`.hxrb`), a compact alternative to the JSONL replay stream.
+ *
+ * Layout: a fixed file header followed by tagged chunks `{u32 kind, u32 bytes, payload}`.
+ *  - The header carries a magic, the format version, `replay_json::kSchemaVersion`, and the byte size
+ *    of every frame section, so a reader built against a different record layout refuses the file
+ *    instead of misreading it.
+ *  - `Frame` chunks are fixed-stride: every non-grid field of `ReplayTelemetryRecord`, copied section
+ *    by section in the order the header lists.
+ *  - `Grid` chunks hold one occupancy or elevation grid. They are written before a frame only when that
+ *    grid differs from the last one written, and every later frame refers to them until they change.
+ *
+ * Writers truncate the target file; appending to a log left by a crashed run is not supported.
+ */
+namespace replay_binary {
+
+inline constexpr std::array<char, 8> kMagic{'H', 'X', 'R', 'P', 'L', 'A', 'Y', '\0'};
+inline constexpr std::uint32_t kFormatVersion = 1;
+
+enum class ChunkKind : std::uint32_t {
+    Frame = 1,
+    Grid = 2,
+};
+
+/** Grid slots, in `LocalMapSnapshot` order. */
+enum class GridSlot : std::uint8_t {
+    Raw = 0,
+    Inflated = 1,
+    ElevationMaxHitZ = 2,
+    ElevationGroundMeanZ = 3,
+};
+inline constexpr std::size_t kGridSlotCount = 4;
+
+/** Appends records to a binary replay log. After the first record (and whenever a grid changes size)
+ *  `write` does no heap allocation. Not thread-safe. */
+class ReplayBinaryWriter {
+public:
+    bool open(const std::string& path, std::string* error = nullptr);
+    [[nodiscard]] bool isOpen() const { return file_.is_open(); }
+    bool write(const replay_json::ReplayTelemetryRecord& record);
+    void flush();
+    void close();
+
+    [[nodiscard]] std::uint64_t framesWritten() const { return frames_written_; }
+    [[nodiscard]] std::uint64_t gridChunksWritten() const { return grid_chunks_written_; }
+
+private:
+    void writeOccupancyGridIfChanged(GridSlot slot, const LocalOccupancyGrid& grid);
+    void writeElevationGridIfChanged(GridSlot slot, const LocalElevationGrid& grid);
+
+    std::ofstream file_{};
+    std::vector<unsigned char> frame_{};
+    LocalOccupancyGrid last_raw_{};
+    LocalOccupancyGrid last_inflated_{};
+    LocalElevationGrid last_elevation_max_hit_z_{};
+    LocalElevationGrid last_elevation_ground_mean_z_{};
+    std::array<bool, kGridSlotCount> grid_written_{};
+    std::uint64_t frames_written_{0};
+    std::uint64_t grid_chunks_written_{0};
+};
+
+/** Random-access reader over a memory-mapped binary replay log. Opening indexes every frame once;
+ *  `read` then rebuilds any record in O(frame + referenced grid) time. A trailing partial chunk
+ *  (a log cut off mid-write) is ignored and reported by `truncated()`. */
+class ReplayBinaryReader {
+public:
+    ReplayBinaryReader() = default;
+    ~ReplayBinaryReader();
+    ReplayBinaryReader(const ReplayBinaryReader&) = delete;
+    ReplayBinaryReader& operator=(const ReplayBinaryReader&) = delete;
+
+    bool open(const std::string& path, std::string* error = nullptr);
+    void close();
+
+    [[nodiscard]] std::size_t frameCount() const { return frames_.size(); }
+    [[nodiscard]] std::size_t gridChunkCount() const { return grid_chunk_count_; }
+    [[nodiscard]] bool truncated() const { return truncated_; }
+    [[nodiscard]] std::uint32_t schemaVersion() const { return schema_version_; }
+
+    [[nodiscard]] TimePointUs timestampAt(std::size_t index) const { return frames_[index].timestamp_us; }
+    /** First frame with `timestamp_us >= timestamp` (assumes non-decreasing timestamps), or
+     *  `frameCount()` when none. */
+    [[nodiscard]] std::size_t frameAtOrAfter(TimePointUs timestamp) const;
+
+    bool read(std::size_t index, replay_json::ReplayTelemetryRecord& out) const;
+
+private:
+    struct FrameIndexEntry {
+        std::size_t offset{0};
+        TimePointUs timestamp_us{};
+        std::array<std::size_t, kGridSlotCount> grid_offsets{};
+    };
+
+    bool fail(std::string* error, const std::string& message);
+
+    const unsigned char* data_{nullptr};
+    std::size_t size_{0};
+    std::uint32_t schema_version_{0};
+    std::vector<FrameIndexEntry> frames_{};
+    std::size_t grid_chunk_count_{0};
+    bool truncated_{false};
+};
+
+/** Writes every record of `binary_path` to `out` as `replay_json::serializeReplayTelemetryRecord`
+ *  lines, so JSONL tooling (`scripts/replay_locomotion_bundle.py`) can consume binary logs. */
+bool convertReplayBinaryToJsonl(const std::string& binary_path, std::ostream& out, std::string* error = nullptr);
+
+} // namespace replay_binary
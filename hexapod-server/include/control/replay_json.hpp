@@ -1,5 +1,6 @@
 #pragma once
 
+#include "json_writer.hpp"
 #include "local_map.hpp"
 #include "locomotion_debug.hpp"
 #include "locomotion_feasibility.hpp"
@@ -37,6 +38,9 @@ struct ReplayTelemetryRecord {
     ReplayTransitionDiagnostics transition_diagnostics{};
 };
 
+/** Appends one record as a single JSON object (no trailing newline). */
+void writeReplayTelemetryRecord(JsonWriter& out, const ReplayTelemetryRecord& record);
+
 std::string serializeReplayTelemetryRecord(const ReplayTelemetryRecord& record);
 
 } // namespace replay_json
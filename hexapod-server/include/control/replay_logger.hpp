@@ -18,5 +18,8 @@ public:
 std::unique_ptr<IReplayLogger> makeNoopReplayLogger();
 std::unique_ptr<IReplayLogger> makeFileReplayLogger(const std::string& path,
                                                     std::shared_ptr<logging::AsyncLogger> logger);
+/** Fixed-schema binary log (`replay_binary.hpp`); convert with `hexapod-replay-to-jsonl`. */
+std::unique_ptr<IReplayLogger> makeBinaryReplayLogger(const std::string& path,
+                                                      std::shared_ptr<logging::AsyncLogger> logger);
 
 } // namespace replay
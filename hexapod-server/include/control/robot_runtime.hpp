@@ -2,7 +2,6 @@
 
 #include "control_pipeline.hpp"
 #include "control_config.hpp"
-#include "double_buffer.hpp"
 #include "estimator.hpp"
 #include "freshness_policy.hpp"
 #include "hardware_bridge.hpp"
@@ -17,6 +16,7 @@
 #include "safety_supervisor.hpp"
 #include "telemetry_publisher.hpp"
 #include "sim_hardware_bridge.hpp"
+#include "snapshot_buffer.hpp"
 #include "types.hpp"
 
 #include <array>
@@ -80,12 +80,13 @@ private:
     static void scaleMotionIntent(MotionIntent& intent, double scale);
     struct ControlInputSnapshot {
         TimePointUs now{};
-        RobotState raw{};
-        RobotState estimated{};
+        // Pinned views of the cross-loop buffers: the control step reads them in place.
+        SnapshotBuffer<RobotState>::ReadView raw{};
+        SnapshotBuffer<RobotState>::ReadView estimated{};
         MotionIntent intent{};
         SafetyState safety_state{};
-        JointTargets previous_joint_targets{};
-        GaitState previous_gait_state{};
+        SnapshotBuffer<JointTargets>::ReadView previous_joint_targets{};
+        SnapshotBuffer<GaitState>::ReadView previous_gait_state{};
         const LocalMapSnapshot* terrain_snapshot{nullptr};
         TimePointUs terrain_timestamp_us{};
         FreshnessPolicy::Evaluation freshness{};
@@ -123,18 +124,18 @@ private:
     RuntimeDiagnosticsReporter diagnostics_reporter_;
     TimePointUs last_estimator_snapshot_log_us_{};
 
-    DoubleBuffer<RobotState> raw_state_;
-    DoubleBuffer<RobotState> estimated_state_;
-    DoubleBuffer<MotionIntent> motion_intent_;
-    DoubleBuffer<MotionIntent> effective_motion_intent_;
-    DoubleBuffer<SafetyState> safety_state_;
-    DoubleBuffer<LegTargets> leg_targets_;
-    DoubleBuffer<GaitState> gait_state_;
-    DoubleBuffer<CommandGovernorState> command_governor_state_;
-    DoubleBuffer<JointTargets> joint_targets_;
-    DoubleBuffer<telemetry::LocomotionDebugSnapshot> locomotion_debug_;
-    DoubleBuffer<LocomotionFeasibility> locomotion_feasibility_;
-    DoubleBuffer<ControlStatus> status_;
+    SnapshotBuffer<RobotState> raw_state_;
+    SnapshotBuffer<RobotState> estimated_state_;
+    SnapshotBuffer<MotionIntent> motion_intent_;
+    SnapshotBuffer<MotionIntent> effective_motion_intent_;
+    SnapshotBuffer<SafetyState> safety_state_;
+    SnapshotBuffer<LegTargets> leg_targets_;
+    SnapshotBuffer<GaitState> gait_state_;
+    SnapshotBuffer<CommandGovernorState> command_governor_state_;
+    SnapshotBuffer<JointTargets> joint_targets_;
+    SnapshotBuffer<telemetry::LocomotionDebugSnapshot> locomotion_debug_;
+    SnapshotBuffer<LocomotionFeasibility> locomotion_feasibility_;
+    SnapshotBuffer<ControlStatus> status_;
 
     TimePointUs next_telemetry_publish_at_{};
     TimePointUs next_geometry_refresh_at_{};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "hexapod_telemetry_protocol.hpp"
+#include "navigation_manager.hpp"
+#include "telemetry_publisher.hpp"
+#include "types.hpp"
+
+#include <cstdint>
+
+// Builds `hexapod_telemetry_protocol.hpp` message bodies from runtime state. Angles are converted to
+// degrees and legs reordered to the visualiser order, matching the JSON `angles_deg` packet.
+namespace telemetry_binary {
+
+hexapod_telemetry::TelemetryControlFrameBody makeControlFrameBody(const telemetry::ControlFrameTelemetry& frame,
+                                                                  uint32_t sequence);
+
+hexapod_telemetry::TelemetryFusionSummaryBody makeFusionSummaryBody(const RobotState& estimated_state,
+                                                                    TimePointUs timestamp_us);
+
+hexapod_telemetry::TelemetryNavigationSummaryBody makeNavigationSummaryBody(const NavigationMonitorSnapshot& nav,
+                                                                            TimePointUs timestamp_us);
+
+} // namespace telemetry_binary
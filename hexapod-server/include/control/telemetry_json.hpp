@@ -4,6 +4,7 @@
 #include <string>
 
 #include "geometry_config.hpp"
+#include "json_writer.hpp"
 #include "telemetry_publisher.hpp"
 #include "types.hpp"
 
@@ -11,6 +12,17 @@ namespace telemetry_json {
 
 inline constexpr int kSchemaVersion = 1;
 
+// The `write*` forms append to a caller-owned writer; reusing one writer per stream keeps steady-state
+// encoding allocation-free. The `serialize*` forms return a fresh string.
+void writeVisualiserJointsPacket(JsonWriter& out,
+                                 const HexapodGeometry& geometry,
+                                 const JointTargets& joints,
+                                 uint64_t timestamp_ms);
+
+void writeGeometryPacket(JsonWriter& out, const HexapodGeometry& geometry);
+
+void writeControlStepPacket(JsonWriter& out, const telemetry::ControlStepTelemetry& telemetry);
+
 std::string serializeVisualiserJointsPacket(const HexapodGeometry& geometry,
                                             const JointTargets& joints,
                                             uint64_t timestamp_ms);
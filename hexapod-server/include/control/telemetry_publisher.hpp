@@ -47,6 +47,7 @@ struct TelemetryPublisherConfig {
     int udp_port{kDefaultUdpPort};
     int publish_period_ms{kDefaultPublishPeriodMs};
     int geometry_refresh_period_ms{kDefaultGeometryRefreshPeriodMs};
+    bool binary_stream{false};
 };
 
 struct FusionTelemetrySnapshot {
@@ -91,6 +92,15 @@ struct ControlStepTelemetry {
     TimePointUs timestamp_us{};
 };
 
+/** Per-step input for the binary stream (`telemetry_binary.hpp`); a small subset of `ControlStepTelemetry`. */
+struct ControlFrameTelemetry {
+    RobotState estimated_state{};
+    JointTargets joint_targets{};
+    ControlStatus status{};
+    std::optional<NavigationMonitorSnapshot> navigation{};
+    TimePointUs timestamp_us{};
+};
+
 struct TelemetryPublishCounters {
     uint64_t packets_sent{0};
     uint64_t socket_send_failures{0};
@@ -103,6 +113,8 @@ public:
 
     virtual void publishGeometry(const HexapodGeometry& geometry) = 0;
     virtual void publishControlStep(const ControlStepTelemetry& telemetry) = 0;
+    /** Binary control frame plus fusion/navigation summaries. Publishers without a binary stream ignore it. */
+    virtual void publishControlFrame(const ControlFrameTelemetry&) {}
     virtual TelemetryPublishCounters counters() const = 0;
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 #include <vector>
@@ -66,12 +67,29 @@ public:
         }
 
         if (!decoder(response_payload, out)) {
-            log_decode_failure(static_cast<CommandCode>(cmd), response_payload.size());
-            last_result_.error = BridgeError::ProtocolFailure;
-            last_result_.phase = BridgeFailurePhase::CommandDecode;
-            last_result_.domain = BridgeFailureDomain::CommandProtocol;
-            last_result_.retryable = false;
-            return BridgeError::ProtocolFailure;
+            return record_decode_failure(cmd, response_payload.size());
+        }
+
+        return BridgeError::None;
+    }
+
+    // Pipelined requests (see CommandClient::post): post a request now and decode its reply on a
+    // later call, so the serial transfer overlaps with whatever the caller does in between.
+    BridgeError post_with_error(CommandCode cmd, const std::vector<uint8_t>& payload);
+    bool has_pending() const;
+    BridgeError complete_pending_payload_with_error(std::vector<uint8_t>& out_payload);
+
+    template <typename T, typename Decoder>
+    BridgeError complete_pending_decoded_with_error(Decoder&& decoder, T& out) {
+        std::vector<uint8_t> response_payload;
+        const BridgeError request_error = complete_pending_payload_with_error(response_payload);
+        if (request_error != BridgeError::None) {
+            return request_error;
+        }
+
+        if (!decoder(response_payload, out)) {
+            return record_decode_failure(static_cast<CommandCode>(last_result_.command_code),
+                                         response_payload.size());
         }
 
         return BridgeError::None;
@@ -87,6 +105,10 @@ private:
     BridgeError request_transaction(CommandCode cmd,
                                     const std::vector<uint8_t>& payload,
                                     std::vector<uint8_t>* out_payload);
+    BridgeError record_outcome(CommandCode cmd,
+                               const TransportSession::CommandOutcome& outcome,
+                               std::size_t response_payload_size);
+    BridgeError record_decode_failure(CommandCode cmd, std::size_t response_payload_size);
     static BridgeError map_outcome_to_bridge_error(const TransportSession::CommandOutcome& outcome);
 
     static void log_command_failure(CommandCode cmd,
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "logger.hpp"
@@ -29,7 +31,27 @@ public:
                                               const std::vector<uint8_t>& payload,
                                               std::vector<uint8_t>* ack_payload);
 
+    // Pipelined exchange: `post` sends a request and returns without waiting for its reply;
+    // `complete_pending` waits for that reply. At most one request is outstanding, so posting
+    // again or starting a `transact` first drains (and drops) the pending reply. Posted
+    // requests are not retried: the next cycle's request supersedes a lost one.
+    void post(CommandCode cmd, const std::vector<uint8_t>& payload);
+    bool has_pending() const;
+    std::optional<CommandCode> pending_command() const;
+    TransportSession::CommandOutcome complete_pending(std::vector<uint8_t>* ack_payload);
+
 private:
+    struct PendingRequest {
+        CommandCode cmd;
+        uint16_t seq;
+        std::chrono::steady_clock::time_point sent_at;
+    };
+
+    void log_telemetry(CommandCode cmd,
+                       uint16_t seq,
+                       std::chrono::steady_clock::time_point start,
+                       const TransportSession::CommandOutcome& outcome,
+                       int attempts) const;
     static const char* outcome_to_text(TransportSession::OutcomeClass outcome);
     static const char* command_name(CommandCode cmd);
     static const char* domain_error_for_outcome(TransportSession::OutcomeClass outcome);
@@ -37,4 +59,5 @@ private:
     TransportSession& transport_;
     std::shared_ptr<logging::AsyncLogger> logger_{};
     RetryPolicy retry_policy_{};
+    std::optional<PendingRequest> pending_{};
 };
@@ -109,6 +109,13 @@ public:
     BridgeError last_error() const;
     std::optional<BridgeCommandResultMetadata> last_bridge_result() const override;
 
+    // Pipelined bus mode: write() posts SET_JOINT_TARGETS_GET_STATE without waiting and the next
+    // read() decodes its reply, so a bus cycle costs one serial exchange that transfers while the
+    // caller is between calls. read() then returns the state sampled when the previous cycle's
+    // targets were applied. Falls back to separate commands if the firmware rejects the command.
+    void set_pipelined_bus(bool enabled);
+    bool pipelined_bus() const;
+
 private:
     bool run_ack_command(const char* command_name,
                          CommandCode command_code,
@@ -136,6 +143,7 @@ private:
     int timeout_ms_;
     std::vector<float> calibrations_;
     bool initialized_{false};
+    bool pipelined_bus_{false};
 
     std::unique_ptr<IPacketEndpoint> packet_endpoint_{};
     std::shared_ptr<logging::AsyncLogger> logger_{};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+// Append-only JSON text builder over a reusable buffer. `clear()` keeps the capacity, so once a
+// writer has held its largest payload, encoding the next one does no heap allocation.
+//
+// Numbers go through `std::to_chars`. The two floating-point styles reproduce the iostream output
+// the telemetry and replay encoders were built on, so consumers see identical text:
+//   number(v)  - default `operator<<` (`%g`, 6 significant digits), used by `telemetry_json`
+//   fixed6(v)  - `std::fixed << std::setprecision(6)` with trailing zeros trimmed, used by `replay_json`
+// Keys and string values are written verbatim: callers only pass identifiers and enum names.
+class JsonWriter {
+public:
+    explicit JsonWriter(std::size_t reserve_bytes = 0) { buffer_.reserve(reserve_bytes); }
+
+    void clear() { buffer_.clear(); }
+    [[nodiscard]] std::string_view view() const { return buffer_; }
+    [[nodiscard]] std::size_t size() const { return buffer_.size(); }
+    [[nodiscard]] std::size_t capacity() const { return buffer_.capacity(); }
+    [[nodiscard]] std::string str() const { return buffer_; }
+
+    JsonWriter& raw(char c) {
+        buffer_.push_back(c);
+        return *this;
+    }
+
+    JsonWriter& raw(std::string_view text) {
+        buffer_.append(text);
+        return *this;
+    }
+
+    JsonWriter& boolean(bool value) { return raw(value ? std::string_view{"true"} : std::string_view{"false"}); }
+
+    JsonWriter& quoted(std::string_view text) { return raw('"').raw(text).raw('"'); }
+
+    template <typename Int>
+    JsonWriter& integer(Int value) {
+        static_assert(std::is_integral_v<Int> && !std::is_same_v<Int, bool>, "integer() takes integral values");
+        char digits[24];
+        const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+        return raw(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
+    }
+
+    JsonWriter& number(double value) {
+        char digits[32];
+        const std::to_chars_result result =
+            std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::general, 6);
+        return raw(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
+    }
+
+    JsonWriter& fixed6(double value) {
+        // Fixed notation spells out every integer digit: up to 309 for the largest double.
+        char digits[328];
+        const std::to_chars_result result =
+            std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::fixed, 6);
+        std::string_view text(digits, static_cast<std::size_t>(result.ptr - digits));
+        const std::size_t trailing = text.find_last_not_of('0');
+        if (trailing != std::string_view::npos) {
+            text = text.substr(0, text[trailing] == '.' ? trailing : trailing + 1);
+        }
+        return text.empty() ? raw('0') : raw(text);
+    }
+
+    /** Upper-case hexadecimal without prefix (`std::hex << std::uppercase`). */
+    JsonWriter& hexUpper(std::uint32_t value) {
+        char digits[8];
+        const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value, 16);
+        for (char* c = digits; c != result.ptr; ++c) {
+            if (*c >= 'a' && *c <= 'f') {
+                *c = static_cast<char>(*c - 'a' + 'A');
+            }
+        }
+        return raw(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
+    }
+
+private:
+    std::string buffer_{};
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+// Latest-value exchange between runtime loops: one thread publishes a snapshot, any number of
+// threads read the most recent one. Readers never block and never copy; they pin the slot the
+// value lives in for as long as they hold a `ReadView`.
+//
+// The value lives in one of `Slots` slots, each with a reader pin count. A write fills a slot that
+// is neither published nor pinned, then publishes it by swapping the generation-tagged index. A
+// reader loads the published index, pins that slot and re-checks the index; if a publish landed
+// in between it unpins and retries, so a reader only ever retries because a newer value appeared.
+// With at most `Slots - 2` views held at once a writer always finds a free slot without waiting.
+//
+// Writes from several threads are serialised by a writer-only flag; readers never touch it.
+template <typename T, std::size_t Slots = 8>
+class SnapshotBuffer {
+    static_assert(Slots >= 3, "SnapshotBuffer needs a published slot, a write slot and one to pin");
+    static_assert(Slots <= 256, "slot index is packed into the low byte of the published word");
+
+    struct alignas(64) Slot {
+        T value{};
+        mutable std::atomic<std::uint32_t> pins{0};
+    };
+
+public:
+    /// Zero-copy read of one published snapshot. The slot stays pinned, and therefore unchanged,
+    /// until the view is destroyed or reset. A default-constructed view is empty.
+    class ReadView {
+    public:
+        ReadView() = default;
+        ReadView(const ReadView&) = delete;
+        ReadView& operator=(const ReadView&) = delete;
+        ReadView(ReadView&& other) noexcept : slot_(std::exchange(other.slot_, nullptr)) {}
+        ReadView& operator=(ReadView&& other) noexcept {
+            if (this != &other) {
+                reset();
+                slot_ = std::exchange(other.slot_, nullptr);
+            }
+            return *this;
+        }
+        ~ReadView() { reset(); }
+
+        [[nodiscard]] const T& operator*() const { return slot_->value; }
+        [[nodiscard]] const T* operator->() const { return &slot_->value; }
+        [[nodiscard]] explicit operator bool() const { return slot_ != nullptr; }
+
+        void reset() {
+            if (slot_ != nullptr) {
+                slot_->pins.fetch_sub(1, std::memory_order_release);
+                slot_ = nullptr;
+            }
+        }
+
+    private:
+        friend class SnapshotBuffer;
+        explicit ReadView(const Slot* slot) : slot_(slot) {}
+
+        const Slot* slot_{nullptr};
+    };
+
+    void write(const T& value) {
+        write_impl(value);
+    }
+
+    void write(T&& value) {
+        write_impl(std::move(value));
+    }
+
+    [[nodiscard]] ReadView view() const {
+        for (;;) {
+            const std::uint64_t published = published_.load(std::memory_order_seq_cst);
+            const Slot& slot = slots_[slotIndex(published)];
+            // seq_cst pairs with the writer's pin check: either the writer sees this pin, or this
+            // re-check sees the writer's newer publish.
+            slot.pins.fetch_add(1, std::memory_order_seq_cst);
+            if (published_.load(std::memory_order_seq_cst) == published) {
+                return ReadView(&slot);
+            }
+            slot.pins.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    /// Copy of the latest snapshot, for callers that keep it beyond the current step.
+    [[nodiscard]] T read() const {
+        return *view();
+    }
+
+private:
+    static std::size_t slotIndex(std::uint64_t published) {
+        return static_cast<std::size_t>(published & 0xFFu);
+    }
+
+    template <typename U>
+    void write_impl(U&& value) {
+        while (writer_busy_.test_and_set(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        const std::uint64_t published = published_.load(std::memory_order_relaxed);
+        const std::size_t current = slotIndex(published);
+        std::size_t target = current;
+        for (std::size_t probe = 1;; ++probe) {
+            const std::size_t candidate = (current + probe) % Slots;
+            if (candidate == current) {
+                // Every other slot is pinned: more than `Slots - 2` views are outstanding.
+                std::this_thread::yield();
+                continue;
+            }
+            if (slots_[candidate].pins.load(std::memory_order_seq_cst) == 0u) {
+                target = candidate;
+                break;
+            }
+        }
+        slots_[target].value = std::forward<U>(value);
+        const std::uint64_t generation = (published >> 8u) + 1u;
+        published_.store((generation << 8u) | target, std::memory_order_seq_cst);
+        writer_busy_.clear(std::memory_order_release);
+    }
+
+    std::array<Slot, Slots> slots_{};
+    alignas(64) std::atomic<std::uint64_t> published_{0};
+    std::atomic_flag writer_busy_ = ATOMIC_FLAG_INIT;
+};
@@ -0,0 +1,45 @@
+#include "replay_binary.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+
+void usage()
+{
+    std::cout
+        << "Usage: hexapod-replay-to-jsonl <replay.hxrb> [output.ndjson]\n"
+        << "  Converts a binary replay log (Runtime.ReplayLog.Format = \"binary\") to replay NDJSON.\n"
+        << "  Writes to stdout when no output path is given.\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3 || std::strcmp(argv[1], "-h") == 0 || std::strcmp(argv[1], "--help") == 0) {
+        usage();
+        return argc < 2 || argc > 3 ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    std::string error;
+    bool ok = false;
+    if (argc == 3) {
+        std::ofstream out(argv[2], std::ios::out | std::ios::trunc);
+        if (!out.is_open()) {
+            std::cerr << "hexapod-replay-to-jsonl: failed to open '" << argv[2] << "'\n";
+            return EXIT_FAILURE;
+        }
+        ok = replay_binary::convertReplayBinaryToJsonl(argv[1], out, &error);
+    } else {
+        ok = replay_binary::convertReplayBinaryToJsonl(argv[1], std::cout, &error);
+    }
+    if (!ok) {
+        std::cerr << "hexapod-replay-to-jsonl: " << error << '\n';
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
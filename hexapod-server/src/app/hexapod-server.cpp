@@ -102,8 +102,10 @@ std::unique_ptr<IHardwareBridge> makeHardwareBridge(const ParsedToml& config,
                                               logger);
   }
 
-  return std::make_unique<SimpleHardwareBridge>(config.serialDevice, config.baudRate,
-                                                config.timeout, config.minMaxPulses, logger);
+  auto bridge = std::make_unique<SimpleHardwareBridge>(config.serialDevice, config.baudRate,
+                                                       config.timeout, config.minMaxPulses, logger);
+  bridge->set_pipelined_bus(config.pipelinedBus);
+  return bridge;
 }
 
 void applyTelemetryCliOverrides(ParsedToml& config,
@@ -126,6 +128,9 @@ void applyTelemetryCliOverrides(ParsedToml& config,
     config.telemetryGeometryResendIntervalSec =
         options.telemetryGeometryResendIntervalSecOverride.value();
   }
+  if (options.telemetryBinaryStreamOverride.has_value()) {
+    config.telemetryBinaryStream = options.telemetryBinaryStreamOverride.value();
+  }
 
   if (config.telemetryHost.empty()) {
     LOG_WARN(logger, "Runtime.Telemetry.Host effective value was empty, using 127.0.0.1");
@@ -254,12 +259,16 @@ int main(int argc, char** argv)
            ", PublishRateHz=",
            control_cfg.telemetry.publish_rate_hz,
            ", GeometryResendIntervalSec=",
-           control_cfg.telemetry.geometry_resend_interval_sec);
+           control_cfg.telemetry.geometry_resend_interval_sec,
+           ", BinaryStream=",
+           control_cfg.telemetry.binary_stream);
   LOG_INFO(logger,
            "Runtime.ReplayLog.Enabled=",
            control_cfg.replay_log.enabled,
            ", Path=",
-           control_cfg.replay_log.file_path);
+           control_cfg.replay_log.file_path,
+           ", Format=",
+           control_cfg.replay_log.format == control_config::ReplayLogFormat::Binary ? "binary" : "jsonl");
   LOG_INFO(logger,
            "Runtime.Trace.ControlLoop=",
            control_cfg.control_loop_trace_enabled ? 1 : 0);
@@ -306,9 +315,12 @@ int main(int argc, char** argv)
   } else {
     estimator = std::make_unique<SimpleEstimator>();
   }
-  auto replay_logger = control_cfg.replay_log.enabled
-                           ? replay::makeFileReplayLogger(control_cfg.replay_log.file_path, logger)
-                           : replay::makeNoopReplayLogger();
+  std::unique_ptr<replay::IReplayLogger> replay_logger = replay::makeNoopReplayLogger();
+  if (control_cfg.replay_log.enabled) {
+    replay_logger = control_cfg.replay_log.format == control_config::ReplayLogFormat::Binary
+                        ? replay::makeBinaryReplayLogger(control_cfg.replay_log.file_path, logger)
+                        : replay::makeFileReplayLogger(control_cfg.replay_log.file_path, logger);
+  }
   RobotControl robot(std::move(hw), std::move(estimator), logger, control_cfg, std::move(replay_logger));
 
   if (!robot.init()) {
@@ -146,6 +146,8 @@ bool parseRuntimeSection(const toml::value& root,
       {"Runtime.Investigation.DisableStanceTiltLeveling", ValueType::Bool, false, false, kNoBoundsMin, kNoBoundsMax, "", false, 0.0},
       {"Runtime.Investigation.SuppressFusionCorrections", ValueType::Bool, false, false, kNoBoundsMin, kNoBoundsMax, "", false, 0.0},
       {"Runtime.Investigation.SuppressFusionResets", ValueType::Bool, false, false, kNoBoundsMin, kNoBoundsMax, "", false, 0.0},
+      {"Runtime.ReplayLog.Format", ValueType::String, false, false, kNoBoundsMin, kNoBoundsMax, "jsonl", false, 0.0},
+      {"Runtime.Telemetry.BinaryStream", ValueType::Bool, false, false, kNoBoundsMin, kNoBoundsMax, "", false, 0.0},
   };
 
   const auto* mode_desc = &schema[0];
@@ -203,6 +205,20 @@ bool parseRuntimeSection(const toml::value& root,
   out.logToFile = findOrByPath<bool>(root, schema[11].key, schema[11].default_bool);
   out.replayLogToFile = findOrByPath<bool>(root, schema[12].key, schema[12].default_bool);
   out.replayLogFilePath = findOrByPath<std::string>(root, schema[13].key, schema[13].default_string);
+  std::string replay_format = findOrByPath<std::string>(root, schema[30].key, schema[30].default_string);
+  std::transform(replay_format.begin(), replay_format.end(), replay_format.begin(),
+                 [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+  if (replay_format != "jsonl" && replay_format != "binary") {
+    config_validation::emitDiagnostic(diagnostics, "runtime", schema[30].key, "invalid_enum",
+                                      "Runtime.ReplayLog.Format must be 'jsonl' or 'binary', got '" +
+                                          replay_format + "', using jsonl");
+    if (logger) {
+      LOG_WARN(logger, "[runtime] Runtime.ReplayLog.Format must be 'jsonl' or 'binary', got '", replay_format,
+               "', using jsonl");
+    }
+    replay_format = schema[30].default_string;
+  }
+  out.replayLogFormat = replay_format;
   out.telemetryEnabled = findOrByPath<bool>(root, schema[14].key, schema[14].default_bool);
   out.telemetryHost = findOrByPath<std::string>(root, schema[15].key, schema[15].default_string);
   if (out.telemetryHost.empty()) {
@@ -223,6 +239,7 @@ bool parseRuntimeSection(const toml::value& root,
   out.telemetryGeometryResendIntervalSec = config_validation::parseDoubleWithFallback(
       root, schema[18].key, schema[18].default_double, schema[18].min_value, schema[18].max_value,
       "runtime", logger, diagnostics);
+  out.telemetryBinaryStream = findOrByPath<bool>(root, schema[31].key, schema[31].default_bool);
 
   out.telemetryUdpHost = out.telemetryHost;
   out.telemetryUdpPort = out.telemetryPort;
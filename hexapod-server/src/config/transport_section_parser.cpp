@@ -41,6 +41,7 @@ bool parseTransportSection(const toml::value& root, ParsedToml& out, bool requir
   out.serialDevice = serialDevice;
   out.baudRate = baudRate;
   out.timeout = timeout > 0 ? timeout : out.timeout;
+  out.pipelinedBus = toml::find_or<bool>(root, "PipelinedBus", out.pipelinedBus);
   return true;
 }
 
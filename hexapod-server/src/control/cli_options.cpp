@@ -110,6 +110,8 @@ bool parseCliOptions(int argc, char** argv, CliOptions& out, std::string& error)
         return false;
       }
       out.telemetryGeometryResendIntervalSecOverride = value;
+    } else if (arg == "--telemetry-binary-stream") {
+      out.telemetryBinaryStreamOverride = true;
     } else if (arg == "--investigation-disable-terrain-stance-bias") {
       out.investigationDisableTerrainStanceBiasOverride = true;
     } else if (arg == "--investigation-disable-terrain-swing-clearance") {
@@ -87,6 +87,7 @@ ControlConfig fromParsedToml(const ParsedToml& config) {
     parsed.telemetry.port = config.telemetryPort;
     parsed.telemetry.publish_rate_hz = config.telemetryPublishRateHz;
     parsed.telemetry.geometry_resend_interval_sec = config.telemetryGeometryResendIntervalSec;
+    parsed.telemetry.binary_stream = config.telemetryBinaryStream;
     parsed.telemetry.udp_host = config.telemetryHost;
     parsed.telemetry.udp_port = config.telemetryPort;
     parsed.telemetry.publish_period = std::chrono::milliseconds{
@@ -95,6 +96,7 @@ ControlConfig fromParsedToml(const ParsedToml& config) {
         std::max(1, static_cast<int>(std::lround(config.telemetryGeometryResendIntervalSec * 1000.0)))};
     parsed.replay_log.enabled = config.replayLogToFile;
     parsed.replay_log.file_path = config.replayLogFilePath;
+    parsed.replay_log.format = config.replayLogFormat == "binary" ? ReplayLogFormat::Binary : ReplayLogFormat::Jsonl;
     parsed.foot_terrain.enable_stance_plane_bias = !config.investigationDisableTerrainStanceBias;
     parsed.foot_terrain.enable_swing_clearance = !config.investigationDisableTerrainSwingClearance;
     parsed.foot_terrain.enable_swing_xy_nudge = !config.investigationDisableTerrainSwingXYNudge;
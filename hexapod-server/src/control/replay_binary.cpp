@@ -0,0 +1,429 @@
+#include "replay_binary.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace replay_binary {
+namespace {
+
+struct FileHeader {
+    std::array<char, 8> magic{};
+    std::uint32_t format_version{0};
+    std::uint32_t schema_version{0};
+    std::uint32_t frame_bytes{0};
+    std::uint32_t section_count{0};
+};
+
+struct ChunkHeader {
+    std::uint32_t kind{0};
+    std::uint32_t bytes{0};
+};
+
+struct GridHeader {
+    std::uint8_t slot{0};
+    std::uint8_t reserved[3]{};
+    std::int32_t width_cells{0};
+    std::int32_t height_cells{0};
+    std::uint32_t value_count{0};
+    double resolution_m{0.0};
+    double center_x_m{0.0};
+    double center_y_m{0.0};
+    double center_yaw_rad{0.0};
+};
+
+static_assert(sizeof(LocalMapCellState) == 1, "occupancy cells are stored as bytes");
+
+/** Every non-grid field the JSON serializer reads, as trivially-copyable sections. The order here is
+ *  the on-disk frame layout; the header records each section's size. */
+template <typename Record, typename Fn>
+void forEachFrameSection(Record& record, Fn&& fn)
+{
+    fn(record.timestamp_us);
+    fn(record.sample_id);
+    fn(record.status);
+    fn(record.governor);
+    fn(record.estimated_state);
+    fn(record.leg_targets);
+    fn(record.gait_state);
+    fn(record.joint_targets);
+    fn(record.locomotion_debug);
+    fn(record.locomotion_feasibility);
+    fn(record.transition_diagnostics);
+    fn(record.terrain_snapshot.elevation_has_data);
+    fn(record.terrain_snapshot.ground_elevation_has_data);
+    fn(record.terrain_snapshot.last_observation_timestamp);
+    fn(record.terrain_snapshot.last_primary_observation_timestamp);
+    fn(record.terrain_snapshot.has_observations);
+    fn(record.terrain_snapshot.has_primary_observations);
+    fn(record.terrain_snapshot.fresh);
+    fn(record.terrain_snapshot.nearest_obstacle_distance_m);
+}
+
+std::vector<std::uint32_t> frameSectionSizes()
+{
+    std::vector<std::uint32_t> sizes;
+    replay_json::ReplayTelemetryRecord record{};
+    forEachFrameSection(record, [&](const auto& section) {
+        static_assert(std::is_trivially_copyable_v<std::decay_t<decltype(section)>>,
+                      "replay frame sections must be trivially copyable");
+        sizes.push_back(static_cast<std::uint32_t>(sizeof(section)));
+    });
+    return sizes;
+}
+
+std::uint32_t frameBytes(const std::vector<std::uint32_t>& sizes)
+{
+    std::uint32_t total = 0;
+    for (const std::uint32_t size : sizes) {
+        total += size;
+    }
+    return total;
+}
+
+template <typename T>
+void writePod(std::ofstream& file, const T& value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T readPod(const unsigned char* data)
+{
+    T value{};
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+GridHeader makeGridHeader(GridSlot slot, int width, int height, double resolution, const NavPose2d& center,
+                          std::size_t value_count)
+{
+    GridHeader header{};
+    header.slot = static_cast<std::uint8_t>(slot);
+    header.width_cells = width;
+    header.height_cells = height;
+    header.value_count = static_cast<std::uint32_t>(value_count);
+    header.resolution_m = resolution;
+    header.center_x_m = center.x_m;
+    header.center_y_m = center.y_m;
+    header.center_yaw_rad = center.yaw_rad;
+    return header;
+}
+
+template <typename Grid, typename Values>
+bool sameGrid(const Grid& lhs, const Grid& rhs, const Values& lhs_values, const Values& rhs_values)
+{
+    // Bitwise comparison so NaN (unknown elevation) cells compare equal to themselves.
+    return lhs.width_cells == rhs.width_cells && lhs.height_cells == rhs.height_cells &&
+           std::memcmp(&lhs.resolution_m, &rhs.resolution_m, sizeof(double)) == 0 &&
+           std::memcmp(&lhs.center_pose, &rhs.center_pose, sizeof(NavPose2d)) == 0 &&
+           lhs_values.size() == rhs_values.size() &&
+           (lhs_values.empty() ||
+            std::memcmp(lhs_values.data(), rhs_values.data(), lhs_values.size() * sizeof(lhs_values[0])) == 0);
+}
+
+template <typename Grid>
+void applyGridHeader(const GridHeader& header, Grid& grid)
+{
+    grid.width_cells = header.width_cells;
+    grid.height_cells = header.height_cells;
+    grid.resolution_m = header.resolution_m;
+    grid.center_pose = NavPose2d{header.center_x_m, header.center_y_m, header.center_yaw_rad};
+}
+
+} // namespace
+
+bool ReplayBinaryWriter::open(const std::string& path, std::string* error)
+{
+    close();
+    file_.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+        if (error) {
+            *error = "failed to open '" + path + "'";
+        }
+        return false;
+    }
+
+    const std::vector<std::uint32_t> sizes = frameSectionSizes();
+    FileHeader header{};
+    header.magic = kMagic;
+    header.format_version = kFormatVersion;
+    header.schema_version = static_cast<std::uint32_t>(replay_json::kSchemaVersion);
+    header.frame_bytes = frameBytes(sizes);
+    header.section_count = static_cast<std::uint32_t>(sizes.size());
+    writePod(file_, header);
+    file_.write(reinterpret_cast<const char*>(sizes.data()),
+                static_cast<std::streamsize>(sizes.size() * sizeof(std::uint32_t)));
+
+    frame_.assign(header.frame_bytes, 0u);
+    grid_written_.fill(false);
+    frames_written_ = 0;
+    grid_chunks_written_ = 0;
+    return static_cast<bool>(file_);
+}
+
+bool ReplayBinaryWriter::write(const replay_json::ReplayTelemetryRecord& record)
+{
+    if (!file_.is_open()) {
+        return false;
+    }
+
+    const LocalMapSnapshot& terrain = record.terrain_snapshot;
+    writeOccupancyGridIfChanged(GridSlot::Raw, terrain.raw);
+    writeOccupancyGridIfChanged(GridSlot::Inflated, terrain.inflated);
+    writeElevationGridIfChanged(GridSlot::ElevationMaxHitZ, terrain.elevation_max_hit_z);
+    writeElevationGridIfChanged(GridSlot::ElevationGroundMeanZ, terrain.elevation_ground_mean_z);
+
+    std::size_t offset = 0;
+    forEachFrameSection(record, [&](const auto& section) {
+        std::memcpy(frame_.data() + offset, &section, sizeof(section));
+        offset += sizeof(section);
+    });
+    writePod(file_, ChunkHeader{static_cast<std::uint32_t>(ChunkKind::Frame), static_cast<std::uint32_t>(offset)});
+    file_.write(reinterpret_cast<const char*>(frame_.data()), static_cast<std::streamsize>(offset));
+    ++frames_written_;
+    return static_cast<bool>(file_);
+}
+
+void ReplayBinaryWriter::writeOccupancyGridIfChanged(GridSlot slot, const LocalOccupancyGrid& grid)
+{
+    const std::size_t index = static_cast<std::size_t>(slot);
+    LocalOccupancyGrid& last = slot == GridSlot::Raw ? last_raw_ : last_inflated_;
+    if (grid_written_[index] && sameGrid(grid, last, grid.cells, last.cells)) {
+        return;
+    }
+    const std::size_t value_bytes = grid.cells.size();
+    writePod(file_, ChunkHeader{static_cast<std::uint32_t>(ChunkKind::Grid),
+                                static_cast<std::uint32_t>(sizeof(GridHeader) + value_bytes)});
+    writePod(file_, makeGridHeader(slot, grid.width_cells, grid.height_cells, grid.resolution_m, grid.center_pose,
+                                   grid.cells.size()));
+    file_.write(reinterpret_cast<const char*>(grid.cells.data()), static_cast<std::streamsize>(value_bytes));
+    last = grid;
+    grid_written_[index] = true;
+    ++grid_chunks_written_;
+}
+
+void ReplayBinaryWriter::writeElevationGridIfChanged(GridSlot slot, const LocalElevationGrid& grid)
+{
+    const std::size_t index = static_cast<std::size_t>(slot);
+    LocalElevationGrid& last =
+        slot == GridSlot::ElevationMaxHitZ ? last_elevation_max_hit_z_ : last_elevation_ground_mean_z_;
+    if (grid_written_[index] && sameGrid(grid, last, grid.max_hit_z_m, last.max_hit_z_m)) {
+        return;
+    }
+    const std::size_t value_bytes = grid.max_hit_z_m.size() * sizeof(double);
+    writePod(file_, ChunkHeader{static_cast<std::uint32_t>(ChunkKind::Grid),
+                                static_cast<std::uint32_t>(sizeof(GridHeader) + value_bytes)});
+    writePod(file_, makeGridHeader(slot, grid.width_cells, grid.height_cells, grid.resolution_m, grid.center_pose,
+                                   grid.max_hit_z_m.size()));
+    file_.write(reinterpret_cast<const char*>(grid.max_hit_z_m.data()), static_cast<std::streamsize>(value_bytes));
+    last = grid;
+    grid_written_[index] = true;
+    ++grid_chunks_written_;
+}
+
+void ReplayBinaryWriter::flush()
+{
+    if (file_.is_open()) {
+        file_.flush();
+    }
+}
+
+void ReplayBinaryWriter::close()
+{
+    if (file_.is_open()) {
+        file_.close();
+    }
+}
+
+ReplayBinaryReader::~ReplayBinaryReader()
+{
+    close();
+}
+
+void ReplayBinaryReader::close()
+{
+    if (data_ != nullptr) {
+        ::munmap(const_cast<unsigned char*>(data_), size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    schema_version_ = 0;
+    frames_.clear();
+    grid_chunk_count_ = 0;
+    truncated_ = false;
+}
+
+bool ReplayBinaryReader::fail(std::string* error, const std::string& message)
+{
+    close();
+    if (error) {
+        *error = message;
+    }
+    return false;
+}
+
+bool ReplayBinaryReader::open(const std::string& path, std::string* error)
+{
+    close();
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return fail(error, "failed to open '" + path + "'");
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return fail(error, "'" + path + "' is empty");
+    }
+    void* mapped = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        return fail(error, "failed to map '" + path + "'");
+    }
+    data_ = static_cast<const unsigned char*>(mapped);
+    size_ = static_cast<std::size_t>(info.st_size);
+
+    if (size_ < sizeof(FileHeader)) {
+        return fail(error, "'" + path + "' is too short for a replay header");
+    }
+    const FileHeader header = readPod<FileHeader>(data_);
+    if (header.magic != kMagic) {
+        return fail(error, "'" + path + "' is not a binary replay log");
+    }
+    if (header.format_version != kFormatVersion) {
+        return fail(error, "unsupported binary replay format version " + std::to_string(header.format_version));
+    }
+    const std::vector<std::uint32_t> sizes = frameSectionSizes();
+    const std::size_t sections_bytes = static_cast<std::size_t>(header.section_count) * sizeof(std::uint32_t);
+    if (header.section_count != sizes.size() || size_ < sizeof(FileHeader) + sections_bytes ||
+        std::memcmp(data_ + sizeof(FileHeader), sizes.data(), sections_bytes) != 0 ||
+        header.frame_bytes != frameBytes(sizes)) {
+        return fail(error, "'" + path + "' was written with a different replay record layout");
+    }
+    schema_version_ = header.schema_version;
+
+    std::array<std::size_t, kGridSlotCount> current_grids{};
+    std::size_t cursor = sizeof(FileHeader) + sections_bytes;
+    while (cursor < size_) {
+        if (size_ - cursor < sizeof(ChunkHeader)) {
+            truncated_ = true;
+            break;
+        }
+        const ChunkHeader chunk = readPod<ChunkHeader>(data_ + cursor);
+        const std::size_t payload = cursor + sizeof(ChunkHeader);
+        if (size_ - payload < chunk.bytes) {
+            truncated_ = true;
+            break;
+        }
+        if (chunk.kind == static_cast<std::uint32_t>(ChunkKind::Frame)) {
+            if (chunk.bytes != header.frame_bytes) {
+                return fail(error, "frame chunk size mismatch at offset " + std::to_string(cursor));
+            }
+            FrameIndexEntry entry{};
+            entry.offset = payload;
+            entry.timestamp_us = readPod<TimePointUs>(data_ + payload);
+            entry.grid_offsets = current_grids;
+            frames_.push_back(entry);
+        } else if (chunk.kind == static_cast<std::uint32_t>(ChunkKind::Grid)) {
+            if (chunk.bytes < sizeof(GridHeader)) {
+                return fail(error, "grid chunk too short at offset " + std::to_string(cursor));
+            }
+            const GridHeader grid = readPod<GridHeader>(data_ + payload);
+            const std::size_t value_bytes =
+                grid.slot < static_cast<std::uint8_t>(GridSlot::ElevationMaxHitZ) ? 1u : sizeof(double);
+            if (grid.slot >= kGridSlotCount ||
+                chunk.bytes != sizeof(GridHeader) + static_cast<std::size_t>(grid.value_count) * value_bytes) {
+                return fail(error, "malformed grid chunk at offset " + std::to_string(cursor));
+            }
+            current_grids[grid.slot] = payload;
+            ++grid_chunk_count_;
+        }
+        // Unknown chunk kinds are skipped so newer writers can add optional chunks.
+        cursor = payload + chunk.bytes;
+    }
+    return true;
+}
+
+std::size_t ReplayBinaryReader::frameAtOrAfter(TimePointUs timestamp) const
+{
+    const auto it = std::lower_bound(frames_.begin(), frames_.end(), timestamp.value,
+                                     [](const FrameIndexEntry& entry, std::uint64_t value) {
+                                         return entry.timestamp_us.value < value;
+                                     });
+    return static_cast<std::size_t>(it - frames_.begin());
+}
+
+bool ReplayBinaryReader::read(std::size_t index, replay_json::ReplayTelemetryRecord& out) const
+{
+    if (index >= frames_.size()) {
+        return false;
+    }
+    const FrameIndexEntry& entry = frames_[index];
+    std::size_t offset = entry.offset;
+    forEachFrameSection(out, [&](auto& section) {
+        std::memcpy(&section, data_ + offset, sizeof(section));
+        offset += sizeof(section);
+    });
+
+    LocalMapSnapshot& terrain = out.terrain_snapshot;
+    const auto read_occupancy = [&](GridSlot slot, LocalOccupancyGrid& grid) {
+        const std::size_t grid_offset = entry.grid_offsets[static_cast<std::size_t>(slot)];
+        if (grid_offset == 0) {
+            grid = LocalOccupancyGrid{};
+            return;
+        }
+        const GridHeader header = readPod<GridHeader>(data_ + grid_offset);
+        applyGridHeader(header, grid);
+        grid.cells.resize(header.value_count);
+        std::memcpy(grid.cells.data(), data_ + grid_offset + sizeof(GridHeader), header.value_count);
+    };
+    const auto read_elevation = [&](GridSlot slot, LocalElevationGrid& grid) {
+        const std::size_t grid_offset = entry.grid_offsets[static_cast<std::size_t>(slot)];
+        if (grid_offset == 0) {
+            grid = LocalElevationGrid{};
+            return;
+        }
+        const GridHeader header = readPod<GridHeader>(data_ + grid_offset);
+        applyGridHeader(header, grid);
+        grid.max_hit_z_m.resize(header.value_count);
+        std::memcpy(grid.max_hit_z_m.data(), data_ + grid_offset + sizeof(GridHeader),
+                    static_cast<std::size_t>(header.value_count) * sizeof(double));
+    };
+    read_occupancy(GridSlot::Raw, terrain.raw);
+    read_occupancy(GridSlot::Inflated, terrain.inflated);
+    read_elevation(GridSlot::ElevationMaxHitZ, terrain.elevation_max_hit_z);
+    read_elevation(GridSlot::ElevationGroundMeanZ, terrain.elevation_ground_mean_z);
+    return true;
+}
+
+bool convertReplayBinaryToJsonl(const std::string& binary_path, std::ostream& out, std::string* error)
+{
+    ReplayBinaryReader reader;
+    if (!reader.open(binary_path, error)) {
+        return false;
+    }
+    replay_json::ReplayTelemetryRecord record{};
+    JsonWriter json;
+    for (std::size_t i = 0; i < reader.frameCount(); ++i) {
+        reader.read(i, record);
+        json.clear();
+        replay_json::writeReplayTelemetryRecord(json, record);
+        json.raw('\n');
+        out.write(json.view().data(), static_cast<std::streamsize>(json.size()));
+    }
+    if (!out) {
+        if (error) {
+            *error = "failed writing JSONL output";
+        }
+        return false;
+    }
+    return true;
+}
+
+} // namespace replay_binary
@@ -6,106 +6,85 @@
 #include <array>
 #include <cmath>
 #include <cstdint>
-#include <iomanip>
 #include <limits>
-#include <sstream>
 
 namespace replay_json {
 namespace {
 
-std::string formatNumber(const double value)
+void appendVec3(JsonWriter& out, const Vec3& vec)
 {
-    std::ostringstream out;
-    out << std::fixed << std::setprecision(6) << value;
-    std::string text = out.str();
-    const auto trailing = text.find_last_not_of('0');
-    if (trailing != std::string::npos && text[trailing] == '.') {
-        text.erase(trailing);
-    } else if (trailing != std::string::npos) {
-        text.erase(trailing + 1);
-    }
-    if (text.empty()) {
-        return "0";
-    }
-    return text;
-}
-
-void appendVec3(std::ostringstream& payload, const Vec3& vec)
-{
-    payload << '[' << formatNumber(vec.x) << ',' << formatNumber(vec.y) << ',' << formatNumber(vec.z)
-            << ']';
+    out.raw('[').fixed6(vec.x).raw(',').fixed6(vec.y).raw(',').fixed6(vec.z).raw(']');
 }
 
-void appendEuler(std::ostringstream& payload, const EulerAnglesRad3& vec)
+void appendEuler(JsonWriter& out, const EulerAnglesRad3& vec)
 {
-    payload << '[' << formatNumber(vec.x) << ',' << formatNumber(vec.y) << ',' << formatNumber(vec.z)
-            << ']';
+    out.raw('[').fixed6(vec.x).raw(',').fixed6(vec.y).raw(',').fixed6(vec.z).raw(']');
 }
 
 template <typename T, std::size_t N>
-void appendScalarArray(std::ostringstream& payload, const std::array<T, N>& values)
+void appendScalarArray(JsonWriter& out, const std::array<T, N>& values)
 {
-    payload << '[';
+    out.raw('[');
     for (std::size_t i = 0; i < values.size(); ++i) {
         if (i > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        payload << formatNumber(static_cast<double>(values[i]));
+        out.fixed6(static_cast<double>(values[i]));
     }
-    payload << ']';
+    out.raw(']');
 }
 
 template <std::size_t N>
-void appendBoolArray(std::ostringstream& payload, const std::array<bool, N>& values)
+void appendBoolArray(JsonWriter& out, const std::array<bool, N>& values)
 {
-    payload << '[';
+    out.raw('[');
     for (std::size_t i = 0; i < values.size(); ++i) {
         if (i > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        payload << (values[i] ? "true" : "false");
+        out.boolean(values[i]);
     }
-    payload << ']';
+    out.raw(']');
 }
 
 template <std::size_t N>
-void appendVec3Array(std::ostringstream& payload, const std::array<Vec3, N>& values)
+void appendVec3Array(JsonWriter& out, const std::array<Vec3, N>& values)
 {
-    payload << '[';
+    out.raw('[');
     for (std::size_t i = 0; i < values.size(); ++i) {
         if (i > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        appendVec3(payload, values[i]);
+        appendVec3(out, values[i]);
     }
-    payload << ']';
+    out.raw(']');
 }
 
-void appendNavPose(std::ostringstream& payload, const NavPose2d& pose)
+void appendNavPose(JsonWriter& out, const NavPose2d& pose)
 {
-    payload << "{\"x_m\":" << formatNumber(pose.x_m)
-            << ",\"y_m\":" << formatNumber(pose.y_m)
-            << ",\"yaw_rad\":" << formatNumber(pose.yaw_rad)
-            << '}';
+    out.raw("{\"x_m\":").fixed6(pose.x_m)
+        .raw(",\"y_m\":").fixed6(pose.y_m)
+        .raw(",\"yaw_rad\":").fixed6(pose.yaw_rad)
+        .raw('}');
 }
 
-void appendBodyTwist(std::ostringstream& payload, const BodyTwistState& twist)
+void appendBodyTwist(JsonWriter& out, const BodyTwistState& twist)
 {
-    payload << "{\"twist_pos_rad\":";
-    appendEuler(payload, twist.twist_pos_rad);
-    payload << ",\"twist_vel_radps\":";
-    appendVec3(payload, Vec3{twist.twist_vel_radps.x, twist.twist_vel_radps.y, twist.twist_vel_radps.z});
-    payload << ",\"body_trans_m\":";
-    appendVec3(payload, twist.body_trans_m.raw());
-    payload << ",\"body_trans_mps\":";
-    appendVec3(payload, twist.body_trans_mps.raw());
-    payload << '}';
+    out.raw("{\"twist_pos_rad\":");
+    appendEuler(out, twist.twist_pos_rad);
+    out.raw(",\"twist_vel_radps\":");
+    appendVec3(out, Vec3{twist.twist_vel_radps.x, twist.twist_vel_radps.y, twist.twist_vel_radps.z});
+    out.raw(",\"body_trans_m\":");
+    appendVec3(out, twist.body_trans_m.raw());
+    out.raw(",\"body_trans_mps\":");
+    appendVec3(out, twist.body_trans_mps.raw());
+    out.raw('}');
 }
 
-void appendGridOrigin(std::ostringstream& payload, const LocalOccupancyGrid& grid)
+void appendGridOrigin(JsonWriter& out, const LocalOccupancyGrid& grid)
 {
     if (grid.empty()) {
-        payload << "null";
+        out.raw("null");
         return;
     }
 
@@ -113,386 +92,346 @@ void appendGridOrigin(std::ostringstream& payload, const LocalOccupancyGrid& gri
     const double half_h = static_cast<double>(grid.height_cells - 1) * 0.5;
     const double origin_x = grid.center_pose.x_m - half_w * grid.resolution_m;
     const double origin_y = grid.center_pose.y_m - half_h * grid.resolution_m;
-    payload << '[' << formatNumber(origin_x) << ',' << formatNumber(origin_y) << ']';
+    out.raw('[').fixed6(origin_x).raw(',').fixed6(origin_y).raw(']');
 }
 
-void appendOccupancyGrid(std::ostringstream& payload, const LocalOccupancyGrid& grid)
+void appendOccupancyGrid(JsonWriter& out, const LocalOccupancyGrid& grid)
 {
-    payload << "{\"width_cells\":" << grid.width_cells
-            << ",\"height_cells\":" << grid.height_cells
-            << ",\"resolution_m\":" << formatNumber(grid.resolution_m)
-            << ",\"center_pose\":";
-    appendNavPose(payload, grid.center_pose);
-    payload << ",\"grid_origin_xy\":";
-    appendGridOrigin(payload, grid);
-    payload << ",\"cells\":[";
+    out.raw("{\"width_cells\":").integer(grid.width_cells)
+        .raw(",\"height_cells\":").integer(grid.height_cells)
+        .raw(",\"resolution_m\":").fixed6(grid.resolution_m)
+        .raw(",\"center_pose\":");
+    appendNavPose(out, grid.center_pose);
+    out.raw(",\"grid_origin_xy\":");
+    appendGridOrigin(out, grid);
+    out.raw(",\"cells\":[");
     for (std::size_t i = 0; i < grid.cells.size(); ++i) {
         if (i > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        payload << static_cast<int>(grid.cells[i]);
+        out.integer(static_cast<int>(grid.cells[i]));
     }
-    payload << "]}";
+    out.raw("]}");
 }
 
-void appendElevationGrid(std::ostringstream& payload, const LocalElevationGrid& grid)
+void appendElevationGrid(JsonWriter& out, const LocalElevationGrid& grid)
 {
-    payload << "{\"width_cells\":" << grid.width_cells
-            << ",\"height_cells\":" << grid.height_cells
-            << ",\"resolution_m\":" << formatNumber(grid.resolution_m)
-            << ",\"center_pose\":";
-    appendNavPose(payload, grid.center_pose);
-    payload << ",\"values\":[";
+    out.raw("{\"width_cells\":").integer(grid.width_cells)
+        .raw(",\"height_cells\":").integer(grid.height_cells)
+        .raw(",\"resolution_m\":").fixed6(grid.resolution_m)
+        .raw(",\"center_pose\":");
+    appendNavPose(out, grid.center_pose);
+    out.raw(",\"values\":[");
     for (std::size_t i = 0; i < grid.max_hit_z_m.size(); ++i) {
         if (i > 0) {
-            payload << ',';
+            out.raw(',');
         }
         const double z = grid.max_hit_z_m[i];
         if (std::isfinite(z)) {
-            payload << formatNumber(z);
+            out.fixed6(z);
         } else {
-            payload << "null";
+            out.raw("null");
         }
     }
-    payload << "]}";
+    out.raw("]}");
 }
 
-void appendMatrixLidar(std::ostringstream& payload, const RobotState& state)
+void appendMatrixLidar(JsonWriter& out, const RobotState& state)
 {
-    payload << "{\"has_matrix_lidar\":" << (state.has_matrix_lidar ? "true" : "false")
-            << ",\"valid\":" << (state.matrix_lidar.valid ? "true" : "false")
-            << ",\"timestamp_us\":" << state.matrix_lidar.timestamp_us.value
-            << ",\"model\":" << static_cast<int>(state.matrix_lidar.model)
-            << ",\"cols\":" << static_cast<int>(state.matrix_lidar.cols)
-            << ",\"rows\":" << static_cast<int>(state.matrix_lidar.rows)
-            << ",\"ranges_mm\":[";
+    out.raw("{\"has_matrix_lidar\":").boolean(state.has_matrix_lidar)
+        .raw(",\"valid\":").boolean(state.matrix_lidar.valid)
+        .raw(",\"timestamp_us\":").integer(state.matrix_lidar.timestamp_us.value)
+        .raw(",\"model\":").integer(static_cast<int>(state.matrix_lidar.model))
+        .raw(",\"cols\":").integer(static_cast<int>(state.matrix_lidar.cols))
+        .raw(",\"rows\":").integer(static_cast<int>(state.matrix_lidar.rows))
+        .raw(",\"ranges_mm\":[");
     const std::size_t cell_count =
         std::min<std::size_t>(static_cast<std::size_t>(state.matrix_lidar.cols) *
                                   static_cast<std::size_t>(state.matrix_lidar.rows),
                               state.matrix_lidar.ranges_mm.size());
     for (std::size_t i = 0; i < cell_count; ++i) {
         if (i > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        payload << state.matrix_lidar.ranges_mm[i];
+        out.integer(state.matrix_lidar.ranges_mm[i]);
     }
-    payload << "]}";
+    out.raw("]}");
 }
 
-void appendEstimatedState(std::ostringstream& payload, const RobotState& state)
+void appendEstimatedState(JsonWriter& out, const RobotState& state)
 {
-    payload << "\"estimated_state\":{"
-            << "\"sample_id\":" << state.sample_id << ','
-            << "\"timestamp_us\":" << state.timestamp_us.value << ','
-            << "\"valid\":" << (state.valid ? "true" : "false") << ','
-            << "\"bus_ok\":" << (state.bus_ok ? "true" : "false") << ','
-            << "\"has_body_twist_state\":" << (state.has_body_twist_state ? "true" : "false")
-            << ",\"foot_contacts\":[";
-    for (std::size_t leg = 0; leg < state.foot_contacts.size(); ++leg) {
-        if (leg > 0) {
-            payload << ',';
-        }
-        payload << (state.foot_contacts[leg] ? "true" : "false");
-    }
-    payload << "],\"foot_contact_phase\":[";
+    out.raw("\"estimated_state\":{")
+        .raw("\"sample_id\":").integer(state.sample_id).raw(',')
+        .raw("\"timestamp_us\":").integer(state.timestamp_us.value).raw(',')
+        .raw("\"valid\":").boolean(state.valid).raw(',')
+        .raw("\"bus_ok\":").boolean(state.bus_ok).raw(',')
+        .raw("\"has_body_twist_state\":").boolean(state.has_body_twist_state)
+        .raw(",\"foot_contacts\":");
+    appendBoolArray(out, state.foot_contacts);
+    out.raw(",\"foot_contact_phase\":[");
     for (std::size_t leg = 0; leg < state.foot_contact_fusion.size(); ++leg) {
         if (leg > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        payload << static_cast<int>(state.foot_contact_fusion[leg].phase);
+        out.integer(static_cast<int>(state.foot_contact_fusion[leg].phase));
     }
-    payload << "],\"foot_contact_confidence\":[";
+    out.raw("],\"foot_contact_confidence\":[");
     for (std::size_t leg = 0; leg < state.foot_contact_fusion.size(); ++leg) {
         if (leg > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        payload << formatNumber(state.foot_contact_fusion[leg].confidence);
+        out.fixed6(state.foot_contact_fusion[leg].confidence);
     }
-    payload << ']';
+    out.raw(']');
     if (state.has_body_twist_state) {
-        payload << ",\"body_twist_state\":";
-        appendBodyTwist(payload, state.body_twist_state);
+        out.raw(",\"body_twist_state\":");
+        appendBodyTwist(out, state.body_twist_state);
     }
     if (state.has_imu) {
-        payload << ",\"imu\":{"
-                << "\"timestamp_us\":" << state.imu.timestamp_us.value << ','
-                << "\"valid\":" << (state.imu.valid ? "true" : "false") << ",\"gyro_radps\":";
-        appendVec3(payload, Vec3{state.imu.gyro_radps.x, state.imu.gyro_radps.y, state.imu.gyro_radps.z});
-        payload << ",\"accel_mps2\":";
-        appendVec3(payload, state.imu.accel_mps2);
-        payload << '}';
+        out.raw(",\"imu\":{")
+            .raw("\"timestamp_us\":").integer(state.imu.timestamp_us.value).raw(',')
+            .raw("\"valid\":").boolean(state.imu.valid).raw(",\"gyro_radps\":");
+        appendVec3(out, Vec3{state.imu.gyro_radps.x, state.imu.gyro_radps.y, state.imu.gyro_radps.z});
+        out.raw(",\"accel_mps2\":");
+        appendVec3(out, state.imu.accel_mps2);
+        out.raw('}');
     }
     if (state.has_matrix_lidar) {
-        payload << ",\"matrix_lidar\":";
-        appendMatrixLidar(payload, state);
+        out.raw(",\"matrix_lidar\":");
+        appendMatrixLidar(out, state);
     }
-    payload << '}';
+    out.raw('}');
 }
 
-void appendFootTargets(std::ostringstream& payload, const LegTargets& targets)
+void appendFootTargets(JsonWriter& out, const LegTargets& targets)
 {
-    payload << "\"leg_targets\":{\"timestamp_us\":" << targets.timestamp_us.value << ",\"feet\":[";
+    out.raw("\"leg_targets\":{\"timestamp_us\":").integer(targets.timestamp_us.value).raw(",\"feet\":[");
     for (std::size_t leg = 0; leg < targets.feet.size(); ++leg) {
         if (leg > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        payload << "{\"pos_body_m\":";
-        appendVec3(payload, targets.feet[leg].pos_body_m.raw());
-        payload << ",\"vel_body_mps\":";
-        appendVec3(payload, targets.feet[leg].vel_body_mps.raw());
-        payload << '}';
+        out.raw("{\"pos_body_m\":");
+        appendVec3(out, targets.feet[leg].pos_body_m.raw());
+        out.raw(",\"vel_body_mps\":");
+        appendVec3(out, targets.feet[leg].vel_body_mps.raw());
+        out.raw('}');
     }
-    payload << "]}";
+    out.raw("]}");
 }
 
-void appendGaitState(std::ostringstream& payload, const GaitState& gait)
+void appendGaitState(JsonWriter& out, const GaitState& gait)
 {
-    payload << "\"gait_state\":{\"timestamp_us\":" << gait.timestamp_us.value
-            << ",\"stride_phase_rate_hz\":" << formatNumber(gait.stride_phase_rate_hz.value)
-            << ",\"duty_factor\":" << formatNumber(gait.duty_factor)
-            << ",\"step_length_m\":" << formatNumber(gait.step_length_m)
-            << ",\"swing_height_m\":" << formatNumber(gait.swing_height_m)
-            << ",\"swing_time_ease_01\":" << formatNumber(gait.swing_time_ease_01)
-            << ",\"static_stability_margin_m\":" << formatNumber(gait.static_stability_margin_m)
-            << ",\"phase\":[";
-    for (std::size_t leg = 0; leg < gait.phase.size(); ++leg) {
-        if (leg > 0) {
-            payload << ',';
-        }
-        payload << formatNumber(gait.phase[leg]);
-    }
-    payload << "],\"in_stance\":[";
-    for (std::size_t leg = 0; leg < gait.in_stance.size(); ++leg) {
-        if (leg > 0) {
-            payload << ',';
-        }
-        payload << (gait.in_stance[leg] ? "true" : "false");
-    }
-    payload << "],\"hold_stance\":[";
-    for (std::size_t leg = 0; leg < gait.stability_hold_stance.size(); ++leg) {
-        if (leg > 0) {
-            payload << ',';
-        }
-        payload << (gait.stability_hold_stance[leg] ? "true" : "false");
-    }
-    payload << "],\"safe_to_lift\":[";
-    for (std::size_t leg = 0; leg < gait.support_liftoff_safe_to_lift.size(); ++leg) {
-        if (leg > 0) {
-            payload << ',';
-        }
-        payload << (gait.support_liftoff_safe_to_lift[leg] ? "true" : "false");
-    }
-    payload << "],\"support_liftoff_clearance_m\":[";
-    for (std::size_t leg = 0; leg < gait.support_liftoff_clearance_m.size(); ++leg) {
-        if (leg > 0) {
-            payload << ',';
-        }
-        payload << formatNumber(gait.support_liftoff_clearance_m[leg]);
-    }
-    payload << "]}";
+    out.raw("\"gait_state\":{\"timestamp_us\":").integer(gait.timestamp_us.value)
+        .raw(",\"stride_phase_rate_hz\":").fixed6(gait.stride_phase_rate_hz.value)
+        .raw(",\"duty_factor\":").fixed6(gait.duty_factor)
+        .raw(",\"step_length_m\":").fixed6(gait.step_length_m)
+        .raw(",\"swing_height_m\":").fixed6(gait.swing_height_m)
+        .raw(",\"swing_time_ease_01\":").fixed6(gait.swing_time_ease_01)
+        .raw(",\"static_stability_margin_m\":").fixed6(gait.static_stability_margin_m)
+        .raw(",\"phase\":");
+    appendScalarArray(out, gait.phase);
+    out.raw(",\"in_stance\":");
+    appendBoolArray(out, gait.in_stance);
+    out.raw(",\"hold_stance\":");
+    appendBoolArray(out, gait.stability_hold_stance);
+    out.raw(",\"safe_to_lift\":");
+    appendBoolArray(out, gait.support_liftoff_safe_to_lift);
+    out.raw(",\"support_liftoff_clearance_m\":");
+    appendScalarArray(out, gait.support_liftoff_clearance_m);
+    out.raw('}');
 }
 
-void appendGovernorReplay(std::ostringstream& payload, const CommandGovernorState& g)
+void appendGovernorReplay(JsonWriter& out, const CommandGovernorState& g)
 {
-    payload << "\"governor\":{"
-            << "\"severity\":" << formatNumber(g.severity) << ','
-            << "\"body_height_delta_m\":" << formatNumber(g.body_height_delta_m) << ','
-            << "\"command_scale\":" << formatNumber(g.command_scale) << ','
-            << "\"cadence_scale\":" << formatNumber(g.cadence_scale) << ','
-            << "\"support_margin_m\":" << formatNumber(g.support_margin_m) << ','
-            << "\"current_support_margin_m\":" << formatNumber(g.current_support_margin_m) << ','
-            << "\"current_support_count\":" << g.current_support_count << ','
-            << "\"confirmed_support_count\":" << g.confirmed_support_count << ','
-            << "\"uncertain_support_count\":" << g.uncertain_support_count << ','
-            << "\"recovery_stage\":\"" << recoveryStageName(g.recovery_stage) << "\","
-            << "\"recovery_release_ready\":" << (g.recovery_release_ready ? "true" : "false") << ','
-            << "\"recovery_hold_active\":" << (g.recovery_hold_active ? "true" : "false") << ','
-            << "\"freeze_phase\":" << (g.freeze_phase ? "true" : "false") << ','
-            << "\"reasons\":\"0x" << std::hex << std::uppercase
-            << static_cast<std::uint32_t>(g.reasons) << std::dec << "\"}";
+    out.raw("\"governor\":{")
+        .raw("\"severity\":").fixed6(g.severity).raw(',')
+        .raw("\"body_height_delta_m\":").fixed6(g.body_height_delta_m).raw(',')
+        .raw("\"command_scale\":").fixed6(g.command_scale).raw(',')
+        .raw("\"cadence_scale\":").fixed6(g.cadence_scale).raw(',')
+        .raw("\"support_margin_m\":").fixed6(g.support_margin_m).raw(',')
+        .raw("\"current_support_margin_m\":").fixed6(g.current_support_margin_m).raw(',')
+        .raw("\"current_support_count\":").integer(g.current_support_count).raw(',')
+        .raw("\"confirmed_support_count\":").integer(g.confirmed_support_count).raw(',')
+        .raw("\"uncertain_support_count\":").integer(g.uncertain_support_count).raw(',')
+        .raw("\"recovery_stage\":").quoted(recoveryStageName(g.recovery_stage)).raw(',')
+        .raw("\"recovery_release_ready\":").boolean(g.recovery_release_ready).raw(',')
+        .raw("\"recovery_hold_active\":").boolean(g.recovery_hold_active).raw(',')
+        .raw("\"freeze_phase\":").boolean(g.freeze_phase).raw(',')
+        .raw("\"reasons\":\"0x").hexUpper(static_cast<std::uint32_t>(g.reasons)).raw("\"}");
 }
 
-void appendLocomotionFeasibility(std::ostringstream& payload, const LocomotionFeasibility& f)
+void appendLocomotionFeasibility(JsonWriter& out, const LocomotionFeasibility& f)
 {
-    payload << "\"locomotion_feasibility\":{"
-            << "\"valid\":" << (f.valid ? "true" : "false") << ','
-            << "\"enabled\":" << (f.enabled ? "true" : "false") << ','
-            << "\"control_margin_source\":\"" << controlMarginSourceName(f.control_margin_source) << "\","
-            << "\"nominal_margin_m\":" << formatNumber(f.nominal_margin_m) << ','
-            << "\"actual_margin_m\":" << formatNumber(f.actual_margin_m) << ','
-            << "\"control_margin_m\":" << formatNumber(f.control_margin_m) << ','
-            << "\"support_count\":" << f.support.support_count << ','
-            << "\"confirmed_support_count\":" << f.support.confirmed_support_count << ','
-            << "\"uncertain_support_count\":" << f.support.uncertain_support_count << ','
-            << "\"body_tilt_rad\":" << formatNumber(f.body_tilt_rad) << ','
-            << "\"body_rate_radps\":" << formatNumber(f.body_rate_radps) << ','
-            << "\"high_demand\":" << (f.high_demand ? "true" : "false") << ','
-            << "\"dynamic_risk\":" << (f.dynamic_risk ? "true" : "false") << ','
-            << "\"sparse_support\":" << (f.sparse_support ? "true" : "false") << ','
-            << "\"deadlocked\":" << (f.deadlocked ? "true" : "false") << ','
-            << "\"recovery_recommended\":" << (f.recovery_recommended ? "true" : "false")
-            << ",\"safe_to_lift\":";
-    appendBoolArray(payload, f.safe_to_lift);
-    payload << ",\"lift_clearance_m\":";
-    appendScalarArray(payload, f.lift_clearance_m);
-    payload << ",\"contact_mode\":[";
+    out.raw("\"locomotion_feasibility\":{")
+        .raw("\"valid\":").boolean(f.valid).raw(',')
+        .raw("\"enabled\":").boolean(f.enabled).raw(',')
+        .raw("\"control_margin_source\":").quoted(controlMarginSourceName(f.control_margin_source)).raw(',')
+        .raw("\"nominal_margin_m\":").fixed6(f.nominal_margin_m).raw(',')
+        .raw("\"actual_margin_m\":").fixed6(f.actual_margin_m).raw(',')
+        .raw("\"control_margin_m\":").fixed6(f.control_margin_m).raw(',')
+        .raw("\"support_count\":").integer(f.support.support_count).raw(',')
+        .raw("\"confirmed_support_count\":").integer(f.support.confirmed_support_count).raw(',')
+        .raw("\"uncertain_support_count\":").integer(f.support.uncertain_support_count).raw(',')
+        .raw("\"body_tilt_rad\":").fixed6(f.body_tilt_rad).raw(',')
+        .raw("\"body_rate_radps\":").fixed6(f.body_rate_radps).raw(',')
+        .raw("\"high_demand\":").boolean(f.high_demand).raw(',')
+        .raw("\"dynamic_risk\":").boolean(f.dynamic_risk).raw(',')
+        .raw("\"sparse_support\":").boolean(f.sparse_support).raw(',')
+        .raw("\"deadlocked\":").boolean(f.deadlocked).raw(',')
+        .raw("\"recovery_recommended\":").boolean(f.recovery_recommended)
+        .raw(",\"safe_to_lift\":");
+    appendBoolArray(out, f.safe_to_lift);
+    out.raw(",\"lift_clearance_m\":");
+    appendScalarArray(out, f.lift_clearance_m);
+    out.raw(",\"contact_mode\":[");
     for (std::size_t leg = 0; leg < f.contact.size(); ++leg) {
         if (leg > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        payload << '\"' << legContactModeName(f.contact[leg].mode) << '\"';
+        out.quoted(legContactModeName(f.contact[leg].mode));
     }
-    payload << "],\"height_policy\":{"
-            << "\"valid\":" << (f.height.valid ? "true" : "false") << ','
-            << "\"enabled\":" << (f.height.enabled ? "true" : "false") << ','
-            << "\"commanded_body_height_m\":" << formatNumber(f.height.commanded_body_height_m) << ','
-            << "\"measured_body_height_m\":" << formatNumber(f.height.measured_body_height_m) << ','
-            << "\"governor_delta_m\":" << formatNumber(f.height.governor_delta_m) << ','
-            << "\"compliance_sag_m\":" << formatNumber(f.height.compliance_sag_m) << ','
-            << "\"tilt_squat_request_m\":" << formatNumber(f.height.tilt_squat_request_m) << ','
-            << "\"swing_clearance_request_m\":" << formatNumber(f.height.swing_clearance_request_m) << ','
-            << "\"policy_body_height_m\":" << formatNumber(f.height.policy_body_height_m)
-            << "}}";
+    out.raw("],\"height_policy\":{")
+        .raw("\"valid\":").boolean(f.height.valid).raw(',')
+        .raw("\"enabled\":").boolean(f.height.enabled).raw(',')
+        .raw("\"commanded_body_height_m\":").fixed6(f.height.commanded_body_height_m).raw(',')
+        .raw("\"measured_body_height_m\":").fixed6(f.height.measured_body_height_m).raw(',')
+        .raw("\"governor_delta_m\":").fixed6(f.height.governor_delta_m).raw(',')
+        .raw("\"compliance_sag_m\":").fixed6(f.height.compliance_sag_m).raw(',')
+        .raw("\"tilt_squat_request_m\":").fixed6(f.height.tilt_squat_request_m).raw(',')
+        .raw("\"swing_clearance_request_m\":").fixed6(f.height.swing_clearance_request_m).raw(',')
+        .raw("\"policy_body_height_m\":").fixed6(f.height.policy_body_height_m)
+        .raw("}}");
 }
 
-void appendJointTargets(std::ostringstream& payload, const JointTargets& joints)
+void appendJointTargets(JsonWriter& out, const JointTargets& joints)
 {
-    payload << "\"joint_targets\":[";
+    out.raw("\"joint_targets\":[");
     for (std::size_t leg = 0; leg < joints.leg_states.size(); ++leg) {
         if (leg > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        payload << '[';
+        out.raw('[');
         for (std::size_t joint = 0; joint < joints.leg_states[leg].joint_state.size(); ++joint) {
             if (joint > 0) {
-                payload << ',';
+                out.raw(',');
             }
-            payload << formatNumber(joints.leg_states[leg].joint_state[joint].pos_rad.value);
+            out.fixed6(joints.leg_states[leg].joint_state[joint].pos_rad.value);
         }
-        payload << ']';
+        out.raw(']');
     }
-    payload << ']';
+    out.raw(']');
 }
 
-void appendTransitionDiagnostics(std::ostringstream& payload,
-                                 const ReplayTransitionDiagnostics& diagnostics)
+void appendTransitionDiagnostics(JsonWriter& out, const ReplayTransitionDiagnostics& diagnostics)
 {
-    payload << "\"transition_diagnostics\":{\"body_height_m\":"
-            << formatNumber(diagnostics.body_height_m)
-            << ",\"stance_leg_count\":" << diagnostics.stance_leg_count
-            << ",\"contact_leg_count\":" << diagnostics.contact_leg_count
-            << ",\"stance_contact_mismatch_count\":" << diagnostics.stance_contact_mismatch_count
-            << ",\"joint_tracking_rms_error_rad\":[";
-    for (std::size_t leg = 0; leg < diagnostics.joint_tracking_rms_error_rad.size(); ++leg) {
-        if (leg > 0) {
-            payload << ',';
-        }
-        payload << formatNumber(diagnostics.joint_tracking_rms_error_rad[leg]);
-    }
-    payload << "],\"joint_tracking_max_abs_error_rad\":[";
-    for (std::size_t leg = 0; leg < diagnostics.joint_tracking_max_abs_error_rad.size(); ++leg) {
-        if (leg > 0) {
-            payload << ',';
-        }
-        payload << formatNumber(diagnostics.joint_tracking_max_abs_error_rad[leg]);
-    }
-    payload << "]}";
+    out.raw("\"transition_diagnostics\":{\"body_height_m\":").fixed6(diagnostics.body_height_m)
+        .raw(",\"stance_leg_count\":").integer(diagnostics.stance_leg_count)
+        .raw(",\"contact_leg_count\":").integer(diagnostics.contact_leg_count)
+        .raw(",\"stance_contact_mismatch_count\":").integer(diagnostics.stance_contact_mismatch_count)
+        .raw(",\"joint_tracking_rms_error_rad\":");
+    appendScalarArray(out, diagnostics.joint_tracking_rms_error_rad);
+    out.raw(",\"joint_tracking_max_abs_error_rad\":");
+    appendScalarArray(out, diagnostics.joint_tracking_max_abs_error_rad);
+    out.raw('}');
 }
 
-void appendLocomotionDebug(std::ostringstream& payload,
-                           const telemetry::LocomotionDebugSnapshot& debug)
+void appendLocomotionDebug(JsonWriter& out, const telemetry::LocomotionDebugSnapshot& debug)
 {
-    payload << "\"locomotion_debug\":{"
-            << "\"valid\":" << (debug.valid ? "true" : "false")
-            << ",\"planned_stance\":";
-    appendBoolArray(payload, debug.planned_stance);
-    payload << ",\"hold_stance\":";
-    appendBoolArray(payload, debug.hold_stance);
-    payload << ",\"raw_contact\":";
-    appendBoolArray(payload, debug.raw_contact);
-    payload << ",\"fused_load_bearing\":";
-    appendBoolArray(payload, debug.fused_load_bearing);
-    payload << ",\"fusion_phase_active\":";
-    appendBoolArray(payload, debug.fusion_phase_active);
-    payload << ",\"fused_support\":";
-    appendBoolArray(payload, debug.fused_support);
-    payload << ",\"fused_contact_phase\":";
-    appendScalarArray(payload, debug.fused_contact_phase);
-    payload << ",\"fused_contact_confidence\":";
-    appendScalarArray(payload, debug.fused_contact_confidence);
-    payload << ",\"measured_foot_body_m\":";
-    appendVec3Array(payload, debug.measured_foot_body_m);
-    payload << ",\"measured_foot_world_m\":";
-    appendVec3Array(payload, debug.measured_foot_world_m);
-    payload << ",\"commanded_foot_body_m\":";
-    appendVec3Array(payload, debug.commanded_foot_body_m);
-    payload << ",\"commanded_foot_world_m\":";
-    appendVec3Array(payload, debug.commanded_foot_world_m);
-    payload << ",\"contact_anchor_world_m\":";
-    appendVec3Array(payload, debug.contact_anchor_world_m);
-    payload << ",\"contact_anchor_drift_m\":";
-    appendScalarArray(payload, debug.contact_anchor_drift_m);
-    payload << ",\"contact_anchor_max_drift_m\":";
-    appendScalarArray(payload, debug.contact_anchor_max_drift_m);
-    payload << ",\"commanded_tracking_error_m\":";
-    appendScalarArray(payload, debug.commanded_tracking_error_m);
-    payload << ",\"contact_anchor_valid\":";
-    appendBoolArray(payload, debug.contact_anchor_valid);
-    payload << ",\"min_measured_foot_world_z_m\":" << formatNumber(debug.min_measured_foot_world_z_m)
-            << ",\"min_commanded_foot_world_z_m\":" << formatNumber(debug.min_commanded_foot_world_z_m)
-            << ",\"max_commanded_tracking_error_m\":"
-            << formatNumber(debug.max_commanded_tracking_error_m)
-            << '}';
+    out.raw("\"locomotion_debug\":{\"valid\":").boolean(debug.valid).raw(",\"planned_stance\":");
+    appendBoolArray(out, debug.planned_stance);
+    out.raw(",\"hold_stance\":");
+    appendBoolArray(out, debug.hold_stance);
+    out.raw(",\"raw_contact\":");
+    appendBoolArray(out, debug.raw_contact);
+    out.raw(",\"fused_load_bearing\":");
+    appendBoolArray(out, debug.fused_load_bearing);
+    out.raw(",\"fusion_phase_active\":");
+    appendBoolArray(out, debug.fusion_phase_active);
+    out.raw(",\"fused_support\":");
+    appendBoolArray(out, debug.fused_support);
+    out.raw(",\"fused_contact_phase\":");
+    appendScalarArray(out, debug.fused_contact_phase);
+    out.raw(",\"fused_contact_confidence\":");
+    appendScalarArray(out, debug.fused_contact_confidence);
+    out.raw(",\"measured_foot_body_m\":");
+    appendVec3Array(out, debug.measured_foot_body_m);
+    out.raw(",\"measured_foot_world_m\":");
+    appendVec3Array(out, debug.measured_foot_world_m);
+    out.raw(",\"commanded_foot_body_m\":");
+    appendVec3Array(out, debug.commanded_foot_body_m);
+    out.raw(",\"commanded_foot_world_m\":");
+    appendVec3Array(out, debug.commanded_foot_world_m);
+    out.raw(",\"contact_anchor_world_m\":");
+    appendVec3Array(out, debug.contact_anchor_world_m);
+    out.raw(",\"contact_anchor_drift_m\":");
+    appendScalarArray(out, debug.contact_anchor_drift_m);
+    out.raw(",\"contact_anchor_max_drift_m\":");
+    appendScalarArray(out, debug.contact_anchor_max_drift_m);
+    out.raw(",\"commanded_tracking_error_m\":");
+    appendScalarArray(out, debug.commanded_tracking_error_m);
+    out.raw(",\"contact_anchor_valid\":");
+    appendBoolArray(out, debug.contact_anchor_valid);
+    out.raw(",\"min_measured_foot_world_z_m\":").fixed6(debug.min_measured_foot_world_z_m)
+        .raw(",\"min_commanded_foot_world_z_m\":").fixed6(debug.min_commanded_foot_world_z_m)
+        .raw(",\"max_commanded_tracking_error_m\":").fixed6(debug.max_commanded_tracking_error_m)
+        .raw('}');
 }
 
 } // namespace
 
+void writeReplayTelemetryRecord(JsonWriter& out, const ReplayTelemetryRecord& record)
+{
+    out.raw("{\"type\":\"replay\",\"schema_version\":").integer(kSchemaVersion).raw(',')
+        .raw("\"timestamp_us\":").integer(record.timestamp_us.value).raw(',')
+        .raw("\"sample_id\":").integer(record.sample_id).raw(',')
+        .raw("\"status\":{")
+        .raw("\"active_mode\":").integer(static_cast<int>(record.status.active_mode)).raw(',')
+        .raw("\"estimator_valid\":").boolean(record.status.estimator_valid).raw(',')
+        .raw("\"bus_ok\":").boolean(record.status.bus_ok).raw(',')
+        .raw("\"active_fault\":").integer(static_cast<int>(record.status.active_fault)).raw(',')
+        .raw("\"loop_counter\":").integer(record.status.loop_counter).raw("},");
+    appendEstimatedState(out, record.estimated_state);
+    out.raw(',');
+    appendFootTargets(out, record.leg_targets);
+    out.raw(',');
+    appendGaitState(out, record.gait_state);
+    out.raw(',');
+    appendJointTargets(out, record.joint_targets);
+    out.raw(',');
+    appendGovernorReplay(out, record.governor);
+    out.raw(',');
+    appendLocomotionFeasibility(out, record.locomotion_feasibility);
+    out.raw(',');
+    appendTransitionDiagnostics(out, record.transition_diagnostics);
+    out.raw(',');
+    appendLocomotionDebug(out, record.locomotion_debug);
+    const LocalMapSnapshot& terrain = record.terrain_snapshot;
+    out.raw(",\"terrain_patch\":{")
+        .raw("\"fresh\":").boolean(terrain.fresh).raw(',')
+        .raw("\"has_observations\":").boolean(terrain.has_observations).raw(',')
+        .raw("\"has_primary_observations\":").boolean(terrain.has_primary_observations).raw(',')
+        .raw("\"last_observation_timestamp_us\":").integer(terrain.last_observation_timestamp.value).raw(',')
+        .raw("\"last_primary_observation_timestamp_us\":")
+        .integer(terrain.last_primary_observation_timestamp.value).raw(',')
+        .raw("\"nearest_obstacle_distance_m\":").fixed6(terrain.nearest_obstacle_distance_m)
+        .raw(",\"elevation_has_data\":").boolean(terrain.elevation_has_data)
+        .raw(",\"ground_elevation_has_data\":").boolean(terrain.ground_elevation_has_data)
+        .raw(",\"raw\":");
+    appendOccupancyGrid(out, terrain.raw);
+    out.raw(",\"inflated\":");
+    appendOccupancyGrid(out, terrain.inflated);
+    out.raw(",\"elevation_max_hit_z\":");
+    appendElevationGrid(out, terrain.elevation_max_hit_z);
+    out.raw(",\"elevation_ground_mean_z\":");
+    appendElevationGrid(out, terrain.elevation_ground_mean_z);
+    out.raw("}}");
+}
+
 std::string serializeReplayTelemetryRecord(const ReplayTelemetryRecord& record)
 {
-    std::ostringstream payload;
-    payload << "{\"type\":\"replay\",\"schema_version\":" << kSchemaVersion << ','
-            << "\"timestamp_us\":" << record.timestamp_us.value << ','
-            << "\"sample_id\":" << record.sample_id << ','
-            << "\"status\":{"
-            << "\"active_mode\":" << static_cast<int>(record.status.active_mode) << ','
-            << "\"estimator_valid\":" << (record.status.estimator_valid ? "true" : "false") << ','
-            << "\"bus_ok\":" << (record.status.bus_ok ? "true" : "false") << ','
-            << "\"active_fault\":" << static_cast<int>(record.status.active_fault) << ','
-            << "\"loop_counter\":" << record.status.loop_counter << "},";
-    appendEstimatedState(payload, record.estimated_state);
-    payload << ',';
-    appendFootTargets(payload, record.leg_targets);
-    payload << ',';
-    appendGaitState(payload, record.gait_state);
-    payload << ',';
-    appendJointTargets(payload, record.joint_targets);
-    payload << ',';
-    appendGovernorReplay(payload, record.governor);
-    payload << ',';
-    appendLocomotionFeasibility(payload, record.locomotion_feasibility);
-    payload << ',';
-    appendTransitionDiagnostics(payload, record.transition_diagnostics);
-    payload << ',';
-    appendLocomotionDebug(payload, record.locomotion_debug);
-    payload << ",\"terrain_patch\":{"
-            << "\"fresh\":" << (record.terrain_snapshot.fresh ? "true" : "false") << ','
-            << "\"has_observations\":" << (record.terrain_snapshot.has_observations ? "true" : "false") << ','
-            << "\"has_primary_observations\":" << (record.terrain_snapshot.has_primary_observations ? "true" : "false") << ','
-            << "\"last_observation_timestamp_us\":" << record.terrain_snapshot.last_observation_timestamp.value << ','
-            << "\"last_primary_observation_timestamp_us\":" << record.terrain_snapshot.last_primary_observation_timestamp.value << ','
-            << "\"nearest_obstacle_distance_m\":" << formatNumber(record.terrain_snapshot.nearest_obstacle_distance_m)
-            << ",\"elevation_has_data\":" << (record.terrain_snapshot.elevation_has_data ? "true" : "false")
-            << ",\"ground_elevation_has_data\":" << (record.terrain_snapshot.ground_elevation_has_data ? "true" : "false")
-            << ",\"raw\":";
-    appendOccupancyGrid(payload, record.terrain_snapshot.raw);
-    payload << ",\"inflated\":";
-    appendOccupancyGrid(payload, record.terrain_snapshot.inflated);
-    payload << ",\"elevation_max_hit_z\":";
-    appendElevationGrid(payload, record.terrain_snapshot.elevation_max_hit_z);
-    payload << ",\"elevation_ground_mean_z\":";
-    appendElevationGrid(payload, record.terrain_snapshot.elevation_ground_mean_z);
-    payload << "}}";
-    return payload.str();
+    JsonWriter out;
+    writeReplayTelemetryRecord(out, record);
+    return out.str();
 }
 
 } // namespace replay_json
@@ -1,5 +1,7 @@
 #include "replay_logger.hpp"
 
+#include "replay_binary.hpp"
+
 #include <fstream>
 #include <mutex>
 
@@ -28,12 +30,43 @@ public:
         if (!file_.is_open()) {
             return;
         }
-        file_ << replay_json::serializeReplayTelemetryRecord(record) << '\n';
+        json_.clear();
+        replay_json::writeReplayTelemetryRecord(json_, record);
+        json_.raw('\n');
+        file_.write(json_.view().data(), static_cast<std::streamsize>(json_.size()));
         file_.flush();
     }
 
 private:
     std::ofstream file_{};
+    JsonWriter json_{};
+    std::mutex mutex_{};
+    std::shared_ptr<logging::AsyncLogger> logger_{};
+};
+
+class BinaryReplayLogger final : public IReplayLogger {
+public:
+    BinaryReplayLogger(const std::string& path, std::shared_ptr<logging::AsyncLogger> logger)
+        : logger_(std::move(logger))
+    {
+        std::string error;
+        if (!writer_.open(path, &error) && logger_) {
+            LOG_WARN(logger_, "replay logging disabled: ", error);
+        }
+    }
+
+    void write(const replay_json::ReplayTelemetryRecord& record) override
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (!writer_.isOpen()) {
+            return;
+        }
+        writer_.write(record);
+        writer_.flush();
+    }
+
+private:
+    replay_binary::ReplayBinaryWriter writer_{};
     std::mutex mutex_{};
     std::shared_ptr<logging::AsyncLogger> logger_{};
 };
@@ -57,4 +90,16 @@ std::unique_ptr<IReplayLogger> makeFileReplayLogger(const std::string& path,
     return std::make_unique<FileReplayLogger>(path, std::move(logger));
 }
 
+std::unique_ptr<IReplayLogger> makeBinaryReplayLogger(const std::string& path,
+                                                      std::shared_ptr<logging::AsyncLogger> logger)
+{
+    if (path.empty()) {
+        if (logger) {
+            LOG_WARN(logger, "replay logging disabled: empty file path");
+        }
+        return makeNoopReplayLogger();
+    }
+    return std::make_unique<BinaryReplayLogger>(path, std::move(logger));
+}
+
 } // namespace replay
@@ -16,6 +16,7 @@ std::unique_ptr<telemetry::ITelemetryPublisher> makeRuntimeTelemetryPublisher(
     telemetry_config.publish_period_ms = static_cast<int>(config.telemetry.publish_period.count());
     telemetry_config.geometry_refresh_period_ms =
         static_cast<int>(config.telemetry.geometry_refresh_period.count());
+    telemetry_config.binary_stream = config.telemetry.binary_stream;
     return telemetry::makeUdpTelemetryPublisher(telemetry_config, logger);
 }
 
@@ -906,10 +906,10 @@ void RobotRuntime::busStep() {
     }
     raw_state_.write(raw);
 
-    const JointTargets cmd = joint_targets_.read();
+    const auto cmd = joint_targets_.view();
     {
         const auto write_scope = resource_profiler_.scope(runtime_resource_monitoring::toIndex(runtime_resource_monitoring::Section::BusWrite));
-        (void)hw_->write(cmd);
+        (void)hw_->write(*cmd);
         (void)write_scope;
     }
 }
@@ -917,13 +917,21 @@ void RobotRuntime::busStep() {
 void RobotRuntime::estimatorStep() {
     const auto scope = resource_profiler_.scope(runtime_resource_monitoring::toIndex(runtime_resource_monitoring::Section::EstimatorUpdate));
     const TimePointUs now = now_us();
-    RobotState raw = raw_state_.read();
-    if (raw.sample_id == 0) {
-        raw.sample_id = raw_sample_seq_.fetch_add(1) + 1;
-    }
-    if (raw.timestamp_us.isZero()) {
-        raw.timestamp_us = now;
+    const auto raw_view = raw_state_.view();
+    // The bus stamps its samples; only copy when a sample still needs an id or timestamp.
+    RobotState stamped_raw{};
+    const RobotState* raw_ptr = &*raw_view;
+    if (raw_view->sample_id == 0 || raw_view->timestamp_us.isZero()) {
+        stamped_raw = *raw_view;
+        if (stamped_raw.sample_id == 0) {
+            stamped_raw.sample_id = raw_sample_seq_.fetch_add(1) + 1;
+        }
+        if (stamped_raw.timestamp_us.isZero()) {
+            stamped_raw.timestamp_us = now;
+        }
+        raw_ptr = &stamped_raw;
     }
+    const RobotState& raw = *raw_ptr;
     const RobotState est = estimator_->update(raw);
     if (logger_ && (last_estimator_snapshot_log_us_.isZero() ||
                     (now.value > last_estimator_snapshot_log_us_.value &&
@@ -989,12 +997,12 @@ void RobotRuntime::controlStep() {
     timing_metrics_.update(now);
     ControlInputSnapshot snapshot{};
     snapshot.now = now;
-    snapshot.previous_joint_targets = joint_targets_.read();
-    snapshot.previous_gait_state = gait_state_.read();
-    snapshot.estimated = estimated_state_.read();
-    snapshot.raw = raw_state_.read();
+    snapshot.previous_joint_targets = joint_targets_.view();
+    snapshot.previous_gait_state = gait_state_.view();
+    snapshot.estimated = estimated_state_.view();
+    snapshot.raw = raw_state_.view();
     if (navigation_manager_ != nullptr) {
-        navigation_manager_->refreshTerrainSnapshot(snapshot.estimated, now);
+        navigation_manager_->refreshTerrainSnapshot(*snapshot.estimated, now);
     }
     if (navigation_manager_ != nullptr) {
         snapshot.terrain_snapshot = navigation_manager_->footTerrainSnapshot(now);
@@ -1002,8 +1010,8 @@ void RobotRuntime::controlStep() {
             snapshot.terrain_timestamp_us = snapshot.terrain_snapshot->last_observation_timestamp;
         }
     }
-    const FusionControlPolicy fusion_policy = applyFusionConsistency(snapshot.estimated, now, snapshot.terrain_snapshot);
-    snapshot.intent = resolveEffectiveIntent(snapshot.estimated, now);
+    const FusionControlPolicy fusion_policy = applyFusionConsistency(*snapshot.estimated, now, snapshot.terrain_snapshot);
+    snapshot.intent = resolveEffectiveIntent(*snapshot.estimated, now);
     if (fusion_policy.force_stand) {
         snapshot.intent.requested_mode = RobotMode::STAND;
         snapshot.intent.speed_mps = LinearRateMps{};
@@ -1017,13 +1025,13 @@ void RobotRuntime::controlStep() {
         snapshot.intent.twist.twist_vel_radps.z = 0.0;
     }
     snapshot.safety_state = safety_state_.read();
-    snapshot.bus_ok = snapshot.raw.bus_ok;
-    const RobotState& est = snapshot.estimated;
-    const RobotState& raw = snapshot.raw;
+    snapshot.bus_ok = snapshot.raw->bus_ok;
+    const RobotState& est = *snapshot.estimated;
+    const RobotState& raw = *snapshot.raw;
     const MotionIntent& intent = snapshot.intent;
     const SafetyState& safety_state = snapshot.safety_state;
-    const JointTargets& previous_joint_targets = snapshot.previous_joint_targets;
-    const GaitState& previous_gait_state = snapshot.previous_gait_state;
+    const JointTargets& previous_joint_targets = *snapshot.previous_joint_targets;
+    const GaitState& previous_gait_state = *snapshot.previous_gait_state;
     const LocalMapSnapshot* terrain_ptr = snapshot.terrain_snapshot;
     bool& bus_ok = snapshot.bus_ok;
     uint64_t& loop_counter = snapshot.loop_counter;
@@ -1320,6 +1328,22 @@ void RobotRuntime::maybePublishTelemetry(const ControlInputSnapshot& snapshot) {
         return;
     }
 
+    if (config_.telemetry.binary_stream) {
+        // The binary frame goes out every control step; only the JSON packets below are rate limited.
+        const auto frame_scope = resource_profiler_.scope(
+            runtime_resource_monitoring::toIndex(runtime_resource_monitoring::Section::TelemetryPublish));
+        telemetry::ControlFrameTelemetry frame{};
+        frame.estimated_state = *snapshot.estimated;
+        frame.joint_targets = joint_targets_.read();
+        frame.status = status_.read();
+        if (navigation_manager_) {
+            frame.navigation = navigation_manager_->monitor();
+        }
+        frame.timestamp_us = snapshot.now;
+        telemetry_publisher_->publishControlFrame(frame);
+        (void)frame_scope;
+    }
+
     if (snapshot.now.value < next_telemetry_publish_at_.value) {
         return;
     }
@@ -1337,7 +1361,7 @@ void RobotRuntime::maybePublishTelemetry(const ControlInputSnapshot& snapshot) {
 
     const auto scope = resource_profiler_.scope(runtime_resource_monitoring::toIndex(runtime_resource_monitoring::Section::TelemetryPublish));
     telemetry::ControlStepTelemetry telemetry_sample{};
-    telemetry_sample.estimated_state = snapshot.estimated;
+    telemetry_sample.estimated_state = *snapshot.estimated;
     telemetry_sample.joint_targets = joint_targets_.read();
     telemetry_sample.locomotion_debug = locomotion_debug_.read();
     telemetry_sample.status = status_.read();
@@ -1355,18 +1379,18 @@ void RobotRuntime::maybePublishTelemetry(const ControlInputSnapshot& snapshot) {
     telemetry_sample.governor_config = pipeline_.commandGovernorConfig();
     telemetry_sample.locomotion_feasibility = locomotion_feasibility_.read();
     telemetry_sample.epoch.control_seq_id = snapshot.loop_counter;
-    telemetry_sample.epoch.raw_seq_id = snapshot.raw.sample_id;
-    telemetry_sample.epoch.est_seq_id = snapshot.estimated.sample_id;
+    telemetry_sample.epoch.raw_seq_id = snapshot.raw->sample_id;
+    telemetry_sample.epoch.est_seq_id = snapshot.estimated->sample_id;
     telemetry_sample.epoch.intent_seq_id = snapshot.intent.sample_id;
-    telemetry_sample.epoch.raw_timestamp_us = snapshot.raw.timestamp_us.value;
-    telemetry_sample.epoch.est_timestamp_us = snapshot.estimated.timestamp_us.value;
+    telemetry_sample.epoch.raw_timestamp_us = snapshot.raw->timestamp_us.value;
+    telemetry_sample.epoch.est_timestamp_us = snapshot.estimated->timestamp_us.value;
     telemetry_sample.epoch.intent_timestamp_us = snapshot.intent.timestamp_us.value;
     telemetry_sample.epoch.terrain_timestamp_us = snapshot.terrain_timestamp_us.value;
-    telemetry_sample.epoch.raw_age_us = ageUsAt(snapshot.now, snapshot.raw.timestamp_us);
+    telemetry_sample.epoch.raw_age_us = ageUsAt(snapshot.now, snapshot.raw->timestamp_us);
     telemetry_sample.epoch.est_age_us = snapshot.freshness.estimator.age_us;
     telemetry_sample.epoch.intent_age_us = snapshot.freshness.intent.age_us;
     telemetry_sample.epoch.terrain_age_us = ageUsAt(snapshot.now, snapshot.terrain_timestamp_us);
-    telemetry_sample.epoch.raw_valid = snapshot.raw.valid || !snapshot.raw.timestamp_us.isZero() || snapshot.raw.sample_id != 0;
+    telemetry_sample.epoch.raw_valid = snapshot.raw->valid || !snapshot.raw->timestamp_us.isZero() || snapshot.raw->sample_id != 0;
     telemetry_sample.epoch.est_valid = snapshot.freshness.estimator.valid;
     telemetry_sample.epoch.intent_valid = snapshot.freshness.intent.valid;
     telemetry_sample.epoch.terrain_valid = snapshot.terrain_snapshot != nullptr && !snapshot.terrain_timestamp_us.isZero();
@@ -1382,9 +1406,9 @@ void RobotRuntime::maybeWriteReplayRecord(const ControlInputSnapshot& snapshot)
     const auto scope = resource_profiler_.scope(runtime_resource_monitoring::toIndex(runtime_resource_monitoring::Section::ReplayWrite));
     replay_json::ReplayTelemetryRecord record{};
     record.timestamp_us = snapshot.now;
-    record.sample_id = snapshot.estimated.sample_id;
+    record.sample_id = snapshot.estimated->sample_id;
     record.status = status_.read();
-    record.estimated_state = snapshot.estimated;
+    record.estimated_state = *snapshot.estimated;
     record.leg_targets = leg_targets_.read();
     record.gait_state = gait_state_.read();
     record.joint_targets = joint_targets_.read();
@@ -1402,8 +1426,10 @@ void RobotRuntime::maybeWriteReplayRecord(const ControlInputSnapshot& snapshot)
 
 void RobotRuntime::safetyStep() {
     const auto scope = resource_profiler_.scope(runtime_resource_monitoring::toIndex(runtime_resource_monitoring::Section::SafetyEvaluate));
-    const RobotState raw = raw_state_.read();
-    const RobotState est = estimated_state_.read();
+    const auto raw_view = raw_state_.view();
+    const auto est_view = estimated_state_.view();
+    const RobotState& raw = *raw_view;
+    const RobotState& est = *est_view;
     const TimePointUs now = now_us();
     const MotionIntent intent = resolveEffectiveIntent(est, now);
     const FreshnessPolicy::Evaluation freshness = freshness_gate_.evaluate(
@@ -1556,8 +1582,10 @@ void RobotRuntime::diagnosticsStep() {
     last_resource_sections_ = resource_profiler_.topSections(runtime_resource_monitoring::kTopSectionsToReport);
     const auto report_scope = resource_profiler_.scope(runtime_resource_monitoring::toIndex(runtime_resource_monitoring::Section::DiagnosticsReport));
     const auto st = status_.read();
-    const RobotState raw = raw_state_.read();
-    const RobotState est = estimated_state_.read();
+    const auto raw_view = raw_state_.view();
+    const auto est_view = estimated_state_.view();
+    const RobotState& raw = *raw_view;
+    const RobotState& est = *est_view;
     const SafetyState safety = safety_state_.read();
     const auto bridge_result = hw_ ? hw_->last_bridge_result() : std::nullopt;
     const uint64_t loops = control_loop_counter_.load();
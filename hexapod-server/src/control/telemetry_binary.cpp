@@ -0,0 +1,111 @@
+#include "telemetry_binary.hpp"
+
+#include "math_types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace telemetry_binary {
+namespace {
+
+constexpr std::array<LegID, kNumLegs> kVisualiserLegOrder = {
+    LegID::L1, LegID::L2, LegID::L3, LegID::R1, LegID::R2, LegID::R3};
+
+static_assert(hexapod_telemetry::kLegCount == static_cast<std::size_t>(kNumLegs));
+static_assert(hexapod_telemetry::kJointsPerLeg == static_cast<std::size_t>(kJointsPerLeg));
+
+void copyAnglesDeg(const std::array<LegState, kNumLegs>& leg_states,
+                   float (&out)[hexapod_telemetry::kLegCount][hexapod_telemetry::kJointsPerLeg]) {
+    for (std::size_t leg = 0; leg < hexapod_telemetry::kLegCount; ++leg) {
+        const LegState& leg_state = leg_states[static_cast<std::size_t>(kVisualiserLegOrder[leg])];
+        for (std::size_t joint = 0; joint < hexapod_telemetry::kJointsPerLeg; ++joint) {
+            out[leg][joint] = static_cast<float>(rad2deg(leg_state.joint_state[joint].pos_rad));
+        }
+    }
+}
+
+hexapod_telemetry::TelemetryVec3f toVec3f(double x, double y, double z) {
+    return {static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)};
+}
+
+uint32_t saturateU32(std::size_t value) {
+    return static_cast<uint32_t>(std::min<std::size_t>(value, std::numeric_limits<uint32_t>::max()));
+}
+
+} // namespace
+
+hexapod_telemetry::TelemetryControlFrameBody makeControlFrameBody(const telemetry::ControlFrameTelemetry& frame,
+                                                                  const uint32_t sequence) {
+    using namespace hexapod_telemetry;
+    const RobotState& est = frame.estimated_state;
+
+    TelemetryControlFrameBody body{};
+    body.timestamp_us = frame.timestamp_us.value;
+    body.sequence = sequence;
+    body.loop_counter = static_cast<uint32_t>(frame.status.loop_counter);
+    body.active_mode = static_cast<uint8_t>(frame.status.active_mode);
+    body.active_fault = static_cast<uint8_t>(frame.status.active_fault);
+    body.flags = static_cast<uint8_t>((frame.status.bus_ok ? kFrameFlagBusOk : 0u) |
+                                      (frame.status.estimator_valid ? kFrameFlagEstimatorValid : 0u) |
+                                      (est.has_body_twist_state ? kFrameFlagHasBodyPose : 0u));
+    body.voltage = est.voltage;
+    body.current = est.current;
+    copyAnglesDeg(frame.joint_targets.leg_states, body.commanded_angles_deg);
+    copyAnglesDeg(est.leg_states, body.measured_angles_deg);
+    if (est.has_body_twist_state) {
+        const BodyTwistState& twist = est.body_twist_state;
+        body.body_position_m = toVec3f(twist.body_trans_m.x, twist.body_trans_m.y, twist.body_trans_m.z);
+        body.body_orientation_rad = toVec3f(twist.twist_pos_rad.x, twist.twist_pos_rad.y, twist.twist_pos_rad.z);
+    }
+    for (std::size_t leg = 0; leg < kLegCount; ++leg) {
+        const std::size_t index = static_cast<std::size_t>(kVisualiserLegOrder[leg]);
+        if (est.foot_contacts[index]) {
+            body.contact_mask = static_cast<uint8_t>(body.contact_mask | (1u << leg));
+        }
+        body.contact_phase[leg] = static_cast<uint8_t>(est.foot_contact_fusion[index].phase);
+        body.contact_confidence[leg] = est.foot_contact_fusion[index].confidence;
+    }
+    return body;
+}
+
+hexapod_telemetry::TelemetryFusionSummaryBody makeFusionSummaryBody(const RobotState& estimated_state,
+                                                                    const TimePointUs timestamp_us) {
+    using namespace hexapod_telemetry;
+    TelemetryFusionSummaryBody body{};
+    body.timestamp_us = timestamp_us.value;
+    if (!estimated_state.has_fusion_diagnostics) {
+        return body;
+    }
+    const FusionDiagnostics& fusion = estimated_state.fusion;
+    body.flags = static_cast<uint8_t>(kFusionFlagHasData |
+                                      (fusion.resync_requested ? kFusionFlagResyncRequested : 0u) |
+                                      (fusion.hard_reset_requested ? kFusionFlagHardResetRequested : 0u) |
+                                      (fusion.predictive_mode ? kFusionFlagPredictiveMode : 0u));
+    body.model_trust = static_cast<float>(fusion.model_trust);
+    body.max_body_position_error_m = static_cast<float>(fusion.residuals.max_body_position_error_m);
+    body.max_body_orientation_error_rad = static_cast<float>(fusion.residuals.max_body_orientation_error_rad);
+    body.contact_mismatch_ratio = static_cast<float>(fusion.residuals.contact_mismatch_ratio);
+    body.terrain_residual_m = static_cast<float>(fusion.residuals.terrain_residual_m);
+    return body;
+}
+
+hexapod_telemetry::TelemetryNavigationSummaryBody makeNavigationSummaryBody(const NavigationMonitorSnapshot& nav,
+                                                                            const TimePointUs timestamp_us) {
+    using namespace hexapod_telemetry;
+    TelemetryNavigationSummaryBody body{};
+    body.timestamp_us = timestamp_us.value;
+    body.lifecycle = static_cast<uint8_t>(nav.lifecycle);
+    body.planner_status = static_cast<uint8_t>(nav.planner_status);
+    body.block_reason = static_cast<uint8_t>(nav.block_reason);
+    body.flags = static_cast<uint8_t>((nav.map_fresh ? kNavFlagMapFresh : 0u) |
+                                      (nav.active ? kNavFlagActive : 0u) |
+                                      (nav.paused ? kNavFlagPaused : 0u));
+    body.replan_count = saturateU32(nav.replan_count);
+    body.active_segment_waypoint_count = saturateU32(nav.active_segment_waypoint_count);
+    body.active_segment_length_m = static_cast<float>(nav.active_segment_length_m);
+    body.nearest_obstacle_distance_m = static_cast<float>(nav.nearest_obstacle_distance_m);
+    return body;
+}
+
+} // namespace telemetry_binary
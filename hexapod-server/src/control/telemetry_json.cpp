@@ -5,8 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
-#include <iomanip>
-#include <sstream>
+#include <type_traits>
 
 namespace telemetry_json {
 namespace {
@@ -16,23 +15,6 @@ constexpr std::array<LegID, kNumLegs> kVisualiserLegOrder = {
     LegID::L1, LegID::L2, LegID::L3, LegID::R1, LegID::R2, LegID::R3};
 constexpr double kMetersToMillimeters = 1000.0;
 
-std::string formatNumber(const double value)
-{
-    std::ostringstream out;
-    out << std::fixed << std::setprecision(6) << value;
-    std::string text = out.str();
-    const auto trailing = text.find_last_not_of('0');
-    if (trailing != std::string::npos && text[trailing] == '.') {
-        text.erase(trailing);
-    } else if (trailing != std::string::npos) {
-        text.erase(trailing + 1);
-    }
-    if (text.empty()) {
-        return "0";
-    }
-    return text;
-}
-
 double averageBodyRadiusM(const HexapodGeometry& geometry)
 {
     double sum = 0.0;
@@ -104,247 +86,247 @@ const char* visualiserKeyForLeg(const LegID leg_id)
 }
 
 template <typename VecLike>
-void appendVec3Json(std::ostringstream& payload, const VecLike& vec) {
-    payload << '[' << vec.x << ',' << vec.y << ',' << vec.z << ']';
+void appendVec3Json(JsonWriter& out, const VecLike& vec) {
+    out.raw('[').number(vec.x).raw(',').number(vec.y).raw(',').number(vec.z).raw(']');
 }
 
 template <typename LegStateArray>
-void appendAnglesDegJson(std::ostringstream& payload, const LegStateArray& leg_states) {
-    payload << '{';
+void appendAnglesDegJson(JsonWriter& out, const LegStateArray& leg_states) {
+    out.raw('{');
     for (int leg = 0; leg < kNumLegs; ++leg) {
         if (leg > 0) {
-            payload << ',';
+            out.raw(',');
         }
         const auto& leg_state = leg_states[static_cast<std::size_t>(kVisualiserLegOrder[leg])];
-        payload << '\"' << kLegOrder[leg] << "\":[";
-        payload << formatNumber(rad2deg(leg_state.joint_state[COXA].pos_rad)) << ',';
-        payload << formatNumber(rad2deg(leg_state.joint_state[FEMUR].pos_rad)) << ',';
-        payload << formatNumber(rad2deg(leg_state.joint_state[TIBIA].pos_rad));
-        payload << ']';
+        out.quoted(kLegOrder[leg]).raw(":[");
+        out.fixed6(rad2deg(leg_state.joint_state[COXA].pos_rad)).raw(',');
+        out.fixed6(rad2deg(leg_state.joint_state[FEMUR].pos_rad)).raw(',');
+        out.fixed6(rad2deg(leg_state.joint_state[TIBIA].pos_rad));
+        out.raw(']');
     }
-    payload << '}';
+    out.raw('}');
 }
 
 template <typename T, std::size_t N>
-void appendScalarArrayJson(std::ostringstream& payload, const std::array<T, N>& values) {
-    payload << '[';
+void appendScalarArrayJson(JsonWriter& out, const std::array<T, N>& values) {
+    out.raw('[');
     for (std::size_t index = 0; index < values.size(); ++index) {
         if (index > 0) {
-            payload << ',';
+            out.raw(',');
+        }
+        if constexpr (std::is_integral_v<T>) {
+            out.integer(values[index]);
+        } else {
+            out.number(static_cast<double>(values[index]));
         }
-        payload << values[index];
     }
-    payload << ']';
+    out.raw(']');
 }
 
 template <std::size_t N>
-void appendBoolArrayJson(std::ostringstream& payload, const std::array<bool, N>& values) {
-    payload << '[';
+void appendBoolArrayJson(JsonWriter& out, const std::array<bool, N>& values) {
+    out.raw('[');
     for (std::size_t index = 0; index < values.size(); ++index) {
         if (index > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        payload << (values[index] ? "true" : "false");
+        out.boolean(values[index]);
     }
-    payload << ']';
+    out.raw(']');
 }
 
 template <std::size_t N>
-void appendVec3ArrayJson(std::ostringstream& payload, const std::array<Vec3, N>& values) {
-    payload << '[';
+void appendVec3ArrayJson(JsonWriter& out, const std::array<Vec3, N>& values) {
+    out.raw('[');
     for (std::size_t index = 0; index < values.size(); ++index) {
         if (index > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        appendVec3Json(payload, values[index]);
+        appendVec3Json(out, values[index]);
     }
-    payload << ']';
+    out.raw(']');
 }
 
-void appendLocomotionDebugJson(std::ostringstream& payload,
-                               const telemetry::LocomotionDebugSnapshot& debug) {
-    payload << "\"locomotion_debug\":{"
-            << "\"valid\":" << (debug.valid ? "true" : "false");
-    payload << ",\"planned_stance\":";
-    appendBoolArrayJson(payload, debug.planned_stance);
-    payload << ",\"hold_stance\":";
-    appendBoolArrayJson(payload, debug.hold_stance);
-    payload << ",\"raw_contact\":";
-    appendBoolArrayJson(payload, debug.raw_contact);
-    payload << ",\"fused_load_bearing\":";
-    appendBoolArrayJson(payload, debug.fused_load_bearing);
-    payload << ",\"fusion_phase_active\":";
-    appendBoolArrayJson(payload, debug.fusion_phase_active);
-    payload << ",\"fused_support\":";
-    appendBoolArrayJson(payload, debug.fused_support);
-    payload << ",\"fused_contact_phase\":";
-    appendScalarArrayJson(payload, debug.fused_contact_phase);
-    payload << ",\"fused_contact_confidence\":";
-    appendScalarArrayJson(payload, debug.fused_contact_confidence);
-    payload << ",\"measured_foot_body_m\":";
-    appendVec3ArrayJson(payload, debug.measured_foot_body_m);
-    payload << ",\"measured_foot_world_m\":";
-    appendVec3ArrayJson(payload, debug.measured_foot_world_m);
-    payload << ",\"commanded_foot_body_m\":";
-    appendVec3ArrayJson(payload, debug.commanded_foot_body_m);
-    payload << ",\"commanded_foot_world_m\":";
-    appendVec3ArrayJson(payload, debug.commanded_foot_world_m);
-    payload << ",\"planned_leg_target_body_m\":";
-    appendVec3ArrayJson(payload, debug.planned_leg_target_body_m);
-    payload << ",\"post_clamp_fk_body_m\":";
-    appendVec3ArrayJson(payload, debug.post_clamp_fk_body_m);
-    payload << ",\"post_clamp_fk_vel_body_mps\":";
-    appendVec3ArrayJson(payload, debug.post_clamp_fk_vel_body_mps);
-    payload << ",\"contact_anchor_world_m\":";
-    appendVec3ArrayJson(payload, debug.contact_anchor_world_m);
-    payload << ",\"contact_anchor_drift_m\":";
-    appendScalarArrayJson(payload, debug.contact_anchor_drift_m);
-    payload << ",\"contact_anchor_max_drift_m\":";
-    appendScalarArrayJson(payload, debug.contact_anchor_max_drift_m);
-    payload << ",\"commanded_tracking_error_m\":";
-    appendScalarArrayJson(payload, debug.commanded_tracking_error_m);
-    payload << ",\"post_clamp_distortion_m\":";
-    appendScalarArrayJson(payload, debug.post_clamp_distortion_m);
-    payload << ",\"post_clamp_distortion_mps\":";
-    appendScalarArrayJson(payload, debug.post_clamp_distortion_mps);
-    payload << ",\"contact_anchor_valid\":";
-    appendBoolArrayJson(payload, debug.contact_anchor_valid);
-    payload << ",\"min_measured_foot_world_z_m\":" << debug.min_measured_foot_world_z_m
-            << ",\"min_commanded_foot_world_z_m\":" << debug.min_commanded_foot_world_z_m
-            << ",\"max_commanded_tracking_error_m\":" << debug.max_commanded_tracking_error_m
-            << ",\"max_post_clamp_distortion_m\":" << debug.max_post_clamp_distortion_m
-            << ",\"max_post_clamp_distortion_mps\":" << debug.max_post_clamp_distortion_mps
-            << '}';
+void appendLocomotionDebugJson(JsonWriter& out, const telemetry::LocomotionDebugSnapshot& debug) {
+    out.raw("\"locomotion_debug\":{\"valid\":").boolean(debug.valid);
+    out.raw(",\"planned_stance\":");
+    appendBoolArrayJson(out, debug.planned_stance);
+    out.raw(",\"hold_stance\":");
+    appendBoolArrayJson(out, debug.hold_stance);
+    out.raw(",\"raw_contact\":");
+    appendBoolArrayJson(out, debug.raw_contact);
+    out.raw(",\"fused_load_bearing\":");
+    appendBoolArrayJson(out, debug.fused_load_bearing);
+    out.raw(",\"fusion_phase_active\":");
+    appendBoolArrayJson(out, debug.fusion_phase_active);
+    out.raw(",\"fused_support\":");
+    appendBoolArrayJson(out, debug.fused_support);
+    out.raw(",\"fused_contact_phase\":");
+    appendScalarArrayJson(out, debug.fused_contact_phase);
+    out.raw(",\"fused_contact_confidence\":");
+    appendScalarArrayJson(out, debug.fused_contact_confidence);
+    out.raw(",\"measured_foot_body_m\":");
+    appendVec3ArrayJson(out, debug.measured_foot_body_m);
+    out.raw(",\"measured_foot_world_m\":");
+    appendVec3ArrayJson(out, debug.measured_foot_world_m);
+    out.raw(",\"commanded_foot_body_m\":");
+    appendVec3ArrayJson(out, debug.commanded_foot_body_m);
+    out.raw(",\"commanded_foot_world_m\":");
+    appendVec3ArrayJson(out, debug.commanded_foot_world_m);
+    out.raw(",\"planned_leg_target_body_m\":");
+    appendVec3ArrayJson(out, debug.planned_leg_target_body_m);
+    out.raw(",\"post_clamp_fk_body_m\":");
+    appendVec3ArrayJson(out, debug.post_clamp_fk_body_m);
+    out.raw(",\"post_clamp_fk_vel_body_mps\":");
+    appendVec3ArrayJson(out, debug.post_clamp_fk_vel_body_mps);
+    out.raw(",\"contact_anchor_world_m\":");
+    appendVec3ArrayJson(out, debug.contact_anchor_world_m);
+    out.raw(",\"contact_anchor_drift_m\":");
+    appendScalarArrayJson(out, debug.contact_anchor_drift_m);
+    out.raw(",\"contact_anchor_max_drift_m\":");
+    appendScalarArrayJson(out, debug.contact_anchor_max_drift_m);
+    out.raw(",\"commanded_tracking_error_m\":");
+    appendScalarArrayJson(out, debug.commanded_tracking_error_m);
+    out.raw(",\"post_clamp_distortion_m\":");
+    appendScalarArrayJson(out, debug.post_clamp_distortion_m);
+    out.raw(",\"post_clamp_distortion_mps\":");
+    appendScalarArrayJson(out, debug.post_clamp_distortion_mps);
+    out.raw(",\"contact_anchor_valid\":");
+    appendBoolArrayJson(out, debug.contact_anchor_valid);
+    out.raw(",\"min_measured_foot_world_z_m\":").number(debug.min_measured_foot_world_z_m)
+        .raw(",\"min_commanded_foot_world_z_m\":").number(debug.min_commanded_foot_world_z_m)
+        .raw(",\"max_commanded_tracking_error_m\":").number(debug.max_commanded_tracking_error_m)
+        .raw(",\"max_post_clamp_distortion_m\":").number(debug.max_post_clamp_distortion_m)
+        .raw(",\"max_post_clamp_distortion_mps\":").number(debug.max_post_clamp_distortion_mps)
+        .raw('}');
 }
 
-void appendLegGeometryJson(std::ostringstream& payload, const HexapodGeometry& geometry) {
-    payload << ",\"legs\":[";
+void appendLegGeometryJson(JsonWriter& out, const HexapodGeometry& geometry) {
+    out.raw(",\"legs\":[");
     for (std::size_t index = 0; index < kVisualiserLegOrder.size(); ++index) {
         if (index > 0) {
-            payload << ',';
+            out.raw(',');
         }
         const LegGeometry& leg = geometry.legGeometry[static_cast<std::size_t>(kVisualiserLegOrder[index])];
-        payload << "{\"key\":\"" << visualiserKeyForLeg(leg.legID) << "\""
-                << ",\"body_coxa_offset\":";
-        appendVec3Json(payload, leg.bodyCoxaOffset);
-        payload << ",\"mount_angle_deg\":" << rad2deg(leg.mountAngle)
-                << ",\"coxa_mm\":" << leg.coxaLength.value * kMetersToMillimeters
-                << ",\"femur_mm\":" << leg.femurLength.value * kMetersToMillimeters
-                << ",\"tibia_mm\":" << leg.tibiaLength.value * kMetersToMillimeters
-                << ",\"coxa_attach_deg\":" << rad2deg(leg.servo.coxaOffset)
-                << ",\"femur_attach_deg\":" << rad2deg(leg.servo.femurOffset)
-                << ",\"tibia_attach_deg\":" << rad2deg(leg.servo.tibiaOffset)
-                << ",\"coxa_sign\":" << leg.servo.coxaSign
-                << ",\"femur_sign\":" << leg.servo.femurSign
-                << ",\"tibia_sign\":" << leg.servo.tibiaSign
-                << "}";
+        out.raw("{\"key\":").quoted(visualiserKeyForLeg(leg.legID)).raw(",\"body_coxa_offset\":");
+        appendVec3Json(out, leg.bodyCoxaOffset);
+        out.raw(",\"mount_angle_deg\":").number(rad2deg(leg.mountAngle))
+            .raw(",\"coxa_mm\":").number(leg.coxaLength.value * kMetersToMillimeters)
+            .raw(",\"femur_mm\":").number(leg.femurLength.value * kMetersToMillimeters)
+            .raw(",\"tibia_mm\":").number(leg.tibiaLength.value * kMetersToMillimeters)
+            .raw(",\"coxa_attach_deg\":").number(rad2deg(leg.servo.coxaOffset))
+            .raw(",\"femur_attach_deg\":").number(rad2deg(leg.servo.femurOffset))
+            .raw(",\"tibia_attach_deg\":").number(rad2deg(leg.servo.tibiaOffset))
+            .raw(",\"coxa_sign\":").number(leg.servo.coxaSign)
+            .raw(",\"femur_sign\":").number(leg.servo.femurSign)
+            .raw(",\"tibia_sign\":").number(leg.servo.tibiaSign)
+            .raw('}');
     }
-    payload << "]";
+    out.raw(']');
 }
 
-void appendGovernorJson(std::ostringstream& payload, const CommandGovernorState& g)
+void appendGovernorJson(JsonWriter& out, const CommandGovernorState& g)
 {
-    payload << "\"governor\":{"
-            << "\"severity\":" << g.severity << ','
-            << "\"body_height_delta_m\":" << g.body_height_delta_m << ','
-            << "\"command_scale\":" << g.command_scale << ','
-            << "\"cadence_scale\":" << g.cadence_scale << ','
-            << "\"support_margin_m\":" << g.support_margin_m << ','
-            << "\"current_support_margin_m\":" << g.current_support_margin_m << ','
-            << "\"current_support_count\":" << g.current_support_count << ','
-            << "\"confirmed_support_count\":" << g.confirmed_support_count << ','
-            << "\"uncertain_support_count\":" << g.uncertain_support_count << ','
-            << "\"recovery_stage\":\"" << recoveryStageName(g.recovery_stage) << "\","
-            << "\"recovery_release_ready\":" << (g.recovery_release_ready ? "true" : "false") << ','
-            << "\"recovery_hold_active\":" << (g.recovery_hold_active ? "true" : "false") << ','
-            << "\"freeze_phase\":" << (g.freeze_phase ? "true" : "false") << ','
-            << "\"reasons\":\"0x" << std::hex << std::uppercase
-            << static_cast<std::uint32_t>(g.reasons) << std::dec << "\"}";
+    out.raw("\"governor\":{")
+        .raw("\"severity\":").number(g.severity).raw(',')
+        .raw("\"body_height_delta_m\":").number(g.body_height_delta_m).raw(',')
+        .raw("\"command_scale\":").number(g.command_scale).raw(',')
+        .raw("\"cadence_scale\":").number(g.cadence_scale).raw(',')
+        .raw("\"support_margin_m\":").number(g.support_margin_m).raw(',')
+        .raw("\"current_support_margin_m\":").number(g.current_support_margin_m).raw(',')
+        .raw("\"current_support_count\":").integer(g.current_support_count).raw(',')
+        .raw("\"confirmed_support_count\":").integer(g.confirmed_support_count).raw(',')
+        .raw("\"uncertain_support_count\":").integer(g.uncertain_support_count).raw(',')
+        .raw("\"recovery_stage\":").quoted(recoveryStageName(g.recovery_stage)).raw(',')
+        .raw("\"recovery_release_ready\":").boolean(g.recovery_release_ready).raw(',')
+        .raw("\"recovery_hold_active\":").boolean(g.recovery_hold_active).raw(',')
+        .raw("\"freeze_phase\":").boolean(g.freeze_phase).raw(',')
+        .raw("\"reasons\":\"0x").hexUpper(static_cast<std::uint32_t>(g.reasons)).raw("\"}");
 }
 
-void appendGovernorConfigJson(std::ostringstream& payload, const control_config::CommandGovernorConfig& cfg)
+void appendGovernorConfigJson(JsonWriter& out, const control_config::CommandGovernorConfig& cfg)
 {
-    payload << "\"governor_config\":{"
-            << "\"low_speed_planar_cutoff_mps\":" << cfg.low_speed_planar_cutoff_mps << ','
-            << "\"low_speed_yaw_cutoff_radps\":" << cfg.low_speed_yaw_cutoff_radps << ','
-            << "\"startup_support_margin_m\":" << cfg.startup_support_margin_m << ','
-            << "\"support_margin_soft_m\":" << cfg.support_margin_soft_m << ','
-            << "\"support_margin_hard_m\":" << cfg.support_margin_hard_m << ','
-            << "\"tilt_soft_rad\":" << cfg.tilt_soft_rad << ','
-            << "\"tilt_hard_rad\":" << cfg.tilt_hard_rad << ','
-            << "\"body_rate_soft_radps\":" << cfg.body_rate_soft_radps << ','
-            << "\"body_rate_hard_radps\":" << cfg.body_rate_hard_radps << ','
-            << "\"fusion_trust_soft\":" << cfg.fusion_trust_soft << ','
-            << "\"fusion_trust_hard\":" << cfg.fusion_trust_hard << ','
-            << "\"contact_mismatch_soft\":" << cfg.contact_mismatch_soft << ','
-            << "\"contact_mismatch_hard\":" << cfg.contact_mismatch_hard << ','
-            << "\"command_accel_soft_mps2\":" << cfg.command_accel_soft_mps2 << ','
-            << "\"command_accel_hard_mps2\":" << cfg.command_accel_hard_mps2 << ','
-            << "\"low_speed_min_scale\":" << cfg.low_speed_min_scale << ','
-            << "\"active_min_scale\":" << cfg.active_min_scale << ','
-            << "\"low_speed_cadence_min_scale\":" << cfg.low_speed_cadence_min_scale << ','
-            << "\"active_cadence_min_scale\":" << cfg.active_cadence_min_scale << ','
-            << "\"body_height_squat_max_m\":" << cfg.body_height_squat_max_m << ','
-            << "\"body_height_squat_severity_threshold\":" << cfg.body_height_squat_severity_threshold << ','
-            << "\"swing_floor_boost_m\":" << cfg.swing_floor_boost_m << ','
-            << "\"body_height_delta_slew_mps\":" << cfg.body_height_delta_slew_mps << ','
-            << "\"ramp_out_health_entry\":" << cfg.ramp_out_health_entry << ','
-            << "\"ramp_out_health_abort\":" << cfg.ramp_out_health_abort << ','
-            << "\"ramp_out_health_filter_tau_s\":" << cfg.ramp_out_health_filter_tau_s << ','
-            << "\"ramp_out_min_dwell_s\":" << cfg.ramp_out_min_dwell_s << ','
-            << "\"ramp_out_abort_persist_s\":" << cfg.ramp_out_abort_persist_s
-            << '}';
+    out.raw("\"governor_config\":{")
+        .raw("\"low_speed_planar_cutoff_mps\":").number(cfg.low_speed_planar_cutoff_mps).raw(',')
+        .raw("\"low_speed_yaw_cutoff_radps\":").number(cfg.low_speed_yaw_cutoff_radps).raw(',')
+        .raw("\"startup_support_margin_m\":").number(cfg.startup_support_margin_m).raw(',')
+        .raw("\"support_margin_soft_m\":").number(cfg.support_margin_soft_m).raw(',')
+        .raw("\"support_margin_hard_m\":").number(cfg.support_margin_hard_m).raw(',')
+        .raw("\"tilt_soft_rad\":").number(cfg.tilt_soft_rad).raw(',')
+        .raw("\"tilt_hard_rad\":").number(cfg.tilt_hard_rad).raw(',')
+        .raw("\"body_rate_soft_radps\":").number(cfg.body_rate_soft_radps).raw(',')
+        .raw("\"body_rate_hard_radps\":").number(cfg.body_rate_hard_radps).raw(',')
+        .raw("\"fusion_trust_soft\":").number(cfg.fusion_trust_soft).raw(',')
+        .raw("\"fusion_trust_hard\":").number(cfg.fusion_trust_hard).raw(',')
+        .raw("\"contact_mismatch_soft\":").number(cfg.contact_mismatch_soft).raw(',')
+        .raw("\"contact_mismatch_hard\":").number(cfg.contact_mismatch_hard).raw(',')
+        .raw("\"command_accel_soft_mps2\":").number(cfg.command_accel_soft_mps2).raw(',')
+        .raw("\"command_accel_hard_mps2\":").number(cfg.command_accel_hard_mps2).raw(',')
+        .raw("\"low_speed_min_scale\":").number(cfg.low_speed_min_scale).raw(',')
+        .raw("\"active_min_scale\":").number(cfg.active_min_scale).raw(',')
+        .raw("\"low_speed_cadence_min_scale\":").number(cfg.low_speed_cadence_min_scale).raw(',')
+        .raw("\"active_cadence_min_scale\":").number(cfg.active_cadence_min_scale).raw(',')
+        .raw("\"body_height_squat_max_m\":").number(cfg.body_height_squat_max_m).raw(',')
+        .raw("\"body_height_squat_severity_threshold\":").number(cfg.body_height_squat_severity_threshold).raw(',')
+        .raw("\"swing_floor_boost_m\":").number(cfg.swing_floor_boost_m).raw(',')
+        .raw("\"body_height_delta_slew_mps\":").number(cfg.body_height_delta_slew_mps).raw(',')
+        .raw("\"ramp_out_health_entry\":").number(cfg.ramp_out_health_entry).raw(',')
+        .raw("\"ramp_out_health_abort\":").number(cfg.ramp_out_health_abort).raw(',')
+        .raw("\"ramp_out_health_filter_tau_s\":").number(cfg.ramp_out_health_filter_tau_s).raw(',')
+        .raw("\"ramp_out_min_dwell_s\":").number(cfg.ramp_out_min_dwell_s).raw(',')
+        .raw("\"ramp_out_abort_persist_s\":").number(cfg.ramp_out_abort_persist_s)
+        .raw('}');
 }
 
-void appendLocomotionFeasibilityJson(std::ostringstream& payload, const LocomotionFeasibility& f)
+void appendLocomotionFeasibilityJson(JsonWriter& out, const LocomotionFeasibility& f)
 {
-    payload << "\"locomotion_feasibility\":{"
-            << "\"valid\":" << (f.valid ? "true" : "false") << ','
-            << "\"enabled\":" << (f.enabled ? "true" : "false") << ','
-            << "\"control_margin_source\":\"" << controlMarginSourceName(f.control_margin_source) << "\","
-            << "\"nominal_margin_m\":" << f.nominal_margin_m << ','
-            << "\"actual_margin_m\":" << f.actual_margin_m << ','
-            << "\"control_margin_m\":" << f.control_margin_m << ','
-            << "\"support_count\":" << f.support.support_count << ','
-            << "\"confirmed_support_count\":" << f.support.confirmed_support_count << ','
-            << "\"uncertain_support_count\":" << f.support.uncertain_support_count << ','
-            << "\"body_tilt_rad\":" << f.body_tilt_rad << ','
-            << "\"body_rate_radps\":" << f.body_rate_radps << ','
-            << "\"high_demand\":" << (f.high_demand ? "true" : "false") << ','
-            << "\"dynamic_risk\":" << (f.dynamic_risk ? "true" : "false") << ','
-            << "\"sparse_support\":" << (f.sparse_support ? "true" : "false") << ','
-            << "\"deadlocked\":" << (f.deadlocked ? "true" : "false") << ','
-            << "\"recovery_recommended\":" << (f.recovery_recommended ? "true" : "false");
-    payload << ",\"safe_to_lift\":";
-    appendBoolArrayJson(payload, f.safe_to_lift);
-    payload << ",\"lift_clearance_m\":";
-    appendScalarArrayJson(payload, f.lift_clearance_m);
-    payload << ",\"contact_mode\":[";
+    out.raw("\"locomotion_feasibility\":{")
+        .raw("\"valid\":").boolean(f.valid).raw(',')
+        .raw("\"enabled\":").boolean(f.enabled).raw(',')
+        .raw("\"control_margin_source\":").quoted(controlMarginSourceName(f.control_margin_source)).raw(',')
+        .raw("\"nominal_margin_m\":").number(f.nominal_margin_m).raw(',')
+        .raw("\"actual_margin_m\":").number(f.actual_margin_m).raw(',')
+        .raw("\"control_margin_m\":").number(f.control_margin_m).raw(',')
+        .raw("\"support_count\":").integer(f.support.support_count).raw(',')
+        .raw("\"confirmed_support_count\":").integer(f.support.confirmed_support_count).raw(',')
+        .raw("\"uncertain_support_count\":").integer(f.support.uncertain_support_count).raw(',')
+        .raw("\"body_tilt_rad\":").number(f.body_tilt_rad).raw(',')
+        .raw("\"body_rate_radps\":").number(f.body_rate_radps).raw(',')
+        .raw("\"high_demand\":").boolean(f.high_demand).raw(',')
+        .raw("\"dynamic_risk\":").boolean(f.dynamic_risk).raw(',')
+        .raw("\"sparse_support\":").boolean(f.sparse_support).raw(',')
+        .raw("\"deadlocked\":").boolean(f.deadlocked).raw(',')
+        .raw("\"recovery_recommended\":").boolean(f.recovery_recommended);
+    out.raw(",\"safe_to_lift\":");
+    appendBoolArrayJson(out, f.safe_to_lift);
+    out.raw(",\"lift_clearance_m\":");
+    appendScalarArrayJson(out, f.lift_clearance_m);
+    out.raw(",\"contact_mode\":[");
     for (std::size_t leg = 0; leg < f.contact.size(); ++leg) {
         if (leg > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        payload << '\"' << legContactModeName(f.contact[leg].mode) << '\"';
+        out.quoted(legContactModeName(f.contact[leg].mode));
     }
-    payload << "],\"contact_use_stance_kinematics\":[";
+    out.raw("],\"contact_use_stance_kinematics\":[");
     for (std::size_t leg = 0; leg < f.contact.size(); ++leg) {
         if (leg > 0) {
-            payload << ',';
+            out.raw(',');
         }
-        payload << (f.contact[leg].use_stance_kinematics ? "true" : "false");
+        out.boolean(f.contact[leg].use_stance_kinematics);
     }
-    payload << "],\"height_policy\":{"
-            << "\"valid\":" << (f.height.valid ? "true" : "false") << ','
-            << "\"enabled\":" << (f.height.enabled ? "true" : "false") << ','
-            << "\"commanded_body_height_m\":" << f.height.commanded_body_height_m << ','
-            << "\"measured_body_height_m\":" << f.height.measured_body_height_m << ','
-            << "\"governor_delta_m\":" << f.height.governor_delta_m << ','
-            << "\"compliance_sag_m\":" << f.height.compliance_sag_m << ','
-            << "\"tilt_squat_request_m\":" << f.height.tilt_squat_request_m << ','
-            << "\"swing_clearance_request_m\":" << f.height.swing_clearance_request_m << ','
-            << "\"terrain_stance_request_m\":" << f.height.terrain_stance_request_m << ','
-            << "\"policy_body_height_m\":" << f.height.policy_body_height_m
-            << "}}";
+    out.raw("],\"height_policy\":{")
+        .raw("\"valid\":").boolean(f.height.valid).raw(',')
+        .raw("\"enabled\":").boolean(f.height.enabled).raw(',')
+        .raw("\"commanded_body_height_m\":").number(f.height.commanded_body_height_m).raw(',')
+        .raw("\"measured_body_height_m\":").number(f.height.measured_body_height_m).raw(',')
+        .raw("\"governor_delta_m\":").number(f.height.governor_delta_m).raw(',')
+        .raw("\"compliance_sag_m\":").number(f.height.compliance_sag_m).raw(',')
+        .raw("\"tilt_squat_request_m\":").number(f.height.tilt_squat_request_m).raw(',')
+        .raw("\"swing_clearance_request_m\":").number(f.height.swing_clearance_request_m).raw(',')
+        .raw("\"terrain_stance_request_m\":").number(f.height.terrain_stance_request_m).raw(',')
+        .raw("\"policy_body_height_m\":").number(f.height.policy_body_height_m)
+        .raw("}}");
 }
 
 const char* jointStateSourceName(const JointStateSource source)
@@ -364,249 +346,213 @@ const char* jointStateSourceName(const JointStateSource source)
     }
 }
 
-void appendJointQualityJson(std::ostringstream& payload,
-                            const std::array<JointStateQuality, kNumLegs>& quality)
+void appendJointQualityJson(JsonWriter& out, const std::array<JointStateQuality, kNumLegs>& quality)
 {
-    payload << "\"joint_state_quality\":[";
+    out.raw("\"joint_state_quality\":[");
     for (std::size_t leg = 0; leg < quality.size(); ++leg) {
         if (leg > 0) {
-            payload << ',';
+            out.raw(',');
         }
         const JointStateQuality& q = quality[leg];
-        payload << "{\"source\":\"" << jointStateSourceName(q.source) << "\","
-                << "\"position_valid\":" << (q.position_valid ? "true" : "false") << ','
-                << "\"velocity_valid\":" << (q.velocity_valid ? "true" : "false") << ','
-                << "\"age_us\":" << q.age_us << ','
-                << "\"confidence\":" << q.confidence
-                << '}';
+        out.raw("{\"source\":").quoted(jointStateSourceName(q.source)).raw(',')
+            .raw("\"position_valid\":").boolean(q.position_valid).raw(',')
+            .raw("\"velocity_valid\":").boolean(q.velocity_valid).raw(',')
+            .raw("\"age_us\":").integer(q.age_us).raw(',')
+            .raw("\"confidence\":").number(q.confidence)
+            .raw('}');
     }
-    payload << ']';
+    out.raw(']');
 }
 
-void appendEpochJson(std::ostringstream& payload, const telemetry::ControlStepTelemetry::EpochTelemetry& epoch)
+void appendEpochJson(JsonWriter& out, const telemetry::ControlStepTelemetry::EpochTelemetry& epoch)
 {
-    payload << "\"epoch\":{"
-            << "\"control_seq_id\":" << epoch.control_seq_id << ','
-            << "\"raw_seq_id\":" << epoch.raw_seq_id << ','
-            << "\"est_seq_id\":" << epoch.est_seq_id << ','
-            << "\"intent_seq_id\":" << epoch.intent_seq_id << ','
-            << "\"raw_timestamp_us\":" << epoch.raw_timestamp_us << ','
-            << "\"est_timestamp_us\":" << epoch.est_timestamp_us << ','
-            << "\"intent_timestamp_us\":" << epoch.intent_timestamp_us << ','
-            << "\"terrain_timestamp_us\":" << epoch.terrain_timestamp_us << ','
-            << "\"raw_age_us\":" << epoch.raw_age_us << ','
-            << "\"est_age_us\":" << epoch.est_age_us << ','
-            << "\"intent_age_us\":" << epoch.intent_age_us << ','
-            << "\"terrain_age_us\":" << epoch.terrain_age_us << ','
-            << "\"raw_valid\":" << (epoch.raw_valid ? "true" : "false") << ','
-            << "\"est_valid\":" << (epoch.est_valid ? "true" : "false") << ','
-            << "\"intent_valid\":" << (epoch.intent_valid ? "true" : "false") << ','
-            << "\"terrain_valid\":" << (epoch.terrain_valid ? "true" : "false")
-            << '}';
+    out.raw("\"epoch\":{")
+        .raw("\"control_seq_id\":").integer(epoch.control_seq_id).raw(',')
+        .raw("\"raw_seq_id\":").integer(epoch.raw_seq_id).raw(',')
+        .raw("\"est_seq_id\":").integer(epoch.est_seq_id).raw(',')
+        .raw("\"intent_seq_id\":").integer(epoch.intent_seq_id).raw(',')
+        .raw("\"raw_timestamp_us\":").integer(epoch.raw_timestamp_us).raw(',')
+        .raw("\"est_timestamp_us\":").integer(epoch.est_timestamp_us).raw(',')
+        .raw("\"intent_timestamp_us\":").integer(epoch.intent_timestamp_us).raw(',')
+        .raw("\"terrain_timestamp_us\":").integer(epoch.terrain_timestamp_us).raw(',')
+        .raw("\"raw_age_us\":").integer(epoch.raw_age_us).raw(',')
+        .raw("\"est_age_us\":").integer(epoch.est_age_us).raw(',')
+        .raw("\"intent_age_us\":").integer(epoch.intent_age_us).raw(',')
+        .raw("\"terrain_age_us\":").integer(epoch.terrain_age_us).raw(',')
+        .raw("\"raw_valid\":").boolean(epoch.raw_valid).raw(',')
+        .raw("\"est_valid\":").boolean(epoch.est_valid).raw(',')
+        .raw("\"intent_valid\":").boolean(epoch.intent_valid).raw(',')
+        .raw("\"terrain_valid\":").boolean(epoch.terrain_valid)
+        .raw('}');
 }
 
-void appendFusionJson(std::ostringstream& payload, const telemetry::FusionTelemetrySnapshot& fusion) {
-    payload << "\"fusion\":{"
-            << "\"has_data\":" << (fusion.has_data ? "true" : "false") << ","
-            << "\"model_trust\":" << fusion.diagnostics.model_trust << ","
-            << "\"resync_requested\":" << (fusion.diagnostics.resync_requested ? "true" : "false") << ","
-            << "\"hard_reset_requested\":" << (fusion.diagnostics.hard_reset_requested ? "true" : "false") << ","
-            << "\"predictive_mode\":" << (fusion.diagnostics.predictive_mode ? "true" : "false") << ","
-            << "\"residuals\":{"
-            << "\"body_position_error_m\":";
-    appendVec3Json(payload, fusion.diagnostics.residuals.body_position_error_m);
-    payload << ",\"body_velocity_error_mps\":";
-    appendVec3Json(payload, fusion.diagnostics.residuals.body_velocity_error_mps);
-    payload << ",\"body_orientation_error_rad\":";
-    appendVec3Json(payload, fusion.diagnostics.residuals.body_orientation_error_rad);
-    payload << ",\"foot_contact_error\":[";
-    for (int leg = 0; leg < kNumLegs; ++leg) {
-        if (leg > 0) {
-            payload << ',';
-        }
-        payload << fusion.diagnostics.residuals.foot_contact_error[static_cast<std::size_t>(leg)];
-    }
-    payload << "],"
-            << "\"max_body_position_error_m\":" << fusion.diagnostics.residuals.max_body_position_error_m << ","
-            << "\"max_body_orientation_error_rad\":"
-            << fusion.diagnostics.residuals.max_body_orientation_error_rad << ","
-            << "\"contact_mismatch_ratio\":" << fusion.diagnostics.residuals.contact_mismatch_ratio << ","
-            << "\"terrain_residual_m\":" << fusion.diagnostics.residuals.terrain_residual_m
-            << "},\"feet\":[";
+void appendResidualsJson(JsonWriter& out, const FusionResidualSummary& residuals)
+{
+    out.raw("\"residuals\":{\"body_position_error_m\":");
+    appendVec3Json(out, residuals.body_position_error_m);
+    out.raw(",\"body_velocity_error_mps\":");
+    appendVec3Json(out, residuals.body_velocity_error_mps);
+    out.raw(",\"body_orientation_error_rad\":");
+    appendVec3Json(out, residuals.body_orientation_error_rad);
+    out.raw(",\"foot_contact_error\":");
+    appendScalarArrayJson(out, residuals.foot_contact_error);
+    out.raw(',')
+        .raw("\"max_body_position_error_m\":").number(residuals.max_body_position_error_m).raw(',')
+        .raw("\"max_body_orientation_error_rad\":").number(residuals.max_body_orientation_error_rad).raw(',')
+        .raw("\"contact_mismatch_ratio\":").number(residuals.contact_mismatch_ratio).raw(',')
+        .raw("\"terrain_residual_m\":").number(residuals.terrain_residual_m)
+        .raw('}');
+}
+
+void appendFusionJson(JsonWriter& out, const telemetry::FusionTelemetrySnapshot& fusion) {
+    out.raw("\"fusion\":{")
+        .raw("\"has_data\":").boolean(fusion.has_data).raw(',')
+        .raw("\"model_trust\":").number(fusion.diagnostics.model_trust).raw(',')
+        .raw("\"resync_requested\":").boolean(fusion.diagnostics.resync_requested).raw(',')
+        .raw("\"hard_reset_requested\":").boolean(fusion.diagnostics.hard_reset_requested).raw(',')
+        .raw("\"predictive_mode\":").boolean(fusion.diagnostics.predictive_mode).raw(',');
+    appendResidualsJson(out, fusion.diagnostics.residuals);
+    out.raw(",\"feet\":[");
     for (int leg = 0; leg < kNumLegs; ++leg) {
         if (leg > 0) {
-            payload << ',';
+            out.raw(',');
         }
         const FootContactFusion& foot = fusion.foot_contact_fusion[static_cast<std::size_t>(leg)];
-        payload << "{\"phase\":" << static_cast<int>(foot.phase)
-                << ",\"confidence\":" << foot.confidence
-                << ",\"touchdown_window_start_us\":" << foot.touchdown_window_start_us.value
-                << ",\"touchdown_window_end_us\":" << foot.touchdown_window_end_us.value
-                << ",\"last_transition_us\":" << foot.last_transition_us.value
-                << "}";
-    }
-    payload << "],\"correction\":{"
-            << "\"has_data\":" << (fusion.correction.has_data ? "true" : "false") << ","
-            << "\"mode\":" << static_cast<int>(fusion.correction.mode) << ","
-            << "\"sample_id\":" << fusion.correction.sample_id << ","
-            << "\"timestamp_us\":" << fusion.correction.timestamp_us.value << ","
-            << "\"correction_strength\":" << fusion.correction.correction_strength << ","
-            << "\"residuals\":{"
-            << "\"body_position_error_m\":";
-    appendVec3Json(payload, fusion.correction.residuals.body_position_error_m);
-    payload << ",\"body_velocity_error_mps\":";
-    appendVec3Json(payload, fusion.correction.residuals.body_velocity_error_mps);
-    payload << ",\"body_orientation_error_rad\":";
-    appendVec3Json(payload, fusion.correction.residuals.body_orientation_error_rad);
-    payload << ",\"foot_contact_error\":[";
-    for (int leg = 0; leg < kNumLegs; ++leg) {
-        if (leg > 0) {
-            payload << ',';
-        }
-        payload << fusion.correction.residuals.foot_contact_error[static_cast<std::size_t>(leg)];
+        out.raw("{\"phase\":").integer(static_cast<int>(foot.phase))
+            .raw(",\"confidence\":").number(foot.confidence)
+            .raw(",\"touchdown_window_start_us\":").integer(foot.touchdown_window_start_us.value)
+            .raw(",\"touchdown_window_end_us\":").integer(foot.touchdown_window_end_us.value)
+            .raw(",\"last_transition_us\":").integer(foot.last_transition_us.value)
+            .raw('}');
     }
-    payload << "],"
-            << "\"max_body_position_error_m\":"
-            << fusion.correction.residuals.max_body_position_error_m << ","
-            << "\"max_body_orientation_error_rad\":"
-            << fusion.correction.residuals.max_body_orientation_error_rad << ","
-            << "\"contact_mismatch_ratio\":" << fusion.correction.residuals.contact_mismatch_ratio << ","
-            << "\"terrain_residual_m\":" << fusion.correction.residuals.terrain_residual_m
-            << "}}";
-    payload << '}';
+    out.raw("],\"correction\":{")
+        .raw("\"has_data\":").boolean(fusion.correction.has_data).raw(',')
+        .raw("\"mode\":").integer(static_cast<int>(fusion.correction.mode)).raw(',')
+        .raw("\"sample_id\":").integer(fusion.correction.sample_id).raw(',')
+        .raw("\"timestamp_us\":").integer(fusion.correction.timestamp_us.value).raw(',')
+        .raw("\"correction_strength\":").number(fusion.correction.correction_strength).raw(',');
+    appendResidualsJson(out, fusion.correction.residuals);
+    out.raw("}}");
 }
 
-void appendProcessResourceJson(std::ostringstream& payload,
-                              const resource_monitoring::ProcessResourceSnapshot& snapshot) {
-    payload << "{\"cpu_percent\":" << snapshot.cpu_percent
-            << ",\"cpu_window_us\":" << snapshot.cpu_window_us
-            << ",\"rss_bytes\":" << snapshot.rss_bytes
-            << ",\"vms_bytes\":" << snapshot.vms_bytes
-            << '}';
+void appendProcessResourceJson(JsonWriter& out, const resource_monitoring::ProcessResourceSnapshot& snapshot) {
+    out.raw("{\"cpu_percent\":").number(snapshot.cpu_percent)
+        .raw(",\"cpu_window_us\":").integer(snapshot.cpu_window_us)
+        .raw(",\"rss_bytes\":").integer(snapshot.rss_bytes)
+        .raw(",\"vms_bytes\":").integer(snapshot.vms_bytes)
+        .raw('}');
 }
 
 template <std::size_t MaxSections>
-void appendResourceSectionSummaryJson(std::ostringstream& payload,
+void appendResourceSectionSummaryJson(JsonWriter& out,
                                       const resource_monitoring::ResourceSectionSummary<MaxSections>& summary) {
-    payload << '[';
+    out.raw('[');
     const std::size_t count = std::min(summary.count, summary.sections.size());
     for (std::size_t index = 0; index < count; ++index) {
         if (index > 0) {
-            payload << ',';
+            out.raw(',');
         }
         const resource_monitoring::ResourceSectionSnapshot& section = summary.sections[index];
-        payload << "{\"label\":\"" << (section.label != nullptr ? section.label : "<unnamed>") << "\""
-                << ",\"total_self_ns\":" << section.total_self_ns
-                << ",\"window_self_ns\":" << section.window_self_ns
-                << ",\"max_self_ns\":" << section.max_self_ns
-                << ",\"call_count\":" << section.call_count
-                << '}';
+        out.raw("{\"label\":").quoted(section.label != nullptr ? section.label : "<unnamed>")
+            .raw(",\"total_self_ns\":").integer(section.total_self_ns)
+            .raw(",\"window_self_ns\":").integer(section.window_self_ns)
+            .raw(",\"max_self_ns\":").integer(section.max_self_ns)
+            .raw(",\"call_count\":").integer(section.call_count)
+            .raw('}');
     }
-    payload << ']';
+    out.raw(']');
 }
 
 } // namespace
 
-std::string serializeGeometryPacket(const HexapodGeometry& geometry)
+void writeGeometryPacket(JsonWriter& out, const HexapodGeometry& geometry)
 {
     const visualiser_telemetry::VisualiserGeometry visualiser_geometry =
         visualiser_telemetry::geometryToVisualiserUnits(geometry);
 
-    std::ostringstream stream;
-    stream << '{'
-           << "\"schema_version\":" << kSchemaVersion << ','
-           << "\"type\":\"geometry\","
-           << "\"geometry\":{"
-           << "\"coxa\":" << visualiser_geometry.coxa_mm << ','
-           << "\"femur\":" << visualiser_geometry.femur_mm << ','
-           << "\"tibia\":" << visualiser_geometry.tibia_mm << ','
-           << "\"body_radius\":" << visualiser_geometry.body_radius_mm;
-    appendLegGeometryJson(stream, geometry);
-    stream << "}}";
-    return stream.str();
+    out.raw('{')
+        .raw("\"schema_version\":").integer(kSchemaVersion).raw(',')
+        .raw("\"type\":\"geometry\",")
+        .raw("\"geometry\":{")
+        .raw("\"coxa\":").number(visualiser_geometry.coxa_mm).raw(',')
+        .raw("\"femur\":").number(visualiser_geometry.femur_mm).raw(',')
+        .raw("\"tibia\":").number(visualiser_geometry.tibia_mm).raw(',')
+        .raw("\"body_radius\":").number(visualiser_geometry.body_radius_mm);
+    appendLegGeometryJson(out, geometry);
+    out.raw("}}");
 }
 
-std::string serializeVisualiserJointsPacket(const HexapodGeometry& geometry,
-                                            const JointTargets& joints,
-                                            const uint64_t timestamp_ms)
+void writeVisualiserJointsPacket(JsonWriter& out,
+                                 const HexapodGeometry& geometry,
+                                 const JointTargets& joints,
+                                 const uint64_t timestamp_ms)
 {
-    std::ostringstream out;
-    out << '{';
-    out << "\"type\":\"joints\",";
-    out << "\"schema_version\":" << kSchemaVersion << ',';
-    out << "\"timestamp_ms\":" << timestamp_ms << ',';
-
-    out << "\"geometry\":{";
-    out << "\"coxa\":" << formatNumber(geometry.legGeometry[0].coxaLength.value * kMetersToMillimeters) << ',';
-    out << "\"femur\":" << formatNumber(geometry.legGeometry[0].femurLength.value * kMetersToMillimeters)
-        << ',';
-    out << "\"tibia\":" << formatNumber(geometry.legGeometry[0].tibiaLength.value * kMetersToMillimeters)
-        << ',';
-    out << "\"body_radius\":" << formatNumber(averageBodyRadiusM(geometry) * kMetersToMillimeters);
+    out.raw('{');
+    out.raw("\"type\":\"joints\",");
+    out.raw("\"schema_version\":").integer(kSchemaVersion).raw(',');
+    out.raw("\"timestamp_ms\":").integer(timestamp_ms).raw(',');
+
+    out.raw("\"geometry\":{");
+    out.raw("\"coxa\":").fixed6(geometry.legGeometry[0].coxaLength.value * kMetersToMillimeters).raw(',');
+    out.raw("\"femur\":").fixed6(geometry.legGeometry[0].femurLength.value * kMetersToMillimeters).raw(',');
+    out.raw("\"tibia\":").fixed6(geometry.legGeometry[0].tibiaLength.value * kMetersToMillimeters).raw(',');
+    out.raw("\"body_radius\":").fixed6(averageBodyRadiusM(geometry) * kMetersToMillimeters);
     appendLegGeometryJson(out, geometry);
-    out << "},";
+    out.raw("},");
 
-    out << "\"angles_deg\":";
+    out.raw("\"angles_deg\":");
     appendAnglesDegJson(out, joints.leg_states);
 
-    out << '}';
-    return out.str();
+    out.raw('}');
 }
 
-std::string serializeControlStepPacket(const telemetry::ControlStepTelemetry& telemetry)
+void writeControlStepPacket(JsonWriter& out, const telemetry::ControlStepTelemetry& telemetry)
 {
-    std::ostringstream payload;
-    payload << "{\"type\":\"joints\",\"schema_version\":" << kSchemaVersion << ','
-            << "\"timestamp_ms\":" << (telemetry.timestamp_us.value / 1000ULL) << ','
-            << "\"loop_counter\":" << telemetry.status.loop_counter << ','
-            << "\"mode\":" << static_cast<int>(telemetry.status.active_mode) << ','
-            << "\"active_mode\":\"" << robotModeToString(telemetry.status.active_mode) << "\","
-            << "\"active_fault\":\"" << faultCodeToString(telemetry.status.active_fault) << "\","
-            << "\"bus_ok\":" << (telemetry.status.bus_ok ? "true" : "false") << ','
-            << "\"estimator_valid\":" << (telemetry.status.estimator_valid ? "true" : "false") << ','
-            << "\"voltage\":" << telemetry.estimated_state.voltage << ','
-            << "\"current\":" << telemetry.estimated_state.current << ','
-            << "\"angles_deg\":";
-    appendAnglesDegJson(payload, telemetry.joint_targets.leg_states);
-    payload << ",\"commanded_angles_deg\":";
-    appendAnglesDegJson(payload, telemetry.joint_targets.leg_states);
-    payload << ",\"measured_angles_deg\":";
-    appendAnglesDegJson(payload, telemetry.estimated_state.leg_states);
-    payload << ",\"raw_contacts\":[";
-    for (int leg = 0; leg < kNumLegs; ++leg) {
-        if (leg != 0) {
-            payload << ",";
-        }
-        payload << (telemetry.estimated_state.foot_contacts[static_cast<std::size_t>(leg)] ? "true" : "false");
-    }
-    payload << "]";
+    out.raw("{\"type\":\"joints\",\"schema_version\":").integer(kSchemaVersion).raw(',')
+        .raw("\"timestamp_ms\":").integer(telemetry.timestamp_us.value / 1000ULL).raw(',')
+        .raw("\"loop_counter\":").integer(telemetry.status.loop_counter).raw(',')
+        .raw("\"mode\":").integer(static_cast<int>(telemetry.status.active_mode)).raw(',')
+        .raw("\"active_mode\":").quoted(robotModeToString(telemetry.status.active_mode)).raw(',')
+        .raw("\"active_fault\":").quoted(faultCodeToString(telemetry.status.active_fault)).raw(',')
+        .raw("\"bus_ok\":").boolean(telemetry.status.bus_ok).raw(',')
+        .raw("\"estimator_valid\":").boolean(telemetry.status.estimator_valid).raw(',')
+        .raw("\"voltage\":").number(telemetry.estimated_state.voltage).raw(',')
+        .raw("\"current\":").number(telemetry.estimated_state.current).raw(',')
+        .raw("\"angles_deg\":");
+    appendAnglesDegJson(out, telemetry.joint_targets.leg_states);
+    out.raw(",\"commanded_angles_deg\":");
+    appendAnglesDegJson(out, telemetry.joint_targets.leg_states);
+    out.raw(",\"measured_angles_deg\":");
+    appendAnglesDegJson(out, telemetry.estimated_state.leg_states);
+    out.raw(",\"raw_contacts\":");
+    appendBoolArrayJson(out, telemetry.estimated_state.foot_contacts);
     if (telemetry.estimated_state.has_body_twist_state) {
-        payload << ",\"body_position\":";
-        appendVec3Json(payload, telemetry.estimated_state.body_twist_state.body_trans_m);
-        payload << ",\"body_orientation_rad\":";
-        appendVec3Json(payload, telemetry.estimated_state.body_twist_state.twist_pos_rad);
-        payload << ",\"body_yaw_rad\":" << telemetry.estimated_state.body_twist_state.twist_pos_rad.z;
+        out.raw(",\"body_position\":");
+        appendVec3Json(out, telemetry.estimated_state.body_twist_state.body_trans_m);
+        out.raw(",\"body_orientation_rad\":");
+        appendVec3Json(out, telemetry.estimated_state.body_twist_state.twist_pos_rad);
+        out.raw(",\"body_yaw_rad\":").number(telemetry.estimated_state.body_twist_state.twist_pos_rad.z);
     }
-    payload << ',';
-    appendLocomotionDebugJson(payload, telemetry.locomotion_debug);
-    payload << ',';
-    appendJointQualityJson(payload, telemetry.estimated_state.joint_state_quality);
+    out.raw(',');
+    appendLocomotionDebugJson(out, telemetry.locomotion_debug);
+    out.raw(',');
+    appendJointQualityJson(out, telemetry.estimated_state.joint_state_quality);
     if (telemetry.navigation.has_value()) {
         const NavigationMonitorSnapshot& nav = telemetry.navigation.value();
-        payload << ",\"nav\":{"
-                << "\"lifecycle\":" << static_cast<int>(nav.lifecycle) << ','
-                << "\"planner_status\":" << static_cast<int>(nav.planner_status) << ','
-                << "\"block_reason\":" << static_cast<int>(nav.block_reason) << ','
-                << "\"map_fresh\":" << (nav.map_fresh ? "true" : "false") << ','
-                << "\"replan_count\":" << nav.replan_count << ','
-                << "\"active_segment_waypoint_count\":" << nav.active_segment_waypoint_count << ','
-                << "\"active_segment_length_m\":" << nav.active_segment_length_m << ','
-                << "\"nearest_obstacle_distance_m\":" << nav.nearest_obstacle_distance_m
-                << "}";
+        out.raw(",\"nav\":{")
+            .raw("\"lifecycle\":").integer(static_cast<int>(nav.lifecycle)).raw(',')
+            .raw("\"planner_status\":").integer(static_cast<int>(nav.planner_status)).raw(',')
+            .raw("\"block_reason\":").integer(static_cast<int>(nav.block_reason)).raw(',')
+            .raw("\"map_fresh\":").boolean(nav.map_fresh).raw(',')
+            .raw("\"replan_count\":").integer(nav.replan_count).raw(',')
+            .raw("\"active_segment_waypoint_count\":").integer(nav.active_segment_waypoint_count).raw(',')
+            .raw("\"active_segment_length_m\":").number(nav.active_segment_length_m).raw(',')
+            .raw("\"nearest_obstacle_distance_m\":").number(nav.nearest_obstacle_distance_m)
+            .raw('}');
     }
     if (telemetry.process_resources.has_value()) {
-        payload << ",\"process_resource\":";
-        appendProcessResourceJson(payload, telemetry.process_resources.value());
+        out.raw(",\"process_resource\":");
+        appendProcessResourceJson(out, telemetry.process_resources.value());
     }
     telemetry::FusionTelemetrySnapshot fusion = telemetry.fusion;
     if (!fusion.has_data && telemetry.estimated_state.has_fusion_diagnostics) {
@@ -614,22 +560,44 @@ std::string serializeControlStepPacket(const telemetry::ControlStepTelemetry& te
         fusion.diagnostics = telemetry.estimated_state.fusion;
         fusion.foot_contact_fusion = telemetry.estimated_state.foot_contact_fusion;
     }
-    payload << ',';
-    appendFusionJson(payload, fusion);
-    payload << ',';
-    appendGovernorJson(payload, telemetry.governor);
-    payload << ',';
-    appendGovernorConfigJson(payload, telemetry.governor_config);
-    payload << ',';
-    appendLocomotionFeasibilityJson(payload, telemetry.locomotion_feasibility);
-    payload << ',';
-    appendEpochJson(payload, telemetry.epoch);
+    out.raw(',');
+    appendFusionJson(out, fusion);
+    out.raw(',');
+    appendGovernorJson(out, telemetry.governor);
+    out.raw(',');
+    appendGovernorConfigJson(out, telemetry.governor_config);
+    out.raw(',');
+    appendLocomotionFeasibilityJson(out, telemetry.locomotion_feasibility);
+    out.raw(',');
+    appendEpochJson(out, telemetry.epoch);
     if (telemetry.resource_sections.has_value()) {
-        payload << ",\"resource_sections\":";
-        appendResourceSectionSummaryJson(payload, telemetry.resource_sections.value());
+        out.raw(",\"resource_sections\":");
+        appendResourceSectionSummaryJson(out, telemetry.resource_sections.value());
     }
-    payload << '}';
-    return payload.str();
+    out.raw('}');
+}
+
+std::string serializeGeometryPacket(const HexapodGeometry& geometry)
+{
+    JsonWriter out;
+    writeGeometryPacket(out, geometry);
+    return out.str();
+}
+
+std::string serializeVisualiserJointsPacket(const HexapodGeometry& geometry,
+                                            const JointTargets& joints,
+                                            const uint64_t timestamp_ms)
+{
+    JsonWriter out;
+    writeVisualiserJointsPacket(out, geometry, joints, timestamp_ms);
+    return out.str();
+}
+
+std::string serializeControlStepPacket(const telemetry::ControlStepTelemetry& telemetry)
+{
+    JsonWriter out;
+    writeControlStepPacket(out, telemetry);
+    return out.str();
 }
 
 } // namespace telemetry_json
@@ -1,4 +1,5 @@
 #include "telemetry_publisher.hpp"
+#include "telemetry_binary.hpp"
 #include "telemetry_json.hpp"
 
 #include <arpa/inet.h>
@@ -6,7 +7,8 @@
 #include <cmath>
 #include <cstring>
 #include <fcntl.h>
-#include <sstream>
+#include <string_view>
+#include <vector>
 #include <sys/socket.h>
 #include <unistd.h>
 
@@ -14,6 +16,9 @@ namespace telemetry {
 
 namespace {
 
+// A full control-step packet is ~9 KiB; reserving past that avoids regrowth on the first few frames.
+constexpr std::size_t kControlStepJsonReserveBytes = 16 * 1024;
+
 class NoopTelemetryPublisher final : public ITelemetryPublisher {
 public:
     void publishGeometry(const HexapodGeometry&) override {}
@@ -27,7 +32,8 @@ class UdpTelemetryPublisher final : public ITelemetryPublisher {
 public:
     UdpTelemetryPublisher(const TelemetryPublisherConfig& config,
                           std::shared_ptr<logging::AsyncLogger> logger)
-        : logger_(std::move(logger)) {
+        : logger_(std::move(logger)),
+          binary_stream_(config.binary_stream) {
         socket_fd_ = ::socket(AF_INET, SOCK_DGRAM, 0);
         if (socket_fd_ < 0) {
             if (logger_) {
@@ -64,21 +70,46 @@ public:
         if (socket_fd_ < 0) {
             return;
         }
-        send(telemetry_json::serializeGeometryPacket(geometry));
+        geometry_json_.clear();
+        telemetry_json::writeGeometryPacket(geometry_json_, geometry);
+        send(geometry_json_.view());
     }
 
     void publishControlStep(const ControlStepTelemetry& telemetry) override {
         if (socket_fd_ < 0) {
             return;
         }
-        send(telemetry_json::serializeControlStepPacket(telemetry));
+        control_step_json_.clear();
+        telemetry_json::writeControlStepPacket(control_step_json_, telemetry);
+        send(control_step_json_.view());
+    }
+
+    void publishControlFrame(const ControlFrameTelemetry& frame) override {
+        if (socket_fd_ < 0 || !binary_stream_) {
+            return;
+        }
+        hexapod_telemetry::EncodeControlFrame(
+            binary_frame_, telemetry_binary::makeControlFrameBody(frame, binary_frame_sequence_++));
+        send(binary_frame_.data(), binary_frame_.size());
+        if (frame.estimated_state.has_fusion_diagnostics) {
+            hexapod_telemetry::EncodeFusionSummary(
+                binary_frame_, telemetry_binary::makeFusionSummaryBody(frame.estimated_state, frame.timestamp_us));
+            send(binary_frame_.data(), binary_frame_.size());
+        }
+        if (frame.navigation.has_value()) {
+            hexapod_telemetry::EncodeNavigationSummary(
+                binary_frame_, telemetry_binary::makeNavigationSummaryBody(frame.navigation.value(), frame.timestamp_us));
+            send(binary_frame_.data(), binary_frame_.size());
+        }
     }
 
 private:
-    void send(const std::string& payload) {
+    void send(std::string_view payload) { send(payload.data(), payload.size()); }
+
+    void send(const void* payload, std::size_t size) {
         const ssize_t sent = ::sendto(socket_fd_,
-                                      payload.data(),
-                                      payload.size(),
+                                      payload,
+                                      size,
                                       MSG_DONTWAIT,
                                       reinterpret_cast<const sockaddr*>(&destination_),
                                       sizeof(destination_));
@@ -109,6 +140,12 @@ private:
     int socket_fd_{-1};
     sockaddr_in destination_{};
     std::shared_ptr<logging::AsyncLogger> logger_;
+    // One reusable encode buffer per packet kind, so a steady stream of control steps never allocates.
+    JsonWriter geometry_json_{};
+    JsonWriter control_step_json_{kControlStepJsonReserveBytes};
+    bool binary_stream_{false};
+    std::vector<uint8_t> binary_frame_{};
+    uint32_t binary_frame_sequence_{0};
     uint64_t send_error_count_{0};
     uint64_t packets_sent_count_{0};
     uint64_t socket_send_failures_{0};
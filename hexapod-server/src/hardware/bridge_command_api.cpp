@@ -1,6 +1,7 @@
 #include "bridge_command_api.hpp"
 
 #include <cstddef>
+#include <optional>
 
 #include "command_client.hpp"
 #include "hexapod-common.hpp"
@@ -41,16 +42,44 @@ BridgeError BridgeCommandApi::request_transaction(CommandCode cmd,
     last_result_ = ResultMetadata{};
     last_result_.command_code = as_u8(cmd);
     const auto outcome = command_client_.transact(static_cast<CommandCode>(cmd), payload, out_payload);
+    return record_outcome(cmd, outcome, (out_payload != nullptr) ? out_payload->size() : 0);
+}
+
+BridgeError BridgeCommandApi::post_with_error(CommandCode cmd, const std::vector<uint8_t>& payload) {
+    last_result_ = ResultMetadata{};
+    last_result_.command_code = as_u8(cmd);
+    command_client_.post(cmd, payload);
+    return BridgeError::None;
+}
+
+bool BridgeCommandApi::has_pending() const {
+    return command_client_.has_pending();
+}
+
+BridgeError BridgeCommandApi::complete_pending_payload_with_error(std::vector<uint8_t>& out_payload) {
+    last_result_ = ResultMetadata{};
+    const std::optional<CommandCode> cmd = command_client_.pending_command();
+    if (!cmd.has_value()) {
+        last_result_.error = BridgeError::ProtocolFailure;
+        last_result_.phase = BridgeFailurePhase::CommandExecution;
+        last_result_.domain = BridgeFailureDomain::CommandProtocol;
+        return BridgeError::ProtocolFailure;
+    }
+
+    last_result_.command_code = as_u8(*cmd);
+    const auto outcome = command_client_.complete_pending(&out_payload);
+    return record_outcome(*cmd, outcome, out_payload.size());
+}
+
+BridgeError BridgeCommandApi::record_outcome(CommandCode cmd,
+                                             const TransportSession::CommandOutcome& outcome,
+                                             std::size_t response_payload_size) {
     if (outcome.outcome_class == TransportSession::OutcomeClass::Success) {
         last_result_.error = BridgeError::None;
         return BridgeError::None;
     }
 
-    const std::size_t payload_size = (out_payload != nullptr) ? out_payload->size() : 0;
-    log_command_failure(static_cast<CommandCode>(cmd),
-                        outcome.outcome_class,
-                        outcome.nack_code,
-                        payload_size);
+    log_command_failure(cmd, outcome.outcome_class, outcome.nack_code, response_payload_size);
     const BridgeError error = map_outcome_to_bridge_error(outcome);
     last_result_.error = error;
     last_result_.nack_code = outcome.nack_code;
@@ -77,6 +106,15 @@ BridgeError BridgeCommandApi::request_transaction(CommandCode cmd,
     return error;
 }
 
+BridgeError BridgeCommandApi::record_decode_failure(CommandCode cmd, std::size_t response_payload_size) {
+    log_decode_failure(cmd, response_payload_size);
+    last_result_.error = BridgeError::ProtocolFailure;
+    last_result_.phase = BridgeFailurePhase::CommandDecode;
+    last_result_.domain = BridgeFailureDomain::CommandProtocol;
+    last_result_.retryable = false;
+    return BridgeError::ProtocolFailure;
+}
+
 BridgeError BridgeCommandApi::map_outcome_to_bridge_error(
     const TransportSession::CommandOutcome& outcome) {
     switch (outcome.outcome_class) {
@@ -27,6 +27,10 @@ bool CommandClient::send_command_and_expect_ack_payload(CommandCode cmd,
 TransportSession::CommandOutcome CommandClient::transact(CommandCode cmd,
                                                          const std::vector<uint8_t>& payload,
                                                          std::vector<uint8_t>* ack_payload) {
+    if (pending_.has_value()) {
+        (void)complete_pending(nullptr);
+    }
+
     const int max_attempts = (retry_policy_.max_attempts > 0) ? retry_policy_.max_attempts : 1;
     const auto start = std::chrono::steady_clock::now();
     TransportSession::CommandOutcome last_outcome{TransportSession::OutcomeClass::ProtocolError, {}, 0};
@@ -52,30 +56,7 @@ TransportSession::CommandOutcome CommandClient::transact(CommandCode cmd,
         last_outcome.outcome_class = TransportSession::OutcomeClass::RetryExhausted;
     }
 
-    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
-        std::chrono::steady_clock::now() - start).count();
-    if (logger_) {
-        LOG_INFO(logger_,
-                 "telemetry command=",
-                 command_name(cmd),
-                 " seq=",
-                 static_cast<unsigned>(seq),
-                 " latency_us=",
-                 elapsed,
-                 " outcome=",
-                 outcome_to_text(last_outcome.outcome_class),
-                 " attempts=",
-                 attempts_used);
-        if (last_outcome.outcome_class != TransportSession::OutcomeClass::Success) {
-            LOG_WARN(logger_,
-                     "command_failure command=",
-                     command_name(cmd),
-                     " domain_error=",
-                     domain_error_for_outcome(last_outcome.outcome_class),
-                     " nack_code=",
-                     static_cast<unsigned>(last_outcome.nack_code));
-        }
-    }
+    log_telemetry(cmd, seq, start, last_outcome, attempts_used);
 
     if (last_outcome.outcome_class == TransportSession::OutcomeClass::Success && ack_payload) {
         *ack_payload = last_outcome.ack_payload;
@@ -84,6 +65,75 @@ TransportSession::CommandOutcome CommandClient::transact(CommandCode cmd,
     return last_outcome;
 }
 
+void CommandClient::post(CommandCode cmd, const std::vector<uint8_t>& payload) {
+    if (pending_.has_value()) {
+        (void)complete_pending(nullptr);
+    }
+
+    const uint16_t seq = transport_.next_sequence();
+    transport_.send(seq, cmd, payload);
+    pending_ = PendingRequest{cmd, seq, std::chrono::steady_clock::now()};
+}
+
+bool CommandClient::has_pending() const {
+    return pending_.has_value();
+}
+
+std::optional<CommandCode> CommandClient::pending_command() const {
+    if (!pending_.has_value()) {
+        return std::nullopt;
+    }
+    return pending_->cmd;
+}
+
+TransportSession::CommandOutcome CommandClient::complete_pending(std::vector<uint8_t>* ack_payload) {
+    if (!pending_.has_value()) {
+        return TransportSession::CommandOutcome{TransportSession::OutcomeClass::ProtocolError, {}, 0};
+    }
+
+    const PendingRequest pending = *pending_;
+    pending_.reset();
+    TransportSession::CommandOutcome outcome = transport_.wait_for_ack(pending.seq);
+    log_telemetry(pending.cmd, pending.seq, pending.sent_at, outcome, 1);
+
+    if (outcome.outcome_class == TransportSession::OutcomeClass::Success && ack_payload) {
+        *ack_payload = outcome.ack_payload;
+    }
+    return outcome;
+}
+
+void CommandClient::log_telemetry(CommandCode cmd,
+                                  uint16_t seq,
+                                  std::chrono::steady_clock::time_point start,
+                                  const TransportSession::CommandOutcome& outcome,
+                                  int attempts) const {
+    if (!logger_) {
+        return;
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    LOG_INFO(logger_,
+             "telemetry command=",
+             command_name(cmd),
+             " seq=",
+             static_cast<unsigned>(seq),
+             " latency_us=",
+             elapsed,
+             " outcome=",
+             outcome_to_text(outcome.outcome_class),
+             " attempts=",
+             attempts);
+    if (outcome.outcome_class != TransportSession::OutcomeClass::Success) {
+        LOG_WARN(logger_,
+                 "command_failure command=",
+                 command_name(cmd),
+                 " domain_error=",
+                 domain_error_for_outcome(outcome.outcome_class),
+                 " nack_code=",
+                 static_cast<unsigned>(outcome.nack_code));
+    }
+}
+
 const char* CommandClient::outcome_to_text(TransportSession::OutcomeClass outcome) {
     switch (outcome) {
         case TransportSession::OutcomeClass::Success:
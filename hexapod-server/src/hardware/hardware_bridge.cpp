@@ -320,7 +320,20 @@ bool SimpleHardwareBridge::read(RobotState& out) {
     const BridgeError command_error = withCommandApi(
         "read",
         CommandCode::GET_FULL_HARDWARE_STATE,
-        [&out, &decode_state](BridgeCommandApi& api) {
+        [this, &out, &decode_state](BridgeCommandApi& api) {
+            // The reply to the previous pipelined write carries this cycle's state. A heartbeat
+            // sent while ensuring the link drains it, in which case the state is requested below.
+            if (api.has_pending()) {
+                const BridgeError pending_error = api.complete_pending_decoded_with_error(decode_state, out);
+                if (pending_error != BridgeError::Unsupported) {
+                    return pending_error;
+                }
+                pipelined_bus_ = false;
+                if (auto logger = resolveLogger(logger_)) {
+                    LOG_WARN(logger,
+                             "firmware rejected SET_JOINT_TARGETS_GET_STATE; falling back to separate bus commands");
+                }
+            }
             return api.request_decoded_with_error(CommandCode::GET_FULL_HARDWARE_STATE, {}, decode_state, out);
         },
         true);
@@ -344,11 +357,17 @@ bool SimpleHardwareBridge::write(const JointTargets& in) {
         return complete_command("write", BridgeError::NotReady, "hardware codec unavailable");
     }
 
+    const bool pipelined = pipelined_bus_;
+    const CommandCode command_code =
+        pipelined ? CommandCode::SET_JOINT_TARGETS_GET_STATE : CommandCode::SET_JOINT_TARGETS;
     const BridgeError command_error = withCommandApi(
         "write",
-        CommandCode::SET_JOINT_TARGETS,
-        [&codec, &in](BridgeCommandApi& api) {
-            return api.request_ack_with_error(CommandCode::SET_JOINT_TARGETS, codec->encode_joint_targets(in));
+        command_code,
+        [&codec, &in, pipelined, command_code](BridgeCommandApi& api) {
+            if (pipelined) {
+                return api.post_with_error(command_code, codec->encode_joint_targets(in));
+            }
+            return api.request_ack_with_error(command_code, codec->encode_joint_targets(in));
         },
         true);
     if (!complete_command("write", command_error, "command execution failed")) {
@@ -359,6 +378,14 @@ bool SimpleHardwareBridge::write(const JointTargets& in) {
     return true;
 }
 
+void SimpleHardwareBridge::set_pipelined_bus(bool enabled) {
+    pipelined_bus_ = enabled;
+}
+
+bool SimpleHardwareBridge::pipelined_bus() const {
+    return pipelined_bus_;
+}
+
 bool SimpleHardwareBridge::set_angle_calibrations(const std::vector<float>& calibs) {
     return complete_command("set_angle_calibrations",
                             send_calibrations_result(calibs),
@@ -309,7 +309,8 @@ bool testTelemetryOverrideOptions()
                                 "--telemetry-publish-hz",
                                 "45.0",
                                 "--telemetry-geometry-resend-sec",
-                                "2.5"};
+                                "2.5",
+                                "--telemetry-binary-stream"};
   std::vector<char*> argv = argvFrom(args);
 
   CliOptions options{};
@@ -330,7 +331,10 @@ bool testTelemetryOverrideOptions()
                 "telemetry-publish-hz should persist rate override") &&
          expect(options.telemetryGeometryResendIntervalSecOverride.has_value() &&
                     options.telemetryGeometryResendIntervalSecOverride.value() == 2.5,
-                "telemetry-geometry-resend-sec should persist resend override");
+                "telemetry-geometry-resend-sec should persist resend override") &&
+         expect(options.telemetryBinaryStreamOverride.has_value() &&
+                    options.telemetryBinaryStreamOverride.value(),
+                "telemetry-binary-stream should set override true");
 }
 
 bool testTelemetryPortRequiresInteger()
@@ -0,0 +1,224 @@
+// Bus-rate benchmark for SimpleHardwareBridge against the real firmware command handlers. The
+// peer is the hexapod-client host-test build: every request is dispatched through
+// `handleActivePacket` as `runCommandLoop` does, and frames travel over a modelled full-duplex
+// UART (8N1, so 10 bit times per byte) on a virtual clock. Rates are therefore wire-limited and
+// deterministic; firmware handler time is not modelled.
+//
+// Each bus cycle is a `read()` followed by a `write()` (the `RobotRuntime::busStep` order) and
+// then `host_work_us` of virtual time the bus thread spends elsewhere (sleeping until the next
+// period, in the runtime). Separate mode pays two round trips per cycle; pipelined mode pays one
+// combined exchange whose transfer overlaps with the host work.
+
+#include "command_dispatch_internal.hpp"
+#include "firmware_context.hpp"
+#include "hardware_bridge.hpp"
+#include "hexapod-common.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr int kBaudRate = 115200;
+constexpr int kCycles = 200;
+
+bool expect(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAIL: " << message << '\n';
+        return false;
+    }
+    return true;
+}
+
+class LoopbackFirmwareEndpoint final : public IPacketEndpoint {
+public:
+    LoopbackFirmwareEndpoint(FirmwareContext& firmware, int baud_rate, bool reject_combined_command)
+        : firmware_(firmware),
+          byte_time_us_(10.0 * 1e6 / static_cast<double>(baud_rate)),
+          reject_combined_command_(reject_combined_command) {}
+
+    void send_packet(uint16_t seq, uint8_t cmd, const std::vector<uint8_t>& payload) override {
+        const double sent_at = std::max(now_us_, host_line_free_us_);
+        const double arrival = sent_at + wireTimeUs(encodePacket(seq, cmd, payload).size());
+        host_line_free_us_ = arrival;
+        ++requests_;
+
+        // The firmware handles requests in arrival order; stamp voltage with the request index so
+        // the host can tell which request a decoded state answers.
+        firmware_.vol_adc.voltage = static_cast<float>(requests_);
+        const DecodedPacket request{seq, cmd, payload};
+        if (reject_combined_command_ && cmd == SET_JOINT_TARGETS_GET_STATE) {
+            firmware_.serial.send_packet(seq, NACK, {UNSUPPORTED_COMMAND});
+        } else if (firmware_.state != HexapodState::ACTIVE) {
+            handleWaitingForHostPacket(firmware_, request);
+        } else {
+            handleActivePacket(firmware_, request);
+        }
+
+        for (const auto& reply : firmware_.serial.sent_packets) {
+            const double reply_start = std::max(arrival, device_line_free_us_);
+            device_line_free_us_ = reply_start + wireTimeUs(encodePacket(reply.seq, reply.cmd, reply.payload).size());
+            replies_.push_back(InFlight{device_line_free_us_, DecodedPacket{reply.seq, reply.cmd, reply.payload}});
+        }
+        firmware_.serial.sent_packets.clear();
+    }
+
+    bool recv_packet(DecodedPacket& packet) override {
+        if (replies_.empty()) {
+            return false;
+        }
+        now_us_ = std::max(now_us_, replies_.front().arrival_us);
+        packet = std::move(replies_.front().packet);
+        replies_.pop_front();
+        return true;
+    }
+
+    void advance(double us) { now_us_ += us; }
+    double now_us() const { return now_us_; }
+    int requests() const { return requests_; }
+
+private:
+    struct InFlight {
+        double arrival_us;
+        DecodedPacket packet;
+    };
+
+    double wireTimeUs(std::size_t frame_bytes) const {
+        return static_cast<double>(frame_bytes) * byte_time_us_;
+    }
+
+    FirmwareContext& firmware_;
+    double byte_time_us_;
+    bool reject_combined_command_;
+    double now_us_{0.0};
+    double host_line_free_us_{0.0};
+    double device_line_free_us_{0.0};
+    int requests_{0};
+    std::deque<InFlight> replies_{};
+};
+
+JointTargets targetsForCycle(int cycle) {
+    JointTargets targets{};
+    for (std::size_t leg = 0; leg < targets.leg_states.size(); ++leg) {
+        for (int joint = 0; joint < kJointsPerLeg; ++joint) {
+            targets.leg_states[leg].joint_state[joint].pos_rad =
+                AngleRad{0.001 * static_cast<double>(cycle) + 0.01 * static_cast<double>(leg * kJointsPerLeg + joint)};
+        }
+    }
+    return targets;
+}
+
+struct BusRun {
+    double cycles_per_s{0.0};
+    double blocked_us_per_cycle{0.0};
+    double requests_per_cycle{0.0};
+    bool pipelined_at_end{false};
+};
+
+bool runBus(const char* label, bool pipelined, double host_work_us, bool reject_combined_command, BusRun& out) {
+    FirmwareContext firmware{};
+    firmware.state = HexapodState::WAITING_FOR_HOST;
+    auto endpoint_owner = std::make_unique<LoopbackFirmwareEndpoint>(firmware, kBaudRate, reject_combined_command);
+    LoopbackFirmwareEndpoint& endpoint = *endpoint_owner;
+    SimpleHardwareBridge bridge(std::move(endpoint_owner));
+    if (!expect(bridge.init(), std::string{label} + ": bridge init against firmware loopback")) {
+        return false;
+    }
+    bridge.set_pipelined_bus(pipelined);
+
+    const double start_us = endpoint.now_us();
+    const int start_requests = endpoint.requests();
+    float previous_tag = 0.0f;
+    JointTargets last_written{};
+    for (int cycle = 0; cycle < kCycles; ++cycle) {
+        RobotState state{};
+        if (!expect(bridge.read(state), std::string{label} + ": read failed")) {
+            return false;
+        }
+        // Separate mode: one GET per read. Pipelined: each read decodes the reply to the previous
+        // cycle's combined request, so the tag advances by exactly the requests sent in between.
+        const float expected_step = bridge.pipelined_bus() ? 1.0f : 2.0f;
+        if (cycle > 1 && !expect(state.voltage - previous_tag == expected_step,
+                                 std::string{label} + ": state does not answer the expected request")) {
+            return false;
+        }
+        previous_tag = state.voltage;
+
+        last_written = targetsForCycle(cycle);
+        if (!expect(bridge.write(last_written), std::string{label} + ": write failed")) {
+            return false;
+        }
+        endpoint.advance(host_work_us);
+    }
+
+    // Drain the last pipelined request so the firmware has applied every written target.
+    RobotState final_state{};
+    if (!expect(bridge.read(final_state), std::string{label} + ": final read failed")) {
+        return false;
+    }
+    const float expected_last = static_cast<float>(last_written.leg_states.back().joint_state.back().pos_rad.value);
+    if (!expect(firmware.jointTargetPositionsRad.back() == expected_last,
+                std::string{label} + ": firmware did not receive the last written targets")) {
+        return false;
+    }
+
+    const double elapsed_us = endpoint.now_us() - start_us;
+    out.cycles_per_s = static_cast<double>(kCycles) * 1e6 / elapsed_us;
+    out.blocked_us_per_cycle = (elapsed_us - host_work_us * kCycles) / kCycles;
+    out.requests_per_cycle = static_cast<double>(endpoint.requests() - start_requests) / kCycles;
+    out.pipelined_at_end = bridge.pipelined_bus();
+
+    std::cout << "  " << std::left << std::setw(38) << label << std::right << std::fixed << std::setprecision(1)
+              << " host_work_us=" << std::setw(7) << host_work_us << " cycles_per_s=" << std::setw(6)
+              << out.cycles_per_s << " blocked_us_per_cycle=" << std::setw(8) << out.blocked_us_per_cycle
+              << " requests_per_cycle=" << std::setprecision(2) << out.requests_per_cycle << '\n';
+    return true;
+}
+
+bool testPipelinedBusRate() {
+    std::cout << "baud=" << kBaudRate << " cycles=" << kCycles << '\n';
+    for (const double host_work_us : {0.0, 5000.0, 20000.0}) {
+        BusRun separate{};
+        BusRun pipelined{};
+        if (!runBus("separate read + write", false, host_work_us, false, separate) ||
+            !runBus("pipelined SET_JOINT_TARGETS_GET_STATE", true, host_work_us, false, pipelined)) {
+            return false;
+        }
+        if (!expect(pipelined.cycles_per_s > separate.cycles_per_s, "pipelined bus should sustain a higher cycle rate") ||
+            !expect(pipelined.blocked_us_per_cycle < separate.blocked_us_per_cycle,
+                    "pipelined bus should block the bus thread for less time per cycle") ||
+            !expect(pipelined.requests_per_cycle < 1.01, "pipelined bus should send one request per cycle") ||
+            !expect(pipelined.pipelined_at_end, "pipelined mode should stay enabled against current firmware")) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool testFallsBackWhenFirmwareRejectsCombinedCommand() {
+    BusRun run{};
+    if (!runBus("older firmware (combined rejected)", true, 0.0, true, run)) {
+        return false;
+    }
+    return expect(!run.pipelined_at_end, "bridge should leave pipelined mode when the firmware rejects it") &&
+           expect(run.requests_per_cycle > 1.9, "fallback should use separate read and write commands");
+}
+
+}  // namespace
+
+int main() {
+    if (!testPipelinedBusRate()) {
+        return EXIT_FAILURE;
+    }
+    if (!testFallsBackWhenFirmwareRejectsCombinedCommand()) {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
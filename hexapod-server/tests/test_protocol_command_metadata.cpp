@@ -40,6 +40,8 @@ bool test_metadata_payload_contracts_match_protocol_constants()
     const CommandMetadata* set_calibrations = find_command_metadata(CommandCode::SET_ANGLE_CALIBRATIONS);
     const CommandMetadata* set_servos_enabled = find_command_metadata(CommandCode::SET_SERVOS_ENABLED);
     const CommandMetadata* set_led_colors = find_command_metadata(CommandCode::SET_LED_COLORS);
+    const CommandMetadata* set_targets_get_state =
+        find_command_metadata(CommandCode::SET_JOINT_TARGETS_GET_STATE);
 
     return expect(set_joint_targets != nullptr &&
                       set_joint_targets->payload_bytes == kProtocolJointTargetsPayloadBytes &&
@@ -56,7 +58,12 @@ bool test_metadata_payload_contracts_match_protocol_constants()
            expect(set_led_colors != nullptr &&
                       set_led_colors->payload_bytes == kProtocolLedColorsPayloadBytes &&
                       set_led_colors->exact_payload_size,
-                  "SET_LED_COLORS contract mismatch");
+                  "SET_LED_COLORS contract mismatch") &&
+           expect(set_targets_get_state != nullptr &&
+                      set_targets_get_state->payload_bytes == kProtocolJointTargetsPayloadBytes &&
+                      set_targets_get_state->exact_payload_size &&
+                      set_targets_get_state->handled_by_firmware_dispatch,
+                  "SET_JOINT_TARGETS_GET_STATE contract mismatch");
 }
 
 
@@ -92,7 +99,7 @@ bool test_firmware_dispatch_coverage_flags()
     const CommandMetadata* heartbeat = find_command_metadata(CommandCode::HEARTBEAT);
     const CommandMetadata* diagnostic = find_command_metadata(CommandCode::DIAGNOSTIC);
 
-    return expect(dispatch_handled_count == 14, "expected firmware dispatch metadata count to match route table") &&
+    return expect(dispatch_handled_count == 15, "expected firmware dispatch metadata count to match route table") &&
            expect(hello != nullptr && !hello->handled_by_firmware_dispatch,
                   "HELLO should be handled by handshake flow, not generic dispatch") &&
            expect(heartbeat != nullptr && !heartbeat->handled_by_firmware_dispatch,
@@ -1,3 +1,4 @@
+#include "replay_binary.hpp"
 #include "replay_json.hpp"
 #include "replay_logger.hpp"
 
@@ -5,8 +6,11 @@
 #include <fstream>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <vector>
 
 namespace {
 
@@ -220,6 +224,57 @@ bool testFileLoggerWritesNdjson()
                   "file logger should end records with newline");
 }
 
+bool testBinaryLogConvertsToMatchingJsonl()
+{
+    const std::string path = "/tmp/hexapod_replay_logging_test.hxrb";
+    std::filesystem::remove(path);
+
+    std::vector<replay_json::ReplayTelemetryRecord> records(3, makeSampleRecord());
+    records[0].terrain_snapshot.elevation_ground_mean_z.max_hit_z_m[1] = std::numeric_limits<double>::quiet_NaN();
+    records[1] = records[0];
+    records[1].timestamp_us = TimePointUs{123'500};
+    records[1].sample_id = 78;
+    records[1].gait_state.phase[2] = 0.45;
+    records[2] = records[1];
+    records[2].timestamp_us = TimePointUs{123'600};
+    records[2].sample_id = 79;
+    records[2].terrain_snapshot.inflated.cells[1] = LocalMapCellState::Occupied;
+    {
+        auto logger = replay::makeBinaryReplayLogger(path, nullptr);
+        for (const auto& record : records) {
+            logger->write(record);
+        }
+    }
+
+    replay_binary::ReplayBinaryReader reader;
+    std::string error;
+    if (!expect(reader.open(path, &error), "binary replay log should open: " + error) ||
+        !expect(reader.frameCount() == records.size(), "binary replay log should index every frame") ||
+        !expect(reader.gridChunkCount() == 5, "grids should only be stored when they change") ||
+        !expect(!reader.truncated(), "complete binary replay log should not be truncated") ||
+        !expect(reader.frameAtOrAfter(TimePointUs{123'550}) == 2, "timestamp lookup should find the next frame")) {
+        return false;
+    }
+
+    replay_json::ReplayTelemetryRecord decoded{};
+    if (!expect(reader.read(1, decoded), "random access read should succeed") ||
+        !expect(replay_json::serializeReplayTelemetryRecord(decoded) ==
+                    replay_json::serializeReplayTelemetryRecord(records[1]),
+                "random access read should reproduce the logged record")) {
+        return false;
+    }
+
+    std::ostringstream converted;
+    if (!expect(replay_binary::convertReplayBinaryToJsonl(path, converted, &error), "conversion should succeed")) {
+        return false;
+    }
+    std::string expected;
+    for (const auto& record : records) {
+        expected += replay_json::serializeReplayTelemetryRecord(record) + '\n';
+    }
+    return expect(converted.str() == expected, "converted JSONL should match the JSON serializer line for line");
+}
+
 } // namespace
 
 int main()
@@ -230,5 +285,8 @@ int main()
     if (!testFileLoggerWritesNdjson()) {
         return EXIT_FAILURE;
     }
+    if (!testBinaryLogConvertsToMatchingJsonl()) {
+        return EXIT_FAILURE;
+    }
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,280 @@
+// Contention microbenchmark for the RobotRuntime cross-loop buffers. Bus, estimator and control
+// threads run flat out with the runtime's access pattern:
+//   bus:       writes raw state, reads joint targets
+//   estimator: reads raw state, writes estimated state
+//   control:   reads estimated + raw state and the previous joint targets, writes joint targets
+// Every read is timed. The same workload runs against a mutex double buffer (the previous
+// exchange: copy under a lock shared with the writer) and against `SnapshotBuffer` views.
+// Payloads are stamped so a torn read fails the test; timings are reported, not asserted.
+
+#include "snapshot_buffer.hpp"
+#include "types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using BenchClock = std::chrono::steady_clock;
+
+bool expect(bool condition, const std::string& message) {
+    if (!condition) {
+        std::cerr << "FAIL: " << message << '\n';
+        return false;
+    }
+    return true;
+}
+
+// The exchange RobotRuntime used before `SnapshotBuffer`: copy-out reads under a mutex.
+template <typename T>
+class MutexDoubleBuffer {
+public:
+    void write(const T& value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const std::size_t next_index = read_index_ ^ 1U;
+        buffers_[next_index] = value;
+        read_index_ = next_index;
+    }
+
+    [[nodiscard]] T read() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return buffers_[read_index_];
+    }
+
+private:
+    T buffers_[2]{};
+    std::size_t read_index_{0};
+    mutable std::mutex mutex_;
+};
+
+void stamp(RobotState& state, uint64_t sequence) {
+    state.sample_id = sequence;
+    state.timestamp_us = TimePointUs{sequence};
+    state.matrix_lidar.ranges_mm.fill(static_cast<std::uint16_t>(sequence));
+    state.has_matrix_lidar = true;
+}
+
+bool consistent(const RobotState& state) {
+    const auto expected = static_cast<std::uint16_t>(state.sample_id);
+    return state.timestamp_us.value == state.sample_id && state.matrix_lidar.ranges_mm.front() == expected &&
+           state.matrix_lidar.ranges_mm.back() == expected;
+}
+
+void stamp(JointTargets& targets, uint64_t sequence) {
+    for (LegState& leg : targets.leg_states) {
+        for (JointState& joint : leg.joint_state) {
+            joint.pos_rad = AngleRad{static_cast<double>(sequence)};
+        }
+    }
+}
+
+bool consistent(const JointTargets& targets) {
+    const double expected = targets.leg_states.front().joint_state.front().pos_rad.value;
+    return targets.leg_states.back().joint_state.back().pos_rad.value == expected;
+}
+
+// Adapters so one workload drives both exchanges: `access` hands the reader a reference that is
+// valid for the duration of the callback (a copy for the mutex buffer, a pinned view otherwise).
+template <typename T>
+struct MutexExchange {
+    MutexDoubleBuffer<T> buffer;
+
+    void write(const T& value) { buffer.write(value); }
+
+    template <typename Fn>
+    void access(Fn&& fn) const {
+        const T copy = buffer.read();
+        fn(copy);
+    }
+};
+
+template <typename T>
+struct SnapshotExchange {
+    SnapshotBuffer<T> buffer;
+
+    void write(const T& value) { buffer.write(value); }
+
+    template <typename Fn>
+    void access(Fn&& fn) const {
+        const auto view = buffer.view();
+        fn(*view);
+    }
+};
+
+struct ReadLatency {
+    std::vector<uint32_t> samples_ns;
+
+    template <typename Exchange, typename Check>
+    bool timedRead(const Exchange& exchange, Check&& check) {
+        bool ok = true;
+        const auto start = BenchClock::now();
+        exchange.access([&](const auto& value) { ok = check(value); });
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(BenchClock::now() - start).count();
+        if (samples_ns.size() < samples_ns.capacity()) {
+            samples_ns.push_back(static_cast<uint32_t>(std::min<int64_t>(elapsed, UINT32_MAX)));
+        }
+        return ok;
+    }
+};
+
+struct Summary {
+    uint64_t reads{0};
+    uint32_t p50_ns{0};
+    uint32_t p99_ns{0};
+    uint32_t p999_ns{0};
+    uint32_t max_ns{0};
+};
+
+Summary summarize(std::vector<uint32_t> samples) {
+    Summary summary{};
+    if (samples.empty()) {
+        return summary;
+    }
+    std::sort(samples.begin(), samples.end());
+    const auto at = [&](double quantile) {
+        const auto index = static_cast<std::size_t>(quantile * static_cast<double>(samples.size() - 1));
+        return samples[index];
+    };
+    summary.reads = samples.size();
+    summary.p50_ns = at(0.50);
+    summary.p99_ns = at(0.99);
+    summary.p999_ns = at(0.999);
+    summary.max_ns = samples.back();
+    return summary;
+}
+
+template <template <typename> class Exchange>
+bool runWorkload(std::string_view label, std::chrono::milliseconds duration) {
+    Exchange<RobotState> raw_state;
+    Exchange<RobotState> estimated_state;
+    Exchange<JointTargets> joint_targets;
+
+    constexpr std::size_t kMaxSamplesPerThread = 1U << 20U;
+    ReadLatency bus_reads;
+    ReadLatency estimator_reads;
+    ReadLatency control_reads;
+    bus_reads.samples_ns.reserve(kMaxSamplesPerThread);
+    estimator_reads.samples_ns.reserve(kMaxSamplesPerThread);
+    control_reads.samples_ns.reserve(kMaxSamplesPerThread * 3U);
+
+    std::atomic<bool> running{true};
+    std::atomic<bool> torn{false};
+    const auto check_state = [](const RobotState& state) { return consistent(state); };
+    const auto check_targets = [](const JointTargets& targets) { return consistent(targets); };
+
+    std::thread bus([&]() {
+        RobotState raw{};
+        for (uint64_t sequence = 1; running.load(std::memory_order_relaxed); ++sequence) {
+            stamp(raw, sequence);
+            raw_state.write(raw);
+            if (!bus_reads.timedRead(joint_targets, check_targets)) {
+                torn.store(true);
+            }
+        }
+    });
+    std::thread estimator([&]() {
+        RobotState est{};
+        while (running.load(std::memory_order_relaxed)) {
+            uint64_t sequence = 0;
+            if (!estimator_reads.timedRead(raw_state, [&](const RobotState& raw) {
+                    sequence = raw.sample_id;
+                    return consistent(raw);
+                })) {
+                torn.store(true);
+            }
+            stamp(est, sequence);
+            estimated_state.write(est);
+        }
+    });
+    std::thread control([&]() {
+        JointTargets targets{};
+        for (uint64_t sequence = 1; running.load(std::memory_order_relaxed); ++sequence) {
+            const bool ok = control_reads.timedRead(estimated_state, check_state) &&
+                            control_reads.timedRead(raw_state, check_state) &&
+                            control_reads.timedRead(joint_targets, check_targets);
+            if (!ok) {
+                torn.store(true);
+            }
+            stamp(targets, sequence);
+            joint_targets.write(targets);
+        }
+    });
+
+    std::this_thread::sleep_for(duration);
+    running.store(false);
+    bus.join();
+    estimator.join();
+    control.join();
+
+    const auto print = [&](std::string_view thread_name, const ReadLatency& latency) {
+        const Summary summary = summarize(latency.samples_ns);
+        std::cout << "  " << std::left << std::setw(10) << thread_name << std::right << " reads=" << std::setw(8)
+                  << summary.reads << " p50_ns=" << std::setw(6) << summary.p50_ns << " p99_ns=" << std::setw(6)
+                  << summary.p99_ns << " p99.9_ns=" << std::setw(7) << summary.p999_ns << " max_ns=" << std::setw(8)
+                  << summary.max_ns << '\n';
+    };
+    std::cout << label << ":\n";
+    print("bus", bus_reads);
+    print("estimator", estimator_reads);
+    print("control", control_reads);
+
+    return expect(!torn.load(), std::string{label} + ": reader observed a torn snapshot") &&
+           expect(!control_reads.samples_ns.empty() && !estimator_reads.samples_ns.empty(),
+                  std::string{label} + ": reader threads made no progress");
+}
+
+bool testViewPinsSlotAcrossWrites() {
+    SnapshotBuffer<RobotState, 3> buffer;
+    RobotState state{};
+    stamp(state, 1);
+    buffer.write(state);
+
+    const auto pinned = buffer.view();
+    for (uint64_t sequence = 2; sequence < 64; ++sequence) {
+        stamp(state, sequence);
+        buffer.write(state);
+    }
+    const auto latest = buffer.view();
+    return expect(pinned->sample_id == 1 && consistent(*pinned), "pinned view must not change under later writes") &&
+           expect(latest->sample_id == 63 && consistent(*latest), "new view must observe the latest write") &&
+           expect(buffer.read().sample_id == 63, "read() must copy the latest write");
+}
+
+std::chrono::milliseconds parseDuration(int argc, char** argv) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::string_view{argv[i]} == "--duration-ms") {
+            return std::chrono::milliseconds{std::max(1, std::atoi(argv[i + 1]))};
+        }
+    }
+    return std::chrono::milliseconds{300};
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (!testViewPinsSlotAcrossWrites()) {
+        return EXIT_FAILURE;
+    }
+    const std::chrono::milliseconds duration = parseDuration(argc, argv);
+    // With fewer hardware threads than workload threads, max_ns is dominated by preemption.
+    std::cout << "hardware_threads=" << std::thread::hardware_concurrency() << " duration_ms=" << duration.count()
+              << '\n';
+    if (!runWorkload<MutexExchange>("mutex double buffer (copy under lock)", duration)) {
+        return EXIT_FAILURE;
+    }
+    if (!runWorkload<SnapshotExchange>("snapshot buffer (pinned view)", duration)) {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
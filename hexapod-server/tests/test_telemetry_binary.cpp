@@ -0,0 +1,160 @@
+#include "math_types.hpp"
+#include "telemetry_binary.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+bool expect(const bool condition, const std::string& message)
+{
+    if (!condition) {
+        std::cerr << "FAIL: " << message << '\n';
+        return false;
+    }
+    return true;
+}
+
+bool near(const double a, const double b, const double tol = 1e-4)
+{
+    return std::abs(a - b) <= tol;
+}
+
+telemetry::ControlFrameTelemetry makeFrame()
+{
+    telemetry::ControlFrameTelemetry frame{};
+    frame.timestamp_us = TimePointUs{1'234'567};
+    frame.status.active_mode = RobotMode::WALK;
+    frame.status.active_fault = FaultCode::TIP_OVER;
+    frame.status.bus_ok = true;
+    frame.status.estimator_valid = false;
+    frame.status.loop_counter = 4242;
+    frame.estimated_state.voltage = 11.5f;
+    frame.estimated_state.current = 2.25f;
+    for (int leg = 0; leg < kNumLegs; ++leg) {
+        for (int joint = 0; joint < kJointsPerLeg; ++joint) {
+            // Commanded angle encodes (leg, joint) so the visualiser reordering is observable.
+            frame.joint_targets.leg_states[leg].joint_state[joint].pos_rad =
+                AngleRad{0.01 * static_cast<double>(10 * leg + joint)};
+            frame.estimated_state.leg_states[leg].joint_state[joint].pos_rad =
+                AngleRad{-0.01 * static_cast<double>(10 * leg + joint)};
+        }
+    }
+    frame.estimated_state.foot_contacts[static_cast<std::size_t>(LegID::R1)] = true;
+    frame.estimated_state.foot_contact_fusion[static_cast<std::size_t>(LegID::R1)].phase = ContactPhase::ConfirmedStance;
+    frame.estimated_state.foot_contact_fusion[static_cast<std::size_t>(LegID::R1)].confidence = 0.75f;
+    frame.estimated_state.has_body_twist_state = true;
+    frame.estimated_state.body_twist_state.body_trans_m = PositionM3{0.1, -0.2, 0.15};
+    frame.estimated_state.body_twist_state.twist_pos_rad = EulerAnglesRad3{0.01, 0.02, 1.5};
+    return frame;
+}
+
+bool test_control_frame_round_trip()
+{
+    using namespace hexapod_telemetry;
+    const telemetry::ControlFrameTelemetry frame = makeFrame();
+    std::vector<std::uint8_t> datagram;
+    EncodeControlFrame(datagram, telemetry_binary::makeControlFrameBody(frame, 77));
+
+    TelemetryControlFrameBody decoded{};
+    const bool ok = expect(datagram.size() == sizeof(TelemetryWireHeader) + sizeof(TelemetryControlFrameBody),
+                           "control frame datagram should be header plus body") &&
+                    expect(IsTelemetryBinaryPayload(datagram.data(), datagram.size()),
+                           "control frame should carry the HXT1 magic") &&
+                    expect(DecodeMessage(datagram.data(), datagram.size(), TelemetryMessageKind::ControlFrame, decoded),
+                           "control frame should decode as a control frame");
+    if (!ok) {
+        return false;
+    }
+
+    // Visualiser leg order is LF, LM, LR, RF, RM, RR; index 3 (RF) is LegID::R1.
+    const std::size_t rf = 3;
+    const double r1_coxa_deg = rad2deg(0.01 * 10.0 * static_cast<double>(LegID::R1));
+    return expect(decoded.timestamp_us == 1'234'567, "timestamp should round-trip") &&
+           expect(decoded.sequence == 77, "sequence should round-trip") &&
+           expect(decoded.loop_counter == 4242, "loop counter should round-trip") &&
+           expect(decoded.active_mode == static_cast<std::uint8_t>(RobotMode::WALK), "mode should round-trip") &&
+           expect(decoded.active_fault == static_cast<std::uint8_t>(FaultCode::TIP_OVER), "fault should round-trip") &&
+           expect(decoded.flags == (kFrameFlagBusOk | kFrameFlagHasBodyPose), "flags should reflect bus/estimator/pose") &&
+           expect(decoded.contact_mask == (1u << rf), "contact mask should use visualiser leg order") &&
+           expect(decoded.contact_phase[rf] == static_cast<std::uint8_t>(ContactPhase::ConfirmedStance),
+                  "contact phase should use visualiser leg order") &&
+           expect(near(decoded.contact_confidence[rf], 0.75), "contact confidence should round-trip") &&
+           expect(near(decoded.commanded_angles_deg[rf][0], r1_coxa_deg), "commanded angles should be degrees in visualiser order") &&
+           expect(near(decoded.measured_angles_deg[rf][0], -r1_coxa_deg), "measured angles should be degrees in visualiser order") &&
+           expect(near(decoded.voltage, 11.5) && near(decoded.current, 2.25), "voltage/current should round-trip") &&
+           expect(near(decoded.body_position_m.y, -0.2) && near(decoded.body_orientation_rad.z, 1.5),
+                  "body pose should round-trip");
+}
+
+bool test_summaries_round_trip()
+{
+    using namespace hexapod_telemetry;
+    RobotState est{};
+    est.has_fusion_diagnostics = true;
+    est.fusion.model_trust = 0.6;
+    est.fusion.predictive_mode = true;
+    est.fusion.residuals.contact_mismatch_ratio = 0.25;
+
+    NavigationMonitorSnapshot nav{};
+    nav.active = true;
+    nav.map_fresh = true;
+    nav.replan_count = 3;
+    nav.nearest_obstacle_distance_m = 0.8;
+
+    std::vector<std::uint8_t> datagram;
+    EncodeFusionSummary(datagram, telemetry_binary::makeFusionSummaryBody(est, TimePointUs{10}));
+    TelemetryFusionSummaryBody fusion{};
+    TelemetryControlFrameBody wrong_kind{};
+    const bool fusion_ok =
+        expect(DecodeMessage(datagram.data(), datagram.size(), TelemetryMessageKind::FusionSummary, fusion),
+               "fusion summary should decode") &&
+        expect(!DecodeMessage(datagram.data(), datagram.size(), TelemetryMessageKind::ControlFrame, wrong_kind),
+               "fusion summary should not decode as a control frame") &&
+        expect(fusion.flags == (kFusionFlagHasData | kFusionFlagPredictiveMode), "fusion flags should round-trip") &&
+        expect(near(fusion.model_trust, 0.6) && near(fusion.contact_mismatch_ratio, 0.25),
+               "fusion residuals should round-trip");
+
+    EncodeNavigationSummary(datagram, telemetry_binary::makeNavigationSummaryBody(nav, TimePointUs{20}));
+    TelemetryNavigationSummaryBody decoded_nav{};
+    return fusion_ok &&
+           expect(DecodeMessage(datagram.data(), datagram.size(), TelemetryMessageKind::NavigationSummary, decoded_nav),
+                  "navigation summary should decode") &&
+           expect(decoded_nav.timestamp_us == 20, "navigation timestamp should round-trip") &&
+           expect(decoded_nav.flags == (kNavFlagMapFresh | kNavFlagActive), "navigation flags should round-trip") &&
+           expect(decoded_nav.replan_count == 3, "replan count should round-trip") &&
+           expect(near(decoded_nav.nearest_obstacle_distance_m, 0.8), "obstacle distance should round-trip");
+}
+
+bool test_rejects_truncated_and_foreign_payloads()
+{
+    using namespace hexapod_telemetry;
+    std::vector<std::uint8_t> datagram;
+    EncodeControlFrame(datagram, telemetry_binary::makeControlFrameBody(makeFrame(), 1));
+    TelemetryControlFrameBody decoded{};
+    const std::string json = "{\"type\":\"joints\"}";
+    return expect(!DecodeMessage(datagram.data(), datagram.size() - 1, TelemetryMessageKind::ControlFrame, decoded),
+                  "truncated control frame should be rejected") &&
+           expect(!IsTelemetryBinaryPayload(json.data(), json.size()), "JSON packets should not match the binary magic");
+}
+
+} // namespace
+
+int main()
+{
+    if (!test_control_frame_round_trip()) {
+        return EXIT_FAILURE;
+    }
+    if (!test_summaries_round_trip()) {
+        return EXIT_FAILURE;
+    }
+    if (!test_rejects_truncated_and_foreign_payloads()) {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
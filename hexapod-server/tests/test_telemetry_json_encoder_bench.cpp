@@ -0,0 +1,271 @@
+// Microbenchmark for the UDP telemetry and replay JSON encoders. A fully populated control step
+// (navigation, process resources, resource sections, fused contacts on every leg) and a replay record
+// with a 40x40 terrain patch are encoded repeatedly two ways:
+//   serialize: `serialize*` returning a fresh std::string per packet
+//   writer:    `write*` into one reused `JsonWriter`, as UdpTelemetryPublisher and the replay loggers do
+// Heap allocations are counted through a replaced global operator new. Reported per packet: ns and
+// allocations. The reused-writer path must not allocate in steady state; timings are not asserted.
+
+#include "json_writer.hpp"
+#include "replay_json.hpp"
+#include "telemetry_json.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <string_view>
+
+namespace {
+
+std::atomic<std::uint64_t> g_allocations{0};
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace {
+
+using BenchClock = std::chrono::steady_clock;
+
+bool expect(bool condition, const std::string& message)
+{
+    if (!condition) {
+        std::cerr << "FAIL: " << message << '\n';
+        return false;
+    }
+    return true;
+}
+
+telemetry::ControlStepTelemetry makeControlStep()
+{
+    telemetry::ControlStepTelemetry sample{};
+    sample.timestamp_us = TimePointUs{987'654'321};
+    sample.status.loop_counter = 123'456;
+    sample.status.active_mode = RobotMode::WALK;
+    sample.status.bus_ok = true;
+    sample.status.estimator_valid = true;
+    sample.estimated_state.voltage = 11.83f;
+    sample.estimated_state.current = 2.41f;
+    sample.estimated_state.has_body_twist_state = true;
+    sample.estimated_state.body_twist_state.body_trans_m = PositionM3{0.0123, -0.0456, 0.1372};
+    sample.estimated_state.body_twist_state.twist_pos_rad = EulerAnglesRad3{0.0132, -0.0217, 0.7311};
+    sample.estimated_state.has_fusion_diagnostics = true;
+    sample.estimated_state.fusion.model_trust = 0.83;
+    for (int leg = 0; leg < kNumLegs; ++leg) {
+        const auto index = static_cast<std::size_t>(leg);
+        const double phase = 0.37 * static_cast<double>(leg + 1);
+        for (int joint = 0; joint < kJointsPerLeg; ++joint) {
+            const double angle = 0.11 * phase + 0.173 * static_cast<double>(joint);
+            sample.joint_targets.leg_states[index].joint_state[static_cast<std::size_t>(joint)].pos_rad =
+                AngleRad{angle};
+            sample.estimated_state.leg_states[index].joint_state[static_cast<std::size_t>(joint)].pos_rad =
+                AngleRad{angle - 0.0031};
+        }
+        sample.estimated_state.foot_contacts[index] = (leg % 2) == 0;
+        sample.estimated_state.joint_state_quality[index].source = JointStateSource::Measured;
+        sample.estimated_state.joint_state_quality[index].position_valid = true;
+        sample.estimated_state.joint_state_quality[index].age_us = 850 + static_cast<std::uint64_t>(leg);
+        sample.estimated_state.joint_state_quality[index].confidence = 0.93;
+        sample.estimated_state.foot_contact_fusion[index].phase =
+            (leg % 2) == 0 ? ContactPhase::ConfirmedStance : ContactPhase::Swing;
+        sample.estimated_state.foot_contact_fusion[index].confidence = 0.871f;
+
+        telemetry::LocomotionDebugSnapshot& debug = sample.locomotion_debug;
+        debug.planned_stance[index] = (leg % 2) == 0;
+        debug.fused_support[index] = (leg % 2) == 0;
+        debug.fused_contact_phase[index] = static_cast<std::uint8_t>(leg % 4);
+        debug.fused_contact_confidence[index] = 0.8713 + 0.01 * phase;
+        debug.measured_foot_body_m[index] = Vec3{0.1821 * phase, -0.1337, -0.1412};
+        debug.measured_foot_world_m[index] = Vec3{0.2124 * phase, 0.0931, 0.0017};
+        debug.commanded_foot_body_m[index] = Vec3{0.1819 * phase, -0.1341, -0.1409};
+        debug.commanded_foot_world_m[index] = Vec3{0.2121 * phase, 0.0934, 0.0021};
+        debug.planned_leg_target_body_m[index] = Vec3{0.1811 * phase, -0.1344, -0.1401};
+        debug.post_clamp_fk_body_m[index] = Vec3{0.1809 * phase, -0.1347, -0.1399};
+        debug.post_clamp_fk_vel_body_mps[index] = Vec3{0.0312, -0.0021, 0.0007};
+        debug.contact_anchor_world_m[index] = Vec3{0.2119 * phase, 0.0929, 0.0};
+        debug.contact_anchor_drift_m[index] = 0.0013 * phase;
+        debug.contact_anchor_max_drift_m[index] = 0.0021 * phase;
+        debug.commanded_tracking_error_m[index] = 0.0047 * phase;
+        debug.post_clamp_distortion_m[index] = 0.0009 * phase;
+        debug.post_clamp_distortion_mps[index] = 0.0112 * phase;
+        debug.contact_anchor_valid[index] = (leg % 2) == 0;
+        sample.locomotion_feasibility.lift_clearance_m[index] = 0.0173 * phase;
+        sample.locomotion_feasibility.safe_to_lift[index] = (leg % 2) != 0;
+    }
+    sample.locomotion_debug.valid = true;
+    sample.locomotion_debug.min_measured_foot_world_z_m = -0.0017;
+    sample.locomotion_debug.max_commanded_tracking_error_m = 0.0121;
+    sample.navigation = NavigationMonitorSnapshot{};
+    sample.navigation->active_segment_length_m = 1.734;
+    sample.navigation->nearest_obstacle_distance_m = 0.912;
+    sample.process_resources = resource_monitoring::ProcessResourceSnapshot{
+        .cpu_percent = 37.52,
+        .cpu_window_us = 1'250'000,
+        .rss_bytes = 9'876'543,
+        .vms_bytes = 123'456'789,
+    };
+    telemetry::ResourceSectionSummary sections{};
+    sections.count = std::min<std::size_t>(4, sections.sections.size());
+    constexpr const char* kLabels[] = {"control.pipeline", "control.gait", "control.ik", "estimator.fusion"};
+    for (std::size_t i = 0; i < sections.count; ++i) {
+        sections.sections[i] = resource_monitoring::ResourceSectionSnapshot{
+            .label = kLabels[i],
+            .total_self_ns = 123'456'789 + i,
+            .window_self_ns = 45'678 + i,
+            .max_self_ns = 12'345 + i,
+            .call_count = 98'765 + i,
+        };
+    }
+    sample.resource_sections = sections;
+    sample.governor.severity = 0.4217;
+    sample.governor.command_scale = 0.8813;
+    sample.governor.current_support_count = 4;
+    sample.governor_config = control_config::CommandGovernorConfig{};
+    sample.locomotion_feasibility.valid = true;
+    sample.locomotion_feasibility.nominal_margin_m = 0.0412;
+    sample.locomotion_feasibility.actual_margin_m = 0.0377;
+    sample.epoch.control_seq_id = 123'456;
+    sample.epoch.raw_timestamp_us = 987'650'000;
+    sample.epoch.est_timestamp_us = 987'651'000;
+    sample.epoch.raw_valid = true;
+    sample.epoch.est_valid = true;
+    return sample;
+}
+
+replay_json::ReplayTelemetryRecord makeReplayRecord(const telemetry::ControlStepTelemetry& step)
+{
+    replay_json::ReplayTelemetryRecord record{};
+    record.timestamp_us = step.timestamp_us;
+    record.sample_id = 4242;
+    record.status = step.status;
+    record.governor = step.governor;
+    record.estimated_state = step.estimated_state;
+    record.joint_targets = step.joint_targets;
+    record.locomotion_debug = step.locomotion_debug;
+    record.locomotion_feasibility = step.locomotion_feasibility;
+    LocalOccupancyGrid grid{};
+    grid.width_cells = 40;
+    grid.height_cells = 40;
+    grid.resolution_m = 0.05;
+    grid.cells.assign(40 * 40, LocalMapCellState::Free);
+    for (std::size_t i = 0; i < grid.cells.size(); i += 7) {
+        grid.cells[i] = LocalMapCellState::Occupied;
+    }
+    record.terrain_snapshot.raw = grid;
+    record.terrain_snapshot.inflated = grid;
+    return record;
+}
+
+struct EncodeStats {
+    double ns_per_packet{0.0};
+    double allocations_per_packet{0.0};
+    std::size_t bytes{0};
+};
+
+template <typename Encode>
+EncodeStats measure(int iterations, Encode&& encode)
+{
+    // Warm-up: lets the reused writer reach its high-water capacity before counting.
+    for (int i = 0; i < 8; ++i) {
+        encode();
+    }
+    const std::uint64_t allocations_before = g_allocations.load(std::memory_order_relaxed);
+    std::size_t bytes = 0;
+    const auto start = BenchClock::now();
+    for (int i = 0; i < iterations; ++i) {
+        bytes = encode();
+    }
+    const auto elapsed = std::chrono::duration<double, std::nano>(BenchClock::now() - start).count();
+    const std::uint64_t allocations = g_allocations.load(std::memory_order_relaxed) - allocations_before;
+    return EncodeStats{elapsed / iterations, static_cast<double>(allocations) / iterations, bytes};
+}
+
+void report(std::string_view label, const EncodeStats& stats)
+{
+    std::cout << "  " << std::left << std::setw(28) << label << std::right << " bytes=" << std::setw(6)
+              << stats.bytes << " ns/packet=" << std::setw(9) << std::fixed << std::setprecision(0)
+              << stats.ns_per_packet << " allocations/packet=" << std::setprecision(2)
+              << stats.allocations_per_packet << '\n';
+}
+
+int parseIterations(int argc, char** argv)
+{
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::string_view{argv[i]} == "--iterations") {
+            return std::max(1, std::atoi(argv[i + 1]));
+        }
+    }
+    return 2000;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const int iterations = parseIterations(argc, argv);
+    const telemetry::ControlStepTelemetry step = makeControlStep();
+    const replay_json::ReplayTelemetryRecord record = makeReplayRecord(step);
+
+    JsonWriter writer;
+    telemetry_json::writeControlStepPacket(writer, step);
+    const std::string serialized = telemetry_json::serializeControlStepPacket(step);
+    if (!expect(writer.view() == serialized, "writer and serialize paths should emit identical control steps")) {
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "iterations=" << iterations << "\ncontrol step (UDP telemetry):\n";
+    const EncodeStats control_serialize = measure(iterations, [&] {
+        return telemetry_json::serializeControlStepPacket(step).size();
+    });
+    const EncodeStats control_writer = measure(iterations, [&] {
+        writer.clear();
+        telemetry_json::writeControlStepPacket(writer, step);
+        return writer.size();
+    });
+    report("serialize (fresh string)", control_serialize);
+    report("writer (reused buffer)", control_writer);
+
+    std::cout << "replay record (JSONL logger):\n";
+    JsonWriter replay_writer;
+    const EncodeStats replay_serialize = measure(iterations, [&] {
+        return replay_json::serializeReplayTelemetryRecord(record).size();
+    });
+    const EncodeStats replay_reused = measure(iterations, [&] {
+        replay_writer.clear();
+        replay_json::writeReplayTelemetryRecord(replay_writer, record);
+        return replay_writer.size();
+    });
+    report("serialize (fresh string)", replay_serialize);
+    report("writer (reused buffer)", replay_reused);
+
+    if (!expect(control_writer.allocations_per_packet == 0.0, "reused writer should not allocate per control step") ||
+        !expect(replay_reused.allocations_per_packet == 0.0, "reused writer should not allocate per replay record")) {
+        return EXIT_FAILURE;
+    }
+    std::cout << "test_telemetry_json_encoder_bench ok\n";
+    return EXIT_SUCCESS;
+}
@@ -2,12 +2,39 @@ from __future__ import annotations
 
 import asyncio
 import json
+import struct
 from typing import Any, Callable
 
 from runtime_support import Diagnostics, GEOMETRY_KEYS, LEG_KEYS, TelemetryState, log_event
 
 EXPECTED_SCHEMA_VERSION = 1
 
+# Binary stream from hexapod-server (hexapod-common/include/hexapod_telemetry_protocol.hpp).
+# Layouts mirror the packed little-endian C++ structs; keep them in sync with that header.
+TELEMETRY_BINARY_MAGIC = b"HXT1"
+TELEMETRY_BINARY_WIRE_VERSION = 1
+TELEMETRY_BINARY_KIND_CONTROL_FRAME = 0
+TELEMETRY_BINARY_KIND_FUSION_SUMMARY = 1
+TELEMETRY_BINARY_KIND_NAVIGATION_SUMMARY = 2
+_BINARY_HEADER = struct.Struct("<4sHBB")
+_BINARY_CONTROL_FRAME = struct.Struct("<QIIBBBBff18f18f3f3f6B2x6f")
+_BINARY_LEG_ORDER = ("LF", "LM", "LR", "RF", "RM", "RR")
+_BINARY_FLAG_BUS_OK = 1 << 0
+_BINARY_FLAG_ESTIMATOR_VALID = 1 << 1
+# RobotMode / FaultCode enum order in hexapod-server types.hpp, named as in the JSON packets.
+_ROBOT_MODE_NAMES = ("SAFE_IDLE", "HOMING", "STAND", "WALK", "FAULT")
+_FAULT_CODE_NAMES = (
+    "NONE",
+    "BUS_TIMEOUT",
+    "ESTOP",
+    "TIP_OVER",
+    "ESTIMATOR_INVALID",
+    "MOTOR_FAULT",
+    "JOINT_LIMIT",
+    "COMMAND_TIMEOUT",
+    "BODY_COLLAPSE",
+)
+
 
 class UdpTelemetryProtocol(asyncio.DatagramProtocol):
     def __init__(self, state: TelemetryState, diagnostics: Diagnostics, on_update: Callable[[], None]):
@@ -17,6 +44,9 @@ class UdpTelemetryProtocol(asyncio.DatagramProtocol):
 
     def datagram_received(self, data: bytes, addr):
         self.diagnostics.udp_received += 1
+        if data.startswith(TELEMETRY_BINARY_MAGIC):
+            self._binary_datagram_received(data, addr)
+            return
         try:
             message = json.loads(data.decode("utf-8"))
         except (json.JSONDecodeError, UnicodeDecodeError):
@@ -42,6 +72,35 @@ class UdpTelemetryProtocol(asyncio.DatagramProtocol):
             )
             return
 
+        self._apply_message(message)
+
+    def _binary_datagram_received(self, data: bytes, addr) -> None:
+        if len(data) < _BINARY_HEADER.size:
+            self.diagnostics.udp_rejected += 1
+            log_event("warning", "udp_rejected", reason="binary_truncated", addr=addr)
+            return
+        _, wire_version, kind, _ = _BINARY_HEADER.unpack_from(data)
+        if wire_version != TELEMETRY_BINARY_WIRE_VERSION:
+            self.diagnostics.udp_rejected += 1
+            log_event(
+                "warning",
+                "udp_rejected",
+                reason="binary_wire_version_mismatch",
+                received_wire_version=wire_version,
+                expected_wire_version=TELEMETRY_BINARY_WIRE_VERSION,
+                addr=addr,
+            )
+            return
+        if kind in (TELEMETRY_BINARY_KIND_FUSION_SUMMARY, TELEMETRY_BINARY_KIND_NAVIGATION_SUMMARY):
+            # Valid, but TelemetryState carries no fusion/navigation fields to update.
+            return
+        if kind != TELEMETRY_BINARY_KIND_CONTROL_FRAME or len(data) < _BINARY_HEADER.size + _BINARY_CONTROL_FRAME.size:
+            self.diagnostics.udp_rejected += 1
+            log_event("warning", "udp_rejected", reason="binary_unknown_or_truncated", kind=kind, addr=addr)
+            return
+        self._apply_message(decode_binary_control_frame(data))
+
+    def _apply_message(self, message: dict[str, Any]) -> None:
         changed = False
 
         geometry = message.get("geometry")
@@ -146,6 +205,29 @@ class UdpTelemetryProtocol(asyncio.DatagramProtocol):
         return sanitized
 
 
+def decode_binary_control_frame(data: bytes) -> dict[str, Any]:
+    """Converts a binary control frame into the equivalent JSON `joints` message fields."""
+    fields = _BINARY_CONTROL_FRAME.unpack_from(data, _BINARY_HEADER.size)
+    timestamp_us, _sequence, loop_counter, mode, fault, flags = fields[:6]
+    voltage, current = fields[7:9]
+    commanded = fields[9:27]
+    return {
+        "type": "joints",
+        "schema_version": EXPECTED_SCHEMA_VERSION,
+        "timestamp_ms": timestamp_us // 1000,
+        "loop_counter": loop_counter,
+        "active_mode": _ROBOT_MODE_NAMES[mode] if mode < len(_ROBOT_MODE_NAMES) else "UNKNOWN",
+        "active_fault": _FAULT_CODE_NAMES[fault] if fault < len(_FAULT_CODE_NAMES) else "UNKNOWN",
+        "bus_ok": bool(flags & _BINARY_FLAG_BUS_OK),
+        "estimator_valid": bool(flags & _BINARY_FLAG_ESTIMATOR_VALID),
+        "voltage": voltage,
+        "current": current,
+        "angles_deg": {
+            leg: list(commanded[3 * index : 3 * index + 3]) for index, leg in enumerate(_BINARY_LEG_ORDER)
+        },
+    }
+
+
 def _is_number(value: Any) -> bool:
     return isinstance(value, (float, int)) and not isinstance(value, bool)
 
@@ -1,6 +1,7 @@
 import asyncio
 import importlib.util
 import pathlib
+import struct
 import sys
 import unittest
 from types import ModuleType, SimpleNamespace
@@ -225,7 +226,41 @@ class TelemetryParserTests(unittest.TestCase):
         self.assertEqual(state.loop_counter, 123)
         self.assertEqual(state.voltage, 11.4)
         self.assertEqual(state.current, 1.8)
-        
+
+    def test_udp_protocol_decodes_binary_control_frames(self):
+        state = server.TelemetryState()
+        updates = []
+        diagnostics = server.Diagnostics()
+        protocol = server.UdpTelemetryProtocol(
+            state, diagnostics, lambda: updates.append(state.to_payload())
+        )
+
+        commanded = [float(i) for i in range(18)]
+        body = struct.pack(
+            "<QIIBBBBff18f18f3f3f6B2x6f",
+            2_500_000, 7, 1250, 3, 3, 0b01, 0, 11.5, 2.25,
+            *commanded, *([0.0] * 18), *([0.0] * 6), *([0] * 6), *([0.0] * 6),
+        )
+        frame = struct.pack("<4sHBB", b"HXT1", 1, 0, 0) + body
+        protocol.datagram_received(frame, ("127.0.0.1", 9000))
+        nav_summary = struct.pack("<4sHBB", b"HXT1", 1, 2, 0) + struct.pack("<QBBBBIIff", 0, 1, 0, 0, 1, 2, 3, 0.5, -1.0)
+        protocol.datagram_received(nav_summary, ("127.0.0.1", 9000))
+        protocol.datagram_received(frame[:-1], ("127.0.0.1", 9000))
+        protocol.datagram_received(b"HXT1" + struct.pack("<HBB", 2, 0, 0) + body, ("127.0.0.1", 9000))
+
+        self.assertEqual(len(updates), 1)
+        self.assertEqual(diagnostics.udp_rejected, 2)
+        self.assertEqual(state.timestamp_ms, 2500)
+        self.assertEqual(state.loop_counter, 1250)
+        self.assertEqual(state.active_mode, "WALK")
+        self.assertEqual(state.active_fault, "TIP_OVER")
+        self.assertTrue(state.bus_ok)
+        self.assertFalse(state.estimator_valid)
+        self.assertEqual(state.voltage, 11.5)
+        self.assertEqual(state.current, 2.25)
+        self.assertEqual(state.angles_deg["LF"], [0.0, 1.0, 2.0])
+        self.assertEqual(state.angles_deg["RR"], [15.0, 16.0, 17.0])
+
     def test_udp_protocol_ignores_unknown_geometry_keys_in_geometry_object(self):
         state = server.TelemetryState()
         diagnostics = server.Diagnostics()
@@ -3,7 +3,7 @@
 
 The locomotion regression suite writes:
   - geometry.json
-  - replay.ndjson
+  - replay.ndjson (or a binary replay.hxrb, converted with hexapod-replay-to-jsonl)
   - summary.json / metrics.json
 
 This helper streams geometry once, then replays each NDJSON control record as a
@@ -16,6 +16,7 @@ from __future__ import annotations
 import argparse
 import json
 import socket
+import subprocess
 import time
 from pathlib import Path
 from typing import Any, Iterable
@@ -35,6 +36,11 @@ def parse_args() -> argparse.Namespace:
     parser.add_argument("--loop", action="store_true", help="Loop playback continuously")
     parser.add_argument("--start-offset-s", type=float, default=0.0, help="Skip frames before this offset")
     parser.add_argument("--frame-delay-ms", type=float, default=0.0, help="Extra delay between frames")
+    parser.add_argument(
+        "--replay-converter",
+        default="hexapod-replay-to-jsonl",
+        help="Converter used when the case only has a binary replay.hxrb",
+    )
     return parser.parse_args()
 
 
@@ -53,23 +59,30 @@ def load_json(path: Path) -> dict[str, Any]:
     return data
 
 
-def load_records(path: Path) -> list[dict[str, Any]]:
-    records: list[dict[str, Any]] = []
+def read_replay_lines(path: Path, converter: str) -> list[str]:
+    if path.suffix == ".hxrb":
+        result = subprocess.run([converter, str(path)], check=True, capture_output=True, text=True)
+        return result.stdout.splitlines()
     with path.open("r", encoding="utf-8") as handle:
-        for line_no, line in enumerate(handle, start=1):
-            line = line.strip()
-            if not line:
-                continue
-            row = json.loads(line)
-            if not isinstance(row, dict):
-                continue
-            if row.get("type") != "replay":
-                continue
-            ts_us = row.get("timestamp_us")
-            if not isinstance(ts_us, int):
-                continue
-            row["_line_no"] = line_no
-            records.append(row)
+        return handle.readlines()
+
+
+def load_records(path: Path, converter: str = "hexapod-replay-to-jsonl") -> list[dict[str, Any]]:
+    records: list[dict[str, Any]] = []
+    for line_no, line in enumerate(read_replay_lines(path, converter), start=1):
+        line = line.strip()
+        if not line:
+            continue
+        row = json.loads(line)
+        if not isinstance(row, dict):
+            continue
+        if row.get("type") != "replay":
+            continue
+        ts_us = row.get("timestamp_us")
+        if not isinstance(ts_us, int):
+            continue
+        row["_line_no"] = line_no
+        records.append(row)
     if not records:
         raise ValueError(f"no replay records found in {path}")
     records.sort(key=lambda item: int(item["timestamp_us"]))
@@ -221,13 +234,15 @@ def main() -> int:
     case_dir = resolve_case_dir(Path(args.artifact_dir), args.case)
     geometry_path = case_dir / "geometry.json"
     replay_path = case_dir / "replay.ndjson"
+    if not replay_path.exists() and (case_dir / "replay.hxrb").exists():
+        replay_path = case_dir / "replay.hxrb"
     if not geometry_path.exists():
         raise FileNotFoundError(f"geometry packet not found: {geometry_path}")
     if not replay_path.exists():
         raise FileNotFoundError(f"replay file not found: {replay_path}")
 
     geometry_packet = load_json(geometry_path)
-    records = filter_start_offset(load_records(replay_path), args.start_offset_s)
+    records = filter_start_offset(load_records(replay_path, args.replay_converter), args.start_offset_s)
     print(
         f"Loaded {len(records)} replay record(s) from {replay_path}; "
         f"streaming geometry + joints to {args.host}:{args.port} at {args.speed:.3f}x"